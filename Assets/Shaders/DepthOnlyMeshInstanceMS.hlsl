@@ -28,9 +28,10 @@ void main(
 
     MeshInstance meshInstance = meshInstanceStorage[gParams.MeshInstanceIdx];
     Mesh mesh = staticMeshStorage[meshInstance.MeshProxyIdx];
-    MeshLod meshLod = mesh.LevelOfDetails[gParams.TargetLevelOfDetail];
+    const uint encodedMeshletIdx = payload.MeshletIndices[groupId];
+    MeshLod meshLod = mesh.LevelOfDetails[DecodePayloadLevelOfDetail(encodedMeshletIdx)];
 
-    Meshlet meshlet = meshletStorage[meshLod.MeshletStorageOffset + payload.MeshletIndices[groupId]];
+    Meshlet meshlet = meshletStorage[meshLod.MeshletStorageOffset + DecodePayloadMeshletIndex(encodedMeshletIdx)];
     uint numIndices = meshlet.NumIndices;
     uint numTriangles = meshlet.NumTriangles;
 
@@ -40,12 +41,11 @@ void main(
     {
         const uint indexStorageIdx = meshLod.IndexStorageOffset + meshlet.IndexOffset + groupThreadId;
         const uint vertexIdx = indexStorage[indexStorageIdx];
-        const uint vertexByteOffset = mad(sizeof(Vertex), vertexIdx, mesh.VertexStorageByteOffset);
-        const Vertex vertex = vertexStorage.Load<Vertex>(vertexByteOffset);
+        const float3 vertexPosition = LoadMeshVertexPosition(vertexStorage, mesh, vertexIdx);
         ZPrePassVertexOutput vertexOutput;
         float4x4 world = transpose(float4x4(meshInstance.ToWorld[0], meshInstance.ToWorld[1], meshInstance.ToWorld[2], float4(0.f, 0.f, 0.f, 1.f)));
         float4x4 worldViewProj = mul(world, perFrameParams.ViewProj);
-        vertexOutput.Position = mul(float4(vertex.Position, 1.f), worldViewProj);
+        vertexOutput.Position = mul(float4(vertexPosition, 1.f), worldViewProj);
         verts[groupThreadId] = vertexOutput;
     }
 
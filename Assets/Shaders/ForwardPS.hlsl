@@ -19,9 +19,19 @@ float4 main(VertexOutput input) : SV_Target
     Material material = materialStorage[meshInstance.MaterialProxyIdx];
 
     const float3 normal = normalize(input.Normal);
-    Texture2D texture = ResourceDescriptorHeap[material.DiffuseTexSrv];
     SamplerState samplerState = SamplerDescriptorHeap[material.DiffuseTexSampler]; // test code material에 sampler도 넣어야함
-    const float3 diffuse = texture.Sample(samplerState, input.TexCoord0).rgb;
+    const float2 diffuseTexCoord = material.DiffuseUvRect.xy + input.TexCoord0 * material.DiffuseUvRect.zw;
+    float3 diffuse;
+    if (material.DiffuseTexSlice == INVALID_TEXTURE_SLICE)
+    {
+        Texture2D texture = ResourceDescriptorHeap[material.DiffuseTexSrv];
+        diffuse = texture.Sample(samplerState, diffuseTexCoord).rgb;
+    }
+    else
+    {
+        Texture2DArray textureArray = ResourceDescriptorHeap[material.DiffuseTexSrv];
+        diffuse = textureArray.Sample(samplerState, float3(diffuseTexCoord, material.DiffuseTexSlice)).rgb;
+    }
 
     float ld = LinearizeDepthReverseZ(input.Position.z, perFrameParams.ViewFrustumParams.z, perFrameParams.ViewFrustumParams.w) / (perFrameParams.ViewFrustumParams.w - perFrameParams.ViewFrustumParams.z);
     uint depthBinIdx = uint(MAX_DEPTH_BIN_IDX_F32 * ld);
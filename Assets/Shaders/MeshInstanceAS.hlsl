@@ -5,7 +5,7 @@ ConstantBuffer<DispatchMeshInstanceParams> gParams : register(b0);
 groupshared MeshInstancePassPayload gPayload;
 
 [NumThreads(MESH_INSTANCE_PASS_AS_GROUP_SIZE, 1, 1)]
-void main(uint dispatchThreadId : SV_DispatchThreadID)
+void main(uint groupThreadId : SV_GroupThreadID, uint groupId : SV_GroupID)
 {
     ConstantBuffer<PerFrameParams> perFrameParams = ResourceDescriptorHeap[gParams.PerFrameParamsCbv];
     ConstantBuffer<UnifiedMeshStorageConstants> unifiedMeshStorageConstants = ResourceDescriptorHeap[gParams.UnifiedMeshStorageConstantsCbv];
@@ -16,24 +16,57 @@ void main(uint dispatchThreadId : SV_DispatchThreadID)
     StructuredBuffer<Meshlet> meshletStorage = ResourceDescriptorHeap[unifiedMeshStorageConstants.MeshletStorageSrv];
     MeshInstance meshInstance = meshInstanceStorage[gParams.MeshInstanceIdx];
     Mesh mesh = staticMeshStorage[meshInstance.MeshProxyIdx];
-    MeshLod meshLod = mesh.LevelOfDetails[gParams.TargetLevelOfDetail];
+
+    /* Cluster LOD 계층인 경우 [TargetLevelOfDetail, NumLevelOfDetails) 의 Meshlet 들이 LOD 별로 Group 단위로 이어서 디스패치 된다. */
+    uint lod = gParams.TargetLevelOfDetail;
+    uint lodGroupId = groupId;
+    if (mesh.bClusterHierarchy)
+    {
+        for (; lod < (mesh.NumLevelOfDetails - 1); ++lod)
+        {
+            const uint numLodGroups = (mesh.LevelOfDetails[lod].NumMeshlets + (MESH_INSTANCE_PASS_AS_GROUP_SIZE - 1)) / MESH_INSTANCE_PASS_AS_GROUP_SIZE;
+            if (lodGroupId < numLodGroups)
+            {
+                break;
+            }
+            lodGroupId -= numLodGroups;
+        }
+    }
+    const uint meshletIdx = mad(lodGroupId, MESH_INSTANCE_PASS_AS_GROUP_SIZE, groupThreadId);
+
+    MeshLod meshLod = mesh.LevelOfDetails[lod];
     const float4x4 worldMat = transpose(float4x4(
         meshInstance.ToWorld[0],
         meshInstance.ToWorld[1],
         meshInstance.ToWorld[2],
         float4(0.f, 0.f, 0.f, 1.f)));
 
-    bool bIsVisible = dispatchThreadId < meshLod.NumMeshlets;
+    bool bIsVisible = meshletIdx < meshLod.NumMeshlets;
     if (bIsVisible)
     {
-        Meshlet meshlet = meshletStorage[meshLod.MeshletStorageOffset + dispatchThreadId];
+        Meshlet meshlet = meshletStorage[meshLod.MeshletStorageOffset + meshletIdx];
+
+        /* Per Meshlet Cluster LOD Selection */
+        /* 자신의 오차는 허용 범위 이내, 부모의 오차는 허용 범위 밖인 Meshlet 만 선택. 가장 세밀한 디스패치 단계는 자신의 오차를 무시한다. */
+        if (mesh.bClusterHierarchy)
+        {
+            const float3 camWorldPos = perFrameParams.CamWorldPosInvAspectRatio.xyz;
+            const float nearZ = perFrameParams.ViewFrustumParams.z;
+            const bool bLodErrorAccepted = (lod == gParams.TargetLevelOfDetail) ||
+                ProjectLodError(meshlet.LodBounds, meshlet.LodError, worldMat, camWorldPos, nearZ, perFrameParams.Proj._m11, perFrameParams.ViewportHeight) <= CLUSTER_LOD_ERROR_THRESHOLD_PIXELS;
+            const bool bParentLodErrorRejected =
+                ProjectLodError(meshlet.ParentLodBounds, meshlet.ParentLodError, worldMat, camWorldPos, nearZ, perFrameParams.Proj._m11, perFrameParams.ViewportHeight) > CLUSTER_LOD_ERROR_THRESHOLD_PIXELS;
+            bIsVisible = bLodErrorAccepted && bParentLodErrorRejected;
+        }
+        /**************************************/
+
         BoundingSphere worldBoundingSphere = TransformBoundingSphere(meshlet.BoundingVolume, worldMat);
         BoundingSphere viewBoundingSphere;
         viewBoundingSphere.Center = mul(float4(worldBoundingSphere.Center, 1.f), perFrameParams.View).xyz;
         viewBoundingSphere.Radius = worldBoundingSphere.Radius + MESHLET_CONSERVATIVE_BOUDNING_RADIUS;
 
         /* Per Meshlet Frustum Culling */
-        bIsVisible = IntersectFrustum(
+        bIsVisible &= IntersectFrustum(
             perFrameParams.CamWorldPosInvAspectRatio.w,
             perFrameParams.ViewFrustumParams,
             viewBoundingSphere);
@@ -100,7 +133,7 @@ void main(uint dispatchThreadId : SV_DispatchThreadID)
     if (bIsVisible)
     {
         const uint idx = WavePrefixCountBits(bIsVisible);
-        gPayload.MeshletIndices[idx] = dispatchThreadId;
+        gPayload.MeshletIndices[idx] = EncodePayloadMeshletIndex(lod, meshletIdx);
     }
 
     const uint numVisibleMeshlets = WaveActiveCountBits(bIsVisible);
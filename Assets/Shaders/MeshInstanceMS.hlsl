@@ -23,9 +23,10 @@ void main(
 
     MeshInstance meshInstance = meshInstanceStorage[gParams.MeshInstanceIdx];
     Mesh mesh = staticMeshStorage[meshInstance.MeshProxyIdx];
-    MeshLod meshLod = mesh.LevelOfDetails[gParams.TargetLevelOfDetail];
+    const uint encodedMeshletIdx = payload.MeshletIndices[groupId];
+    MeshLod meshLod = mesh.LevelOfDetails[DecodePayloadLevelOfDetail(encodedMeshletIdx)];
 
-    Meshlet meshlet = meshletStorage[meshLod.MeshletStorageOffset + payload.MeshletIndices[groupId]];
+    Meshlet meshlet = meshletStorage[meshLod.MeshletStorageOffset + DecodePayloadMeshletIndex(encodedMeshletIdx)];
     uint numIndices = meshlet.NumIndices;
     uint numTriangles = meshlet.NumTriangles;
 
@@ -35,14 +36,13 @@ void main(
     {
         const uint indexStorageIdx = meshLod.IndexStorageOffset + meshlet.IndexOffset + groupThreadId;
         const uint vertexIdx = indexStorage[indexStorageIdx];
-        const uint vertexByteOffset = mad(sizeof(Vertex), vertexIdx, mesh.VertexStorageByteOffset);
-        const Vertex vertex = vertexStorage.Load<Vertex>(vertexByteOffset);
+        const MeshVertex vertex = LoadMeshVertex(vertexStorage, mesh, vertexIdx);
         VertexOutput vertexOutput;
         float4x4 world = transpose(float4x4(meshInstance.ToWorld[0], meshInstance.ToWorld[1], meshInstance.ToWorld[2], float4(0.f, 0.f, 0.f, 1.f)));
         float4x4 worldViewProj = mul(world, perFrameParams.ViewProj);
         vertexOutput.Position = mul(float4(vertex.Position, 1.f), worldViewProj);
-        vertexOutput.Normal = mul(float4(DecodeNormalX10Y10Z10(vertex.QuantizedNormal), 0.f), world).xyz;
-        vertexOutput.TexCoord0 = vertex.QuantizedTexCoords;
+        vertexOutput.Normal = mul(float4(vertex.Normal, 0.f), world).xyz;
+        vertexOutput.TexCoord0 = vertex.TexCoord0;
         vertexOutput.WorldPosition = mul(float4(vertex.Position, 1.f), world).xyz;
         verts[groupThreadId] = vertexOutput;
     }
@@ -6,12 +6,99 @@
 #include "Constants.hlsli"
 
 #define MESH_INSTANCE_PASS_AS_GROUP_SIZE 32
+/* Payload 의 Meshlet 인덱스 상위 3비트에 Meshlet이 속한 LOD를 기록 한다. */
+#define MESH_INSTANCE_PASS_PAYLOAD_LOD_SHIFT 29
+#define MESH_INSTANCE_PASS_PAYLOAD_MESHLET_MASK ((1u << MESH_INSTANCE_PASS_PAYLOAD_LOD_SHIFT) - 1u)
+/* Cluster LOD 계층에서 허용 되는 화면 공간 오차 (픽셀) */
+#define CLUSTER_LOD_ERROR_THRESHOLD_PIXELS 1.f
 
 struct MeshInstancePassPayload
 {
     uint MeshletIndices[MESH_INSTANCE_PASS_AS_GROUP_SIZE];
 };
 
+uint EncodePayloadMeshletIndex(uint lod, uint meshletIdx)
+{
+    return (lod << MESH_INSTANCE_PASS_PAYLOAD_LOD_SHIFT) | meshletIdx;
+}
+
+uint DecodePayloadLevelOfDetail(uint encodedMeshletIdx)
+{
+    return encodedMeshletIdx >> MESH_INSTANCE_PASS_PAYLOAD_LOD_SHIFT;
+}
+
+uint DecodePayloadMeshletIndex(uint encodedMeshletIdx)
+{
+    return encodedMeshletIdx & MESH_INSTANCE_PASS_PAYLOAD_MESHLET_MASK;
+}
+
+/* 메시 로컬 공간의 LOD 오차 경계를 화면 공간 오차(픽셀)로 투영. 카메라가 경계 내부에 있다면 Near 평면 거리를 사용한다. */
+float ProjectLodError(BoundingSphere lodBounds, float lodError, float4x4 worldMat, float3 camWorldPos, float nearZ, float projScaleY, float viewportHeight)
+{
+    if (lodError >= FLT_MAX)
+    {
+        return FLT_MAX;
+    }
+
+    const BoundingSphere worldLodBounds = TransformBoundingSphere(lodBounds, worldMat);
+    const float worldLodError = lodError * ExtractMaxAbsScale(worldMat);
+    const float distance = max(length(worldLodBounds.Center - camWorldPos) - worldLodBounds.Radius, nearZ);
+    return (worldLodError / distance) * projScaleY * viewportHeight * 0.5f;
+}
+
+struct MeshVertex
+{
+    float3 Position;
+    float3 Normal;
+    float2 TexCoord0;
+};
+
+float3 DequantizeMeshVertexPosition(Mesh mesh, uint2 quantizedPosition)
+{
+    const float3 unorm = float3(quantizedPosition.x & 0xFFFF, quantizedPosition.x >> 16, quantizedPosition.y & 0xFFFF) * (1.f / 65535.f);
+    return mad(unorm, mesh.PositionDequantizeScale, mesh.PositionDequantizeOffset);
+}
+
+/* Mesh::VertexFormat 에 따라 정점을 읽어 메시 로컬 공간의 값으로 복원 한다. */
+MeshVertex LoadMeshVertex(ByteAddressBuffer vertexStorage, Mesh mesh, uint vertexIdx)
+{
+    MeshVertex meshVertex;
+    if (mesh.VertexFormat == VERTEX_FORMAT_FULL)
+    {
+        const Vertex vertex = vertexStorage.Load<Vertex>(mad(sizeof(Vertex), vertexIdx, mesh.VertexStorageByteOffset));
+        meshVertex.Position = vertex.Position;
+        meshVertex.Normal = DecodeNormalX10Y10Z10(vertex.QuantizedNormal);
+        meshVertex.TexCoord0 = vertex.QuantizedTexCoords;
+        return meshVertex;
+    }
+
+    const QuantizedVertex vertex = vertexStorage.Load<QuantizedVertex>(mad(sizeof(QuantizedVertex), vertexIdx, mesh.VertexStorageByteOffset));
+    meshVertex.Position = DequantizeMeshVertexPosition(mesh, vertex.QuantizedPosition);
+    meshVertex.Normal = DecodeTangentFrameNormal(vertex.TangentFrame);
+    if (mesh.VertexFormat == VERTEX_FORMAT_QUANTIZED_UNORM_TEXCOORDS)
+    {
+        const float2 unorm = float2(vertex.QuantizedTexCoords & 0xFFFF, vertex.QuantizedTexCoords >> 16) * (1.f / 65535.f);
+        meshVertex.TexCoord0 = mad(unorm, mesh.TexCoordDequantizeScale, mesh.TexCoordDequantizeOffset);
+    }
+    else
+    {
+        meshVertex.TexCoord0 = float2(f16tof32(vertex.QuantizedTexCoords), f16tof32(vertex.QuantizedTexCoords >> 16));
+    }
+
+    return meshVertex;
+}
+
+/* Depth Only 패스 용; 위치만 읽는다. */
+float3 LoadMeshVertexPosition(ByteAddressBuffer vertexStorage, Mesh mesh, uint vertexIdx)
+{
+    if (mesh.VertexFormat == VERTEX_FORMAT_FULL)
+    {
+        return vertexStorage.Load<float3>(mad(sizeof(Vertex), vertexIdx, mesh.VertexStorageByteOffset));
+    }
+
+    return DequantizeMeshVertexPosition(mesh, vertexStorage.Load<uint2>(mad(sizeof(QuantizedVertex), vertexIdx, mesh.VertexStorageByteOffset)));
+}
+
 struct VertexOutput
 {
     float4 Position : SV_Position;
@@ -132,6 +132,8 @@ void main(uint3 DTid : SV_DispatchThreadID)
         targetLevelOfDetail = MapScreenCoverageToLodAuto(screenCoverage, mesh.NumLevelOfDetails);
     }
     targetLevelOfDetail = min(targetLevelOfDetail, mesh.NumLevelOfDetails - 1);
+    /* 요청된 LOD가 아직 스트리밍 되지 않았다면, 상주 중인 가장 세밀한 LOD로 대체 */
+    targetLevelOfDetail = max(targetLevelOfDetail, mesh.MinResidentLevelOfDetail);
     /**************************************/
 
     MeshLod meshLod = mesh.LevelOfDetails[targetLevelOfDetail];
@@ -143,6 +145,14 @@ void main(uint3 DTid : SV_DispatchThreadID)
     newDispatchMeshInstance.Params.SceneProxyConstantsCbv = gMeshInstanceParams.SceneProxyConstantsCbv;
     newDispatchMeshInstance.Params.DepthPyramidParamsCbv = gMeshInstanceParams.DepthPyramidParamsCbv;
     newDispatchMeshInstance.ThreadGroupCountX = (meshLod.NumMeshlets + 31) / 32;
+    /* Cluster LOD 계층인 경우 더 거친 단계의 Meshlet 들도 함께 디스패치하여, AS 에서 Meshlet 단위로 LOD를 선택 한다. */
+    if (mesh.bClusterHierarchy)
+    {
+        for (uint coarserLod = targetLevelOfDetail + 1; coarserLod < mesh.NumLevelOfDetails; ++coarserLod)
+        {
+            newDispatchMeshInstance.ThreadGroupCountX += (mesh.LevelOfDetails[coarserLod].NumMeshlets + 31) / 32;
+        }
+    }
     newDispatchMeshInstance.ThreadGroupCountY = 1;
     newDispatchMeshInstance.ThreadGroupCountZ = 1;
 
@@ -76,10 +76,14 @@ struct Light
     float3 Forward;
 };
 
+#define INVALID_TEXTURE_SLICE 0xFFFFFFFF
+
 struct Material
 {
     uint DiffuseTexSrv;
     uint DiffuseTexSampler;
+    uint DiffuseTexSlice;   /* 텍스처 배열에 패킹 된 서브 텍스처의 Slice, 아니라면 INVALID_TEXTURE_SLICE */
+    float4 DiffuseUvRect;   /* xy: Offset, zw: Scale; 아틀라스에 패킹 된 서브 텍스처의 UV 영역 */
 };
 
 struct Vertex
@@ -92,6 +96,18 @@ struct Vertex
     uint ColorRGBA8;          /* R8G8B8A8_UINT */
 };
 
+/* ig::EVertexFormat */
+#define VERTEX_FORMAT_FULL 0
+#define VERTEX_FORMAT_QUANTIZED 1
+#define VERTEX_FORMAT_QUANTIZED_UNORM_TEXCOORDS 2
+
+struct QuantizedVertex
+{
+    uint2 QuantizedPosition;  /* x: 16 Bits, y: 16 Bits, z: 16 Bits, Pad: 16 Bits; Mesh AABB 에 대한 Unorm16 */
+    uint TangentFrame;        /* Octahedral Normal(10 Bits, 10 Bits), Tangent Angle: 11 Bits, Bitangent Sign: 1 Bit */
+    uint QuantizedTexCoords;  /* VERTEX_FORMAT_QUANTIZED: half2, VERTEX_FORMAT_QUANTIZED_UNORM_TEXCOORDS: Unorm16x2 */
+};
+
 struct BoundingSphere
 {
     float3 Center;
@@ -112,6 +128,12 @@ struct Meshlet
     BoundingSphere BoundingVolume;
 
     uint EncodedNormalCone;
+
+    /* Cluster LOD 오차 경계 (메시 로컬 공간) */
+    BoundingSphere LodBounds;
+    float LodError;
+    BoundingSphere ParentLodBounds;
+    float ParentLodError;
 };
 
 struct MeshLod
@@ -133,7 +155,14 @@ struct Mesh
 
     uint bOverrideLodScreenCoverageThreshold;
     float LodScreenCoverageThresholds[MAX_MESH_LEVEL_OF_DETAILS];;
-    uint Padding;
+    uint MinResidentLevelOfDetail;
+    uint bClusterHierarchy;
+
+    uint VertexFormat;
+    float3 PositionDequantizeOffset;
+    float3 PositionDequantizeScale;
+    float2 TexCoordDequantizeOffset;
+    float2 TexCoordDequantizeScale;
 };
 
 #define MESH_TYPE_STATIC 0
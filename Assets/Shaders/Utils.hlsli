@@ -53,6 +53,23 @@ float3 DecodeNormalX10Y10Z10(uint encodedNormal)
         (float((encodedNormal >> 20) & 0x3FF) * kInvFactor) - 1.f);
 }
 
+/* [-1, 1]^2 -> 단위 벡터; ig::DecodeOctahedral 과 동일 */
+float3 DecodeOctahedral(float2 encoded)
+{
+    float3 normal = float3(encoded.x, encoded.y, 1.f - abs(encoded.x) - abs(encoded.y));
+    const float t = saturate(-normal.z);
+    normal.x += normal.x >= 0.f ? -t : t;
+    normal.y += normal.y >= 0.f ? -t : t;
+    return normalize(normal);
+}
+
+/* ig::EncodeTangentFrame 의 Normal 부분만 복원 */
+float3 DecodeTangentFrameNormal(uint tangentFrame)
+{
+    const static float kInvFactor = 1.f / 1023.f;
+    return DecodeOctahedral(float2(float(tangentFrame & 0x3FF), float((tangentFrame >> 10) & 0x3FF)) * (2.f * kInvFactor) - 1.f);
+}
+
 uint BitfieldMask(uint width, uint min)
 {
     return (uint(0xFFFFFFFF) >> (32 - width)) << min;
@@ -1,6 +1,7 @@
 #include "Frieren/Frieren.h"
 #include "Igniter/Core/Engine.h"
 #include "Igniter/Core/Timer.h"
+#include "Igniter/Core/Memory.h"
 #include "Igniter/Core/FrameManager.h"
 #include "Igniter/D3D12/GpuBuffer.h"
 #include "Igniter/D3D12/GpuTextureDesc.h"
@@ -53,10 +54,29 @@ namespace fe
         if (ImGui::BeginMenuBar())
         {
             RenderFilterMenu();
+            RenderCacheMenu();
             ImGui::EndMenuBar();
         }
     }
 
+    void AssetInspector::RenderCacheMenu()
+    {
+        if (ImGui::BeginMenu("Cache"))
+        {
+            ig::AssetManager& assetManager{ig::Engine::GetAssetManager()};
+            if (ImGui::MenuItem("Trim Keep-Alive"))
+            {
+                assetManager.TrimKeepAlive(mainTableAssetFilter);
+            }
+
+            if (ImGui::MenuItem("Reset Statistics"))
+            {
+                assetManager.ResetCacheStatistics();
+            }
+            ImGui::EndMenu();
+        }
+    }
+
     void AssetInspector::RenderFilterMenu()
     {
         if (ImGui::BeginMenu("Filters"))
@@ -130,6 +150,35 @@ namespace fe
                 std::format("#Imported Assets: {}\t#Cached Assets: {}", snapshots.size(), std::count_if(snapshots.begin(), snapshots.end(), IsCached))
                 .c_str());
         }
+
+        RenderCacheStats();
+    }
+
+    void AssetInspector::RenderCacheStats()
+    {
+        if (!ImGui::TreeNode("Cache Statistics"))
+        {
+            return;
+        }
+
+        const ig::AssetManager& assetManager{ig::Engine::GetAssetManager()};
+        for (const auto category : magic_enum::enum_values<ig::EAssetCategory>())
+        {
+            if (category == ig::EAssetCategory::Unknown ||
+                (mainTableAssetFilter != ig::EAssetCategory::Unknown && mainTableAssetFilter != category))
+            {
+                continue;
+            }
+
+            const ig::AssetManager::CacheStatistics stats{assetManager.GetCacheStatistics(category)};
+            const ig::Size numRequests = stats.NumHits + stats.NumMisses;
+            const float hitRatio = numRequests > 0 ? static_cast<float>(stats.NumHits) / numRequests : 0.f;
+            ImGui::Text(std::format("{}: Hits {} (Keep-Alive {}) / Misses {} ({:.1f}%)\tEvictions {}\tKept Alive {} ({:.2f}/{:.2f} MB)",
+                category, stats.NumHits, stats.NumKeepAliveHits, stats.NumMisses, hitRatio * 100.f, stats.NumEvictions,
+                stats.NumKeptAlive, ig::BytesToMegaBytes(stats.KeptAliveBytes), ig::BytesToMegaBytes(stats.KeepAliveBudget)).c_str());
+        }
+
+        ImGui::TreePop();
     }
 
     void AssetInspector::RenderAssetTable(const ig::EAssetCategory assetCategoryFilter, int& selectedIdx, bool* bSelectionDirtyFlagPtr)
@@ -228,7 +277,14 @@ namespace fe
                     ImGui::TableNextColumn();
                     ImGui::Text(ToCStr(snapshot.Info.GetScope()));
                     ImGui::TableNextColumn();
-                    ImGui::Text("%u", snapshot.RefCount);
+                    if (snapshot.bIsKeptAlive)
+                    {
+                        ImGui::Text("%u (Kept Alive)", snapshot.RefCount);
+                    }
+                    else
+                    {
+                        ImGui::Text("%u", snapshot.RefCount);
+                    }
                 }
             }
             ImGui::EndTable();
@@ -371,6 +427,7 @@ namespace fe
                     }
                 }
 
+                ImGui::Text("Simplification Error: %.6f", loadDescOpt->LevelOfDetailErrors[lod]);
                 ImGui::Text("Num Meshlet Vertices: %u", loadDescOpt->NumMeshletVertexIndices[lod]);
                 ImGui::Text("Num Meshlet Triangles: %u", loadDescOpt->NumMeshletTriangles[lod]);
                 ImGui::Text("Num Meshlets: %u", loadDescOpt->NumMeshlets[lod]);
@@ -20,8 +20,10 @@ namespace fe
       private:
         void RenderMenuBar();
         void RenderFilterMenu();
+        void RenderCacheMenu();
         void RenderMainFrame();
         void RenderAssetStats();
+        void RenderCacheStats();
         void RenderAssetTable(const ig::EAssetCategory assetCategoryFilter, int& selectedIdx, bool* bSelectionDirtyFlagPtr = nullptr);
         void RenderInspector();
         void RenderEdit(const ig::AssetInfo& assetInfo);
@@ -87,6 +87,26 @@ namespace fe
                     }
                 }
 
+                ImGui::Separator();
+                ig::AssetManager& assetManager = ig::Engine::GetAssetManager();
+                if (ImGui::MenuItem("Build Asset Package", nullptr, nullptr, !assetManager.IsPackageMounted()))
+                {
+                    assetManager.SaveAllChanges();
+                    assetManager.BuildPackage();
+                }
+
+                if (ImGui::MenuItem("Mount Asset Package", nullptr, assetManager.IsPackageMounted()))
+                {
+                    if (assetManager.IsPackageMounted())
+                    {
+                        assetManager.UnmountPackage();
+                    }
+                    else
+                    {
+                        assetManager.MountPackage();
+                    }
+                }
+
                 ImGui::EndMenu();
             }
 
@@ -1,6 +1,7 @@
 #include "Frieren/Frieren.h"
 #include "Igniter/Core/Engine.h"
 #include "Igniter/Asset/AssetManager.h"
+#include "Igniter/ImGui/ImGuiExtensions.h"
 #include "Frieren/Gui/StaticMeshImportPanel.h"
 
 namespace fe
@@ -25,12 +26,23 @@ namespace fe
             ImGui::Checkbox("Flip UV Coordinates", &config.bFlipUVs);
             ImGui::Checkbox("Flip Winding Order", &config.bFlipWindingOrder);
             ImGui::Checkbox("Split Large Meshes", &config.bSplitLargeMeshes);
+            ImGui::Checkbox("Import As Scene", &config.bImportAsScene);
+            ImGui::BeginDisabled(config.bImportAsScene);
             ImGui::Checkbox("Pre-Transform Vertices", &config.bPreTransformVertices);
+            ImGui::EndDisabled();
             ImGui::Checkbox("Improve Cache Locality", &config.bImproveCacheLocality);
             ImGui::Checkbox("Generate UV Coordinates", &config.bGenerateUVCoords);
             ImGui::Checkbox("Generate Bounding Boxes", &config.bGenerateBoundingBoxes);
             ImGui::Checkbox("Import Materials", &config.bImportMaterials);
             ImGui::Checkbox("Generate LODs", &config.bGenerateLODs);
+            ImGui::BeginDisabled(!config.bGenerateLODs);
+            ImGui::Checkbox("Build Cluster Hierarchy", &config.bBuildClusterHierarchy);
+            ImGui::EndDisabled();
+
+            if (ig::ImGuiX::BeginEnumCombo<ig::EVertexFormat>("Vertex Format", config.VertexFormat))
+            {
+                ig::ImGuiX::EndEnumCombo();
+            }
 
             if (ImGui::Button("Import"))
             {
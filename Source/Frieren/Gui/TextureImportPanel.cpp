@@ -27,6 +27,11 @@ namespace fe
                 ig::ImGuiX::EndEnumCombo();
             }
 
+            if (ig::ImGuiX::BeginEnumCombo<ig::ETextureCompressionQuality>("Compression Quality", config.CompressionQuality))
+            {
+                ig::ImGuiX::EndEnumCombo();
+            }
+
             ImGui::Checkbox("Generate Mips", &config.bGenerateMips);
 
             if (ig::ImGuiX::BeginEnumCombo<D3D12_FILTER>("Filter", selectedFilterIdx))
@@ -0,0 +1,87 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Timer.h"
+#include "Igniter/Animation/AnimationSampler.h"
+
+namespace ig
+{
+    AnimationBinding::AnimationBinding(const AnimationClip& clip, const Skeleton& skeleton)
+        : clip(&clip)
+        , skeleton(&skeleton)
+        , boneTracks(skeleton.GetNumBones(), InvalidIndexU32)
+    {
+        for (Index boneIdx = 0; boneIdx < skeleton.GetNumBones(); ++boneIdx)
+        {
+            boneTracks[boneIdx] = clip.FindTrack(skeleton.BoneNames[boneIdx]);
+        }
+    }
+
+    AnimationSampler::AnimationSampler(tf::Executor& taskExecutor)
+        : taskExecutor(taskExecutor)
+    {}
+
+    void AnimationSampler::Sample(const std::span<const AnimationSampleRequest> requests, const std::span<PackedBoneMatrix> outSkinningMatrices)
+    {
+        const Size sampleBegin = Timer::Now<std::chrono::microseconds>();
+
+        tf::Taskflow sampleFlow;
+        sampleFlow.for_each_index(
+            0, (S32)requests.size(), 1,
+            [requests, outSkinningMatrices](const Index requestIdx)
+            {
+                SamplePose(requests[requestIdx], outSkinningMatrices);
+            });
+        taskExecutor.run(sampleFlow).wait();
+
+        lastSampleMicroseconds = Timer::Now<std::chrono::microseconds>() - sampleBegin;
+    }
+
+    void AnimationSampler::SamplePose(const AnimationSampleRequest& request, const std::span<PackedBoneMatrix> outSkinningMatrices)
+    {
+        using namespace DirectX;
+
+        IG_CHECK(request.Binding != nullptr);
+        const AnimationBinding& binding{*request.Binding};
+        const AnimationClip& clip{binding.GetClip()};
+        const Skeleton& skeleton{binding.GetSkeleton()};
+        const std::span<const U32> boneTracks{binding.GetBoneTracks()};
+        const Size numBones = skeleton.GetNumBones();
+        IG_CHECK(numBones <= Skeleton::kMaxBones);
+        IG_CHECK(request.OutputOffset + numBones <= outSkinningMatrices.size());
+
+        U32 frame0 = 0;
+        U32 frame1 = 0;
+        F32 alpha = 0.f;
+        clip.ComputeFramePosition(request.Time, request.bLoop, frame0, frame1, alpha);
+
+        /* 부모가 항상 자식 보다 앞선 인덱스를 가지므로, 한 번의 순회로 메시 공간 변환을 누적 할 수 있다. */
+        XMMATRIX globalTransforms[Skeleton::kMaxBones];
+        const XMMATRIX rootTransform{XMLoadFloat4x4(&skeleton.RootTransform)};
+        for (Size boneIdx = 0; boneIdx < numBones; ++boneIdx)
+        {
+            const U32 trackIdx = boneTracks[boneIdx];
+            const U32 parentIdx = skeleton.ParentIndices[boneIdx];
+            XMMATRIX localTransform{};
+            if (trackIdx != InvalidIndexU32)
+            {
+                const AnimationTransform sampled{clip.SampleTrack(trackIdx, frame0, frame1, alpha)};
+                localTransform = XMMatrixAffineTransformation(
+                    XMLoadFloat3(&sampled.Scale), XMVectorZero(), XMLoadFloat4(&sampled.Rotation), XMLoadFloat3(&sampled.Translation));
+                /* 트랙은 씬 루트 노드에 대한 로컬 변환 이므로, 루트 Bone 의 경우 메시 공간으로 옮긴다. */
+                if (parentIdx == InvalidIndexU32)
+                {
+                    localTransform = XMMatrixMultiply(localTransform, rootTransform);
+                }
+            }
+            else
+            {
+                localTransform = XMLoadFloat4x4(&skeleton.BindLocalTransforms[boneIdx]);
+            }
+
+            IG_CHECK(parentIdx == InvalidIndexU32 || parentIdx < boneIdx);
+            globalTransforms[boneIdx] = parentIdx == InvalidIndexU32 ? localTransform : XMMatrixMultiply(localTransform, globalTransforms[parentIdx]);
+
+            const XMMATRIX skinningMatrix{XMMatrixMultiply(XMLoadFloat4x4(&skeleton.InverseBindMatrices[boneIdx]), globalTransforms[boneIdx])};
+            XMStoreFloat3x4(&outSkinningMatrices[request.OutputOffset + boneIdx], skinningMatrix);
+        }
+    }
+} // namespace ig
@@ -0,0 +1,73 @@
+#pragma once
+#include "Igniter/Asset/AnimationClip.h"
+#include "Igniter/Asset/SkeletalMesh.h"
+
+namespace ig
+{
+    /* XMStoreFloat3x4 로 전치 되어 기록 된 Skinning 행렬; 셰이더에서 float3x4 로 읽어 mul(M, float4(Position, 1)) 로 사용 한다. */
+    using PackedBoneMatrix = DirectX::XMFLOAT3X4;
+    static_assert(sizeof(PackedBoneMatrix) == sizeof(F32) * 12);
+
+    /*
+     * 클립의 트랙과 스켈레톤의 Bone 사이의 대응. 클립/스켈레톤 쌍 마다 한 번 생성 하여 재사용 한다.
+     * 클립과 스켈레톤(스켈레탈 메시)은 바인딩 보다 오래 유지 되어야 한다.
+     */
+    class AnimationBinding final
+    {
+    public:
+        AnimationBinding(const AnimationClip& clip, const Skeleton& skeleton);
+        AnimationBinding(const AnimationBinding&) = default;
+        AnimationBinding(AnimationBinding&&) noexcept = default;
+        ~AnimationBinding() = default;
+
+        AnimationBinding& operator=(const AnimationBinding&) = default;
+        AnimationBinding& operator=(AnimationBinding&&) noexcept = default;
+
+        [[nodiscard]] const AnimationClip& GetClip() const noexcept { return *clip; }
+        [[nodiscard]] const Skeleton& GetSkeleton() const noexcept { return *skeleton; }
+        /* Bone 인덱스 -> 트랙 인덱스; 트랙이 없는 Bone 은 InvalidIndexU32 이며 Bind Pose 를 유지 한다. */
+        [[nodiscard]] std::span<const U32> GetBoneTracks() const noexcept { return boneTracks; }
+
+    private:
+        const AnimationClip* clip = nullptr;
+        const Skeleton* skeleton = nullptr;
+        Vector<U32> boneTracks;
+    };
+
+    struct AnimationSampleRequest
+    {
+    public:
+        const AnimationBinding* Binding = nullptr;
+        F32 Time = 0.f;
+        bool bLoop = true;
+        /* 출력 버퍼 내에서 이 포즈의 Skinning 행렬(NumBones 개)이 기록 될 위치 */
+        U32 OutputOffset = 0;
+    };
+
+    /*
+     * #sy_note 포즈 샘플링
+     * 요청(인스턴스) 단위로 Task Executor 에 분배 하며, 각 포즈는 DirectXMath(SIMD) 로 평가 한다.
+     * 트랙 복원 => 로컬 변환 합성 => 계층 누적 => Skinning 행렬 까지 하나의 순회로 처리 하여, 중간 포즈를 메모리에 기록 하지 않는다.
+     */
+    class AnimationSampler final
+    {
+    public:
+        explicit AnimationSampler(tf::Executor& taskExecutor);
+        AnimationSampler(const AnimationSampler&) = delete;
+        AnimationSampler(AnimationSampler&&) noexcept = delete;
+        ~AnimationSampler() = default;
+
+        AnimationSampler& operator=(const AnimationSampler&) = delete;
+        AnimationSampler& operator=(AnimationSampler&&) noexcept = delete;
+
+        /* 모든 요청을 병렬로 평가 한다. 요청들의 출력 구간은 서로 겹치지 않아야 한다. */
+        void Sample(const std::span<const AnimationSampleRequest> requests, const std::span<PackedBoneMatrix> outSkinningMatrices);
+        [[nodiscard]] Size GetLastSampleMicroseconds() const noexcept { return lastSampleMicroseconds; }
+
+        static void SamplePose(const AnimationSampleRequest& request, const std::span<PackedBoneMatrix> outSkinningMatrices);
+
+    private:
+        tf::Executor& taskExecutor;
+        Size lastSampleMicroseconds = 0;
+    };
+} // namespace ig
@@ -0,0 +1,124 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Json.h"
+#include "Igniter/Asset/AnimationClip.h"
+
+namespace ig
+{
+    Json& AnimationClipImportDesc::Serialize(Json& archive) const
+    {
+        IG_SERIALIZE_TO_JSON(AnimationClipImportDesc, archive, bMakeLeftHanded);
+        IG_SERIALIZE_TO_JSON(AnimationClipImportDesc, archive, SampleRate);
+        IG_SERIALIZE_TO_JSON(AnimationClipImportDesc, archive, MaxTranslationError);
+        IG_SERIALIZE_TO_JSON(AnimationClipImportDesc, archive, MaxRotationError);
+        IG_SERIALIZE_TO_JSON(AnimationClipImportDesc, archive, MaxScaleError);
+        return archive;
+    }
+
+    const Json& AnimationClipImportDesc::Deserialize(const Json& archive)
+    {
+        *this = {};
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipImportDesc, archive, bMakeLeftHanded);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipImportDesc, archive, SampleRate);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipImportDesc, archive, MaxTranslationError);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipImportDesc, archive, MaxRotationError);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipImportDesc, archive, MaxScaleError);
+        return archive;
+    }
+
+    Json& AnimationClipLoadDesc::Serialize(Json& archive) const
+    {
+        IG_SERIALIZE_TO_JSON(AnimationClipLoadDesc, archive, NumFrames);
+        IG_SERIALIZE_TO_JSON(AnimationClipLoadDesc, archive, SampleRate);
+        IG_SERIALIZE_TO_JSON(AnimationClipLoadDesc, archive, Duration);
+        IG_SERIALIZE_TO_JSON(AnimationClipLoadDesc, archive, FrameBitSize);
+        IG_SERIALIZE_TO_JSON(AnimationClipLoadDesc, archive, TrackNames);
+        return archive;
+    }
+
+    const Json& AnimationClipLoadDesc::Deserialize(const Json& archive)
+    {
+        *this = {};
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipLoadDesc, archive, NumFrames);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipLoadDesc, archive, SampleRate);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipLoadDesc, archive, Duration);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipLoadDesc, archive, FrameBitSize);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(AnimationClipLoadDesc, archive, TrackNames);
+        return archive;
+    }
+
+    AnimationClip::AnimationClip(const Desc& snapshot, Vector<AnimationSubTrack> subTracks, Vector<U8> packedFrames)
+        : snapshot(snapshot)
+        , subTracks(std::move(subTracks))
+        , packedFrames(std::move(packedFrames))
+    {
+        IG_CHECK(this->subTracks.size() == snapshot.LoadDescriptor.GetNumSubTracks());
+        IG_CHECK(this->packedFrames.size() == snapshot.LoadDescriptor.GetPackedFramesSize());
+    }
+
+    U32 AnimationClip::FindTrack(const std::string_view trackName) const
+    {
+        const std::span<const std::string> trackNames{GetTrackNames()};
+        for (Index trackIdx = 0; trackIdx < trackNames.size(); ++trackIdx)
+        {
+            if (trackNames[trackIdx] == trackName)
+            {
+                return (U32)trackIdx;
+            }
+        }
+
+        return InvalidIndexU32;
+    }
+
+    void AnimationClip::ComputeFramePosition(const F32 time, const bool bLoop, U32& frame0, U32& frame1, F32& alpha) const
+    {
+        const AnimationClipLoadDesc& loadDesc{snapshot.LoadDescriptor};
+        IG_CHECK(loadDesc.NumFrames > 0);
+
+        F32 clipTime = time;
+        if (bLoop && loadDesc.Duration > 0.f)
+        {
+            clipTime = std::fmod(time, loadDesc.Duration);
+            if (clipTime < 0.f)
+            {
+                clipTime += loadDesc.Duration;
+            }
+        }
+
+        const F32 framePosition = std::clamp(clipTime * loadDesc.SampleRate, 0.f, (F32)(loadDesc.NumFrames - 1));
+        frame0 = std::min((U32)framePosition, loadDesc.NumFrames - 1);
+        frame1 = std::min(frame0 + 1, loadDesc.NumFrames - 1);
+        alpha = framePosition - (F32)frame0;
+    }
+
+    AnimationTransform AnimationClip::SampleTrack(const U32 trackIdx, const U32 frame0, const U32 frame1, const F32 alpha) const
+    {
+        const AnimationTransform transform0{DecodeTrack(trackIdx, frame0)};
+        if (frame0 == frame1 || alpha <= 0.f)
+        {
+            return transform0;
+        }
+
+        /* Quaternion::Lerp 는 최단 경로로 보간 한 후 정규화 한다. (nlerp) */
+        const AnimationTransform transform1{DecodeTrack(trackIdx, frame1)};
+        return AnimationTransform{
+            .Rotation = Quaternion::Lerp(transform0.Rotation, transform1.Rotation, alpha),
+            .Translation = Vector3::Lerp(transform0.Translation, transform1.Translation, alpha),
+            .Scale = Vector3::Lerp(transform0.Scale, transform1.Scale, alpha)};
+    }
+
+    AnimationTransform AnimationClip::DecodeTrack(const U32 trackIdx, const U32 frame) const
+    {
+        const AnimationClipLoadDesc& loadDesc{snapshot.LoadDescriptor};
+        IG_CHECK(trackIdx < loadDesc.GetNumTracks());
+        IG_CHECK(frame < loadDesc.NumFrames);
+
+        constexpr Size kNumSubTracksPerTrack = magic_enum::enum_count<EAnimationSubTrack>();
+        const AnimationSubTrack* trackSubTracks = subTracks.data() + (trackIdx * kNumSubTracksPerTrack);
+        const Size frameBitOffset = (Size)frame * loadDesc.FrameBitSize;
+        const std::span<const U8> frames{packedFrames.data(), packedFrames.size()};
+        return AnimationTransform{
+            .Rotation = details::RestoreQuaternionW(details::DecodeSubTrack(trackSubTracks[(Size)EAnimationSubTrack::Rotation], frames, frameBitOffset)),
+            .Translation = details::DecodeSubTrack(trackSubTracks[(Size)EAnimationSubTrack::Translation], frames, frameBitOffset),
+            .Scale = details::DecodeSubTrack(trackSubTracks[(Size)EAnimationSubTrack::Scale], frames, frameBitOffset)};
+    }
+} // namespace ig
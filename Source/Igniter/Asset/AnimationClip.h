@@ -0,0 +1,192 @@
+#pragma once
+#include "Igniter/Asset/Common.h"
+
+namespace ig
+{
+    class AnimationClip;
+
+    struct AnimationClipImportDesc
+    {
+    public:
+        Json& Serialize(Json& archive) const;
+        const Json& Deserialize(const Json& archive);
+
+    public:
+        /* 스켈레탈 메시 임포트 설정과 일치 해야 한다. */
+        bool bMakeLeftHanded = true;
+        /* 트랙을 균일한 간격으로 재샘플링 할 빈도 (Hz) */
+        F32 SampleRate = 30.f;
+        /* 각 트랙의 비트 수를 결정하기 위한 로컬 공간 허용 오차 */
+        F32 MaxTranslationError = 0.0001f;
+        F32 MaxRotationError = 0.0001f; /* Radians */
+        F32 MaxScaleError = 0.00001f;
+    };
+
+    enum class EAnimationSubTrack : U8
+    {
+        Rotation,
+        Translation,
+        Scale,
+    };
+
+    /*
+     * 하나의 Bone 트랙을 구성하는 Rotation/Translation/Scale 중 하나.
+     * 모든 프레임의 값을 [RangeMin, RangeMin+RangeExtent] 로 범위 축소 한 후, 성분 당 NumBits 로 양자화 한다.
+     * NumBits 가 0 이면 상수 트랙(RangeMin) 이며, 프레임 데이터를 차지하지 않는다.
+     * Rotation 은 W >= 0 이 되도록 부호를 맞춘 Quaternion 의 XYZ 만 기록하며, W 는 단위 길이로 부터 복원 한다.
+     */
+    struct AnimationSubTrack
+    {
+    public:
+        constexpr static U8 kMaxBits = 16;
+
+    public:
+        Vector3 RangeMin{};
+        Vector3 RangeExtent{};
+        /* 프레임 시작 부터의 비트 오프셋 */
+        U32 FrameBitOffset = 0;
+        U8 NumBits = 0;
+        U8 Padding[3]{};
+    };
+
+    /*
+     * Animation Clip Binary Layout
+     * Begin->
+     * SubTracks => [0, sizeof(AnimationSubTrack)*NumTracks*3); 트랙 i 의 (Rotation, Translation, Scale) 순
+     * PackedFrames => [PrevLast, PrevLast+GetPackedFramesSize()); 프레임 f 는 비트 [f*FrameBitSize, (f+1)*FrameBitSize) 구간
+     * <-End
+     *
+     * #sy_note 한 프레임의 모든 트랙이 연속 되도록(Frame-Major) 기록 되기 때문에, 포즈를 샘플링 할 때 두 프레임 분량의 메모리만 접근 한다.
+     * 트랙들을 곡선으로 근사 하는 대신 균일한 간격으로 샘플링 하여, 임의의 시간에 대해 키 탐색 없이 O(1) 로 접근 할 수 있다.
+     */
+    struct AnimationClipLoadDesc
+    {
+    public:
+        /* 64 비트 단위로 비트를 읽기 때문에, 마지막 프레임을 읽을 때 버퍼를 벗어나지 않도록 여유 공간을 둔다. */
+        constexpr static Size kPackedFramesPadding = sizeof(U64);
+
+    public:
+        Json& Serialize(Json& archive) const;
+        const Json& Deserialize(const Json& archive);
+
+        [[nodiscard]] Size GetNumTracks() const noexcept { return TrackNames.size(); }
+        [[nodiscard]] Size GetNumSubTracks() const noexcept { return GetNumTracks() * magic_enum::enum_count<EAnimationSubTrack>(); }
+        [[nodiscard]] Size GetSubTracksSize() const noexcept { return sizeof(AnimationSubTrack) * GetNumSubTracks(); }
+        [[nodiscard]] Size GetPackedFramesSize() const noexcept { return ((Size)FrameBitSize * NumFrames + 7) / 8 + kPackedFramesPadding; }
+        [[nodiscard]] Size GetBlobSize() const noexcept { return GetSubTracksSize() + GetPackedFramesSize(); }
+
+    public:
+        U32 NumFrames = 0;
+        F32 SampleRate = 0.f;
+        F32 Duration = 0.f;
+        U32 FrameBitSize = 0;
+        /* 트랙이 애니메이션 하는 노드(Bone)의 이름 */
+        Vector<std::string> TrackNames;
+    };
+
+    /* 트랙을 샘플링 한 로컬 변환; Scale -> Rotation -> Translation 순으로 적용 된다. */
+    struct AnimationTransform
+    {
+    public:
+        Quaternion Rotation{};
+        Vector3 Translation{};
+        Vector3 Scale{1.f, 1.f, 1.f};
+    };
+
+    /*
+     * #sy_note 애니메이션 클립
+     * 압축 된 상태로 메모리에 유지 되며, 샘플링 시 필요한 두 프레임만 복원 한다. (GPU 자원을 사용하지 않는다)
+     * 스켈레톤에 대한 포즈 평가는 AnimationSampler 를 통해 이루어 진다.
+     */
+    class AnimationClip final
+    {
+    public:
+        using ImportDesc = AnimationClipImportDesc;
+        using LoadDesc = AnimationClipLoadDesc;
+        using Desc = AssetDesc<AnimationClip>;
+
+    public:
+        AnimationClip(const Desc& snapshot, Vector<AnimationSubTrack> subTracks, Vector<U8> packedFrames);
+        AnimationClip(const AnimationClip&) = delete;
+        AnimationClip(AnimationClip&&) noexcept = default;
+        ~AnimationClip() = default;
+
+        AnimationClip& operator=(const AnimationClip&) = delete;
+        AnimationClip& operator=(AnimationClip&&) noexcept = default;
+
+        [[nodiscard]] const Desc& GetSnapshot() const noexcept { return snapshot; }
+        [[nodiscard]] F32 GetDuration() const noexcept { return snapshot.LoadDescriptor.Duration; }
+        [[nodiscard]] Size GetNumTracks() const noexcept { return snapshot.LoadDescriptor.GetNumTracks(); }
+        [[nodiscard]] std::span<const std::string> GetTrackNames() const noexcept { return snapshot.LoadDescriptor.TrackNames; }
+        /* 찾지 못한 경우 InvalidIndexU32 */
+        [[nodiscard]] U32 FindTrack(const std::string_view trackName) const;
+
+        /* 시간을 [0, Duration] 으로 제한(또는 반복) 하여, 보간 할 두 프레임과 가중치를 구한다. */
+        void ComputeFramePosition(const F32 time, const bool bLoop, U32& frame0, U32& frame1, F32& alpha) const;
+        /* 두 프레임 사이를 보간 한 트랙의 로컬 변환 */
+        [[nodiscard]] AnimationTransform SampleTrack(const U32 trackIdx, const U32 frame0, const U32 frame1, const F32 alpha) const;
+        /* 보간 없이 양자화 된 값을 복원 */
+        [[nodiscard]] AnimationTransform DecodeTrack(const U32 trackIdx, const U32 frame) const;
+
+        [[nodiscard]] Bytes GetResidentSize() const noexcept
+        {
+            return sizeof(AnimationClip) + sizeof(AnimationSubTrack) * subTracks.size() + packedFrames.size();
+        }
+
+    private:
+        Desc snapshot{};
+        Vector<AnimationSubTrack> subTracks;
+        Vector<U8> packedFrames;
+    };
+
+    namespace details
+    {
+        [[nodiscard]] inline U32 ReadPackedBits(const std::span<const U8> packedBits, const Size bitOffset, const U8 numBits)
+        {
+            IG_CHECK(numBits <= AnimationSubTrack::kMaxBits);
+            IG_CHECK((bitOffset / 8) + sizeof(U64) <= packedBits.size());
+            U64 word = 0;
+            std::memcpy(&word, packedBits.data() + (bitOffset / 8), sizeof(U64));
+            return (U32)((word >> (bitOffset % 8)) & ((1ull << numBits) - 1));
+        }
+
+        [[nodiscard]] inline F32 DequantizeUnorm(const U32 quantized, const U8 numBits)
+        {
+            return (F32)quantized / (F32)((1u << numBits) - 1);
+        }
+
+        [[nodiscard]] inline U32 QuantizeUnorm(const F32 normalized, const U8 numBits)
+        {
+            const F32 maxValue = (F32)((1u << numBits) - 1);
+            return (U32)std::clamp(std::round(normalized * maxValue), 0.f, maxValue);
+        }
+
+        [[nodiscard]] inline Vector3 DecodeSubTrack(const AnimationSubTrack& subTrack, const std::span<const U8> packedFrames, const Size frameBitOffset)
+        {
+            if (subTrack.NumBits == 0)
+            {
+                return subTrack.RangeMin;
+            }
+
+            const Size bitOffset = frameBitOffset + subTrack.FrameBitOffset;
+            const Vector3 normalized{
+                DequantizeUnorm(ReadPackedBits(packedFrames, bitOffset, subTrack.NumBits), subTrack.NumBits),
+                DequantizeUnorm(ReadPackedBits(packedFrames, bitOffset + subTrack.NumBits, subTrack.NumBits), subTrack.NumBits),
+                DequantizeUnorm(ReadPackedBits(packedFrames, bitOffset + 2 * (Size)subTrack.NumBits, subTrack.NumBits), subTrack.NumBits)};
+            return subTrack.RangeMin + normalized * subTrack.RangeExtent;
+        }
+
+        [[nodiscard]] inline Quaternion RestoreQuaternionW(const Vector3& xyz)
+        {
+            /* 양자화 오차로 단위 길이를 넘어선 경우, W 가 0 인 단위 Quaternion 으로 보정 한다. */
+            const F32 lengthSquared = xyz.LengthSquared();
+            if (lengthSquared >= 1.f)
+            {
+                const Vector3 normalized{xyz / std::sqrt(lengthSquared)};
+                return Quaternion{normalized.x, normalized.y, normalized.z, 0.f};
+            }
+
+            return Quaternion{xyz.x, xyz.y, xyz.z, std::sqrt(1.f - lengthSquared)};
+        }
+    } // namespace details
+} // namespace ig
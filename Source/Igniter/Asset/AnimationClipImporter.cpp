@@ -0,0 +1,387 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/AnimationClipImporter.h"
+
+IG_DECLARE_LOG_CATEGORY(AnimationClipImporterLog);
+
+IG_DEFINE_LOG_CATEGORY(AnimationClipImporterLog);
+
+namespace ig
+{
+    namespace
+    {
+        /* mTicksPerSecond 가 주어지지 않은 경우 Assimp 가 가정하는 값 */
+        constexpr F64 kDefaultTicksPerSecond = 25.0;
+        /* 3 비트 미만은 상수 트랙과 비교해 이득이 거의 없다. */
+        constexpr U8 kMinBitRate = 3;
+        constexpr Size kNumSubTracksPerTrack = magic_enum::enum_count<EAnimationSubTrack>();
+
+        Vector3 ToVector3(const aiVector3D& vector)
+        {
+            return Vector3{vector.x, vector.y, vector.z};
+        }
+
+        /* 정규화 후 W >= 0 이 되도록 부호를 맞춘다; q 와 -q 는 같은 회전을 나타낸다. */
+        Quaternion ToCanonicalQuaternion(const aiQuaternion& quaternion)
+        {
+            Quaternion canonical{quaternion.x, quaternion.y, quaternion.z, quaternion.w};
+            canonical.Normalize();
+            return canonical.w < 0.f ? -canonical : canonical;
+        }
+
+        aiVector3D InterpolateVectorKeys(const aiVectorKey* keys, const U32 numKeys, const F64 time, const aiVector3D& fallback)
+        {
+            if (numKeys == 0)
+            {
+                return fallback;
+            }
+
+            if (numKeys == 1 || time <= keys[0].mTime)
+            {
+                return keys[0].mValue;
+            }
+
+            if (time >= keys[numKeys - 1].mTime)
+            {
+                return keys[numKeys - 1].mValue;
+            }
+
+            const aiVectorKey* nextKey = std::upper_bound(keys, keys + numKeys, time, [](const F64 targetTime, const aiVectorKey& key) { return targetTime < key.mTime; });
+            const aiVectorKey* prevKey = nextKey - 1;
+            const F32 alpha = (F32)((time - prevKey->mTime) / (nextKey->mTime - prevKey->mTime));
+            return prevKey->mValue + (nextKey->mValue - prevKey->mValue) * alpha;
+        }
+
+        aiQuaternion InterpolateQuaternionKeys(const aiQuatKey* keys, const U32 numKeys, const F64 time, const aiQuaternion& fallback)
+        {
+            if (numKeys == 0)
+            {
+                return fallback;
+            }
+
+            if (numKeys == 1 || time <= keys[0].mTime)
+            {
+                return keys[0].mValue;
+            }
+
+            if (time >= keys[numKeys - 1].mTime)
+            {
+                return keys[numKeys - 1].mValue;
+            }
+
+            const aiQuatKey* nextKey = std::upper_bound(keys, keys + numKeys, time, [](const F64 targetTime, const aiQuatKey& key) { return targetTime < key.mTime; });
+            const aiQuatKey* prevKey = nextKey - 1;
+            aiQuaternion interpolated{};
+            aiQuaternion::Interpolate(interpolated, prevKey->mValue, nextKey->mValue, (F32)((time - prevKey->mTime) / (nextKey->mTime - prevKey->mTime)));
+            return interpolated;
+        }
+
+        Vector3 GetSubTrackValue(const AnimationTransform& transform, const EAnimationSubTrack subTrackType)
+        {
+            switch (subTrackType)
+            {
+            case EAnimationSubTrack::Rotation:
+                return Vector3{transform.Rotation.x, transform.Rotation.y, transform.Rotation.z};
+            case EAnimationSubTrack::Translation:
+                return transform.Translation;
+            default:
+                return transform.Scale;
+            }
+        }
+
+        U32 QuantizeComponent(const F32 value, const F32 rangeMin, const F32 rangeExtent, const U8 numBits)
+        {
+            return rangeExtent > 0.f ? details::QuantizeUnorm((value - rangeMin) / rangeExtent, numBits) : 0;
+        }
+
+        Vector3 QuantizeRoundTrip(const AnimationSubTrack& subTrack, const Vector3& value)
+        {
+            const auto roundTrip = [&subTrack](const F32 component, const F32 rangeMin, const F32 rangeExtent)
+            {
+                return rangeMin + details::DequantizeUnorm(QuantizeComponent(component, rangeMin, rangeExtent, subTrack.NumBits), subTrack.NumBits) * rangeExtent;
+            };
+
+            return Vector3{
+                roundTrip(value.x, subTrack.RangeMin.x, subTrack.RangeExtent.x),
+                roundTrip(value.y, subTrack.RangeMin.y, subTrack.RangeExtent.y),
+                roundTrip(value.z, subTrack.RangeMin.z, subTrack.RangeExtent.z)};
+        }
+
+        void WritePackedBits(const std::span<U8> packedBits, const Size bitOffset, const U8 numBits, const U32 value)
+        {
+            IG_CHECK(numBits <= AnimationSubTrack::kMaxBits);
+            IG_CHECK((bitOffset / 8) + sizeof(U64) <= packedBits.size());
+            IG_CHECK(value < (1u << numBits));
+            U64 word = 0;
+            std::memcpy(&word, packedBits.data() + (bitOffset / 8), sizeof(U64));
+            word |= (U64)value << (bitOffset % 8);
+            std::memcpy(packedBits.data() + (bitOffset / 8), &word, sizeof(U64));
+        }
+    } // namespace
+
+    AnimationClipImporter::AnimationClipImporter(tf::Executor& taskExecutor)
+        : taskExecutor(taskExecutor)
+    {}
+
+    Vector<Result<AnimationClip::Desc, EAnimationClipImportStatus>> AnimationClipImporter::Import(const std::string_view resPathStr,
+        const AnimationClip::ImportDesc& desc)
+    {
+        Vector<Result<AnimationClip::Desc, EAnimationClipImportStatus>> results;
+        const Path resPath{resPathStr};
+        if (!fs::exists(resPath))
+        {
+            results.emplace_back(MakeFail<AnimationClip::Desc, EAnimationClipImportStatus::FileDoesNotExists>());
+            return results;
+        }
+
+        if (desc.SampleRate <= 0.f)
+        {
+            results.emplace_back(MakeFail<AnimationClip::Desc, EAnimationClipImportStatus::InvalidSampleRate>());
+            return results;
+        }
+
+        Assimp::Importer importer;
+        const aiScene* scene = importer.ReadFile(resPathStr.data(), desc.bMakeLeftHanded ? aiProcess_MakeLeftHanded : 0);
+        if (scene == nullptr || scene->mRootNode == nullptr)
+        {
+            IG_LOG(AnimationClipImporterLog, Error, "Load animation file from \"{}\" failed: \"{}\"", resPathStr, importer.GetErrorString());
+            results.emplace_back(MakeFail<AnimationClip::Desc, EAnimationClipImportStatus::FailedLoadFromFile>());
+            return results;
+        }
+        IG_LOG(AnimationClipImporterLog, Info, "{}: {} animations found.", resPathStr, scene->mNumAnimations);
+
+        const std::string modelName = resPath.filename().replace_extension().string();
+        results.reserve(scene->mNumAnimations);
+        for (U32 animIdx = 0; animIdx < scene->mNumAnimations; ++animIdx)
+        {
+            const aiAnimation& animation = *scene->mAnimations[animIdx];
+            if (animation.mNumChannels == 0)
+            {
+                results.emplace_back(MakeFail<AnimationClip::Desc, EAnimationClipImportStatus::EmptyAnimation>());
+                continue;
+            }
+
+            details::AnimationClipData clipData{};
+            details::AnimationClipCompressionStages::ResampleChannels(*scene, animation, desc.SampleRate, clipData);
+            details::AnimationClipCompressionStages::SelectBitRates(taskExecutor, desc, clipData);
+            details::AnimationClipCompressionStages::PackFrames(clipData);
+            results.emplace_back(ExportToFile(std::format("{}_{}_{}", modelName, animation.mName.C_Str(), animIdx), clipData));
+        }
+        importer.FreeScene();
+
+        return results;
+    }
+
+    Result<AnimationClip::Desc, EAnimationClipImportStatus> AnimationClipImporter::ExportToFile(const std::string_view clipName,
+        const details::AnimationClipData& clipData)
+    {
+        const AssetInfo assetInfo{MakeVirtualPathPreferred(clipName), EAssetCategory::Animation};
+
+        const AnimationClipLoadDesc newLoadDesc{details::AnimationClipCompressionStages::MakeLoadDesc(clipData)};
+        IG_CHECK(clipData.SubTracks.size() == newLoadDesc.GetNumSubTracks());
+        IG_CHECK(clipData.PackedFrames.size() == newLoadDesc.GetPackedFramesSize());
+
+        Array<F32, kNumSubTracksPerTrack> maxErrors{0.f, 0.f, 0.f};
+        for (Size subTrackIdx = 0; subTrackIdx < clipData.SubTrackErrors.size(); ++subTrackIdx)
+        {
+            F32& maxError = maxErrors[subTrackIdx % kNumSubTracksPerTrack];
+            maxError = std::max(maxError, clipData.SubTrackErrors[subTrackIdx]);
+        }
+
+        const Size rawSize = sizeof(AnimationTransform) * clipData.Samples.size();
+        IG_LOG(AnimationClipImporterLog, Info,
+            "{}: {} Tracks, {} Frames ({:.2f} s) => {} bytes ({:.2f}:1), {} bits per frame, Max Error (Rotation {:.6f} rad, Translation {:.6f}, Scale {:.6f})",
+            clipName, newLoadDesc.GetNumTracks(), newLoadDesc.NumFrames, newLoadDesc.Duration,
+            newLoadDesc.GetBlobSize(), (F32)rawSize / newLoadDesc.GetBlobSize(), newLoadDesc.FrameBitSize,
+            maxErrors[(Size)EAnimationSubTrack::Rotation], maxErrors[(Size)EAnimationSubTrack::Translation], maxErrors[(Size)EAnimationSubTrack::Scale]);
+
+        Json assetMetadata{};
+        assetMetadata << assetInfo << newLoadDesc;
+        if (!SaveJsonToFile(MakeAssetMetadataPath(EAssetCategory::Animation, assetInfo.GetGuid()), assetMetadata))
+        {
+            return MakeFail<AnimationClip::Desc, EAnimationClipImportStatus::FailedSaveMetadataToFile>();
+        }
+
+        Array<std::span<const U8>, 2> blobs{
+            std::span<const U8>{reinterpret_cast<const U8*>(clipData.SubTracks.data()), newLoadDesc.GetSubTracksSize()},
+            std::span<const U8>{clipData.PackedFrames}};
+        if (!SaveBlobsToFile(MakeAssetPath(EAssetCategory::Animation, assetInfo.GetGuid()), blobs))
+        {
+            return MakeFail<AnimationClip::Desc, EAnimationClipImportStatus::FailedSaveAssetToFile>();
+        }
+
+        IG_CHECK(assetInfo.IsValid());
+        return MakeSuccess<AnimationClip::Desc, EAnimationClipImportStatus>(assetInfo, newLoadDesc);
+    }
+} // namespace ig
+
+namespace ig::details
+{
+    void AnimationClipCompressionStages::ResampleChannels(const aiScene& scene, const aiAnimation& animation, const F32 sampleRate, AnimationClipData& clipData)
+    {
+        const F64 ticksPerSecond = animation.mTicksPerSecond > 0.0 ? animation.mTicksPerSecond : kDefaultTicksPerSecond;
+        clipData.Duration = (F32)(animation.mDuration / ticksPerSecond);
+        clipData.NumFrames = (U32)std::ceil(clipData.Duration * sampleRate) + 1;
+        /* 마지막 프레임이 정확히 Duration 에 위치 하도록 실제 샘플링 빈도를 조정 한다. */
+        clipData.SampleRate = clipData.NumFrames > 1 ? (F32)(clipData.NumFrames - 1) / clipData.Duration : sampleRate;
+
+        const U32 numTracks = animation.mNumChannels;
+        clipData.TrackNames.resize(numTracks);
+        clipData.Samples.resize((Size)clipData.NumFrames * numTracks);
+        for (U32 trackIdx = 0; trackIdx < numTracks; ++trackIdx)
+        {
+            const aiNodeAnim& channel = *animation.mChannels[trackIdx];
+            clipData.TrackNames[trackIdx] = channel.mNodeName.C_Str();
+
+            /* 키가 없는 성분은 노드의 변환을 유지 한다. */
+            aiVector3D nodeScale{1.f, 1.f, 1.f};
+            aiQuaternion nodeRotation{};
+            aiVector3D nodePosition{};
+            if (const aiNode* node = scene.mRootNode->FindNode(channel.mNodeName);
+                node != nullptr)
+            {
+                node->mTransformation.Decompose(nodeScale, nodeRotation, nodePosition);
+            }
+
+            for (U32 frame = 0; frame < clipData.NumFrames; ++frame)
+            {
+                const F64 time = std::min((F64)frame / clipData.SampleRate, (F64)clipData.Duration) * ticksPerSecond;
+                clipData.Samples[(Size)frame * numTracks + trackIdx] = AnimationTransform{
+                    .Rotation = ToCanonicalQuaternion(InterpolateQuaternionKeys(channel.mRotationKeys, channel.mNumRotationKeys, time, nodeRotation)),
+                    .Translation = ToVector3(InterpolateVectorKeys(channel.mPositionKeys, channel.mNumPositionKeys, time, nodePosition)),
+                    .Scale = ToVector3(InterpolateVectorKeys(channel.mScalingKeys, channel.mNumScalingKeys, time, nodeScale))};
+            }
+        }
+    }
+
+    void AnimationClipCompressionStages::SelectBitRates(tf::Executor& taskExecutor, const AnimationClip::ImportDesc& desc, AnimationClipData& clipData)
+    {
+        const Size numTracks = clipData.TrackNames.size();
+        const Size numSubTracks = numTracks * kNumSubTracksPerTrack;
+        clipData.SubTracks.resize(numSubTracks);
+        clipData.SubTrackErrors.resize(numSubTracks);
+
+        tf::Taskflow bitRateFlow;
+        bitRateFlow.for_each_index(
+            0, (S32)numSubTracks, 1,
+            [&desc, &clipData, numTracks](const Index subTrackIdx)
+            {
+                const Size trackIdx = subTrackIdx / kNumSubTracksPerTrack;
+                const EAnimationSubTrack subTrackType = (EAnimationSubTrack)(subTrackIdx % kNumSubTracksPerTrack);
+                const F32 maxError = subTrackType == EAnimationSubTrack::Rotation ? desc.MaxRotationError :
+                    subTrackType == EAnimationSubTrack::Translation ? desc.MaxTranslationError : desc.MaxScaleError;
+
+                Vector<Vector3> values(clipData.NumFrames);
+                Vector3 rangeMin{FLT_MAX, FLT_MAX, FLT_MAX};
+                Vector3 rangeMax{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+                for (U32 frame = 0; frame < clipData.NumFrames; ++frame)
+                {
+                    values[frame] = GetSubTrackValue(clipData.Samples[(Size)frame * numTracks + trackIdx], subTrackType);
+                    rangeMin = Vector3::Min(rangeMin, values[frame]);
+                    rangeMax = Vector3::Max(rangeMax, values[frame]);
+                }
+
+                const auto measureMaxError = [subTrackType, &values](const auto& reconstruct)
+                {
+                    F32 maxMeasuredError = 0.f;
+                    for (const Vector3& value : values)
+                    {
+                        maxMeasuredError = std::max(maxMeasuredError, MeasureError(subTrackType, value, reconstruct(value)));
+                    }
+                    return maxMeasuredError;
+                };
+
+                AnimationSubTrack& subTrack = clipData.SubTracks[subTrackIdx];
+                F32& subTrackError = clipData.SubTrackErrors[subTrackIdx];
+
+                /* 상수 트랙 */
+                const Vector3 midpoint{(rangeMin + rangeMax) * 0.5f};
+                subTrack = AnimationSubTrack{.RangeMin = midpoint, .RangeExtent = Vector3::Zero, .NumBits = 0};
+                subTrackError = measureMaxError([&midpoint](const Vector3&) { return midpoint; });
+                if (subTrackError <= maxError)
+                {
+                    return;
+                }
+
+                subTrack.RangeMin = rangeMin;
+                subTrack.RangeExtent = rangeMax - rangeMin;
+                for (U8 numBits = kMinBitRate; numBits <= AnimationSubTrack::kMaxBits; ++numBits)
+                {
+                    subTrack.NumBits = numBits;
+                    subTrackError = measureMaxError([&subTrack](const Vector3& value) { return QuantizeRoundTrip(subTrack, value); });
+                    if (subTrackError <= maxError)
+                    {
+                        return;
+                    }
+                }
+            });
+        taskExecutor.run(bitRateFlow).wait();
+    }
+
+    void AnimationClipCompressionStages::PackFrames(AnimationClipData& clipData)
+    {
+        U32 frameBitSize = 0;
+        for (AnimationSubTrack& subTrack : clipData.SubTracks)
+        {
+            subTrack.FrameBitOffset = frameBitSize;
+            frameBitSize += 3 * (U32)subTrack.NumBits;
+        }
+        clipData.FrameBitSize = frameBitSize;
+
+        const AnimationClipLoadDesc packedLayout{.NumFrames = clipData.NumFrames, .FrameBitSize = frameBitSize};
+        clipData.PackedFrames.clear();
+        clipData.PackedFrames.resize(packedLayout.GetPackedFramesSize(), 0);
+
+        const std::span<U8> packedFrames{clipData.PackedFrames.data(), clipData.PackedFrames.size()};
+        const Size numTracks = clipData.TrackNames.size();
+        for (U32 frame = 0; frame < clipData.NumFrames; ++frame)
+        {
+            const Size frameBitOffset = (Size)frame * frameBitSize;
+            for (Size subTrackIdx = 0; subTrackIdx < clipData.SubTracks.size(); ++subTrackIdx)
+            {
+                const AnimationSubTrack& subTrack = clipData.SubTracks[subTrackIdx];
+                if (subTrack.NumBits == 0)
+                {
+                    continue;
+                }
+
+                const Size trackIdx = subTrackIdx / kNumSubTracksPerTrack;
+                const EAnimationSubTrack subTrackType = (EAnimationSubTrack)(subTrackIdx % kNumSubTracksPerTrack);
+                const Vector3 value{GetSubTrackValue(clipData.Samples[(Size)frame * numTracks + trackIdx], subTrackType)};
+                const Size bitOffset = frameBitOffset + subTrack.FrameBitOffset;
+                WritePackedBits(packedFrames, bitOffset, subTrack.NumBits,
+                    QuantizeComponent(value.x, subTrack.RangeMin.x, subTrack.RangeExtent.x, subTrack.NumBits));
+                WritePackedBits(packedFrames, bitOffset + subTrack.NumBits, subTrack.NumBits,
+                    QuantizeComponent(value.y, subTrack.RangeMin.y, subTrack.RangeExtent.y, subTrack.NumBits));
+                WritePackedBits(packedFrames, bitOffset + 2 * (Size)subTrack.NumBits, subTrack.NumBits,
+                    QuantizeComponent(value.z, subTrack.RangeMin.z, subTrack.RangeExtent.z, subTrack.NumBits));
+            }
+        }
+    }
+
+    AnimationClipLoadDesc AnimationClipCompressionStages::MakeLoadDesc(const AnimationClipData& clipData)
+    {
+        AnimationClipLoadDesc loadDesc{};
+        loadDesc.NumFrames = clipData.NumFrames;
+        loadDesc.SampleRate = clipData.SampleRate;
+        loadDesc.Duration = clipData.Duration;
+        loadDesc.FrameBitSize = clipData.FrameBitSize;
+        loadDesc.TrackNames = clipData.TrackNames;
+        return loadDesc;
+    }
+
+    F32 AnimationClipCompressionStages::MeasureError(const EAnimationSubTrack subTrackType, const Vector3& original, const Vector3& reconstructed)
+    {
+        if (subTrackType != EAnimationSubTrack::Rotation)
+        {
+            return Vector3::Distance(original, reconstructed);
+        }
+
+        /* 두 회전 사이의 각도; 작은 각도 에서 acos 는 F32 정밀도가 부족 하므로 atan2 를 사용 한다. */
+        Quaternion inverseOriginal{};
+        RestoreQuaternionW(original).Inverse(inverseOriginal);
+        const Quaternion delta{inverseOriginal * RestoreQuaternionW(reconstructed)};
+        return 2.f * std::atan2(Vector3{delta.x, delta.y, delta.z}.Length(), std::abs(delta.w));
+    }
+} // namespace ig::details
@@ -0,0 +1,81 @@
+#pragma once
+#include "Igniter/Asset/AnimationClip.h"
+
+namespace ig
+{
+    enum class EAnimationClipImportStatus : U8
+    {
+        Success,
+        FileDoesNotExists,
+        FailedLoadFromFile,
+        FailedSaveMetadataToFile,
+        FailedSaveAssetToFile,
+        InvalidSampleRate,
+        EmptyAnimation,
+    };
+
+    namespace details
+    {
+        struct AnimationClipData
+        {
+        public:
+            Vector<std::string> TrackNames;
+            U32 NumFrames = 0;
+            F32 SampleRate = 0.f;
+            F32 Duration = 0.f;
+            /* [Frame * NumTracks + Track] */
+            Vector<AnimationTransform> Samples;
+
+            Vector<AnimationSubTrack> SubTracks;
+            /* 양자화 후 Sub Track 별로 측정 한 최대 오차 */
+            Vector<F32> SubTrackErrors;
+            U32 FrameBitSize = 0;
+            Vector<U8> PackedFrames;
+        };
+
+        /* Assimp 씬을 읽어 들인 이후의 압축 단계. 파일 시스템에 의존하지 않기 때문에, 메모리 상의 씬 만으로 독립적으로 실행 할 수 있다. */
+        struct AnimationClipCompressionStages
+        {
+        public:
+            static void ResampleChannels(const aiScene& scene, const aiAnimation& animation, const F32 sampleRate, AnimationClipData& clipData);
+            /* Sub Track 들은 서로 독립적이므로 병렬로 비트 수를 결정 한다. */
+            static void SelectBitRates(tf::Executor& taskExecutor, const AnimationClip::ImportDesc& desc, AnimationClipData& clipData);
+            static void PackFrames(AnimationClipData& clipData);
+
+            [[nodiscard]] static AnimationClipLoadDesc MakeLoadDesc(const AnimationClipData& clipData);
+            /* 트랙 회전 간의 각도(Radians), 또는 이동/스케일 간의 거리 */
+            [[nodiscard]] static F32 MeasureError(const EAnimationSubTrack subTrackType, const Vector3& original, const Vector3& reconstructed);
+        };
+    } // namespace details
+
+    class AssetManager;
+
+    /*
+     * #sy_note 애니메이션 클립 임포트 (ACL 의 Uniform Sampling + Variable Bit Rate 방식)
+     * aiAnimation 마다 하나의 클립 에셋을 생성한다.
+     * 1. 모든 채널을 SampleRate 로 재샘플링 (키 프레임의 간격과 관계 없이 O(1) 로 접근 가능)
+     * 2. Sub Track 별로 범위 축소(Range Reduction) 후, 허용 오차를 만족하는 가장 적은 비트 수(0, 3~16)를 선택
+     * 3. 프레임 단위로 비트를 연속 되게 기록
+     */
+    class AnimationClipImporter final
+    {
+        friend class AssetManager;
+
+    public:
+        explicit AnimationClipImporter(tf::Executor& taskExecutor);
+        AnimationClipImporter(const AnimationClipImporter&) = delete;
+        AnimationClipImporter(AnimationClipImporter&&) noexcept = delete;
+        ~AnimationClipImporter() = default;
+
+        AnimationClipImporter& operator=(const AnimationClipImporter&) = delete;
+        AnimationClipImporter& operator=(AnimationClipImporter&&) noexcept = delete;
+
+    private:
+        Vector<Result<AnimationClip::Desc, EAnimationClipImportStatus>> Import(const std::string_view resPathStr, const AnimationClip::ImportDesc& desc);
+
+        static Result<AnimationClip::Desc, EAnimationClipImportStatus> ExportToFile(const std::string_view clipName, const details::AnimationClipData& clipData);
+
+    private:
+        tf::Executor& taskExecutor;
+    };
+} // namespace ig
@@ -0,0 +1,71 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/AssetManager.h"
+#include "Igniter/Asset/AnimationClipLoader.h"
+
+namespace ig
+{
+    AnimationClipLoader::AnimationClipLoader(AssetManager& assetManager)
+        : assetManager(assetManager)
+    {}
+
+    Result<AnimationClip, EAnimationClipLoadStatus> AnimationClipLoader::Load(const AnimationClip::Desc& desc)
+    {
+        const AssetInfo& assetInfo{desc.Info};
+        const AnimationClipLoadDesc& loadDesc{desc.LoadDescriptor};
+        if (!assetInfo.IsValid())
+        {
+            return MakeFail<AnimationClip, EAnimationClipLoadStatus::InvalidAssetInfo>();
+        }
+
+        if (assetInfo.GetCategory() != EAssetCategory::Animation)
+        {
+            return MakeFail<AnimationClip, EAnimationClipLoadStatus::AssetTypeMismatch>();
+        }
+
+        if (loadDesc.NumFrames == 0)
+        {
+            return MakeFail<AnimationClip, EAnimationClipLoadStatus::ZeroNumFrames>();
+        }
+
+        if (loadDesc.SampleRate <= 0.f)
+        {
+            return MakeFail<AnimationClip, EAnimationClipLoadStatus::InvalidSampleRate>();
+        }
+
+        Vector<U8> looseBlob{};
+        std::span<const U8> blob{assetManager.FindPackedAsset(assetInfo.GetGuid())};
+        if (blob.empty())
+        {
+            const Path assetPath = MakeAssetPath(EAssetCategory::Animation, assetInfo.GetGuid());
+            if (!fs::exists(assetPath))
+            {
+                return MakeFail<AnimationClip, EAnimationClipLoadStatus::FileDoesNotExists>();
+            }
+
+            looseBlob = LoadBlobFromFile(assetPath);
+            blob = std::span<const U8>{looseBlob.data(), looseBlob.size()};
+        }
+
+        if (blob.size() != loadDesc.GetBlobSize())
+        {
+            return MakeFail<AnimationClip, EAnimationClipLoadStatus::BlobSizeMismatch>();
+        }
+
+        Vector<AnimationSubTrack> subTracks(loadDesc.GetNumSubTracks());
+        std::memcpy(subTracks.data(), blob.data(), loadDesc.GetSubTracksSize());
+        /* 샘플링 시 경계 검사를 하지 않기 때문에, 모든 Sub Track 이 프레임 내에 위치 하는지 미리 검사 한다. */
+        const bool bValidSubTracks = std::all_of(subTracks.cbegin(), subTracks.cend(),
+            [frameBitSize = loadDesc.FrameBitSize](const AnimationSubTrack& subTrack)
+            {
+                return subTrack.NumBits <= AnimationSubTrack::kMaxBits && subTrack.FrameBitOffset + 3 * (U32)subTrack.NumBits <= frameBitSize;
+            });
+        if (!bValidSubTracks)
+        {
+            return MakeFail<AnimationClip, EAnimationClipLoadStatus::InvalidSubTrack>();
+        }
+
+        const std::span<const U8> packedFrames{blob.subspan(loadDesc.GetSubTracksSize())};
+        return MakeSuccess<AnimationClip, EAnimationClipLoadStatus>(desc, std::move(subTracks), Vector<U8>(packedFrames.begin(), packedFrames.end()));
+    }
+} // namespace ig
@@ -0,0 +1,40 @@
+#pragma once
+#include "Igniter/Core/Result.h"
+#include "Igniter/Asset/AnimationClip.h"
+
+namespace ig
+{
+    enum class EAnimationClipLoadStatus
+    {
+        Success,
+        InvalidAssetInfo,
+        AssetTypeMismatch,
+        ZeroNumFrames,
+        InvalidSampleRate,
+        FileDoesNotExists,
+        BlobSizeMismatch,
+        InvalidSubTrack,
+    };
+
+    class AssetManager;
+
+    class AnimationClipLoader final
+    {
+        friend class AssetManager;
+
+    public:
+        explicit AnimationClipLoader(AssetManager& assetManager);
+        AnimationClipLoader(const AnimationClipLoader&) = delete;
+        AnimationClipLoader(AnimationClipLoader&&) noexcept = delete;
+        ~AnimationClipLoader() = default;
+
+        AnimationClipLoader& operator=(const AnimationClipLoader&) = delete;
+        AnimationClipLoader& operator=(AnimationClipLoader&&) noexcept = delete;
+
+    private:
+        [[nodiscard]] Result<AnimationClip, EAnimationClipLoadStatus> Load(const AnimationClip::Desc& desc);
+
+    private:
+        AssetManager& assetManager;
+    };
+} // namespace ig
@@ -1,6 +1,7 @@
 #pragma once
 #include "Igniter/Igniter.h"
 #include "Igniter/Core/String.h"
+#include "Igniter/Core/Memory.h"
 #include "Igniter/Core/Handle.h"
 #include "Igniter/Core/HandleStorage.h"
 #include "Igniter/Asset/Common.h"
@@ -14,6 +15,19 @@ namespace ig::details
         {
             const U64 HandleHash{IG_NUMERIC_MAX_OF(HandleHash)};
             const U32 RefCount{};
+            const bool bIsKeptAlive{false};
+        };
+
+        struct Statistics
+        {
+            Size NumHits{0};
+            /* Hit 중, Keep-Alive 상태(RefCount == 0)에서 다시 살아난 횟수 */
+            Size NumKeepAliveHits{0};
+            Size NumMisses{0};
+            Size NumEvictions{0};
+            Size NumKeptAlive{0};
+            Bytes KeptAliveBytes{0};
+            Bytes KeepAliveBudget{0};
         };
 
     public:
@@ -24,13 +38,97 @@ namespace ig::details
         virtual [[nodiscard]] bool IsCached(const Guid& guid) const = 0;
         virtual [[nodiscard]] Vector<Snapshot> TakeSnapshots() const = 0;
         [[nodiscard]] virtual Snapshot TakeSnapshot(const Guid& guid) const = 0;
+
+        [[nodiscard]] virtual Statistics GetStatistics() const = 0;
+        virtual void ResetStatistics() = 0;
+        virtual void SetKeepAliveBudget(const Bytes newBudget) = 0;
+        /* Keep-Alive 중인 에셋들의 총 크기가 targetBytes 이하가 될 때 까지 LRU 순으로 해제. 해제된 에셋의 수를 반환. */
+        virtual Size TrimKeepAlive(const Bytes targetBytes = 0) = 0;
     };
 
+    /*
+     * #sy_note Keep-Alive
+     * Managed 에셋의 RefCount가 0이 되더라도 즉시 해제하지 않고, 카테고리 별 예산(Budget) 내에서 LRU 순서로 유지한다.
+     * 유지 중인 에셋이 다시 로드되면 Loader를 거치지 않고 그대로 재사용 된다.
+     * 에셋의 크기(Footprint)는 캐싱 시점에 상주 중인 메모리(GPU 할당 포함)의 크기로, 에셋이 참조를 유지 하는 다른 에셋(ex. Material 의 Texture)의 크기를 포함 한다.
+     * 참조 되는 에셋은 RefCount > 0 이므로 스스로 Keep-Alive 상태가 될 수 없으며, 참조 하는 에셋이 해제 될 때 비로소 자신의 예산에 포함 된다.
+     * 크기를 알 수 없는 에셋도 kMinFootprint 만큼 예산을 차지 하므로, 예산 내에서 유지 되는 에셋의 수는 항상 제한 된다.
+     *
+     * #sy_note RefCount
+     * 엔트리는 Guid 마다 하나씩 생성 되어 캐시가 해제 될 때 까지 유지 되며(무효화 시 재사용), RefCount 는 엔트리에 원자적으로 저장 된다.
+     * Guid => 엔트리 조회는 Open Addressing 테이블(EntryTable)을 통해 잠금 없이 이루어 진다. 테이블에는 엔트리가 추가 되기만 하며,
+     * 추가와 테이블 확장은 배타적 잠금 하에서 이루어 진다. 확장 전의 테이블은 읽는 중인 스레드가 있을 수 있으므로 캐시가 해제 될 때 까지 유지 된다.
+     * RefCount가 0 => 1, 1 => 0 으로 변하는 경우(캐싱, Keep-Alive 진입/탈출, 해제)만 배타적 잠금을 사용하고,
+     * 이미 참조 되고 있는 에셋의 TryAcquire/TryRelease/Clone 은 잠금 없이 CAS로 처리 된다.
+     */
     template <typename T>
     class AssetCache final : public TypelessAssetCache
     {
+    private:
+        struct Entry
+        {
+        public:
+            /* 엔트리가 테이블에 추가 되기 전에 기록 되며, 이후 불변 */
+            Guid AssetGuid{};
+            /* 배타적 잠금 하에서만 변경 된다. 잠금 없이 읽는 경우, RefCount 의 증가(CAS)에 성공한 이후에만 읽어야 한다. */
+            std::atomic<U64> AssetHandleValue{Handle<T>{}.Value};
+            std::atomic<U32> RefCount{0};
+            Bytes Footprint{0};
+            bool bIsCached = false;
+        };
+
+        class EntryTable
+        {
+        public:
+            explicit EntryTable(const Size capacity)
+                : slots(capacity)
+                , mask(capacity - 1)
+            {
+                IG_CHECK(std::has_single_bit(capacity));
+            }
+
+            [[nodiscard]] Size GetCapacity() const noexcept { return slots.size(); }
+
+            [[nodiscard]] Entry* Find(const Guid& guid) const noexcept
+            {
+                for (Size slotIdx = std::hash<Guid>{}(guid) & mask;; slotIdx = (slotIdx + 1) & mask)
+                {
+                    Entry* entry = slots[slotIdx].load(std::memory_order_acquire);
+                    if (entry == nullptr || entry->AssetGuid == guid)
+                    {
+                        return entry;
+                    }
+                }
+            }
+
+            /* 배타적 잠금 하에서만 호출 되어야 한다. 테이블은 항상 빈 슬롯을 가진다. */
+            void Insert(Entry& entry) noexcept
+            {
+                Size slotIdx = std::hash<Guid>{}(entry.AssetGuid) & mask;
+                while (slots[slotIdx].load(std::memory_order_relaxed) != nullptr)
+                {
+                    slotIdx = (slotIdx + 1) & mask;
+                }
+                slots[slotIdx].store(&entry, std::memory_order_release);
+            }
+
+        private:
+            /* eastl::vector 의 크기 지정 생성은 원소를 복사 하므로, 복사 할 수 없는 원자적 타입을 위해 std::vector 를 사용 */
+            std::vector<std::atomic<Entry*>> slots;
+            Size mask;
+        };
+
     public:
-        AssetCache() = default;
+        constexpr static Bytes kMinFootprint = KiloBytesToBytes(4);
+
+    public:
+        explicit AssetCache(const Bytes keepAliveBudget = 0)
+            : keepAliveBudget(keepAliveBudget)
+        {
+            entryTables.emplace_back(MakePtr<EntryTable>(kInitialEntryTableCapacity));
+            publishedEntryTable.store(entryTables.back().get(), std::memory_order_release);
+        }
+
         AssetCache(const AssetCache&) = delete;
         AssetCache(AssetCache&&) noexcept = delete;
         ~AssetCache() override = default;
@@ -40,15 +138,18 @@ namespace ig::details
 
         EAssetCategory GetAssetType() const override { return AssetType; }
 
-        void Cache(const Guid& guid, T asset)
+        void Cache(const Guid& guid, T asset, const Bytes footprint = 0)
         {
             IG_CHECK(guid.isValid());
 
             ReadWriteLock rwLock{mutex};
-            IG_CHECK(!cachedAssets.contains(guid));
-            IG_CHECK(!refCounterTable.contains(guid));
-            cachedAssets[guid] = registry.Create(std::move(asset));
-            refCounterTable[guid] = 0;
+            Entry& newEntry{FindOrCreateEntryUnsafe(guid)};
+            IG_CHECK(!newEntry.bIsCached);
+            IG_CHECK(newEntry.RefCount.load(std::memory_order_relaxed) == 0);
+            newEntry.AssetHandleValue.store(registry.Create(std::move(asset)).Value, std::memory_order_relaxed);
+            newEntry.Footprint = std::max(footprint, kMinFootprint);
+            newEntry.bIsCached = true;
+            ++numCachedEntries;
         }
 
         void Invalidate(const Guid& guid) override
@@ -57,22 +158,94 @@ namespace ig::details
             InvalidateUnsafe(guid);
         }
 
+        /*
+         * 캐시 된 에셋 인스턴스를 asset 과 교체 한다. 핸들(슬롯)은 그대로 유지 되므로 기존 핸들 들은 계속 유효 하다.
+         * 교체 후 asset 은 이전 인스턴스를 가지게 되며, 그 해제는 호출자에게 맡긴다.
+         * expectedHandle 은 교체가 요청 된 시점의 핸들 이다. 캐시 되어 있지 않거나, 그 사이 해제 후 다시 캐시 되어 핸들(버전)이 달라졌다면 false.
+         */
+        [[nodiscard]] bool Swap(const Guid& guid, const Handle<T> expectedHandle, T& asset)
+        {
+            ReadWriteLock rwLock{mutex};
+            const Entry* entry = FindCachedEntryUnsafe(guid);
+            if (entry == nullptr || GetHandle(*entry) != expectedHandle)
+            {
+                return false;
+            }
+
+            T* cachedAssetPtr = registry.Lookup(GetHandle(*entry));
+            IG_CHECK(cachedAssetPtr != nullptr);
+            std::swap(*cachedAssetPtr, asset);
+            return true;
+        }
+
         [[nodiscard]] Handle<T> Load(const Guid& guid, const bool bShouldIncreaseRefCounter = true)
         {
+            if (bShouldIncreaseRefCounter)
+            {
+                if (Entry* entry = FindEntry(guid);
+                    entry != nullptr && TryIncreaseRefCount(*entry, 1))
+                {
+                    return GetHandle(*entry);
+                }
+            }
+
             ReadWriteLock rwLock{mutex};
             return LoadUnsafe(guid, bShouldIncreaseRefCounter);
         }
 
+        /* 이미 참조 되고 있는(RefCount > 0) 에셋인 경우에만 RefCount를 증가시킨 핸들을 반환. 잠금을 사용하지 않는다. */
+        [[nodiscard]] Handle<T> TryAcquire(const Guid& guid)
+        {
+            Entry* entry = FindEntry(guid);
+            if (entry == nullptr || !TryIncreaseRefCount(*entry, 1))
+            {
+                return Handle<T>{};
+            }
+
+            numHits.fetch_add(1, std::memory_order_relaxed);
+            return GetHandle(*entry);
+        }
+
+        /* 캐싱 되어 있다면(Keep-Alive 포함) RefCount를 증가시킨 핸들을, 그렇지 않다면 유효하지 않은 핸들을 반환. Hit/Miss 가 집계 된다. */
+        [[nodiscard]] Handle<T> TryLoad(const Guid& guid)
+        {
+            if (Handle<T> acquiredHandle{TryAcquire(guid)};
+                acquiredHandle)
+            {
+                return acquiredHandle;
+            }
+
+            ReadWriteLock rwLock{mutex};
+            if (!IsCachedUnsafe(guid))
+            {
+                numMisses.fetch_add(1, std::memory_order_relaxed);
+                return Handle<T>{};
+            }
+
+            numHits.fetch_add(1, std::memory_order_relaxed);
+            if (keepAliveTickTable.contains(guid))
+            {
+                numKeepAliveHits.fetch_add(1, std::memory_order_relaxed);
+            }
+            return LoadUnsafe(guid);
+        }
+
         void Clone(const Guid& guid, const U32 numClones = 1)
         {
             IG_CHECK(numClones > 0);
             IG_CHECK(guid.isValid());
 
-            ReadWriteLock rwLock{mutex};
-            IG_CHECK(cachedAssets.contains(guid));
-            IG_CHECK(refCounterTable.contains(guid));
+            if (Entry* entry = FindEntry(guid);
+                entry != nullptr && TryIncreaseRefCount(*entry, numClones))
+            {
+                return;
+            }
 
-            refCounterTable[guid] += numClones;
+            ReadWriteLock rwLock{mutex};
+            Entry* entry = FindCachedEntryUnsafe(guid);
+            IG_CHECK(entry != nullptr);
+            RemoveFromKeepAliveUnsafe(guid);
+            entry->RefCount.fetch_add(numClones, std::memory_order_acq_rel);
         }
 
         [[nodiscard]] bool IsCached(const Guid& guid) const override
@@ -93,17 +266,41 @@ namespace ig::details
             return registry.Lookup(handle);
         }
 
+        /* RefCount가 1 보다 큰 경우에만 잠금 없이 감소 시킴. RefCount가 0이 되어야 하는 경우는 Unload를 통해 처리 되어야 한다. */
+        [[nodiscard]] bool TryRelease(const Guid& guid)
+        {
+            Entry* entry = FindEntry(guid);
+            return entry != nullptr && TryDecreaseRefCount(*entry);
+        }
+
         void Unload(const AssetInfo& assetInfo)
         {
             const Guid& guid = assetInfo.GetGuid();
+            if (TryRelease(guid))
+            {
+                return;
+            }
+
             ReadWriteLock rwLock{mutex};
-            IG_CHECK(cachedAssets.contains(guid));
-            IG_CHECK(refCounterTable.contains(guid));
-            IG_CHECK(refCounterTable[guid] > 0);
-            const U32 refCount{--refCounterTable[guid]};
+            Entry* entryPtr = FindCachedEntryUnsafe(guid);
+            IG_CHECK(entryPtr != nullptr);
+            Entry& entry{*entryPtr};
+            IG_CHECK(entry.RefCount.load(std::memory_order_relaxed) > 0);
+            const U32 refCount{entry.RefCount.fetch_sub(1, std::memory_order_acq_rel) - 1};
             if (refCount == 0 && assetInfo.GetScope() == EAssetScope::Managed)
             {
-                InvalidateUnsafe(guid);
+                if (entry.Footprint > keepAliveBudget)
+                {
+                    InvalidateUnsafe(guid);
+                }
+                else
+                {
+                    const U64 tick = ++keepAliveTick;
+                    keepAliveTickTable[guid] = tick;
+                    keepAliveList[tick] = guid;
+                    keptAliveBytes += entry.Footprint;
+                    TrimKeepAliveUnsafe(keepAliveBudget);
+                }
             }
         }
 
@@ -113,10 +310,19 @@ namespace ig::details
         {
             ReadOnlyLock lock{mutex};
             Vector<Snapshot> refCounterSnapshots{};
-            refCounterSnapshots.reserve(refCounterTable.size());
-            for (const auto& guidRefCounter : refCounterTable)
+            refCounterSnapshots.reserve(numCachedEntries);
+            for (const Ptr<Entry>& entry : entries)
             {
-                refCounterSnapshots.emplace_back(Snapshot{.HandleHash = cachedAssets.at(guidRefCounter.first).GetHash(), .RefCount = guidRefCounter.second});
+                if (!entry->bIsCached)
+                {
+                    continue;
+                }
+
+                refCounterSnapshots.emplace_back(Snapshot{
+                    .HandleHash = GetHandle(*entry).GetHash(),
+                    .RefCount = entry->RefCount.load(std::memory_order_relaxed),
+                    .bIsKeptAlive = keepAliveTickTable.contains(entry->AssetGuid)
+                });
             }
 
             return refCounterSnapshots;
@@ -125,49 +331,223 @@ namespace ig::details
         [[nodiscard]] Snapshot TakeSnapshot(const Guid& guid) const override
         {
             ReadOnlyLock lock{mutex};
-            const auto refCounterItr = refCounterTable.find(guid);
-            return refCounterItr != refCounterTable.cend() ? Snapshot{.HandleHash = cachedAssets.at(guid).GetHash(), .RefCount = refCounterItr->second} : Snapshot{};
+            const Entry* entry = FindCachedEntryUnsafe(guid);
+            return entry != nullptr ?
+                Snapshot{
+                    .HandleHash = GetHandle(*entry).GetHash(),
+                    .RefCount = entry->RefCount.load(std::memory_order_relaxed),
+                    .bIsKeptAlive = keepAliveTickTable.contains(guid)
+                } :
+                Snapshot{};
+        }
+
+        [[nodiscard]] Statistics GetStatistics() const override
+        {
+            ReadOnlyLock lock{mutex};
+            return Statistics{
+                .NumHits = numHits.load(std::memory_order_relaxed),
+                .NumKeepAliveHits = numKeepAliveHits.load(std::memory_order_relaxed),
+                .NumMisses = numMisses.load(std::memory_order_relaxed),
+                .NumEvictions = numEvictions.load(std::memory_order_relaxed),
+                .NumKeptAlive = keepAliveList.size(),
+                .KeptAliveBytes = keptAliveBytes,
+                .KeepAliveBudget = keepAliveBudget
+            };
+        }
+
+        void ResetStatistics() override
+        {
+            numHits.store(0, std::memory_order_relaxed);
+            numKeepAliveHits.store(0, std::memory_order_relaxed);
+            numMisses.store(0, std::memory_order_relaxed);
+            numEvictions.store(0, std::memory_order_relaxed);
+        }
+
+        void SetKeepAliveBudget(const Bytes newBudget) override
+        {
+            ReadWriteLock rwLock{mutex};
+            keepAliveBudget = newBudget;
+            TrimKeepAliveUnsafe(keepAliveBudget);
+        }
+
+        Size TrimKeepAlive(const Bytes targetBytes = 0) override
+        {
+            ReadWriteLock rwLock{mutex};
+            return TrimKeepAliveUnsafe(targetBytes);
         }
 
     private:
+        [[nodiscard]] static Handle<T> GetHandle(const Entry& entry) noexcept
+        {
+            return Handle<T>{entry.AssetHandleValue.load(std::memory_order_relaxed)};
+        }
+
+        /* 잠금 없이 엔트리를 찾는다. 반환 된 엔트리는 캐시 되어 있지 않을 수 있다. */
+        [[nodiscard]] Entry* FindEntry(const Guid& guid) const noexcept
+        {
+            IG_CHECK(guid.isValid());
+            return publishedEntryTable.load(std::memory_order_acquire)->Find(guid);
+        }
+
+        [[nodiscard]] Entry* FindCachedEntryUnsafe(const Guid& guid) const noexcept
+        {
+            Entry* entry = FindEntry(guid);
+            return entry != nullptr && entry->bIsCached ? entry : nullptr;
+        }
+
+        Entry& FindOrCreateEntryUnsafe(const Guid& guid)
+        {
+            if (Entry* entry = FindEntry(guid);
+                entry != nullptr)
+            {
+                return *entry;
+            }
+
+            /* 부하율을 1/2 이하로 유지; 확장 된 테이블은 모든 엔트리가 추가 된 이후에 공개 된다. */
+            EntryTable* entryTable = entryTables.back().get();
+            if ((entries.size() + 1) * 2 > entryTable->GetCapacity())
+            {
+                Ptr<EntryTable> newEntryTable{MakePtr<EntryTable>(entryTable->GetCapacity() * 2)};
+                for (const Ptr<Entry>& entry : entries)
+                {
+                    newEntryTable->Insert(*entry);
+                }
+
+                entryTable = newEntryTable.get();
+                entryTables.emplace_back(std::move(newEntryTable));
+                publishedEntryTable.store(entryTable, std::memory_order_release);
+            }
+
+            Ptr<Entry>& newEntry{entries.emplace_back(MakePtr<Entry>())};
+            newEntry->AssetGuid = guid;
+            entryTable->Insert(*newEntry);
+            return *newEntry;
+        }
+
         [[nodiscard]] bool IsCachedUnsafe(const Guid& guid) const
         {
             IG_CHECK(guid.isValid());
-            return cachedAssets.contains(guid) && refCounterTable.contains(guid);
+            return FindCachedEntryUnsafe(guid) != nullptr;
         }
 
         [[nodiscard]] Handle<T> LoadUnsafe(const Guid& guid, const bool bShouldIncreaseRefCounter = true)
         {
             IG_CHECK(guid.isValid());
-            IG_CHECK(cachedAssets.contains(guid));
-            IG_CHECK(refCounterTable.contains(guid));
-
+            Entry* entry = FindCachedEntryUnsafe(guid);
+            IG_CHECK(entry != nullptr);
             if (bShouldIncreaseRefCounter)
             {
-                ++refCounterTable[guid];
+                RemoveFromKeepAliveUnsafe(guid);
+                /* 잠금 없이 RefCount 를 증가 시키는 스레드가 핸들을 볼 수 있도록 release */
+                entry->RefCount.fetch_add(1, std::memory_order_acq_rel);
             }
 
-            return cachedAssets[guid];
+            return GetHandle(*entry);
         }
 
         void InvalidateUnsafe(const Guid& guid)
         {
             IG_CHECK(guid.isValid());
-            IG_CHECK(cachedAssets.contains(guid));
-            IG_CHECK(refCounterTable.contains(guid));
+            Entry* entry = FindCachedEntryUnsafe(guid);
+            IG_CHECK(entry != nullptr);
+
+            RemoveFromKeepAliveUnsafe(guid);
+            /* 잠금 없는 경로의 CAS 가 더 이상 성공 하지 않도록 RefCount 를 먼저 0으로 만든다. */
+            entry->RefCount.store(0, std::memory_order_release);
+            registry.Destroy(GetHandle(*entry));
+            entry->AssetHandleValue.store(Handle<T>{}.Value, std::memory_order_relaxed);
+            entry->Footprint = 0;
+            entry->bIsCached = false;
+            --numCachedEntries;
+        }
+
+        void RemoveFromKeepAliveUnsafe(const Guid& guid)
+        {
+            const auto tickItr = keepAliveTickTable.find(guid);
+            if (tickItr == keepAliveTickTable.end())
+            {
+                return;
+            }
+
+            const Bytes footprint{FindEntry(guid)->Footprint};
+            IG_CHECK(keptAliveBytes >= footprint);
+            keptAliveBytes -= footprint;
+            keepAliveList.erase(tickItr->second);
+            keepAliveTickTable.erase(tickItr);
+        }
+
+        Size TrimKeepAliveUnsafe(const Bytes targetBytes)
+        {
+            Size numEvicted = 0;
+            while (!keepAliveList.empty() && keptAliveBytes > targetBytes)
+            {
+                /* 가장 오래 전에 Keep-Alive 상태가 된 에셋 부터 해제 */
+                const Guid guid{keepAliveList.begin()->second};
+                IG_CHECK(FindEntry(guid)->RefCount.load(std::memory_order_relaxed) == 0);
+                InvalidateUnsafe(guid);
+                ++numEvicted;
+            }
 
-            registry.Destroy(cachedAssets[guid]);
-            cachedAssets.erase(guid);
-            refCounterTable.erase(guid);
+            numEvictions.fetch_add(numEvicted, std::memory_order_relaxed);
+            return numEvicted;
+        }
+
+        /* RefCount가 0인 경우(Keep-Alive 이거나, 캐싱 직후)는 배타적 잠금 하에서 처리 되어야 하므로 실패 */
+        static bool TryIncreaseRefCount(Entry& entry, const U32 amount)
+        {
+            U32 refCount = entry.RefCount.load(std::memory_order_relaxed);
+            while (refCount > 0)
+            {
+                if (entry.RefCount.compare_exchange_weak(refCount, refCount + amount, std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /* RefCount가 0이 되는 경우 배타적 잠금 하에서 처리 되어야 하므로 실패 */
+        static bool TryDecreaseRefCount(Entry& entry)
+        {
+            U32 refCount = entry.RefCount.load(std::memory_order_relaxed);
+            while (refCount > 1)
+            {
+                if (entry.RefCount.compare_exchange_weak(refCount, refCount - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+
+            return false;
         }
 
     public:
         constexpr static EAssetCategory AssetType = AssetCategoryOf<T>;
 
+    private:
+        constexpr static Size kInitialEntryTableCapacity = 256;
+
     private:
         mutable SharedMutex mutex;
         HandleStorage<T> registry;
-        UnorderedMap<Guid, Handle<T>> cachedAssets{};
-        UnorderedMap<Guid, U32> refCounterTable{};
+        /* Guid 마다 하나의 엔트리; 엔트리의 주소는 캐시가 해제 될 때 까지 유지 된다. */
+        Vector<Ptr<Entry>> entries{};
+        Size numCachedEntries{0};
+        /* 가장 마지막 테이블이 공개 된 테이블. 이전 테이블 들은 잠금 없이 읽는 중인 스레드를 위해 유지 된다. */
+        Vector<Ptr<EntryTable>> entryTables{};
+        std::atomic<EntryTable*> publishedEntryTable{nullptr};
+
+        Bytes keepAliveBudget{0};
+        Bytes keptAliveBytes{0};
+        U64 keepAliveTick{0};
+        /* Tick(오름차순) => Guid; 가장 앞의 원소가 가장 오래 전에 사용된 에셋 */
+        OrderedMap<U64, Guid> keepAliveList{};
+        UnorderedMap<Guid, U64> keepAliveTickTable{};
+
+        std::atomic<Size> numHits{0};
+        std::atomic<Size> numKeepAliveHits{0};
+        std::atomic<Size> numMisses{0};
+        std::atomic<Size> numEvictions{0};
     };
 } // namespace ig::details
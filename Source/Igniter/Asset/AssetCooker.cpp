@@ -0,0 +1,391 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Core/Timer.h"
+#include "Igniter/Core/Serialization.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/Texture.h"
+#include "Igniter/Asset/StaticMesh.h"
+#include "Igniter/Asset/AudioClip.h"
+#include "Igniter/Asset/TextureImporter.h"
+#include "Igniter/Asset/StaticMeshImporter.h"
+#include "Igniter/Asset/MaterialImporter.h"
+#include "Igniter/Asset/AudioClipImporter.h"
+#include "Igniter/Asset/AssetMonitor.h"
+#include "Igniter/Asset/AssetCooker.h"
+
+IG_DECLARE_LOG_CATEGORY(AssetCookerLog);
+
+IG_DEFINE_LOG_CATEGORY(AssetCookerLog);
+
+namespace ig
+{
+    static EAssetCategory DeduceCategoryFromExtension(const Path& resPath)
+    {
+        std::string extension{resPath.extension().string()};
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](const char character) { return (char)std::tolower(character); });
+
+        constexpr std::string_view kTextureExtensions[]{".dds", ".png", ".jpg", ".jpeg", ".bmp", ".tga", ".hdr"};
+        constexpr std::string_view kStaticMeshExtensions[]{".fbx", ".obj", ".gltf", ".glb", ".blend", ".dae"};
+        constexpr std::string_view kAudioExtensions[]{".wav", ".mp3", ".ogg", ".flac"};
+        if (std::ranges::find(kTextureExtensions, extension) != std::end(kTextureExtensions))
+        {
+            return EAssetCategory::Texture;
+        }
+
+        if (std::ranges::find(kStaticMeshExtensions, extension) != std::end(kStaticMeshExtensions))
+        {
+            return EAssetCategory::StaticMesh;
+        }
+
+        if (std::ranges::find(kAudioExtensions, extension) != std::end(kAudioExtensions))
+        {
+            return EAssetCategory::Audio;
+        }
+
+        return EAssetCategory::Unknown;
+    }
+
+    AssetCooker::AssetCooker(const Size numWorkers)
+        : cookExecutor(std::max<Size>(numWorkers, 1))
+        , importExecutor(std::max<Size>(numWorkers, 1))
+        , assetMonitor(MakePtr<details::AssetMonitor>(importExecutor))
+        , textureImporter(MakePtr<TextureImporter>(importExecutor, false))
+        , staticMeshImporter(MakePtr<StaticMeshImporter>(importExecutor,
+            [this](const std::string_view virtualPath, const MaterialAssetCreateDesc& createDesc)
+            {
+                return CreateMaterial(virtualPath, createDesc);
+            }))
+        , audioClipImporter(MakePtr<AudioClipImporter>())
+    {}
+
+    AssetCooker::~AssetCooker() {}
+
+    AssetCookReport AssetCooker::Cook(const std::span<const AssetCookItem> items)
+    {
+        TempTimer cookTimer{};
+        cookTimer.Begin();
+
+        AssetCookReport report{};
+        report.Records.resize(items.size());
+
+        /* Material 은 참조 할 텍스처가 모두 등록 된 이후에 처리 */
+        tf::Taskflow cookFlow{};
+        tf::Task resourcePass = cookFlow.for_each_index(0, (S32)items.size(), 1,
+            [this, items, &report](const Index itemIdx)
+            {
+                const AssetCookItem& item{items[itemIdx]};
+                switch (item.Category)
+                {
+                case EAssetCategory::Texture:
+                    report.Records[itemIdx] = CookTexture(item);
+                    break;
+                case EAssetCategory::StaticMesh:
+                    report.Records[itemIdx] = CookStaticMesh(item);
+                    break;
+                case EAssetCategory::Audio:
+                    report.Records[itemIdx] = CookAudioClip(item);
+                    break;
+                default:
+                    break;
+                }
+            });
+
+        tf::Task materialPass = cookFlow.for_each_index(0, (S32)items.size(), 1,
+            [this, items, &report](const Index itemIdx)
+            {
+                const AssetCookItem& item{items[itemIdx]};
+                if (item.Category == EAssetCategory::Material)
+                {
+                    report.Records[itemIdx] = CookMaterial(item);
+                }
+                else if (item.Category != EAssetCategory::Texture && item.Category != EAssetCategory::StaticMesh &&
+                    item.Category != EAssetCategory::Audio)
+                {
+                    report.Records[itemIdx] = AssetCookRecord{.Category = item.Category, .Source = item.Source, .Status = "UnsupportedCategory"};
+                }
+            });
+        resourcePass.precede(materialPass);
+        cookExecutor.run(cookFlow).wait();
+
+        assetMonitor->SaveAllChanges();
+
+        report.NumFailed = std::ranges::count_if(report.Records, [](const AssetCookRecord& record) { return !record.bSucceeded; });
+        report.ElapsedMs = cookTimer.End();
+        IG_LOG(AssetCookerLog, Info, "{} items cooked in {} ms. (Failed: {})", items.size(), report.ElapsedMs, report.NumFailed);
+        return report;
+    }
+
+    AssetCookRecord AssetCooker::CookTexture(const AssetCookItem& item)
+    {
+        TempTimer cookTimer{};
+        cookTimer.Begin();
+
+        TextureImportDesc importDesc{};
+        if (!item.SerializedDesc.empty())
+        {
+            item.SerializedDesc >> importDesc;
+        }
+
+        AssetCookRecord record{.Category = EAssetCategory::Texture, .Source = item.Source};
+        Result<Texture::Desc, ETextureImportStatus> result{textureImporter->Import(item.Source, importDesc)};
+        record.Status = ToCStr(result.GetStatus());
+        if (result.HasOwnership())
+        {
+            const Guid guid{Register<Texture>(result.Take())};
+            record.bSucceeded = guid.isValid();
+            record.Outputs.emplace_back(guid);
+        }
+
+        record.ElapsedMs = cookTimer.End();
+        return record;
+    }
+
+    AssetCookRecord AssetCooker::CookStaticMesh(const AssetCookItem& item)
+    {
+        TempTimer cookTimer{};
+        cookTimer.Begin();
+
+        StaticMeshImportDesc importDesc{};
+        if (!item.SerializedDesc.empty())
+        {
+            item.SerializedDesc >> importDesc;
+        }
+
+        AssetCookRecord record{.Category = EAssetCategory::StaticMesh, .Source = item.Source, .bSucceeded = true};
+        Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> results{staticMeshImporter->Import(item.Source, importDesc)};
+        record.Status = ToCStr(EStaticMeshImportStatus::Success);
+        for (Result<StaticMesh::Desc, EStaticMeshImportStatus>& result : results)
+        {
+            if (!result.HasOwnership())
+            {
+                record.bSucceeded = false;
+                record.Status = ToCStr(result.GetStatus());
+                continue;
+            }
+
+            const Guid guid{Register<StaticMesh>(result.Take())};
+            record.bSucceeded = record.bSucceeded && guid.isValid();
+            record.Outputs.emplace_back(guid);
+        }
+
+        record.bSucceeded = record.bSucceeded && !results.empty();
+        record.ElapsedMs = cookTimer.End();
+        return record;
+    }
+
+    AssetCookRecord AssetCooker::CookMaterial(const AssetCookItem& item)
+    {
+        TempTimer cookTimer{};
+        cookTimer.Begin();
+
+        const std::string diffuseVirtualPath{
+            item.SerializedDesc.is_object() ? item.SerializedDesc.value("DiffuseVirtualPath", std::string{Texture::EngineDefault}) :
+                                              std::string{Texture::EngineDefault}
+        };
+        const Guid guid{CreateMaterial(item.Source, MaterialAssetCreateDesc{.DiffuseVirtualPath = diffuseVirtualPath})};
+
+        AssetCookRecord record{
+            .Category = EAssetCategory::Material,
+            .Source = item.Source,
+            .bSucceeded = guid.isValid(),
+            .Status = guid.isValid() ? ToCStr(EMaterialAssetImportStatus::Success) : ToCStr(EMaterialAssetImportStatus::InvalidAssetInfo)
+        };
+        record.Outputs.emplace_back(guid);
+        record.ElapsedMs = cookTimer.End();
+        return record;
+    }
+
+    AssetCookRecord AssetCooker::CookAudioClip(const AssetCookItem& item)
+    {
+        TempTimer cookTimer{};
+        cookTimer.Begin();
+
+        AssetCookRecord record{.Category = EAssetCategory::Audio, .Source = item.Source};
+        Result<AudioClip::Desc, EAudioClipImportError> result{audioClipImporter->Import(AudioClipImportDesc{.Path = item.Source})};
+        record.Status = ToCStr(result.GetStatus());
+        if (result.HasOwnership())
+        {
+            const Guid guid{Register<AudioClip>(result.Take())};
+            record.bSucceeded = guid.isValid();
+            record.Outputs.emplace_back(guid);
+        }
+
+        record.ElapsedMs = cookTimer.End();
+        return record;
+    }
+
+    Guid AssetCooker::CreateMaterial(const std::string_view virtualPath, const MaterialAssetCreateDesc& createDesc)
+    {
+        if (!IsValidVirtualPath(virtualPath))
+        {
+            IG_LOG(AssetCookerLog, Error, "Create Material: Invalid Virtual Path {}", virtualPath);
+            return Guid{};
+        }
+
+        /* 엔진 기본 텍스처는 AssetMonitor 에 등록 되지 않기 때문에 직접 해석 한다. */
+        Guid diffuseTexGuid{DefaultTextureGuid};
+        if (createDesc.DiffuseVirtualPath == Texture::EngineDefaultWhite)
+        {
+            diffuseTexGuid = Guid{DefaultWhiteTextureGuid};
+        }
+        else if (createDesc.DiffuseVirtualPath == Texture::EngineDefaultBlack)
+        {
+            diffuseTexGuid = Guid{DefaultBlackTextureGuid};
+        }
+        else if (createDesc.DiffuseVirtualPath != Texture::EngineDefault)
+        {
+            if (assetMonitor->Contains(EAssetCategory::Texture, createDesc.DiffuseVirtualPath))
+            {
+                diffuseTexGuid = assetMonitor->GetGuid(EAssetCategory::Texture, createDesc.DiffuseVirtualPath);
+            }
+            else
+            {
+                IG_LOG(AssetCookerLog, Warning, "Material {}: Texture \"{}\" does not exists. Fallback to engine default.", virtualPath,
+                    createDesc.DiffuseVirtualPath);
+            }
+        }
+
+        Result<Material::Desc, EMaterialAssetImportStatus> result{
+            MaterialImporter::Export(AssetInfo{virtualPath, EAssetCategory::Material}, Material::LoadDesc{.DiffuseTexGuid = diffuseTexGuid})
+        };
+        if (!result.HasOwnership())
+        {
+            IG_LOG(AssetCookerLog, Error, "Failed({}) to create material {}.", result.GetStatus(), virtualPath);
+            return Guid{};
+        }
+
+        return Register<Material>(result.Take());
+    }
+
+    template <typename T>
+    Guid AssetCooker::Register(const typename T::Desc& desc)
+    {
+        constexpr auto kAssetCategory{AssetCategoryOf<T>};
+        AssetInfo assetInfo{desc.Info};
+        IG_CHECK(assetInfo.IsValid());
+        IG_CHECK(assetInfo.GetCategory() == kAssetCategory);
+
+        const std::string_view virtualPath{assetInfo.GetVirtualPath()};
+        const Path newAssetPath{MakeAssetPath(kAssetCategory, assetInfo.GetGuid())};
+        const Path newAssetMetadataPath{MakeAssetMetadataPath(kAssetCategory, assetInfo.GetGuid())};
+
+        UniqueLock lock{registerMutex};
+        if (assetMonitor->Contains(kAssetCategory, virtualPath))
+        {
+            const AssetInfo oldAssetInfo{assetMonitor->GetAssetInfo(kAssetCategory, virtualPath)};
+            IG_CHECK(oldAssetInfo.IsValid());
+            if (oldAssetInfo.GetScope() == EAssetScope::Engine)
+            {
+                IG_LOG(AssetCookerLog, Error, "{}: Given virtual path {} was reserved by engine.", kAssetCategory, virtualPath);
+                fs::remove(newAssetPath);
+                fs::remove(newAssetMetadataPath);
+                return Guid{};
+            }
+
+            /* 쿠커는 임시 에셋(복구용 백업)을 남기지 않고 바로 교체 한다. */
+            assetMonitor->Remove(oldAssetInfo.GetGuid(), false);
+            const Path oldAssetPath{MakeAssetPath(kAssetCategory, oldAssetInfo.GetGuid())};
+            const Path oldAssetMetadataPath{MakeAssetMetadataPath(kAssetCategory, oldAssetInfo.GetGuid())};
+            fs::remove(oldAssetPath);
+            fs::remove(oldAssetMetadataPath);
+            fs::rename(newAssetPath, oldAssetPath);
+            fs::rename(newAssetMetadataPath, oldAssetMetadataPath);
+
+            assetInfo.SetGuid(oldAssetInfo.GetGuid());
+            IG_LOG(AssetCookerLog, Warning, "{}: {} already exists. Replaced with newly cooked one.", kAssetCategory, virtualPath);
+        }
+
+        assetMonitor->Create<T>(assetInfo, desc.LoadDescriptor);
+        return assetInfo.GetGuid();
+    }
+
+    std::optional<Vector<AssetCookItem>> AssetCooker::LoadManifest(const Path& manifestPath)
+    {
+        const Json manifest{LoadJsonFromFile(manifestPath)};
+        if (manifest.empty() || !manifest.contains("Items") || !manifest["Items"].is_array())
+        {
+            IG_LOG(AssetCookerLog, Error, "Invalid cook manifest {}.", manifestPath.string());
+            return std::nullopt;
+        }
+
+        Vector<AssetCookItem> items{};
+        items.reserve(manifest["Items"].size());
+        for (const Json& serializedItem : manifest["Items"])
+        {
+            AssetCookItem item{
+                .Category = magic_enum::enum_cast<EAssetCategory>(serializedItem.value("Category", std::string{})).value_or(EAssetCategory::Unknown),
+                .Source = serializedItem.value("Source", std::string{}),
+                .SerializedDesc = serializedItem.value("Desc", Json{})
+            };
+
+            if (item.Source.empty())
+            {
+                IG_LOG(AssetCookerLog, Error, "Invalid cook manifest {}. Item source is empty.", manifestPath.string());
+                return std::nullopt;
+            }
+
+            if (item.Category == EAssetCategory::Unknown)
+            {
+                item.Category = DeduceCategoryFromExtension(item.Source);
+            }
+
+            items.emplace_back(std::move(item));
+        }
+
+        return items;
+    }
+
+    Vector<AssetCookItem> AssetCooker::ScanDirectory(const Path& directoryPath)
+    {
+        Vector<AssetCookItem> items{};
+        std::error_code errorCode{};
+        for (const fs::directory_entry& entry : fs::recursive_directory_iterator{directoryPath, errorCode})
+        {
+            if (!entry.is_regular_file())
+            {
+                continue;
+            }
+
+            const EAssetCategory category{DeduceCategoryFromExtension(entry.path())};
+            if (category != EAssetCategory::Unknown)
+            {
+                items.emplace_back(AssetCookItem{.Category = category, .Source = entry.path().string()});
+            }
+        }
+
+        if (errorCode)
+        {
+            IG_LOG(AssetCookerLog, Error, "Failed to scan {}: {}", directoryPath.string(), errorCode.message());
+        }
+
+        return items;
+    }
+
+    bool AssetCooker::SaveReport(const Path& reportPath, const AssetCookReport& report)
+    {
+        Json serializedReport{};
+        serializedReport["NumItems"] = report.Records.size();
+        serializedReport["NumFailed"] = report.NumFailed;
+        serializedReport["ElapsedMs"] = report.ElapsedMs;
+        serializedReport["Records"] = Json::array();
+        for (const AssetCookRecord& record : report.Records)
+        {
+            Json serializedOutputs = Json::array();
+            for (const Guid& output : record.Outputs)
+            {
+                serializedOutputs.push_back(output.str());
+            }
+
+            serializedReport["Records"].push_back(Json{
+                {"Category", ToCStr(record.Category)},
+                {"Source", record.Source},
+                {"Succeeded", record.bSucceeded},
+                {"Status", record.Status},
+                {"Outputs", serializedOutputs},
+                {"ElapsedMs", record.ElapsedMs}
+            });
+        }
+
+        return SaveJsonToFile(reportPath, serializedReport);
+    }
+} // namespace ig
@@ -0,0 +1,98 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Asset/Common.h"
+#include "Igniter/Asset/Material.h"
+
+namespace ig::details
+{
+    class AssetMonitor;
+} // namespace ig::details
+
+namespace ig
+{
+    class TextureImporter;
+    class StaticMeshImporter;
+    class AudioClipImporter;
+
+    struct AssetCookItem
+    {
+    public:
+        EAssetCategory Category = EAssetCategory::Unknown;
+        /* 리소스 파일 경로. Material 의 경우 생성 할 에셋의 Virtual Path */
+        std::string Source{};
+        /* 각 카테고리 별 ImportDesc 의 직렬화 결과. 비어 있다면 기본 값을 사용 한다. */
+        Json SerializedDesc{};
+    };
+
+    struct AssetCookRecord
+    {
+    public:
+        EAssetCategory Category = EAssetCategory::Unknown;
+        std::string Source{};
+        bool bSucceeded = false;
+        std::string Status{};
+        Vector<Guid> Outputs{};
+        Size ElapsedMs = 0;
+    };
+
+    struct AssetCookReport
+    {
+    public:
+        Vector<AssetCookRecord> Records{};
+        Size NumFailed = 0;
+        Size ElapsedMs = 0;
+    };
+
+    /*
+     * #sy_note 에셋 쿠커
+     * Engine 인스턴스(D3D12 Device, Window, AudioSystem) 없이 리소스를 에셋으로 임포트 한다.
+     * 결과물은 에디터에서 임포트 한 것과 동일하게 'Assets\{Type}\{GUID}' 및 메타데이터로 기록 된다.
+     * Texture, StaticMesh, Audio 는 병렬로 처리 되며, Material 은 참조 할 텍스처가 모두 쿠킹 된 이후에 처리 된다.
+     *
+     * Manifest(json)
+     * { "Items": [ { "Category": "Texture", "Source": "Resources\\Foo.png", "Desc": { <Serialized TextureImportDesc> } },
+     *              { "Category": "Material", "Source": "Foo", "Desc": { "DiffuseVirtualPath": "Foo" } } ] }
+     */
+    class AssetCooker final
+    {
+    public:
+        explicit AssetCooker(const Size numWorkers = std::thread::hardware_concurrency());
+        AssetCooker(const AssetCooker&) = delete;
+        AssetCooker(AssetCooker&&) noexcept = delete;
+        ~AssetCooker();
+
+        AssetCooker& operator=(const AssetCooker&) = delete;
+        AssetCooker& operator=(AssetCooker&&) noexcept = delete;
+
+        [[nodiscard]] AssetCookReport Cook(const std::span<const AssetCookItem> items);
+
+        [[nodiscard]] static std::optional<Vector<AssetCookItem>> LoadManifest(const Path& manifestPath);
+        /* 확장자를 기준으로 카테고리를 결정 하며, 모든 항목은 기본 ImportDesc 를 사용 한다. */
+        [[nodiscard]] static Vector<AssetCookItem> ScanDirectory(const Path& directoryPath);
+        static bool SaveReport(const Path& reportPath, const AssetCookReport& report);
+
+    private:
+        AssetCookRecord CookTexture(const AssetCookItem& item);
+        AssetCookRecord CookStaticMesh(const AssetCookItem& item);
+        AssetCookRecord CookMaterial(const AssetCookItem& item);
+        AssetCookRecord CookAudioClip(const AssetCookItem& item);
+
+        Guid CreateMaterial(const std::string_view virtualPath, const MaterialAssetCreateDesc& createDesc);
+
+        /* 같은 Virtual Path 의 에셋이 이미 존재 한다면, 기존 Guid 를 유지한 채로 결과물을 교체 한다. 실패 시 유효하지 않은 Guid 반환. */
+        template <typename T>
+        Guid Register(const typename T::Desc& desc);
+
+    private:
+        /* 쿠킹 작업과 임포터 내부 작업이 서로를 기다리며 교착 되지 않도록 Executor 를 분리 */
+        tf::Executor cookExecutor;
+        tf::Executor importExecutor;
+
+        Ptr<details::AssetMonitor> assetMonitor;
+        Mutex registerMutex;
+
+        Ptr<TextureImporter> textureImporter;
+        Ptr<StaticMeshImporter> staticMeshImporter;
+        Ptr<AudioClipImporter> audioClipImporter;
+    };
+} // namespace ig
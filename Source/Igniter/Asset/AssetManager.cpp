@@ -1,38 +1,72 @@
 #include "Igniter/Igniter.h"
+#include "Igniter/Core/Memory.h"
+#include "Igniter/Core/Engine.h"
 #include "Igniter/Asset/TextureImporter.h"
 #include "Igniter/Asset/StaticMeshImporter.h"
+#include "Igniter/Asset/SkeletalMeshImporter.h"
 #include "Igniter/Asset/MaterialImporter.h"
 #include "Igniter/Asset/MapCreator.h"
 #include "Igniter/Asset/AudioClipImporter.h"
+#include "Igniter/Asset/AnimationClipImporter.h"
+#include "Igniter/Asset/AssetPackage.h"
+#include "Igniter/Filesystem/FileWatcher.h"
 #include "Igniter/Asset/AssetManager.h"
+#include "Igniter/Gameplay/World.h"
+#include "Igniter/Component/NameComponent.h"
+#include "Igniter/Component/TransformComponent.h"
+#include "Igniter/Component/StaticMeshComponent.h"
+#include "Igniter/Component/MaterialComponent.h"
 
 IG_DEFINE_LOG_CATEGORY(AssetManagerLog);
 
 namespace ig
 {
     AssetManager::AssetManager(RenderContext& renderContext, AudioSystem& audioSystem)
-        : textureImporter(MakePtr<TextureImporter>())
-        , textureLoader(MakePtr<TextureLoader>(renderContext))
+        : textureImporter(MakePtr<TextureImporter>(Engine::GetTaskExecutor()))
+        , textureLoader(MakePtr<TextureLoader>(renderContext, *this))
         , staticMeshImporter(MakePtr<StaticMeshImporter>(*this))
         , staticMeshLoader(MakePtr<StaticMeshLoader>(renderContext, *this))
+        , skeletalMeshImporter(MakePtr<SkeletalMeshImporter>(Engine::GetTaskExecutor()))
+        , skeletalMeshLoader(MakePtr<SkeletalMeshLoader>(renderContext, *this))
         , materialImporter(MakePtr<MaterialImporter>(*this))
         , materialLoader(MakePtr<MaterialLoader>(*this))
+        , mapCreator(MakePtr<MapCreator>())
+        , mapLoader(MakePtr<MapLoader>(*this))
         , audioImporter(MakePtr<AudioClipImporter>())
-        , audioLoader(MakePtr<AudioClipLoader>(audioSystem))
+        , audioLoader(MakePtr<AudioClipLoader>(audioSystem, *this))
+        , animationImporter(MakePtr<AnimationClipImporter>(Engine::GetTaskExecutor()))
+        , animationLoader(MakePtr<AnimationClipLoader>(*this))
+        , package(MakePtr<AssetPackage>())
+        , taskExecutor(Engine::GetTaskExecutor())
     {
         RestoreTempAssets();
         assetMonitor = MakePtr<details::AssetMonitor>();
 
-        assetCaches.emplace_back(MakePtr<details::AssetCache<Texture>>());
-        assetCaches.emplace_back(MakePtr<details::AssetCache<StaticMesh>>());
-        assetCaches.emplace_back(MakePtr<details::AssetCache<Material>>());
-        assetCaches.emplace_back(MakePtr<details::AssetCache<Map>>());
-        assetCaches.emplace_back(MakePtr<details::AssetCache<AudioClip>>());
+        assetCaches.emplace_back(MakePtr<details::AssetCache<Texture>>(MegaBytesToBytes(256)));
+        assetCaches.emplace_back(MakePtr<details::AssetCache<StaticMesh>>(MegaBytesToBytes(128)));
+        assetCaches.emplace_back(MakePtr<details::AssetCache<SkeletalMesh>>(MegaBytesToBytes(64)));
+        assetCaches.emplace_back(MakePtr<details::AssetCache<Material>>(MegaBytesToBytes(1)));
+        assetCaches.emplace_back(MakePtr<details::AssetCache<Map>>(MegaBytesToBytes(4)));
+        assetCaches.emplace_back(MakePtr<details::AssetCache<AudioClip>>(MegaBytesToBytes(64)));
+        assetCaches.emplace_back(MakePtr<details::AssetCache<AnimationClip>>(MegaBytesToBytes(32)));
         RegisterEngineDefault();
+
+        assetFileWatcher = MakePtr<FileWatcher>(Path{details::AssetRootPath});
     }
 
     AssetManager::~AssetManager()
     {
+        /* 진행 중인 리로드는 완료 될 때 까지 기다린 후, 반영 하지 않고 버린다. */
+        {
+            UniqueLock lock{pendingReloadMutex};
+            pendingReloads.clear();
+        }
+
+        /* Keep-Alive 중인 에셋이 다른 에셋을 참조 할 수 있으므로(ex. StaticMesh => Material), 더 이상 해제 될 에셋이 없을 때 까지 반복 */
+        while (TrimKeepAlive() > 0)
+        {
+        }
+
         UnRegisterEngineDefault();
         for (const auto& snapshot : TakeSnapshots())
         {
@@ -130,6 +164,55 @@ namespace ig
         return *guidOpt;
     }
 
+    Vector<Guid> AssetManager::Import(const std::span<const std::string> resPaths, const TexturePackImportDesc& desc, const bool bShouldSuppressDirty)
+    {
+        TexturePackImportResult packResult = textureImporter->ImportPack(resPaths, desc);
+        Vector<Guid> packedTextureGuids(packResult.PackedTextures.size());
+        for (Index pageIdx = 0; pageIdx < packResult.PackedTextures.size(); ++pageIdx)
+        {
+            if (const std::optional<Guid> guidOpt{ImportImpl<Texture>(desc.PackName, packResult.PackedTextures[pageIdx], bShouldSuppressDirty)};
+                guidOpt)
+            {
+                packedTextureGuids[pageIdx] = *guidOpt;
+            }
+        }
+
+        Vector<Guid> output(packResult.SubTextures.size());
+        for (Index sourceIdx = 0; sourceIdx < packResult.SubTextures.size(); ++sourceIdx)
+        {
+            SubTextureImportEntry& subTexture = packResult.SubTextures[sourceIdx];
+            /* 패킹 될 수 없는 소스는 일반 텍스처로 임포트 한다. */
+            if (subTexture.PackedTextureIdx == InvalidIndex)
+            {
+                output[sourceIdx] = Import(subTexture.ResPath,
+                    TextureImportDesc{
+                        .CompressionMode = desc.CompressionMode,
+                        .CompressionQuality = desc.CompressionQuality,
+                        .bGenerateMips = desc.bGenerateMips,
+                        .Filter = desc.Filter,
+                        .AddressModeU = desc.AddressModeU,
+                        .AddressModeV = desc.AddressModeV},
+                    bShouldSuppressDirty);
+                continue;
+            }
+
+            const Guid& packedTextureGuid = packedTextureGuids[subTexture.PackedTextureIdx];
+            if (!packedTextureGuid.isValid())
+            {
+                continue;
+            }
+
+            subTexture.LoadDesc.PackedTextureGuid = packedTextureGuid;
+            Result<Texture::Desc, ETextureImportStatus> result = TextureImporter::ExportSubTexture(subTexture.ResPath, subTexture.LoadDesc);
+            if (const std::optional<Guid> guidOpt{ImportImpl<Texture>(subTexture.ResPath, result, bShouldSuppressDirty)}; guidOpt)
+            {
+                output[sourceIdx] = *guidOpt;
+            }
+        }
+
+        return output;
+    }
+
     Handle<Texture> AssetManager::LoadTexture(const Guid& guid, const bool bShouldSuppressDirty)
     {
         Handle<Texture> cachedTex{LoadImpl<Texture>(guid, *textureLoader, bShouldSuppressDirty)};
@@ -160,21 +243,66 @@ namespace ig
 
     Vector<Guid> AssetManager::Import(const std::string_view resPath, const StaticMeshImportDesc& desc, const bool bShouldSuppressDirty)
     {
-        Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> results = staticMeshImporter->Import(resPath, desc);
+        Vector<StaticMeshSceneInstance> sceneInstances{};
+        Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> results = staticMeshImporter->Import(resPath, desc, &sceneInstances);
         Vector<Guid> output;
         output.reserve(results.size());
-        for (Result<StaticMesh::Desc, EStaticMeshImportStatus>& result : results)
+        /* 씬 인스턴스가 결과의 인덱스로 메시를 참조하므로, 실패한 결과도 자리를 유지 한다. */
+        Vector<Guid> resultGuids(results.size());
+        for (Index resultIdx = 0; resultIdx < results.size(); ++resultIdx)
         {
-            std::optional<Guid> guidOpt{ImportImpl<StaticMesh>(resPath, result, bShouldSuppressDirty)};
+            std::optional<Guid> guidOpt{ImportImpl<StaticMesh>(resPath, results[resultIdx], bShouldSuppressDirty)};
             if (guidOpt)
             {
                 output.emplace_back(*guidOpt);
+                resultGuids[resultIdx] = *guidOpt;
             }
         }
 
+        if (desc.bImportAsScene)
+        {
+            CreateSceneMap(resPath, sceneInstances, resultGuids, bShouldSuppressDirty);
+        }
+
         return output;
     }
 
+    Guid AssetManager::CreateSceneMap(const std::string_view resPath, const std::span<const StaticMeshSceneInstance> sceneInstances,
+        const std::span<const Guid> meshGuids, const bool bShouldSuppressDirty)
+    {
+        /* 메시와 머터리얼을 로드 하지 않고, Guid 만으로 직렬화 된 World 를 구성 한다. */
+        MapCreateDesc mapCreateDesc{};
+        U32 numEntities = 0;
+        for (const StaticMeshSceneInstance& instance : sceneInstances)
+        {
+            IG_CHECK(instance.MeshResultIdx < meshGuids.size());
+            const Guid& meshGuid = meshGuids[instance.MeshResultIdx];
+            if (!meshGuid.isValid())
+            {
+                continue;
+            }
+
+            Guid materialGuid{DefaultMaterialGuid};
+            if (IsValidVirtualPath(instance.MaterialVirtualPath) && assetMonitor->Contains(EAssetCategory::Material, instance.MaterialVirtualPath))
+            {
+                materialGuid = assetMonitor->GetGuid(EAssetCategory::Material, instance.MaterialVirtualPath);
+            }
+
+            const U32 entityId = numEntities++;
+            Json& serializedWorld = mapCreateDesc.SerializedWorld;
+            Serialize<Json, NameComponent>(World::AddSerializedComponent(serializedWorld, entityId, TypeHash<NameComponent>), NameComponent{.Name = instance.Name});
+            Serialize<Json, TransformComponent>(World::AddSerializedComponent(serializedWorld, entityId, TypeHash<TransformComponent>),
+                TransformComponent{.Position = instance.Position, .Scale = instance.Scale, .Rotation = instance.Rotation});
+            SerializeStaticMeshComponent(World::AddSerializedComponent(serializedWorld, entityId, TypeHash<StaticMeshComponent>), meshGuid);
+            SerializeMaterialComponent(World::AddSerializedComponent(serializedWorld, entityId, TypeHash<MaterialComponent>), materialGuid);
+        }
+
+        const std::string mapVirtualPath{MakeVirtualPathPreferred(Path{resPath}.filename().replace_extension().string())};
+        const Guid mapGuid{Create(mapVirtualPath, mapCreateDesc, bShouldSuppressDirty)};
+        IG_LOG(AssetManagerLog, Info, "Scene map \"{}\" created with {} entities from \"{}\".", mapVirtualPath, numEntities, resPath);
+        return mapGuid;
+    }
+
     Handle<StaticMesh> AssetManager::LoadStaticMesh(const Guid& guid, const bool bShouldSuppressDirty)
     {
         return LoadImpl<StaticMesh>(guid, *staticMeshLoader, bShouldSuppressDirty);
@@ -197,6 +325,44 @@ namespace ig
         return LoadImpl<StaticMesh>(assetMonitor->GetGuid(EAssetCategory::StaticMesh, virtualPath), *staticMeshLoader, bShouldSuppressDirty);
     }
 
+    Vector<Guid> AssetManager::Import(const std::string_view resPath, const SkeletalMeshImportDesc& desc, const bool bShouldSuppressDirty)
+    {
+        Vector<Result<SkeletalMesh::Desc, ESkeletalMeshImportStatus>> results = skeletalMeshImporter->Import(resPath, desc);
+        Vector<Guid> output;
+        output.reserve(results.size());
+        for (Result<SkeletalMesh::Desc, ESkeletalMeshImportStatus>& result : results)
+        {
+            if (std::optional<Guid> guidOpt{ImportImpl<SkeletalMesh>(resPath, result, bShouldSuppressDirty)}; guidOpt)
+            {
+                output.emplace_back(*guidOpt);
+            }
+        }
+
+        return output;
+    }
+
+    Handle<SkeletalMesh> AssetManager::LoadSkeletalMesh(const Guid& guid, const bool bShouldSuppressDirty)
+    {
+        return LoadImpl<SkeletalMesh>(guid, *skeletalMeshLoader, bShouldSuppressDirty);
+    }
+
+    Handle<SkeletalMesh> AssetManager::LoadSkeletalMesh(const std::string_view virtualPath, const bool bShouldSuppressDirty)
+    {
+        if (!IsValidVirtualPath(virtualPath))
+        {
+            IG_LOG(AssetManagerLog, Error, "Load Skeletal Mesh: Invalid Virtual Path {}", virtualPath);
+            return Handle<SkeletalMesh>{};
+        }
+
+        if (!assetMonitor->Contains(EAssetCategory::SkeletalMesh, virtualPath))
+        {
+            IG_LOG(AssetManagerLog, Error, "Skeletal mesh \"{}\" is invisible to asset manager.", virtualPath);
+            return Handle<SkeletalMesh>{};
+        }
+
+        return LoadImpl<SkeletalMesh>(assetMonitor->GetGuid(EAssetCategory::SkeletalMesh, virtualPath), *skeletalMeshLoader, bShouldSuppressDirty);
+    }
+
     Guid AssetManager::Create(const std::string_view virtualPath, const MaterialAssetCreateDesc& createDesc, const bool bShouldSuppressDirty)
     {
         if (!IsValidVirtualPath(virtualPath))
@@ -301,6 +467,44 @@ namespace ig
         return *guidOpt;
     }
     
+    Vector<Guid> AssetManager::Import(const std::span<const std::string> resPaths, const SoundBankImportDesc& desc, const bool bShouldSuppressDirty)
+    {
+        SoundBankImportResult bankResult{audioImporter->ImportSoundBank(resPaths, desc)};
+        const std::optional<Guid> soundBankGuidOpt{ImportImpl<AudioClip>(desc.BankName, bankResult.SoundBank, bShouldSuppressDirty)};
+
+        Vector<Guid> output(bankResult.Clips.size());
+        for (Index clipIdx = 0; clipIdx < bankResult.Clips.size(); ++clipIdx)
+        {
+            SoundBankClipImportEntry& clip = bankResult.Clips[clipIdx];
+            /* 뱅크에 포함 될 수 없는 클립은 일반 클립으로 임포트 한다. */
+            if (!clip.bIsInSoundBank)
+            {
+                output[clipIdx] = Import(clip.ResPath,
+                    AudioClipImportDesc{
+                        .Path = clip.ResPath,
+                        .Encoding = desc.Encoding,
+                        .LoadMode = desc.LoadMode,
+                        .StreamingThresholdSeconds = desc.StreamingThresholdSeconds},
+                    bShouldSuppressDirty);
+                continue;
+            }
+
+            if (!soundBankGuidOpt)
+            {
+                continue;
+            }
+
+            clip.LoadDesc.SoundBankGuid = *soundBankGuidOpt;
+            Result<AudioClip::Desc, EAudioClipImportError> result{AudioClipImporter::ExportSoundBankClip(clip.ResPath, clip.LoadDesc)};
+            if (const std::optional<Guid> guidOpt{ImportImpl<AudioClip>(clip.ResPath, result, bShouldSuppressDirty)}; guidOpt)
+            {
+                output[clipIdx] = *guidOpt;
+            }
+        }
+
+        return output;
+    }
+
     Handle<AudioClip> AssetManager::LoadAudioClip(const Guid& guid, const bool bShouldSuppressDirty)
     {
         const Handle<AudioClip> cachedAudioClipHandle{LoadImpl<AudioClip>(guid, *audioLoader, bShouldSuppressDirty)};
@@ -329,6 +533,44 @@ namespace ig
         return LoadAudioClip(assetMonitor->GetGuid(EAssetCategory::Audio, virtualPath), bShouldSuppressDirty);
     }
 
+    Vector<Guid> AssetManager::Import(const std::string_view resPath, const AnimationClipImportDesc& desc, const bool bShouldSuppressDirty)
+    {
+        Vector<Result<AnimationClip::Desc, EAnimationClipImportStatus>> results = animationImporter->Import(resPath, desc);
+        Vector<Guid> output;
+        output.reserve(results.size());
+        for (Result<AnimationClip::Desc, EAnimationClipImportStatus>& result : results)
+        {
+            if (std::optional<Guid> guidOpt{ImportImpl<AnimationClip>(resPath, result, bShouldSuppressDirty)}; guidOpt)
+            {
+                output.emplace_back(*guidOpt);
+            }
+        }
+
+        return output;
+    }
+
+    Handle<AnimationClip> AssetManager::LoadAnimationClip(const Guid& guid, const bool bShouldSuppressDirty)
+    {
+        return LoadImpl<AnimationClip>(guid, *animationLoader, bShouldSuppressDirty);
+    }
+
+    Handle<AnimationClip> AssetManager::LoadAnimationClip(const std::string_view virtualPath, const bool bShouldSuppressDirty)
+    {
+        if (!IsValidVirtualPath(virtualPath))
+        {
+            IG_LOG(AssetManagerLog, Error, "Load Animation Clip: Invalid Virtual Path {}", virtualPath);
+            return {};
+        }
+
+        if (!assetMonitor->Contains(EAssetCategory::Animation, virtualPath))
+        {
+            IG_LOG(AssetManagerLog, Error, "Animation Clip \"{}\" is invisible to asset manager.", virtualPath);
+            return {};
+        }
+
+        return LoadAnimationClip(assetMonitor->GetGuid(EAssetCategory::Animation, virtualPath), bShouldSuppressDirty);
+    }
+
     void AssetManager::Delete(const Guid& guid, const bool bShouldSuppressDirty)
     {
         if (!assetMonitor->Contains(guid))
@@ -395,6 +637,115 @@ namespace ig
         ClearTempAssets();
     }
 
+    bool AssetManager::MountPackage(const Path& packagePath)
+    {
+        if (!UnmountPackage())
+        {
+            return false;
+        }
+
+        ReadWriteLock rwLock{packageMutex};
+        if (!package->Mount(packagePath))
+        {
+            return false;
+        }
+
+        assetMonitor->MountPackedAssets(*package);
+        bIsDirty = true;
+        return true;
+    }
+
+    bool AssetManager::UnmountPackage()
+    {
+        ReadWriteLock rwLock{packageMutex};
+        if (!package->IsMounted())
+        {
+            return true;
+        }
+
+        /*
+         * 패키지에만 존재하는 에셋은 언마운트 이후 다시 로드 할 수 없으므로, 캐시에 남아 있어선 안된다.
+         * Keep-Alive 중인 에셋은 먼저 해제 한다. Keep-Alive 중인 에셋(ex. Material)이 참조 하던 다른 패키지 에셋이
+         * 해제 과정 에서 Keep-Alive 상태가 될 수 있으므로, 더 이상 해제 할 에셋이 없을 때 까지 반복 한다.
+         */
+        const std::span<const AssetPackage::TocEntry> tableOfContents{package->GetTableOfContents()};
+        bool bHasInvalidated = true;
+        while (bHasInvalidated)
+        {
+            bHasInvalidated = false;
+            for (const AssetPackage::TocEntry& entry : tableOfContents)
+            {
+                const Guid guid{entry.Guid};
+                if (!assetMonitor->IsPackedOnly(guid))
+                {
+                    continue;
+                }
+
+                details::TypelessAssetCache& cache{GetTypelessCache(entry.Category)};
+                if (cache.TakeSnapshot(guid).bIsKeptAlive)
+                {
+                    cache.Invalidate(guid);
+                    bHasInvalidated = true;
+                }
+            }
+        }
+
+        Size numReferencedAssets = 0;
+        for (const AssetPackage::TocEntry& entry : tableOfContents)
+        {
+            const Guid guid{entry.Guid};
+            if (assetMonitor->IsPackedOnly(guid) && GetTypelessCache(entry.Category).IsCached(guid))
+            {
+                IG_LOG(AssetManagerLog, Error, "Packed asset {} is still referenced.", guid);
+                ++numReferencedAssets;
+            }
+        }
+
+        if (numReferencedAssets > 0)
+        {
+            IG_LOG(AssetManagerLog, Error, "Failed to unmount package {}. {} packed assets are still referenced.",
+                package->GetPath().string(), numReferencedAssets);
+            return false;
+        }
+
+        assetMonitor->UnmountPackedAssets();
+        package->Unmount();
+        bIsDirty = true;
+        return true;
+    }
+
+    bool AssetManager::IsPackageMounted() const
+    {
+        ReadOnlyLock lock{packageMutex};
+        return package->IsMounted();
+    }
+
+    std::span<const U8> AssetManager::FindPackedAsset(const Guid& guid) const
+    {
+        ReadOnlyLock lock{packageMutex};
+        return package->IsMounted() ? assetMonitor->FindPackedAssetData(*package, guid) : std::span<const U8>{};
+    }
+
+    bool AssetManager::BuildPackage(const Path& packagePath)
+    {
+        /* 매핑 된 파일은 덮어 쓸 수 없으므로, 같은 경로의 패키지가 마운트 되어 있다면 먼저 언마운트 해야 한다. */
+        std::error_code errorCode{};
+        if (IsPackageMounted() && fs::equivalent(package->GetPath(), packagePath, errorCode))
+        {
+            IG_LOG(AssetManagerLog, Error, "Failed to build package {}. The package is currently mounted.", packagePath.string());
+            return false;
+        }
+
+        Result<AssetPackage::BuildReport, EAssetPackageBuildStatus> result{AssetPackage::Build(packagePath)};
+        if (!result.HasOwnership())
+        {
+            IG_LOG(AssetManagerLog, Error, "Failed({}) to build package {}.", result.GetStatus(), packagePath.string());
+            return false;
+        }
+
+        return true;
+    }
+
     std::optional<AssetInfo> AssetManager::GetAssetInfo(const Guid& guid) const
     {
         if (!assetMonitor->Contains(guid))
@@ -433,7 +784,8 @@ namespace ig
                     const Snapshot snapshot{
                         assetInfo,
                         cacheSnapshot.RefCount,
-                        cacheSnapshot.HandleHash
+                        cacheSnapshot.HandleHash,
+                        cacheSnapshot.bIsKeptAlive
                     };
 
                     if (!bOnlyTakeCached || snapshot.IsCached())
@@ -454,7 +806,8 @@ namespace ig
                         const details::TypelessAssetCache::Snapshot cacheSnapshot = assetCache->TakeSnapshot(assetInfo.GetGuid());
                         snapshots.emplace_back(assetInfo,
                             cacheSnapshot.RefCount,
-                            cacheSnapshot.HandleHash);
+                            cacheSnapshot.HandleHash,
+                            cacheSnapshot.bIsKeptAlive);
                         break;
                     }
                 }
@@ -464,6 +817,89 @@ namespace ig
         return snapshots;
     }
 
+    void AssetManager::CommitReloads()
+    {
+        ZoneScoped;
+        ReloadModifiedAssets();
+
+        Vector<Ptr<details::TypelessAssetReload>> completedReloads{};
+        {
+            UniqueLock lock{pendingReloadMutex};
+            for (auto itr = pendingReloads.begin(); itr != pendingReloads.end();)
+            {
+                if (!(*itr)->IsReady())
+                {
+                    ++itr;
+                    continue;
+                }
+
+                completedReloads.emplace_back(std::move(*itr));
+                itr = pendingReloads.erase(itr);
+            }
+        }
+
+        /* 이전 인스턴스의 해제(ex. StaticMesh => Material Unload)가 다시 에셋 매니저를 거칠 수 있으므로, 잠금 밖에서 반영 한다. */
+        for (Ptr<details::TypelessAssetReload>& completedReload : completedReloads)
+        {
+            if (completedReload->IsSuperseded())
+            {
+                continue;
+            }
+
+            if (!completedReload->Publish(GetTypelessCache(completedReload->GetAssetType())))
+            {
+                continue;
+            }
+
+            IG_LOG(AssetManagerLog, Info, "{} asset {} reloaded.", completedReload->GetAssetType(), completedReload->GetGuid());
+            if (!completedReload->ShouldSuppressDirty())
+            {
+                bIsDirty = true;
+            }
+        }
+    }
+
+    void AssetManager::ReloadModifiedAssets()
+    {
+        const Vector<FileChange> changes{assetFileWatcher->Poll()};
+        if (changes.empty())
+        {
+            return;
+        }
+
+        /* 캐시 되어 있지 않은 에셋은 다음 로드 시 변경 된 파일로 부터 로드 되므로, 리로드 요청이 무시 된다. */
+        for (const AssetInfo& assetInfo : assetMonitor->ResolveModifiedAssets(changes))
+        {
+            const Guid& guid{assetInfo.GetGuid()};
+            switch (assetInfo.GetCategory())
+            {
+            case EAssetCategory::Texture:
+                Reload<Texture>(guid);
+                break;
+            case EAssetCategory::StaticMesh:
+                Reload<StaticMesh>(guid);
+                break;
+            case EAssetCategory::SkeletalMesh:
+                Reload<SkeletalMesh>(guid);
+                break;
+            case EAssetCategory::Material:
+                Reload<Material>(guid);
+                break;
+            case EAssetCategory::Map:
+                Reload<Map>(guid);
+                break;
+            case EAssetCategory::Audio:
+                Reload<AudioClip>(guid);
+                break;
+            case EAssetCategory::Animation:
+                Reload<AnimationClip>(guid);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
     void AssetManager::DispatchEvent()
     {
         if (bIsDirty.exchange(false))
@@ -472,6 +908,45 @@ namespace ig
         }
     }
 
+    AssetManager::CacheStatistics AssetManager::GetCacheStatistics(const EAssetCategory assetCategory) const
+    {
+        return GetTypelessCache(assetCategory).GetStatistics();
+    }
+
+    void AssetManager::ResetCacheStatistics()
+    {
+        for (Ptr<details::TypelessAssetCache>& assetCache : assetCaches)
+        {
+            assetCache->ResetStatistics();
+        }
+    }
+
+    void AssetManager::SetKeepAliveBudget(const EAssetCategory assetCategory, const Bytes newBudget)
+    {
+        GetTypelessCache(assetCategory).SetKeepAliveBudget(newBudget);
+        bIsDirty = true;
+    }
+
+    Size AssetManager::TrimKeepAlive(const EAssetCategory assetCategory, const Bytes targetBytes)
+    {
+        Size numEvicted = 0;
+        for (Ptr<details::TypelessAssetCache>& assetCache : assetCaches)
+        {
+            if (assetCategory == EAssetCategory::Unknown || assetCache->GetAssetType() == assetCategory)
+            {
+                numEvicted += assetCache->TrimKeepAlive(targetBytes);
+            }
+        }
+
+        if (numEvicted > 0)
+        {
+            IG_LOG(AssetManagerLog, Info, "{} kept alive assets trimmed.", numEvicted);
+            bIsDirty = true;
+        }
+
+        return numEvicted;
+    }
+
     void AssetManager::ClearTempAssets()
     {
         for (auto category : magic_enum::enum_values<EAssetCategory>())
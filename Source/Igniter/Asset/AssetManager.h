@@ -2,6 +2,7 @@
 #include "Igniter/Core/Result.h"
 #include "Igniter/Core/Log.h"
 #include "Igniter/Core/Event.h"
+#include "Igniter/Core/Timer.h"
 #include "Igniter/Asset/Common.h"
 #include "Igniter/Asset/AssetMonitor.h"
 #include "Igniter/Asset/AssetCache.h"
@@ -9,12 +10,16 @@
 #include "Igniter/Asset/TextureLoader.h"
 #include "Igniter/Asset/StaticMesh.h"
 #include "Igniter/Asset/StaticMeshLoader.h"
+#include "Igniter/Asset/SkeletalMesh.h"
+#include "Igniter/Asset/SkeletalMeshLoader.h"
 #include "Igniter/Asset/Material.h"
 #include "Igniter/Asset/MaterialLoader.h"
 #include "Igniter/Asset/Map.h"
 #include "Igniter/Asset/MapLoader.h"
 #include "Igniter/Asset/AudioClip.h"
 #include "Igniter/Asset/AudioClipLoader.h"
+#include "Igniter/Asset/AnimationClip.h"
+#include "Igniter/Asset/AnimationClipLoader.h"
 
 IG_DECLARE_LOG_CATEGORY(AssetManagerLog);
 
@@ -24,6 +29,96 @@ namespace ig::details
     {
         Success,
     };
+
+    /*
+     * #sy_note 백그라운드 리로드
+     * 워커 스레드에서 로더를 통해 섀도우 인스턴스를 만들어 두고, 프레임 경계(AssetManager::CommitReloads)에서 캐시의 인스턴스와 교체 한다.
+     * 교체 후 섀도우에 남은 이전 인스턴스는 리로드 객체와 함께 소멸 되며, GPU 자원은 RenderContext 의 지연 해제 목록을 통해 해제 된다.
+     */
+    class TypelessAssetReload
+    {
+    public:
+        TypelessAssetReload(const Guid& guid, const bool bShouldSuppressDirty)
+            : guid(guid)
+            , bShouldSuppressDirty(bShouldSuppressDirty)
+        {}
+
+        TypelessAssetReload(const TypelessAssetReload&) = delete;
+        TypelessAssetReload(TypelessAssetReload&&) noexcept = delete;
+        virtual ~TypelessAssetReload() = default;
+
+        TypelessAssetReload& operator=(const TypelessAssetReload&) = delete;
+        TypelessAssetReload& operator=(TypelessAssetReload&&) noexcept = delete;
+
+        [[nodiscard]] virtual EAssetCategory GetAssetType() const = 0;
+        [[nodiscard]] virtual bool IsReady() const = 0;
+        /* 로드 된 섀도우 인스턴스를 캐시에 반영 한다. 로드에 실패 했거나, 그 사이 캐시에서 해제(또는 해제 후 다시 캐시) 되었다면 false. */
+        virtual bool Publish(TypelessAssetCache& assetCache) = 0;
+
+        [[nodiscard]] const Guid& GetGuid() const noexcept { return guid; }
+        [[nodiscard]] bool ShouldSuppressDirty() const noexcept { return bShouldSuppressDirty; }
+        [[nodiscard]] bool IsSuperseded() const noexcept { return bIsSuperseded; }
+        /* 같은 에셋에 대한 이후의 리로드가 요청 된 경우, 이전 리로드의 결과는 반영하지 않고 버린다. */
+        void Supersede() noexcept { bIsSuperseded = true; }
+
+    private:
+        Guid guid{};
+        bool bShouldSuppressDirty = false;
+        bool bIsSuperseded = false;
+    };
+
+    template <typename T, typename LoadResult>
+    class AssetReload final : public TypelessAssetReload
+    {
+    public:
+        /* cachedHandle: 리로드가 요청 된 시점의 캐시 된 에셋 핸들 */
+        AssetReload(const Guid& guid, const Handle<T> cachedHandle, const bool bShouldSuppressDirty, std::future<LoadResult> loadResult)
+            : TypelessAssetReload(guid, bShouldSuppressDirty)
+            , cachedHandle(cachedHandle)
+            , loadResult(std::move(loadResult))
+        {}
+
+        /* 반영 되지 않은(실패, 대체, 종료) 리로드의 결과도 소유권을 가져와 해제 한다. 로드가 끝나지 않았다면 완료 될 때 까지 대기 한다. */
+        ~AssetReload() override
+        {
+            if (loadResult.valid())
+            {
+                LoadResult result{loadResult.get()};
+                if (result.HasOwnership())
+                {
+                    [[maybe_unused]] T discarded{result.Take()};
+                }
+            }
+        }
+
+        [[nodiscard]] EAssetCategory GetAssetType() const override { return AssetCategoryOf<T>; }
+        [[nodiscard]] bool IsReady() const override { return loadResult.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+
+        bool Publish(TypelessAssetCache& assetCache) override
+        {
+            IG_CHECK(assetCache.GetAssetType() == AssetCategoryOf<T>);
+            LoadResult result{loadResult.get()};
+            if (!result.HasOwnership())
+            {
+                IG_LOG(AssetManagerLog, Error, "{} asset \"{}\" failed({}) to reload.", AssetCategoryOf<T>, GetGuid(), result.GetStatus());
+                return false;
+            }
+
+            /* 교체 후 shadow 는 이전 인스턴스를 가지며, 스코프를 벗어나며 해제 된다. */
+            T shadow{result.Take()};
+            if (!static_cast<AssetCache<T>&>(assetCache).Swap(GetGuid(), cachedHandle, shadow))
+            {
+                IG_LOG(AssetManagerLog, Warning, "{} asset \"{}\" was unloaded or recached during reload. Reloaded instance discarded.", AssetCategoryOf<T>, GetGuid());
+                return false;
+            }
+
+            return true;
+        }
+
+    private:
+        Handle<T> cachedHandle;
+        std::future<LoadResult> loadResult;
+    };
 }
 
 namespace ig
@@ -33,13 +128,20 @@ namespace ig
     class TextureImporter;
     class TextureLoader;
     class StaticMeshImporter;
+    struct StaticMeshSceneInstance;
     class StaticMeshLoader;
+    class SkeletalMeshImporter;
+    class SkeletalMeshLoader;
     class MaterialImporter;
     class MaterialLoader;
     class MapCreator;
     class MapLoader;
     class AudioClipImporter;
     class AudioClipLoader;
+    class AnimationClipImporter;
+    class AnimationClipLoader;
+    class AssetPackage;
+    class FileWatcher;
 
     // #sy_todo bIsSuppress 같은걸 flag로 관리 하기
     // ex. EAssetManagerOptionFlag, SuppressLog, SuppressDirty etc..
@@ -62,8 +164,11 @@ namespace ig
             AssetInfo Info{};
             U32 RefCount{};
             Size HandleHash{IG_NUMERIC_MAX_OF(HandleHash)};
+            bool bIsKeptAlive{false};
         };
 
+        using CacheStatistics = details::TypelessAssetCache::Statistics;
+
     public:
         explicit AssetManager(RenderContext& renderContext, AudioSystem& audioSystem);
         AssetManager(const AssetManager&) = delete;
@@ -80,6 +185,8 @@ namespace ig
          */
 
         Guid Import(const std::string_view resPath, const TextureImportDesc& desc, const bool bShouldSuppressDirty = false);
+        /* 작은 텍스처 들을 텍스처 배열/아틀라스로 묶어 임포트 한다. resPaths 의 순서 대로 각 소스의 (서브)텍스처 Guid 를 반환. */
+        Vector<Guid> Import(const std::span<const std::string> resPaths, const TexturePackImportDesc& desc, const bool bShouldSuppressDirty = false);
         [[nodiscard]] Handle<Texture> LoadTexture(const Guid& guid, const bool bShouldSuppressDirty = false);
         [[nodiscard]] Handle<Texture> LoadTexture(const std::string_view virtualPath, const bool bShouldSuppressDirty = false);
 
@@ -87,6 +194,11 @@ namespace ig
         [[nodiscard]] Handle<StaticMesh> LoadStaticMesh(const Guid& guid, const bool bShouldSuppressDirty = false);
         [[nodiscard]] Handle<StaticMesh> LoadStaticMesh(const std::string_view virtualPath, const bool bShouldSuppressDirty = false);
 
+        /* Bone 을 가진 메시 마다 하나의 스켈레탈 메시 에셋을 임포트 한다. */
+        Vector<Guid> Import(const std::string_view resPath, const SkeletalMeshImportDesc& desc, const bool bShouldSuppressDirty = false);
+        [[nodiscard]] Handle<SkeletalMesh> LoadSkeletalMesh(const Guid& guid, const bool bShouldSuppressDirty = false);
+        [[nodiscard]] Handle<SkeletalMesh> LoadSkeletalMesh(const std::string_view virtualPath, const bool bShouldSuppressDirty = false);
+
         Guid Create(const std::string_view virtualPath, const MaterialAssetCreateDesc& createDesc, const bool bShouldSuppressDirty = false);
         [[nodiscard]] Handle<Material> LoadMaterial(const Guid& guid, const bool bShouldSuppressDirty = false);
         [[nodiscard]] Handle<Material> LoadMaterial(const std::string_view virtualPath, const bool bShouldSuppressDirty = false);
@@ -96,9 +208,16 @@ namespace ig
         [[nodiscard]] Handle<Map> LoadMap(const std::string_view virtualPath, const bool bShouldSuppressDirty = false);
 
         Guid Import(const std::string_view resPath, const AudioClipImportDesc& desc, const bool bShouldSuppressDirty = false);
+        /* 오디오 클립 들을 하나의 사운드 뱅크로 묶어 임포트 한다. resPaths 의 순서 대로 각 클립의 Guid 를 반환. */
+        Vector<Guid> Import(const std::span<const std::string> resPaths, const SoundBankImportDesc& desc, const bool bShouldSuppressDirty = false);
         [[nodiscard]] Handle<AudioClip> LoadAudioClip(const Guid& guid, const bool bShouldSuppressDirty = false);
         [[nodiscard]] Handle<AudioClip> LoadAudioClip(const std::string_view virtualPath, const bool bShouldSuppressDirty = false);
 
+        /* 파일에 포함 된 애니메이션 마다 하나의 클립 에셋을 임포트 한다. */
+        Vector<Guid> Import(const std::string_view resPath, const AnimationClipImportDesc& desc, const bool bShouldSuppressDirty = false);
+        [[nodiscard]] Handle<AnimationClip> LoadAnimationClip(const Guid& guid, const bool bShouldSuppressDirty = false);
+        [[nodiscard]] Handle<AnimationClip> LoadAnimationClip(const std::string_view virtualPath, const bool bShouldSuppressDirty = false);
+
         template <typename T>
         [[nodiscard]] Handle<T> Load(const Guid& guid, const bool bShouldSuppressDirty = false)
         {
@@ -110,6 +229,10 @@ namespace ig
             {
                 return LoadStaticMesh(guid, bShouldSuppressDirty);
             }
+            else if constexpr (AssetCategoryOf<T> == EAssetCategory::SkeletalMesh)
+            {
+                return LoadSkeletalMesh(guid, bShouldSuppressDirty);
+            }
             else if constexpr (AssetCategoryOf<T> == EAssetCategory::Material)
             {
                 return LoadMaterial(guid, bShouldSuppressDirty);
@@ -122,6 +245,10 @@ namespace ig
             {
                 return LoadAudioClip(guid, bShouldSuppressDirty);
             }
+            else if constexpr (AssetCategoryOf<T> == EAssetCategory::Animation)
+            {
+                return LoadAnimationClip(guid, bShouldSuppressDirty);
+            }
             else
             {
                 return {};
@@ -139,6 +266,10 @@ namespace ig
             {
                 return LoadStaticMesh(virtualPath);
             }
+            else if constexpr (AssetCategoryOf<T> == EAssetCategory::SkeletalMesh)
+            {
+                return LoadSkeletalMesh(virtualPath);
+            }
             else if constexpr (AssetCategoryOf<T> == EAssetCategory::Material)
             {
                 return LoadMaterial(virtualPath);
@@ -151,6 +282,10 @@ namespace ig
             {
                 return LoadAudioClip(virtualPath);
             }
+            else if constexpr (AssetCategoryOf<T> == EAssetCategory::Animation)
+            {
+                return LoadAnimationClip(virtualPath);
+            }
             else
             {
                 return {};
@@ -158,6 +293,7 @@ namespace ig
         }
 
         // Reload는 항상 메모리 상에 로드 되어 있는(디스크 상 파일이 아닌)데이터(asset info/description)를 기준으로 한다.
+        // 반환 값은 리로드가 요청 되었는지 여부이며, 새 인스턴스는 이후 프레임의 CommitReloads 에서 반영 된다.
         template <typename T>
         bool Reload(const Guid& guid, const bool bShouldSuppressDirty = false)
         {
@@ -177,6 +313,10 @@ namespace ig
             {
                 bSuceeded = ReloadImpl<StaticMesh>(guid, desc, *staticMeshLoader, bShouldSuppressDirty);
             }
+            else if constexpr (AssetCategoryOf<T> == EAssetCategory::SkeletalMesh)
+            {
+                bSuceeded = ReloadImpl<SkeletalMesh>(guid, desc, *skeletalMeshLoader, bShouldSuppressDirty);
+            }
             else if constexpr (AssetCategoryOf<T> == EAssetCategory::Material)
             {
                 bSuceeded = ReloadImpl<Material>(guid, desc, *materialLoader, bShouldSuppressDirty);
@@ -189,6 +329,10 @@ namespace ig
             {
                 bSuceeded = ReloadImpl<AudioClip>(guid, desc, *audioLoader, bShouldSuppressDirty);
             }
+            else if constexpr (AssetCategoryOf<T> == EAssetCategory::Animation)
+            {
+                bSuceeded = ReloadImpl<AnimationClip>(guid, desc, *animationLoader, bShouldSuppressDirty);
+            }
             else
             {
                 IG_CHECK_NO_ENTRY();
@@ -251,6 +395,17 @@ namespace ig
             T* ptr = cache.Lookup(handle);
             if (ptr != nullptr)
             {
+                const AssetInfo& assetInfo{ptr->GetSnapshot().Info};
+                /* 마지막 참조가 아니라면 에셋 별 잠금 없이 RefCount만 감소 시킨다. */
+                if (cache.TryRelease(assetInfo.GetGuid()))
+                {
+                    if (!bShouldSuppressDirty)
+                    {
+                        bIsDirty = true;
+                    }
+                    return;
+                }
+
                 const typename T::Desc desc = ptr->GetSnapshot();
                 AssetLock assetLock{GetAssetMutex(desc.Info.GetGuid())};
                 cache.Unload(desc.Info);
@@ -264,6 +419,23 @@ namespace ig
 
         void SaveAllChanges();
 
+        /*
+         * #sy_note 에셋 패키지
+         * 패키지가 마운트 되어 있다면 로더는 Loose 파일 대신 매핑된 패키지의 데이터를 우선적으로 사용한다.
+         * 패키지에만 존재하는 에셋은 읽기 전용으로 취급 되며, 메타데이터가 파일로 저장되지 않는다.
+         */
+        bool MountPackage(const Path& packagePath = Path{details::DefaultAssetPackagePath});
+        /* 패키지에만 존재하는 에셋이 아직 참조 되고 있다면 언마운트 하지 않고 false 를 반환. Keep-Alive 중인 에셋은 먼저 해제 된다. */
+        bool UnmountPackage();
+        [[nodiscard]] bool IsPackageMounted() const;
+        /*
+         * 패키지에만 존재하는 에셋이 아니거나, 마운트 된 패키지가 없다면 빈 span을 반환. 반환된 span은 UnmountPackage 전까지 유효
+         * Loose 파일이 있는 에셋(재임포트 포함)은 항상 Loose 파일에서 읽는다.
+         */
+        [[nodiscard]] std::span<const U8> FindPackedAsset(const Guid& guid) const;
+        /* 패키지를 빌드하기 전, 변경 사항을 먼저 저장하여야 한다. */
+        bool BuildPackage(const Path& packagePath = Path{details::DefaultAssetPackagePath});
+
         [[nodiscard]] std::optional<AssetInfo> GetAssetInfo(const Guid& guid) const;
 
         /*
@@ -303,8 +475,19 @@ namespace ig
         // Unknown == no filter
         [[nodiscard]] Vector<Snapshot> TakeSnapshots(const EAssetCategory filter = EAssetCategory::Unknown, const bool bOnlyTakeCached = false) const;
 
+        [[nodiscard]] CacheStatistics GetCacheStatistics(const EAssetCategory assetCategory) const;
+        void ResetCacheStatistics();
+        void SetKeepAliveBudget(const EAssetCategory assetCategory, const Bytes newBudget);
+        /* Unknown == 모든 카테고리. 해제된 에셋의 수를 반환 */
+        Size TrimKeepAlive(const EAssetCategory assetCategory = EAssetCategory::Unknown, const Bytes targetBytes = 0);
+
         [[nodiscard]] ModifiedEvent& GetModifiedEvent() { return assetModifiedEvent; }
 
+        /*
+         * 완료 된 백그라운드 리로드 들을 캐시에 반영 한다. 메인 스레드에서 DispatchEvent 이전에 호출 되어야 하며, 완료 되지 않은 리로드를 기다리지 않는다.
+         * 또한, 에셋 디렉터리에서 외부에 의해 변경 된 에셋 들의 리로드를 요청 한다.
+         */
+        void CommitReloads();
         void DispatchEvent();
 
     private:
@@ -323,6 +506,10 @@ namespace ig
         details::TypelessAssetCache& GetTypelessCache(const EAssetCategory assetType);
         const details::TypelessAssetCache& GetTypelessCache(const EAssetCategory assetType) const;
 
+        /* 씬 임포트 결과로 부터 메시 인스턴스들을 배치한 Map 을 생성. meshGuids 는 임포트 결과 순서와 같다. */
+        Guid CreateSceneMap(const std::string_view resPath, const std::span<const StaticMeshSceneInstance> sceneInstances,
+            const std::span<const Guid> meshGuids, const bool bShouldSuppressDirty);
+
         template <typename T, ResultStatus ImportStatus>
         std::optional<Guid> ImportImpl(std::string_view resPath, Result<typename T::Desc, ImportStatus>& result, const bool bShouldSuppressDirty)
         {
@@ -412,25 +599,50 @@ namespace ig
                 return Handle<T>{};
             }
 
-            AssetLock assetLock{GetAssetMutex(guid)};
+            /* 이미 참조 되고 있는 에셋은 에셋 별 잠금 없이 RefCount만 증가 시킨다. */
             details::AssetCache<T>& assetCache{GetCache<T>()};
-            if (!assetCache.IsCached(guid))
+            if (Handle<T> acquiredHandle{assetCache.TryAcquire(guid)};
+                acquiredHandle)
             {
-                const typename T::Desc desc{assetMonitor->GetDesc<T>(guid)};
-                IG_CHECK(desc.Info.GetGuid() == guid);
-                auto result{loader.Load(desc)};
-                if (!result.HasOwnership())
+                if (!bShouldSuppressDirty)
                 {
-                    IG_LOG(AssetManagerLog, Error, "Failed({}) to load {} asset {} ({}).", AssetCategoryOf<T>, result.GetStatus(),
-                        desc.Info.GetVirtualPath(), guid);
-                    return Handle<T>{};
+                    bIsDirty = true;
                 }
+                return acquiredHandle;
+            }
 
-                assetCache.Cache(guid, result.Take());
-                IG_LOG(AssetManagerLog, Info, "{} asset {} ({}) cached.", AssetCategoryOf<T>, desc.Info.GetVirtualPath(), guid);
+            AssetLock assetLock{GetAssetMutex(guid)};
+            if (Handle<T> cachedHandle{assetCache.TryLoad(guid)};
+                cachedHandle)
+            {
+                IG_LOG(AssetManagerLog, Info, "Cache Hit! {} asset {} loaded.", AssetCategoryOf<T>, guid);
+                if (!bShouldSuppressDirty)
+                {
+                    bIsDirty = true;
+                }
+                return cachedHandle;
+            }
+
+            const typename T::Desc desc{assetMonitor->GetDesc<T>(guid)};
+            IG_CHECK(desc.Info.GetGuid() == guid);
+            const std::span<const U8> packedAsset{FindPackedAsset(guid)};
+            const bool bIsPacked{!packedAsset.empty()};
+            TempTimer loadTimer{};
+            loadTimer.Begin();
+            auto result{loader.Load(desc)};
+            if (!result.HasOwnership())
+            {
+                IG_LOG(AssetManagerLog, Error, "Failed({}) to load {} asset {} ({}).", AssetCategoryOf<T>, result.GetStatus(),
+                    desc.Info.GetVirtualPath(), guid);
+                return Handle<T>{};
             }
 
-            IG_LOG(AssetManagerLog, Info, "Cache Hit! {} asset {} loaded.", AssetCategoryOf<T>, guid);
+            T newAsset{result.Take()};
+            const Bytes residentSize{newAsset.GetResidentSize()};
+            assetCache.Cache(guid, std::move(newAsset), residentSize);
+            IG_LOG(AssetManagerLog, Info, "{} asset {} ({}) cached. (Source: {}, Resident: {} bytes, {} ms)", AssetCategoryOf<T>,
+                desc.Info.GetVirtualPath(), guid, bIsPacked ? "Package" : "Loose", residentSize, loadTimer.End());
+
             if (!bShouldSuppressDirty)
             {
                 bIsDirty = true;
@@ -442,48 +654,53 @@ namespace ig
         bool ReloadImpl(const Guid& guid, const typename T::Desc& desc, AssetLoader& loader, const bool bShouldSuppressDirty)
         {
             /* #sy_note
-             * 현재 구현은 핸들이 가르키는 메모리 공간의 인스턴스를 replace 하는 방식으로 구현
-             * 이 경우, 해당 메모리 공간에 대한 스레드 안전성은 보장 되지 않음.
-             * 이후, 해당 메모리 공간에 대한 스레드 안전성을 보장하기 위해서는 이전 핸들을 invalidate 시키고
-             * 해당 핸들을 참조하는 측에서 별도의 fallback (예시. 1차 fallback => 캐시된 guid로 재 로드 시도, 2차 fallback => 엔진 기본 에셋)
-             * 을 제공하는 방식으로 구현하는 것이 좋아 보임.
+             * 리로드는 호출 스레드를 막지 않는다. 새 인스턴스는 워커에서 로드 되며, CommitReloads 에서 핸들이 가르키는 슬롯의 인스턴스와 교체 된다.
+             * 교체는 프레임 경계에서만 일어나므로, 프레임 도중 얻은 에셋 포인터는 해당 프레임 동안 유효 하다.
+             * 변경 이벤트 역시 교체가 이루어진 이후에 발생 한다.
              */
             IG_CHECK(assetMonitor->Contains(guid));
             IG_CHECK(desc.Info.GetGuid() == guid);
-            details::AssetCache<T>& assetCache{GetCache<T>()};
-            AssetLock assetLock{GetAssetMutex(guid)};
-            if (!assetCache.IsCached(guid))
+            /* 로드/해제와 경쟁 하지 않도록 에셋 별 잠금 하에서 확인 하고, 교체 시 비교 할 핸들을 기록 한다. */
+            Handle<T> cachedHandle{};
             {
-                return false;
-            }
+                AssetLock assetLock{GetAssetMutex(guid)};
+                details::AssetCache<T>& assetCache = GetCache<T>();
+                if (!assetCache.IsCached(guid))
+                {
+                    return false;
+                }
 
-            auto result{loader.Load(desc)};
-            if (!result.HasOwnership())
-            {
-                IG_LOG(AssetManagerLog, Error, "{} asset \"{}\" failed to reload.", AssetCategoryOf<T>, guid);
-                return false;
+                cachedHandle = assetCache.Load(guid, false);
             }
 
-            Handle<T> cachedAsset{assetCache.Load(guid, false)};
-            if (cachedAsset)
-            {
-                T* cachedAssetPtr = assetCache.Lookup(cachedAsset);
-                IG_CHECK(cachedAssetPtr != nullptr);
-                *cachedAssetPtr = result.Take();
-            }
-            else
+            using LoadResult = decltype(loader.Load(desc));
+            SharedPtr<std::promise<LoadResult>> loadPromise = std::make_shared<std::promise<LoadResult>>();
             {
-                assetCache.Cache(guid, result.Take());
-            }
+                UniqueLock lock{pendingReloadMutex};
+                for (Ptr<details::TypelessAssetReload>& pendingReload : pendingReloads)
+                {
+                    if (pendingReload->GetGuid() == guid)
+                    {
+                        pendingReload->Supersede();
+                    }
+                }
 
-            if (!bShouldSuppressDirty)
-            {
-                bIsDirty = true;
+                pendingReloads.emplace_back(MakePtr<details::AssetReload<T, LoadResult>>(
+                    guid, cachedHandle, bShouldSuppressDirty, loadPromise->get_future()));
             }
 
+            taskExecutor.silent_async(
+                [&loader, desc, loadPromise]()
+                {
+                    loadPromise->set_value(loader.Load(desc));
+                });
+
+            IG_LOG(AssetManagerLog, Info, "{} asset {} ({}) reload requested.", AssetCategoryOf<T>, desc.Info.GetVirtualPath(), guid);
             return true;
         }
 
+        void ReloadModifiedAssets();
+
         void DeleteImpl(const EAssetCategory assetType, const Guid& guid, const bool bShouldSuppressDirty);
 
         [[nodiscard]] AssetMutex& GetAssetMutex(const Guid& guid);
@@ -538,6 +755,9 @@ namespace ig
         Ptr<StaticMeshImporter> staticMeshImporter;
         Ptr<StaticMeshLoader> staticMeshLoader;
 
+        Ptr<SkeletalMeshImporter> skeletalMeshImporter;
+        Ptr<SkeletalMeshLoader> skeletalMeshLoader;
+
         Ptr<MaterialImporter> materialImporter;
         Ptr<MaterialLoader> materialLoader;
 
@@ -547,6 +767,18 @@ namespace ig
         Ptr<AudioClipImporter> audioImporter;
         Ptr<AudioClipLoader> audioLoader;
 
+        Ptr<AnimationClipImporter> animationImporter;
+        Ptr<AnimationClipLoader> animationLoader;
+
+        mutable SharedMutex packageMutex;
+        Ptr<AssetPackage> package;
+
+        tf::Executor& taskExecutor;
+        Ptr<FileWatcher> assetFileWatcher;
+        Mutex pendingReloadMutex;
+        /* 요청 순서 대로 */
+        Vector<Ptr<details::TypelessAssetReload>> pendingReloads;
+
         std::atomic_bool bIsDirty{false};
         ModifiedEvent assetModifiedEvent;
     };
@@ -0,0 +1,179 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Core/String.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/AssetMetadataIndex.h"
+
+IG_DECLARE_LOG_CATEGORY(AssetMetadataIndexLog);
+
+IG_DEFINE_LOG_CATEGORY(AssetMetadataIndexLog);
+
+namespace ig::details
+{
+    bool AssetMetadataIndex::Open(const Path& indexPath)
+    {
+        Close();
+        if (!fs::exists(indexPath) || !mappedFile.Open(indexPath))
+        {
+            return false;
+        }
+
+        if (mappedFile.GetSize() < sizeof(Header))
+        {
+            IG_LOG(AssetMetadataIndexLog, Warning, "Metadata index {} ignored. The file is truncated.", indexPath.string());
+            Close();
+            return false;
+        }
+
+        const Header& header{*reinterpret_cast<const Header*>(mappedFile.GetData())};
+        if (header.Magic != Header::kMagic || header.Version != Header::kVersion)
+        {
+            IG_LOG(AssetMetadataIndexLog, Warning, "Metadata index {} ignored. Magic or version mismatch.", indexPath.string());
+            Close();
+            return false;
+        }
+
+        const Size entryTableSize = header.NumEntries * sizeof(Entry);
+        if (header.EntryTableOffset + entryTableSize > mappedFile.GetSize() || header.PayloadsOffset > mappedFile.GetSize())
+        {
+            IG_LOG(AssetMetadataIndexLog, Warning, "Metadata index {} ignored. The entry table is out of range.", indexPath.string());
+            Close();
+            return false;
+        }
+
+        entries = std::span<const Entry>{
+            reinterpret_cast<const Entry*>(mappedFile.GetData() + header.EntryTableOffset),
+            header.NumEntries
+        };
+        return true;
+    }
+
+    void AssetMetadataIndex::Close()
+    {
+        entries = {};
+        mappedFile.Close();
+    }
+
+    std::optional<Json> AssetMetadataIndex::Lookup(const Path& metadataPath, const U64 lastWriteTime, const U64 fileSize) const
+    {
+        if (!IsOpened())
+        {
+            return std::nullopt;
+        }
+
+        const U64 pathHash = MakePathHash(metadataPath);
+        const auto entryItr = std::lower_bound(entries.begin(), entries.end(), pathHash,
+            [](const Entry& entry, const U64 hash)
+            {
+                return entry.PathHash < hash;
+            });
+
+        if (entryItr == entries.end() || entryItr->PathHash != pathHash)
+        {
+            return std::nullopt;
+        }
+
+        const Entry& entry{*entryItr};
+        if (entry.LastWriteTime != lastWriteTime || entry.FileSize != fileSize)
+        {
+            return std::nullopt;
+        }
+
+        if (entry.PayloadOffset + entry.PayloadSize > mappedFile.GetSize())
+        {
+            return std::nullopt;
+        }
+
+        const std::span<const U8> payload{mappedFile.GetSpan(entry.PayloadOffset, entry.PayloadSize)};
+        Json serializedMetadata{Json::from_msgpack(payload.begin(), payload.end(), true, false)};
+        if (serializedMetadata.is_discarded())
+        {
+            return std::nullopt;
+        }
+
+        return serializedMetadata;
+    }
+
+    bool AssetMetadataIndex::Save(const Path& indexPath, const std::span<const Record> records)
+    {
+        Vector<Entry> newEntries;
+        newEntries.reserve(records.size());
+        Vector<Vector<U8>> payloads;
+        payloads.reserve(records.size());
+        for (const Record& record : records)
+        {
+            std::error_code errorCode{};
+            if (!fs::exists(record.MetadataPath, errorCode))
+            {
+                continue;
+            }
+
+            std::vector<U8> payload{Json::to_msgpack(record.SerializedMetadata)};
+            newEntries.emplace_back(Entry{
+                .PathHash = MakePathHash(record.MetadataPath),
+                .LastWriteTime = record.LastWriteTime,
+                .FileSize = record.FileSize,
+                .PayloadOffset = 0,
+                .PayloadSize = payload.size()
+            });
+            payloads.emplace_back(payload.cbegin(), payload.cend());
+        }
+
+        Vector<Index> sortedIndices(newEntries.size());
+        std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+        std::sort(sortedIndices.begin(), sortedIndices.end(),
+            [&newEntries](const Index lhs, const Index rhs)
+            {
+                return newEntries[lhs].PathHash < newEntries[rhs].PathHash;
+            });
+
+        const Header header{
+            .NumEntries = newEntries.size(),
+            .EntryTableOffset = sizeof(Header),
+            .PayloadsOffset = sizeof(Header) + sizeof(Entry) * newEntries.size()
+        };
+
+        Vector<Entry> sortedEntries;
+        sortedEntries.reserve(newEntries.size());
+        U64 payloadOffset = header.PayloadsOffset;
+        for (const Index entryIdx : sortedIndices)
+        {
+            Entry& entry{sortedEntries.emplace_back(newEntries[entryIdx])};
+            entry.PayloadOffset = payloadOffset;
+            payloadOffset += entry.PayloadSize;
+        }
+
+        Vector<U8> blob(payloadOffset);
+        std::memcpy(blob.data(), &header, sizeof(Header));
+        if (!sortedEntries.empty())
+        {
+            std::memcpy(blob.data() + header.EntryTableOffset, sortedEntries.data(), sizeof(Entry) * sortedEntries.size());
+        }
+        for (Index sortedIdx = 0; sortedIdx < sortedEntries.size(); ++sortedIdx)
+        {
+            const Vector<U8>& payload{payloads[sortedIndices[sortedIdx]]};
+            std::memcpy(blob.data() + sortedEntries[sortedIdx].PayloadOffset, payload.data(), payload.size());
+        }
+
+        if (!SaveBlobToFile(indexPath, blob))
+        {
+            IG_LOG(AssetMetadataIndexLog, Error, "Failed to save metadata index to {}.", indexPath.string());
+            return false;
+        }
+
+        IG_LOG(AssetMetadataIndexLog, Debug, "Metadata index saved: {} entries, {} bytes.", sortedEntries.size(), blob.size());
+        return true;
+    }
+
+    U64 AssetMetadataIndex::QueryLastWriteTime(const Path& path)
+    {
+        std::error_code errorCode{};
+        const fs::file_time_type lastWriteTime = fs::last_write_time(path, errorCode);
+        return errorCode ? 0 : static_cast<U64>(lastWriteTime.time_since_epoch().count());
+    }
+
+    U64 AssetMetadataIndex::MakePathHash(const Path& path)
+    {
+        return Hash(path.lexically_normal().generic_string());
+    }
+} // namespace ig::details
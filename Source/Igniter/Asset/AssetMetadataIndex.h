@@ -0,0 +1,87 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Filesystem/MappedFile.h"
+
+namespace ig::details
+{
+    /*
+     * #sy_note 에셋 메타데이터 인덱스
+     * 시작 시 모든 '.metadata' json 파일을 파싱하는 비용을 줄이기 위해, 메타데이터 파일의 (경로, 최종 수정 시각, 크기)를 키로
+     * 파싱 된 메타데이터를 MessagePack 형식으로 저장해두는 바이너리 인덱스.
+     * 인덱스는 메모리 매핑되며, 헤더만 Open 시점에 검증하고 각 엔트리는 Lookup 시점에 (지연) 검증 된다.
+     *
+     * Binary Layout
+     * Header => [0, sizeof(Header))
+     * Entries(Sorted by PathHash) => [Header::EntryTableOffset, Header::EntryTableOffset + sizeof(Entry) * Header::NumEntries)
+     * Payloads(MessagePack) => [Entry::PayloadOffset, Entry::PayloadOffset + Entry::PayloadSize)
+     */
+    class AssetMetadataIndex final
+    {
+    public:
+        struct Record
+        {
+        public:
+            Path MetadataPath{};
+            /* SerializedMetadata 를 파싱(또는 기록) 했을 당시의 메타데이터 파일 상태 */
+            U64 LastWriteTime = 0;
+            U64 FileSize = 0;
+            Json SerializedMetadata{};
+        };
+
+    private:
+        struct Header
+        {
+        public:
+            constexpr static U32 kMagic = 0x494D4749; /* 'IGMI' */
+            constexpr static U32 kVersion = 1;
+
+        public:
+            U32 Magic = kMagic;
+            U32 Version = kVersion;
+            U64 NumEntries = 0;
+            U64 EntryTableOffset = 0;
+            U64 PayloadsOffset = 0;
+        };
+
+        struct Entry
+        {
+        public:
+            U64 PathHash = 0;
+            U64 LastWriteTime = 0;
+            U64 FileSize = 0;
+            U64 PayloadOffset = 0;
+            U64 PayloadSize = 0;
+        };
+
+    public:
+        AssetMetadataIndex() = default;
+        AssetMetadataIndex(const AssetMetadataIndex&) = delete;
+        AssetMetadataIndex(AssetMetadataIndex&&) noexcept = delete;
+        ~AssetMetadataIndex() = default;
+
+        AssetMetadataIndex& operator=(const AssetMetadataIndex&) = delete;
+        AssetMetadataIndex& operator=(AssetMetadataIndex&&) noexcept = delete;
+
+        bool Open(const Path& indexPath);
+        void Close();
+
+        [[nodiscard]] bool IsOpened() const noexcept { return mappedFile.IsOpened(); }
+        [[nodiscard]] Size GetNumEntries() const noexcept { return entries.size(); }
+
+        /* 메타데이터 파일의 현재 상태(최종 수정 시각, 크기)가 인덱스에 기록된 상태와 일치 할 때만 캐싱된 메타데이터를 반환 */
+        [[nodiscard]] std::optional<Json> Lookup(const Path& metadataPath, const U64 lastWriteTime, const U64 fileSize) const;
+
+        /*
+         * 각 레코드의 메타데이터 파일 상태는 레코드에 기록 된 (파싱 시점의) 상태 그대로 저장 된다.
+         * 파싱 이후 변경 된 파일은 다음 Lookup 에서 상태가 일치 하지 않아 다시 파싱 된다. 인덱스가 Open 되어 있는 경우 덮어 쓸 수 없음.
+         */
+        static bool Save(const Path& indexPath, const std::span<const Record> records);
+
+        static U64 QueryLastWriteTime(const Path& path);
+        static U64 MakePathHash(const Path& path);
+
+    private:
+        MappedFile mappedFile{};
+        std::span<const Entry> entries{};
+    };
+} // namespace ig::details
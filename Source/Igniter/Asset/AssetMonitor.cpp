@@ -1,11 +1,18 @@
 #include "Igniter/Igniter.h"
 #include "Igniter/Core/Log.h"
+#include "Igniter/Core/Timer.h"
+#include "Igniter/Core/Engine.h"
 #include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Filesystem/FileWatcher.h"
+#include "Igniter/Filesystem/AsyncFileIo.h"
 #include "Igniter/Asset/Texture.h"
 #include "Igniter/Asset/StaticMesh.h"
+#include "Igniter/Asset/SkeletalMesh.h"
 #include "Igniter/Asset/Material.h"
 #include "Igniter/Asset/Map.h"
 #include "Igniter/Asset/AudioClip.h"
+#include "Igniter/Asset/AnimationClip.h"
+#include "Igniter/Asset/AssetPackage.h"
 #include "Igniter/Asset/AssetMonitor.h"
 
 IG_DECLARE_LOG_CATEGORY(AssetMonitorLog);
@@ -15,6 +22,11 @@ IG_DEFINE_LOG_CATEGORY(AssetMonitorLog);
 namespace ig::details
 {
     AssetMonitor::AssetMonitor()
+        : AssetMonitor(Engine::GetTaskExecutor())
+    {}
+
+    AssetMonitor::AssetMonitor(tf::Executor& taskExecutor)
+        : taskExecutor(taskExecutor)
     {
         InitAssetDescTables();
         InitVirtualPathGuidTables();
@@ -28,9 +40,11 @@ namespace ig::details
     {
         guidDescTables.emplace_back(std::make_pair(EAssetCategory::Texture, MakePtr<AssetDescMap<Texture>>()));
         guidDescTables.emplace_back(std::make_pair(EAssetCategory::StaticMesh, MakePtr<AssetDescMap<StaticMesh>>()));
+        guidDescTables.emplace_back(std::make_pair(EAssetCategory::SkeletalMesh, MakePtr<AssetDescMap<SkeletalMesh>>()));
         guidDescTables.emplace_back(std::make_pair(EAssetCategory::Material, MakePtr<AssetDescMap<Material>>()));
         guidDescTables.emplace_back(std::make_pair(EAssetCategory::Map, MakePtr<AssetDescMap<Map>>()));
         guidDescTables.emplace_back(std::make_pair(EAssetCategory::Audio, MakePtr<AssetDescMap<AudioClip>>()));
+        guidDescTables.emplace_back(std::make_pair(EAssetCategory::Animation, MakePtr<AssetDescMap<AnimationClip>>()));
     }
 
     void AssetMonitor::InitVirtualPathGuidTables()
@@ -52,6 +66,29 @@ namespace ig::details
 
     void AssetMonitor::ParseAssetDirectory()
     {
+        struct MetadataCandidate
+        {
+            EAssetCategory Category{EAssetCategory::Unknown};
+            Path AssetPath{};
+            Path MetadataPath{};
+            Guid GuidFromPath{};
+            Size MetadataFileSize{0};
+            U64 MetadataLastWriteTime{0};
+            Json SerializedMetadata{};
+        };
+
+        TempTimer parseTimer{};
+        parseTimer.Begin();
+
+        AssetMetadataIndex metadataIndex{};
+        const Path metadataIndexPath{details::MetadataIndexPath};
+        if (!metadataIndex.Open(metadataIndexPath))
+        {
+            IG_LOG(AssetMonitorLog, Info, "Metadata index does not exists or invalid. Every metadata will be parsed from json.");
+        }
+
+        Vector<MetadataCandidate> candidates{};
+        Vector<Index> missedCandidates{};
         for (const auto assetType : magic_enum::enum_values<EAssetCategory>())
         {
             if (assetType == EAssetCategory::Unknown)
@@ -59,9 +96,7 @@ namespace ig::details
                 continue;
             }
 
-            VirtualPathGuidTable& virtualPathGuidTable = GetVirtualPathGuidTable(assetType);
             fs::directory_iterator directoryItr{GetAssetDirectoryPath(assetType)};
-
             IG_LOG(AssetMonitorLog, Debug, "* Parsing {} type root dir ({})...", assetType, GetAssetDirectoryPath(assetType).string());
             while (directoryItr != fs::end(directoryItr))
             {
@@ -79,64 +114,201 @@ namespace ig::details
 
                     Path metadataPath{entry.path()};
                     metadataPath.replace_extension(details::MetadataExt);
-                    if (!fs::exists(metadataPath))
+                    std::error_code errorCode{};
+                    const U64 metadataFileSize = fs::file_size(metadataPath, errorCode);
+                    if (errorCode)
                     {
                         IG_LOG(AssetMonitorLog, Error, "Asset {} ignored. The metadata does not exists.", entry.path().string());
                         ++directoryItr;
                         continue;
                     }
 
-                    Json serializedMetadata{LoadJsonFromFile(metadataPath)};
-                    AssetInfo assetInfo{};
-                    serializedMetadata >> assetInfo;
-
-                    const Guid guid{assetInfo.GetGuid()};
-                    const std::string_view virtualPath{assetInfo.GetVirtualPath()};
-                    const U64 virtualPathHash = Hash(virtualPath);
-
-                    if (!assetInfo.IsValid())
+                    const U64 metadataLastWriteTime = AssetMetadataIndex::QueryLastWriteTime(metadataPath);
+                    std::optional<Json> indexedMetadata{metadataIndex.Lookup(metadataPath, metadataLastWriteTime, metadataFileSize)};
+                    if (!indexedMetadata)
                     {
-                        IG_LOG(AssetMonitorLog, Error, "Asset {} ignored. The asset info is invalid.", entry.path().string());
-                        ++directoryItr;
-                        continue;
+                        missedCandidates.emplace_back(candidates.size());
                     }
 
-                    if (guidFromPath != guid)
-                    {
-                        IG_LOG(AssetMonitorLog, Error,
-                            "{}: Asset {} ignored. The guid from filename does not match asset info guid."
-                            " Which was {}.",
-                            assetInfo.GetCategory(), entry.path().string(), guid);
-                        ++directoryItr;
-                        continue;
-                    }
+                    candidates.emplace_back(MetadataCandidate{
+                        .Category = assetType,
+                        .AssetPath = entry.path(),
+                        .MetadataPath = metadataPath,
+                        .GuidFromPath = guidFromPath,
+                        .MetadataFileSize = metadataFileSize,
+                        .MetadataLastWriteTime = metadataLastWriteTime,
+                        .SerializedMetadata = indexedMetadata ? std::move(*indexedMetadata) : Json{}
+                    });
+                }
 
-                    if (virtualPathGuidTable.contains(virtualPathHash))
-                    {
-                        IG_LOG(AssetMonitorLog, Error, "{}: Asset {} ({}) ignored. Which has duplicated virtual path.", assetInfo.GetCategory(),
-                            virtualPath, guid);
-                        ++directoryItr;
-                        continue;
-                    }
+                ++directoryItr;
+            }
+        }
 
-                    if (assetInfo.GetScope() == EAssetScope::Engine)
+        const bool bIndexWasOpened{metadataIndex.IsOpened()};
+        const Size numIndexEntries{metadataIndex.GetNumEntries()};
+        metadataIndex.Close();
+
+        /*
+         * 변경 되었거나 인덱스에 존재하지 않는 메타데이터만 다시 파싱.
+         * 읽기 들을 한 번에 제출 하여 여러 읽기가 동시에 진행 되도록 하고, 읽기가 끝난 순서 대로 워커 에서 파싱 한다.
+         */
+        if (!missedCandidates.empty())
+        {
+            Vector<Vector<U8>> metadataBlobs(missedCandidates.size());
+            Vector<AsyncReadRequest> readRequests{};
+            readRequests.reserve(missedCandidates.size());
+            for (Index missedIdx = 0; missedIdx < missedCandidates.size(); ++missedIdx)
+            {
+                MetadataCandidate& candidate{candidates[missedCandidates[missedIdx]]};
+                Vector<U8>& metadataBlob{metadataBlobs[missedIdx]};
+                metadataBlob.resize(candidate.MetadataFileSize);
+                readRequests.emplace_back(AsyncReadRequest{
+                    .FilePath = candidate.MetadataPath,
+                    .Destination = std::span<U8>{metadataBlob.data(), metadataBlob.size()},
+                    .OnCompleted = [&candidate, &metadataBlob](const AsyncReadResult& result)
                     {
-                        IG_LOG(AssetMonitorLog, Warning, "{}: Found invalid asset scope Asset {} ({}). Assumes as Managed.", assetInfo.GetCategory(),
-                            virtualPath, guid);
-                        assetInfo.SetScope(EAssetScope::Managed);
-                        serializedMetadata << assetInfo;
+                        if (result.Status != EAsyncReadStatus::Success)
+                        {
+                            return;
+                        }
+
+                        Json parsedMetadata{Json::parse(metadataBlob.begin(), metadataBlob.begin() + result.NumReadBytes, nullptr, false)};
+                        if (!parsedMetadata.is_discarded())
+                        {
+                            candidate.SerializedMetadata = std::move(parsedMetadata);
+                        }
                     }
+                });
+            }
+
+            AsyncFileIo asyncFileIo{taskExecutor};
+            asyncFileIo.Submit(std::move(readRequests));
+            asyncFileIo.WaitIdle();
+        }
+
+        /*
+         * 거부 된 메타데이터도 같은 키(경로, 최종 수정 시각, 크기)로 인덱스에 기록 하여, 파일이 변경 되기 전까지 다시 파싱 하지 않는다.
+         * 파싱 할 수 없는 메타데이터는 null 로 기록 되며, 다음 시작 시 다시 거부 된다.
+         */
+        rejectedMetadataRecords.clear();
+        const auto rejectCandidate = [this](const MetadataCandidate& candidate)
+        {
+            rejectedMetadataRecords.emplace_back(AssetMetadataIndex::Record{
+                .MetadataPath = candidate.MetadataPath,
+                .LastWriteTime = candidate.MetadataLastWriteTime,
+                .FileSize = candidate.MetadataFileSize,
+                .SerializedMetadata = candidate.SerializedMetadata
+            });
+        };
+
+        for (MetadataCandidate& candidate : candidates)
+        {
+            Json& serializedMetadata{candidate.SerializedMetadata};
+            AssetInfo assetInfo{};
+            serializedMetadata >> assetInfo;
+
+            const Guid guid{assetInfo.GetGuid()};
+            const std::string_view virtualPath{assetInfo.GetVirtualPath()};
+            const U64 virtualPathHash = Hash(virtualPath);
+
+            if (!assetInfo.IsValid())
+            {
+                IG_LOG(AssetMonitorLog, Error, "Asset {} ignored. The asset info is invalid.", candidate.AssetPath.string());
+                rejectCandidate(candidate);
+                continue;
+            }
+
+            if (candidate.GuidFromPath != guid)
+            {
+                IG_LOG(AssetMonitorLog, Error,
+                    "{}: Asset {} ignored. The guid from filename does not match asset info guid."
+                    " Which was {}.",
+                    assetInfo.GetCategory(), candidate.AssetPath.string(), guid);
+                rejectCandidate(candidate);
+                continue;
+            }
+
+            VirtualPathGuidTable& virtualPathGuidTable = GetVirtualPathGuidTable(candidate.Category);
+            if (virtualPathGuidTable.contains(virtualPathHash))
+            {
+                IG_LOG(AssetMonitorLog, Error, "{}: Asset {} ({}) ignored. Which has duplicated virtual path.", assetInfo.GetCategory(),
+                    virtualPath, guid);
+                rejectCandidate(candidate);
+                continue;
+            }
+
+            if (assetInfo.GetScope() == EAssetScope::Engine)
+            {
+                IG_LOG(AssetMonitorLog, Warning, "{}: Found invalid asset scope Asset {} ({}). Assumes as Managed.", assetInfo.GetCategory(),
+                    virtualPath, guid);
+                assetInfo.SetScope(EAssetScope::Managed);
+                serializedMetadata << assetInfo;
+            }
+
+            virtualPathGuidTable[virtualPathHash] = guid;
+            metadataFileStates[guid] = MetadataFileState{.LastWriteTime = candidate.MetadataLastWriteTime, .FileSize = candidate.MetadataFileSize};
+            IG_LOG(AssetMonitorLog, Debug, "VirtualPath: {}, Guid: {}", virtualPath, guid);
+            IG_CHECK(!Contains(guid));
+            TypelessAssetDescMap& descTable{GetDescMap(assetInfo.GetCategory())};
+            descTable.Insert(serializedMetadata);
+        }
+
+        const bool bShouldRebuildIndex{!bIndexWasOpened || !missedCandidates.empty() || numIndexEntries != candidates.size()};
+        if (bShouldRebuildIndex)
+        {
+            SaveMetadataIndexUnsafe();
+        }
+
+        parseStatistics = ParseStatistics{
+            .NumCandidates = candidates.size(),
+            .NumRejected = rejectedMetadataRecords.size(),
+            .NumIndexHits = candidates.size() - missedCandidates.size(),
+            .NumReparsed = missedCandidates.size(),
+            .bIndexRebuilt = bShouldRebuildIndex,
+            .ElapsedMilliseconds = parseTimer.End()
+        };
+        IG_LOG(AssetMonitorLog, Info, "{} assets parsed in {} ms. (Index Hits: {}, Re-parsed: {}, Rejected: {}, Index Rebuilt: {})",
+            parseStatistics.NumCandidates, parseStatistics.ElapsedMilliseconds,
+            parseStatistics.NumIndexHits, parseStatistics.NumReparsed, parseStatistics.NumRejected,
+            parseStatistics.bIndexRebuilt);
+    }
+
+    void AssetMonitor::SaveMetadataIndexUnsafe() const
+    {
+        Vector<AssetMetadataIndex::Record> records{};
+        for (const auto& assetTypeDescTablePair : guidDescTables)
+        {
+            const TypelessAssetDescMap& descMap{*assetTypeDescTablePair.second};
+            for (Json& serializedDesc : descMap.GetSerializedDescs())
+            {
+                AssetInfo assetInfo{};
+                serializedDesc >> assetInfo;
+                IG_CHECK(assetInfo.IsValid());
+                if (assetInfo.GetScope() == EAssetScope::Engine || packedOnlyGuids.contains(assetInfo.GetGuid()))
+                {
+                    continue;
+                }
 
-                    virtualPathGuidTable[virtualPathHash] = guid;
-                    IG_LOG(AssetMonitorLog, Debug, "VirtualPath: {}, Guid: {}", virtualPath, guid);
-                    IG_CHECK(!Contains(guid));
-                    TypelessAssetDescMap& descTable{GetDescMap(assetInfo.GetCategory())};
-                    descTable.Insert(serializedMetadata);
+                /* 모니터가 파싱 하거나 기록 한 적이 없는 메타데이터는 상태를 알 수 없으므로, 다음 시작 시 다시 파싱 한다. */
+                const auto fileStateItr = metadataFileStates.find(assetInfo.GetGuid());
+                if (fileStateItr == metadataFileStates.end())
+                {
+                    continue;
                 }
 
-                ++directoryItr;
+                records.emplace_back(AssetMetadataIndex::Record{
+                    .MetadataPath = MakeAssetMetadataPath(assetInfo.GetCategory(), assetInfo.GetGuid()),
+                    .LastWriteTime = fileStateItr->second.LastWriteTime,
+                    .FileSize = fileStateItr->second.FileSize,
+                    .SerializedMetadata = std::move(serializedDesc)
+                });
             }
         }
+
+        /* 파일이 삭제 된 레코드는 Save 에서 제외 된다. */
+        records.insert(records.end(), rejectedMetadataRecords.begin(), rejectedMetadataRecords.end());
+        AssetMetadataIndex::Save(Path{details::MetadataIndexPath}, records);
     }
 
     AssetMonitor::VirtualPathGuidTable& AssetMonitor::GetVirtualPathGuidTable(const EAssetCategory assetType)
@@ -306,6 +478,8 @@ namespace ig::details
         }
 
         virtualPathGuidTable.erase(virtualPathHash);
+        packedOnlyGuids.erase(guid);
+        metadataFileStates.erase(guid);
 
         for (auto& assetTypeDescTablePair : guidDescTables)
         {
@@ -360,19 +534,92 @@ namespace ig::details
                 serializedDesc >> assetInfo;
                 IG_CHECK(assetInfo.IsValid());
 
-                if (assetInfo.GetScope() != EAssetScope::Engine)
+                if (assetInfo.GetScope() != EAssetScope::Engine && !packedOnlyGuids.contains(assetInfo.GetGuid()))
                 {
                     const Guid guid{assetInfo.GetGuid()};
                     const std::string_view virtualPath{assetInfo.GetVirtualPath()};
 
                     const Path metadataPath{MakeAssetMetadataPath(assetInfo.GetCategory(), guid)};
                     IG_ENSURE(SaveJsonToFile(metadataPath, serializedDesc));
+                    std::error_code errorCode{};
+                    const U64 metadataFileSize = fs::file_size(metadataPath, errorCode);
+                    if (!errorCode)
+                    {
+                        metadataFileStates[guid] =
+                            MetadataFileState{.LastWriteTime = AssetMetadataIndex::QueryLastWriteTime(metadataPath), .FileSize = metadataFileSize};
+                    }
                     IG_LOG(AssetMonitorLog, Debug, "{} Asset metadata Saved: {} ({})", assetInfo.GetCategory(), virtualPath, guid);
                 }
             }
         }
     }
 
+    Size AssetMonitor::MountPackedAssets(const AssetPackage& package)
+    {
+        ReadWriteLock rwLock{mutex};
+        Size numMountedAssets = 0;
+        for (const AssetPackage::TocEntry& entry : package.GetTableOfContents())
+        {
+            const Guid guid{entry.Guid};
+            if (!package.Contains(guid) || ContainsUnsafe(guid))
+            {
+                continue;
+            }
+
+            Json serializedMetadata{package.GetSerializedMetadata(entry)};
+            AssetInfo assetInfo{};
+            serializedMetadata >> assetInfo;
+            if (!assetInfo.IsValid() || assetInfo.GetGuid() != guid || assetInfo.GetCategory() != entry.Category)
+            {
+                IG_LOG(AssetMonitorLog, Error, "Packed asset {} ignored. The asset info is invalid.", guid);
+                continue;
+            }
+
+            const U64 virtualPathHash = Hash(assetInfo.GetVirtualPath());
+            VirtualPathGuidTable& virtualPathGuidTable = GetVirtualPathGuidTable(entry.Category);
+            if (virtualPathGuidTable.contains(virtualPathHash))
+            {
+                IG_LOG(AssetMonitorLog, Warning, "{}: Packed asset {} ({}) ignored. Which has duplicated virtual path.", entry.Category,
+                    assetInfo.GetVirtualPath(), guid);
+                continue;
+            }
+
+            virtualPathGuidTable[virtualPathHash] = guid;
+            GetDescMap(entry.Category).Insert(serializedMetadata);
+            packedOnlyGuids.insert(guid);
+            ++numMountedAssets;
+        }
+
+        IG_LOG(AssetMonitorLog, Info, "{} packed only assets mounted.", numMountedAssets);
+        return numMountedAssets;
+    }
+
+    void AssetMonitor::UnmountPackedAssets()
+    {
+        ReadWriteLock rwLock{mutex};
+        for (const Guid& guid : packedOnlyGuids)
+        {
+            IG_CHECK(ContainsUnsafe(guid));
+            const AssetInfo assetInfo{GetAssetInfoUnsafe(guid)};
+            GetVirtualPathGuidTable(assetInfo.GetCategory()).erase(Hash(assetInfo.GetVirtualPath()));
+            GetDescMap(assetInfo.GetCategory()).Erase(guid);
+        }
+
+        packedOnlyGuids.clear();
+    }
+
+    bool AssetMonitor::IsPackedOnly(const Guid& guid) const
+    {
+        ReadOnlyLock lock{mutex};
+        return packedOnlyGuids.contains(guid);
+    }
+
+    std::span<const U8> AssetMonitor::FindPackedAssetData(const AssetPackage& package, const Guid& guid) const
+    {
+        ReadOnlyLock lock{mutex};
+        return packedOnlyGuids.contains(guid) ? package.GetAssetData(guid) : std::span<const U8>{};
+    }
+
     void AssetMonitor::CleanupOrphanFiles()
     {
         Vector<Path> orphanFiles{};
@@ -426,6 +673,7 @@ namespace ig::details
             ReflectExpiredToFilesUnsafe();
             ReflectRemainedToFilesUnsafe();
             CleanupOrphanFiles();
+            SaveMetadataIndexUnsafe();
         }
         IG_LOG(AssetMonitorLog, Info, "All info changes saved.");
     }
@@ -457,6 +705,37 @@ namespace ig::details
         return assetInfoSnapshots;
     }
 
+    Vector<AssetInfo> AssetMonitor::ResolveModifiedAssets(const std::span<const FileChange> changes) const
+    {
+        ReadOnlyLock lock{mutex};
+        Vector<AssetInfo> modifiedAssetInfos{};
+        for (const FileChange& change : changes)
+        {
+            /* 메타데이터는 에셋 매니저가 직접 기록(SaveAllChanges) 하므로, 에셋 파일(확장자 없음)의 변경 만 반영 한다. */
+            if (change.Action == EFileWatchAction::Removed || change.Path.has_extension())
+            {
+                continue;
+            }
+
+            const Guid guid{change.Path.filename().string()};
+            if (!guid.isValid() || !ContainsUnsafe(guid))
+            {
+                continue;
+            }
+
+            /* 임시 디렉터리(temp)에 백업 된 파일은 제외 */
+            const AssetInfo assetInfo{GetAssetInfoUnsafe(guid)};
+            if (change.Path.parent_path() != GetAssetDirectoryPath(assetInfo.GetCategory()))
+            {
+                continue;
+            }
+
+            modifiedAssetInfos.emplace_back(assetInfo);
+        }
+
+        return modifiedAssetInfos;
+    }
+
     TypelessAssetDescMap& AssetMonitor::GetDescMap(const EAssetCategory assetType)
     {
         TypelessAssetDescMap* ptr{nullptr};
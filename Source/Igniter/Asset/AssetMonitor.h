@@ -2,6 +2,13 @@
 #include "Igniter/Igniter.h"
 #include "Igniter/Core/Serialization.h"
 #include "Igniter/Asset/Common.h"
+#include "Igniter/Asset/AssetMetadataIndex.h"
+
+namespace ig
+{
+    class AssetPackage;
+    struct FileChange;
+}
 
 namespace ig::details
 {
@@ -89,8 +96,30 @@ namespace ig::details
     {
         using VirtualPathGuidTable = UnorderedMap<U64, Guid>;
 
+        struct MetadataFileState
+        {
+        public:
+            U64 LastWriteTime = 0;
+            U64 FileSize = 0;
+        };
+
+    public:
+        /* 마지막 에셋 디렉터리 파싱의 통계. 콜드/웜 스타트 측정에 사용 된다. */
+        struct ParseStatistics
+        {
+        public:
+            Size NumCandidates = 0;
+            Size NumRejected = 0;
+            Size NumIndexHits = 0;
+            Size NumReparsed = 0;
+            bool bIndexRebuilt = false;
+            Size ElapsedMilliseconds = 0;
+        };
+
     public:
         AssetMonitor();
+        /* Engine 인스턴스 없이(Headless) 사용 하는 경우 */
+        explicit AssetMonitor(tf::Executor& taskExecutor);
         AssetMonitor(const AssetMonitor&) = delete;
         AssetMonitor(AssetMonitor&&) = delete;
         ~AssetMonitor();
@@ -174,8 +203,23 @@ namespace ig::details
         void Remove(const Guid& guid, const bool bShouldExpired = true);
         void SaveAllChanges();
 
+        /* 패키지에만 존재하는 에셋을 등록. 이미 존재하는(Loose) 에셋이 패키지에 포함되어 있더라도, Loose 에셋이 우선 된다. */
+        Size MountPackedAssets(const AssetPackage& package);
+        void UnmountPackedAssets();
+        [[nodiscard]] bool IsPackedOnly(const Guid& guid) const;
+        /*
+         * 패키지에만 존재하는 에셋의 데이터. Loose 에셋(ex. 패키지 마운트 이후 재임포트 된 에셋)은 패키지에 포함 되어 있더라도
+         * 패키지의 오래된 데이터 대신 Loose 파일을 읽어야 하므로 빈 span 을 반환 한다.
+         */
+        [[nodiscard]] std::span<const U8> FindPackedAssetData(const AssetPackage& package, const Guid& guid) const;
+
         [[nodiscard]] Vector<AssetInfo> TakeSnapshots(const EAssetCategory filter) const;
 
+        /* 에셋 디렉터리의 변경 배치로 부터, 디스크 상 데이터가 변경 된 에셋 들을 찾는다. */
+        [[nodiscard]] Vector<AssetInfo> ResolveModifiedAssets(const std::span<const FileChange> changes) const;
+
+        [[nodiscard]] const ParseStatistics& GetParseStatistics() const noexcept { return parseStatistics; }
+
     private:
         void InitAssetDescTables();
         void InitVirtualPathGuidTables();
@@ -231,12 +275,20 @@ namespace ig::details
 
         void ReflectExpiredToFilesUnsafe();
         void ReflectRemainedToFilesUnsafe();
+        void SaveMetadataIndexUnsafe() const;
         static void CleanupOrphanFiles();
 
     private:
+        tf::Executor& taskExecutor;
         mutable SharedMutex mutex;
         Vector<std::pair<EAssetCategory, VirtualPathGuidTable>> virtualPathGuidTables;
         Vector<std::pair<EAssetCategory, Ptr<TypelessAssetDescMap>>> guidDescTables;
         UnorderedMap<Guid, AssetInfo> expiredAssetInfos;
+        UnorderedSet<Guid> packedOnlyGuids;
+        /* 메타데이터를 파싱(또는 기록) 한 시점의 파일 상태. 인덱스에는 저장 시점이 아닌 이 상태가 기록 된다. */
+        UnorderedMap<Guid, MetadataFileState> metadataFileStates;
+        /* 거부 된 메타데이터. 인덱스에 함께 기록 되어 웜 스타트 시 다시 파싱 되지 않는다. */
+        Vector<AssetMetadataIndex::Record> rejectedMetadataRecords;
+        ParseStatistics parseStatistics{};
     };
 } // namespace ig::details
@@ -0,0 +1,218 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Core/Memory.h"
+#include "Igniter/Core/Timer.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/AssetPackage.h"
+
+IG_DECLARE_LOG_CATEGORY(AssetPackageLog);
+
+IG_DEFINE_LOG_CATEGORY(AssetPackageLog);
+
+namespace ig
+{
+    bool AssetPackage::Mount(const Path& packagePath)
+    {
+        Unmount();
+        if (!mappedFile.Open(packagePath))
+        {
+            IG_LOG(AssetPackageLog, Error, "Failed to map asset package {}.", packagePath.string());
+            return false;
+        }
+
+        if (mappedFile.GetSize() < sizeof(Header))
+        {
+            IG_LOG(AssetPackageLog, Error, "Asset package {} is truncated.", packagePath.string());
+            Unmount();
+            return false;
+        }
+
+        const Header& header{*reinterpret_cast<const Header*>(mappedFile.GetData())};
+        if (header.Magic != Header::kMagic || header.Version != Header::kVersion)
+        {
+            IG_LOG(AssetPackageLog, Error, "Asset package {} has invalid magic or version.", packagePath.string());
+            Unmount();
+            return false;
+        }
+
+        if (header.TocOffset % kTocAlignment != 0 || header.TocOffset + sizeof(TocEntry) * header.NumEntries > mappedFile.GetSize())
+        {
+            IG_LOG(AssetPackageLog, Error, "Asset package {} has invalid table of contents.", packagePath.string());
+            Unmount();
+            return false;
+        }
+
+        toc = std::span<const TocEntry>{reinterpret_cast<const TocEntry*>(mappedFile.GetData() + header.TocOffset), header.NumEntries};
+        guidEntryTable.reserve(toc.size());
+        for (Index entryIdx = 0; entryIdx < toc.size(); ++entryIdx)
+        {
+            const TocEntry& entry{toc[entryIdx]};
+            if (entry.Offset + entry.ByteSize > mappedFile.GetSize() || entry.MetadataOffset + entry.MetadataSize > mappedFile.GetSize())
+            {
+                IG_LOG(AssetPackageLog, Warning, "Asset package entry {} is out of range. Ignored.", Guid{entry.Guid});
+                continue;
+            }
+
+            guidEntryTable[Guid{entry.Guid}] = entryIdx;
+        }
+
+        path = packagePath;
+        IG_LOG(AssetPackageLog, Info, "Asset package {} mounted. ({} assets)", path.string(), guidEntryTable.size());
+        return true;
+    }
+
+    void AssetPackage::Unmount()
+    {
+        guidEntryTable.clear();
+        toc = {};
+        mappedFile.Close();
+        path.clear();
+    }
+
+    std::span<const U8> AssetPackage::GetAssetData(const Guid& guid) const
+    {
+        const auto itr = guidEntryTable.find(guid);
+        if (itr == guidEntryTable.cend())
+        {
+            return {};
+        }
+
+        const TocEntry& entry{toc[itr->second]};
+        IG_CHECK(entry.Compression == EAssetPackageCompression::None);
+        return mappedFile.GetSpan(entry.Offset, entry.ByteSize);
+    }
+
+    Json AssetPackage::GetSerializedMetadata(const TocEntry& entry) const
+    {
+        const std::span<const U8> payload{mappedFile.GetSpan(entry.MetadataOffset, entry.MetadataSize)};
+        const Json serializedMetadata{Json::from_msgpack(payload.begin(), payload.end(), true, false)};
+        return serializedMetadata.is_discarded() ? Json{} : serializedMetadata;
+    }
+
+    Result<AssetPackage::BuildReport, EAssetPackageBuildStatus> AssetPackage::Build(const Path& packagePath)
+    {
+        struct PackCandidate
+        {
+            TocEntry Entry{};
+            Path AssetPath{};
+            std::vector<U8> Metadata{};
+        };
+
+        TempTimer buildTimer{};
+        buildTimer.Begin();
+
+        BuildReport report{};
+        Vector<PackCandidate> candidates{};
+        for (const auto category : magic_enum::enum_values<EAssetCategory>())
+        {
+            if (category == EAssetCategory::Unknown || !fs::exists(GetAssetDirectoryPath(category)))
+            {
+                continue;
+            }
+
+            for (const fs::directory_entry& dirEntry : fs::directory_iterator{GetAssetDirectoryPath(category)})
+            {
+                if (!dirEntry.is_regular_file() || dirEntry.path().has_extension())
+                {
+                    continue;
+                }
+
+                const Guid guid{dirEntry.path().filename().string()};
+                const Path metadataPath{MakeAssetMetadataPath(category, guid)};
+                if (!guid.isValid() || !fs::exists(metadataPath))
+                {
+                    ++report.NumSkippedAssets;
+                    continue;
+                }
+
+                const Json serializedMetadata{LoadJsonFromFile(metadataPath)};
+                if (serializedMetadata.empty())
+                {
+                    IG_LOG(AssetPackageLog, Warning, "Asset {} skipped. Failed to parse metadata.", dirEntry.path().string());
+                    ++report.NumSkippedAssets;
+                    continue;
+                }
+
+                PackCandidate& candidate{candidates.emplace_back()};
+                candidate.Entry.Guid = guid.bytes();
+                candidate.Entry.Category = category;
+                candidate.Entry.Compression = EAssetPackageCompression::None;
+                candidate.Entry.ByteSize = dirEntry.file_size();
+                candidate.Entry.UncompressedSize = candidate.Entry.ByteSize;
+                candidate.AssetPath = dirEntry.path();
+                candidate.Metadata = Json::to_msgpack(serializedMetadata);
+            }
+        }
+
+        /* 모든 오프셋을 미리 계산한 뒤, 파일에 순차적으로 기록 */
+        const Header header{
+            .NumEntries = static_cast<U32>(candidates.size()),
+            .TocOffset = AlignTo(sizeof(Header), kTocAlignment),
+            .DataOffset = AlignTo(AlignTo(sizeof(Header), kTocAlignment) + sizeof(TocEntry) * candidates.size(), kDataAlignment)
+        };
+
+        U64 offset = header.DataOffset;
+        for (PackCandidate& candidate : candidates)
+        {
+            candidate.Entry.Offset = offset;
+            offset = AlignTo(offset + candidate.Entry.ByteSize, kDataAlignment);
+        }
+
+        for (PackCandidate& candidate : candidates)
+        {
+            candidate.Entry.MetadataOffset = offset;
+            candidate.Entry.MetadataSize = static_cast<U32>(candidate.Metadata.size());
+            offset += candidate.Metadata.size();
+        }
+
+        std::ofstream packageStream{packagePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc};
+        if (!packageStream.is_open())
+        {
+            return MakeFail<BuildReport, EAssetPackageBuildStatus::FailedOpenPackageFile>();
+        }
+
+        const auto kWritePadding = [&packageStream](const U64 targetOffset)
+        {
+            constexpr U8 kZeros[kDataAlignment]{};
+            while (static_cast<U64>(packageStream.tellp()) < targetOffset)
+            {
+                const U64 paddingSize = std::min<U64>(targetOffset - static_cast<U64>(packageStream.tellp()), kDataAlignment);
+                packageStream.write(reinterpret_cast<const char*>(kZeros), paddingSize);
+            }
+        };
+
+        packageStream.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        kWritePadding(header.TocOffset);
+        for (const PackCandidate& candidate : candidates)
+        {
+            packageStream.write(reinterpret_cast<const char*>(&candidate.Entry), sizeof(TocEntry));
+        }
+
+        for (const PackCandidate& candidate : candidates)
+        {
+            kWritePadding(candidate.Entry.Offset);
+            const Vector<U8> assetBlob{LoadBlobFromFile(candidate.AssetPath)};
+            IG_CHECK(assetBlob.size() == candidate.Entry.ByteSize);
+            packageStream.write(reinterpret_cast<const char*>(assetBlob.data()), assetBlob.size());
+        }
+
+        for (const PackCandidate& candidate : candidates)
+        {
+            kWritePadding(candidate.Entry.MetadataOffset);
+            packageStream.write(reinterpret_cast<const char*>(candidate.Metadata.data()), candidate.Metadata.size());
+        }
+
+        if (!packageStream.good())
+        {
+            return MakeFail<BuildReport, EAssetPackageBuildStatus::FailedWritePackageFile>();
+        }
+
+        report.NumPackedAssets = candidates.size();
+        report.PackageSize = static_cast<Bytes>(packageStream.tellp());
+        packageStream.close();
+
+        IG_LOG(AssetPackageLog, Info, "Asset package {} built in {} ms. (Packed: {}, Skipped: {}, Size: {:.2f} MB)",
+            packagePath.string(), buildTimer.End(), report.NumPackedAssets, report.NumSkippedAssets, BytesToMegaBytes(report.PackageSize));
+        return MakeSuccess<BuildReport, EAssetPackageBuildStatus>(report);
+    }
+} // namespace ig
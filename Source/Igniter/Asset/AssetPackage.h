@@ -0,0 +1,106 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Result.h"
+#include "Igniter/Core/GuidBytes.h"
+#include "Igniter/Filesystem/MappedFile.h"
+#include "Igniter/Asset/Common.h"
+
+namespace ig
+{
+    enum class EAssetPackageCompression : U32
+    {
+        None,
+    };
+
+    enum class EAssetPackageBuildStatus
+    {
+        Success,
+        FailedOpenPackageFile,
+        FailedWritePackageFile,
+    };
+
+    /*
+     * #sy_note 에셋 패키지
+     * 에셋 디렉터리의 'Assets\{Type}\{GUID}' 파일과 메타데이터를 하나의 파일로 묶은 읽기 전용 아카이브.
+     * 마운트 된 패키지는 메모리 매핑 되며, 에셋 데이터는 매핑된 메모리에서 직접 읽는다.
+     *
+     * Binary Layout
+     * Header => [0, sizeof(Header))
+     * TableOfContents => [Header::TocOffset, Header::TocOffset + sizeof(TocEntry) * Header::NumEntries), aligned to kTocAlignment
+     * Asset Data => [TocEntry::Offset, TocEntry::Offset + TocEntry::ByteSize), aligned to kDataAlignment
+     * Metadata(MessagePack) => [TocEntry::MetadataOffset, TocEntry::MetadataOffset + TocEntry::MetadataSize)
+     */
+    class AssetPackage final
+    {
+    public:
+        constexpr static Size kTocAlignment = 64;
+        constexpr static Size kDataAlignment = 256;
+
+        struct Header
+        {
+        public:
+            constexpr static U32 kMagic = 0x4B504749; /* 'IGPK' */
+            constexpr static U32 kVersion = 1;
+
+        public:
+            U32 Magic = kMagic;
+            U32 Version = kVersion;
+            U32 NumEntries = 0;
+            U32 Padding = 0;
+            U64 TocOffset = 0;
+            U64 DataOffset = 0;
+        };
+
+        struct alignas(kTocAlignment) TocEntry
+        {
+        public:
+            GuidBytes Guid{};
+            EAssetCategory Category = EAssetCategory::Unknown;
+            EAssetPackageCompression Compression = EAssetPackageCompression::None;
+            U64 Offset = 0;
+            U64 ByteSize = 0;
+            U64 UncompressedSize = 0;
+            U64 MetadataOffset = 0;
+            U32 MetadataSize = 0;
+        };
+        static_assert(sizeof(TocEntry) == kTocAlignment);
+
+        struct BuildReport
+        {
+        public:
+            Size NumPackedAssets = 0;
+            Size NumSkippedAssets = 0;
+            Bytes PackageSize = 0;
+        };
+
+    public:
+        AssetPackage() = default;
+        AssetPackage(const AssetPackage&) = delete;
+        AssetPackage(AssetPackage&&) noexcept = delete;
+        ~AssetPackage() = default;
+
+        AssetPackage& operator=(const AssetPackage&) = delete;
+        AssetPackage& operator=(AssetPackage&&) noexcept = delete;
+
+        [[nodiscard]] bool Mount(const Path& packagePath);
+        void Unmount();
+
+        [[nodiscard]] bool IsMounted() const noexcept { return mappedFile.IsOpened(); }
+        [[nodiscard]] const Path& GetPath() const noexcept { return path; }
+        [[nodiscard]] std::span<const TocEntry> GetTableOfContents() const noexcept { return toc; }
+
+        [[nodiscard]] bool Contains(const Guid& guid) const { return guidEntryTable.contains(guid); }
+        /* 반환된 span은 Unmount 전까지 유효 */
+        [[nodiscard]] std::span<const U8> GetAssetData(const Guid& guid) const;
+        [[nodiscard]] Json GetSerializedMetadata(const TocEntry& entry) const;
+
+        /* 현재 에셋 디렉터리로 부터 패키지를 생성 (Packer) */
+        static Result<BuildReport, EAssetPackageBuildStatus> Build(const Path& packagePath);
+
+    private:
+        Path path{};
+        MappedFile mappedFile{};
+        std::span<const TocEntry> toc{};
+        UnorderedMap<Guid, Index> guidEntryTable{};
+    };
+} // namespace ig
@@ -2,6 +2,7 @@
 #include "Igniter/Core/Engine.h"
 #include "Igniter/Core/Json.h"
 #include "Igniter/Audio/AudioSystem.h"
+#include "Igniter/Asset/AssetManager.h"
 #include "Igniter/Asset/AudioClip.h"
 
 namespace ig
@@ -9,12 +10,26 @@ namespace ig
     Json& AudioClipLoadDesc::Serialize(Json& archive) const
     {
         IG_SERIALIZE_TO_JSON(AudioClipLoadDesc, archive, Extension);
+        IG_SERIALIZE_TO_JSON(AudioClipLoadDesc, archive, LoadMode);
+        IG_SERIALIZE_TO_JSON(AudioClipLoadDesc, archive, SampleRate);
+        IG_SERIALIZE_TO_JSON(AudioClipLoadDesc, archive, NumChannels);
+        IG_SERIALIZE_TO_JSON(AudioClipLoadDesc, archive, DurationSeconds);
+        IG_SERIALIZE_TO_JSON(AudioClipLoadDesc, archive, bIsSoundBank);
+        IG_SERIALIZE_TO_JSON(AudioClipLoadDesc, archive, SoundBankGuid);
+        IG_SERIALIZE_TO_JSON(AudioClipLoadDesc, archive, SoundBankEntryIdx);
         return archive;
     }
 
     const Json& AudioClipLoadDesc::Deserialize(const Json& archive)
     {
         IG_DESERIALIZE_FROM_JSON(AudioClipLoadDesc, archive, Extension);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(AudioClipLoadDesc, archive, LoadMode, EAudioClipLoadMode::Decompressed);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(AudioClipLoadDesc, archive, SampleRate, 0);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(AudioClipLoadDesc, archive, NumChannels, 0);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(AudioClipLoadDesc, archive, DurationSeconds, 0.f);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(AudioClipLoadDesc, archive, bIsSoundBank, false);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(AudioClipLoadDesc, archive, SoundBankGuid, Guid{});
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(AudioClipLoadDesc, archive, SoundBankEntryIdx, 0);
         return archive;
     }
 
@@ -23,9 +38,29 @@ namespace ig
         , audioHandle(newAudioHandle)
     {}
 
+    AudioClip::AudioClip(const Desc& snapshot, Vector<U8> soundBankData)
+        : snapshot(snapshot)
+        , soundBankData(std::move(soundBankData))
+    {
+        IG_CHECK(snapshot.LoadDescriptor.bIsSoundBank);
+    }
+
+    AudioClip::AudioClip(AssetManager& assetManager, const Desc& snapshot, const Handle<Audio> newAudioHandle, const Handle<AudioClip> soundBank)
+        : snapshot(snapshot)
+        , audioHandle(newAudioHandle)
+        , assetManager(&assetManager)
+        , soundBank(soundBank)
+    {
+        IG_CHECK(snapshot.LoadDescriptor.IsInSoundBank());
+        IG_CHECK(soundBank);
+    }
+
     AudioClip::AudioClip(AudioClip&& other) noexcept
         : snapshot(other.snapshot)
         , audioHandle(std::exchange(other.audioHandle, {}))
+        , soundBankData(std::move(other.soundBankData))
+        , assetManager(std::exchange(other.assetManager, nullptr))
+        , soundBank(std::exchange(other.soundBank, {}))
     {}
 
     AudioClip::~AudioClip()
@@ -38,9 +73,36 @@ namespace ig
         Destroy();
         snapshot = other.snapshot;
         audioHandle = std::exchange(other.audioHandle, {});
+        soundBankData = std::move(other.soundBankData);
+        assetManager = std::exchange(other.assetManager, nullptr);
+        soundBank = std::exchange(other.soundBank, {});
         return *this;
     }
 
+    Bytes AudioClip::GetResidentSize() const
+    {
+        const AudioClipLoadDesc& loadDesc{snapshot.LoadDescriptor};
+        if (loadDesc.IsInSoundBank())
+        {
+            const AudioClip* soundBankPtr = assetManager != nullptr ? assetManager->Lookup(soundBank) : nullptr;
+            return sizeof(AudioClip) + (soundBankPtr != nullptr ? soundBankPtr->GetResidentSize() : 0);
+        }
+
+        if (loadDesc.bIsSoundBank)
+        {
+            return sizeof(AudioClip) + soundBankData.size();
+        }
+
+        /* 스트리밍 되는 클립은 재생 중에만 디코딩 버퍼를 가진다. 디코딩 된 클립은 PCM16 으로 상주 한다. */
+        if (loadDesc.LoadMode == EAudioClipLoadMode::Streamed)
+        {
+            return sizeof(AudioClip);
+        }
+
+        return sizeof(AudioClip) +
+            static_cast<Bytes>(static_cast<F64>(loadDesc.SampleRate) * loadDesc.NumChannels * loadDesc.DurationSeconds) * sizeof(S16);
+    }
+
     void AudioClip::Destroy()
     {
         if (audioHandle)
@@ -48,5 +110,15 @@ namespace ig
             Engine::GetAudioSystem().Destroy(audioHandle);
             audioHandle = {};
         }
+
+        /* 클립의 사운드가 먼저 해제 된 이후에 뱅크의 레퍼런스를 반환 한다. */
+        if (soundBank)
+        {
+            IG_CHECK(assetManager != nullptr);
+            assetManager->Unload(soundBank);
+            soundBank = {};
+        }
+        soundBankData.clear();
+        assetManager = nullptr;
     }
 }
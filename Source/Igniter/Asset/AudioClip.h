@@ -3,9 +3,39 @@
 
 namespace ig
 {
+    enum class EAudioClipEncoding : U8
+    {
+        /* 원본 파일을 그대로 복사 */
+        Source,
+        /* 16 비트 PCM 으로 디코딩 후 IMA ADPCM(4:1) 으로 압축 */
+        ImaAdpcm,
+    };
+
+    enum class EAudioClipLoadMode : U8
+    {
+        /* 클립의 길이(StreamingThresholdSeconds)에 따라 Decompressed 또는 Streamed 중 하나를 선택 (임포트 시 에만 유효) */
+        Auto,
+        /* 로드 시 PCM 으로 디코딩 되어 메모리에 상주 */
+        Decompressed,
+        /* 재생 중에 조금씩 디코딩 */
+        Streamed,
+    };
+
     struct AudioClipImportDesc
     {
         std::string_view Path;
+        EAudioClipEncoding Encoding = EAudioClipEncoding::ImaAdpcm;
+        EAudioClipLoadMode LoadMode = EAudioClipLoadMode::Auto;
+        float StreamingThresholdSeconds = 10.f;
+    };
+
+    /* 짧은 효과음 들을 하나의 사운드 뱅크로 묶어 임포트 (SoundBank) */
+    struct SoundBankImportDesc
+    {
+        std::string BankName;
+        EAudioClipEncoding Encoding = EAudioClipEncoding::ImaAdpcm;
+        EAudioClipLoadMode LoadMode = EAudioClipLoadMode::Auto;
+        float StreamingThresholdSeconds = 10.f;
     };
 
     struct AudioClipLoadDesc
@@ -14,11 +44,24 @@ namespace ig
         Json& Serialize(Json& archive) const;
         const Json& Deserialize(const Json& archive);
 
+        [[nodiscard]] bool IsInSoundBank() const noexcept { return SoundBankGuid.isValid(); }
+
     public:
         std::string Extension;
+        EAudioClipLoadMode LoadMode = EAudioClipLoadMode::Decompressed;
+        U32 SampleRate = 0;
+        U16 NumChannels = 0;
+        float DurationSeconds = 0.f;
+
+        /* 사운드 뱅크 에셋 인 경우 true; 뱅크는 재생 할 수 없으며, 포함 된 클립들의 데이터를 메모리에 유지 한다. */
+        bool bIsSoundBank = false;
+        /* 사운드 뱅크에 포함된 클립 인 경우, 뱅크 에셋의 Guid 와 Offset Table 의 인덱스 */
+        Guid SoundBankGuid{};
+        U32 SoundBankEntryIdx = 0;
     };
 
     class Audio;
+    class AssetManager;
 
     class AudioClip
     {
@@ -29,6 +72,10 @@ namespace ig
 
     public:
         AudioClip(const Desc& snapshot, const Handle<Audio> newAudioHandle);
+        /* 사운드 뱅크 */
+        AudioClip(const Desc& snapshot, Vector<U8> soundBankData);
+        /* 사운드 뱅크에 포함 된 클립; 클립이 해제 될 때 까지 뱅크의 레퍼런스를 유지 한다. */
+        AudioClip(AssetManager& assetManager, const Desc& snapshot, const Handle<Audio> newAudioHandle, const Handle<AudioClip> soundBank);
         AudioClip(const AudioClip&) = delete;
         AudioClip(AudioClip&& other) noexcept;
         ~AudioClip();
@@ -38,6 +85,9 @@ namespace ig
 
         [[nodiscard]] const Desc& GetSnapshot() const noexcept { return snapshot; }
         [[nodiscard]] Handle<Audio> GetAudio() const noexcept { return audioHandle; }
+        [[nodiscard]] std::span<const U8> GetSoundBankData() const noexcept { return soundBankData; }
+        /* 디코딩 된 PCM 또는 사운드 뱅크 데이터의 크기. 뱅크에 포함 된 클립의 경우 참조 중인 뱅크의 크기. */
+        [[nodiscard]] Bytes GetResidentSize() const;
 
     private:
         void Destroy();
@@ -45,5 +95,9 @@ namespace ig
     private:
         Desc snapshot{};
         Handle<Audio> audioHandle;
+        Vector<U8> soundBankData;
+
+        AssetManager* assetManager{nullptr};
+        Handle<AudioClip> soundBank{};
     };
 }
@@ -1,41 +1,295 @@
 #include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
 #include "Igniter/Core/Serialization.h"
 #include "Igniter/Filesystem/Utils.h"
 #include "Igniter/Asset/Common.h"
+#include "Igniter/Asset/ImaAdpcmEncoder.h"
+#include "Igniter/Asset/SoundBank.h"
 #include "Igniter/Asset/AudioClipImporter.h"
 
+IG_DECLARE_LOG_CATEGORY(AudioClipImporterLog);
+
+IG_DEFINE_LOG_CATEGORY(AudioClipImporterLog);
 
 namespace ig
 {
+    namespace
+    {
+        struct TranscodedAudioClip
+        {
+        public:
+            Vector<U8> Data;
+            AudioClipLoadDesc LoadDesc;
+        };
+
+        /* FMOD 가 디코딩 한 샘플을 16 비트 PCM 으로 변환 한다. FMOD_SOUND_FORMAT_PCM8 은 부호 있는 8 비트 이다. */
+        bool AppendAsPcm16(const FMOD_SOUND_FORMAT format, const std::span<const U8> decoded, Vector<S16>& samples)
+        {
+            switch (format)
+            {
+            case FMOD_SOUND_FORMAT_PCM8:
+                for (const U8 sample : decoded)
+                {
+                    samples.emplace_back(static_cast<S16>(static_cast<S8>(sample) * 256));
+                }
+                return true;
+            case FMOD_SOUND_FORMAT_PCM16:
+                for (Size offset = 0; offset + 2 <= decoded.size(); offset += 2)
+                {
+                    S16 sample = 0;
+                    std::memcpy(&sample, decoded.data() + offset, sizeof(S16));
+                    samples.emplace_back(sample);
+                }
+                return true;
+            case FMOD_SOUND_FORMAT_PCM24:
+                for (Size offset = 0; offset + 3 <= decoded.size(); offset += 3)
+                {
+                    samples.emplace_back(static_cast<S16>(decoded[offset + 1] | (decoded[offset + 2] << 8)));
+                }
+                return true;
+            case FMOD_SOUND_FORMAT_PCM32:
+                for (Size offset = 0; offset + 4 <= decoded.size(); offset += 4)
+                {
+                    S32 sample = 0;
+                    std::memcpy(&sample, decoded.data() + offset, sizeof(S32));
+                    samples.emplace_back(static_cast<S16>(sample >> 16));
+                }
+                return true;
+            case FMOD_SOUND_FORMAT_PCMFLOAT:
+                for (Size offset = 0; offset + 4 <= decoded.size(); offset += 4)
+                {
+                    float sample = 0.f;
+                    std::memcpy(&sample, decoded.data() + offset, sizeof(float));
+                    samples.emplace_back(static_cast<S16>(std::lround(std::clamp(sample, -1.f, 1.f) * 32767.f)));
+                }
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        EAudioClipImportError Transcode(FMOD::System& decoder, const Path& resPath, const EAudioClipEncoding encoding, const EAudioClipLoadMode loadMode,
+            const float streamingThresholdSeconds, TranscodedAudioClip& transcoded)
+        {
+            FMOD::Sound* sound = nullptr;
+            if (const FMOD_RESULT result = decoder.createSound(resPath.string().c_str(), FMOD_OPENONLY | FMOD_ACCURATETIME, nullptr, &sound);
+                result != FMOD_OK)
+            {
+                IG_LOG(AudioClipImporterLog, Error, "Failed to open {}: {}", resPath.string(), FMOD_ErrorString(result));
+                return EAudioClipImportError::FailedToDecodeAudioFile;
+            }
+            IG_CHECK(sound != nullptr);
+
+            FMOD_SOUND_FORMAT format = FMOD_SOUND_FORMAT_NONE;
+            int numChannels = 0;
+            float sampleRate = 0.f;
+            unsigned int numFrames = 0;
+            if (sound->getFormat(nullptr, &format, &numChannels, nullptr) != FMOD_OK || sound->getDefaults(&sampleRate, nullptr) != FMOD_OK ||
+                sound->getLength(&numFrames, FMOD_TIMEUNIT_PCM) != FMOD_OK || numChannels <= 0 || sampleRate <= 0.f)
+            {
+                sound->release();
+                return EAudioClipImportError::FailedToDecodeAudioFile;
+            }
+
+            transcoded = {};
+            transcoded.LoadDesc.SampleRate = static_cast<U32>(sampleRate);
+            transcoded.LoadDesc.NumChannels = static_cast<U16>(numChannels);
+            transcoded.LoadDesc.DurationSeconds = static_cast<float>(numFrames) / sampleRate;
+            transcoded.LoadDesc.LoadMode = loadMode;
+            if (loadMode == EAudioClipLoadMode::Auto)
+            {
+                transcoded.LoadDesc.LoadMode = transcoded.LoadDesc.DurationSeconds >= streamingThresholdSeconds ? EAudioClipLoadMode::Streamed :
+                                                                                                                 EAudioClipLoadMode::Decompressed;
+            }
+
+            if (encoding == EAudioClipEncoding::Source)
+            {
+                sound->release();
+                transcoded.Data = LoadBlobFromFile(resPath);
+                if (transcoded.Data.empty())
+                {
+                    return EAudioClipImportError::FailedToCopyAudioFile;
+                }
+
+                transcoded.LoadDesc.Extension = resPath.extension().string();
+                return EAudioClipImportError::Success;
+            }
+
+            IG_CHECK(encoding == EAudioClipEncoding::ImaAdpcm);
+            Vector<S16> samples{};
+            samples.reserve(static_cast<Size>(numFrames) * numChannels);
+
+            /* 전체 파일을 한번에 디코딩 하지 않고, 고정 크기 버퍼 단위로 읽어 들인다. */
+            constexpr Size kDecodeChunkSize = 64 * 1024;
+            Vector<U8> decodeChunk(kDecodeChunkSize);
+            FMOD_RESULT readResult = FMOD_OK;
+            while (readResult == FMOD_OK)
+            {
+                unsigned int numReadBytes = 0;
+                readResult = sound->readData(decodeChunk.data(), static_cast<unsigned int>(decodeChunk.size()), &numReadBytes);
+                if (readResult != FMOD_OK && readResult != FMOD_ERR_FILE_EOF)
+                {
+                    IG_LOG(AudioClipImporterLog, Error, "Failed to decode {}: {}", resPath.string(), FMOD_ErrorString(readResult));
+                    sound->release();
+                    return EAudioClipImportError::FailedToDecodeAudioFile;
+                }
+
+                if (!AppendAsPcm16(format, std::span<const U8>{decodeChunk.data(), numReadBytes}, samples))
+                {
+                    sound->release();
+                    return EAudioClipImportError::UnsupportedSampleFormat;
+                }
+            }
+            sound->release();
+
+            /* 채널 수의 배수가 아닌 꼬리 샘플(잘린 파일)은 버린다. */
+            samples.resize(samples.size() - samples.size() % numChannels);
+            transcoded.Data = details::ImaAdpcmEncoder::EncodeWave(samples, transcoded.LoadDesc.SampleRate, transcoded.LoadDesc.NumChannels);
+            transcoded.LoadDesc.Extension = ".wav";
+            return EAudioClipImportError::Success;
+        }
+
+        Result<AudioClip::Desc, EAudioClipImportError> MakeTranscodeFail(const EAudioClipImportError status)
+        {
+            switch (status)
+            {
+            case EAudioClipImportError::FailedToCopyAudioFile:
+                return MakeFail<AudioClip::Desc, EAudioClipImportError::FailedToCopyAudioFile>();
+            case EAudioClipImportError::UnsupportedSampleFormat:
+                return MakeFail<AudioClip::Desc, EAudioClipImportError::UnsupportedSampleFormat>();
+            default:
+                return MakeFail<AudioClip::Desc, EAudioClipImportError::FailedToDecodeAudioFile>();
+            }
+        }
+
+        /* data 가 비어 있다면 에셋 파일은 자리 표시자로 저장 된다. (사운드 뱅크에 포함 된 클립) */
+        Result<AudioClip::Desc, EAudioClipImportError> ExportAudioClip(const AssetInfo& assetInfo, const AudioClipLoadDesc& loadDesc,
+            const std::span<const U8> data)
+        {
+            Json assetMetadata{};
+            assetMetadata << assetInfo << loadDesc;
+            if (!SaveJsonToFile(MakeAssetMetadataPath(EAssetCategory::Audio, assetInfo.GetGuid()), assetMetadata))
+            {
+                return MakeFail<AudioClip::Desc, EAudioClipImportError::FailedToSaveMetadata>();
+            }
+
+            const Path assetPath = MakeAssetPath(EAssetCategory::Audio, assetInfo.GetGuid());
+            const bool bSaved = data.empty() ? SaveBlobToFile(assetPath, std::array<U8, 1>{0}) : SaveBlobToFile(assetPath, data);
+            if (!bSaved)
+            {
+                return MakeFail<AudioClip::Desc, EAudioClipImportError::FailedToCopyAudioFile>();
+            }
+
+            IG_CHECK(assetInfo.IsValid());
+            return MakeSuccess<AudioClip::Desc, EAudioClipImportError>(assetInfo, loadDesc);
+        }
+    } // namespace
+
+    AudioClipImporter::AudioClipImporter()
+    {
+        FMOD_RESULT result = FMOD::System_Create(&decoder);
+        if (result != FMOD_OK)
+        {
+            IG_LOG(AudioClipImporterLog, Fatal, "Failed to create FMOD decoder: {}", FMOD_ErrorString(result));
+        }
+
+        /* 실시간 출력 없이 readData 로 디코딩 만을 수행 한다. */
+        result = decoder->setOutput(FMOD_OUTPUTTYPE_NOSOUND_NRT);
+        if (result != FMOD_OK)
+        {
+            IG_LOG(AudioClipImporterLog, Fatal, "Failed to setup FMOD decoder output: {}", FMOD_ErrorString(result));
+        }
+
+        result = decoder->init(1, FMOD_INIT_NORMAL, nullptr);
+        if (result != FMOD_OK)
+        {
+            IG_LOG(AudioClipImporterLog, Fatal, "Failed to initialize FMOD decoder: {}", FMOD_ErrorString(result));
+        }
+    }
+
+    AudioClipImporter::~AudioClipImporter()
+    {
+        if (decoder != nullptr)
+        {
+            decoder->release();
+        }
+    }
+
     Result<AudioClip::Desc, EAudioClipImportError> AudioClipImporter::Import(const AudioClip::ImportDesc& desc)
     {
+        IG_CHECK(decoder != nullptr);
         const Path resPath{desc.Path};
         if (!fs::exists(resPath))
         {
             return MakeFail<AudioClip::Desc, EAudioClipImportError::FileDoesNotExist>();
         }
 
-        const Path fileExtension = resPath.extension();
+        TranscodedAudioClip transcoded{};
+        if (const EAudioClipImportError status = Transcode(*decoder, resPath, desc.Encoding, desc.LoadMode, desc.StreamingThresholdSeconds, transcoded);
+            status != EAudioClipImportError::Success)
+        {
+            return MakeTranscodeFail(status);
+        }
+
         const AssetInfo newAssetInfo{MakeVirtualPathPreferred(resPath.filename().replace_extension("").string()), EAssetCategory::Audio};
+        IG_LOG(AudioClipImporterLog, Info, "{}: {:.2f}s, {}Hz, {}ch, {} bytes ({}).", resPath.string(), transcoded.LoadDesc.DurationSeconds,
+            transcoded.LoadDesc.SampleRate, transcoded.LoadDesc.NumChannels, transcoded.Data.size(), transcoded.LoadDesc.LoadMode);
+        return ExportAudioClip(newAssetInfo, transcoded.LoadDesc, transcoded.Data);
+    }
 
-        const AudioClipLoadDesc newLoadDesc{
-            .Extension = fileExtension.string(),
-        };
+    SoundBankImportResult AudioClipImporter::ImportSoundBank(const std::span<const std::string> resPaths, const SoundBankImportDesc& desc)
+    {
+        IG_CHECK(decoder != nullptr);
+        SoundBankImportResult result{};
+        result.Clips.resize(resPaths.size());
 
-        const Path newMetadataPath = MakeAssetMetadataPath(EAssetCategory::Audio, newAssetInfo.GetGuid());
-        Json newAssetMetadata{};
-        newAssetMetadata << newAssetInfo << newLoadDesc;
-        if (!SaveJsonToFile(newMetadataPath, newAssetMetadata))
+        Vector<Vector<U8>> clipData{};
+        clipData.reserve(resPaths.size());
+        for (Index clipIdx = 0; clipIdx < resPaths.size(); ++clipIdx)
         {
-            return MakeFail<AudioClip::Desc, EAudioClipImportError::FailedToSaveMetadata>();
+            SoundBankClipImportEntry& clip = result.Clips[clipIdx];
+            clip.ResPath = resPaths[clipIdx];
+
+            const Path resPath{resPaths[clipIdx]};
+            if (!fs::exists(resPath))
+            {
+                continue;
+            }
+
+            TranscodedAudioClip transcoded{};
+            if (const EAudioClipImportError status = Transcode(*decoder, resPath, desc.Encoding, desc.LoadMode, desc.StreamingThresholdSeconds, transcoded);
+                status != EAudioClipImportError::Success)
+            {
+                IG_LOG(AudioClipImporterLog, Warning, "\"{}\" can not be packed into sound bank \"{}\": {}", clip.ResPath, desc.BankName, status);
+                continue;
+            }
+
+            clip.bIsInSoundBank = true;
+            clip.LoadDesc = transcoded.LoadDesc;
+            clip.LoadDesc.SoundBankEntryIdx = static_cast<U32>(clipData.size());
+            clipData.emplace_back(std::move(transcoded.Data));
         }
-        const Path newAssetPath = MakeAssetPath(EAssetCategory::Audio, newAssetInfo.GetGuid());
-        if (!fs::copy_file(resPath, newAssetPath))
+
+        if (clipData.empty())
         {
-            return MakeFail<AudioClip::Desc, EAudioClipImportError::FailedToCopyAudioFile>();
+            result.SoundBank = MakeFail<AudioClip::Desc, EAudioClipImportError::EmptySoundBank>();
+            return result;
         }
 
-        IG_CHECK(newAssetInfo.IsValid());
-        return MakeSuccess<AudioClip::Desc, EAudioClipImportError>(newAssetInfo, newLoadDesc);
+        const Vector<U8> soundBankData{details::SoundBank::Build(clipData)};
+        const std::string_view bankName = desc.BankName.empty() ? std::string_view{"SoundBank"} : std::string_view{desc.BankName};
+        const AssetInfo soundBankInfo{MakeVirtualPathPreferred(bankName), EAssetCategory::Audio};
+        const AudioClipLoadDesc soundBankLoadDesc{.Extension = ".igsb", .bIsSoundBank = true};
+        IG_LOG(AudioClipImporterLog, Info, "Sound bank {}: {} clips, {} bytes.", bankName, clipData.size(), soundBankData.size());
+        result.SoundBank = ExportAudioClip(soundBankInfo, soundBankLoadDesc, soundBankData);
+        return result;
+    }
+
+    Result<AudioClip::Desc, EAudioClipImportError> AudioClipImporter::ExportSoundBankClip(const std::string_view resPathStr, const AudioClipLoadDesc& loadDesc)
+    {
+        IG_CHECK(loadDesc.IsInSoundBank());
+        const Path resPath{resPathStr};
+        const AssetInfo assetInfo{MakeVirtualPathPreferred(resPath.filename().replace_extension("").string()), EAssetCategory::Audio};
+        return ExportAudioClip(assetInfo, loadDesc, {});
     }
 }
@@ -12,19 +12,49 @@ namespace ig
         FileDoesNotExist,
         FailedToSaveMetadata,
         FailedToCopyAudioFile,
+        FailedToDecodeAudioFile,
+        UnsupportedSampleFormat,
+        EmptySoundBank,
+    };
+
+    struct SoundBankClipImportEntry
+    {
+    public:
+        std::string ResPath{};
+        /* 뱅크에 포함 되지 못한 클립(디코딩 실패 등)은 false */
+        bool bIsInSoundBank = false;
+        /* SoundBankGuid 는 뱅크가 임포트 된 이후에 결정 된다. */
+        AudioClipLoadDesc LoadDesc{};
+    };
+
+    struct SoundBankImportResult
+    {
+    public:
+        Result<AudioClip::Desc, EAudioClipImportError> SoundBank{};
+        Vector<SoundBankClipImportEntry> Clips;
     };
 
     class AudioClipImporter
     {
+        friend class AssetManager;
+
     public:
-        AudioClipImporter() = default;
+        AudioClipImporter();
         AudioClipImporter(const AudioClipImporter&) = delete;
         AudioClipImporter(AudioClipImporter&&) noexcept = delete;
-        ~AudioClipImporter() = default;
+        ~AudioClipImporter();
 
         AudioClipImporter& operator=(const AudioClipImporter&) = delete;
         AudioClipImporter& operator=(AudioClipImporter&&) noexcept = delete;
 
         Result<AudioClip::Desc, EAudioClipImportError> Import(const AudioClip::ImportDesc& desc);
+
+    private:
+        SoundBankImportResult ImportSoundBank(const std::span<const std::string> resPaths, const SoundBankImportDesc& desc);
+        static Result<AudioClip::Desc, EAudioClipImportError> ExportSoundBankClip(const std::string_view resPathStr, const AudioClipLoadDesc& loadDesc);
+
+    private:
+        /* 오디오 장치 없이 디코딩 만을 수행 하기 위한 FMOD 시스템 (FMOD_OUTPUTTYPE_NOSOUND_NRT) */
+        FMOD::System* decoder = nullptr;
     };
 }
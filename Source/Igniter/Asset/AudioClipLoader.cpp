@@ -1,18 +1,23 @@
 #include "Igniter/Igniter.h"
+#include "Igniter/Filesystem/Utils.h"
 #include "Igniter/Audio/AudioSystem.h"
+#include "Igniter/Asset/SoundBank.h"
+#include "Igniter/Asset/AssetManager.h"
 #include "Igniter/Asset/AudioClipLoader.h"
 
 namespace ig
 {
-    AudioClipLoader::AudioClipLoader(AudioSystem& audioSystem)
+    AudioClipLoader::AudioClipLoader(AudioSystem& audioSystem, AssetManager& assetManager)
         : audioSystem(&audioSystem)
+        , assetManager(&assetManager)
     {}
 
     Result<AudioClip, EAudioClipLoadError> AudioClipLoader::Load(const AudioClip::Desc& desc)
     {
         IG_CHECK(audioSystem != nullptr);
+        IG_CHECK(assetManager != nullptr);
         const AssetInfo& assetInfo{desc.Info};
-        //const AudioClip::LoadDesc& loadDesc{desc.LoadDescriptor};
+        const AudioClip::LoadDesc& loadDesc{desc.LoadDescriptor};
         if (!assetInfo.IsValid())
         {
             return MakeFail<AudioClip, EAudioClipLoadError::InvalidAssetInfo>();
@@ -22,8 +27,22 @@ namespace ig
             return MakeFail<AudioClip, EAudioClipLoadError::AssetCategoryMismatch>();
         }
 
-        const Path assetPath = MakeAssetPath(EAssetCategory::Audio, assetInfo.GetGuid());
-        const Handle<Audio> audioHandle{audioSystem->CreateAudio(assetPath.string())};
+        if (loadDesc.bIsSoundBank)
+        {
+            return LoadSoundBank(desc);
+        }
+
+        if (loadDesc.IsInSoundBank())
+        {
+            return LoadSoundBankClip(desc);
+        }
+
+        const bool bStreamed = loadDesc.LoadMode == EAudioClipLoadMode::Streamed;
+        const std::span<const U8> packedAsset{assetManager->FindPackedAsset(assetInfo.GetGuid())};
+        const Handle<Audio> audioHandle{
+            packedAsset.empty() ?
+                audioSystem->CreateAudio(MakeAssetPath(EAssetCategory::Audio, assetInfo.GetGuid()).string(), bStreamed) :
+                audioSystem->CreateAudio(packedAsset, bStreamed)};
         if (!audioHandle)
         {
             return MakeFail<AudioClip, EAudioClipLoadError::FailedToAllocateHandle>();
@@ -31,4 +50,79 @@ namespace ig
 
         return MakeSuccess<AudioClip, EAudioClipLoadError>(desc, audioHandle);
     }
+
+    Result<AudioClip, EAudioClipLoadError> AudioClipLoader::LoadSoundBank(const AudioClip::Desc& desc)
+    {
+        const AssetInfo& assetInfo{desc.Info};
+        IG_CHECK(desc.LoadDescriptor.bIsSoundBank);
+
+        /* 뱅크 전체를 한번에 읽어 들여, 이후 클립 들은 메모리 에서 생성 된다. */
+        Vector<U8> soundBankData{};
+        if (const std::span<const U8> packedAsset{assetManager->FindPackedAsset(assetInfo.GetGuid())};
+            !packedAsset.empty())
+        {
+            soundBankData.assign(packedAsset.begin(), packedAsset.end());
+        }
+        else
+        {
+            const Path assetPath{MakeAssetPath(EAssetCategory::Audio, assetInfo.GetGuid())};
+            if (!fs::exists(assetPath))
+            {
+                return MakeFail<AudioClip, EAudioClipLoadError::AssetFileDoesNotExists>();
+            }
+
+            soundBankData = LoadBlobFromFile(assetPath);
+            if (soundBankData.empty())
+            {
+                return MakeFail<AudioClip, EAudioClipLoadError::FailedToReadSoundBank>();
+            }
+        }
+
+        if (!details::SoundBank::Validate(soundBankData))
+        {
+            return MakeFail<AudioClip, EAudioClipLoadError::InvalidSoundBank>();
+        }
+
+        return MakeSuccess<AudioClip, EAudioClipLoadError>(desc, std::move(soundBankData));
+    }
+
+    Result<AudioClip, EAudioClipLoadError> AudioClipLoader::LoadSoundBankClip(const AudioClip::Desc& desc)
+    {
+        const AssetInfo& assetInfo{desc.Info};
+        const AudioClip::LoadDesc& loadDesc{desc.LoadDescriptor};
+        IG_CHECK(loadDesc.IsInSoundBank());
+        if (loadDesc.SoundBankGuid == assetInfo.GetGuid())
+        {
+            return MakeFail<AudioClip, EAudioClipLoadError::InvalidSoundBank>();
+        }
+
+        const Handle<AudioClip> soundBank{assetManager->LoadAudioClip(loadDesc.SoundBankGuid)};
+        if (!soundBank)
+        {
+            return MakeFail<AudioClip, EAudioClipLoadError::FailedToLoadSoundBank>();
+        }
+
+        const AudioClip* soundBankPtr{assetManager->Lookup(soundBank)};
+        if (soundBankPtr == nullptr || !soundBankPtr->GetSnapshot().LoadDescriptor.bIsSoundBank)
+        {
+            assetManager->Unload(soundBank);
+            return MakeFail<AudioClip, EAudioClipLoadError::InvalidSoundBank>();
+        }
+
+        const std::span<const U8> clipData{details::SoundBank::GetEntryData(soundBankPtr->GetSoundBankData(), loadDesc.SoundBankEntryIdx)};
+        if (clipData.empty())
+        {
+            assetManager->Unload(soundBank);
+            return MakeFail<AudioClip, EAudioClipLoadError::InvalidSoundBankEntry>();
+        }
+
+        const Handle<Audio> audioHandle{audioSystem->CreateAudio(clipData, loadDesc.LoadMode == EAudioClipLoadMode::Streamed)};
+        if (!audioHandle)
+        {
+            assetManager->Unload(soundBank);
+            return MakeFail<AudioClip, EAudioClipLoadError::FailedToAllocateHandle>();
+        }
+
+        return MakeSuccess<AudioClip, EAudioClipLoadError>(*assetManager, desc, audioHandle, soundBank);
+    }
 }
@@ -11,14 +11,19 @@ namespace ig
         AssetCategoryMismatch,
         AssetFileDoesNotExists,
         FailedToAllocateHandle,
+        FailedToReadSoundBank,
+        InvalidSoundBank,
+        FailedToLoadSoundBank,
+        InvalidSoundBankEntry,
     };
 
     class AudioSystem;
+    class AssetManager;
 
     class AudioClipLoader
     {
     public:
-        explicit AudioClipLoader(AudioSystem& audioSystem);
+        AudioClipLoader(AudioSystem& audioSystem, AssetManager& assetManager);
         AudioClipLoader(const AudioClipLoader&) = delete;
         AudioClipLoader(AudioClipLoader&&) noexcept = delete;
         ~AudioClipLoader() = default;
@@ -28,7 +33,12 @@ namespace ig
 
         Result<AudioClip, EAudioClipLoadError> Load(const AudioClip::Desc& desc);
 
+    private:
+        Result<AudioClip, EAudioClipLoadError> LoadSoundBank(const AudioClip::Desc& desc);
+        Result<AudioClip, EAudioClipLoadError> LoadSoundBankClip(const AudioClip::Desc& desc);
+
     private:
         AudioSystem* audioSystem = nullptr;
+        AssetManager* assetManager = nullptr;
     };
 }
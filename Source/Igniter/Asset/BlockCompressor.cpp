@@ -0,0 +1,946 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Asset/BlockCompressor.h"
+
+namespace ig::details
+{
+    namespace
+    {
+        constexpr U32 kNumBlockPixels = 16;
+        constexpr Array<U32, 16> kBC7Weights4{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+        constexpr U32 kBC7Mode = 6;
+
+        class BlockBitWriter
+        {
+        public:
+            explicit BlockBitWriter(U8* dst)
+                : dst(dst)
+            {
+                std::memset(dst, 0, 16);
+            }
+
+            void Write(const U32 value, const U32 numBits)
+            {
+                for (U32 bit = 0; bit < numBits; ++bit, ++offset)
+                {
+                    dst[offset >> 3] |= (U8)(((value >> bit) & 1) << (offset & 7));
+                }
+            }
+
+        private:
+            U8* dst = nullptr;
+            U32 offset = 0;
+        };
+
+        class BlockBitReader
+        {
+        public:
+            explicit BlockBitReader(const U8* src)
+                : src(src)
+            {}
+
+            U32 Read(const U32 numBits)
+            {
+                U32 value = 0;
+                for (U32 bit = 0; bit < numBits; ++bit, ++offset)
+                {
+                    value |= (U32)((src[offset >> 3] >> (offset & 7)) & 1) << bit;
+                }
+                return value;
+            }
+
+        private:
+            const U8* src = nullptr;
+            U32 offset = 0;
+        };
+
+        F32 ClampUnorm8(const F32 value)
+        {
+            return std::clamp(value, 0.f, 255.f);
+        }
+
+        /* 고정 길이 점 집합의 주성분 축 위에서 엔드포인트(e0: 최소, e1: 최대)를 찾는다. */
+        template <U32 NumChannels>
+        void FindEndpoints(const F32 (&points)[kNumBlockPixels][NumChannels], const ETextureCompressionQuality quality, F32 (&e0)[NumChannels],
+            F32 (&e1)[NumChannels])
+        {
+            F32 mean[NumChannels]{};
+            F32 minValues[NumChannels];
+            F32 maxValues[NumChannels];
+            std::fill_n(minValues, NumChannels, 255.f);
+            std::fill_n(maxValues, NumChannels, 0.f);
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                for (U32 channel = 0; channel < NumChannels; ++channel)
+                {
+                    mean[channel] += points[pixelIdx][channel];
+                    minValues[channel] = std::min(minValues[channel], points[pixelIdx][channel]);
+                    maxValues[channel] = std::max(maxValues[channel], points[pixelIdx][channel]);
+                }
+            }
+
+            for (U32 channel = 0; channel < NumChannels; ++channel)
+            {
+                mean[channel] /= (F32)kNumBlockPixels;
+            }
+
+            F32 covariance[NumChannels][NumChannels]{};
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                F32 delta[NumChannels];
+                for (U32 channel = 0; channel < NumChannels; ++channel)
+                {
+                    delta[channel] = points[pixelIdx][channel] - mean[channel];
+                }
+
+                for (U32 row = 0; row < NumChannels; ++row)
+                {
+                    for (U32 col = 0; col < NumChannels; ++col)
+                    {
+                        covariance[row][col] += delta[row] * delta[col];
+                    }
+                }
+            }
+
+            /* Power Iteration; 바운딩 박스의 대각선에서 시작 */
+            F32 axis[NumChannels];
+            for (U32 channel = 0; channel < NumChannels; ++channel)
+            {
+                axis[channel] = maxValues[channel] - minValues[channel];
+            }
+
+            const U32 numIterations = quality == ETextureCompressionQuality::Fast ? 1 : (quality == ETextureCompressionQuality::Normal ? 4 : 8);
+            for (U32 iteration = 0; iteration < numIterations; ++iteration)
+            {
+                F32 nextAxis[NumChannels]{};
+                F32 maxComponent = 0.f;
+                for (U32 row = 0; row < NumChannels; ++row)
+                {
+                    for (U32 col = 0; col < NumChannels; ++col)
+                    {
+                        nextAxis[row] += covariance[row][col] * axis[col];
+                    }
+                    maxComponent = std::max(maxComponent, std::abs(nextAxis[row]));
+                }
+
+                if (maxComponent < 1e-6f)
+                {
+                    break;
+                }
+
+                for (U32 channel = 0; channel < NumChannels; ++channel)
+                {
+                    axis[channel] = nextAxis[channel] / maxComponent;
+                }
+            }
+
+            F32 axisLengthSq = 0.f;
+            for (U32 channel = 0; channel < NumChannels; ++channel)
+            {
+                axisLengthSq += axis[channel] * axis[channel];
+            }
+
+            if (axisLengthSq < 1e-6f)
+            {
+                std::copy_n(mean, NumChannels, e0);
+                std::copy_n(mean, NumChannels, e1);
+                return;
+            }
+
+            const F32 invAxisLength = 1.f / std::sqrt(axisLengthSq);
+            for (U32 channel = 0; channel < NumChannels; ++channel)
+            {
+                axis[channel] *= invAxisLength;
+            }
+
+            F32 minProj = std::numeric_limits<F32>::max();
+            F32 maxProj = std::numeric_limits<F32>::lowest();
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                F32 proj = 0.f;
+                for (U32 channel = 0; channel < NumChannels; ++channel)
+                {
+                    proj += (points[pixelIdx][channel] - mean[channel]) * axis[channel];
+                }
+                minProj = std::min(minProj, proj);
+                maxProj = std::max(maxProj, proj);
+            }
+
+            for (U32 channel = 0; channel < NumChannels; ++channel)
+            {
+                e0[channel] = ClampUnorm8(mean[channel] + axis[channel] * minProj);
+                e1[channel] = ClampUnorm8(mean[channel] + axis[channel] * maxProj);
+            }
+        }
+
+        /* weights[pixel] 는 e1 의 가중치. 보간 결과와 픽셀 간 오차의 제곱 합을 최소화 하는 엔드포인트를 구한다. */
+        template <U32 NumChannels>
+        bool SolveLeastSquaresEndpoints(const F32 (&points)[kNumBlockPixels][NumChannels], const F32 (&weights)[kNumBlockPixels], F32 (&e0)[NumChannels],
+            F32 (&e1)[NumChannels])
+        {
+            F32 sumW0W0 = 0.f;
+            F32 sumW0W1 = 0.f;
+            F32 sumW1W1 = 0.f;
+            F32 sumW0P[NumChannels]{};
+            F32 sumW1P[NumChannels]{};
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                const F32 w1 = weights[pixelIdx];
+                const F32 w0 = 1.f - w1;
+                sumW0W0 += w0 * w0;
+                sumW0W1 += w0 * w1;
+                sumW1W1 += w1 * w1;
+                for (U32 channel = 0; channel < NumChannels; ++channel)
+                {
+                    sumW0P[channel] += w0 * points[pixelIdx][channel];
+                    sumW1P[channel] += w1 * points[pixelIdx][channel];
+                }
+            }
+
+            const F32 det = sumW0W0 * sumW1W1 - sumW0W1 * sumW0W1;
+            if (std::abs(det) < 1e-6f)
+            {
+                return false;
+            }
+
+            const F32 invDet = 1.f / det;
+            for (U32 channel = 0; channel < NumChannels; ++channel)
+            {
+                e0[channel] = ClampUnorm8((sumW1W1 * sumW0P[channel] - sumW0W1 * sumW1P[channel]) * invDet);
+                e1[channel] = ClampUnorm8((sumW0W0 * sumW1P[channel] - sumW0W1 * sumW0P[channel]) * invDet);
+            }
+
+            return true;
+        }
+
+        /******************************** BC1 ********************************/
+        U16 PackRgb565(const F32 (&rgb)[3])
+        {
+            const U32 r = (U32)std::lround(rgb[0] * (31.f / 255.f));
+            const U32 g = (U32)std::lround(rgb[1] * (63.f / 255.f));
+            const U32 b = (U32)std::lround(rgb[2] * (31.f / 255.f));
+            return (U16)((r << 11) | (g << 5) | b);
+        }
+
+        void UnpackRgb565(const U16 color, F32 (&rgb)[3])
+        {
+            const U32 r = (color >> 11) & 0x1F;
+            const U32 g = (color >> 5) & 0x3F;
+            const U32 b = color & 0x1F;
+            rgb[0] = (F32)((r << 3) | (r >> 2));
+            rgb[1] = (F32)((g << 2) | (g >> 4));
+            rgb[2] = (F32)((b << 3) | (b >> 2));
+        }
+
+        /* 4 단계 팔레트: 0 => c0, 1 => c1, 2 => 2/3 c0 + 1/3 c1, 3 => 1/3 c0 + 2/3 c1 */
+        void MakeBC1Palette(const U16 c0, const U16 c1, F32 (&palette)[4][3])
+        {
+            UnpackRgb565(c0, palette[0]);
+            UnpackRgb565(c1, palette[1]);
+            for (U32 channel = 0; channel < 3; ++channel)
+            {
+                palette[2][channel] = (2.f * palette[0][channel] + palette[1][channel]) / 3.f;
+                palette[3][channel] = (palette[0][channel] + 2.f * palette[1][channel]) / 3.f;
+            }
+        }
+
+        F32 FitBC1Indices(const F32 (&points)[kNumBlockPixels][3], const U16 c0, const U16 c1, U8 (&indices)[kNumBlockPixels])
+        {
+            F32 palette[4][3];
+            MakeBC1Palette(c0, c1, palette);
+
+            F32 totalError = 0.f;
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                F32 bestError = std::numeric_limits<F32>::max();
+                for (U8 paletteIdx = 0; paletteIdx < 4; ++paletteIdx)
+                {
+                    F32 error = 0.f;
+                    for (U32 channel = 0; channel < 3; ++channel)
+                    {
+                        const F32 delta = points[pixelIdx][channel] - palette[paletteIdx][channel];
+                        error += delta * delta;
+                    }
+
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        indices[pixelIdx] = paletteIdx;
+                    }
+                }
+                totalError += bestError;
+            }
+
+            return totalError;
+        }
+
+        void WriteBC1Block(U16 c0, U16 c1, U8 (&indices)[kNumBlockPixels], U8* dst)
+        {
+            /* c0 <= c1 인 경우 3 단계(+투명) 팔레트로 해석 되므로, 항상 c0 > c1 이 되도록 교환 한다. */
+            if (c0 < c1)
+            {
+                std::swap(c0, c1);
+                for (U8& index : indices)
+                {
+                    index ^= 1;
+                }
+            }
+            else if (c0 == c1)
+            {
+                std::fill_n(indices, kNumBlockPixels, (U8)0);
+            }
+
+            U32 packedIndices = 0;
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                packedIndices |= (U32)indices[pixelIdx] << (pixelIdx * 2);
+            }
+
+            dst[0] = (U8)(c0 & 0xFF);
+            dst[1] = (U8)(c0 >> 8);
+            dst[2] = (U8)(c1 & 0xFF);
+            dst[3] = (U8)(c1 >> 8);
+            for (U32 byteIdx = 0; byteIdx < 4; ++byteIdx)
+            {
+                dst[4 + byteIdx] = (U8)(packedIndices >> (byteIdx * 8));
+            }
+        }
+
+        void EncodeBC1(const U8 (&pixels)[kNumBlockPixels][4], const ETextureCompressionQuality quality, U8* dst)
+        {
+            F32 points[kNumBlockPixels][3];
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                for (U32 channel = 0; channel < 3; ++channel)
+                {
+                    points[pixelIdx][channel] = (F32)pixels[pixelIdx][channel];
+                }
+            }
+
+            F32 e0[3];
+            F32 e1[3];
+            FindEndpoints<3>(points, quality, e0, e1);
+
+            U16 c0 = PackRgb565(e1);
+            U16 c1 = PackRgb565(e0);
+            U8 indices[kNumBlockPixels];
+            F32 bestError = FitBC1Indices(points, c0, c1, indices);
+
+            constexpr F32 kIndexWeights[4]{0.f, 1.f, 1.f / 3.f, 2.f / 3.f};
+            const U32 numRefinements = quality == ETextureCompressionQuality::Fast ? 0 : (quality == ETextureCompressionQuality::Normal ? 1 : 3);
+            for (U32 refinement = 0; refinement < numRefinements && bestError > 0.f; ++refinement)
+            {
+                F32 weights[kNumBlockPixels];
+                for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+                {
+                    weights[pixelIdx] = kIndexWeights[indices[pixelIdx]];
+                }
+
+                F32 refinedC0[3];
+                F32 refinedC1[3];
+                if (!SolveLeastSquaresEndpoints<3>(points, weights, refinedC0, refinedC1))
+                {
+                    break;
+                }
+
+                const U16 newC0 = PackRgb565(refinedC0);
+                const U16 newC1 = PackRgb565(refinedC1);
+                U8 newIndices[kNumBlockPixels];
+                const F32 newError = FitBC1Indices(points, newC0, newC1, newIndices);
+                if (newError >= bestError)
+                {
+                    break;
+                }
+
+                c0 = newC0;
+                c1 = newC1;
+                std::copy_n(newIndices, kNumBlockPixels, indices);
+                bestError = newError;
+            }
+
+            WriteBC1Block(c0, c1, indices, dst);
+        }
+
+        void DecodeBC1(const U8* src, const bool bForceFourColors, U8 (&pixels)[kNumBlockPixels][4])
+        {
+            const U16 c0 = (U16)(src[0] | (src[1] << 8));
+            const U16 c1 = (U16)(src[2] | (src[3] << 8));
+            const U32 packedIndices = (U32)src[4] | ((U32)src[5] << 8) | ((U32)src[6] << 16) | ((U32)src[7] << 24);
+
+            F32 palette[4][3];
+            MakeBC1Palette(c0, c1, palette);
+            const bool bThreeColors = !bForceFourColors && c0 <= c1;
+            if (bThreeColors)
+            {
+                for (U32 channel = 0; channel < 3; ++channel)
+                {
+                    palette[2][channel] = (palette[0][channel] + palette[1][channel]) * 0.5f;
+                    palette[3][channel] = 0.f;
+                }
+            }
+
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                const U32 index = (packedIndices >> (pixelIdx * 2)) & 0x3;
+                for (U32 channel = 0; channel < 3; ++channel)
+                {
+                    pixels[pixelIdx][channel] = (U8)std::lround(palette[index][channel]);
+                }
+                pixels[pixelIdx][3] = (bThreeColors && index == 3) ? 0 : 255;
+            }
+        }
+
+        /******************************** BC4 ********************************/
+        /* a0 > a1 => 8 단계 보간, a0 <= a1 => 6 단계 보간 + 0, 255 */
+        void MakeBC4Palette(const U8 a0, const U8 a1, U8 (&palette)[8])
+        {
+            palette[0] = a0;
+            palette[1] = a1;
+            if (a0 > a1)
+            {
+                for (U32 step = 1; step < 7; ++step)
+                {
+                    palette[step + 1] = (U8)(((7 - step) * a0 + step * a1 + 3) / 7);
+                }
+            }
+            else
+            {
+                for (U32 step = 1; step < 5; ++step)
+                {
+                    palette[step + 1] = (U8)(((5 - step) * a0 + step * a1 + 2) / 5);
+                }
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+        }
+
+        U32 FitBC4Indices(const U8 (&values)[kNumBlockPixels], const U8 a0, const U8 a1, U8 (&indices)[kNumBlockPixels])
+        {
+            U8 palette[8];
+            MakeBC4Palette(a0, a1, palette);
+
+            U32 totalError = 0;
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                U32 bestError = std::numeric_limits<U32>::max();
+                for (U8 paletteIdx = 0; paletteIdx < 8; ++paletteIdx)
+                {
+                    const S32 delta = (S32)values[pixelIdx] - (S32)palette[paletteIdx];
+                    const U32 error = (U32)(delta * delta);
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        indices[pixelIdx] = paletteIdx;
+                    }
+                }
+                totalError += bestError;
+            }
+
+            return totalError;
+        }
+
+        void EncodeBC4(const U8 (&values)[kNumBlockPixels], const ETextureCompressionQuality quality, U8* dst)
+        {
+            U8 minValue = 255;
+            U8 maxValue = 0;
+            /* 6 단계 팔레트는 0/255 를 명시적으로 표현 하므로, 양 끝 값을 제외한 범위를 사용 */
+            U8 minInnerValue = 255;
+            U8 maxInnerValue = 0;
+            for (const U8 value : values)
+            {
+                minValue = std::min(minValue, value);
+                maxValue = std::max(maxValue, value);
+                if (value != 0 && value != 255)
+                {
+                    minInnerValue = std::min(minInnerValue, value);
+                    maxInnerValue = std::max(maxInnerValue, value);
+                }
+            }
+
+            U8 a0 = maxValue;
+            U8 a1 = minValue;
+            U8 indices[kNumBlockPixels];
+            U32 bestError = FitBC4Indices(values, a0, a1, indices);
+
+            const auto tryEndpoints = [&values, &a0, &a1, &indices, &bestError](const U8 candidateA0, const U8 candidateA1)
+            {
+                U8 candidateIndices[kNumBlockPixels];
+                const U32 error = FitBC4Indices(values, candidateA0, candidateA1, candidateIndices);
+                if (error < bestError)
+                {
+                    a0 = candidateA0;
+                    a1 = candidateA1;
+                    std::copy_n(candidateIndices, kNumBlockPixels, indices);
+                    bestError = error;
+                }
+            };
+
+            if (quality != ETextureCompressionQuality::Fast && bestError > 0 && minInnerValue <= maxInnerValue)
+            {
+                tryEndpoints(minInnerValue, maxInnerValue);
+            }
+
+            if (quality == ETextureCompressionQuality::High && bestError > 0 && maxValue > minValue)
+            {
+                constexpr S32 kSearchRadius = 3;
+                for (S32 deltaMax = -kSearchRadius; deltaMax <= kSearchRadius; ++deltaMax)
+                {
+                    for (S32 deltaMin = -kSearchRadius; deltaMin <= kSearchRadius; ++deltaMin)
+                    {
+                        const S32 candidateA0 = std::clamp((S32)maxValue + deltaMax, 0, 255);
+                        const S32 candidateA1 = std::clamp((S32)minValue + deltaMin, 0, 255);
+                        if (candidateA0 > candidateA1)
+                        {
+                            tryEndpoints((U8)candidateA0, (U8)candidateA1);
+                        }
+                    }
+                }
+            }
+
+            U64 packedIndices = 0;
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                packedIndices |= (U64)indices[pixelIdx] << (pixelIdx * 3);
+            }
+
+            dst[0] = a0;
+            dst[1] = a1;
+            for (U32 byteIdx = 0; byteIdx < 6; ++byteIdx)
+            {
+                dst[2 + byteIdx] = (U8)(packedIndices >> (byteIdx * 8));
+            }
+        }
+
+        void DecodeBC4(const U8* src, U8 (&values)[kNumBlockPixels])
+        {
+            U8 palette[8];
+            MakeBC4Palette(src[0], src[1], palette);
+
+            U64 packedIndices = 0;
+            for (U32 byteIdx = 0; byteIdx < 6; ++byteIdx)
+            {
+                packedIndices |= (U64)src[2 + byteIdx] << (byteIdx * 8);
+            }
+
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                values[pixelIdx] = palette[(packedIndices >> (pixelIdx * 3)) & 0x7];
+            }
+        }
+
+        void EncodeBC4Channel(const U8 (&pixels)[kNumBlockPixels][4], const U32 channel, const ETextureCompressionQuality quality, U8* dst)
+        {
+            U8 values[kNumBlockPixels];
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                values[pixelIdx] = pixels[pixelIdx][channel];
+            }
+            EncodeBC4(values, quality, dst);
+        }
+
+        /******************************** BC7 (Mode 6) ********************************/
+        struct BC7Endpoints
+        {
+            /* 7 비트 양자화 값; 실제 엔드포인트 = (Quantized << 1) | PBit */
+            U8 Quantized[2][4];
+            U8 PBits[2];
+        };
+
+        U8 QuantizeBC7Component(const F32 value, const U8 pBit)
+        {
+            return (U8)std::clamp((S32)std::lround((value - (F32)pBit) * 0.5f), 0, 127);
+        }
+
+        void QuantizeBC7Endpoint(const F32 (&endpoint)[4], const U8 pBit, U8 (&quantized)[4])
+        {
+            for (U32 channel = 0; channel < 4; ++channel)
+            {
+                quantized[channel] = QuantizeBC7Component(endpoint[channel], pBit);
+            }
+        }
+
+        /* 엔드포인트 자체의 양자화 오차가 가장 작은 p-bit */
+        U8 SelectBC7PBit(const F32 (&endpoint)[4])
+        {
+            F32 errors[2]{};
+            for (U8 pBit = 0; pBit < 2; ++pBit)
+            {
+                for (U32 channel = 0; channel < 4; ++channel)
+                {
+                    const F32 delta = endpoint[channel] - (F32)((QuantizeBC7Component(endpoint[channel], pBit) << 1) | pBit);
+                    errors[pBit] += delta * delta;
+                }
+            }
+            return errors[1] < errors[0] ? 1 : 0;
+        }
+
+        void MakeBC7Palette(const BC7Endpoints& endpoints, U8 (&palette)[16][4])
+        {
+            for (U32 channel = 0; channel < 4; ++channel)
+            {
+                const U32 e0 = ((U32)endpoints.Quantized[0][channel] << 1) | endpoints.PBits[0];
+                const U32 e1 = ((U32)endpoints.Quantized[1][channel] << 1) | endpoints.PBits[1];
+                for (U32 paletteIdx = 0; paletteIdx < 16; ++paletteIdx)
+                {
+                    const U32 weight = kBC7Weights4[paletteIdx];
+                    palette[paletteIdx][channel] = (U8)(((64 - weight) * e0 + weight * e1 + 32) >> 6);
+                }
+            }
+        }
+
+        U32 FitBC7Indices(const U8 (&pixels)[kNumBlockPixels][4], const BC7Endpoints& endpoints, U8 (&indices)[kNumBlockPixels])
+        {
+            U8 palette[16][4];
+            MakeBC7Palette(endpoints, palette);
+
+            U32 totalError = 0;
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                U32 bestError = std::numeric_limits<U32>::max();
+                for (U8 paletteIdx = 0; paletteIdx < 16; ++paletteIdx)
+                {
+                    U32 error = 0;
+                    for (U32 channel = 0; channel < 4; ++channel)
+                    {
+                        const S32 delta = (S32)pixels[pixelIdx][channel] - (S32)palette[paletteIdx][channel];
+                        error += (U32)(delta * delta);
+                    }
+
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        indices[pixelIdx] = paletteIdx;
+                    }
+                }
+                totalError += bestError;
+            }
+
+            return totalError;
+        }
+
+        void WriteBC7Mode6Block(BC7Endpoints endpoints, U8 (&indices)[kNumBlockPixels], U8* dst)
+        {
+            /* 앵커(첫 픽셀) 인덱스의 최상위 비트는 암시적으로 0 이므로, 필요 하다면 엔드포인트를 교환 한다. */
+            if (indices[0] >= 8)
+            {
+                for (U32 channel = 0; channel < 4; ++channel)
+                {
+                    std::swap(endpoints.Quantized[0][channel], endpoints.Quantized[1][channel]);
+                }
+                std::swap(endpoints.PBits[0], endpoints.PBits[1]);
+                for (U8& index : indices)
+                {
+                    index = 15 - index;
+                }
+            }
+
+            BlockBitWriter writer{dst};
+            writer.Write(1 << kBC7Mode, kBC7Mode + 1);
+            for (U32 channel = 0; channel < 4; ++channel)
+            {
+                writer.Write(endpoints.Quantized[0][channel], 7);
+                writer.Write(endpoints.Quantized[1][channel], 7);
+            }
+            writer.Write(endpoints.PBits[0], 1);
+            writer.Write(endpoints.PBits[1], 1);
+            writer.Write(indices[0], 3);
+            for (U32 pixelIdx = 1; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                writer.Write(indices[pixelIdx], 4);
+            }
+        }
+
+        void EncodeBC7(const U8 (&pixels)[kNumBlockPixels][4], const ETextureCompressionQuality quality, U8* dst)
+        {
+            F32 points[kNumBlockPixels][4];
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                for (U32 channel = 0; channel < 4; ++channel)
+                {
+                    points[pixelIdx][channel] = (F32)pixels[pixelIdx][channel];
+                }
+            }
+
+            F32 e0[4];
+            F32 e1[4];
+            FindEndpoints<4>(points, quality, e0, e1);
+
+            const U32 numRefinements = quality == ETextureCompressionQuality::Fast ? 0 : (quality == ETextureCompressionQuality::Normal ? 1 : 2);
+            const auto encodeWithPBits = [&points, &pixels, &e0, &e1, numRefinements](const U8 pBit0, const U8 pBit1, BC7Endpoints& endpoints,
+                U8 (&indices)[kNumBlockPixels])
+            {
+                endpoints.PBits[0] = pBit0;
+                endpoints.PBits[1] = pBit1;
+                QuantizeBC7Endpoint(e0, pBit0, endpoints.Quantized[0]);
+                QuantizeBC7Endpoint(e1, pBit1, endpoints.Quantized[1]);
+                U32 bestError = FitBC7Indices(pixels, endpoints, indices);
+
+                for (U32 refinement = 0; refinement < numRefinements && bestError > 0; ++refinement)
+                {
+                    F32 weights[kNumBlockPixels];
+                    for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+                    {
+                        weights[pixelIdx] = (F32)kBC7Weights4[indices[pixelIdx]] / 64.f;
+                    }
+
+                    F32 refinedE0[4];
+                    F32 refinedE1[4];
+                    if (!SolveLeastSquaresEndpoints<4>(points, weights, refinedE0, refinedE1))
+                    {
+                        break;
+                    }
+
+                    BC7Endpoints refinedEndpoints{};
+                    refinedEndpoints.PBits[0] = pBit0;
+                    refinedEndpoints.PBits[1] = pBit1;
+                    QuantizeBC7Endpoint(refinedE0, pBit0, refinedEndpoints.Quantized[0]);
+                    QuantizeBC7Endpoint(refinedE1, pBit1, refinedEndpoints.Quantized[1]);
+                    U8 refinedIndices[kNumBlockPixels];
+                    const U32 refinedError = FitBC7Indices(pixels, refinedEndpoints, refinedIndices);
+                    if (refinedError >= bestError)
+                    {
+                        break;
+                    }
+
+                    endpoints = refinedEndpoints;
+                    std::copy_n(refinedIndices, kNumBlockPixels, indices);
+                    bestError = refinedError;
+                }
+
+                return bestError;
+            };
+
+            BC7Endpoints bestEndpoints{};
+            U8 bestIndices[kNumBlockPixels];
+            U32 bestError = encodeWithPBits(SelectBC7PBit(e0), SelectBC7PBit(e1), bestEndpoints, bestIndices);
+            if (quality == ETextureCompressionQuality::High && bestError > 0)
+            {
+                for (U8 pBits = 0; pBits < 4; ++pBits)
+                {
+                    BC7Endpoints endpoints{};
+                    U8 indices[kNumBlockPixels];
+                    const U32 error = encodeWithPBits(pBits & 1, pBits >> 1, endpoints, indices);
+                    if (error < bestError)
+                    {
+                        bestEndpoints = endpoints;
+                        std::copy_n(indices, kNumBlockPixels, bestIndices);
+                        bestError = error;
+                    }
+                }
+            }
+
+            WriteBC7Mode6Block(bestEndpoints, bestIndices, dst);
+        }
+
+        bool DecodeBC7(const U8* src, U8 (&pixels)[kNumBlockPixels][4])
+        {
+            BlockBitReader reader{src};
+            if (reader.Read(kBC7Mode + 1) != (1 << kBC7Mode))
+            {
+                return false;
+            }
+
+            BC7Endpoints endpoints{};
+            for (U32 channel = 0; channel < 4; ++channel)
+            {
+                endpoints.Quantized[0][channel] = (U8)reader.Read(7);
+                endpoints.Quantized[1][channel] = (U8)reader.Read(7);
+            }
+            endpoints.PBits[0] = (U8)reader.Read(1);
+            endpoints.PBits[1] = (U8)reader.Read(1);
+
+            U8 palette[16][4];
+            MakeBC7Palette(endpoints, palette);
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                const U32 index = reader.Read(pixelIdx == 0 ? 3 : 4);
+                std::copy_n(palette[index], 4, pixels[pixelIdx]);
+            }
+
+            return true;
+        }
+
+        /* 경계를 벗어나는 픽셀은 가장자리 픽셀을 반복 한다. */
+        void FetchBlock(const BlockImageView& image, const U32 blockX, const U32 blockY, U8 (&pixels)[kNumBlockPixels][4])
+        {
+            for (U32 y = 0; y < 4; ++y)
+            {
+                const U8* srcRow = image.Pixels + std::min(blockY * 4 + y, image.Height - 1) * image.RowPitch;
+                for (U32 x = 0; x < 4; ++x)
+                {
+                    std::memcpy(pixels[y * 4 + x], srcRow + std::min(blockX * 4 + x, image.Width - 1) * 4, 4);
+                }
+            }
+        }
+
+        U32 GetNumCompressedChannels(const EBlockCompressionFormat format)
+        {
+            switch (format)
+            {
+            case EBlockCompressionFormat::BC1:
+                return 3;
+            case EBlockCompressionFormat::BC4:
+                return 1;
+            case EBlockCompressionFormat::BC5:
+                return 2;
+            case EBlockCompressionFormat::BC3:
+            case EBlockCompressionFormat::BC7:
+            default:
+                return 4;
+            }
+        }
+    } // namespace
+
+    Size BlockCompressor::GetBlockSize(const EBlockCompressionFormat format)
+    {
+        return (format == EBlockCompressionFormat::BC1 || format == EBlockCompressionFormat::BC4) ? 8 : 16;
+    }
+
+    void BlockCompressor::EncodeBlock(const EBlockCompressionFormat format, const ETextureCompressionQuality quality, const U8 (&pixels)[16][4], U8* dst)
+    {
+        switch (format)
+        {
+        case EBlockCompressionFormat::BC1:
+            EncodeBC1(pixels, quality, dst);
+            break;
+        case EBlockCompressionFormat::BC3:
+            EncodeBC4Channel(pixels, 3, quality, dst);
+            EncodeBC1(pixels, quality, dst + 8);
+            break;
+        case EBlockCompressionFormat::BC4:
+            EncodeBC4Channel(pixels, 0, quality, dst);
+            break;
+        case EBlockCompressionFormat::BC5:
+            EncodeBC4Channel(pixels, 0, quality, dst);
+            EncodeBC4Channel(pixels, 1, quality, dst + 8);
+            break;
+        case EBlockCompressionFormat::BC7:
+            EncodeBC7(pixels, quality, dst);
+            break;
+        default:
+            IG_CHECK_NO_ENTRY();
+            break;
+        }
+    }
+
+    bool BlockCompressor::DecodeBlock(const EBlockCompressionFormat format, const U8* src, U8 (&pixels)[16][4])
+    {
+        switch (format)
+        {
+        case EBlockCompressionFormat::BC1:
+            DecodeBC1(src, false, pixels);
+            return true;
+        case EBlockCompressionFormat::BC3:
+        {
+            DecodeBC1(src + 8, true, pixels);
+            U8 alphas[kNumBlockPixels];
+            DecodeBC4(src, alphas);
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                pixels[pixelIdx][3] = alphas[pixelIdx];
+            }
+            return true;
+        }
+        case EBlockCompressionFormat::BC4:
+        case EBlockCompressionFormat::BC5:
+        {
+            U8 reds[kNumBlockPixels];
+            U8 greens[kNumBlockPixels]{};
+            DecodeBC4(src, reds);
+            if (format == EBlockCompressionFormat::BC5)
+            {
+                DecodeBC4(src + 8, greens);
+            }
+
+            for (U32 pixelIdx = 0; pixelIdx < kNumBlockPixels; ++pixelIdx)
+            {
+                pixels[pixelIdx][0] = reds[pixelIdx];
+                pixels[pixelIdx][1] = greens[pixelIdx];
+                pixels[pixelIdx][2] = 0;
+                pixels[pixelIdx][3] = 255;
+            }
+            return true;
+        }
+        case EBlockCompressionFormat::BC7:
+            return DecodeBC7(src, pixels);
+        default:
+            return false;
+        }
+    }
+
+    void BlockCompressor::Compress(tf::Executor& taskExecutor, const EBlockCompressionFormat format, const ETextureCompressionQuality quality,
+        const std::span<const BlockImageView> srcImages, const std::span<const CompressedImageView> dstImages)
+    {
+        IG_CHECK(srcImages.size() == dstImages.size());
+
+        /* rowOffsets[imageIdx] = 해당 이미지의 첫 블록 행이 평탄화 된 작업 목록 내에서 가지는 인덱스 */
+        Vector<Size> rowOffsets(srcImages.size() + 1, 0);
+        for (Index imageIdx = 0; imageIdx < srcImages.size(); ++imageIdx)
+        {
+            rowOffsets[imageIdx + 1] = rowOffsets[imageIdx] + GetNumBlocks(srcImages[imageIdx].Height);
+        }
+
+        const Size blockSize = GetBlockSize(format);
+        tf::Taskflow compressFlow{};
+        compressFlow.for_each_index(
+            0, (S32)rowOffsets.back(), 1,
+            [format, quality, srcImages, dstImages, blockSize, &rowOffsets](const Index rowIdx)
+            {
+                const Index imageIdx = (Index)(std::upper_bound(rowOffsets.cbegin(), rowOffsets.cend(), rowIdx) - rowOffsets.cbegin()) - 1;
+                const BlockImageView& srcImage = srcImages[imageIdx];
+                const CompressedImageView& dstImage = dstImages[imageIdx];
+                const U32 blockY = (U32)(rowIdx - rowOffsets[imageIdx]);
+                U8* dstRow = dstImage.Blocks + blockY * dstImage.RowPitch;
+
+                U8 pixels[kNumBlockPixels][4];
+                const U32 numBlocksX = GetNumBlocks(srcImage.Width);
+                for (U32 blockX = 0; blockX < numBlocksX; ++blockX)
+                {
+                    FetchBlock(srcImage, blockX, blockY, pixels);
+                    EncodeBlock(format, quality, pixels, dstRow + blockX * blockSize);
+                }
+            });
+        taskExecutor.run(compressFlow).wait();
+    }
+
+    F64 BlockCompressor::ComputePsnr(const EBlockCompressionFormat format, const BlockImageView& srcImage, const CompressedImageView& compressedImage)
+    {
+        const U32 numChannels = GetNumCompressedChannels(format);
+        const Size blockSize = GetBlockSize(format);
+
+        U64 squaredErrorSum = 0;
+        U8 decoded[kNumBlockPixels][4];
+        for (U32 blockY = 0; blockY < GetNumBlocks(srcImage.Height); ++blockY)
+        {
+            const U8* blockRow = compressedImage.Blocks + blockY * compressedImage.RowPitch;
+            for (U32 blockX = 0; blockX < GetNumBlocks(srcImage.Width); ++blockX)
+            {
+                if (!DecodeBlock(format, blockRow + blockX * blockSize, decoded))
+                {
+                    return 0.0;
+                }
+
+                for (U32 y = 0; y < 4 && blockY * 4 + y < srcImage.Height; ++y)
+                {
+                    const U8* srcRow = srcImage.Pixels + (blockY * 4 + y) * srcImage.RowPitch;
+                    for (U32 x = 0; x < 4 && blockX * 4 + x < srcImage.Width; ++x)
+                    {
+                        const U8* srcPixel = srcRow + (blockX * 4 + x) * 4;
+                        for (U32 channel = 0; channel < numChannels; ++channel)
+                        {
+                            const S32 delta = (S32)srcPixel[channel] - (S32)decoded[y * 4 + x][channel];
+                            squaredErrorSum += (U64)(delta * delta);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (squaredErrorSum == 0)
+        {
+            return std::numeric_limits<F64>::infinity();
+        }
+
+        const F64 meanSquaredError = (F64)squaredErrorSum / ((F64)srcImage.Width * srcImage.Height * numChannels);
+        return 10.0 * std::log10((255.0 * 255.0) / meanSquaredError);
+    }
+} // namespace ig::details
@@ -0,0 +1,67 @@
+#pragma once
+#include "Igniter/Igniter.h"
+
+namespace ig
+{
+    enum class ETextureCompressionQuality : U8
+    {
+        Fast,   /* 근사 주성분 축 엔드포인트 */
+        Normal, /* 주성분 축 엔드포인트 + 최소 제곱 보정 1회 */
+        High    /* 주성분 축 엔드포인트 + 반복 최소 제곱 보정, BC4 엔드포인트/BC7 p-bit 탐색 */
+    };
+} // namespace ig
+
+namespace ig::details
+{
+    enum class EBlockCompressionFormat : U8
+    {
+        BC1,
+        BC3,
+        BC4,
+        BC5,
+        BC7
+    };
+
+    /* 플랫폼 독립적인 RGBA8 이미지 */
+    struct BlockImageView
+    {
+        const U8* Pixels = nullptr;
+        U32 Width = 0;
+        U32 Height = 0;
+        Size RowPitch = 0;
+    };
+
+    /* 블록 압축된 이미지; RowPitch 는 블록 한 행의 크기 */
+    struct CompressedImageView
+    {
+        U8* Blocks = nullptr;
+        Size RowPitch = 0;
+    };
+
+    /*
+     * #sy_note 블록 압축(BCn) 인코더
+     * DirectXTex 의 CPU 코덱을 대체하기 위한 플랫폼 독립적인 인코더.
+     * BC1/BC3(색상) => 주성분 축 위의 엔드포인트를 RGB565 로 양자화 한 뒤, 4 단계 팔레트에 대한 최소 제곱 보정.
+     * BC4/BC5(채널) => Min/Max 엔드포인트의 8 단계 팔레트. Normal 이상에선 0/255 를 포함하는 6 단계 팔레트도 비교 한다.
+     * BC7 => Mode 6(단일 서브셋, RGBA 7.7.7.7 + p-bit, 4비트 인덱스) 만 사용 한다.
+     * 블록 내부 연산은 16 픽셀 고정 길이 배열 위의 루프로 작성 되어 컴파일러의 자동 벡터화 대상이 된다.
+     */
+    class BlockCompressor final
+    {
+    public:
+        [[nodiscard]] static Size GetBlockSize(const EBlockCompressionFormat format);
+        [[nodiscard]] static U32 GetNumBlocks(const U32 extent) { return std::max((extent + 3) / 4, 1u); }
+
+        /* pixels: 행 우선 4x4 RGBA8 픽셀 */
+        static void EncodeBlock(const EBlockCompressionFormat format, const ETextureCompressionQuality quality, const U8 (&pixels)[16][4], U8* dst);
+        /* BC7 은 이 인코더가 생성하는 Mode 6 블록만 디코딩 할 수 있다. */
+        [[nodiscard]] static bool DecodeBlock(const EBlockCompressionFormat format, const U8* src, U8 (&pixels)[16][4]);
+
+        /* 모든 이미지(Mip/Array Slice)의 블록 행을 하나의 작업 목록으로 평탄화 하여 taskExecutor 에서 병렬로 압축 한다. */
+        static void Compress(tf::Executor& taskExecutor, const EBlockCompressionFormat format, const ETextureCompressionQuality quality,
+            const std::span<const BlockImageView> srcImages, const std::span<const CompressedImageView> dstImages);
+
+        /* 압축 결과를 디코딩 하여 포맷이 사용하는 채널에 대한 PSNR(dB)을 계산 한다. */
+        [[nodiscard]] static F64 ComputePsnr(const EBlockCompressionFormat format, const BlockImageView& srcImage, const CompressedImageView& compressedImage);
+    };
+} // namespace ig::details
@@ -0,0 +1,388 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Asset/ClusterLodBuilder.h"
+
+namespace ig::details
+{
+    namespace
+    {
+        struct Cluster
+        {
+            /* meshopt_Meshlet 과 같은 형식; VertexIndices 는 메시 전체의 정점 인덱스, LocalTriangles 는 VertexIndices 내의 로컬 인덱스 */
+            Vector<U32> VertexIndices;
+            Vector<U8> LocalTriangles;
+
+            BoundingSphere LodBounds{};
+            F32 LodError = 0.f;
+            BoundingSphere ParentLodBounds{};
+            F32 ParentLodError = FLT_MAX;
+        };
+
+        const F32* GetPositions(const std::span<const Vertex> vertices)
+        {
+            return &vertices[0].Position.x;
+        }
+
+        Size GetNumTriangles(const Cluster& cluster)
+        {
+            return cluster.LocalTriangles.size() / Mesh::kNumVertexPerTriangle;
+        }
+
+        Vector<Cluster> Clusterize(const std::span<const Vertex> vertices, const std::span<const U32> indices)
+        {
+            constexpr F32 kConeWeight = 0.f;
+            const Size maxMeshlets = meshopt_buildMeshletsBound(indices.size(), Meshlet::kMaxVertices, Meshlet::kMaxTriangles);
+            Vector<meshopt_Meshlet> meshlets(maxMeshlets);
+            Vector<U32> meshletVertices(maxMeshlets * Meshlet::kMaxVertices);
+            Vector<U8> meshletTriangles(maxMeshlets * Meshlet::kMaxTriangles * Mesh::kNumVertexPerTriangle);
+            const Size numMeshlets = meshopt_buildMeshlets(
+                meshlets.data(), meshletVertices.data(), meshletTriangles.data(),
+                indices.data(), indices.size(),
+                GetPositions(vertices), vertices.size(), sizeof(Vertex),
+                Meshlet::kMaxVertices, Meshlet::kMaxTriangles, kConeWeight);
+
+            Vector<Cluster> clusters(numMeshlets);
+            for (Index meshletIdx = 0; meshletIdx < numMeshlets; ++meshletIdx)
+            {
+                const meshopt_Meshlet& meshlet = meshlets[meshletIdx];
+                meshopt_optimizeMeshlet(
+                    meshletVertices.data() + meshlet.vertex_offset,
+                    meshletTriangles.data() + meshlet.triangle_offset,
+                    meshlet.triangle_count, meshlet.vertex_count);
+
+                Cluster& cluster = clusters[meshletIdx];
+                cluster.VertexIndices.assign(
+                    meshletVertices.begin() + meshlet.vertex_offset,
+                    meshletVertices.begin() + meshlet.vertex_offset + meshlet.vertex_count);
+                cluster.LocalTriangles.assign(
+                    meshletTriangles.begin() + meshlet.triangle_offset,
+                    meshletTriangles.begin() + meshlet.triangle_offset + meshlet.triangle_count * Mesh::kNumVertexPerTriangle);
+            }
+
+            return clusters;
+        }
+
+        meshopt_Bounds ComputeBounds(const std::span<const Vertex> vertices, const Cluster& cluster)
+        {
+            return meshopt_computeMeshletBounds(
+                cluster.VertexIndices.data(), cluster.LocalTriangles.data(), GetNumTriangles(cluster),
+                GetPositions(vertices), vertices.size(), sizeof(Vertex));
+        }
+
+        /* 모든 구를 포함하는 구. 최소 구는 아니지만, 입력 순서와 무관하게 같은 결과를 보장 한다. */
+        BoundingSphere MergeSpheres(const std::span<const BoundingSphere> spheres)
+        {
+            IG_CHECK(!spheres.empty());
+            Vector3 min{FLT_MAX, FLT_MAX, FLT_MAX};
+            Vector3 max{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+            for (const BoundingSphere& sphere : spheres)
+            {
+                const Vector3 extent{sphere.Radius, sphere.Radius, sphere.Radius};
+                min = Vector3::Min(min, sphere.Centroid - extent);
+                max = Vector3::Max(max, sphere.Centroid + extent);
+            }
+
+            BoundingSphere merged{(min + max) * 0.5f, 0.f};
+            for (const BoundingSphere& sphere : spheres)
+            {
+                merged.Radius = std::max(merged.Radius, Vector3::Distance(merged.Centroid, sphere.Centroid) + sphere.Radius);
+            }
+
+            return merged;
+        }
+
+        bool ContainsSphere(const BoundingSphere& outer, const BoundingSphere& inner)
+        {
+            constexpr F32 kEpsilon = 1e-4f;
+            return Vector3::Distance(outer.Centroid, inner.Centroid) + inner.Radius <= outer.Radius * (1.f + kEpsilon) + kEpsilon;
+        }
+
+        /*
+         * 위치가 같은 정점(Attribute Seam)을 같은 정점으로 취급하여, 정점을 공유하는 Cluster 들을 인접한 것으로 본다.
+         * 시드 Cluster 에서 시작하여 그룹과 가장 많은 정점을 공유하는 Cluster 를 탐욕적으로 추가 한다. (동률인 경우 더 작은 인덱스)
+         */
+        Vector<Vector<U32>> GroupClusters(const std::span<const Cluster> clusters, const std::span<const U32> positionRemap)
+        {
+            UnorderedMap<U32, Vector<U32>> vertexClusters{};
+            for (U32 clusterIdx = 0; clusterIdx < clusters.size(); ++clusterIdx)
+            {
+                for (const U32 vertexIdx : clusters[clusterIdx].VertexIndices)
+                {
+                    Vector<U32>& sharedClusters = vertexClusters[positionRemap[vertexIdx]];
+                    if (sharedClusters.empty() || sharedClusters.back() != clusterIdx)
+                    {
+                        sharedClusters.emplace_back(clusterIdx);
+                    }
+                }
+            }
+
+            Vector<UnorderedMap<U32, U32>> adjacency(clusters.size());
+            for (const auto& [vertexIdx, sharedClusters] : vertexClusters)
+            {
+                for (Index lhs = 0; lhs < sharedClusters.size(); ++lhs)
+                {
+                    for (Index rhs = lhs + 1; rhs < sharedClusters.size(); ++rhs)
+                    {
+                        ++adjacency[sharedClusters[lhs]][sharedClusters[rhs]];
+                        ++adjacency[sharedClusters[rhs]][sharedClusters[lhs]];
+                    }
+                }
+            }
+
+            Vector<Vector<U32>> groups{};
+            Vector<bool> grouped(clusters.size(), false);
+            for (U32 seedIdx = 0; seedIdx < clusters.size(); ++seedIdx)
+            {
+                if (grouped[seedIdx])
+                {
+                    continue;
+                }
+
+                Vector<U32>& group = groups.emplace_back();
+                UnorderedMap<U32, U32> candidateWeights{};
+                U32 newMemberIdx = seedIdx;
+                while (true)
+                {
+                    group.emplace_back(newMemberIdx);
+                    grouped[newMemberIdx] = true;
+                    candidateWeights.erase(newMemberIdx);
+                    if (group.size() >= ClusterLodBuilder::kClusterGroupSize)
+                    {
+                        break;
+                    }
+
+                    for (const auto& [neighborIdx, weight] : adjacency[newMemberIdx])
+                    {
+                        if (!grouped[neighborIdx])
+                        {
+                            candidateWeights[neighborIdx] += weight;
+                        }
+                    }
+
+                    if (candidateWeights.empty())
+                    {
+                        break;
+                    }
+
+                    U32 bestIdx = std::numeric_limits<U32>::max();
+                    U32 bestWeight = 0;
+                    for (const auto& [candidateIdx, weight] : candidateWeights)
+                    {
+                        if (weight > bestWeight || (weight == bestWeight && candidateIdx < bestIdx))
+                        {
+                            bestIdx = candidateIdx;
+                            bestWeight = weight;
+                        }
+                    }
+                    newMemberIdx = bestIdx;
+                }
+            }
+
+            return groups;
+        }
+
+        ClusterLodLevel MakeLevel(const std::span<const Vertex> vertices, const std::span<const Cluster> clusters)
+        {
+            ClusterLodLevel level{};
+            level.Meshlets.resize(clusters.size());
+            for (Index clusterIdx = 0; clusterIdx < clusters.size(); ++clusterIdx)
+            {
+                const Cluster& cluster = clusters[clusterIdx];
+                const meshopt_Bounds bounds = ComputeBounds(vertices, cluster);
+
+                Meshlet& meshlet = level.Meshlets[clusterIdx];
+                meshlet.IndexOffset = (U32)level.MeshletVertexIndices.size();
+                meshlet.NumIndices = (U32)cluster.VertexIndices.size();
+                meshlet.TriangleOffset = (U32)level.MeshletTriangles.size();
+                meshlet.NumTriangles = (U32)GetNumTriangles(cluster);
+                level.MeshletVertexIndices.insert(level.MeshletVertexIndices.end(), cluster.VertexIndices.begin(), cluster.VertexIndices.end());
+                for (Index triangleIdx = 0; triangleIdx < meshlet.NumTriangles; ++triangleIdx)
+                {
+                    level.MeshletTriangles.emplace_back(
+                        EncodeTriangleU32(
+                            cluster.LocalTriangles[triangleIdx * Mesh::kNumVertexPerTriangle + 0],
+                            cluster.LocalTriangles[triangleIdx * Mesh::kNumVertexPerTriangle + 1],
+                            cluster.LocalTriangles[triangleIdx * Mesh::kNumVertexPerTriangle + 2]));
+                }
+
+                meshlet.BoundingVolume = BoundingSphere{
+                    Vector3{bounds.center[0], bounds.center[1], bounds.center[2]},
+                    bounds.radius
+                };
+                meshlet.QuantizedNormalConeAxis[0] = (U8)(bounds.cone_axis_s8[0] + 127);
+                meshlet.QuantizedNormalConeAxis[1] = (U8)(bounds.cone_axis_s8[1] + 127);
+                meshlet.QuantizedNormalConeAxis[2] = (U8)(bounds.cone_axis_s8[2] + 127);
+                meshlet.QuantizedNormalConeCutoff = (U8)(bounds.cone_cutoff_s8 + 127);
+
+                meshlet.LodBounds = cluster.LodBounds;
+                meshlet.LodError = cluster.LodError;
+                meshlet.ParentLodBounds = cluster.ParentLodBounds;
+                meshlet.ParentLodError = cluster.ParentLodError;
+            }
+
+            return level;
+        }
+    } // namespace
+
+    ClusterLodHierarchy ClusterLodBuilder::Build(const std::span<const Vertex> vertices, const std::span<const U32> indices, const U8 maxNumLevels)
+    {
+        IG_CHECK(!vertices.empty());
+        IG_CHECK(!indices.empty() && (indices.size() % Mesh::kNumVertexPerTriangle) == 0);
+        IG_CHECK(maxNumLevels >= 1);
+
+        Vector<U32> positionRemap(vertices.size());
+        const meshopt_Stream positionStream{GetPositions(vertices), sizeof(F32) * 3, sizeof(Vertex)};
+        meshopt_generateVertexRemapMulti(positionRemap.data(), nullptr, vertices.size(), vertices.size(), &positionStream, 1);
+        /* meshopt_simplify 의 오차는 메시 크기에 대한 상대 값 */
+        const F32 errorScale = meshopt_simplifyScale(GetPositions(vertices), vertices.size(), sizeof(Vertex));
+
+        ClusterLodHierarchy hierarchy{};
+        Vector<Cluster> clusters = Clusterize(vertices, indices);
+        for (Cluster& cluster : clusters)
+        {
+            const meshopt_Bounds bounds = ComputeBounds(vertices, cluster);
+            cluster.LodBounds = BoundingSphere{Vector3{bounds.center[0], bounds.center[1], bounds.center[2]}, bounds.radius};
+            cluster.LodError = 0.f;
+        }
+
+        Vector<U32> groupIndices{};
+        Vector<U32> simplifiedIndices{};
+        Vector<BoundingSphere> childBounds{};
+        while (hierarchy.Levels.size() + 1 < maxNumLevels && clusters.size() > 1)
+        {
+            Size numTriangles = 0;
+            for (const Cluster& cluster : clusters)
+            {
+                numTriangles += GetNumTriangles(cluster);
+            }
+
+            Vector<Cluster> parentClusters{};
+            Vector<Cluster> childClusters = clusters;
+            Size numParentTriangles = 0;
+            for (const Vector<U32>& group : GroupClusters(clusters, positionRemap))
+            {
+                groupIndices.clear();
+                childBounds.clear();
+                F32 groupError = 0.f;
+                for (const U32 clusterIdx : group)
+                {
+                    const Cluster& cluster = clusters[clusterIdx];
+                    for (const U8 localIdx : cluster.LocalTriangles)
+                    {
+                        groupIndices.emplace_back(cluster.VertexIndices[localIdx]);
+                    }
+                    childBounds.emplace_back(cluster.LodBounds);
+                    groupError = std::max(groupError, cluster.LodError);
+                }
+
+                /* 그룹의 경계를 고정해야 인접한 그룹이 서로 다른 단계로 선택 되어도 균열이 생기지 않는다. */
+                const Size targetNumIndices = (groupIndices.size() / (Mesh::kNumVertexPerTriangle * 2)) * Mesh::kNumVertexPerTriangle;
+                simplifiedIndices.resize(groupIndices.size());
+                F32 simplifyError = 0.f;
+                const Size numSimplifiedIndices = meshopt_simplify(
+                    simplifiedIndices.data(),
+                    groupIndices.data(), groupIndices.size(),
+                    GetPositions(vertices), vertices.size(), sizeof(Vertex),
+                    targetNumIndices, FLT_MAX, meshopt_SimplifyLockBorder, &simplifyError);
+                if (numSimplifiedIndices == 0 || numSimplifiedIndices >= groupIndices.size())
+                {
+                    /* 단순화 할 수 없는 그룹은 그대로 다음 단계로 옮겨 각 단계가 항상 메시 전체를 덮도록 한다. */
+                    simplifiedIndices = groupIndices;
+                    simplifyError = 0.f;
+                }
+                else
+                {
+                    simplifiedIndices.resize(numSimplifiedIndices);
+                }
+
+                const BoundingSphere groupBounds = MergeSpheres(childBounds);
+                groupError = std::max(groupError, simplifyError * errorScale);
+                for (const U32 clusterIdx : group)
+                {
+                    childClusters[clusterIdx].ParentLodBounds = groupBounds;
+                    childClusters[clusterIdx].ParentLodError = groupError;
+                }
+
+                for (Cluster& parentCluster : Clusterize(vertices, simplifiedIndices))
+                {
+                    parentCluster.LodBounds = groupBounds;
+                    parentCluster.LodError = groupError;
+                    numParentTriangles += GetNumTriangles(parentCluster);
+                    parentClusters.emplace_back(std::move(parentCluster));
+                }
+            }
+
+            if ((F32)numParentTriangles > (F32)numTriangles * kMinTriangleReductionRatio)
+            {
+                break;
+            }
+
+            hierarchy.Levels.emplace_back(MakeLevel(vertices, childClusters));
+            clusters = std::move(parentClusters);
+        }
+
+        /* 최상위 단계 */
+        for (Cluster& cluster : clusters)
+        {
+            cluster.ParentLodBounds = cluster.LodBounds;
+            cluster.ParentLodError = FLT_MAX;
+        }
+        hierarchy.Levels.emplace_back(MakeLevel(vertices, clusters));
+
+        return hierarchy;
+    }
+
+    bool ClusterLodBuilder::ValidateErrorMonotonicity(const ClusterLodHierarchy& hierarchy)
+    {
+        if (hierarchy.Levels.empty())
+        {
+            return false;
+        }
+
+        using GroupKey = std::tuple<F32, F32, F32, F32, F32>;
+        const auto kMakeGroupKey = [](const BoundingSphere& bounds, const F32 error)
+        {
+            return GroupKey{error, bounds.Centroid.x, bounds.Centroid.y, bounds.Centroid.z, bounds.Radius};
+        };
+
+        for (Index levelIdx = 0; levelIdx < hierarchy.Levels.size(); ++levelIdx)
+        {
+            const bool bIsRootLevel = (levelIdx + 1) == hierarchy.Levels.size();
+            Vector<GroupKey> parentGroupKeys{};
+            if (!bIsRootLevel)
+            {
+                for (const Meshlet& parentMeshlet : hierarchy.Levels[levelIdx + 1].Meshlets)
+                {
+                    parentGroupKeys.emplace_back(kMakeGroupKey(parentMeshlet.LodBounds, parentMeshlet.LodError));
+                }
+                std::sort(parentGroupKeys.begin(), parentGroupKeys.end());
+            }
+
+            for (const Meshlet& meshlet : hierarchy.Levels[levelIdx].Meshlets)
+            {
+                if (levelIdx == 0 && meshlet.LodError != 0.f)
+                {
+                    return false;
+                }
+
+                if (meshlet.LodError > meshlet.ParentLodError || !ContainsSphere(meshlet.ParentLodBounds, meshlet.LodBounds))
+                {
+                    return false;
+                }
+
+                if (bIsRootLevel != (meshlet.ParentLodError == FLT_MAX))
+                {
+                    return false;
+                }
+
+                /* 부모 그룹이 다음 단계에 실제로 존재해야 한다. */
+                if (!bIsRootLevel &&
+                    !std::binary_search(parentGroupKeys.begin(), parentGroupKeys.end(), kMakeGroupKey(meshlet.ParentLodBounds, meshlet.ParentLodError)))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+} // namespace ig::details
@@ -0,0 +1,47 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Render/Vertex.h"
+#include "Igniter/Render/Mesh.h"
+
+namespace ig::details
+{
+    /* 계층의 한 단계. 메시 전체를 덮으며, StaticMeshImporter 의 LOD 하나에 대응 된다. */
+    struct ClusterLodLevel
+    {
+    public:
+        Vector<U32> MeshletVertexIndices;
+        Vector<U32> MeshletTriangles;
+        Vector<Meshlet> Meshlets;
+    };
+
+    struct ClusterLodHierarchy
+    {
+    public:
+        Vector<ClusterLodLevel> Levels;
+    };
+
+    /*
+     * #sy_note Cluster LOD 계층(DAG) 생성
+     * LOD0 를 Meshlet(Cluster)로 나눈 뒤, 매 단계 마다
+     * 1. 경계 정점을 공유하는 Cluster 들을 kClusterGroupSize 개 씩 그룹으로 묶고
+     * 2. 그룹의 경계(다른 그룹과 공유 되는 Edge)를 고정한 채로 절반 만큼 단순화 한 다음
+     * 3. 단순화 결과를 다시 Cluster 로 나누어 다음 단계를 구성 한다.
+     * 그룹의 오차는 (자식 오차의 최대값, 단순화 오차) 중 큰 값, 경계는 자식 경계를 모두 포함하는 구로 정해지기 때문에
+     * 부모로 갈 수록 오차와 경계가 단조 증가 한다. 따라서 Meshlet 마다
+     * (Project(LodBounds, LodError) <= Threshold < Project(ParentLodBounds, ParentLodError)) 를 독립적으로 판단하여도 균열이 생기지 않는다.
+     * 각 단계는 메시 전체를 덮기 때문에, 단계 단위로 스트리밍(StaticMeshStreamer) 하거나 LOD로 사용 할 수 있다.
+     * 모든 연산은 입력 순서에만 의존하므로 결과는 결정적(Deterministic)이다.
+     */
+    class ClusterLodBuilder final
+    {
+    public:
+        constexpr static Size kClusterGroupSize = 4;
+        /* 한 단계에서 삼각형 수가 이 비율 이하로 줄어들지 않으면 더 이상 단계를 만들지 않는다. */
+        constexpr static F32 kMinTriangleReductionRatio = 0.85f;
+
+    public:
+        [[nodiscard]] static ClusterLodHierarchy Build(const std::span<const Vertex> vertices, const std::span<const U32> indices, const U8 maxNumLevels);
+        /* 모든 단계의 Meshlet 이 오차 단조성(LodError <= ParentLodError, ParentLodBounds ⊇ LodBounds)과 부모-자식 연결을 만족하는지 검증 */
+        [[nodiscard]] static bool ValidateErrorMonotonicity(const ClusterLodHierarchy& hierarchy);
+    };
+} // namespace ig::details
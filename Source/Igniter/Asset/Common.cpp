@@ -100,6 +100,8 @@ namespace ig
             return Path{details::SkeletalMeshAssetRootPath};
         case EAssetCategory::Audio:
             return Path{details::AudioAssetRootPath};
+        case EAssetCategory::Animation:
+            return Path{details::AnimationAssetRootPath};
         case EAssetCategory::Material:
             return Path{details::MaterialAssetRootPath};
         case EAssetCategory::Map:
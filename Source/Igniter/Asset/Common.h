@@ -13,10 +13,14 @@ namespace ig::details
     inline constexpr std::string_view TextureAssetRootPath = "Assets\\Textures";
     inline constexpr std::string_view StaticMeshAssetRootPath = "Assets\\StaticMeshes";
     inline constexpr std::string_view SkeletalMeshAssetRootPath = "Assets\\SkeletalMeshes";
+    inline constexpr std::string_view AnimationAssetRootPath = "Assets\\Animations";
     inline constexpr std::string_view AudioAssetRootPath = "Assets\\Audios";
     inline constexpr std::string_view ScriptAssetRootPath = "Assets\\Scripts";
     inline constexpr std::string_view MaterialAssetRootPath = "Assets\\Materials";
     inline constexpr std::string_view MapAssetRootPath = "Assets\\Maps";
+    inline constexpr std::string_view MetadataIndexPath = "Assets\\Metadata.index";
+    inline constexpr std::string_view DefaultAssetPackagePath = "Assets\\Assets.igpak";
+    inline constexpr std::string_view ImportCacheRootPath = "ImportCache";
 } // namespace ig::details
 
 namespace ig
@@ -35,6 +39,7 @@ namespace ig
         Audio,
         Material,
         Map,
+        Animation,
     };
 
     template <typename T>
@@ -47,6 +52,10 @@ namespace ig
     template <>
     constexpr inline EAssetCategory AssetCategoryOf<class StaticMesh> = EAssetCategory::StaticMesh;
     template <>
+    constexpr inline EAssetCategory AssetCategoryOf<class SkeletalMesh> = EAssetCategory::SkeletalMesh;
+    template <>
+    constexpr inline EAssetCategory AssetCategoryOf<class AnimationClip> = EAssetCategory::Animation;
+    template <>
     constexpr inline EAssetCategory AssetCategoryOf<class Texture> = EAssetCategory::Texture;
     template <>
     constexpr inline EAssetCategory AssetCategoryOf<class AudioClip> = EAssetCategory::Audio;
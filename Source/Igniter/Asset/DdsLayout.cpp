@@ -0,0 +1,522 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Asset/DdsLayout.h"
+
+namespace ig::details
+{
+    namespace
+    {
+        /* https://learn.microsoft.com/en-us/windows/win32/direct3ddds/dds-header */
+        constexpr U32 kDdsMagic = 0x20534444; /* "DDS " */
+        constexpr U32 kDdsHeaderSize = 124;
+        constexpr U32 kDdsPixelFormatSize = 32;
+        constexpr Size kDdsLegacyHeaderEnd = 4 + kDdsHeaderSize;
+
+        constexpr Size kHeightOffset = 12;
+        constexpr Size kWidthOffset = 16;
+        constexpr Size kDepthOffset = 24;
+        constexpr Size kMipMapCountOffset = 28;
+        constexpr Size kPixelFormatOffset = 76;
+        constexpr Size kCaps2Offset = 112;
+
+        constexpr U32 kPixelFormatAlphaPixels = 0x1;
+        constexpr U32 kPixelFormatAlpha = 0x2;
+        constexpr U32 kPixelFormatFourCC = 0x4;
+        constexpr U32 kPixelFormatRgb = 0x40;
+        constexpr U32 kPixelFormatLuminance = 0x20000;
+        constexpr U32 kPixelFormatBumpDuDv = 0x80000;
+
+        constexpr U32 kCaps2Cubemap = 0x200;
+        constexpr U32 kCaps2CubemapAllFaces = 0xFC00;
+        constexpr U32 kCaps2Volume = 0x200000;
+
+        constexpr U32 kDx10ResourceDimensionTex1D = 2;
+        constexpr U32 kDx10ResourceDimensionTex2D = 3;
+        constexpr U32 kDx10ResourceDimensionTex3D = 4;
+        constexpr U32 kDx10MiscTextureCube = 0x4;
+
+        constexpr U16 kMaxMipLevels = 16;
+
+        constexpr U32 MakeFourCC(const char c0, const char c1, const char c2, const char c3)
+        {
+            return static_cast<U32>(static_cast<U8>(c0)) | (static_cast<U32>(static_cast<U8>(c1)) << 8) |
+                   (static_cast<U32>(static_cast<U8>(c2)) << 16) | (static_cast<U32>(static_cast<U8>(c3)) << 24);
+        }
+
+        /* DDS 는 Little-Endian 으로 기록 된다. */
+        U32 ReadU32(const std::span<const U8> bytes, const Size offset)
+        {
+            IG_CHECK(offset + sizeof(U32) <= bytes.size());
+            return static_cast<U32>(bytes[offset]) | (static_cast<U32>(bytes[offset + 1]) << 8) | (static_cast<U32>(bytes[offset + 2]) << 16) |
+                   (static_cast<U32>(bytes[offset + 3]) << 24);
+        }
+
+        struct DdsPixelFormat
+        {
+        public:
+            [[nodiscard]] bool HasMasks(const U32 r, const U32 g, const U32 b, const U32 a) const noexcept
+            {
+                return RMask == r && GMask == g && BMask == b && AMask == a;
+            }
+
+        public:
+            U32 Flags = 0;
+            U32 FourCC = 0;
+            U32 RgbBitCount = 0;
+            U32 RMask = 0;
+            U32 GMask = 0;
+            U32 BMask = 0;
+            U32 AMask = 0;
+        };
+
+        /* DirectXTex 의 GetDXGIFormat 이 해석하는 레거시 픽셀 포맷 중 DXGI 포맷으로 직접 대응 되는 것들 */
+        DXGI_FORMAT AsDxgiFormat(const DdsPixelFormat& pixelFormat)
+        {
+            if (pixelFormat.Flags & kPixelFormatFourCC)
+            {
+                switch (pixelFormat.FourCC)
+                {
+                case MakeFourCC('D', 'X', 'T', '1'):
+                    return DXGI_FORMAT_BC1_UNORM;
+                case MakeFourCC('D', 'X', 'T', '2'):
+                case MakeFourCC('D', 'X', 'T', '3'):
+                    return DXGI_FORMAT_BC2_UNORM;
+                case MakeFourCC('D', 'X', 'T', '4'):
+                case MakeFourCC('D', 'X', 'T', '5'):
+                    return DXGI_FORMAT_BC3_UNORM;
+                case MakeFourCC('A', 'T', 'I', '1'):
+                case MakeFourCC('B', 'C', '4', 'U'):
+                    return DXGI_FORMAT_BC4_UNORM;
+                case MakeFourCC('B', 'C', '4', 'S'):
+                    return DXGI_FORMAT_BC4_SNORM;
+                case MakeFourCC('A', 'T', 'I', '2'):
+                case MakeFourCC('B', 'C', '5', 'U'):
+                    return DXGI_FORMAT_BC5_UNORM;
+                case MakeFourCC('B', 'C', '5', 'S'):
+                    return DXGI_FORMAT_BC5_SNORM;
+                /* D3DFORMAT 값이 FourCC 로 기록 된 경우 */
+                case 36:
+                    return DXGI_FORMAT_R16G16B16A16_UNORM;
+                case 110:
+                    return DXGI_FORMAT_R16G16B16A16_SNORM;
+                case 111:
+                    return DXGI_FORMAT_R16_FLOAT;
+                case 112:
+                    return DXGI_FORMAT_R16G16_FLOAT;
+                case 113:
+                    return DXGI_FORMAT_R16G16B16A16_FLOAT;
+                case 114:
+                    return DXGI_FORMAT_R32_FLOAT;
+                case 115:
+                    return DXGI_FORMAT_R32G32_FLOAT;
+                case 116:
+                    return DXGI_FORMAT_R32G32B32A32_FLOAT;
+                default:
+                    return DXGI_FORMAT_UNKNOWN;
+                }
+            }
+
+            if (pixelFormat.Flags & kPixelFormatRgb)
+            {
+                if (pixelFormat.RgbBitCount == 32)
+                {
+                    if (pixelFormat.HasMasks(0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000))
+                    {
+                        return DXGI_FORMAT_R8G8B8A8_UNORM;
+                    }
+                    if (pixelFormat.HasMasks(0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000))
+                    {
+                        return DXGI_FORMAT_B8G8R8A8_UNORM;
+                    }
+                    if (pixelFormat.HasMasks(0x00FF0000, 0x0000FF00, 0x000000FF, 0))
+                    {
+                        return DXGI_FORMAT_B8G8R8X8_UNORM;
+                    }
+                    /* 대부분의 도구가 10:10:10:2 포맷의 R/B 마스크를 뒤바꿔 기록 하므로 DirectXTex 와 동일하게 해석 한다. */
+                    if (pixelFormat.HasMasks(0x3FF00000, 0x000FFC00, 0x000003FF, 0xC0000000))
+                    {
+                        return DXGI_FORMAT_R10G10B10A2_UNORM;
+                    }
+                    if (pixelFormat.HasMasks(0x0000FFFF, 0xFFFF0000, 0, 0))
+                    {
+                        return DXGI_FORMAT_R16G16_UNORM;
+                    }
+                    if (pixelFormat.HasMasks(0xFFFFFFFF, 0, 0, 0))
+                    {
+                        return DXGI_FORMAT_R32_FLOAT;
+                    }
+                }
+                else if (pixelFormat.RgbBitCount == 16)
+                {
+                    if (pixelFormat.HasMasks(0x7C00, 0x03E0, 0x001F, 0x8000))
+                    {
+                        return DXGI_FORMAT_B5G5R5A1_UNORM;
+                    }
+                    if (pixelFormat.HasMasks(0xF800, 0x07E0, 0x001F, 0))
+                    {
+                        return DXGI_FORMAT_B5G6R5_UNORM;
+                    }
+                    if (pixelFormat.HasMasks(0x0F00, 0x00F0, 0x000F, 0xF000))
+                    {
+                        return DXGI_FORMAT_B4G4R4A4_UNORM;
+                    }
+                }
+
+                return DXGI_FORMAT_UNKNOWN;
+            }
+
+            if (pixelFormat.Flags & kPixelFormatLuminance)
+            {
+                if (pixelFormat.RgbBitCount == 8 && pixelFormat.HasMasks(0xFF, 0, 0, 0))
+                {
+                    return DXGI_FORMAT_R8_UNORM;
+                }
+                if (pixelFormat.RgbBitCount == 16)
+                {
+                    if (pixelFormat.HasMasks(0xFFFF, 0, 0, 0))
+                    {
+                        return DXGI_FORMAT_R16_UNORM;
+                    }
+                    if ((pixelFormat.Flags & kPixelFormatAlphaPixels) && pixelFormat.HasMasks(0x00FF, 0, 0, 0xFF00))
+                    {
+                        return DXGI_FORMAT_R8G8_UNORM;
+                    }
+                }
+
+                return DXGI_FORMAT_UNKNOWN;
+            }
+
+            if (pixelFormat.Flags & kPixelFormatAlpha)
+            {
+                return pixelFormat.RgbBitCount == 8 ? DXGI_FORMAT_A8_UNORM : DXGI_FORMAT_UNKNOWN;
+            }
+
+            if (pixelFormat.Flags & kPixelFormatBumpDuDv)
+            {
+                if (pixelFormat.RgbBitCount == 16 && pixelFormat.HasMasks(0x00FF, 0xFF00, 0, 0))
+                {
+                    return DXGI_FORMAT_R8G8_SNORM;
+                }
+                if (pixelFormat.RgbBitCount == 32)
+                {
+                    if (pixelFormat.HasMasks(0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000))
+                    {
+                        return DXGI_FORMAT_R8G8B8A8_SNORM;
+                    }
+                    if (pixelFormat.HasMasks(0x0000FFFF, 0xFFFF0000, 0, 0))
+                    {
+                        return DXGI_FORMAT_R16G16_SNORM;
+                    }
+                }
+            }
+
+            return DXGI_FORMAT_UNKNOWN;
+        }
+    } // namespace
+
+    Result<DdsLayout, EDdsParseStatus> DdsLayoutParser::Parse(const std::span<const U8> header, const Size fileSize)
+    {
+        if (header.size() < kDdsLegacyHeaderEnd || fileSize < header.size())
+        {
+            return MakeFail<DdsLayout, EDdsParseStatus::NotEnoughData>();
+        }
+
+        if (ReadU32(header, 0) != kDdsMagic)
+        {
+            return MakeFail<DdsLayout, EDdsParseStatus::InvalidMagic>();
+        }
+
+        if (ReadU32(header, 4) != kDdsHeaderSize || ReadU32(header, kPixelFormatOffset) != kDdsPixelFormatSize)
+        {
+            return MakeFail<DdsLayout, EDdsParseStatus::InvalidHeader>();
+        }
+
+        DdsLayout layout{};
+        layout.Width = ReadU32(header, kWidthOffset);
+        layout.Height = ReadU32(header, kHeightOffset);
+        layout.MipLevels = static_cast<U16>(std::max(ReadU32(header, kMipMapCountOffset), 1u));
+        if (layout.Width == 0 || layout.Height == 0 || ReadU32(header, kMipMapCountOffset) > kMaxMipLevels)
+        {
+            return MakeFail<DdsLayout, EDdsParseStatus::InvalidHeader>();
+        }
+
+        const DdsPixelFormat pixelFormat{
+            .Flags = ReadU32(header, kPixelFormatOffset + 4),
+            .FourCC = ReadU32(header, kPixelFormatOffset + 8),
+            .RgbBitCount = ReadU32(header, kPixelFormatOffset + 12),
+            .RMask = ReadU32(header, kPixelFormatOffset + 16),
+            .GMask = ReadU32(header, kPixelFormatOffset + 20),
+            .BMask = ReadU32(header, kPixelFormatOffset + 24),
+            .AMask = ReadU32(header, kPixelFormatOffset + 28),
+        };
+        const U32 caps2 = ReadU32(header, kCaps2Offset);
+
+        if ((pixelFormat.Flags & kPixelFormatFourCC) && pixelFormat.FourCC == MakeFourCC('D', 'X', '1', '0'))
+        {
+            constexpr Size kDx10HeaderEnd = kDdsLegacyHeaderEnd + 20;
+            static_assert(kDx10HeaderEnd == kMaxHeaderSize);
+            if (header.size() < kDx10HeaderEnd)
+            {
+                return MakeFail<DdsLayout, EDdsParseStatus::NotEnoughData>();
+            }
+
+            layout.Format = static_cast<DXGI_FORMAT>(ReadU32(header, kDdsLegacyHeaderEnd));
+            const U32 resourceDimension = ReadU32(header, kDdsLegacyHeaderEnd + 4);
+            const U32 miscFlag = ReadU32(header, kDdsLegacyHeaderEnd + 8);
+            layout.ArraySize = ReadU32(header, kDdsLegacyHeaderEnd + 12);
+            layout.PayloadOffset = kDx10HeaderEnd;
+            if (layout.ArraySize == 0)
+            {
+                return MakeFail<DdsLayout, EDdsParseStatus::InvalidHeader>();
+            }
+
+            switch (resourceDimension)
+            {
+            case kDx10ResourceDimensionTex1D:
+                if (layout.Height != 1)
+                {
+                    return MakeFail<DdsLayout, EDdsParseStatus::InvalidHeader>();
+                }
+                layout.Dimension = ETextureDimension::Tex1D;
+                break;
+            case kDx10ResourceDimensionTex2D:
+                layout.Dimension = ETextureDimension::Tex2D;
+                if (miscFlag & kDx10MiscTextureCube)
+                {
+                    layout.bIsCubemap = true;
+                    layout.ArraySize *= 6;
+                }
+                break;
+            case kDx10ResourceDimensionTex3D:
+                if (layout.ArraySize != 1)
+                {
+                    return MakeFail<DdsLayout, EDdsParseStatus::InvalidHeader>();
+                }
+                layout.Dimension = ETextureDimension::Tex3D;
+                layout.Depth = std::max(ReadU32(header, kDepthOffset), 1u);
+                break;
+            default:
+                return MakeFail<DdsLayout, EDdsParseStatus::UnsupportedDimension>();
+            }
+        }
+        else
+        {
+            layout.Format = AsDxgiFormat(pixelFormat);
+            layout.PayloadOffset = kDdsLegacyHeaderEnd;
+            if (caps2 & kCaps2Volume)
+            {
+                layout.Dimension = ETextureDimension::Tex3D;
+                layout.Depth = std::max(ReadU32(header, kDepthOffset), 1u);
+            }
+            else if (caps2 & kCaps2Cubemap)
+            {
+                if ((caps2 & kCaps2CubemapAllFaces) != kCaps2CubemapAllFaces)
+                {
+                    return MakeFail<DdsLayout, EDdsParseStatus::UnsupportedDimension>();
+                }
+                layout.bIsCubemap = true;
+                layout.ArraySize = 6;
+            }
+        }
+
+        const U32 maxExtent = std::max({layout.Width, layout.Height, layout.Depth});
+        if (layout.MipLevels > std::bit_width(maxExtent))
+        {
+            return MakeFail<DdsLayout, EDdsParseStatus::InvalidHeader>();
+        }
+
+        /* 파일 내의 페이로드는 Array Slice 우선, 그 안에서 Mip 순서로 배치 된다. 이는 D3D12 서브리소스 인덱스 순서와 같다. */
+        layout.Subresources.reserve(static_cast<Size>(layout.ArraySize) * layout.MipLevels);
+        Size offset = layout.PayloadOffset;
+        for (U32 item = 0; item < layout.ArraySize; ++item)
+        {
+            for (U16 mip = 0; mip < layout.MipLevels; ++mip)
+            {
+                DdsSubresourceLayout& subresource = layout.Subresources.emplace_back();
+                if (!ComputePitch(layout.Format, std::max(layout.Width >> mip, 1u), std::max(layout.Height >> mip, 1u), subresource.RowPitch,
+                        subresource.NumRows))
+                {
+                    return MakeFail<DdsLayout, EDdsParseStatus::UnsupportedFormat>();
+                }
+
+                subresource.Offset = offset;
+                subresource.SlicePitch = subresource.RowPitch * subresource.NumRows;
+                subresource.Depth = std::max(layout.Depth >> mip, 1u);
+                offset += subresource.SlicePitch * subresource.Depth;
+            }
+        }
+
+        if (offset > fileSize)
+        {
+            return MakeFail<DdsLayout, EDdsParseStatus::TruncatedPayload>();
+        }
+
+        return MakeSuccess<DdsLayout, EDdsParseStatus>(std::move(layout));
+    }
+
+    U32 DdsLayoutParser::GetBitsPerPixel(const DXGI_FORMAT format)
+    {
+        switch (format)
+        {
+        case DXGI_FORMAT_R32G32B32A32_TYPELESS:
+        case DXGI_FORMAT_R32G32B32A32_FLOAT:
+        case DXGI_FORMAT_R32G32B32A32_UINT:
+        case DXGI_FORMAT_R32G32B32A32_SINT:
+            return 128;
+
+        case DXGI_FORMAT_R32G32B32_TYPELESS:
+        case DXGI_FORMAT_R32G32B32_FLOAT:
+        case DXGI_FORMAT_R32G32B32_UINT:
+        case DXGI_FORMAT_R32G32B32_SINT:
+            return 96;
+
+        case DXGI_FORMAT_R16G16B16A16_TYPELESS:
+        case DXGI_FORMAT_R16G16B16A16_FLOAT:
+        case DXGI_FORMAT_R16G16B16A16_UNORM:
+        case DXGI_FORMAT_R16G16B16A16_UINT:
+        case DXGI_FORMAT_R16G16B16A16_SNORM:
+        case DXGI_FORMAT_R16G16B16A16_SINT:
+        case DXGI_FORMAT_R32G32_TYPELESS:
+        case DXGI_FORMAT_R32G32_FLOAT:
+        case DXGI_FORMAT_R32G32_UINT:
+        case DXGI_FORMAT_R32G32_SINT:
+            return 64;
+
+        case DXGI_FORMAT_R10G10B10A2_TYPELESS:
+        case DXGI_FORMAT_R10G10B10A2_UNORM:
+        case DXGI_FORMAT_R10G10B10A2_UINT:
+        case DXGI_FORMAT_R11G11B10_FLOAT:
+        case DXGI_FORMAT_R8G8B8A8_TYPELESS:
+        case DXGI_FORMAT_R8G8B8A8_UNORM:
+        case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+        case DXGI_FORMAT_R8G8B8A8_UINT:
+        case DXGI_FORMAT_R8G8B8A8_SNORM:
+        case DXGI_FORMAT_R8G8B8A8_SINT:
+        case DXGI_FORMAT_R16G16_TYPELESS:
+        case DXGI_FORMAT_R16G16_FLOAT:
+        case DXGI_FORMAT_R16G16_UNORM:
+        case DXGI_FORMAT_R16G16_UINT:
+        case DXGI_FORMAT_R16G16_SNORM:
+        case DXGI_FORMAT_R16G16_SINT:
+        case DXGI_FORMAT_R32_TYPELESS:
+        case DXGI_FORMAT_R32_FLOAT:
+        case DXGI_FORMAT_R32_UINT:
+        case DXGI_FORMAT_R32_SINT:
+        case DXGI_FORMAT_R9G9B9E5_SHAREDEXP:
+        case DXGI_FORMAT_R10G10B10_XR_BIAS_A2_UNORM:
+        case DXGI_FORMAT_B8G8R8A8_TYPELESS:
+        case DXGI_FORMAT_B8G8R8A8_UNORM:
+        case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+        case DXGI_FORMAT_B8G8R8X8_TYPELESS:
+        case DXGI_FORMAT_B8G8R8X8_UNORM:
+        case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
+            return 32;
+
+        case DXGI_FORMAT_R8G8_TYPELESS:
+        case DXGI_FORMAT_R8G8_UNORM:
+        case DXGI_FORMAT_R8G8_UINT:
+        case DXGI_FORMAT_R8G8_SNORM:
+        case DXGI_FORMAT_R8G8_SINT:
+        case DXGI_FORMAT_R16_TYPELESS:
+        case DXGI_FORMAT_R16_FLOAT:
+        case DXGI_FORMAT_R16_UNORM:
+        case DXGI_FORMAT_R16_UINT:
+        case DXGI_FORMAT_R16_SNORM:
+        case DXGI_FORMAT_R16_SINT:
+        case DXGI_FORMAT_B5G6R5_UNORM:
+        case DXGI_FORMAT_B5G5R5A1_UNORM:
+        case DXGI_FORMAT_B4G4R4A4_UNORM:
+            return 16;
+
+        case DXGI_FORMAT_R8_TYPELESS:
+        case DXGI_FORMAT_R8_UNORM:
+        case DXGI_FORMAT_R8_UINT:
+        case DXGI_FORMAT_R8_SNORM:
+        case DXGI_FORMAT_R8_SINT:
+        case DXGI_FORMAT_A8_UNORM:
+            return 8;
+
+        case DXGI_FORMAT_BC1_TYPELESS:
+        case DXGI_FORMAT_BC1_UNORM:
+        case DXGI_FORMAT_BC1_UNORM_SRGB:
+        case DXGI_FORMAT_BC4_TYPELESS:
+        case DXGI_FORMAT_BC4_UNORM:
+        case DXGI_FORMAT_BC4_SNORM:
+            return 4;
+
+        case DXGI_FORMAT_BC2_TYPELESS:
+        case DXGI_FORMAT_BC2_UNORM:
+        case DXGI_FORMAT_BC2_UNORM_SRGB:
+        case DXGI_FORMAT_BC3_TYPELESS:
+        case DXGI_FORMAT_BC3_UNORM:
+        case DXGI_FORMAT_BC3_UNORM_SRGB:
+        case DXGI_FORMAT_BC5_TYPELESS:
+        case DXGI_FORMAT_BC5_UNORM:
+        case DXGI_FORMAT_BC5_SNORM:
+        case DXGI_FORMAT_BC6H_TYPELESS:
+        case DXGI_FORMAT_BC6H_UF16:
+        case DXGI_FORMAT_BC6H_SF16:
+        case DXGI_FORMAT_BC7_TYPELESS:
+        case DXGI_FORMAT_BC7_UNORM:
+        case DXGI_FORMAT_BC7_UNORM_SRGB:
+            return 8;
+
+        default:
+            return 0;
+        }
+    }
+
+    U32 DdsLayoutParser::GetBytesPerBlock(const DXGI_FORMAT format)
+    {
+        switch (format)
+        {
+        case DXGI_FORMAT_BC1_TYPELESS:
+        case DXGI_FORMAT_BC1_UNORM:
+        case DXGI_FORMAT_BC1_UNORM_SRGB:
+        case DXGI_FORMAT_BC4_TYPELESS:
+        case DXGI_FORMAT_BC4_UNORM:
+        case DXGI_FORMAT_BC4_SNORM:
+            return 8;
+
+        case DXGI_FORMAT_BC2_TYPELESS:
+        case DXGI_FORMAT_BC2_UNORM:
+        case DXGI_FORMAT_BC2_UNORM_SRGB:
+        case DXGI_FORMAT_BC3_TYPELESS:
+        case DXGI_FORMAT_BC3_UNORM:
+        case DXGI_FORMAT_BC3_UNORM_SRGB:
+        case DXGI_FORMAT_BC5_TYPELESS:
+        case DXGI_FORMAT_BC5_UNORM:
+        case DXGI_FORMAT_BC5_SNORM:
+        case DXGI_FORMAT_BC6H_TYPELESS:
+        case DXGI_FORMAT_BC6H_UF16:
+        case DXGI_FORMAT_BC6H_SF16:
+        case DXGI_FORMAT_BC7_TYPELESS:
+        case DXGI_FORMAT_BC7_UNORM:
+        case DXGI_FORMAT_BC7_UNORM_SRGB:
+            return 16;
+
+        default:
+            return 0;
+        }
+    }
+
+    bool DdsLayoutParser::ComputePitch(const DXGI_FORMAT format, const U32 width, const U32 height, Size& rowPitch, U32& numRows)
+    {
+        if (const U32 bytesPerBlock = GetBytesPerBlock(format);
+            bytesPerBlock > 0)
+        {
+            rowPitch = static_cast<Size>(std::max((width + 3) / 4, 1u)) * bytesPerBlock;
+            numRows = std::max((height + 3) / 4, 1u);
+            return true;
+        }
+
+        const U32 bitsPerPixel = GetBitsPerPixel(format);
+        if (bitsPerPixel == 0)
+        {
+            return false;
+        }
+
+        rowPitch = (static_cast<Size>(width) * bitsPerPixel + 7) / 8;
+        numRows = height;
+        return true;
+    }
+} // namespace ig::details
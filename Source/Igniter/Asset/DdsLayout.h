@@ -0,0 +1,72 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Result.h"
+#include "Igniter/Asset/Texture.h"
+
+namespace ig::details
+{
+    enum class EDdsParseStatus
+    {
+        Success,
+        NotEnoughData,
+        InvalidMagic,
+        InvalidHeader,
+        UnsupportedFormat,
+        UnsupportedDimension,
+        TruncatedPayload,
+    };
+
+    /* 파일 내에서 하나의 서브리소스(Mip/Array Slice)가 차지하는 영역. Depth 개의 Slice 가 연속적으로 배치 되어 있다. */
+    struct DdsSubresourceLayout
+    {
+    public:
+        Size Offset = 0;
+        Size RowPitch = 0;
+        Size SlicePitch = 0;
+        /* BC 포맷의 경우 블록 행의 수 */
+        U32 NumRows = 0;
+        U32 Depth = 1;
+    };
+
+    struct DdsLayout
+    {
+    public:
+        DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+        ETextureDimension Dimension = ETextureDimension::Tex2D;
+        U32 Width = 0;
+        U32 Height = 0;
+        U32 Depth = 1;
+        /* 큐브맵의 경우 면의 수(6 * 큐브 수) */
+        U32 ArraySize = 1;
+        U16 MipLevels = 1;
+        bool bIsCubemap = false;
+        /* 헤더(DX10 확장 헤더 포함) 이후 페이로드의 시작 위치 */
+        Size PayloadOffset = 0;
+        /* D3D12 서브리소스 인덱스 순서(ArraySlice * MipLevels + Mip) */
+        Vector<DdsSubresourceLayout> Subresources;
+    };
+
+    /*
+     * #sy_note DDS 헤더 파서
+     * DirectXTex 의 ScratchImage 를 거치지 않고, 헤더 만으로 서브리소스 배치를 계산하여 페이로드를 업로드 버퍼에 직접 읽어 들이기 위함.
+     * DX10 확장 헤더와, 임포터/일반적인 도구가 생성하는 레거시 픽셀 포맷(DXTn/ATIn/BCnU/BCnS FourCC, RGBA 마스크)만을 지원한다.
+     * 팔레트, 패킹(YUV, R8G8_B8G8) 포맷 및 일부 면만 존재하는 레거시 큐브맵은 지원하지 않는다.
+     */
+    class DdsLayoutParser final
+    {
+    public:
+        /* Magic(4) + DDS_HEADER(124) + DDS_HEADER_DXT10(20); 헤더 전체를 읽기 위해 필요한 최대 크기 */
+        constexpr static Size kMaxHeaderSize = 148;
+
+    public:
+        /* header 는 파일의 시작 부분 이어야 하며, fileSize 는 페이로드 영역이 잘리지 않았는지 검사 하는데 사용 된다. */
+        [[nodiscard]] static Result<DdsLayout, EDdsParseStatus> Parse(const std::span<const U8> header, const Size fileSize);
+
+        /* 포맷이 지원 되지 않는 경우 0 */
+        [[nodiscard]] static U32 GetBitsPerPixel(const DXGI_FORMAT format);
+        /* BC 포맷이 아닌 경우 0 */
+        [[nodiscard]] static U32 GetBytesPerBlock(const DXGI_FORMAT format);
+        /* 주어진 크기를 가진 Mip 의 행 크기와 행의 수; 지원 되지 않는 포맷인 경우 false */
+        [[nodiscard]] static bool ComputePitch(const DXGI_FORMAT format, const U32 width, const U32 height, Size& rowPitch, U32& numRows);
+    };
+} // namespace ig::details
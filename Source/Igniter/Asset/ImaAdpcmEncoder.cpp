@@ -0,0 +1,177 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Asset/ImaAdpcmEncoder.h"
+
+namespace ig::details
+{
+    namespace
+    {
+        constexpr std::array<S32, 89> kStepTable{
+            7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157,
+            173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707,
+            1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635,
+            13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+        constexpr std::array<S32, 8> kIndexTable{-1, -1, -1, -1, 2, 4, 6, 8};
+
+        struct ChannelState
+        {
+        public:
+            S32 Predictor = 0;
+            S32 StepIndex = 0;
+        };
+
+        /* 디코더와 같은 방식으로 예측 값을 갱신 해야 오차가 누적 되지 않는다. */
+        U8 EncodeNibble(ChannelState& state, const S32 sample)
+        {
+            S32 step = kStepTable[state.StepIndex];
+            S32 diff = sample - state.Predictor;
+            U8 nibble = 0;
+            if (diff < 0)
+            {
+                nibble = 8;
+                diff = -diff;
+            }
+
+            S32 delta = step >> 3;
+            if (diff >= step)
+            {
+                nibble |= 4;
+                diff -= step;
+                delta += step;
+            }
+            step >>= 1;
+            if (diff >= step)
+            {
+                nibble |= 2;
+                diff -= step;
+                delta += step;
+            }
+            step >>= 1;
+            if (diff >= step)
+            {
+                nibble |= 1;
+                delta += step;
+            }
+
+            state.Predictor = std::clamp<S32>((nibble & 8) != 0 ? state.Predictor - delta : state.Predictor + delta, -32768, 32767);
+            state.StepIndex = std::clamp<S32>(state.StepIndex + kIndexTable[nibble & 7], 0, static_cast<S32>(kStepTable.size()) - 1);
+            return nibble;
+        }
+
+        template <typename T>
+        void Append(Vector<U8>& bytes, const T value)
+        {
+            const Size offset = bytes.size();
+            bytes.resize(offset + sizeof(T));
+            std::memcpy(bytes.data() + offset, &value, sizeof(T));
+        }
+
+        void AppendFourCC(Vector<U8>& bytes, const char (&fourCC)[5])
+        {
+            bytes.insert(bytes.end(), fourCC, fourCC + 4);
+        }
+    } // namespace
+
+    U16 ImaAdpcmEncoder::ComputeBlockAlign(const U32 sampleRate, const U16 numChannels)
+    {
+        /* Microsoft ADPCM 권장 값: 11.025kHz 당 256 바이트 (채널 당) */
+        const U32 rateScale = std::clamp<U32>(sampleRate / 11025, 1, 4);
+        return static_cast<U16>(256 * numChannels * rateScale);
+    }
+
+    U32 ImaAdpcmEncoder::ComputeSamplesPerBlock(const U16 blockAlign, const U16 numChannels)
+    {
+        IG_CHECK(numChannels > 0 && blockAlign > 4 * numChannels);
+        return (blockAlign - 4 * numChannels) * 8 / (4 * numChannels) + 1;
+    }
+
+    Vector<U8> ImaAdpcmEncoder::EncodeWave(const std::span<const S16> interleavedSamples, const U32 sampleRate, const U16 numChannels)
+    {
+        IG_CHECK(numChannels > 0 && sampleRate > 0);
+        IG_CHECK(interleavedSamples.size() % numChannels == 0);
+        const U16 blockAlign = ComputeBlockAlign(sampleRate, numChannels);
+        const U32 samplesPerBlock = ComputeSamplesPerBlock(blockAlign, numChannels);
+        const Size numFrames = interleavedSamples.size() / numChannels;
+        const Size numBlocks = (numFrames + samplesPerBlock - 1) / samplesPerBlock;
+        const Size dataSize = numBlocks * blockAlign;
+
+        constexpr U32 kFmtChunkSize = 20;
+        constexpr U32 kFactChunkSize = 4;
+        const Size riffSize = 4 + (8 + kFmtChunkSize) + (8 + kFactChunkSize) + (8 + dataSize);
+
+        Vector<U8> bytes{};
+        bytes.reserve(8 + riffSize);
+        AppendFourCC(bytes, "RIFF");
+        Append<U32>(bytes, static_cast<U32>(riffSize));
+        AppendFourCC(bytes, "WAVE");
+
+        AppendFourCC(bytes, "fmt ");
+        Append<U32>(bytes, kFmtChunkSize);
+        Append<U16>(bytes, kWaveFormatTag);
+        Append<U16>(bytes, numChannels);
+        Append<U32>(bytes, sampleRate);
+        Append<U32>(bytes, static_cast<U32>(static_cast<U64>(sampleRate) * blockAlign / samplesPerBlock));
+        Append<U16>(bytes, blockAlign);
+        Append<U16>(bytes, kBitsPerSample);
+        Append<U16>(bytes, 2);
+        Append<U16>(bytes, static_cast<U16>(samplesPerBlock));
+
+        /* 마지막 블록의 Padding 을 제외한 실제 샘플 수 */
+        AppendFourCC(bytes, "fact");
+        Append<U32>(bytes, kFactChunkSize);
+        Append<U32>(bytes, static_cast<U32>(numFrames));
+
+        AppendFourCC(bytes, "data");
+        Append<U32>(bytes, static_cast<U32>(dataSize));
+
+        const Size dataOffset = bytes.size();
+        bytes.resize(dataOffset + dataSize, 0);
+
+        /* 마지막 블록을 넘어서는 샘플은 마지막 샘플로 채워 불필요한 고주파 성분이 생기지 않도록 한다. */
+        const auto fetchSample = [interleavedSamples, numFrames, numChannels](const Size frameIdx, const U16 channelIdx) -> S32
+        {
+            if (numFrames == 0)
+            {
+                return 0;
+            }
+
+            return interleavedSamples[std::min(frameIdx, numFrames - 1) * numChannels + channelIdx];
+        };
+
+        Vector<ChannelState> states(numChannels);
+        for (Size blockIdx = 0; blockIdx < numBlocks; ++blockIdx)
+        {
+            U8* block = bytes.data() + dataOffset + blockIdx * blockAlign;
+            const Size firstFrameIdx = blockIdx * samplesPerBlock;
+
+            /* 블록의 첫 샘플은 헤더에 그대로 저장 된다. StepIndex 는 이전 블록에서 이어 받는다. */
+            for (U16 channelIdx = 0; channelIdx < numChannels; ++channelIdx)
+            {
+                ChannelState& state = states[channelIdx];
+                state.Predictor = fetchSample(firstFrameIdx, channelIdx);
+                const S16 predictor = static_cast<S16>(state.Predictor);
+                std::memcpy(block + channelIdx * 4, &predictor, sizeof(S16));
+                block[channelIdx * 4 + 2] = static_cast<U8>(state.StepIndex);
+                block[channelIdx * 4 + 3] = 0;
+            }
+
+            U8* encodedBytes = block + 4 * numChannels;
+            for (U32 groupBegin = 1; groupBegin < samplesPerBlock; groupBegin += 8)
+            {
+                for (U16 channelIdx = 0; channelIdx < numChannels; ++channelIdx)
+                {
+                    ChannelState& state = states[channelIdx];
+                    for (U32 sampleIdx = 0; sampleIdx < 8; sampleIdx += 2)
+                    {
+                        const U8 lowNibble = EncodeNibble(state, fetchSample(firstFrameIdx + groupBegin + sampleIdx, channelIdx));
+                        const U8 highNibble = EncodeNibble(state, fetchSample(firstFrameIdx + groupBegin + sampleIdx + 1, channelIdx));
+                        *encodedBytes++ = static_cast<U8>(lowNibble | (highNibble << 4));
+                    }
+                }
+            }
+            IG_CHECK(encodedBytes == block + blockAlign);
+        }
+
+        return bytes;
+    }
+} // namespace ig::details
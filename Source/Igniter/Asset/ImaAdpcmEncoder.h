@@ -0,0 +1,27 @@
+#pragma once
+#include "Igniter/Igniter.h"
+
+namespace ig::details
+{
+    /*
+     * #sy_note IMA ADPCM 인코더
+     * 16 비트 PCM 을 4 비트 IMA ADPCM(WAVE_FORMAT_IMA_ADPCM) 으로 압축 한다. (4:1)
+     * 블록 마다 독립적으로 디코딩 할 수 있어 스트리밍/탐색에 적합 하며, FMOD 를 포함한 대부분의 디코더가 별도의 코덱 없이 지원 한다.
+     *
+     * Block Layout (채널 수 = C)
+     * [Header(4 Bytes: S16 Predictor, U8 StepIndex, U8 0) x C] [(4 Bytes = 8 Samples) x C] ...
+     */
+    class ImaAdpcmEncoder final
+    {
+    public:
+        constexpr static U16 kWaveFormatTag = 0x0011;
+        constexpr static U16 kBitsPerSample = 4;
+
+    public:
+        [[nodiscard]] static U16 ComputeBlockAlign(const U32 sampleRate, const U16 numChannels);
+        [[nodiscard]] static U32 ComputeSamplesPerBlock(const U16 blockAlign, const U16 numChannels);
+
+        /* interleavedSamples 를 인코딩 하여 RIFF/WAVE 파일 이미지를 반환 한다. */
+        [[nodiscard]] static Vector<U8> EncodeWave(const std::span<const S16> interleavedSamples, const U32 sampleRate, const U16 numChannels);
+    };
+} // namespace ig::details
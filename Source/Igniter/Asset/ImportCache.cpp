@@ -0,0 +1,150 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Core/Hash.h"
+#include "Igniter/Core/String.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Filesystem/MappedFile.h"
+#include "Igniter/Asset/ImportCache.h"
+
+IG_DECLARE_LOG_CATEGORY(ImportCacheLog);
+
+IG_DEFINE_LOG_CATEGORY(ImportCacheLog);
+
+namespace ig
+{
+    static Path MakeImportCacheEntryPath(const EAssetCategory category, const U64 key)
+    {
+        return Path{details::ImportCacheRootPath} / ToCStr(category) / std::format("{:016X}", key);
+    }
+
+    U64 ImportCache::MakeKey(const Path& resPath, const Json& serializedImportDesc, const U32 importerVersion)
+    {
+        MappedFile resFile{};
+        if (!resFile.Open(resPath))
+        {
+            return InvalidKey;
+        }
+
+        const U64 contentHash = Hash(std::string_view{reinterpret_cast<const char*>(resFile.GetData()), resFile.GetSize()});
+        const U64 importDescHash = Hash(serializedImportDesc.dump());
+        const U64 versionHash = importerVersion;
+        const U64 key = HashInstances(contentHash, importDescHash, versionHash);
+        return key != InvalidKey ? key : key + 1;
+    }
+
+    std::optional<ImportCache::Entry> ImportCache::Lookup(const EAssetCategory category, const U64 key)
+    {
+        if (key == InvalidKey)
+        {
+            return std::nullopt;
+        }
+
+        const Path entryPath{MakeImportCacheEntryPath(category, key)};
+        const Json serializedEntry{LoadJsonFromFile(entryPath / "Entry.json")};
+        if (serializedEntry.empty() || !serializedEntry.contains("Outputs") || !serializedEntry["Outputs"].is_array())
+        {
+            return std::nullopt;
+        }
+
+        Entry entry{};
+        const Json& serializedOutputs{serializedEntry["Outputs"]};
+        for (Index outputIdx = 0; outputIdx < serializedOutputs.size(); ++outputIdx)
+        {
+            const Json& serializedOutput{serializedOutputs[outputIdx]};
+            CachedOutput output{
+                .VirtualPath = serializedOutput.value("VirtualPath", std::string{}),
+                .SerializedLoadDesc = serializedOutput.value("LoadDesc", Json{}),
+                .BlobPath = entryPath / std::to_string(outputIdx)
+            };
+
+            if (!IsValidVirtualPath(output.VirtualPath) || output.SerializedLoadDesc.empty() || !fs::exists(output.BlobPath))
+            {
+                IG_LOG(ImportCacheLog, Warning, "Import cache entry {} is corrupted. Ignored.", entryPath.string());
+                return std::nullopt;
+            }
+
+            entry.Outputs.emplace_back(std::move(output));
+        }
+
+        entry.Extra = serializedEntry.value("Extra", Json{});
+        return entry;
+    }
+
+    bool ImportCache::Store(const EAssetCategory category, const U64 key, const std::span<const Record> records, const Json& extra)
+    {
+        if (key == InvalidKey || records.empty())
+        {
+            return false;
+        }
+
+        const Path entryPath{MakeImportCacheEntryPath(category, key)};
+        if (fs::exists(entryPath / "Entry.json"))
+        {
+            return true;
+        }
+
+        /* 같은 키에 대한 동시 임포트를 고려하여, 임시 디렉터리에 먼저 기록한 뒤 rename 한다. */
+        Path stagingPath{entryPath};
+        stagingPath += std::format(".{}", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+        std::error_code errorCode{};
+        fs::remove_all(stagingPath, errorCode);
+        fs::create_directories(stagingPath, errorCode);
+        if (errorCode)
+        {
+            IG_LOG(ImportCacheLog, Warning, "Failed to create import cache directory {}: {}", stagingPath.string(), errorCode.message());
+            return false;
+        }
+
+        Json serializedEntry{};
+        serializedEntry["Outputs"] = Json::array();
+        serializedEntry["Extra"] = extra;
+        for (Index recordIdx = 0; recordIdx < records.size(); ++recordIdx)
+        {
+            const Record& record{records[recordIdx]};
+            fs::copy_file(record.AssetPath, stagingPath / std::to_string(recordIdx), fs::copy_options::overwrite_existing, errorCode);
+            if (errorCode)
+            {
+                IG_LOG(ImportCacheLog, Warning, "Failed to store {} to import cache: {}", record.AssetPath.string(), errorCode.message());
+                fs::remove_all(stagingPath, errorCode);
+                return false;
+            }
+
+            serializedEntry["Outputs"].push_back(Json{{"VirtualPath", record.VirtualPath}, {"LoadDesc", record.SerializedLoadDesc}});
+        }
+
+        if (!SaveJsonToFile(stagingPath / "Entry.json", serializedEntry))
+        {
+            fs::remove_all(stagingPath, errorCode);
+            return false;
+        }
+
+        fs::rename(stagingPath, entryPath, errorCode);
+        if (errorCode)
+        {
+            /* 다른 임포트가 먼저 같은 엔트리를 기록한 경우 */
+            fs::remove_all(stagingPath, errorCode);
+            return fs::exists(entryPath / "Entry.json");
+        }
+
+        IG_LOG(ImportCacheLog, Debug, "Import cache entry {} stored. ({} outputs)", entryPath.string(), records.size());
+        return true;
+    }
+
+    bool ImportCache::Materialize(const Path& blobPath, const Path& assetPath)
+    {
+        std::error_code errorCode{};
+        if (fs::exists(assetPath))
+        {
+            fs::remove(assetPath, errorCode);
+        }
+
+        fs::create_hard_link(blobPath, assetPath, errorCode);
+        if (!errorCode)
+        {
+            return true;
+        }
+
+        return fs::copy_file(blobPath, assetPath, fs::copy_options::overwrite_existing, errorCode) && !errorCode;
+    }
+} // namespace ig
@@ -0,0 +1,56 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Asset/Common.h"
+
+namespace ig
+{
+    /*
+     * #sy_note 임포트 캐시
+     * (리소스 파일의 내용, 임포트 설정, 임포터 버전)의 해시를 키로, 임포트 결과물(에셋 Blob, LoadDesc)을 로컬에 저장하는 Content-Addressed 캐시.
+     * 같은 리소스를 같은 설정으로 다시 임포트 하는 경우, 비싼 가공 과정 없이 캐싱된 Blob을 에셋 경로에 링크(또는 복사)한다.
+     *
+     * Layout
+     * ImportCache\{Category}\{Key}\Entry.json => 출력물 목록 및 부가 정보
+     * ImportCache\{Category}\{Key}\{OutputIndex} => 출력물 Blob
+     */
+    class ImportCache final
+    {
+    public:
+        /* 임포트 결과물; AssetPath 의 파일이 캐시에 저장 된다. */
+        struct Record
+        {
+        public:
+            std::string VirtualPath{};
+            Json SerializedLoadDesc{};
+            Path AssetPath{};
+        };
+
+        struct CachedOutput
+        {
+        public:
+            std::string VirtualPath{};
+            Json SerializedLoadDesc{};
+            Path BlobPath{};
+        };
+
+        struct Entry
+        {
+        public:
+            Vector<CachedOutput> Outputs{};
+            Json Extra{};
+        };
+
+    public:
+        ImportCache() = delete;
+
+        /* 리소스 파일을 읽을 수 없다면 InvalidKey를 반환 */
+        [[nodiscard]] static U64 MakeKey(const Path& resPath, const Json& serializedImportDesc, const U32 importerVersion);
+        [[nodiscard]] static std::optional<Entry> Lookup(const EAssetCategory category, const U64 key);
+        static bool Store(const EAssetCategory category, const U64 key, const std::span<const Record> records, const Json& extra = Json{});
+        /* 캐싱된 Blob을 에셋 경로에 하드 링크. 링크 할 수 없다면 복사 한다. */
+        static bool Materialize(const Path& blobPath, const Path& assetPath);
+
+    public:
+        constexpr static U64 InvalidKey = 0;
+    };
+} // namespace ig
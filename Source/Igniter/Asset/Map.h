@@ -9,6 +9,8 @@ namespace ig
     {
     public:
         World* WorldToSerialize = nullptr;
+        /* WorldToSerialize 가 nullptr 인 경우 사용 되는 직렬화 된 World (World::AddSerializedComponent) */
+        Json SerializedWorld{};
     };
 
     struct MapLoadDesc final
@@ -26,9 +28,11 @@ namespace ig
         using Desc = AssetDesc<Map>;
 
     public:
-        Map(const Desc& snapshot, Json serializedWorld)
+        /* serializedSize: 로드 한 직렬화 된 월드(ubjson) 의 크기 */
+        Map(const Desc& snapshot, Json serializedWorld, const Size serializedSize = 0)
             : snapshot(snapshot)
-            , serializedWorld(serializedWorld)
+            , serializedWorld(std::move(serializedWorld))
+            , serializedSize(serializedSize)
         {}
 
         Map(const Map&) = delete;
@@ -40,9 +44,15 @@ namespace ig
 
         [[nodiscard]] const Desc& GetSnapshot() const { return snapshot; }
         [[nodiscard]] const Json& GetSerializedWorld() const { return serializedWorld; }
+        /*
+         * 로드 시점의 직렬화 된 월드 크기로 근사 한다. 캐시가 자주 조회 하므로 매번 다시 직렬화 하지 않는다.
+         * 월드가 참조 하는 에셋 들은 맵이 아닌 인스턴스화 된 월드가 참조를 유지 한다.
+         */
+        [[nodiscard]] Bytes GetResidentSize() const noexcept { return sizeof(Map) + serializedSize; }
 
     private:
         Desc snapshot{};
         Json serializedWorld{};
+        Size serializedSize = 0;
     };
 } // namespace ig
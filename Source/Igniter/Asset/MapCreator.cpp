@@ -18,7 +18,7 @@ namespace ig
             return MakeFail<Map::Desc, EMapCreateStatus::InvalidAssetType>();
         }
 
-        Json serializedWorld{};
+        Json serializedWorld{desc.SerializedWorld};
         if (desc.WorldToSerialize != nullptr)
         {
             desc.WorldToSerialize->Serialize(serializedWorld);
@@ -1,9 +1,14 @@
 #include "Igniter/Igniter.h"
 #include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/AssetManager.h"
 #include "Igniter/Asset/MapLoader.h"
 
 namespace ig
 {
+    MapLoader::MapLoader(AssetManager& assetManager)
+        : assetManager(assetManager)
+    {}
+
     Result<Map, EMapLoadStatus> MapLoader::Load(const Map::Desc& desc)
     {
         const AssetInfo& assetInfo{desc.Info};
@@ -17,6 +22,12 @@ namespace ig
             return MakeFail<Map, EMapLoadStatus::AssetTypeMismatch>();
         }
 
+        if (const std::span<const U8> packedAsset{assetManager.FindPackedAsset(assetInfo.GetGuid())};
+            !packedAsset.empty())
+        {
+            return MakeSuccess<Map, EMapLoadStatus>(Map{desc, Json::from_ubjson(packedAsset), packedAsset.size()});
+        }
+
         const Path assetPath = MakeAssetPath(EAssetCategory::Map, assetInfo.GetGuid());
         if (!fs::exists(assetPath))
         {
@@ -25,6 +36,6 @@ namespace ig
 
         /* #sy_todo ubjson 으로 저장할지, 아니면 그냥 json으로 저장할지 load desc 에서 설정 할 수 있도록 할 것! */
         const Vector<U8> blob = LoadBlobFromFile(assetPath);
-        return MakeSuccess<Map, EMapLoadStatus>(Map{desc, Json::from_ubjson(std::span{blob.data(), blob.size()})});
+        return MakeSuccess<Map, EMapLoadStatus>(Map{desc, Json::from_ubjson(std::span{blob.data(), blob.size()}), blob.size()});
     }
 } // namespace ig
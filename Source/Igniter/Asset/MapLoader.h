@@ -12,12 +12,14 @@ namespace ig
         FileDoesNotExists
     };
 
+    class AssetManager;
+
     class MapLoader final
     {
         friend class AssetManager;
 
     public:
-        MapLoader() = default;
+        explicit MapLoader(AssetManager& assetManager);
         MapLoader(const MapLoader&) = delete;
         MapLoader(MapLoader&&) noexcept = delete;
         ~MapLoader() = default;
@@ -27,5 +29,8 @@ namespace ig
 
     private:
         Result<Map, EMapLoadStatus> Load(const Map::Desc& desc);
+
+    private:
+        AssetManager& assetManager;
     };
 } // namespace ig
@@ -44,6 +44,8 @@ namespace ig
 
         [[nodiscard]] const Desc& GetSnapshot() const { return snapshot; }
         [[nodiscard]] Handle<Texture> GetDiffuse() const { return diffuse; }
+        /* 머터리얼 자신의 데이터만 포함 한다. 참조 하는 텍스처 들은 각자의 캐시에서 따로 계산 된다. */
+        [[nodiscard]] Bytes GetResidentSize() const noexcept { return sizeof(Material); }
 
     private:
         void Destroy();
@@ -62,5 +64,9 @@ namespace ig
     {
         U32 DiffuseTextureSrv = IG_NUMERIC_MAX_OF(DiffuseTextureSrv);
         U32 DiffuseTextureSampler = IG_NUMERIC_MAX_OF(DiffuseTextureSampler);
+        /* 텍스처 배열에 패킹 된 서브 텍스처의 Slice; 아니라면 InvalidIndexU32 */
+        U32 DiffuseTextureSlice = InvalidIndexU32;
+        /* xy: Offset, zw: Scale; 아틀라스에 패킹 된 서브 텍스처의 UV 영역 */
+        Vector4 DiffuseUvRect{0.f, 0.f, 1.f, 1.f};
     };
 } // namespace ig
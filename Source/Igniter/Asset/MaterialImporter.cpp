@@ -39,7 +39,20 @@ namespace ig
         }
         IG_CHECK(diffuseTexGuid.isValid());
 
-        const Material::LoadDesc loadDesc{.DiffuseTexGuid = diffuseTexGuid};
+        return Export(assetInfo, Material::LoadDesc{.DiffuseTexGuid = diffuseTexGuid});
+    }
+
+    Result<Material::Desc, EMaterialAssetImportStatus> MaterialImporter::Export(const AssetInfo& assetInfo, const Material::LoadDesc& loadDesc)
+    {
+        if (!assetInfo.IsValid())
+        {
+            return MakeFail<Material::Desc, EMaterialAssetImportStatus::InvalidAssetInfo>();
+        }
+
+        if (assetInfo.GetCategory() != EAssetCategory::Material)
+        {
+            return MakeFail<Material::Desc, EMaterialAssetImportStatus::InvalidAssetType>();
+        }
 
         Json serializedMeta{};
         serializedMeta << assetInfo << loadDesc;
@@ -13,10 +13,12 @@ namespace ig
     };
 
     class AssetManager;
+    class AssetCooker;
 
     class MaterialImporter final
     {
         friend class AssetManager;
+        friend class AssetCooker;
 
     public:
         MaterialImporter(AssetManager& assetManager);
@@ -29,6 +31,8 @@ namespace ig
 
     private:
         Result<Material::Desc, EMaterialAssetImportStatus> Import(const AssetInfo& assetInfo, const MaterialAssetCreateDesc& desc);
+        /* 이미 참조할 텍스처의 Guid가 결정된 경우, AssetManager 없이 메타데이터와 에셋 파일을 기록 */
+        static Result<Material::Desc, EMaterialAssetImportStatus> Export(const AssetInfo& assetInfo, const Material::LoadDesc& loadDesc);
 
     private:
         AssetManager& assetManager;
@@ -0,0 +1,208 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Asset/MeshletCodec.h"
+
+namespace ig::details
+{
+    namespace
+    {
+        void WriteVarint(Vector<U8>& dst, U64 value)
+        {
+            while (value >= 0x80)
+            {
+                dst.push_back((U8)(value | 0x80));
+                value >>= 7;
+            }
+            dst.push_back((U8)value);
+        }
+
+        bool ReadVarint(const std::span<const U8> src, Size& offset, U64& value)
+        {
+            value = 0;
+            for (U32 shift = 0; shift < 64; shift += 7)
+            {
+                if (offset >= src.size())
+                {
+                    return false;
+                }
+
+                const U8 byte = src[offset++];
+                value |= (U64)(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool ReadVarint(const std::span<const U8> src, Size& offset, U32& value)
+        {
+            U64 wideValue = 0;
+            if (!ReadVarint(src, offset, wideValue) || wideValue > std::numeric_limits<U32>::max())
+            {
+                return false;
+            }
+
+            value = (U32)wideValue;
+            return true;
+        }
+
+        /* U32 오프셋 간의 차이는 [-(2^32 - 1), 2^32 - 1] 이므로, ZigZag 인코딩 결과는 33 비트가 필요 하다. */
+        U64 EncodeZigZag(const S64 value)
+        {
+            return ((U64)value << 1) ^ (U64)(value >> 63);
+        }
+
+        S64 DecodeZigZag(const U64 value)
+        {
+            return (S64)(value >> 1) ^ -(S64)(value & 1);
+        }
+
+        bool ApplyOffsetDelta(const U32 expectedOffset, const U64 encodedDelta, U32& offset)
+        {
+            const S64 decodedOffset = (S64)expectedOffset + DecodeZigZag(encodedDelta);
+            if (decodedOffset < 0 || decodedOffset > (S64)std::numeric_limits<U32>::max())
+            {
+                return false;
+            }
+
+            offset = (U32)decodedOffset;
+            return true;
+        }
+
+        void WriteRaw(Vector<U8>& dst, const void* src, const Size size)
+        {
+            const U8* srcBytes = reinterpret_cast<const U8*>(src);
+            dst.insert(dst.end(), srcBytes, srcBytes + size);
+        }
+
+        bool ReadRaw(const std::span<const U8> src, Size& offset, void* dst, const Size size)
+        {
+            if (offset + size > src.size())
+            {
+                return false;
+            }
+
+            std::memcpy(dst, src.data() + offset, size);
+            offset += size;
+            return true;
+        }
+    } // namespace
+
+    Vector<U8> MeshletCodec::EncodeVertexIndices(const std::span<const U32> vertexIndices)
+    {
+        meshopt_encodeIndexVersion(1);
+        Vector<U8> encoded(meshopt_encodeIndexSequenceBound(vertexIndices.size(), vertexIndices.empty() ? 0 : *std::max_element(vertexIndices.begin(), vertexIndices.end()) + 1));
+        encoded.resize(meshopt_encodeIndexSequence(encoded.data(), encoded.size(), vertexIndices.data(), vertexIndices.size()));
+        return encoded;
+    }
+
+    bool MeshletCodec::DecodeVertexIndices(const std::span<const U8> encoded, const std::span<U32> dst)
+    {
+        return meshopt_decodeIndexSequence(dst.data(), dst.size(), sizeof(U32), encoded.data(), encoded.size()) == 0;
+    }
+
+    Vector<U8> MeshletCodec::EncodeTriangles(const std::span<const U32> triangles)
+    {
+        /* Meshlet 로컬 인덱스는 Meshlet::kMaxVertices 보다 작으므로, 일반적인 Triangle List 로 취급 할 수 있다. */
+        Vector<U32> localIndices(triangles.size() * Mesh::kNumVertexPerTriangle);
+        for (Index triangleIdx = 0; triangleIdx < triangles.size(); ++triangleIdx)
+        {
+            const U32 triangle = triangles[triangleIdx];
+            localIndices[triangleIdx * Mesh::kNumVertexPerTriangle + 0] = triangle & 0xFF;
+            localIndices[triangleIdx * Mesh::kNumVertexPerTriangle + 1] = (triangle >> 8) & 0xFF;
+            localIndices[triangleIdx * Mesh::kNumVertexPerTriangle + 2] = (triangle >> 16) & 0xFF;
+        }
+
+        meshopt_encodeIndexVersion(1);
+        Vector<U8> encoded(meshopt_encodeIndexBufferBound(localIndices.size(), Meshlet::kMaxVertices));
+        encoded.resize(meshopt_encodeIndexBuffer(encoded.data(), encoded.size(), localIndices.data(), localIndices.size()));
+        return encoded;
+    }
+
+    bool MeshletCodec::DecodeTriangles(const std::span<const U8> encoded, const std::span<U32> dst)
+    {
+        Vector<U32> localIndices(dst.size() * Mesh::kNumVertexPerTriangle);
+        if (meshopt_decodeIndexBuffer(localIndices.data(), localIndices.size(), sizeof(U32), encoded.data(), encoded.size()) != 0)
+        {
+            return false;
+        }
+
+        for (Index triangleIdx = 0; triangleIdx < dst.size(); ++triangleIdx)
+        {
+            dst[triangleIdx] = EncodeTriangleU32(
+                (U8)localIndices[triangleIdx * Mesh::kNumVertexPerTriangle + 0],
+                (U8)localIndices[triangleIdx * Mesh::kNumVertexPerTriangle + 1],
+                (U8)localIndices[triangleIdx * Mesh::kNumVertexPerTriangle + 2]);
+        }
+
+        return true;
+    }
+
+    Vector<U8> MeshletCodec::EncodeMeshlets(const std::span<const Meshlet> meshlets)
+    {
+        Vector<U8> encoded{};
+        encoded.reserve(meshlets.size() * (sizeof(BoundingSphere) * 3 + 16));
+
+        U32 expectedIndexOffset = 0;
+        U32 expectedTriangleOffset = 0;
+        for (const Meshlet& meshlet : meshlets)
+        {
+            /* 일반적으로 Meshlet 들은 연속적으로 배치 되어 있기 때문에, 예측값과의 차이는 0 이다. */
+            WriteVarint(encoded, EncodeZigZag((S64)meshlet.IndexOffset - (S64)expectedIndexOffset));
+            WriteVarint(encoded, meshlet.NumIndices);
+            WriteVarint(encoded, EncodeZigZag((S64)meshlet.TriangleOffset - (S64)expectedTriangleOffset));
+            WriteVarint(encoded, meshlet.NumTriangles);
+            WriteRaw(encoded, &meshlet.BoundingVolume, sizeof(BoundingSphere));
+            WriteRaw(encoded, meshlet.QuantizedNormalConeAxis, sizeof(meshlet.QuantizedNormalConeAxis));
+            WriteRaw(encoded, &meshlet.QuantizedNormalConeCutoff, sizeof(meshlet.QuantizedNormalConeCutoff));
+            WriteRaw(encoded, &meshlet.LodBounds, sizeof(BoundingSphere));
+            WriteRaw(encoded, &meshlet.LodError, sizeof(F32));
+            WriteRaw(encoded, &meshlet.ParentLodBounds, sizeof(BoundingSphere));
+            WriteRaw(encoded, &meshlet.ParentLodError, sizeof(F32));
+
+            expectedIndexOffset = meshlet.IndexOffset + meshlet.NumIndices;
+            expectedTriangleOffset = meshlet.TriangleOffset + meshlet.NumTriangles;
+        }
+
+        return encoded;
+    }
+
+    bool MeshletCodec::DecodeMeshlets(const std::span<const U8> encoded, const std::span<Meshlet> dst)
+    {
+        Size offset = 0;
+        U32 expectedIndexOffset = 0;
+        U32 expectedTriangleOffset = 0;
+        for (Meshlet& meshlet : dst)
+        {
+            U64 indexOffsetDelta = 0;
+            U64 triangleOffsetDelta = 0;
+            if (!ReadVarint(encoded, offset, indexOffsetDelta) ||
+                !ReadVarint(encoded, offset, meshlet.NumIndices) ||
+                !ReadVarint(encoded, offset, triangleOffsetDelta) ||
+                !ReadVarint(encoded, offset, meshlet.NumTriangles) ||
+                !ReadRaw(encoded, offset, &meshlet.BoundingVolume, sizeof(BoundingSphere)) ||
+                !ReadRaw(encoded, offset, meshlet.QuantizedNormalConeAxis, sizeof(meshlet.QuantizedNormalConeAxis)) ||
+                !ReadRaw(encoded, offset, &meshlet.QuantizedNormalConeCutoff, sizeof(meshlet.QuantizedNormalConeCutoff)) ||
+                !ReadRaw(encoded, offset, &meshlet.LodBounds, sizeof(BoundingSphere)) ||
+                !ReadRaw(encoded, offset, &meshlet.LodError, sizeof(F32)) ||
+                !ReadRaw(encoded, offset, &meshlet.ParentLodBounds, sizeof(BoundingSphere)) ||
+                !ReadRaw(encoded, offset, &meshlet.ParentLodError, sizeof(F32)))
+            {
+                return false;
+            }
+
+            if (!ApplyOffsetDelta(expectedIndexOffset, indexOffsetDelta, meshlet.IndexOffset) ||
+                !ApplyOffsetDelta(expectedTriangleOffset, triangleOffsetDelta, meshlet.TriangleOffset))
+            {
+                return false;
+            }
+
+            expectedIndexOffset = meshlet.IndexOffset + meshlet.NumIndices;
+            expectedTriangleOffset = meshlet.TriangleOffset + meshlet.NumTriangles;
+        }
+
+        return offset == encoded.size();
+    }
+} // namespace ig::details
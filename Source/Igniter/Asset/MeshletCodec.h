@@ -0,0 +1,27 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Render/Mesh.h"
+
+namespace ig::details
+{
+    /*
+     * #sy_note Meshlet 데이터 압축
+     * MeshletVertexIndices => meshopt Index Sequence 코덱
+     * MeshletTriangles => 8비트 로컬 인덱스를 Triangle List로 풀어 meshopt Index Buffer 코덱
+     * Meshlets => 오프셋은 이전 Meshlet 으로 부터의 예측값과의 차이(ZigZag, 64비트 Varint), 개수는 Varint 로 기록.
+     *             Bounding Sphere, Normal Cone 그리고 Cluster LOD 오차 경계는 그대로 기록 한다.
+     * 디코딩 결과는 압축 전 데이터와 같은 레이아웃을 가지므로, 그대로 GPU 에 업로드 할 수 있다.
+     */
+    class MeshletCodec final
+    {
+    public:
+        [[nodiscard]] static Vector<U8> EncodeVertexIndices(const std::span<const U32> vertexIndices);
+        [[nodiscard]] static bool DecodeVertexIndices(const std::span<const U8> encoded, const std::span<U32> dst);
+
+        [[nodiscard]] static Vector<U8> EncodeTriangles(const std::span<const U32> triangles);
+        [[nodiscard]] static bool DecodeTriangles(const std::span<const U8> encoded, const std::span<U32> dst);
+
+        [[nodiscard]] static Vector<U8> EncodeMeshlets(const std::span<const Meshlet> meshlets);
+        [[nodiscard]] static bool DecodeMeshlets(const std::span<const U8> encoded, const std::span<Meshlet> dst);
+    };
+} // namespace ig::details
@@ -0,0 +1,159 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Json.h"
+#include "Igniter/Render/RenderContext.h"
+#include "Igniter/Render/UnifiedMeshStorage.h"
+#include "Igniter/Asset/AssetManager.h"
+#include "Igniter/Asset/SkeletalMesh.h"
+
+namespace ig
+{
+    Json& SkeletalMeshImportDesc::Serialize(Json& archive) const
+    {
+        IG_SERIALIZE_TO_JSON(SkeletalMeshImportDesc, archive, bMakeLeftHanded);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshImportDesc, archive, bFlipUVs);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshImportDesc, archive, bFlipWindingOrder);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshImportDesc, archive, bImproveCacheLocality);
+        return archive;
+    }
+
+    const Json& SkeletalMeshImportDesc::Deserialize(const Json& archive)
+    {
+        *this = {};
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshImportDesc, archive, bMakeLeftHanded);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshImportDesc, archive, bFlipUVs);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshImportDesc, archive, bFlipWindingOrder);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshImportDesc, archive, bImproveCacheLocality);
+        return archive;
+    }
+
+    U32 Skeleton::FindBone(const std::string_view boneName) const
+    {
+        for (Index boneIdx = 0; boneIdx < BoneNames.size(); ++boneIdx)
+        {
+            if (BoneNames[boneIdx] == boneName)
+            {
+                return (U32)boneIdx;
+            }
+        }
+
+        return InvalidIndexU32;
+    }
+
+    Json& SkeletalMeshLoadDesc::Serialize(Json& archive) const
+    {
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, NumVertices);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, CompressedVerticesSize);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, NumMeshletVertexIndices);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, NumMeshletTriangles);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, NumMeshlets);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, CompressedMeshletVertexIndicesSize);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, CompressedMeshletTrianglesSize);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, CompressedMeshletsSize);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, NumMeshletBoneBounds);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, NumMeshBoneBounds);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, BoundingBox);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, BoneNames);
+        IG_SERIALIZE_TO_JSON(SkeletalMeshLoadDesc, archive, BoneParentIndices);
+        return archive;
+    }
+
+    const Json& SkeletalMeshLoadDesc::Deserialize(const Json& archive)
+    {
+        *this = {};
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, NumVertices);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, CompressedVerticesSize);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, NumMeshletVertexIndices);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, NumMeshletTriangles);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, NumMeshlets);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, CompressedMeshletVertexIndicesSize);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, CompressedMeshletTrianglesSize);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, CompressedMeshletsSize);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, NumMeshletBoneBounds);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, NumMeshBoneBounds);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, BoundingBox);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, BoneNames);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(SkeletalMeshLoadDesc, archive, BoneParentIndices);
+        return archive;
+    }
+
+    SkeletalMesh::SkeletalMesh(RenderContext& renderContext, AssetManager& assetManager, const Desc& snapshot, const Mesh& newMesh, Skeleton newSkeleton,
+        Vector<MeshletBoneBoundsRange> newMeshletBoneBoundsRanges, Vector<MeshletBoneBounds> newMeshletBoneBounds,
+        Vector<MeshletBoneBounds> newMeshBoneBounds)
+        : renderContext(&renderContext)
+        , assetManager(&assetManager)
+        , snapshot(snapshot)
+        , mesh(newMesh)
+        , skeleton(std::move(newSkeleton))
+        , meshletBoneBoundsRanges(std::move(newMeshletBoneBoundsRanges))
+        , meshletBoneBounds(std::move(newMeshletBoneBounds))
+        , meshBoneBounds(std::move(newMeshBoneBounds))
+    {}
+
+    SkeletalMesh::SkeletalMesh(SkeletalMesh&& other) noexcept
+        : renderContext(std::exchange(other.renderContext, nullptr))
+        , assetManager(std::exchange(other.assetManager, nullptr))
+        , snapshot(std::exchange(other.snapshot, {}))
+        , mesh(std::exchange(other.mesh, {}))
+        , skeleton(std::exchange(other.skeleton, {}))
+        , meshletBoneBoundsRanges(std::exchange(other.meshletBoneBoundsRanges, {}))
+        , meshletBoneBounds(std::exchange(other.meshletBoneBounds, {}))
+        , meshBoneBounds(std::exchange(other.meshBoneBounds, {}))
+    {}
+
+    SkeletalMesh::~SkeletalMesh()
+    {
+        Destroy();
+    }
+
+    SkeletalMesh& SkeletalMesh::operator=(SkeletalMesh&& rhs) noexcept
+    {
+        Destroy();
+        renderContext = std::exchange(rhs.renderContext, nullptr);
+        assetManager = std::exchange(rhs.assetManager, nullptr);
+        snapshot = std::exchange(rhs.snapshot, {});
+        mesh = std::exchange(rhs.mesh, {});
+        skeleton = std::exchange(rhs.skeleton, {});
+        meshletBoneBoundsRanges = std::exchange(rhs.meshletBoneBoundsRanges, {});
+        meshletBoneBounds = std::exchange(rhs.meshletBoneBounds, {});
+        meshBoneBounds = std::exchange(rhs.meshBoneBounds, {});
+        return *this;
+    }
+
+    Bytes SkeletalMesh::GetResidentSize() const
+    {
+        Bytes residentSize = sizeof(SkeletalMesh);
+        residentSize += renderContext != nullptr ? renderContext->GetUnifiedMeshStorage().GetResidentSize(mesh) : 0;
+        for (const std::string& boneName : skeleton.BoneNames)
+        {
+            residentSize += sizeof(std::string) + boneName.capacity();
+        }
+        residentSize += sizeof(U32) * skeleton.ParentIndices.size();
+        residentSize += sizeof(Matrix) * (skeleton.InverseBindMatrices.size() + skeleton.BindLocalTransforms.size());
+        residentSize += sizeof(MeshletBoneBoundsRange) * meshletBoneBoundsRanges.size();
+        residentSize += sizeof(MeshletBoneBounds) * (meshletBoneBounds.size() + meshBoneBounds.size());
+        return residentSize;
+    }
+
+    void SkeletalMesh::Destroy()
+    {
+        if (renderContext == nullptr)
+        {
+            return;
+        }
+
+        /* 업로드가 진행 중인 경우, 업로드가 끝난 이후에 해제 된다. */
+        UnifiedMeshStorage& unifiedMeshStorage = renderContext->GetUnifiedMeshStorage();
+        unifiedMeshStorage.Deallocate(mesh.VertexStorageAlloc, mesh.UploadSync);
+        for (U8 lod = 0; lod < mesh.NumLevelOfDetails; ++lod)
+        {
+            unifiedMeshStorage.Deallocate(mesh.LevelOfDetails[lod], mesh.UploadSync);
+        }
+
+        snapshot = {};
+        mesh = {};
+        skeleton = {};
+        meshletBoneBoundsRanges = {};
+        meshletBoneBounds = {};
+        meshBoneBounds = {};
+    }
+} // namespace ig
@@ -0,0 +1,159 @@
+#pragma once
+#include "Igniter/Core/BoundingVolume.h"
+#include "Igniter/Render/Mesh.h"
+#include "Igniter/Render/Vertex.h"
+#include "Igniter/Asset/Common.h"
+
+namespace ig
+{
+    class SkeletalMesh;
+
+    struct SkeletalMeshImportDesc
+    {
+    public:
+        Json& Serialize(Json& archive) const;
+        const Json& Deserialize(const Json& archive);
+
+    public:
+        bool bMakeLeftHanded = true;
+        bool bFlipUVs = true;
+        bool bFlipWindingOrder = true;
+        bool bImproveCacheLocality = true;
+    };
+
+    /*
+     * 메시가 참조하는 Bone 들과 그 조상 노드 들로 구성 된 계층. 부모는 항상 자식 보다 앞선 인덱스를 가진다.
+     * 행렬 들은 SimpleMath 의 규약(Row-Major, Row-Vector)을 따른다.
+     * Skinning Matrix(i) = InverseBindMatrices[i] * (현재 포즈에서 Bone i 의 메시 공간 변환)
+     */
+    struct Skeleton
+    {
+    public:
+        /* SkinnedVertex::BoneIndices 가 8 Bits 이기 때문에, 메시 당 Bone 의 수가 제한 된다. */
+        constexpr static Size kMaxBones = 256;
+
+    public:
+        [[nodiscard]] Size GetNumBones() const noexcept { return BoneNames.size(); }
+        /* 찾지 못한 경우 InvalidIndexU32 */
+        [[nodiscard]] U32 FindBone(const std::string_view boneName) const;
+
+    public:
+        Vector<std::string> BoneNames;
+        /* 루트 Bone 의 경우 InvalidIndexU32 */
+        Vector<U32> ParentIndices;
+        /* 메시 공간 -> Bone 공간 (Bind Pose) */
+        Vector<Matrix> InverseBindMatrices;
+        /* Bind Pose 에서 부모 Bone 공간에 대한 로컬 변환 (루트 Bone 의 경우 메시 공간에 대한 변환) */
+        Vector<Matrix> BindLocalTransforms;
+        /* 루트 Bone 의 부모 노드 공간 -> 메시 공간; 애니메이션 트랙이 샘플링 한 루트 Bone 의 로컬 변환에 적용 된다. */
+        Matrix RootTransform = Matrix::Identity;
+    };
+
+    /*
+     * Skeletal Mesh Binary Layout
+     * Begin->
+     * CompressedVertices => [0, CompressedVerticesSize); SkinnedVertex 의 배열을 압축한 것
+     * CompressedMeshletVertexIndices => [PrevLast, PrevLast+CompressedMeshletVertexIndicesSize)
+     * CompressedMeshletTriangles => [PrevLast, PrevLast+CompressedMeshletTrianglesSize)
+     * CompressedMeshlets => [PrevLast, PrevLast+CompressedMeshletsSize)
+     * InverseBindMatrices => [PrevLast, PrevLast+sizeof(Matrix)*NumBones)
+     * BindLocalTransforms => [PrevLast, PrevLast+sizeof(Matrix)*NumBones)
+ * RootTransform => [PrevLast, PrevLast+sizeof(Matrix))
+     * MeshletBoneBoundsRanges => [PrevLast, PrevLast+sizeof(MeshletBoneBoundsRange)*NumMeshlets)
+     * MeshletBoneBounds => [PrevLast, PrevLast+sizeof(MeshletBoneBounds)*NumMeshletBoneBounds)
+     * MeshBoneBounds => [PrevLast, PrevLast+sizeof(MeshletBoneBounds)*NumMeshBoneBounds)
+     * <-End
+     *
+     * Meshlet 관련 데이터는 StaticMesh 의 LOD 와 같이 MeshletCodec 으로 압축 되어 있다. 스켈레탈 메시는 단일 LOD 만을 가진다.
+     * 스켈레톤의 이름과 계층(BoneNames, BoneParentIndices)은 메타데이터에 기록 된다.
+     */
+    struct SkeletalMeshLoadDesc
+    {
+    public:
+        Json& Serialize(Json& archive) const;
+        const Json& Deserialize(const Json& archive);
+
+        [[nodiscard]] Size GetNumBones() const noexcept { return BoneNames.size(); }
+        [[nodiscard]] Size GetMeshletsOffset() const { return CompressedVerticesSize; }
+        [[nodiscard]] Size GetCompressedMeshletDataSize() const
+        {
+            return (Size)CompressedMeshletVertexIndicesSize + CompressedMeshletTrianglesSize + CompressedMeshletsSize;
+        }
+        [[nodiscard]] Size GetSkeletonOffset() const { return GetMeshletsOffset() + GetCompressedMeshletDataSize(); }
+        [[nodiscard]] Size GetSkeletonSize() const { return sizeof(Matrix) * (2 * GetNumBones() + 1); }
+        [[nodiscard]] Size GetBoneBoundsOffset() const { return GetSkeletonOffset() + GetSkeletonSize(); }
+        [[nodiscard]] Size GetBoneBoundsSize() const
+        {
+            return sizeof(MeshletBoneBoundsRange) * NumMeshlets + sizeof(MeshletBoneBounds) * ((Size)NumMeshletBoneBounds + NumMeshBoneBounds);
+        }
+        [[nodiscard]] Size GetBlobSize() const { return GetBoneBoundsOffset() + GetBoneBoundsSize(); }
+
+    public:
+        U32 NumVertices{0};
+        Bytes CompressedVerticesSize{0};
+        U32 NumMeshletVertexIndices{0};
+        U32 NumMeshletTriangles{0};
+        U32 NumMeshlets{0};
+        U32 CompressedMeshletVertexIndicesSize{0};
+        U32 CompressedMeshletTrianglesSize{0};
+        U32 CompressedMeshletsSize{0};
+        U32 NumMeshletBoneBounds{0};
+        U32 NumMeshBoneBounds{0};
+        /* Bind Pose 에서의 경계 */
+        AABB BoundingBox;
+
+        Vector<std::string> BoneNames;
+        Vector<U32> BoneParentIndices;
+    };
+
+    class RenderContext;
+    class AssetManager;
+
+    /*
+     * #sy_note 스켈레탈 메시
+     * 정점(SkinnedVertex)과 Meshlet 데이터는 Unified Mesh Storage 에 업로드 되며, Mesh::LevelOfDetails[0] 만 유효하다.
+     * Bone 단위 경계(MeshletBoneBounds)는 포즈에 따른 컬링을 위해 CPU 에 유지 된다.
+     */
+    class SkeletalMesh final
+    {
+    public:
+        using ImportDesc = SkeletalMeshImportDesc;
+        using LoadDesc = SkeletalMeshLoadDesc;
+        using Desc = AssetDesc<SkeletalMesh>;
+
+    public:
+        SkeletalMesh(RenderContext& renderContext, AssetManager& assetManager, const Desc& snapshot, const Mesh& newMesh, Skeleton newSkeleton,
+            Vector<MeshletBoneBoundsRange> newMeshletBoneBoundsRanges, Vector<MeshletBoneBounds> newMeshletBoneBounds,
+            Vector<MeshletBoneBounds> newMeshBoneBounds);
+        SkeletalMesh(const SkeletalMesh&) = delete;
+        SkeletalMesh(SkeletalMesh&& other) noexcept;
+        ~SkeletalMesh();
+
+        SkeletalMesh& operator=(const SkeletalMesh&) = delete;
+        SkeletalMesh& operator=(SkeletalMesh&& rhs) noexcept;
+
+        [[nodiscard]] const Desc& GetSnapshot() const noexcept { return snapshot; }
+        [[nodiscard]] const Mesh& GetMesh() const noexcept { return mesh; }
+        [[nodiscard]] const Skeleton& GetSkeleton() const noexcept { return skeleton; }
+        [[nodiscard]] std::span<const MeshletBoneBoundsRange> GetMeshletBoneBoundsRanges() const noexcept { return meshletBoneBoundsRanges; }
+        [[nodiscard]] std::span<const MeshletBoneBounds> GetMeshletBoneBounds() const noexcept { return meshletBoneBounds; }
+        /* 메시 전체에 대한 Bone 단위 경계 */
+        [[nodiscard]] std::span<const MeshletBoneBounds> GetMeshBoneBounds() const noexcept { return meshBoneBounds; }
+        /* Unified Mesh Storage 에 상주 중인 메시와 CPU 측 Skeleton, Bone 경계 들의 크기 */
+        [[nodiscard]] Bytes GetResidentSize() const;
+
+    private:
+        void Destroy();
+
+    private:
+        RenderContext* renderContext{nullptr};
+        AssetManager* assetManager{nullptr};
+        Desc snapshot{};
+
+        Mesh mesh;
+        Skeleton skeleton;
+        Vector<MeshletBoneBoundsRange> meshletBoneBoundsRanges;
+        Vector<MeshletBoneBounds> meshletBoneBounds;
+        Vector<MeshletBoneBounds> meshBoneBounds;
+    };
+} // namespace ig
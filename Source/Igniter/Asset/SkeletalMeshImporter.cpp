@@ -0,0 +1,575 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Render/Vertex.h"
+#include "Igniter/Asset/SkeletalMeshImporter.h"
+#include "Igniter/Asset/MeshletCodec.h"
+
+IG_DECLARE_LOG_CATEGORY(SkeletalMeshImporterLog);
+
+IG_DEFINE_LOG_CATEGORY(SkeletalMeshImporterLog);
+
+namespace ig
+{
+    namespace
+    {
+        /* Assimp(Column-Vector) => SimpleMath(Row-Vector) */
+        Matrix ToMatrix(const aiMatrix4x4& matrix)
+        {
+            return Matrix{
+                matrix.a1, matrix.b1, matrix.c1, matrix.d1,
+                matrix.a2, matrix.b2, matrix.c2, matrix.d2,
+                matrix.a3, matrix.b3, matrix.c3, matrix.d3,
+                matrix.a4, matrix.b4, matrix.c4, matrix.d4};
+        }
+
+        aiMatrix4x4 ComputeGlobalTransform(const aiNode& node)
+        {
+            aiMatrix4x4 globalTransform = node.mTransformation;
+            for (const aiNode* ancestor = node.mParent; ancestor != nullptr; ancestor = ancestor->mParent)
+            {
+                globalTransform = ancestor->mTransformation * globalTransform;
+            }
+
+            return globalTransform;
+        }
+
+        const aiNode* FindMeshNode(const aiNode& node, const U32 meshIdx)
+        {
+            for (U32 nodeMeshIdx = 0; nodeMeshIdx < node.mNumMeshes; ++nodeMeshIdx)
+            {
+                if (node.mMeshes[nodeMeshIdx] == meshIdx)
+                {
+                    return &node;
+                }
+            }
+
+            for (U32 childIdx = 0; childIdx < node.mNumChildren; ++childIdx)
+            {
+                if (const aiNode* meshNode = FindMeshNode(*node.mChildren[childIdx], meshIdx);
+                    meshNode != nullptr)
+                {
+                    return meshNode;
+                }
+            }
+
+            return nullptr;
+        }
+
+        template <typename T>
+        std::span<const U8> AsBytes(const Vector<T>& elements)
+        {
+            return std::span<const U8>{reinterpret_cast<const U8*>(elements.data()), elements.size() * sizeof(T)};
+        }
+
+        /*
+         * vertexIndices 가 가리키는 정점 들의 Bone 단위 경계를 Bone 인덱스 순으로 추가 한다.
+         * 구는 Bone 공간 AABB 의 중심을 중심으로 한다. 최소 구는 아니지만, 입력 순서와 무관하게 같은 결과를 보장 한다.
+         */
+        void AppendBoneBounds(const std::span<const U32> vertexIndices, const std::span<const SkinnedVertex> vertices, const Skeleton& skeleton,
+            Vector<MeshletBoneBounds>& boneBounds)
+        {
+            Vector<std::pair<U32, Vector3>> boneSpacePositions{};
+            boneSpacePositions.reserve(vertexIndices.size() * SkinnedVertex::kMaxInfluences);
+            for (const U32 vertexIdx : vertexIndices)
+            {
+                const SkinnedVertex& vertex = vertices[vertexIdx];
+                for (U8 influenceIdx = 0; influenceIdx < SkinnedVertex::kMaxInfluences; ++influenceIdx)
+                {
+                    if (vertex.BoneWeights[influenceIdx] == 0)
+                    {
+                        continue;
+                    }
+
+                    const U32 boneIdx = vertex.BoneIndices[influenceIdx];
+                    boneSpacePositions.emplace_back(boneIdx, Vector3::Transform(vertex.Position, skeleton.InverseBindMatrices[boneIdx]));
+                }
+            }
+
+            std::stable_sort(boneSpacePositions.begin(), boneSpacePositions.end(),
+                [](const std::pair<U32, Vector3>& lhs, const std::pair<U32, Vector3>& rhs) { return lhs.first < rhs.first; });
+
+            for (Size groupBegin = 0; groupBegin < boneSpacePositions.size();)
+            {
+                const U32 boneIdx = boneSpacePositions[groupBegin].first;
+                Size groupEnd = groupBegin;
+                Vector3 min{FLT_MAX, FLT_MAX, FLT_MAX};
+                Vector3 max{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+                for (; groupEnd < boneSpacePositions.size() && boneSpacePositions[groupEnd].first == boneIdx; ++groupEnd)
+                {
+                    min = Vector3::Min(min, boneSpacePositions[groupEnd].second);
+                    max = Vector3::Max(max, boneSpacePositions[groupEnd].second);
+                }
+
+                BoundingSphere bounds{(min + max) * 0.5f, 0.f};
+                for (Size positionIdx = groupBegin; positionIdx < groupEnd; ++positionIdx)
+                {
+                    bounds.Radius = std::max(bounds.Radius, Vector3::Distance(bounds.Centroid, boneSpacePositions[positionIdx].second));
+                }
+
+                boneBounds.emplace_back(MeshletBoneBounds{.BoneSpaceBounds = bounds, .BoneIdx = boneIdx});
+                groupBegin = groupEnd;
+            }
+        }
+    } // namespace
+
+    SkeletalMeshImporter::SkeletalMeshImporter(tf::Executor& taskExecutor)
+        : taskExecutor(taskExecutor)
+    {}
+
+    Vector<Result<SkeletalMesh::Desc, ESkeletalMeshImportStatus>> SkeletalMeshImporter::Import(const std::string_view resPathStr,
+        const SkeletalMesh::ImportDesc& desc)
+    {
+        Vector<Result<SkeletalMesh::Desc, ESkeletalMeshImportStatus>> results;
+        const Path resPath{resPathStr};
+        if (!fs::exists(resPath))
+        {
+            results.emplace_back(MakeFail<SkeletalMesh::Desc, ESkeletalMeshImportStatus::FileDoesNotExists>());
+            return results;
+        }
+
+        Assimp::Importer importer;
+        const aiScene* scene = importer.ReadFile(resPathStr.data(), MakeAssimpImportFlagsFromDesc(desc));
+        if (scene == nullptr || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || scene->mRootNode == nullptr)
+        {
+            IG_LOG(SkeletalMeshImporterLog, Error, "Load model file from \"{}\" failed: \"{}\"", resPathStr, importer.GetErrorString());
+            results.emplace_back(MakeFail<SkeletalMesh::Desc, ESkeletalMeshImportStatus::FailedLoadFromFile>());
+            return results;
+        }
+
+        Vector<U32> skinnedMeshIndices{};
+        for (U32 meshIdx = 0; meshIdx < scene->mNumMeshes; ++meshIdx)
+        {
+            if (scene->mMeshes[meshIdx]->HasBones())
+            {
+                skinnedMeshIndices.emplace_back(meshIdx);
+            }
+        }
+        IG_LOG(SkeletalMeshImporterLog, Info, "{}: {} of {} meshes have bones.", resPathStr, skinnedMeshIndices.size(), scene->mNumMeshes);
+
+        const std::string modelName = resPath.filename().replace_extension().string();
+        results.resize(skinnedMeshIndices.size());
+        tf::Taskflow meshImportFlow;
+        meshImportFlow.for_each_index(
+            0, (S32)skinnedMeshIndices.size(), 1,
+            [scene, &results, &skinnedMeshIndices, &desc, &modelName](const Index resultIdx)
+            {
+                const U32 meshIdx = skinnedMeshIndices[resultIdx];
+                const aiMesh& mesh = *scene->mMeshes[meshIdx];
+                const std::string meshName = std::format("{}_{}_{}", modelName, mesh.mName.C_Str(), meshIdx);
+
+                details::SkeletalMeshData meshData{};
+                switch (const ESkeletalMeshImportStatus status = details::SkeletalMeshImportStages::Build(*scene, meshIdx, desc.bImproveCacheLocality, meshData))
+                {
+                case ESkeletalMeshImportStatus::Success:
+                    break;
+                case ESkeletalMeshImportStatus::MissingBoneNode:
+                    IG_LOG(SkeletalMeshImporterLog, Error, "{}: Failed to build skeleton ({}).", meshName, status);
+                    results[resultIdx] = MakeFail<SkeletalMesh::Desc, ESkeletalMeshImportStatus::MissingBoneNode>();
+                    return;
+                case ESkeletalMeshImportStatus::ExceededNumBones:
+                    IG_LOG(SkeletalMeshImporterLog, Error, "{}: Failed to build skeleton ({}).", meshName, status);
+                    results[resultIdx] = MakeFail<SkeletalMesh::Desc, ESkeletalMeshImportStatus::ExceededNumBones>();
+                    return;
+                case ESkeletalMeshImportStatus::EmptyVertices:
+                    results[resultIdx] = MakeFail<SkeletalMesh::Desc, ESkeletalMeshImportStatus::EmptyVertices>();
+                    return;
+                default:
+                    IG_CHECK(status == ESkeletalMeshImportStatus::EmptyIndices);
+                    results[resultIdx] = MakeFail<SkeletalMesh::Desc, ESkeletalMeshImportStatus::EmptyIndices>();
+                    return;
+                }
+
+                results[resultIdx] = ExportToFile(meshName, meshData);
+            });
+        taskExecutor.run(meshImportFlow).wait();
+        importer.FreeScene();
+
+        return results;
+    }
+
+    U32 SkeletalMeshImporter::MakeAssimpImportFlagsFromDesc(const SkeletalMesh::ImportDesc& desc)
+    {
+        U32 importFlags = aiProcess_Triangulate;
+        importFlags |= desc.bMakeLeftHanded ? aiProcess_MakeLeftHanded : 0;
+        importFlags |= desc.bFlipUVs ? aiProcess_FlipUVs : 0;
+        importFlags |= desc.bFlipWindingOrder ? aiProcess_FlipWindingOrder : 0;
+        importFlags |= aiProcess_GenSmoothNormals;
+        /* 정점 당 영향의 수는 ProcessSkinnedVertices 에서 다시 제한 된다. */
+        importFlags |= aiProcess_LimitBoneWeights;
+        return importFlags;
+    }
+
+    Result<SkeletalMesh::Desc, ESkeletalMeshImportStatus> SkeletalMeshImporter::ExportToFile(const std::string_view meshName,
+        const details::SkeletalMeshData& meshData)
+    {
+        const AssetInfo assetInfo{MakeVirtualPathPreferred(meshName), EAssetCategory::SkeletalMesh};
+        const SkeletalMeshLoadDesc newLoadDesc{details::SkeletalMeshImportStages::MakeLoadDesc(meshData)};
+        IG_LOG(SkeletalMeshImporterLog, Info, "{}: {} Bones, {} Vertices => {} bytes, {} Meshlets, {:.2f} Bone Bounds per Meshlet",
+            meshName, newLoadDesc.GetNumBones(),
+            newLoadDesc.NumVertices, newLoadDesc.CompressedVerticesSize,
+            newLoadDesc.NumMeshlets, (F32)newLoadDesc.NumMeshletBoneBounds / newLoadDesc.NumMeshlets);
+
+        Json assetMetadata{};
+        assetMetadata << assetInfo << newLoadDesc;
+        if (!SaveJsonToFile(MakeAssetMetadataPath(EAssetCategory::SkeletalMesh, assetInfo.GetGuid()), assetMetadata))
+        {
+            return MakeFail<SkeletalMesh::Desc, ESkeletalMeshImportStatus::FailedSaveMetadataToFile>();
+        }
+
+        Array<std::span<const U8>, 10> blobs{details::SkeletalMeshImportStages::GetBlobs(meshData)};
+        if (!SaveBlobsToFile(MakeAssetPath(EAssetCategory::SkeletalMesh, assetInfo.GetGuid()), blobs))
+        {
+            return MakeFail<SkeletalMesh::Desc, ESkeletalMeshImportStatus::FailedSaveAssetToFile>();
+        }
+
+        IG_CHECK(assetInfo.IsValid());
+        return MakeSuccess<SkeletalMesh::Desc, ESkeletalMeshImportStatus>(assetInfo, newLoadDesc);
+    }
+} // namespace ig
+
+namespace ig::details
+{
+    ESkeletalMeshImportStatus SkeletalMeshImportStages::Build(const aiScene& scene, const U32 meshIdx, const bool bImproveCacheLocality,
+        SkeletalMeshData& meshData)
+    {
+        IG_CHECK(meshIdx < scene.mNumMeshes);
+        Vector<U32> meshBoneToSkeletonBone{};
+        if (const ESkeletalMeshImportStatus status = BuildSkeleton(scene, meshIdx, meshData.MeshSkeleton, meshBoneToSkeletonBone);
+            status != ESkeletalMeshImportStatus::Success)
+        {
+            return status;
+        }
+
+        ProcessSkinnedVertices(*scene.mMeshes[meshIdx], meshBoneToSkeletonBone, meshData);
+        if (meshData.Vertices.empty())
+        {
+            return ESkeletalMeshImportStatus::EmptyVertices;
+        }
+        if (meshData.Indices.empty())
+        {
+            return ESkeletalMeshImportStatus::EmptyIndices;
+        }
+
+        if (bImproveCacheLocality)
+        {
+            OptimizeMesh(meshData);
+        }
+        BuildMeshlets(meshData);
+        BuildBoneBounds(meshData);
+        CompressMesh(meshData);
+        return ESkeletalMeshImportStatus::Success;
+    }
+
+    ESkeletalMeshImportStatus SkeletalMeshImportStages::BuildSkeleton(const aiScene& scene, const U32 meshIdx, Skeleton& skeleton,
+        Vector<U32>& meshBoneToSkeletonBone)
+    {
+        const aiMesh& mesh = *scene.mMeshes[meshIdx];
+        const aiNode& rootNode = *scene.mRootNode;
+
+        /* Bone 노드와 씬 루트를 제외한 그 조상 노드 들. Bone 이 아닌 노드는 Offset Matrix 를 가지지 않는다. */
+        UnorderedMap<const aiNode*, const aiBone*> skeletonNodes{};
+        for (U32 meshBoneIdx = 0; meshBoneIdx < mesh.mNumBones; ++meshBoneIdx)
+        {
+            const aiBone& bone = *mesh.mBones[meshBoneIdx];
+            const aiNode* boneNode = rootNode.FindNode(bone.mName);
+            if (boneNode == nullptr)
+            {
+                IG_LOG(SkeletalMeshImporterLog, Error, "Node of bone \"{}\" does not exists.", bone.mName.C_Str());
+                return ESkeletalMeshImportStatus::MissingBoneNode;
+            }
+
+            skeletonNodes[boneNode] = &bone;
+            for (const aiNode* ancestor = boneNode->mParent; ancestor != nullptr && ancestor != &rootNode; ancestor = ancestor->mParent)
+            {
+                skeletonNodes.emplace(ancestor, nullptr);
+            }
+        }
+
+        if (skeletonNodes.size() > Skeleton::kMaxBones)
+        {
+            IG_LOG(SkeletalMeshImporterLog, Error, "Number of bones {} exceeds limit {}.", skeletonNodes.size(), Skeleton::kMaxBones);
+            return ESkeletalMeshImportStatus::ExceededNumBones;
+        }
+
+        /* Bind Pose 의 Bone 변환은 메시 노드의 공간을 기준으로 한다. */
+        const aiNode* meshNode = FindMeshNode(rootNode, meshIdx);
+        const aiMatrix4x4 meshNodeTransform = meshNode != nullptr ? ComputeGlobalTransform(*meshNode) : aiMatrix4x4{};
+        const aiMatrix4x4 inverseMeshNodeTransform = aiMatrix4x4{meshNodeTransform}.Inverse();
+
+        skeleton = {};
+        skeleton.BoneNames.reserve(skeletonNodes.size());
+        /* 씬 루트는 스켈레톤에서 제외 되므로, 루트 Bone 의 부모는 항상 씬 루트 이다. */
+        skeleton.RootTransform = ToMatrix(inverseMeshNodeTransform * rootNode.mTransformation);
+        UnorderedMap<const aiNode*, U32> nodeBoneIndices{};
+        /* Pre-Order 순회; (노드, 가장 가까운 조상 Bone 인덱스) */
+        Vector<std::pair<const aiNode*, U32>> pendingNodes{std::make_pair(&rootNode, InvalidIndexU32)};
+        while (!pendingNodes.empty())
+        {
+            const auto [node, parentBoneIdx] = pendingNodes.back();
+            pendingNodes.pop_back();
+
+            U32 boneIdx = parentBoneIdx;
+            if (const auto skeletonNodeItr = skeletonNodes.find(node);
+                skeletonNodeItr != skeletonNodes.end())
+            {
+                boneIdx = (U32)skeleton.BoneNames.size();
+                nodeBoneIndices[node] = boneIdx;
+
+                const aiMatrix4x4 globalTransform = ComputeGlobalTransform(*node);
+                const aiBone* bone = skeletonNodeItr->second;
+                const aiMatrix4x4 inverseBindMatrix = bone != nullptr ? bone->mOffsetMatrix : aiMatrix4x4{globalTransform}.Inverse() * meshNodeTransform;
+                /* 조상이 모두 스켈레톤에 포함 되므로, 부모 Bone 은 항상 직계 부모 노드 이다. 루트 Bone 은 메시 공간에 대한 변환을 가진다. */
+                const aiMatrix4x4 bindLocalTransform = parentBoneIdx == InvalidIndexU32 ? inverseMeshNodeTransform * globalTransform : node->mTransformation;
+
+                skeleton.BoneNames.emplace_back(node->mName.C_Str());
+                skeleton.ParentIndices.emplace_back(parentBoneIdx);
+                skeleton.InverseBindMatrices.emplace_back(ToMatrix(inverseBindMatrix));
+                skeleton.BindLocalTransforms.emplace_back(ToMatrix(bindLocalTransform));
+            }
+
+            for (U32 childIdx = node->mNumChildren; childIdx > 0; --childIdx)
+            {
+                pendingNodes.emplace_back(node->mChildren[childIdx - 1], boneIdx);
+            }
+        }
+        IG_CHECK(skeleton.GetNumBones() == skeletonNodes.size());
+
+        meshBoneToSkeletonBone.resize(mesh.mNumBones);
+        for (U32 meshBoneIdx = 0; meshBoneIdx < mesh.mNumBones; ++meshBoneIdx)
+        {
+            meshBoneToSkeletonBone[meshBoneIdx] = nodeBoneIndices[rootNode.FindNode(mesh.mBones[meshBoneIdx]->mName)];
+        }
+
+        return ESkeletalMeshImportStatus::Success;
+    }
+
+    void SkeletalMeshImportStages::ProcessSkinnedVertices(const aiMesh& mesh, const std::span<const U32> meshBoneToSkeletonBone, SkeletalMeshData& meshData)
+    {
+        constexpr U8 kMaxInfluences = SkinnedVertex::kMaxInfluences;
+        /* 가중치가 큰 순서로 정렬 된 최대 4개의 영향 */
+        Vector<Array<F32, kMaxInfluences>> influenceWeights(mesh.mNumVertices, Array<F32, kMaxInfluences>{0.f, 0.f, 0.f, 0.f});
+        Vector<Array<U32, kMaxInfluences>> influenceBones(mesh.mNumVertices, Array<U32, kMaxInfluences>{0, 0, 0, 0});
+        for (U32 meshBoneIdx = 0; meshBoneIdx < mesh.mNumBones; ++meshBoneIdx)
+        {
+            const aiBone& bone = *mesh.mBones[meshBoneIdx];
+            for (U32 weightIdx = 0; weightIdx < bone.mNumWeights; ++weightIdx)
+            {
+                const aiVertexWeight& vertexWeight = bone.mWeights[weightIdx];
+                IG_CHECK(vertexWeight.mVertexId < mesh.mNumVertices);
+                Array<F32, kMaxInfluences>& weights = influenceWeights[vertexWeight.mVertexId];
+                Array<U32, kMaxInfluences>& bones = influenceBones[vertexWeight.mVertexId];
+                if (vertexWeight.mWeight <= weights[kMaxInfluences - 1])
+                {
+                    continue;
+                }
+
+                Index slot = kMaxInfluences - 1;
+                for (; slot > 0 && weights[slot - 1] < vertexWeight.mWeight; --slot)
+                {
+                    weights[slot] = weights[slot - 1];
+                    bones[slot] = bones[slot - 1];
+                }
+                weights[slot] = vertexWeight.mWeight;
+                bones[slot] = meshBoneToSkeletonBone[meshBoneIdx];
+            }
+        }
+
+        meshData.BoundingBox = AABB{.Min = Vector3{FLT_MAX, FLT_MAX, FLT_MAX}, .Max = Vector3{-FLT_MAX, -FLT_MAX, -FLT_MAX}};
+        meshData.Vertices.reserve(mesh.mNumVertices);
+        Size numUnweightedVertices = 0;
+        for (Size vertexIdx = 0; vertexIdx < mesh.mNumVertices; ++vertexIdx)
+        {
+            const aiVector3D position = mesh.mVertices[vertexIdx];
+            const aiVector3D normal = mesh.HasNormals() ? mesh.mNormals[vertexIdx] : aiVector3D(0.f, 0.f, 0.f);
+            const aiVector3D uvCoords = mesh.HasTextureCoords(0) ? mesh.mTextureCoords[0][vertexIdx] : aiVector3D(0.f, 0.f, 0.f);
+            const aiVector3D tangent = mesh.HasTangentsAndBitangents() ? mesh.mTangents[vertexIdx] : aiVector3D(0.f, 0.f, 0.f);
+            const aiVector3D bitangent = mesh.HasTangentsAndBitangents() ? mesh.mBitangents[vertexIdx] : aiVector3D(0.f, 0.f, 0.f);
+            const aiColor4D vertexColor = mesh.HasVertexColors(0) ? mesh.mColors[0][vertexIdx] : aiColor4D(0.f, 0.f, 0.f, 1.f);
+
+            SkinnedVertex newVertex{};
+            newVertex.Position = Vector3{position.x, position.y, position.z};
+            newVertex.QuantizedNormal = EncodeNormalX10Y10Z10(Vector3{normal.x, normal.y, normal.z});
+            newVertex.QuantizedTangent = EncodeNormalX10Y10Z10(Vector3{tangent.x, tangent.y, tangent.z});
+            newVertex.QuantizedBitangent = EncodeNormalX10Y10Z10(Vector3{bitangent.x, bitangent.y, bitangent.z});
+            newVertex.QuantizedTexCoords[0] = meshopt_quantizeHalf(uvCoords.x);
+            newVertex.QuantizedTexCoords[1] = meshopt_quantizeHalf(uvCoords.y);
+            newVertex.ColorRGBA8_U32 = EncodeRGBA32F(Vector4{vertexColor.r, vertexColor.g, vertexColor.b, vertexColor.a});
+
+            /* 영향이 없는 정점은 루트 Bone 을 따른다. */
+            numUnweightedVertices += influenceWeights[vertexIdx][0] <= 0.f ? 1 : 0;
+            QuantizeBoneWeights(std::span<const F32, kMaxInfluences>{influenceWeights[vertexIdx].data(), kMaxInfluences}, newVertex.BoneWeights);
+            for (U8 influenceIdx = 0; influenceIdx < kMaxInfluences; ++influenceIdx)
+            {
+                /* 가중치가 0 인 영향은 Bone 0 을 가리키도록 하여, 같은 정점이 같은 값을 가지도록 한다. (Vertex Codec 효율) */
+                newVertex.BoneIndices[influenceIdx] = newVertex.BoneWeights[influenceIdx] > 0 ? (U8)influenceBones[vertexIdx][influenceIdx] : 0;
+            }
+
+            meshData.BoundingBox.Min = Vector3::Min(meshData.BoundingBox.Min, newVertex.Position);
+            meshData.BoundingBox.Max = Vector3::Max(meshData.BoundingBox.Max, newVertex.Position);
+            meshData.Vertices.emplace_back(newVertex);
+        }
+
+        if (numUnweightedVertices > 0)
+        {
+            IG_LOG(SkeletalMeshImporterLog, Warning, "{}: {} vertices does not have any bone influence.", mesh.mName.C_Str(), numUnweightedVertices);
+        }
+
+        meshData.Indices.reserve((Size)mesh.mNumFaces * Mesh::kNumVertexPerTriangle);
+        for (Size faceIdx = 0; faceIdx < mesh.mNumFaces; ++faceIdx)
+        {
+            const aiFace& face = mesh.mFaces[faceIdx];
+            IG_CHECK(face.mNumIndices == Mesh::kNumVertexPerTriangle);
+            meshData.Indices.emplace_back(face.mIndices[0]);
+            meshData.Indices.emplace_back(face.mIndices[1]);
+            meshData.Indices.emplace_back(face.mIndices[2]);
+        }
+    }
+
+    void SkeletalMeshImportStages::OptimizeMesh(SkeletalMeshData& meshData)
+    {
+        meshopt_optimizeVertexCache(meshData.Indices.data(), meshData.Indices.data(), meshData.Indices.size(), meshData.Vertices.size());
+        meshopt_optimizeVertexFetch(meshData.Vertices.data(), meshData.Indices.data(), meshData.Indices.size(),
+            meshData.Vertices.data(), meshData.Vertices.size(), sizeof(SkinnedVertex));
+    }
+
+    void SkeletalMeshImportStages::BuildMeshlets(SkeletalMeshData& meshData)
+    {
+        IG_CHECK(!meshData.Vertices.empty());
+        IG_CHECK(!meshData.Indices.empty());
+
+        constexpr F32 kConeWeight = 0.f;
+        const Size maxMeshlets = meshopt_buildMeshletsBound(meshData.Indices.size(), Meshlet::kMaxVertices, Meshlet::kMaxTriangles);
+        Vector<meshopt_Meshlet> meshlets(maxMeshlets);
+        Vector<U8> triangles(maxMeshlets * Meshlet::kMaxTriangles * Mesh::kNumVertexPerTriangle);
+        meshData.MeshletVertexIndices.resize(maxMeshlets * Meshlet::kMaxVertices);
+
+        const Size numMeshlets = meshopt_buildMeshlets(
+            meshlets.data(),
+            meshData.MeshletVertexIndices.data(),
+            triangles.data(),
+            meshData.Indices.data(), meshData.Indices.size(),
+            &meshData.Vertices[0].Position.x, meshData.Vertices.size(), sizeof(SkinnedVertex),
+            Meshlet::kMaxVertices, Meshlet::kMaxTriangles, kConeWeight);
+
+        Size numIndices = 0;
+        U32 numTriangles = 0;
+        meshData.Meshlets.resize(numMeshlets);
+        meshData.MeshletTriangles.reserve(numMeshlets * Meshlet::kMaxTriangles);
+        for (Index meshletIdx = 0; meshletIdx < numMeshlets; ++meshletIdx)
+        {
+            const meshopt_Meshlet& meshOptMeshlet = meshlets[meshletIdx];
+            meshopt_optimizeMeshlet(
+                meshData.MeshletVertexIndices.data() + meshOptMeshlet.vertex_offset,
+                triangles.data() + meshOptMeshlet.triangle_offset,
+                meshOptMeshlet.triangle_count,
+                meshOptMeshlet.vertex_count);
+
+            const meshopt_Bounds meshletBounds = meshopt_computeMeshletBounds(
+                meshData.MeshletVertexIndices.data() + meshOptMeshlet.vertex_offset,
+                triangles.data() + meshOptMeshlet.triangle_offset, meshOptMeshlet.triangle_count,
+                &meshData.Vertices[0].Position.x, meshData.Vertices.size(), sizeof(SkinnedVertex));
+
+            Meshlet& meshlet = meshData.Meshlets[meshletIdx];
+            meshlet.IndexOffset = meshOptMeshlet.vertex_offset;
+            meshlet.NumIndices = meshOptMeshlet.vertex_count;
+            numIndices += meshOptMeshlet.vertex_count;
+
+            meshlet.TriangleOffset = numTriangles;
+            meshlet.NumTriangles = meshOptMeshlet.triangle_count;
+            for (Index triangleIdx = 0; triangleIdx < meshOptMeshlet.triangle_count; ++triangleIdx)
+            {
+                meshData.MeshletTriangles.emplace_back(
+                    EncodeTriangleU32(
+                        triangles[meshOptMeshlet.triangle_offset + triangleIdx * Mesh::kNumVertexPerTriangle + 0],
+                        triangles[meshOptMeshlet.triangle_offset + triangleIdx * Mesh::kNumVertexPerTriangle + 1],
+                        triangles[meshOptMeshlet.triangle_offset + triangleIdx * Mesh::kNumVertexPerTriangle + 2]));
+            }
+            numTriangles += meshOptMeshlet.triangle_count;
+
+            /* Bind Pose 기준의 경계. 포즈가 적용 된 경계는 MeshletBoneBounds 로 부터 계산 한다. */
+            meshlet.BoundingVolume = BoundingSphere{
+                Vector3{meshletBounds.center[0], meshletBounds.center[1], meshletBounds.center[2]},
+                meshletBounds.radius
+            };
+
+            /* 스키닝에 의해 노멀의 분포가 달라지기 때문에, Cutoff 를 1 로 두어 Normal Cone 컬링을 비활성화 한다. */
+            meshlet.QuantizedNormalConeAxis[0] = 127;
+            meshlet.QuantizedNormalConeAxis[1] = 127;
+            meshlet.QuantizedNormalConeAxis[2] = 254;
+            meshlet.QuantizedNormalConeCutoff = 254;
+        }
+
+        meshData.MeshletVertexIndices.resize(numIndices);
+    }
+
+    void SkeletalMeshImportStages::BuildBoneBounds(SkeletalMeshData& meshData)
+    {
+        IG_CHECK(!meshData.Meshlets.empty());
+        const Skeleton& skeleton = meshData.MeshSkeleton;
+        meshData.BoneBoundsRanges.resize(meshData.Meshlets.size());
+        for (Index meshletIdx = 0; meshletIdx < meshData.Meshlets.size(); ++meshletIdx)
+        {
+            const Meshlet& meshlet = meshData.Meshlets[meshletIdx];
+            MeshletBoneBoundsRange& range = meshData.BoneBoundsRanges[meshletIdx];
+            range.Offset = (U32)meshData.BoneBounds.size();
+            AppendBoneBounds(std::span<const U32>{meshData.MeshletVertexIndices.data() + meshlet.IndexOffset, meshlet.NumIndices},
+                meshData.Vertices, skeleton, meshData.BoneBounds);
+            range.NumBoneBounds = (U32)meshData.BoneBounds.size() - range.Offset;
+        }
+
+        Vector<U32> allVertexIndices(meshData.Vertices.size());
+        std::iota(allVertexIndices.begin(), allVertexIndices.end(), 0u);
+        AppendBoneBounds(allVertexIndices, meshData.Vertices, skeleton, meshData.MeshBoneBounds);
+    }
+
+    void SkeletalMeshImportStages::CompressMesh(SkeletalMeshData& meshData)
+    {
+        meshopt_encodeVertexVersion(0);
+        meshData.CompressedVertices.resize(meshopt_encodeVertexBufferBound(meshData.Vertices.size(), sizeof(SkinnedVertex)));
+        meshData.CompressedVertices.resize(
+            meshopt_encodeVertexBuffer(meshData.CompressedVertices.data(),
+                meshData.CompressedVertices.size(),
+                meshData.Vertices.data(),
+                meshData.Vertices.size(),
+                sizeof(SkinnedVertex)));
+
+        meshData.CompressedMeshletVertexIndices = details::MeshletCodec::EncodeVertexIndices(meshData.MeshletVertexIndices);
+        meshData.CompressedMeshletTriangles = details::MeshletCodec::EncodeTriangles(meshData.MeshletTriangles);
+        meshData.CompressedMeshlets = details::MeshletCodec::EncodeMeshlets(meshData.Meshlets);
+    }
+
+    SkeletalMeshLoadDesc SkeletalMeshImportStages::MakeLoadDesc(const SkeletalMeshData& meshData)
+    {
+        SkeletalMeshLoadDesc loadDesc{};
+        loadDesc.NumVertices = (U32)meshData.Vertices.size();
+        loadDesc.CompressedVerticesSize = (U32)meshData.CompressedVertices.size();
+        loadDesc.NumMeshletVertexIndices = (U32)meshData.MeshletVertexIndices.size();
+        loadDesc.NumMeshletTriangles = (U32)meshData.MeshletTriangles.size();
+        loadDesc.NumMeshlets = (U32)meshData.Meshlets.size();
+        loadDesc.CompressedMeshletVertexIndicesSize = (U32)meshData.CompressedMeshletVertexIndices.size();
+        loadDesc.CompressedMeshletTrianglesSize = (U32)meshData.CompressedMeshletTriangles.size();
+        loadDesc.CompressedMeshletsSize = (U32)meshData.CompressedMeshlets.size();
+        loadDesc.NumMeshletBoneBounds = (U32)meshData.BoneBounds.size();
+        loadDesc.NumMeshBoneBounds = (U32)meshData.MeshBoneBounds.size();
+        loadDesc.BoundingBox = meshData.BoundingBox;
+        loadDesc.BoneNames = meshData.MeshSkeleton.BoneNames;
+        loadDesc.BoneParentIndices = meshData.MeshSkeleton.ParentIndices;
+        return loadDesc;
+    }
+
+    Array<std::span<const U8>, 10> SkeletalMeshImportStages::GetBlobs(const SkeletalMeshData& meshData)
+    {
+        return Array<std::span<const U8>, 10>{
+            std::span<const U8>{meshData.CompressedVertices},
+            std::span<const U8>{meshData.CompressedMeshletVertexIndices},
+            std::span<const U8>{meshData.CompressedMeshletTriangles},
+            std::span<const U8>{meshData.CompressedMeshlets},
+            AsBytes(meshData.MeshSkeleton.InverseBindMatrices),
+            AsBytes(meshData.MeshSkeleton.BindLocalTransforms),
+            std::span<const U8>{reinterpret_cast<const U8*>(&meshData.MeshSkeleton.RootTransform), sizeof(Matrix)},
+            AsBytes(meshData.BoneBoundsRanges),
+            AsBytes(meshData.BoneBounds),
+            AsBytes(meshData.MeshBoneBounds)};
+    }
+} // namespace ig::details
@@ -0,0 +1,97 @@
+#pragma once
+#include "Igniter/Asset/SkeletalMesh.h"
+
+namespace ig
+{
+    enum class ESkeletalMeshImportStatus : U8
+    {
+        Success,
+        FileDoesNotExists,
+        FailedLoadFromFile,
+        FailedSaveMetadataToFile,
+        FailedSaveAssetToFile,
+        EmptyVertices,
+        EmptyIndices,
+        MissingBoneNode,
+        ExceededNumBones,
+    };
+
+    namespace details
+    {
+        struct SkeletalMeshData
+        {
+        public:
+            Vector<SkinnedVertex> Vertices;
+            Vector<U32> Indices;
+            Vector<U32> MeshletVertexIndices;
+            Vector<U32> MeshletTriangles;
+            Vector<Meshlet> Meshlets;
+            Vector<MeshletBoneBoundsRange> BoneBoundsRanges;
+            /* Meshlet 별 Bone 단위 경계; BoneBoundsRanges 로 참조 */
+            Vector<MeshletBoneBounds> BoneBounds;
+            Vector<MeshletBoneBounds> MeshBoneBounds;
+            Skeleton MeshSkeleton;
+            AABB BoundingBox;
+
+            Vector<U8> CompressedVertices;
+            Vector<U8> CompressedMeshletVertexIndices;
+            Vector<U8> CompressedMeshletTriangles;
+            Vector<U8> CompressedMeshlets;
+        };
+
+        /* Assimp 씬을 읽어 들인 이후의 임포트 단계. 파일 시스템에 의존하지 않기 때문에, 메모리 상의 씬 만으로 독립적으로 실행 할 수 있다. */
+        struct SkeletalMeshImportStages
+        {
+        public:
+            /* 스켈레톤 구성 부터 압축 까지의 모든 단계를 수행 한다. */
+            [[nodiscard]] static ESkeletalMeshImportStatus Build(const aiScene& scene, const U32 meshIdx, const bool bImproveCacheLocality,
+                SkeletalMeshData& meshData);
+
+            /* meshBoneToSkeletonBone[aiMesh Bone Index] = 스켈레톤 내 Bone 인덱스 */
+            static ESkeletalMeshImportStatus BuildSkeleton(const aiScene& scene, const U32 meshIdx, Skeleton& skeleton, Vector<U32>& meshBoneToSkeletonBone);
+            static void ProcessSkinnedVertices(const aiMesh& mesh, const std::span<const U32> meshBoneToSkeletonBone, SkeletalMeshData& meshData);
+            /* Vertex Cache => Vertex Fetch 순으로 최적화 */
+            static void OptimizeMesh(SkeletalMeshData& meshData);
+            static void BuildMeshlets(SkeletalMeshData& meshData);
+            static void BuildBoneBounds(SkeletalMeshData& meshData);
+            static void CompressMesh(SkeletalMeshData& meshData);
+
+            [[nodiscard]] static SkeletalMeshLoadDesc MakeLoadDesc(const SkeletalMeshData& meshData);
+            /* SkeletalMeshLoadDesc 의 Binary Layout 순서로 에셋 파일에 기록 되는 데이터 */
+            [[nodiscard]] static Array<std::span<const U8>, 10> GetBlobs(const SkeletalMeshData& meshData);
+        };
+    } // namespace details
+
+    class AssetManager;
+
+    /*
+     * #sy_note 스켈레탈 메시 임포트
+     * Bone 을 가진 aiMesh 마다 하나의 스켈레탈 메시 에셋을 생성한다. (Bone 이 없는 메시는 무시 되며, StaticMeshImporter 로 임포트 해야 한다.)
+     * 1. 메시의 Bone 노드와 그 조상 노드 들로 스켈레톤을 구성 (Pre-Order 이므로 부모가 항상 앞선다)
+     * 2. 정점 당 가중치가 큰 순서로 최대 4개의 영향을 남겨 8 Bits 로 양자화
+     * 3. Bind Pose 에서 Meshlet 을 생성하고, Meshlet/메시 별 Bone 단위 경계(MeshletBoneBounds)를 계산
+     * 스키닝 가중치를 보존하는 단순화가 필요하기 때문에 LOD 는 생성 하지 않는다.
+     */
+    class SkeletalMeshImporter final
+    {
+        friend class AssetManager;
+
+    public:
+        explicit SkeletalMeshImporter(tf::Executor& taskExecutor);
+        SkeletalMeshImporter(const SkeletalMeshImporter&) = delete;
+        SkeletalMeshImporter(SkeletalMeshImporter&&) noexcept = delete;
+        ~SkeletalMeshImporter() = default;
+
+        SkeletalMeshImporter& operator=(const SkeletalMeshImporter&) = delete;
+        SkeletalMeshImporter& operator=(SkeletalMeshImporter&&) noexcept = delete;
+
+    private:
+        Vector<Result<SkeletalMesh::Desc, ESkeletalMeshImportStatus>> Import(const std::string_view resPathStr, const SkeletalMesh::ImportDesc& desc);
+
+        static U32 MakeAssimpImportFlagsFromDesc(const SkeletalMesh::ImportDesc& desc);
+        static Result<SkeletalMesh::Desc, ESkeletalMeshImportStatus> ExportToFile(const std::string_view meshName, const details::SkeletalMeshData& meshData);
+
+    private:
+        tf::Executor& taskExecutor;
+    };
+} // namespace ig
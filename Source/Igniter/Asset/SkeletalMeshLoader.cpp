@@ -0,0 +1,265 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/D3D12/GpuBuffer.h"
+#include "Igniter/Render/GpuUploader.h"
+#include "Igniter/Render/RenderContext.h"
+#include "Igniter/Render/UnifiedMeshStorage.h"
+#include "Igniter/Asset/AssetManager.h"
+#include "Igniter/Asset/SkeletalMeshLoader.h"
+#include "Igniter/Asset/MeshletCodec.h"
+
+IG_DECLARE_LOG_CATEGORY(SkeletalMeshLoaderLog);
+
+IG_DEFINE_LOG_CATEGORY(SkeletalMeshLoaderLog);
+
+namespace ig::details
+{
+    namespace
+    {
+        template <typename T>
+        void CopyElements(const std::span<const U8> src, const Size offset, const Size numElements, Vector<T>& dst)
+        {
+            dst.resize(numElements);
+            std::memcpy(dst.data(), src.data() + offset, numElements * sizeof(T));
+        }
+    } // namespace
+
+    bool SkeletalMeshLoadStages::ValidateSkeleton(const SkeletalMeshLoadDesc& loadDesc)
+    {
+        const Size numBones = loadDesc.GetNumBones();
+        if (numBones == 0 || numBones > Skeleton::kMaxBones || loadDesc.BoneParentIndices.size() != numBones)
+        {
+            return false;
+        }
+
+        for (Index boneIdx = 0; boneIdx < numBones; ++boneIdx)
+        {
+            const U32 parentIdx = loadDesc.BoneParentIndices[boneIdx];
+            if (parentIdx != InvalidIndexU32 && parentIdx >= boneIdx)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool SkeletalMeshLoadStages::Decode(const SkeletalMeshLoadDesc& loadDesc, const std::span<const U8> blob, DecodedSkeletalMesh& decoded)
+    {
+        if (blob.size() != loadDesc.GetBlobSize())
+        {
+            return false;
+        }
+
+        const Size verticesSize = sizeof(SkinnedVertex) * loadDesc.NumVertices;
+        const Size indicesSize = sizeof(U32) * loadDesc.NumMeshletVertexIndices;
+        const Size trianglesSize = sizeof(U32) * loadDesc.NumMeshletTriangles;
+        const Size meshletsSize = sizeof(Meshlet) * loadDesc.NumMeshlets;
+        decoded.UploadPayload.resize(verticesSize + indicesSize + trianglesSize + meshletsSize);
+        U8* const payload = decoded.UploadPayload.data();
+        const std::span<SkinnedVertex> vertices{reinterpret_cast<SkinnedVertex*>(payload), loadDesc.NumVertices};
+        const std::span<U32> indices{reinterpret_cast<U32*>(payload + verticesSize), loadDesc.NumMeshletVertexIndices};
+        const std::span<U32> triangles{reinterpret_cast<U32*>(payload + verticesSize + indicesSize), loadDesc.NumMeshletTriangles};
+        const std::span<Meshlet> meshlets{reinterpret_cast<Meshlet*>(payload + verticesSize + indicesSize + trianglesSize), loadDesc.NumMeshlets};
+
+        if (meshopt_decodeVertexBuffer(vertices.data(), vertices.size(), sizeof(SkinnedVertex), blob.data(), loadDesc.CompressedVerticesSize) != 0)
+        {
+            return false;
+        }
+
+        Size offset = loadDesc.GetMeshletsOffset();
+        const std::span<const U8> encodedIndices{blob.subspan(offset, loadDesc.CompressedMeshletVertexIndicesSize)};
+        offset += encodedIndices.size();
+        const std::span<const U8> encodedTriangles{blob.subspan(offset, loadDesc.CompressedMeshletTrianglesSize)};
+        offset += encodedTriangles.size();
+        const std::span<const U8> encodedMeshlets{blob.subspan(offset, loadDesc.CompressedMeshletsSize)};
+        if (!MeshletCodec::DecodeVertexIndices(encodedIndices, indices) ||
+            !MeshletCodec::DecodeTriangles(encodedTriangles, triangles) ||
+            !MeshletCodec::DecodeMeshlets(encodedMeshlets, meshlets))
+        {
+            return false;
+        }
+
+        const Size numBones = loadDesc.GetNumBones();
+        Skeleton& skeleton = decoded.MeshSkeleton;
+        skeleton.BoneNames = loadDesc.BoneNames;
+        skeleton.ParentIndices = loadDesc.BoneParentIndices;
+        offset = loadDesc.GetSkeletonOffset();
+        CopyElements(blob, offset, numBones, skeleton.InverseBindMatrices);
+        offset += sizeof(Matrix) * numBones;
+        CopyElements(blob, offset, numBones, skeleton.BindLocalTransforms);
+        offset += sizeof(Matrix) * numBones;
+        std::memcpy(&skeleton.RootTransform, blob.data() + offset, sizeof(Matrix));
+
+        offset = loadDesc.GetBoneBoundsOffset();
+        CopyElements(blob, offset, loadDesc.NumMeshlets, decoded.BoneBoundsRanges);
+        offset += sizeof(MeshletBoneBoundsRange) * loadDesc.NumMeshlets;
+        CopyElements(blob, offset, loadDesc.NumMeshletBoneBounds, decoded.BoneBounds);
+        offset += sizeof(MeshletBoneBounds) * loadDesc.NumMeshletBoneBounds;
+        CopyElements(blob, offset, loadDesc.NumMeshBoneBounds, decoded.MeshBoneBounds);
+        IG_CHECK(offset + sizeof(MeshletBoneBounds) * loadDesc.NumMeshBoneBounds == blob.size());
+
+        /* 셰이더가 Bone 팔레트의 범위를 벗어나 읽지 않도록, 모든 Bone 인덱스를 검사 한다. */
+        for (const SkinnedVertex& vertex : vertices)
+        {
+            for (U8 influenceIdx = 0; influenceIdx < SkinnedVertex::kMaxInfluences; ++influenceIdx)
+            {
+                if (vertex.BoneIndices[influenceIdx] >= numBones)
+                {
+                    return false;
+                }
+            }
+        }
+
+        const auto isValidBoneBounds = [numBones](const MeshletBoneBounds& boneBounds) { return boneBounds.BoneIdx < numBones; };
+        if (!std::all_of(decoded.BoneBounds.cbegin(), decoded.BoneBounds.cend(), isValidBoneBounds) ||
+            !std::all_of(decoded.MeshBoneBounds.cbegin(), decoded.MeshBoneBounds.cend(), isValidBoneBounds))
+        {
+            return false;
+        }
+
+        return std::all_of(decoded.BoneBoundsRanges.cbegin(), decoded.BoneBoundsRanges.cend(),
+            [numBoneBounds = decoded.BoneBounds.size()](const MeshletBoneBoundsRange& range)
+            {
+                return (Size)range.Offset + range.NumBoneBounds <= numBoneBounds;
+            });
+    }
+} // namespace ig::details
+
+namespace ig
+{
+    SkeletalMeshLoader::SkeletalMeshLoader(RenderContext& renderContext, AssetManager& assetManager)
+        : renderContext(renderContext)
+        , assetManager(assetManager)
+    {}
+
+    Result<SkeletalMesh, ESkeletalMeshLoadStatus> SkeletalMeshLoader::Load(const SkeletalMesh::Desc& desc) const
+    {
+        const AssetInfo& assetInfo{desc.Info};
+        const SkeletalMeshLoadDesc& loadDesc{desc.LoadDescriptor};
+        if (!assetInfo.IsValid())
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::InvalidAssetInfo>();
+        }
+
+        if (assetInfo.GetCategory() != EAssetCategory::SkeletalMesh)
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::AssetTypeMismatch>();
+        }
+
+        if (loadDesc.NumVertices == 0)
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::ZeroNumVertices>();
+        }
+
+        if (loadDesc.NumMeshlets == 0 || loadDesc.NumMeshletVertexIndices == 0 || loadDesc.NumMeshletTriangles == 0)
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::ZeroNumMeshlets>();
+        }
+
+        if (!details::SkeletalMeshLoadStages::ValidateSkeleton(loadDesc))
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::InvalidSkeleton>();
+        }
+
+        Vector<U8> looseBlob{};
+        std::span<const U8> blob{assetManager.FindPackedAsset(assetInfo.GetGuid())};
+        if (blob.empty())
+        {
+            const Path assetPath = MakeAssetPath(EAssetCategory::SkeletalMesh, assetInfo.GetGuid());
+            if (!fs::exists(assetPath))
+            {
+                return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::FileDoesNotExists>();
+            }
+
+            looseBlob = LoadBlobFromFile(assetPath);
+            blob = std::span<const U8>{looseBlob.data(), looseBlob.size()};
+        }
+
+        if (blob.size() != loadDesc.GetBlobSize())
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::BlobSizeMismatch>();
+        }
+
+        details::DecodedSkeletalMesh decoded{};
+        if (!details::SkeletalMeshLoadStages::Decode(loadDesc, blob, decoded))
+        {
+            IG_LOG(SkeletalMeshLoaderLog, Error, "Failed to decode skeletal mesh {}.", assetInfo.GetVirtualPath());
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::FailedDecode>();
+        }
+
+        UnifiedMeshStorage& unifiedMeshStorage = renderContext.GetUnifiedMeshStorage();
+        const auto kDeleter = [&unifiedMeshStorage](Mesh* mesh)
+        {
+            IG_CHECK(mesh != nullptr);
+            unifiedMeshStorage.Deallocate(mesh->VertexStorageAlloc);
+            unifiedMeshStorage.Deallocate(mesh->LevelOfDetails[0].IndexStorageAlloc);
+            unifiedMeshStorage.Deallocate(mesh->LevelOfDetails[0].TriangleStorageAlloc);
+            unifiedMeshStorage.Deallocate(mesh->LevelOfDetails[0].MeshletStorageAlloc);
+        };
+        /* Ptr의 RAII를 통해 Load 실패 시 안전하게 자원을 해제; 성공 시 Release를 통해 자원 해제 비활성화 */
+        Mesh newMesh;
+        Ptr<Mesh, decltype(kDeleter)> meshGuard{&newMesh, kDeleter};
+        newMesh.NumLevelOfDetails = 1;
+        newMesh.BoundingBox = loadDesc.BoundingBox;
+
+        newMesh.VertexStorageAlloc = unifiedMeshStorage.AllocateVertices<SkinnedVertex>(loadDesc.NumVertices);
+        if (!newMesh.VertexStorageAlloc)
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::FailedAllocateVertexSpace>();
+        }
+
+        MeshLod& meshLod = newMesh.LevelOfDetails[0];
+        meshLod.IndexStorageAlloc = unifiedMeshStorage.AllocateIndices(loadDesc.NumMeshletVertexIndices);
+        if (!meshLod.IndexStorageAlloc)
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::FailedAllocateIndexSpace>();
+        }
+
+        meshLod.TriangleStorageAlloc = unifiedMeshStorage.AllocateTriangles(loadDesc.NumMeshletTriangles);
+        if (!meshLod.TriangleStorageAlloc)
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::FailedAllocateTriangleSpace>();
+        }
+
+        meshLod.MeshletStorageAlloc = unifiedMeshStorage.AllocateMeshlets(loadDesc.NumMeshlets);
+        if (!meshLod.MeshletStorageAlloc)
+        {
+            return MakeFail<SkeletalMesh, ESkeletalMeshLoadStatus::FailedAllocateMeshletSpace>();
+        }
+
+        const MeshVertexAllocation* vertexAllocPtr = unifiedMeshStorage.Lookup(newMesh.VertexStorageAlloc);
+        const GpuStorage::Allocation* indexAllocPtr = unifiedMeshStorage.Lookup(meshLod.IndexStorageAlloc);
+        const GpuStorage::Allocation* triangleAllocPtr = unifiedMeshStorage.Lookup(meshLod.TriangleStorageAlloc);
+        const GpuStorage::Allocation* meshletAllocPtr = unifiedMeshStorage.Lookup(meshLod.MeshletStorageAlloc);
+        IG_CHECK(vertexAllocPtr != nullptr && indexAllocPtr != nullptr && triangleAllocPtr != nullptr && meshletAllocPtr != nullptr);
+        IG_CHECK(vertexAllocPtr->Alloc.AllocSize + indexAllocPtr->AllocSize + triangleAllocPtr->AllocSize + meshletAllocPtr->AllocSize ==
+            decoded.UploadPayload.size());
+
+        GpuBuffer* vertexStorageBufferPtr = renderContext.Lookup(unifiedMeshStorage.GetVertexStorageBuffer());
+        GpuBuffer* indexStorageBufferPtr = renderContext.Lookup(unifiedMeshStorage.GetIndexStorageBuffer());
+        GpuBuffer* triangleStorageBufferPtr = renderContext.Lookup(unifiedMeshStorage.GetTriangleStorageBuffer());
+        GpuBuffer* meshletStorageBufferPtr = renderContext.Lookup(unifiedMeshStorage.GetMeshletStorageBuffer());
+        IG_CHECK(vertexStorageBufferPtr != nullptr && indexStorageBufferPtr != nullptr && triangleStorageBufferPtr != nullptr && meshletStorageBufferPtr != nullptr);
+
+        /* 정점과 Meshlet 데이터를 하나의 업로드 컨텍스트에 기록하여 메시 당 한 번만 제출 한다. */
+        GpuUploader& gpuUploader{renderContext.GetNonFrameCriticalGpuUploader()};
+        UploadContext uploadCtx = gpuUploader.Reserve(decoded.UploadPayload.size());
+        std::memcpy(uploadCtx.GetOffsettedCpuAddress(), decoded.UploadPayload.data(), decoded.UploadPayload.size());
+
+        Size uploadCtxOffset = 0;
+        uploadCtx.CopyBuffer(uploadCtxOffset, vertexAllocPtr->Alloc.AllocSize, *vertexStorageBufferPtr, vertexAllocPtr->Alloc.Offset);
+        uploadCtxOffset += vertexAllocPtr->Alloc.AllocSize;
+        uploadCtx.CopyBuffer(uploadCtxOffset, indexAllocPtr->AllocSize, *indexStorageBufferPtr, indexAllocPtr->Offset);
+        uploadCtxOffset += indexAllocPtr->AllocSize;
+        uploadCtx.CopyBuffer(uploadCtxOffset, triangleAllocPtr->AllocSize, *triangleStorageBufferPtr, triangleAllocPtr->Offset);
+        uploadCtxOffset += triangleAllocPtr->AllocSize;
+        uploadCtx.CopyBuffer(uploadCtxOffset, meshletAllocPtr->AllocSize, *meshletStorageBufferPtr, meshletAllocPtr->Offset);
+        newMesh.UploadSync = gpuUploader.Submit(uploadCtx);
+
+        meshGuard.release();
+        return MakeSuccess<SkeletalMesh, ESkeletalMeshLoadStatus>(renderContext, assetManager, desc, newMesh,
+            std::move(decoded.MeshSkeleton), std::move(decoded.BoneBoundsRanges), std::move(decoded.BoneBounds), std::move(decoded.MeshBoneBounds));
+    }
+} // namespace ig
@@ -0,0 +1,71 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Asset/SkeletalMesh.h"
+
+namespace ig
+{
+    enum class ESkeletalMeshLoadStatus
+    {
+        Success,
+        InvalidAssetInfo,
+        AssetTypeMismatch,
+        ZeroNumVertices,
+        ZeroNumMeshlets,
+        InvalidSkeleton,
+        FileDoesNotExists,
+        BlobSizeMismatch,
+        FailedDecode,
+        FailedAllocateVertexSpace,
+        FailedAllocateIndexSpace,
+        FailedAllocateTriangleSpace,
+        FailedAllocateMeshletSpace,
+    };
+
+    class AssetManager;
+    class RenderContext;
+
+    namespace details
+    {
+        struct DecodedSkeletalMesh
+        {
+        public:
+            /* [SkinnedVertex * NumVertices][U32 * NumMeshletVertexIndices][U32 * NumMeshletTriangles][Meshlet * NumMeshlets] */
+            Vector<U8> UploadPayload;
+            Skeleton MeshSkeleton;
+            Vector<MeshletBoneBoundsRange> BoneBoundsRanges;
+            Vector<MeshletBoneBounds> BoneBounds;
+            Vector<MeshletBoneBounds> MeshBoneBounds;
+        };
+
+        /* GPU 자원에 의존하지 않기 때문에, 메모리 버퍼 만으로 독립적으로 실행 할 수 있다. */
+        struct SkeletalMeshLoadStages
+        {
+        public:
+            /* 스켈레톤 계층(부모가 자식 보다 앞선 인덱스)과 Bone 수 제한을 검사 한다. */
+            [[nodiscard]] static bool ValidateSkeleton(const SkeletalMeshLoadDesc& loadDesc);
+            /* blob 은 에셋 파일 전체 이어야 하며, 모든 Bone 인덱스가 스켈레톤 범위 내 인지 검사 한다. */
+            [[nodiscard]] static bool Decode(const SkeletalMeshLoadDesc& loadDesc, const std::span<const U8> blob, DecodedSkeletalMesh& decoded);
+        };
+    } // namespace details
+
+    class SkeletalMeshLoader final
+    {
+        friend class AssetManager;
+
+    public:
+        SkeletalMeshLoader(RenderContext& renderContext, AssetManager& assetManager);
+        SkeletalMeshLoader(const SkeletalMeshLoader&) = delete;
+        SkeletalMeshLoader(SkeletalMeshLoader&&) noexcept = delete;
+        ~SkeletalMeshLoader() = default;
+
+        SkeletalMeshLoader& operator=(const SkeletalMeshLoader&) = delete;
+        SkeletalMeshLoader& operator=(SkeletalMeshLoader&&) noexcept = delete;
+
+    private:
+        [[nodiscard]] Result<SkeletalMesh, ESkeletalMeshLoadStatus> Load(const SkeletalMesh::Desc& desc) const;
+
+    private:
+        RenderContext& renderContext;
+        AssetManager& assetManager;
+    };
+} // namespace ig
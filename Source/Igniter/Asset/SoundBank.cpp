@@ -0,0 +1,85 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Memory.h"
+#include "Igniter/Asset/SoundBank.h"
+
+namespace ig::details
+{
+    Vector<U8> SoundBank::Build(const std::span<const Vector<U8>> clips)
+    {
+        const Size tableOffset = sizeof(Header);
+        Size dataOffset = tableOffset + sizeof(Entry) * clips.size();
+        Vector<Entry> entries(clips.size());
+        for (Index clipIdx = 0; clipIdx < clips.size(); ++clipIdx)
+        {
+            dataOffset = AlignTo(dataOffset, kDataAlignment);
+            entries[clipIdx] = Entry{.Offset = dataOffset, .Size = clips[clipIdx].size()};
+            dataOffset += clips[clipIdx].size();
+        }
+
+        Vector<U8> bank(dataOffset, 0);
+        const Header header{.NumEntries = static_cast<U32>(clips.size())};
+        std::memcpy(bank.data(), &header, sizeof(Header));
+        if (!entries.empty())
+        {
+            std::memcpy(bank.data() + tableOffset, entries.data(), sizeof(Entry) * entries.size());
+        }
+
+        for (Index clipIdx = 0; clipIdx < clips.size(); ++clipIdx)
+        {
+            if (!clips[clipIdx].empty())
+            {
+                std::memcpy(bank.data() + entries[clipIdx].Offset, clips[clipIdx].data(), clips[clipIdx].size());
+            }
+        }
+
+        return bank;
+    }
+
+    bool SoundBank::Validate(const std::span<const U8> bank)
+    {
+        if (bank.size() < sizeof(Header))
+        {
+            return false;
+        }
+
+        Header header{};
+        std::memcpy(&header, bank.data(), sizeof(Header));
+        if (header.Magic != Header::kMagic || header.Version != Header::kVersion ||
+            sizeof(Header) + sizeof(Entry) * static_cast<Size>(header.NumEntries) > bank.size())
+        {
+            return false;
+        }
+
+        for (Index entryIdx = 0; entryIdx < header.NumEntries; ++entryIdx)
+        {
+            Entry entry{};
+            std::memcpy(&entry, bank.data() + sizeof(Header) + sizeof(Entry) * entryIdx, sizeof(Entry));
+            if (entry.Offset > bank.size() || entry.Size > bank.size() - entry.Offset)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    U32 SoundBank::GetNumEntries(const std::span<const U8> bank)
+    {
+        IG_CHECK(bank.size() >= sizeof(Header));
+        Header header{};
+        std::memcpy(&header, bank.data(), sizeof(Header));
+        return header.NumEntries;
+    }
+
+    std::span<const U8> SoundBank::GetEntryData(const std::span<const U8> bank, const Index entryIdx)
+    {
+        if (entryIdx >= GetNumEntries(bank))
+        {
+            return {};
+        }
+
+        Entry entry{};
+        std::memcpy(&entry, bank.data() + sizeof(Header) + sizeof(Entry) * entryIdx, sizeof(Entry));
+        return bank.subspan(entry.Offset, entry.Size);
+    }
+} // namespace ig::details
@@ -0,0 +1,50 @@
+#pragma once
+#include "Igniter/Igniter.h"
+
+namespace ig::details
+{
+    /*
+     * #sy_note 사운드 뱅크
+     * 짧은 오디오 클립 들을 하나의 파일로 묶어, 한번의 읽기로 모든 클립을 메모리에 올릴 수 있도록 한다.
+     * 각 클립은 뱅크 에셋의 Guid 와 엔트리 인덱스를 통해 Offset Table 에서 자신의 데이터 영역을 찾는다.
+     *
+     * Binary Layout
+     * Header => [0, sizeof(Header))
+     * Offset Table => [sizeof(Header), sizeof(Header) + sizeof(Entry) * Header::NumEntries)
+     * Clip Data => [Entry::Offset, Entry::Offset + Entry::Size), aligned to kDataAlignment
+     */
+    class SoundBank final
+    {
+    public:
+        constexpr static Size kDataAlignment = 16;
+
+        struct Header
+        {
+        public:
+            constexpr static U32 kMagic = 0x42534749; /* 'IGSB' */
+            constexpr static U32 kVersion = 1;
+
+        public:
+            U32 Magic = kMagic;
+            U32 Version = kVersion;
+            U32 NumEntries = 0;
+            U32 Padding = 0;
+        };
+
+        struct Entry
+        {
+        public:
+            U64 Offset = 0;
+            U64 Size = 0;
+        };
+
+    public:
+        [[nodiscard]] static Vector<U8> Build(const std::span<const Vector<U8>> clips);
+
+        /* 헤더와 Offset Table 이 유효 하고, 모든 엔트리가 뱅크 범위 안에 있다면 true */
+        [[nodiscard]] static bool Validate(const std::span<const U8> bank);
+        [[nodiscard]] static U32 GetNumEntries(const std::span<const U8> bank);
+        /* Validate 된 뱅크 에서 엔트리의 데이터; 범위를 벗어난 경우 빈 span */
+        [[nodiscard]] static std::span<const U8> GetEntryData(const std::span<const U8> bank, const Index entryIdx);
+    };
+} // namespace ig::details
@@ -6,6 +6,31 @@
 #include "Igniter/Asset/AssetManager.h"
 #include "Igniter/Asset/StaticMesh.h"
 
+namespace ig::details
+{
+    Json& MeshLodStatistics::Serialize(Json& archive) const
+    {
+        IG_SERIALIZE_TO_JSON(MeshLodStatistics, archive, Acmr);
+        IG_SERIALIZE_TO_JSON(MeshLodStatistics, archive, Atvr);
+        IG_SERIALIZE_TO_JSON(MeshLodStatistics, archive, Overdraw);
+        IG_SERIALIZE_TO_JSON(MeshLodStatistics, archive, Overfetch);
+        IG_SERIALIZE_TO_JSON(MeshLodStatistics, archive, MeshletVertexFill);
+        IG_SERIALIZE_TO_JSON(MeshLodStatistics, archive, MeshletTriangleFill);
+        return archive;
+    }
+
+    const Json& MeshLodStatistics::Deserialize(const Json& archive)
+    {
+        IG_DESERIALIZE_FROM_JSON(MeshLodStatistics, archive, Acmr);
+        IG_DESERIALIZE_FROM_JSON(MeshLodStatistics, archive, Atvr);
+        IG_DESERIALIZE_FROM_JSON(MeshLodStatistics, archive, Overdraw);
+        IG_DESERIALIZE_FROM_JSON(MeshLodStatistics, archive, Overfetch);
+        IG_DESERIALIZE_FROM_JSON(MeshLodStatistics, archive, MeshletVertexFill);
+        IG_DESERIALIZE_FROM_JSON(MeshLodStatistics, archive, MeshletTriangleFill);
+        return archive;
+    }
+} // namespace ig::details
+
 namespace ig
 {
     Json& StaticMeshImportDesc::Serialize(Json& archive) const
@@ -20,6 +45,9 @@ namespace ig
         IG_SERIALIZE_TO_JSON(StaticMeshImportDesc, archive, bGenerateBoundingBoxes);
         IG_SERIALIZE_TO_JSON(StaticMeshImportDesc, archive, bImportMaterials);
         IG_SERIALIZE_TO_JSON(StaticMeshImportDesc, archive, bGenerateLODs);
+        IG_SERIALIZE_TO_JSON(StaticMeshImportDesc, archive, bBuildClusterHierarchy);
+        IG_SERIALIZE_TO_JSON(StaticMeshImportDesc, archive, VertexFormat);
+        IG_SERIALIZE_TO_JSON(StaticMeshImportDesc, archive, bImportAsScene);
         return archive;
     }
 
@@ -36,6 +64,9 @@ namespace ig
         IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshImportDesc, archive, bGenerateBoundingBoxes);
         IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshImportDesc, archive, bImportMaterials);
         IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshImportDesc, archive, bGenerateLODs);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshImportDesc, archive, bBuildClusterHierarchy);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshImportDesc, archive, VertexFormat);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshImportDesc, archive, bImportAsScene);
         return archive;
     }
 
@@ -48,8 +79,20 @@ namespace ig
         IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, NumMeshletTriangles);
         IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, NumMeshlets);
         IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, BoundingBox);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, bCoarsestLodFirst);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, bCompressedLevelOfDetails);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, bClusterHierarchy);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, VertexFormat);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, TexCoordMin);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, TexCoordMax);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, CompressedMeshletVertexIndicesSize);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, CompressedMeshletTrianglesSize);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, CompressedMeshletsSize);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, LevelOfDetailErrors);
         IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, bOverrideLodScreenCoverageThresholds);
         IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, LodScreenCoverageThresholds);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, LevelOfDetailStatistics);
+        IG_SERIALIZE_TO_JSON(StaticMeshLoadDesc, archive, UnoptimizedStatistics);
         return archive;
     }
 
@@ -63,11 +106,76 @@ namespace ig
         IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, NumMeshletTriangles);
         IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, NumMeshlets);
         IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, BoundingBox);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, bCoarsestLodFirst);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, bCompressedLevelOfDetails);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, bClusterHierarchy);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, VertexFormat);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, TexCoordMin);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, TexCoordMax);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, CompressedMeshletVertexIndicesSize);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, CompressedMeshletTrianglesSize);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, CompressedMeshletsSize);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, LevelOfDetailErrors);
         IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, bOverrideLodScreenCoverageThresholds);
         IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, LodScreenCoverageThresholds);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, LevelOfDetailStatistics);
+        IG_DESERIALIZE_FROM_JSON_NO_FALLBACK(StaticMeshLoadDesc, archive, UnoptimizedStatistics);
         return archive;
     }
 
+    Size StaticMeshLoadDesc::GetLevelOfDetailSize(const U8 lod) const
+    {
+        IG_CHECK(lod < NumLevelOfDetails);
+        if (bCompressedLevelOfDetails)
+        {
+            return (Size)CompressedMeshletVertexIndicesSize[lod] + CompressedMeshletTrianglesSize[lod] + CompressedMeshletsSize[lod];
+        }
+
+        return GetDecodedLevelOfDetailSize(lod);
+    }
+
+    Size StaticMeshLoadDesc::GetDecodedLevelOfDetailSize(const U8 lod) const
+    {
+        IG_CHECK(lod < NumLevelOfDetails);
+        return sizeof(U32) * NumMeshletVertexIndices[lod] +
+            sizeof(U32) * NumMeshletTriangles[lod] +
+            sizeof(Meshlet) * NumMeshlets[lod];
+    }
+
+    Size StaticMeshLoadDesc::GetLevelOfDetailOffset(const U8 lod) const
+    {
+        IG_CHECK(lod < NumLevelOfDetails);
+        Size offset = CompressedVerticesSize;
+        if (bCoarsestLodFirst)
+        {
+            for (U8 coarserLod = NumLevelOfDetails - 1; coarserLod > lod; --coarserLod)
+            {
+                offset += GetLevelOfDetailSize(coarserLod);
+            }
+        }
+        else
+        {
+            for (U8 finerLod = 0; finerLod < lod; ++finerLod)
+            {
+                offset += GetLevelOfDetailSize(finerLod);
+            }
+        }
+
+        return offset;
+    }
+
+    Size StaticMeshLoadDesc::GetResidentBlobSize(const U8 minResidentLod) const
+    {
+        IG_CHECK(minResidentLod < NumLevelOfDetails);
+        Size residentBlobSize = CompressedVerticesSize;
+        for (U8 lod = minResidentLod; lod < NumLevelOfDetails; ++lod)
+        {
+            residentBlobSize = std::max(residentBlobSize, GetLevelOfDetailOffset(lod) + GetLevelOfDetailSize(lod));
+        }
+
+        return residentBlobSize;
+    }
+
     StaticMesh::StaticMesh(RenderContext& renderContext, AssetManager& assetManager, const Desc& snapshot, const Mesh& newMesh)
         : renderContext(&renderContext)
         , assetManager(&assetManager)
@@ -97,6 +205,11 @@ namespace ig
         return *this;
     }
 
+    Bytes StaticMesh::GetResidentSize() const
+    {
+        return sizeof(StaticMesh) + (renderContext != nullptr ? renderContext->GetUnifiedMeshStorage().GetResidentSize(mesh) : 0);
+    }
+
     void StaticMesh::Destroy()
     {
         if (renderContext == nullptr)
@@ -104,26 +217,12 @@ namespace ig
             return;
         }
 
+        /* 업로드가 진행 중인 경우, 업로드가 끝난 이후에 해제 된다. */
         UnifiedMeshStorage& unifiedMeshStorae = renderContext->GetUnifiedMeshStorage();
+        unifiedMeshStorae.Deallocate(mesh.VertexStorageAlloc, mesh.UploadSync);
+        for (U8 lod = mesh.MinResidentLevelOfDetail; lod < mesh.NumLevelOfDetails; ++lod)
         {
-            unifiedMeshStorae.Deallocate(mesh.VertexStorageAlloc);
-        }
-
-        for (U8 lod = 0; lod < mesh.NumLevelOfDetails; ++lod)
-        {
-            MeshLod& meshLod = mesh.LevelOfDetails[lod];
-            if (meshLod.IndexStorageAlloc)
-            {
-                unifiedMeshStorae.Deallocate(meshLod.IndexStorageAlloc);
-            }
-            if (meshLod.TriangleStorageAlloc)
-            {
-                unifiedMeshStorae.Deallocate(meshLod.TriangleStorageAlloc);
-            }
-            if (meshLod.MeshletStorageAlloc)
-            {
-                unifiedMeshStorae.Deallocate(meshLod.MeshletStorageAlloc);
-            }
+            unifiedMeshStorae.Deallocate(mesh.LevelOfDetails[lod], mesh.UploadSync);
         }
 
         snapshot = {};
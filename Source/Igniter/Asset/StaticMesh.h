@@ -4,6 +4,26 @@
 #include "Igniter/Render/Vertex.h"
 #include "Igniter/Asset/Common.h"
 
+namespace ig::details
+{
+    /* 임포트 시 측정 된 LOD 의 렌더링 효율. ACMR/ATVR 는 16 엔트리 FIFO 캐시 기준 */
+    struct MeshLodStatistics
+    {
+    public:
+        Json& Serialize(Json& archive) const;
+        const Json& Deserialize(const Json& archive);
+
+    public:
+        F32 Acmr = 0.f;
+        F32 Atvr = 0.f;
+        F32 Overdraw = 0.f;
+        F32 Overfetch = 0.f;
+        /* Meshlet 이 최대 정점/삼각형 수에 얼마나 가깝게 채워 졌는지 [0, 1]. 높을 수록 Mesh Shader Group 의 낭비가 적다. */
+        F32 MeshletVertexFill = 0.f;
+        F32 MeshletTriangleFill = 0.f;
+    };
+} // namespace ig::details
+
 namespace ig
 {
     class StaticMesh;
@@ -29,19 +49,39 @@ namespace ig
         bool bImportMaterials = false; /* Only if materials does not exist or not imported before. */
 
         bool bGenerateLODs = true;
+        /* bGenerateLODs 인 경우, 메시 전체를 단순화 하는 대신 Cluster LOD 계층(ClusterLodBuilder)을 생성 */
+        bool bBuildClusterHierarchy = true;
+
+        /* Full 이외의 형식은 정점 당 16 바이트(QuantizedVertex)로 양자화 하여 저장 */
+        EVertexFormat VertexFormat = EVertexFormat::Full;
+
+        /*
+         * 노드 계층을 따라 메시를 인스턴스로 배치한 Map 을 함께 생성 한다. (bPreTransformVertices 무시)
+         * 같은 지오메트리를 가진 메시는 하나의 에셋으로 중복 제거 된다.
+         */
+        bool bImportAsScene = false;
     };
 
     /*
-     * Static Mesh Binary Layout
+     * Static Mesh Binary Layout (bCoarsestLodFirst == true)
      * Begin->
      * CompressedVertices => [0, CompressedVerticesSize)
-     * LOD0.CompressedMeshletVertexIndices => [CompressedVerticesSize, CompressedVerticesSize + LOD0.CompressedMeshletVertexIndicesSize)
-     * LOD0.Triangles => [PrevLast, PrevLast+sizeof(U32)*LOD0.NumMeshletTriangles)
-     * LOD0.Meshlets => [PrevLast, PrevLast+sizeof(Meshlet)*LOD0.NumMeshlets)
-     * ...
+     * LOD(N-1).MeshletVertexIndices => [CompressedVerticesSize, CompressedVerticesSize + sizeof(U32)*LOD(N-1).NumMeshletVertexIndices)
+     * LOD(N-1).Triangles => [PrevLast, PrevLast+sizeof(U32)*LOD(N-1).NumMeshletTriangles)
      * LOD(N-1).Meshlets => [PrevLast, PrevLast+sizeof(Meshlet)*LOD(N-1).NumMeshlets)
+     * LOD(N-2).MeshletVertexIndices => ...
+     * ...
+     * LOD0.Meshlets => [PrevLast, PrevLast+sizeof(Meshlet)*LOD0.NumMeshlets)
      * <-End
-     * assert(N-1 == Mesh.NumLevelOfDetails)
+     * assert(N == Mesh.NumLevelOfDetails)
+     *
+     * 가장 거친 LOD 부터 기록 되어, 각 LOD를 독립적으로 읽을 수 있고 [0, GetResidentBlobSize(lod)) 구간 만으로 lod~(N-1) 를 로드 할 수 있다.
+     * bCoarsestLodFirst == false 인 경우(이전 버전), LOD0 부터 순서대로 기록 되어 있다.
+     *
+     * bCompressedLevelOfDetails == true 인 경우 각 LOD 구간은 MeshletCodec 으로 압축 되어 있으며,
+     * 구간의 크기는 Compressed*Size 를 따른다. 디코딩 결과는 압축 되지 않은 경우의 레이아웃과 같다.
+     *
+     * CompressedVertices 는 VertexFormat 에 따라 Vertex 또는 QuantizedVertex 의 배열을 압축한 것이다.
      */
     struct StaticMeshLoadDesc
     {
@@ -49,6 +89,17 @@ namespace ig
         Json& Serialize(Json& archive) const;
         const Json& Deserialize(const Json& archive);
 
+        /* Blob 에 기록 된 LOD 구간의 크기 */
+        [[nodiscard]] Size GetLevelOfDetailSize(const U8 lod) const;
+        /* 디코딩 된 LOD 의 크기(= GPU 메모리 사용량) */
+        [[nodiscard]] Size GetDecodedLevelOfDetailSize(const U8 lod) const;
+        [[nodiscard]] Size GetLevelOfDetailOffset(const U8 lod) const;
+        /* minResidentLod ~ (N-1) 의 LOD를 로드하기 위해 필요한 Blob 의 앞 부분 크기 */
+        [[nodiscard]] Size GetResidentBlobSize(const U8 minResidentLod) const;
+        [[nodiscard]] Size GetBlobSize() const { return GetResidentBlobSize(0); }
+        /* 최초 로드 시 상주 시킬 가장 세밀한 LOD. 이전 버전의 레이아웃은 모든 LOD를 상주 시킨다. */
+        [[nodiscard]] U8 GetInitialResidentLevelOfDetail() const { return bCoarsestLodFirst ? NumLevelOfDetails - 1 : 0; }
+
     public:
         U32 NumVertices{0};
         Bytes CompressedVerticesSize{0};
@@ -57,9 +108,28 @@ namespace ig
         Array<U32, Mesh::kMaxMeshLevelOfDetails> NumMeshletTriangles{0};
         Array<U32, Mesh::kMaxMeshLevelOfDetails> NumMeshlets{0};
         AABB BoundingBox;
+        bool bCoarsestLodFirst = false;
+        bool bCompressedLevelOfDetails = false;
+        /* 각 LOD가 Cluster LOD 계층의 한 단계. Meshlet 의 Lod* 오차 경계가 유효하다. */
+        bool bClusterHierarchy = false;
+        /* 양자화 된 정점의 위치는 BoundingBox, 텍스처 좌표(QuantizedUnormTexCoords)는 [TexCoordMin, TexCoordMax] 를 기준으로 복원 한다. */
+        EVertexFormat VertexFormat = EVertexFormat::Full;
+        Array<F32, 2> TexCoordMin{0.f, 0.f};
+        Array<F32, 2> TexCoordMax{1.f, 1.f};
+        Array<U32, Mesh::kMaxMeshLevelOfDetails> CompressedMeshletVertexIndicesSize{0};
+        Array<U32, Mesh::kMaxMeshLevelOfDetails> CompressedMeshletTrianglesSize{0};
+        Array<U32, Mesh::kMaxMeshLevelOfDetails> CompressedMeshletsSize{0};
+
+        /* LOD 별 메시 로컬 공간 에서의 단순화 오차. 임포트 시 LodScreenCoverageThresholds 를 유도 하는데 사용 된다. */
+        Array<F32, Mesh::kMaxMeshLevelOfDetails> LevelOfDetailErrors{0.f,};
 
         bool bOverrideLodScreenCoverageThresholds = false;
         Array<F32, Mesh::kMaxMeshLevelOfDetails> LodScreenCoverageThresholds{0.f,};
+
+        /* 임포트 시 측정 된 LOD 별 통계. 로드 시에는 사용 되지 않는다. */
+        Array<details::MeshLodStatistics, Mesh::kMaxMeshLevelOfDetails> LevelOfDetailStatistics{};
+        /* bImproveCacheLocality 로 최적화 되기 전 LOD0 의 통계. 최적화 하지 않은 경우 LevelOfDetailStatistics[0] 과 같다. */
+        details::MeshLodStatistics UnoptimizedStatistics{};
     };
 
     class GpuBuffer;
@@ -70,6 +140,8 @@ namespace ig
 
     class StaticMesh final
     {
+        friend class StaticMeshStreamer;
+
     public:
         constexpr static U8 kMaxNumLods = StaticMeshImportDesc::kMaxNumLods;
 
@@ -94,6 +166,8 @@ namespace ig
 
         [[nodiscard]] const Desc& GetSnapshot() const noexcept { return snapshot; }
         [[nodiscard]] const Mesh& GetMesh() const noexcept { return mesh; }
+        /* Unified Mesh Storage 에 상주 중인 정점과 LOD 들의 크기 */
+        [[nodiscard]] Bytes GetResidentSize() const;
 
     private:
         void Destroy();
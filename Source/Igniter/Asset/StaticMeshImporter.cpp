@@ -1,11 +1,15 @@
 #include "Igniter/Igniter.h"
 #include "Igniter/Core/Log.h"
 #include "Igniter/Core/Timer.h"
+#include "Igniter/Core/Hash.h"
 #include "Igniter/Core/Engine.h"
 #include "Igniter/Filesystem/Utils.h"
 #include "Igniter/Render/Vertex.h"
 #include "Igniter/Asset/AssetManager.h"
 #include "Igniter/Asset/StaticMeshImporter.h"
+#include "Igniter/Asset/MeshletCodec.h"
+#include "Igniter/Asset/ClusterLodBuilder.h"
+#include "Igniter/Asset/StaticMeshStreamer.h"
 
 IG_DECLARE_LOG_CATEGORY(StaticMeshImporterLog);
 
@@ -16,9 +20,21 @@ namespace ig
     constexpr inline Size NumIndicesPerFace = 3;
 
     StaticMeshImporter::StaticMeshImporter(AssetManager& assetManager)
-        : assetManager(assetManager)
+        : taskExecutor(Engine::GetTaskExecutor())
+        , materialCreateFunc(
+            [&assetManager](const std::string_view virtualPath, const MaterialAssetCreateDesc& createDesc)
+            {
+                return assetManager.Create(virtualPath, createDesc);
+            })
     {}
 
+    StaticMeshImporter::StaticMeshImporter(tf::Executor& taskExecutor, MaterialCreateFunc materialCreateFunc)
+        : taskExecutor(taskExecutor)
+        , materialCreateFunc(std::move(materialCreateFunc))
+    {
+        IG_CHECK(this->materialCreateFunc);
+    }
+
     static bool CheckAssimpSceneLoadingSucceed(const std::string_view resPathStr, const Assimp::Importer& importer, const aiScene* scene)
     {
         if (scene == nullptr || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || scene->mRootNode == nullptr)
@@ -30,7 +46,8 @@ namespace ig
         return true;
     }
 
-    Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> StaticMeshImporter::Import(const std::string_view resPathStr, const StaticMesh::ImportDesc& desc)
+    Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> StaticMeshImporter::Import(const std::string_view resPathStr, const StaticMesh::ImportDesc& desc,
+        Vector<StaticMeshSceneInstance>* sceneInstances)
     {
         Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> results;
         const Path resPath{resPathStr};
@@ -40,6 +57,16 @@ namespace ig
             return results;
         }
 
+        Json serializedImportDesc{};
+        serializedImportDesc << desc;
+        const U64 importCacheKey{ImportCache::MakeKey(resPath, serializedImportDesc, kImporterVersion)};
+        if (const std::optional<ImportCache::Entry> cacheEntry{ImportCache::Lookup(EAssetCategory::StaticMesh, importCacheKey)};
+            cacheEntry)
+        {
+            IG_LOG(StaticMeshImporterLog, Info, "Import cache hit. File: {}", resPathStr);
+            return ImportFromCache(desc, *cacheEntry, sceneInstances);
+        }
+
         const U32 importFlags = MakeAssimpImportFlagsFromDesc(desc);
 
         Assimp::Importer importer;
@@ -54,7 +81,7 @@ namespace ig
             /* Create Materials */
             if (desc.bImportMaterials)
             {
-                const Size numImportedMaterials = ImportMaterialsFromScene(assetManager, *scene);
+                const Size numImportedMaterials = ImportMaterialsFromScene(materialCreateFunc, *scene);
                 IG_LOG(StaticMeshImporterLog, Info, "{} of materials imported from static mesh asset.", numImportedMaterials);
             }
 
@@ -62,16 +89,40 @@ namespace ig
             const std::string modelName = resPath.filename().replace_extension().string();
             results.resize(scene->mNumMeshes);
             Vector<MeshData> staticMeshes{scene->mNumMeshes};
+            /* 씬 임포트 시 같은 지오메트리를 가진 메시는 가장 앞선 메시(canonicalMeshIndices[meshIdx] == meshIdx) 만 에셋으로 임포트 한다. */
+            Vector<Index> canonicalMeshIndices(scene->mNumMeshes);
+            std::iota(canonicalMeshIndices.begin(), canonicalMeshIndices.end(), Index{0});
+            Vector<U64> geometryHashes(scene->mNumMeshes, 0);
 
-            tf::Executor& taskExecutor = Engine::GetTaskExecutor();
             tf::Taskflow meshImportFlow;
-            [[maybe_unused]] tf::Task procMeshes = meshImportFlow.for_each_index(
+            tf::Task procMeshesLod0 = meshImportFlow.for_each_index(
                 0, (S32)scene->mNumMeshes, 1,
-                [scene, &results, &staticMeshes, &desc, &modelName](const Index meshIdx)
+                [scene, &staticMeshes, &geometryHashes, &desc](const Index meshIdx)
                 {
-                    const aiMesh& mesh = *scene->mMeshes[meshIdx];
-                    ProcessMeshLod0(mesh, staticMeshes[meshIdx]);
+                    ProcessMeshLod0(*scene->mMeshes[meshIdx], desc.VertexFormat, staticMeshes[meshIdx]);
+                    if (desc.bImportAsScene)
+                    {
+                        geometryHashes[meshIdx] = HashMeshGeometry(staticMeshes[meshIdx]);
+                    }
+                });
+            tf::Task deduplicateMeshes = meshImportFlow.emplace(
+                [&staticMeshes, &geometryHashes, &canonicalMeshIndices, &desc]()
+                {
+                    if (desc.bImportAsScene)
+                    {
+                        canonicalMeshIndices = DeduplicateMeshes(staticMeshes, geometryHashes);
+                    }
+                });
+            tf::Task procMeshes = meshImportFlow.for_each_index(
+                0, (S32)scene->mNumMeshes, 1,
+                [scene, &results, &staticMeshes, &canonicalMeshIndices, &desc, &modelName](const Index meshIdx)
+                {
+                    if (canonicalMeshIndices[meshIdx] != meshIdx)
+                    {
+                        return;
+                    }
 
+                    const aiMesh& mesh = *scene->mMeshes[meshIdx];
                     if (staticMeshes[meshIdx].Vertices.empty())
                     {
                         results[meshIdx] = MakeFail<StaticMesh::Desc, EStaticMeshImportStatus::EmptyVertices>();
@@ -83,25 +134,210 @@ namespace ig
                         return;
                     }
 
-                    if (desc.bGenerateLODs)
+                    const std::string meshName = std::format("{}_{}_{}", modelName, mesh.mName.C_Str(), meshIdx);
+                    if (desc.bImproveCacheLocality)
                     {
-                        GenerateLevelOfDetails(staticMeshes[meshIdx]);
+                        staticMeshes[meshIdx].UnoptimizedStatistics = AnalyzeLevelOfDetail(staticMeshes[meshIdx], 0);
+                    }
+                    /* Cluster 계층은 LOD0 의 삼각형 순서로 부터 만들어 지기 때문에, 계층 생성 전에 최적화 한다. */
+                    if (desc.bGenerateLODs && desc.bBuildClusterHierarchy)
+                    {
+                        if (desc.bImproveCacheLocality)
+                        {
+                            OptimizeLevelOfDetails(staticMeshes[meshIdx]);
+                        }
+                        BuildClusterHierarchy(staticMeshes[meshIdx]);
+                    }
+                    else
+                    {
+                        if (desc.bGenerateLODs)
+                        {
+                            GenerateLevelOfDetails(staticMeshes[meshIdx]);
+                        }
+                        if (desc.bImproveCacheLocality)
+                        {
+                            OptimizeLevelOfDetails(staticMeshes[meshIdx]);
+                        }
+                        BuildMeshlets(staticMeshes[meshIdx]);
                     }
                     IG_CHECK(staticMeshes[meshIdx].NumLevelOfDetails >= 1 && staticMeshes[meshIdx].NumLevelOfDetails <= StaticMesh::kMaxNumLods);
 
-                    BuildMeshlets(staticMeshes[meshIdx]);
-                    CompressMeshVertices(staticMeshes[meshIdx]);
+                    AnalyzeLevelOfDetails(staticMeshes[meshIdx]);
+                    if (desc.bImproveCacheLocality)
+                    {
+                        const details::MeshLodStatistics& unoptimizedStats = staticMeshes[meshIdx].UnoptimizedStatistics;
+                        const details::MeshLodStatistics& optimizedStats = staticMeshes[meshIdx].LevelOfDetailStatistics[0];
+                        IG_LOG(StaticMeshImporterLog, Info,
+                            "{}: LOD0 ACMR {:.3f} => {:.3f}, ATVR {:.3f} => {:.3f}, Overdraw {:.3f} => {:.3f}, Overfetch {:.3f} => {:.3f}",
+                            meshName,
+                            unoptimizedStats.Acmr, optimizedStats.Acmr,
+                            unoptimizedStats.Atvr, optimizedStats.Atvr,
+                            unoptimizedStats.Overdraw, optimizedStats.Overdraw,
+                            unoptimizedStats.Overfetch, optimizedStats.Overfetch);
+                    }
+                    else
+                    {
+                        staticMeshes[meshIdx].UnoptimizedStatistics = staticMeshes[meshIdx].LevelOfDetailStatistics[0];
+                    }
+                    LogMeshletStatistics(meshName, staticMeshes[meshIdx]);
+
+                    CompressMeshVertices(meshName, staticMeshes[meshIdx]);
+                    CompressMeshLevelOfDetails(staticMeshes[meshIdx]);
 
-                    const std::string meshName = std::format("{}_{}_{}", modelName, mesh.mName.C_Str(), meshIdx);
                     results[meshIdx] = ExportToFile(meshName, staticMeshes[meshIdx]);
                 });
+            procMeshesLod0.precede(deduplicateMeshes);
+            deduplicateMeshes.precede(procMeshes);
             taskExecutor.run(meshImportFlow).wait();
+
+            Vector<StaticMeshSceneInstance> collectedSceneInstances{};
+            if (desc.bImportAsScene)
+            {
+                /* 중복 된 메시의 결과를 제외 하고, 인스턴스는 남은 결과의 인덱스로 메시를 참조한다. */
+                Vector<Index> meshResultIndices(scene->mNumMeshes, InvalidIndex);
+                Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> uniqueResults;
+                for (Index meshIdx = 0; meshIdx < scene->mNumMeshes; ++meshIdx)
+                {
+                    if (canonicalMeshIndices[meshIdx] == meshIdx)
+                    {
+                        meshResultIndices[meshIdx] = uniqueResults.size();
+                        uniqueResults.emplace_back(std::move(results[meshIdx]));
+                    }
+                }
+                for (Index meshIdx = 0; meshIdx < scene->mNumMeshes; ++meshIdx)
+                {
+                    meshResultIndices[meshIdx] = meshResultIndices[canonicalMeshIndices[meshIdx]];
+                }
+                results = std::move(uniqueResults);
+
+                CollectSceneInstances(*scene, *scene->mRootNode, aiMatrix4x4{}, meshResultIndices, collectedSceneInstances);
+                IG_LOG(StaticMeshImporterLog, Info, "{}: {} meshes deduplicated to {} unique meshes, {} instances.",
+                    modelName, scene->mNumMeshes, results.size(), collectedSceneInstances.size());
+            }
+
+            StoreToCache(importCacheKey, *scene, results, collectedSceneInstances);
+            if (sceneInstances != nullptr)
+            {
+                *sceneInstances = std::move(collectedSceneInstances);
+            }
         }
         importer.FreeScene();
 
         return results;
     }
 
+    Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> StaticMeshImporter::ImportFromCache(const StaticMesh::ImportDesc& desc,
+        const ImportCache::Entry& cacheEntry, Vector<StaticMeshSceneInstance>* sceneInstances)
+    {
+        if (sceneInstances != nullptr && desc.bImportAsScene && cacheEntry.Extra.contains("SceneInstances"))
+        {
+            for (const Json& serializedInstance : cacheEntry.Extra["SceneInstances"])
+            {
+                const Json& position = serializedInstance["Position"];
+                const Json& scale = serializedInstance["Scale"];
+                const Json& rotation = serializedInstance["Rotation"];
+                sceneInstances->emplace_back(StaticMeshSceneInstance{
+                    .Name = serializedInstance["Name"].get<std::string>(),
+                    .MeshResultIdx = serializedInstance["MeshResultIdx"].get<Index>(),
+                    .MaterialVirtualPath = serializedInstance["MaterialVirtualPath"].get<std::string>(),
+                    .Position = Vector3{position[0].get<F32>(), position[1].get<F32>(), position[2].get<F32>()},
+                    .Scale = Vector3{scale[0].get<F32>(), scale[1].get<F32>(), scale[2].get<F32>()},
+                    .Rotation = Quaternion{rotation[0].get<F32>(), rotation[1].get<F32>(), rotation[2].get<F32>(), rotation[3].get<F32>()}
+                });
+            }
+        }
+
+        if (desc.bImportMaterials && cacheEntry.Extra.contains("Materials"))
+        {
+            Size numImportedMaterials = 0;
+            for (const Json& materialName : cacheEntry.Extra["Materials"])
+            {
+                const Guid importedGuid = materialCreateFunc(MakeVirtualPathPreferred(materialName.get<std::string>()),
+                    MaterialAssetCreateDesc{.DiffuseVirtualPath = Texture::EngineDefault});
+                numImportedMaterials = importedGuid.isValid() ? (numImportedMaterials + 1) : numImportedMaterials;
+            }
+            IG_LOG(StaticMeshImporterLog, Info, "{} of materials imported from static mesh asset.", numImportedMaterials);
+        }
+
+        Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> results;
+        results.reserve(cacheEntry.Outputs.size());
+        for (const ImportCache::CachedOutput& cachedOutput : cacheEntry.Outputs)
+        {
+            const AssetInfo assetInfo{cachedOutput.VirtualPath, EAssetCategory::StaticMesh};
+            StaticMeshLoadDesc loadDesc{};
+            cachedOutput.SerializedLoadDesc >> loadDesc;
+
+            Json assetMetadata{};
+            assetMetadata << assetInfo << loadDesc;
+            if (!SaveJsonToFile(MakeAssetMetadataPath(EAssetCategory::StaticMesh, assetInfo.GetGuid()), assetMetadata))
+            {
+                results.emplace_back(MakeFail<StaticMesh::Desc, EStaticMeshImportStatus::FailedSaveMetadataToFile>());
+                continue;
+            }
+
+            if (!ImportCache::Materialize(cachedOutput.BlobPath, MakeAssetPath(EAssetCategory::StaticMesh, assetInfo.GetGuid())))
+            {
+                results.emplace_back(MakeFail<StaticMesh::Desc, EStaticMeshImportStatus::FailedSaveAssetToFile>());
+                continue;
+            }
+
+            results.emplace_back(MakeSuccess<StaticMesh::Desc, EStaticMeshImportStatus>(assetInfo, loadDesc));
+        }
+
+        return results;
+    }
+
+    void StaticMeshImporter::StoreToCache(const U64 importCacheKey, const aiScene& scene,
+        const std::span<Result<StaticMesh::Desc, EStaticMeshImportStatus>> results,
+        const std::span<const StaticMeshSceneInstance> sceneInstances)
+    {
+        /* 일부 메시의 임포트가 실패한 경우, 다음 임포트에서 같은 실패를 재현 하기 위해 캐싱하지 않는다. */
+        const bool bAllSucceeded = std::all_of(results.begin(), results.end(),
+            [](const Result<StaticMesh::Desc, EStaticMeshImportStatus>& result) { return result.IsSuccess(); });
+        if (!bAllSucceeded)
+        {
+            return;
+        }
+
+        Vector<ImportCache::Record> records;
+        records.reserve(results.size());
+        for (Result<StaticMesh::Desc, EStaticMeshImportStatus>& result : results)
+        {
+            /* Result는 값을 참조로 노출하지 않기 때문에, 소유권을 가져왔다가 다시 돌려준다. */
+            const StaticMesh::Desc meshDesc{result.Take()};
+            Json serializedLoadDesc{};
+            serializedLoadDesc << meshDesc.LoadDescriptor;
+            records.emplace_back(ImportCache::Record{
+                .VirtualPath = std::string{meshDesc.Info.GetVirtualPath()},
+                .SerializedLoadDesc = serializedLoadDesc,
+                .AssetPath = MakeAssetPath(EAssetCategory::StaticMesh, meshDesc.Info.GetGuid())
+            });
+            result = MakeSuccess<StaticMesh::Desc, EStaticMeshImportStatus>(meshDesc);
+        }
+
+        Json extra{};
+        extra["Materials"] = Json::array();
+        for (U32 materialIdx = 0; materialIdx < scene.mNumMaterials; ++materialIdx)
+        {
+            extra["Materials"].push_back(scene.mMaterials[materialIdx]->GetName().C_Str());
+        }
+
+        extra["SceneInstances"] = Json::array();
+        for (const StaticMeshSceneInstance& instance : sceneInstances)
+        {
+            extra["SceneInstances"].push_back(Json{
+                {"Name", instance.Name},
+                {"MeshResultIdx", instance.MeshResultIdx},
+                {"MaterialVirtualPath", instance.MaterialVirtualPath},
+                {"Position", {instance.Position.x, instance.Position.y, instance.Position.z}},
+                {"Scale", {instance.Scale.x, instance.Scale.y, instance.Scale.z}},
+                {"Rotation", {instance.Rotation.x, instance.Rotation.y, instance.Rotation.z, instance.Rotation.w}}
+            });
+        }
+
+        ImportCache::Store(EAssetCategory::StaticMesh, importCacheKey, records, extra);
+    }
+
     U32 StaticMeshImporter::MakeAssimpImportFlagsFromDesc(const StaticMesh::ImportDesc& desc)
     {
         U32 importFlags = aiProcess_Triangulate;
@@ -109,28 +345,128 @@ namespace ig
         importFlags |= desc.bFlipUVs ? aiProcess_FlipUVs : 0;
         importFlags |= desc.bFlipWindingOrder ? aiProcess_FlipWindingOrder : 0;
         importFlags |= desc.bSplitLargeMeshes ? aiProcess_SplitLargeMeshes : 0;
-        importFlags |= desc.bPreTransformVertices ? aiProcess_PreTransformVertices : 0;
+        /* 씬 임포트는 노드 계층의 변환을 인스턴스로 보존 해야 한다. */
+        importFlags |= (desc.bPreTransformVertices && !desc.bImportAsScene) ? aiProcess_PreTransformVertices : 0;
         importFlags |= aiProcess_GenSmoothNormals;
         importFlags |= desc.bGenerateUVCoords ? aiProcess_GenUVCoords : 0;
         importFlags |= desc.bGenerateBoundingBoxes ? aiProcess_GenBoundingBoxes : 0;
         return importFlags;
     }
 
-    Size StaticMeshImporter::ImportMaterialsFromScene(AssetManager& assetManager, const aiScene& scene)
+    Size StaticMeshImporter::ImportMaterialsFromScene(const MaterialCreateFunc& materialCreateFunc, const aiScene& scene)
     {
         Size numImportedMaterials = 0;
         for (U32 materialIdx = 0; materialIdx < scene.mNumMaterials; ++materialIdx)
         {
             const aiMaterial& material = *scene.mMaterials[materialIdx];
-            const Guid importedGuid = assetManager.Create(MakeVirtualPathPreferred(material.GetName().C_Str()),
+            const Guid importedGuid = materialCreateFunc(MakeVirtualPathPreferred(material.GetName().C_Str()),
                 MaterialAssetCreateDesc{.DiffuseVirtualPath = Texture::EngineDefault});
             numImportedMaterials = importedGuid.isValid() ? (numImportedMaterials + 1) : numImportedMaterials;
         }
         return numImportedMaterials;
     }
 
-    void StaticMeshImporter::ProcessMeshLod0(const aiMesh& mesh, MeshData& meshData)
+    U64 StaticMeshImporter::HashMeshGeometry(const MeshData& meshData)
+    {
+        static_assert(sizeof(Vertex) % sizeof(U32) == 0);
+        const Vector<U32>& indices = meshData.LevelOfDetails[0].Indices;
+        const U32* verticesBegin = reinterpret_cast<const U32*>(meshData.Vertices.data());
+        const U32* verticesEnd = verticesBegin + (meshData.Vertices.size() * sizeof(Vertex) / sizeof(U32));
+        const U64 verticesHash = HashRange(verticesBegin, verticesEnd, kFnvOffsetBasis);
+        return HashRange(indices.data(), indices.data() + indices.size(), verticesHash);
+    }
+
+    Vector<Index> StaticMeshImporter::DeduplicateMeshes(const std::span<const MeshData> meshes, const std::span<const U64> geometryHashes)
+    {
+        IG_CHECK(meshes.size() == geometryHashes.size());
+        Vector<Index> canonicalMeshIndices(meshes.size());
+        /* 해시 충돌 시에도 올바르도록, 같은 해시를 가진 후보들과 실제 데이터를 비교 한다. */
+        UnorderedMap<U64, Vector<Index>> candidatesPerHash{};
+        for (Index meshIdx = 0; meshIdx < meshes.size(); ++meshIdx)
+        {
+            canonicalMeshIndices[meshIdx] = meshIdx;
+            const MeshData& meshData = meshes[meshIdx];
+            if (meshData.Vertices.empty() || meshData.LevelOfDetails[0].Indices.empty())
+            {
+                continue;
+            }
+
+            Vector<Index>& candidates = candidatesPerHash[geometryHashes[meshIdx]];
+            for (const Index candidateIdx : candidates)
+            {
+                const MeshData& candidate = meshes[candidateIdx];
+                const bool bSameVertices = candidate.Vertices.size() == meshData.Vertices.size() &&
+                    std::memcmp(candidate.Vertices.data(), meshData.Vertices.data(), meshData.Vertices.size() * sizeof(Vertex)) == 0;
+                if (bSameVertices && candidate.LevelOfDetails[0].Indices == meshData.LevelOfDetails[0].Indices)
+                {
+                    canonicalMeshIndices[meshIdx] = candidateIdx;
+                    break;
+                }
+            }
+
+            if (canonicalMeshIndices[meshIdx] == meshIdx)
+            {
+                candidates.emplace_back(meshIdx);
+            }
+        }
+
+        return canonicalMeshIndices;
+    }
+
+    void StaticMeshImporter::CollectSceneInstances(const aiScene& scene, const aiNode& node, const aiMatrix4x4& parentTransform,
+        const std::span<const Index> meshResultIndices, Vector<StaticMeshSceneInstance>& sceneInstances)
+    {
+        const aiMatrix4x4 transform = parentTransform * node.mTransformation;
+        if (node.mNumMeshes > 0)
+        {
+            aiVector3D scale{};
+            aiQuaternion rotation{};
+            aiVector3D position{};
+            transform.Decompose(scale, rotation, position);
+
+            for (U32 nodeMeshIdx = 0; nodeMeshIdx < node.mNumMeshes; ++nodeMeshIdx)
+            {
+                const U32 meshIdx = node.mMeshes[nodeMeshIdx];
+                if (meshResultIndices[meshIdx] == InvalidIndex)
+                {
+                    continue;
+                }
+
+                const aiMesh& mesh = *scene.mMeshes[meshIdx];
+                sceneInstances.emplace_back(StaticMeshSceneInstance{
+                    .Name = node.mNumMeshes > 1 ? std::format("{}_{}", node.mName.C_Str(), nodeMeshIdx) : std::string{node.mName.C_Str()},
+                    .MeshResultIdx = meshResultIndices[meshIdx],
+                    .MaterialVirtualPath = MakeVirtualPathPreferred(scene.mMaterials[mesh.mMaterialIndex]->GetName().C_Str()),
+                    .Position = Vector3{position.x, position.y, position.z},
+                    .Scale = Vector3{scale.x, scale.y, scale.z},
+                    .Rotation = Quaternion{rotation.x, rotation.y, rotation.z, rotation.w}
+                });
+            }
+        }
+
+        for (U32 childIdx = 0; childIdx < node.mNumChildren; ++childIdx)
+        {
+            CollectSceneInstances(scene, *node.mChildren[childIdx], transform, meshResultIndices, sceneInstances);
+        }
+    }
+
+    void StaticMeshImporter::ProcessMeshLod0(const aiMesh& mesh, const EVertexFormat vertexFormat, MeshData& meshData)
     {
+        meshData.VertexFormat = vertexFormat;
+        const bool bUnormTexCoords = vertexFormat == EVertexFormat::QuantizedUnormTexCoords;
+        if (bUnormTexCoords && mesh.HasTextureCoords(0) && mesh.mNumVertices > 0)
+        {
+            meshData.TexCoordMin = Vector2{FLT_MAX, FLT_MAX};
+            meshData.TexCoordMax = Vector2{-FLT_MAX, -FLT_MAX};
+            for (Size vertexIdx = 0; vertexIdx < mesh.mNumVertices; ++vertexIdx)
+            {
+                const aiVector3D uvCoords = mesh.mTextureCoords[0][vertexIdx];
+                meshData.TexCoordMin = Vector2{std::min(meshData.TexCoordMin.x, uvCoords.x), std::min(meshData.TexCoordMin.y, uvCoords.y)};
+                meshData.TexCoordMax = Vector2{std::max(meshData.TexCoordMax.x, uvCoords.x), std::max(meshData.TexCoordMax.y, uvCoords.y)};
+            }
+        }
+        const Vector2 texCoordScale = meshData.TexCoordMax - meshData.TexCoordMin;
+
         meshData.Vertices.reserve(mesh.mNumVertices);
         meshData.LevelOfDetails[0].Indices.reserve((Size)mesh.mNumFaces * Mesh::kNumVertexPerTriangle);
 
@@ -155,8 +491,16 @@ namespace ig
             newVertex.QuantizedNormal = EncodeNormalX10Y10Z10(Vector3{normal.x, normal.y, normal.z});
             newVertex.QuantizedTangent = EncodeNormalX10Y10Z10(Vector3{tangent.x, tangent.y, tangent.z});
             newVertex.QuantizedBitangent = EncodeNormalX10Y10Z10(Vector3{bitangent.x, bitangent.y, bitangent.z});
-            newVertex.QuantizedTexCoords[0] = meshopt_quantizeHalf(uvCoords.x);
-            newVertex.QuantizedTexCoords[1] = meshopt_quantizeHalf(uvCoords.y);
+            if (bUnormTexCoords)
+            {
+                newVertex.QuantizedTexCoords[0] = QuantizeUnorm16(uvCoords.x, meshData.TexCoordMin.x, texCoordScale.x);
+                newVertex.QuantizedTexCoords[1] = QuantizeUnorm16(uvCoords.y, meshData.TexCoordMin.y, texCoordScale.y);
+            }
+            else
+            {
+                newVertex.QuantizedTexCoords[0] = meshopt_quantizeHalf(uvCoords.x);
+                newVertex.QuantizedTexCoords[1] = meshopt_quantizeHalf(uvCoords.y);
+            }
             newVertex.ColorRGBA8_U32 = EncodeRGBA32F(Vector4{vertexColor.r, vertexColor.g, vertexColor.b, vertexColor.a});
             meshData.Vertices.emplace_back(newVertex);
         }
@@ -179,77 +523,105 @@ namespace ig
     {
         IG_CHECK(meshData.NumLevelOfDetails == 1);
 
+        /*
+         * #sy_note 오차 기반 LOD 생성
+         * 후보 목표 오차(메시 크기 대비 상대 오차) 마다 LOD0 를 단순화 하고, 실제 달성 된 오차를 메시 로컬 공간의 오차로 기록 한다.
+         * 이전 LOD 대비 인덱스가 충분히 줄어들지 않은 후보는 저장 할 가치가 없으므로 버린다.
+         */
+        constexpr Array<F32, 10> kCandidateTargetErrors{0.001f, 0.002f, 0.004f, 0.008f, 0.016f, 0.032f, 0.064f, 0.128f, 0.256f, 0.512f};
+
         const Vector<Vertex>& verticesLod0 = meshData.Vertices;
         const Vector<U32>& indicesLod0 = meshData.LevelOfDetails[0].Indices;
-        for (Index lod = 1; lod < Mesh::kMaxMeshLevelOfDetails; ++lod)
+        const F32 errorScale = meshopt_simplifyScale(&verticesLod0[0].Position.x, verticesLod0.size(), sizeof(Vertex));
+        meshData.LevelOfDetailErrors[0] = 0.f;
+        for (const F32 targetError : kCandidateTargetErrors)
         {
-            const Size previousLodNumIndices = meshData.LevelOfDetails[lod - 1].Indices.size();
-            const Size targetNumIndices = (Size)((F32)previousLodNumIndices * 0.7f);
-            if (targetNumIndices == 0)
+            if (meshData.NumLevelOfDetails >= Mesh::kMaxMeshLevelOfDetails)
             {
                 break;
             }
 
+            const U8 lod = meshData.NumLevelOfDetails;
+            const Size previousLodNumIndices = meshData.LevelOfDetails[lod - 1].Indices.size();
             Vector<U32>& lodIndices = meshData.LevelOfDetails[lod].Indices;
             lodIndices.resize(indicesLod0.size());
-            const F32 tLod = (F32)lod / (F32)Mesh::kMaxMeshLevelOfDetails;
-            const float targetError = (1.f - tLod) * 0.05f + tLod * 0.95f;
 
-            Size numSimplifiedIndices = meshopt_simplify(
+            F32 resultError = 0.f;
+            const Size numSimplifiedIndices = meshopt_simplify(
                 lodIndices.data(),
                 indicesLod0.data(), indicesLod0.size(),
                 &verticesLod0[0].Position.x, verticesLod0.size(), sizeof(Vertex),
-                targetNumIndices, targetError,
-                0, nullptr);
+                0, targetError,
+                0, &resultError);
 
-            bool simplifyPass = numSimplifiedIndices <= targetNumIndices;
-            if (!simplifyPass)
+            if (numSimplifiedIndices == 0)
             {
-                numSimplifiedIndices = meshopt_simplifySloppy(
-                    lodIndices.data(),
-                    indicesLod0.data(), indicesLod0.size(),
-                    &verticesLod0[0].Position.x, verticesLod0.size(), sizeof(Vertex),
-                    targetNumIndices, targetError, nullptr);
-
-                simplifyPass = numSimplifiedIndices <= targetNumIndices;
+                lodIndices.clear();
+                break;
             }
 
-            if (!simplifyPass)
+            if ((F32)numSimplifiedIndices > (F32)previousLodNumIndices * kMinLodIndexReductionRatio)
             {
-                numSimplifiedIndices = meshopt_simplify(
-                    lodIndices.data(),
-                    indicesLod0.data(), indicesLod0.size(),
-                    &verticesLod0[0].Position.x, verticesLod0.size(), sizeof(Vertex),
-                    targetNumIndices, FLT_MAX,
-                    0, nullptr);
-
-                simplifyPass = numSimplifiedIndices <= targetNumIndices;
+                lodIndices.clear();
+                continue;
             }
 
-            if (!simplifyPass)
-            {
-                numSimplifiedIndices = meshopt_simplifySloppy(
-                    lodIndices.data(),
-                    indicesLod0.data(), indicesLod0.size(),
-                    &verticesLod0[0].Position.x, verticesLod0.size(), sizeof(Vertex),
-                    targetNumIndices, FLT_MAX, nullptr);
+            lodIndices.resize(numSimplifiedIndices);
+            /* 목표 오차가 증가 하므로 달성 오차도 증가 해야 하지만, 임계값이 단조 감소 하도록 보장 한다. */
+            meshData.LevelOfDetailErrors[lod] = std::max(resultError * errorScale, meshData.LevelOfDetailErrors[lod - 1]);
+            ++meshData.NumLevelOfDetails;
+        }
+    }
 
-                simplifyPass = numSimplifiedIndices < previousLodNumIndices;
-            }
+    void StaticMeshImporter::OptimizeLevelOfDetails(MeshData& meshData)
+    {
+        IG_CHECK(meshData.NumLevelOfDetails >= 1);
+        Array<Vector<U32>, Mesh::kMaxMeshLevelOfDetails> lodIndices{};
+        for (U8 lod = 0; lod < meshData.NumLevelOfDetails; ++lod)
+        {
+            lodIndices[lod] = std::move(meshData.LevelOfDetails[lod].Indices);
+        }
 
-            if (!simplifyPass)
-            {
-                lodIndices.clear();
-                break;
-            }
-            lodIndices.resize(numSimplifiedIndices);
-            if (numSimplifiedIndices == 0)
+        details::MeshLodOptimizer::Optimize(meshData.Vertices, std::span{lodIndices.data(), meshData.NumLevelOfDetails});
+        for (U8 lod = 0; lod < meshData.NumLevelOfDetails; ++lod)
+        {
+            meshData.LevelOfDetails[lod].Indices = std::move(lodIndices[lod]);
+        }
+    }
+
+    details::MeshLodStatistics StaticMeshImporter::AnalyzeLevelOfDetail(const MeshData& meshData, const U8 lod)
+    {
+        IG_CHECK(lod < meshData.NumLevelOfDetails);
+        return details::MeshLodOptimizer::Analyze(meshData.Vertices, meshData.LevelOfDetails[lod].Indices);
+    }
+
+    void StaticMeshImporter::AnalyzeLevelOfDetails(MeshData& meshData)
+    {
+        for (U8 lod = 0; lod < meshData.NumLevelOfDetails; ++lod)
+        {
+            const MeshLod& meshLod = meshData.LevelOfDetails[lod];
+            details::MeshLodStatistics& stats = meshData.LevelOfDetailStatistics[lod];
+            stats = AnalyzeLevelOfDetail(meshData, lod);
+            if (!meshLod.Meshlets.empty())
             {
-                break;
+                const F32 numMeshlets = (F32)meshLod.Meshlets.size();
+                stats.MeshletVertexFill = (F32)meshLod.MeshletVertexIndices.size() / (numMeshlets * Meshlet::kMaxVertices);
+                stats.MeshletTriangleFill = (F32)meshLod.MeshletTriangles.size() / (numMeshlets * Meshlet::kMaxTriangles);
             }
+        }
+    }
 
-            ++meshData.NumLevelOfDetails;
+    void StaticMeshImporter::LogMeshletStatistics(const std::string_view meshName, const MeshData& meshData)
+    {
+        const MeshLod& meshLod0 = meshData.LevelOfDetails[0];
+        if (meshLod0.Meshlets.empty())
+        {
+            return;
         }
+
+        const details::MeshLodStatistics& stats = meshData.LevelOfDetailStatistics[0];
+        IG_LOG(StaticMeshImporterLog, Info, "{}: LOD0 {} meshlets, Vertex Fill {:.1f}%, Triangle Fill {:.1f}%, {} LODs",
+            meshName, meshLod0.Meshlets.size(), stats.MeshletVertexFill * 100.f, stats.MeshletTriangleFill * 100.f, (U32)meshData.NumLevelOfDetails);
     }
 
     void StaticMeshImporter::BuildMeshlets(MeshData& meshData)
@@ -329,7 +701,41 @@ namespace ig
         }
     }
 
-    void StaticMeshImporter::CompressMeshVertices(MeshData& meshData)
+    void StaticMeshImporter::BuildClusterHierarchy(MeshData& meshData)
+    {
+        IG_CHECK(meshData.NumLevelOfDetails == 1);
+        IG_CHECK(!meshData.Vertices.empty());
+
+        details::ClusterLodHierarchy hierarchy = details::ClusterLodBuilder::Build(
+            meshData.Vertices, meshData.LevelOfDetails[0].Indices, Mesh::kMaxMeshLevelOfDetails);
+        IG_CHECK(!hierarchy.Levels.empty() && hierarchy.Levels.size() <= Mesh::kMaxMeshLevelOfDetails);
+        if (!details::ClusterLodBuilder::ValidateErrorMonotonicity(hierarchy))
+        {
+            IG_LOG(StaticMeshImporterLog, Error, "Cluster LOD hierarchy violates error monotonicity.");
+            IG_CHECK_NO_ENTRY();
+        }
+
+        meshData.NumLevelOfDetails = (U8)hierarchy.Levels.size();
+        meshData.bClusterHierarchy = true;
+        for (U8 lod = 0; lod < meshData.NumLevelOfDetails; ++lod)
+        {
+            details::ClusterLodLevel& level = hierarchy.Levels[lod];
+            MeshLod& meshLod = meshData.LevelOfDetails[lod];
+            meshLod.MeshletVertexIndices = std::move(level.MeshletVertexIndices);
+            meshLod.MeshletTriangles = std::move(level.MeshletTriangles);
+            meshLod.Meshlets = std::move(level.Meshlets);
+
+            /* 단계의 오차는 해당 단계 Meshlet 들의 오차 중 최대값 */
+            F32 levelError = lod > 0 ? meshData.LevelOfDetailErrors[lod - 1] : 0.f;
+            for (const Meshlet& meshlet : meshLod.Meshlets)
+            {
+                levelError = std::max(levelError, meshlet.LodError);
+            }
+            meshData.LevelOfDetailErrors[lod] = levelError;
+        }
+    }
+
+    void StaticMeshImporter::CompressMeshVertices(const std::string_view meshName, MeshData& meshData)
     {
         IG_CHECK(meshData.NumLevelOfDetails >= 1);
         IG_CHECK(!meshData.Vertices.empty());
@@ -337,6 +743,47 @@ namespace ig
         meshopt_encodeVertexVersion(0);
         meshopt_encodeIndexVersion(1);
 
+        if (meshData.VertexFormat != EVertexFormat::Full)
+        {
+            const VertexDequantization dequantization = MakeVertexDequantization(meshData.BoundingBox, meshData.TexCoordMin, meshData.TexCoordMax);
+            Vector<QuantizedVertex> quantizedVertices(meshData.Vertices.size());
+            /* 양자화 오차: 위치는 메시 로컬 공간 거리, 노멀은 기존 Vertex 의 노멀 과의 각도(Degree) */
+            F32 maxPositionError = 0.f;
+            F32 maxNormalErrorDegrees = 0.f;
+            for (Size vertexIdx = 0; vertexIdx < meshData.Vertices.size(); ++vertexIdx)
+            {
+                const Vertex& vertex = meshData.Vertices[vertexIdx];
+                quantizedVertices[vertexIdx] = QuantizeVertex(vertex, dequantization);
+
+                maxPositionError = std::max(maxPositionError, Vector3::Distance(vertex.Position, DequantizePosition(quantizedVertices[vertexIdx], dequantization)));
+
+                Vector3 referenceNormal = DecodeNormalX10Y10Z10(vertex.QuantizedNormal);
+                if (referenceNormal.LengthSquared() > 0.5f)
+                {
+                    referenceNormal.Normalize();
+                    Vector3 decodedNormal{};
+                    Vector3 decodedTangent{};
+                    Vector3 decodedBitangent{};
+                    DecodeTangentFrame(quantizedVertices[vertexIdx].TangentFrame, decodedNormal, decodedTangent, decodedBitangent);
+                    const F32 cosTheta = std::clamp(referenceNormal.Dot(decodedNormal), -1.f, 1.f);
+                    maxNormalErrorDegrees = std::max(maxNormalErrorDegrees, std::acos(cosTheta) * (180.f / std::numbers::pi_v<F32>));
+                }
+            }
+
+            IG_LOG(StaticMeshImporterLog, Info, "{}: {} Vertices, Max Position Error {:.6f}, Max Normal Error {:.3f} deg",
+                meshName, magic_enum::enum_name(meshData.VertexFormat), maxPositionError, maxNormalErrorDegrees);
+
+            meshData.CompressedVertices.resize(
+                meshopt_encodeVertexBufferBound(quantizedVertices.size(), sizeof(QuantizedVertex)));
+            meshData.CompressedVertices.resize(
+                meshopt_encodeVertexBuffer(meshData.CompressedVertices.data(),
+                    meshData.CompressedVertices.size(),
+                    quantizedVertices.data(),
+                    quantizedVertices.size(),
+                    sizeof(QuantizedVertex)));
+            return;
+        }
+
         meshData.CompressedVertices.resize(
             meshopt_encodeVertexBufferBound(meshData.Vertices.size(), sizeof(Vertex)));
         meshData.CompressedVertices.resize(
@@ -347,6 +794,18 @@ namespace ig
                 sizeof(Vertex)));
     }
 
+    void StaticMeshImporter::CompressMeshLevelOfDetails(MeshData& meshData)
+    {
+        IG_CHECK(meshData.NumLevelOfDetails >= 1);
+        for (U8 lod = 0; lod < meshData.NumLevelOfDetails; ++lod)
+        {
+            MeshLod& meshLod = meshData.LevelOfDetails[lod];
+            meshLod.CompressedMeshletVertexIndices = details::MeshletCodec::EncodeVertexIndices(meshLod.MeshletVertexIndices);
+            meshLod.CompressedMeshletTriangles = details::MeshletCodec::EncodeTriangles(meshLod.MeshletTriangles);
+            meshLod.CompressedMeshlets = details::MeshletCodec::EncodeMeshlets(meshLod.Meshlets);
+        }
+    }
+
     Result<StaticMesh::Desc, EStaticMeshImportStatus> StaticMeshImporter::ExportToFile(const std::string_view meshName, const MeshData& meshData)
     {
         const AssetInfo assetInfo{MakeVirtualPathPreferred(meshName), EAssetCategory::StaticMesh};
@@ -363,6 +822,43 @@ namespace ig
             newLoadDesc.NumMeshlets[lod] = (U32)meshLod.Meshlets.size();
         }
         newLoadDesc.BoundingBox = meshData.BoundingBox;
+        newLoadDesc.bCoarsestLodFirst = true;
+        newLoadDesc.bCompressedLevelOfDetails = true;
+        newLoadDesc.bClusterHierarchy = meshData.bClusterHierarchy;
+        newLoadDesc.VertexFormat = meshData.VertexFormat;
+        newLoadDesc.TexCoordMin = {meshData.TexCoordMin.x, meshData.TexCoordMin.y};
+        newLoadDesc.TexCoordMax = {meshData.TexCoordMax.x, meshData.TexCoordMax.y};
+        newLoadDesc.LevelOfDetailErrors = meshData.LevelOfDetailErrors;
+        newLoadDesc.LevelOfDetailStatistics = meshData.LevelOfDetailStatistics;
+        newLoadDesc.UnoptimizedStatistics = meshData.UnoptimizedStatistics;
+        if (newLoadDesc.NumLevelOfDetails > 1)
+        {
+            /* 기본 테이블 대신 실제 오차로 부터 유도 된 임계값을 사용 한다. 에디터에서 수정 가능. */
+            newLoadDesc.bOverrideLodScreenCoverageThresholds = true;
+            newLoadDesc.LodScreenCoverageThresholds = details::MeshLodStreamingPolicy::ComputeLodScreenCoverageThresholds(
+                newLoadDesc.LevelOfDetailErrors, newLoadDesc.NumLevelOfDetails, ToBoundingSphere(newLoadDesc.BoundingBox).Radius);
+            for (U8 lod = 0; lod < newLoadDesc.NumLevelOfDetails; ++lod)
+            {
+                IG_LOG(StaticMeshImporterLog, Info, "{}: LOD{} Error {:.6f}, Screen Coverage Threshold {:.7f}",
+                    meshName, (U32)lod, newLoadDesc.LevelOfDetailErrors[lod], newLoadDesc.LodScreenCoverageThresholds[lod]);
+            }
+        }
+        Size rawLodDataSize = 0;
+        Size compressedLodDataSize = 0;
+        for (U8 lod = 0; lod < meshData.NumLevelOfDetails; ++lod)
+        {
+            const MeshLod& meshLod = meshData.LevelOfDetails[lod];
+            newLoadDesc.CompressedMeshletVertexIndicesSize[lod] = (U32)meshLod.CompressedMeshletVertexIndices.size();
+            newLoadDesc.CompressedMeshletTrianglesSize[lod] = (U32)meshLod.CompressedMeshletTriangles.size();
+            newLoadDesc.CompressedMeshletsSize[lod] = (U32)meshLod.CompressedMeshlets.size();
+            rawLodDataSize += newLoadDesc.GetDecodedLevelOfDetailSize(lod);
+            compressedLodDataSize += newLoadDesc.GetLevelOfDetailSize(lod);
+        }
+        IG_LOG(StaticMeshImporterLog, Info, "{}: Vertices {} => {} bytes, LODs {} => {} bytes ({:.1f}%)",
+            meshName,
+            newLoadDesc.NumVertices * GetVertexSize(newLoadDesc.VertexFormat), newLoadDesc.CompressedVerticesSize,
+            rawLodDataSize, compressedLodDataSize,
+            rawLodDataSize > 0 ? (compressedLodDataSize * 100.0 / rawLodDataSize) : 0.0);
 
         const Path newMetaPath = MakeAssetMetadataPath(EAssetCategory::StaticMesh, assetInfo.GetGuid());
 
@@ -379,22 +875,14 @@ namespace ig
         constexpr Size kNumBlobs = (kNumBlobPerLod * Mesh::kMaxMeshLevelOfDetails) + kNumAdditionalBlob;
         Array<std::span<const U8>, kNumBlobs> blobs{};
         blobs[0] = std::span<const U8>{meshData.CompressedVertices};
+        /* LOD 스트리밍을 위해 가장 거친 LOD 부터 기록 한다. */
         for (U8 lod = 0; lod < meshData.NumLevelOfDetails; ++lod)
         {
             const MeshLod& meshLod = meshData.LevelOfDetails[lod];
-            const Index blobOffset = kNumAdditionalBlob + (lod * kNumBlobPerLod);
-            blobs[blobOffset + 0] = std::span<const U8>{
-                reinterpret_cast<const U8*>(meshLod.MeshletVertexIndices.data()),
-                sizeof(U32) * meshLod.MeshletVertexIndices.size()
-            };
-            blobs[blobOffset + 1] = std::span<const U8>{
-                reinterpret_cast<const U8*>(meshLod.MeshletTriangles.data()),
-                sizeof(U32) * meshLod.MeshletTriangles.size()
-            };
-            blobs[blobOffset + 2] = std::span<const U8>{
-                reinterpret_cast<const U8*>(meshLod.Meshlets.data()),
-                sizeof(Meshlet) * meshLod.Meshlets.size()
-            };
+            const Index blobOffset = kNumAdditionalBlob + ((meshData.NumLevelOfDetails - 1 - lod) * kNumBlobPerLod);
+            blobs[blobOffset + 0] = std::span<const U8>{meshLod.CompressedMeshletVertexIndices};
+            blobs[blobOffset + 1] = std::span<const U8>{meshLod.CompressedMeshletTriangles};
+            blobs[blobOffset + 2] = std::span<const U8>{meshLod.CompressedMeshlets};
         }
         if (!SaveBlobsToFile(assetPath, blobs))
         {
@@ -405,3 +893,53 @@ namespace ig
         return MakeSuccess<StaticMesh::Desc, EStaticMeshImportStatus>(assetInfo, newLoadDesc);
     }
 } // namespace ig
+
+namespace ig::details
+{
+    void MeshLodOptimizer::Optimize(Vector<Vertex>& vertices, const std::span<Vector<U32>> lodIndices)
+    {
+        IG_CHECK(!vertices.empty());
+
+        /* https://github.com/zeux/meshoptimizer#pipeline */
+        constexpr F32 kOverdrawThreshold = 1.05f;
+        Vector<U32> fetchOrderIndices{};
+        for (Vector<U32>& indices : lodIndices)
+        {
+            meshopt_optimizeVertexCache(indices.data(), indices.data(), indices.size(), vertices.size());
+            meshopt_optimizeOverdraw(indices.data(), indices.data(), indices.size(),
+                &vertices[0].Position.x, vertices.size(), sizeof(Vertex),
+                kOverdrawThreshold);
+            fetchOrderIndices.insert(fetchOrderIndices.end(), indices.begin(), indices.end());
+        }
+
+        /* 가장 세밀한 LOD 부터 처음 참조 되는 순서대로 정점을 배치 한다. 참조 되지 않는 정점은 제거 된다. */
+        Vector<U32> remap(vertices.size());
+        const Size numUniqueVertices = meshopt_optimizeVertexFetchRemap(remap.data(), fetchOrderIndices.data(), fetchOrderIndices.size(), vertices.size());
+        meshopt_remapVertexBuffer(vertices.data(), vertices.data(), vertices.size(), sizeof(Vertex), remap.data());
+        vertices.resize(numUniqueVertices);
+        for (Vector<U32>& indices : lodIndices)
+        {
+            meshopt_remapIndexBuffer(indices.data(), indices.data(), indices.size(), remap.data());
+        }
+    }
+
+    MeshLodStatistics MeshLodOptimizer::Analyze(const std::span<const Vertex> vertices, const std::span<const U32> indices)
+    {
+        if (indices.empty() || vertices.empty())
+        {
+            return {};
+        }
+
+        constexpr U32 kCacheSize = 16;
+        const meshopt_VertexCacheStatistics cacheStats = meshopt_analyzeVertexCache(indices.data(), indices.size(), vertices.size(), kCacheSize, 0, 0);
+        const meshopt_OverdrawStatistics overdrawStats = meshopt_analyzeOverdraw(indices.data(), indices.size(),
+            &vertices[0].Position.x, vertices.size(), sizeof(Vertex));
+        const meshopt_VertexFetchStatistics fetchStats = meshopt_analyzeVertexFetch(indices.data(), indices.size(), vertices.size(), sizeof(Vertex));
+        return MeshLodStatistics{
+            .Acmr = cacheStats.acmr,
+            .Atvr = cacheStats.atvr,
+            .Overdraw = overdrawStats.overdraw,
+            .Overfetch = fetchStats.overfetch
+        };
+    }
+} // namespace ig::details
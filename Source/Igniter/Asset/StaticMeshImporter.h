@@ -1,5 +1,18 @@
 #pragma once
 #include "Igniter/Asset/StaticMesh.h"
+#include "Igniter/Asset/Material.h"
+#include "Igniter/Asset/ImportCache.h"
+
+namespace ig::details
+{
+    class MeshLodOptimizer final
+    {
+    public:
+        /* 각 LOD의 인덱스를 Vertex Cache => Overdraw 순으로 최적화 한 뒤, 모든 LOD의 인덱스 순서에 맞춰 정점을 재배치(Vertex Fetch) */
+        static void Optimize(Vector<Vertex>& vertices, const std::span<Vector<U32>> lodIndices);
+        [[nodiscard]] static MeshLodStatistics Analyze(const std::span<const Vertex> vertices, const std::span<const U32> indices);
+    };
+} // namespace ig::details
 
 namespace ig
 {
@@ -15,10 +28,25 @@ namespace ig
     };
 
     class AssetManager;
+    class AssetCooker;
+
+    /* 씬 임포트(StaticMeshImportDesc::bImportAsScene) 시 노드 계층을 평탄화 한 메시 인스턴스 */
+    struct StaticMeshSceneInstance
+    {
+    public:
+        std::string Name;
+        /* StaticMeshImporter::Import 결과 내 인덱스. 같은 지오메트리를 가진 인스턴스는 같은 결과를 공유 한다. */
+        Index MeshResultIdx = 0;
+        std::string MaterialVirtualPath;
+        Vector3 Position{};
+        Vector3 Scale{1.f, 1.f, 1.f};
+        Quaternion Rotation{};
+    };
 
     class StaticMeshImporter final
     {
         friend class AssetManager;
+        friend class AssetCooker;
 
         struct MeshLod
         {
@@ -26,6 +54,10 @@ namespace ig
             Vector<U32> MeshletVertexIndices;
             Vector<U32> MeshletTriangles;
             Vector<Meshlet> Meshlets;
+
+            Vector<U8> CompressedMeshletVertexIndices;
+            Vector<U8> CompressedMeshletTriangles;
+            Vector<U8> CompressedMeshlets;
         };
 
         struct MeshData
@@ -34,11 +66,25 @@ namespace ig
             Vector<U8> CompressedVertices;
             Array<MeshLod, Mesh::kMaxMeshLevelOfDetails> LevelOfDetails;
             U8 NumLevelOfDetails = 1; // assert (>=1); LOD 생성을 concurrent 하게 한다 치면 atomic으로?
+            /* LOD 별 메시 로컬 공간 에서의 단순화 오차 (LOD0 = 0) */
+            Array<F32, Mesh::kMaxMeshLevelOfDetails> LevelOfDetailErrors{0.f,};
+            Array<details::MeshLodStatistics, Mesh::kMaxMeshLevelOfDetails> LevelOfDetailStatistics{};
+            details::MeshLodStatistics UnoptimizedStatistics{};
             AABB BoundingBox;
+            bool bClusterHierarchy = false;
+            /* QuantizedUnormTexCoords 인 경우 Vertices 의 텍스처 좌표는 [TexCoordMin, TexCoordMax] 에 대한 Unorm16 */
+            EVertexFormat VertexFormat = EVertexFormat::Full;
+            Vector2 TexCoordMin{0.f, 0.f};
+            Vector2 TexCoordMax{1.f, 1.f};
         };
 
+    public:
+        using MaterialCreateFunc = std::function<Guid(const std::string_view virtualPath, const MaterialAssetCreateDesc& createDesc)>;
+
     public:
         explicit StaticMeshImporter(AssetManager& assetManager);
+        /* Engine 인스턴스 없이(Headless) 임포트 하는 경우 */
+        StaticMeshImporter(tf::Executor& taskExecutor, MaterialCreateFunc materialCreateFunc);
         StaticMeshImporter(const StaticMeshImporter&) = delete;
         StaticMeshImporter(StaticMeshImporter&&) noexcept = delete;
         ~StaticMeshImporter() = default;
@@ -46,24 +92,55 @@ namespace ig
         StaticMeshImporter& operator=(const StaticMeshImporter&) = delete;
         StaticMeshImporter& operator=(StaticMeshImporter&&) noexcept = delete;
 
+    public:
+        /* 임포트 결과물에 영향을 주는 변경이 있을 경우 반드시 증가 시켜야 함 (Import Cache 무효화) */
+        constexpr static U32 kImporterVersion = 9;
+        /* 이전 LOD 대비 인덱스 수가 이 비율 이하로 줄어들지 않는 LOD는 생성 하지 않는다. */
+        constexpr static F32 kMinLodIndexReductionRatio = 0.75f;
+
     private:
-        Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> Import(const std::string_view resPathStr, const StaticMesh::ImportDesc& desc);
+        /* sceneInstances: bImportAsScene 인 경우 씬의 메시 인스턴스 목록을 기록 (nullptr 인 경우 무시) */
+        Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> Import(const std::string_view resPathStr, const StaticMesh::ImportDesc& desc,
+            Vector<StaticMeshSceneInstance>* sceneInstances = nullptr);
+        Vector<Result<StaticMesh::Desc, EStaticMeshImportStatus>> ImportFromCache(const StaticMesh::ImportDesc& desc, const ImportCache::Entry& cacheEntry,
+            Vector<StaticMeshSceneInstance>* sceneInstances);
+        static void StoreToCache(const U64 importCacheKey, const aiScene& scene, const std::span<Result<StaticMesh::Desc, EStaticMeshImportStatus>> results,
+            const std::span<const StaticMeshSceneInstance> sceneInstances);
 
         static U32 MakeAssimpImportFlagsFromDesc(const StaticMesh::ImportDesc& desc);
-        static Size ImportMaterialsFromScene(AssetManager& assetManager, const aiScene& scene);
+        static Size ImportMaterialsFromScene(const MaterialCreateFunc& materialCreateFunc, const aiScene& scene);
 
         /* Load LOD0 (+ Remap Vertices & Indices) */
-        static void ProcessMeshLod0(const aiMesh& mesh, MeshData& meshData);
-        /* Generate LOD 1~LOD (MaxLOD-1): 최대한 많은 LOD 생성 */
+        static void ProcessMeshLod0(const aiMesh& mesh, const EVertexFormat vertexFormat, MeshData& meshData);
+        /* Vertices 와 LOD0 인덱스의 해시 */
+        [[nodiscard]] static U64 HashMeshGeometry(const MeshData& meshData);
+        /* 같은 지오메트리를 가진 메시 중 가장 앞선 메시의 인덱스. 반환 값[meshIdx] == meshIdx 인 메시만 에셋으로 임포트 된다. */
+        [[nodiscard]] static Vector<Index> DeduplicateMeshes(const std::span<const MeshData> meshes, const std::span<const U64> geometryHashes);
+        /* meshResultIndices[aiMesh Index] 가 유효한 메시를 참조하는 모든 노드를 월드 변환과 함께 수집 */
+        static void CollectSceneInstances(const aiScene& scene, const aiNode& node, const aiMatrix4x4& parentTransform,
+            const std::span<const Index> meshResultIndices, Vector<StaticMeshSceneInstance>& sceneInstances);
+        /* Generate LOD 1~LOD (MaxLOD-1): 목표 오차를 증가 시키며 의미 있는 LOD만 생성, 달성 오차를 LevelOfDetailErrors 에 기록 */
         static void GenerateLevelOfDetails(MeshData& meshData);
+        /* details::MeshLodOptimizer 참고 */
+        static void OptimizeLevelOfDetails(MeshData& meshData);
+        [[nodiscard]] static details::MeshLodStatistics AnalyzeLevelOfDetail(const MeshData& meshData, const U8 lod);
+        /* 각 LOD의 정점 캐시/Overdraw/Vertex Fetch 효율 및 Meshlet 의 채움 비율을 LevelOfDetailStatistics 에 기록 (BuildMeshlets 이후) */
+        static void AnalyzeLevelOfDetails(MeshData& meshData);
         /* 각 LOD별로 Meshlet 데이터(Meshlet, Triangles, MeshletVertexIndices) 생성 */
         static void BuildMeshlets(MeshData& meshData);
-        /* Mesh의 Vertices 압축 */
-        static void CompressMeshVertices(MeshData& meshData);
+        /* LOD0 로 부터 Cluster LOD 계층을 생성하여, 각 단계를 LOD로 사용 (GenerateLevelOfDetails + BuildMeshlets 대체) */
+        static void BuildClusterHierarchy(MeshData& meshData);
+        /* Mesh의 Vertices 압축. 양자화 형식인 경우 QuantizedVertex 로 변환 후 압축 한다. */
+        static void CompressMeshVertices(const std::string_view meshName, MeshData& meshData);
+        /* 각 LOD별 Meshlet 데이터(MeshletVertexIndices, MeshletTriangles, Meshlets) 압축 */
+        static void CompressMeshLevelOfDetails(MeshData& meshData);
+
+        static void LogMeshletStatistics(const std::string_view meshName, const MeshData& meshData);
 
         static Result<StaticMesh::Desc, EStaticMeshImportStatus> ExportToFile(const std::string_view meshName, const MeshData& meshData);
 
     private:
-        AssetManager& assetManager;
+        tf::Executor& taskExecutor;
+        MaterialCreateFunc materialCreateFunc;
     };
 } // namespace ig
@@ -11,13 +11,173 @@
 #include "Igniter/Render/UnifiedMeshStorage.h"
 #include "Igniter/Asset/AssetManager.h"
 #include "Igniter/Asset/StaticMeshLoader.h"
+#include "Igniter/Asset/MeshletCodec.h"
 
 IG_DECLARE_LOG_CATEGORY(StaticMeshLoaderLog);
 
 IG_DEFINE_LOG_CATEGORY(StaticMeshLoaderLog);
 
+namespace ig::details
+{
+    bool StaticMeshLoadStages::ReadChunked(const Path& path, const std::span<U8> dst, const Size firstRegionSize, const std::function<void()>& onFirstRegionRead)
+    {
+        IG_CHECK(firstRegionSize <= dst.size());
+        std::ifstream fileStream{path.c_str(), std::ios::binary};
+        if (!fileStream)
+        {
+            return false;
+        }
+
+        bool bFirstRegionNotified = false;
+        Size offset = 0;
+        while (offset < dst.size())
+        {
+            /* 첫 구간의 경계에서 Chunk를 끊어, 첫 구간 직후 바로 콜백을 호출 할 수 있도록 한다. */
+            const Size boundary = offset < firstRegionSize ? firstRegionSize : dst.size();
+            const Size chunkSize = std::min(kReadChunkSize, boundary - offset);
+            fileStream.read(reinterpret_cast<char*>(dst.data() + offset), static_cast<std::streamsize>(chunkSize));
+            if (static_cast<Size>(fileStream.gcount()) != chunkSize)
+            {
+                return false;
+            }
+            offset += chunkSize;
+
+            if (!bFirstRegionNotified && offset >= firstRegionSize)
+            {
+                bFirstRegionNotified = true;
+                if (onFirstRegionRead)
+                {
+                    onFirstRegionRead();
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool StaticMeshLoadStages::DecodeVertices(const std::span<const U8> compressedVertices, const U32 numVertices, const Size vertexSize, const std::span<U8> dst)
+    {
+        if (dst.size() != numVertices * vertexSize)
+        {
+            return false;
+        }
+
+        return meshopt_decodeVertexBuffer(dst.data(), numVertices, vertexSize, compressedVertices.data(), compressedVertices.size()) == 0;
+    }
+
+    bool StaticMeshLoadStages::DecodeLevelOfDetail(const StaticMeshLoadDesc& loadDesc, const U8 lod, const std::span<const U8> encodedLod, const std::span<U8> dst)
+    {
+        if (encodedLod.size() != loadDesc.GetLevelOfDetailSize(lod) || dst.size() != loadDesc.GetDecodedLevelOfDetailSize(lod))
+        {
+            return false;
+        }
+
+        if (!loadDesc.bCompressedLevelOfDetails)
+        {
+            std::memcpy(dst.data(), encodedLod.data(), encodedLod.size());
+            return true;
+        }
+
+        const Size numIndices = loadDesc.NumMeshletVertexIndices[lod];
+        const Size numTriangles = loadDesc.NumMeshletTriangles[lod];
+        const Size numMeshlets = loadDesc.NumMeshlets[lod];
+        const std::span<U32> indices{reinterpret_cast<U32*>(dst.data()), numIndices};
+        const std::span<U32> triangles{reinterpret_cast<U32*>(dst.data() + sizeof(U32) * numIndices), numTriangles};
+        const std::span<Meshlet> meshlets{reinterpret_cast<Meshlet*>(dst.data() + sizeof(U32) * (numIndices + numTriangles)), numMeshlets};
+
+        Size encodedOffset = 0;
+        const std::span<const U8> encodedIndices{encodedLod.subspan(encodedOffset, loadDesc.CompressedMeshletVertexIndicesSize[lod])};
+        encodedOffset += encodedIndices.size();
+        const std::span<const U8> encodedTriangles{encodedLod.subspan(encodedOffset, loadDesc.CompressedMeshletTrianglesSize[lod])};
+        encodedOffset += encodedTriangles.size();
+        const std::span<const U8> encodedMeshlets{encodedLod.subspan(encodedOffset, loadDesc.CompressedMeshletsSize[lod])};
+
+        return MeshletCodec::DecodeVertexIndices(encodedIndices, indices) &&
+            MeshletCodec::DecodeTriangles(encodedTriangles, triangles) &&
+            MeshletCodec::DecodeMeshlets(encodedMeshlets, meshlets);
+    }
+
+    Size StaticMeshLoadStages::AppendLevelOfDetailCopies(const StaticMeshLoadDesc& loadDesc, const U8 lod, const Size payloadOffset,
+        const Size indexStorageOffset, const Size triangleStorageOffset, const Size meshletStorageOffset, Vector<MeshUploadCopy>& copies)
+    {
+        IG_CHECK(lod < loadDesc.NumLevelOfDetails);
+        Size offset = payloadOffset;
+        const Size indicesSize = sizeof(U32) * loadDesc.NumMeshletVertexIndices[lod];
+        copies.emplace_back(MeshUploadCopy{.Storage = EMeshStorage::Index, .PayloadOffset = offset, .NumBytes = indicesSize, .StorageOffset = indexStorageOffset});
+        offset += indicesSize;
+
+        const Size trianglesSize = sizeof(U32) * loadDesc.NumMeshletTriangles[lod];
+        copies.emplace_back(MeshUploadCopy{.Storage = EMeshStorage::Triangle, .PayloadOffset = offset, .NumBytes = trianglesSize, .StorageOffset = triangleStorageOffset});
+        offset += trianglesSize;
+
+        const Size meshletsSize = sizeof(Meshlet) * loadDesc.NumMeshlets[lod];
+        copies.emplace_back(MeshUploadCopy{.Storage = EMeshStorage::Meshlet, .PayloadOffset = offset, .NumBytes = meshletsSize, .StorageOffset = meshletStorageOffset});
+        offset += meshletsSize;
+
+        IG_CHECK((offset - payloadOffset) == loadDesc.GetDecodedLevelOfDetailSize(lod));
+        return offset;
+    }
+
+    GpuSyncPoint MemoryMeshUploader::Upload(const std::span<const U8> payload, const std::span<const MeshUploadCopy> copies)
+    {
+        for (const MeshUploadCopy& copy : copies)
+        {
+            IG_CHECK(copy.PayloadOffset + copy.NumBytes <= payload.size());
+            Vector<U8>& storage{storages[static_cast<Size>(copy.Storage)]};
+            if (storage.size() < copy.StorageOffset + copy.NumBytes)
+            {
+                storage.resize(copy.StorageOffset + copy.NumBytes);
+            }
+
+            std::memcpy(storage.data() + copy.StorageOffset, payload.data() + copy.PayloadOffset, copy.NumBytes);
+        }
+
+        ++numUploads;
+        /* 복사가 즉시 끝나므로 기다릴 동기화 지점이 없다. */
+        return GpuSyncPoint::Invalid();
+    }
+} // namespace ig::details
+
 namespace ig
 {
+    namespace
+    {
+        /* UnifiedMeshStorage 의 각 저장소 버퍼로 업로드 한다. */
+        class GpuMeshUploader final : public details::MeshUploader
+        {
+        public:
+            GpuMeshUploader(RenderContext& renderContext, GpuUploader& gpuUploader)
+                : renderContext(renderContext)
+                , gpuUploader(gpuUploader)
+            {}
+
+            GpuSyncPoint Upload(const std::span<const U8> payload, const std::span<const details::MeshUploadCopy> copies) override
+            {
+                const UnifiedMeshStorage& unifiedMeshStorage = renderContext.GetUnifiedMeshStorage();
+                const Array<GpuBuffer*, magic_enum::enum_count<details::EMeshStorage>()> storageBuffers{
+                    renderContext.Lookup(unifiedMeshStorage.GetVertexStorageBuffer()),
+                    renderContext.Lookup(unifiedMeshStorage.GetIndexStorageBuffer()),
+                    renderContext.Lookup(unifiedMeshStorage.GetTriangleStorageBuffer()),
+                    renderContext.Lookup(unifiedMeshStorage.GetMeshletStorageBuffer())};
+
+                UploadContext uploadCtx = gpuUploader.Reserve(payload.size());
+                std::memcpy(uploadCtx.GetOffsettedCpuAddress(), payload.data(), payload.size());
+                for (const details::MeshUploadCopy& copy : copies)
+                {
+                    GpuBuffer* storageBufferPtr = storageBuffers[static_cast<Size>(copy.Storage)];
+                    IG_CHECK(storageBufferPtr != nullptr);
+                    uploadCtx.CopyBuffer(copy.PayloadOffset, copy.NumBytes, *storageBufferPtr, copy.StorageOffset);
+                }
+
+                return gpuUploader.Submit(uploadCtx);
+            }
+
+        private:
+            RenderContext& renderContext;
+            GpuUploader& gpuUploader;
+        };
+    } // namespace
+
     StaticMeshLoader::StaticMeshLoader(RenderContext& renderContext, AssetManager& assetManager)
         : renderContext(renderContext)
         , assetManager(assetManager)
@@ -58,9 +218,6 @@ namespace ig
             return MakeFail<StaticMesh, EStaticMeshLoadStatus::ExceededNumLevelOfDetails>();
         }
 
-        Size expectedNumIndices = 0;
-        Size expectedNumTriangles = 0;
-        Size expectedNumMeshlets = 0;
         for (U8 lod = 0; lod < loadDesc.NumLevelOfDetails; ++lod)
         {
             if (loadDesc.NumMeshletVertexIndices[lod] == 0)
@@ -75,35 +232,135 @@ namespace ig
             {
                 return MakeFail<StaticMesh, EStaticMeshLoadStatus::ZeroNumMeshlets>();
             }
-            expectedNumIndices += loadDesc.NumMeshletVertexIndices[lod];
-            expectedNumTriangles += loadDesc.NumMeshletTriangles[lod];
-            expectedNumMeshlets += loadDesc.NumMeshlets[lod];
         }
 
-        const Path assetPath = MakeAssetPath(EAssetCategory::StaticMesh, assetInfo.GetGuid());
-        if (!fs::exists(assetPath))
+        const Size expectedBlobSize = loadDesc.GetBlobSize();
+
+        /* 최초 로드 시 필요한 LOD 만 상주 시키며, 나머지 LOD는 StaticMeshStreamer 에 의해 필요 시 스트리밍 된다. */
+        const U8 minResidentLod = loadDesc.GetInitialResidentLevelOfDetail();
+        const Size residentBlobSize = loadDesc.GetResidentBlobSize(minResidentLod);
+
+        /*
+         * 패키지가 마운트 되어 있다면 매핑된 메모리를 직접 사용하고, 그렇지 않다면 Loose 파일로 부터 Chunk 단위로 읽어온다.
+         * Loose 파일의 경우 정점 구간을 읽는 즉시 압축 해제를 시작하여 나머지 구간(LOD 데이터)의 I/O 및 디코딩과 겹치게 한다.
+         * 정점과 LOD 들은 Upload Payload 의 각자 구간에 직접 디코딩 된다.
+         */
+        const Size vertexSize = GetVertexSize(loadDesc.VertexFormat);
+        const Size decodedVerticesSize = loadDesc.NumVertices * vertexSize;
+        Size uploadPayloadSize = decodedVerticesSize;
+        for (U8 lod = minResidentLod; lod < loadDesc.NumLevelOfDetails; ++lod)
         {
-            return MakeFail<StaticMesh, EStaticMeshLoadStatus::FileDoesNotExists>();
+            uploadPayloadSize += loadDesc.GetDecodedLevelOfDetailSize(lod);
         }
+        Vector<U8> uploadPayload(uploadPayloadSize);
+        const std::span<U8> decodedVertices{uploadPayload.data(), decodedVerticesSize};
 
-        Vector<uint8_t> blob = LoadBlobFromFile(assetPath);
-        if (blob.empty())
+        bool bLevelOfDetailsDecodeSucceed = true;
+        const auto decodeLevelOfDetails = [&](const std::span<const U8> residentBlob)
         {
-            return MakeFail<StaticMesh, EStaticMeshLoadStatus::EmptyBlob>();
+            Size payloadOffset = decodedVerticesSize;
+            for (U8 lod = minResidentLod; lod < loadDesc.NumLevelOfDetails && bLevelOfDetailsDecodeSucceed; ++lod)
+            {
+                const Size decodedLodSize = loadDesc.GetDecodedLevelOfDetailSize(lod);
+                bLevelOfDetailsDecodeSucceed = details::StaticMeshLoadStages::DecodeLevelOfDetail(loadDesc, lod,
+                    residentBlob.subspan(loadDesc.GetLevelOfDetailOffset(lod), loadDesc.GetLevelOfDetailSize(lod)),
+                    std::span<U8>{uploadPayload.data() + payloadOffset, decodedLodSize});
+                payloadOffset += decodedLodSize;
+            }
+        };
+
+        bool bVerticesDecodeSucceed = false;
+        Vector<U8> looseBlob{};
+        std::span<const U8> blob{assetManager.FindPackedAsset(assetInfo.GetGuid())};
+        if (!blob.empty())
+        {
+            if (blob.size() != expectedBlobSize)
+            {
+                return MakeFail<StaticMesh, EStaticMeshLoadStatus::BlobSizeMismatch>();
+            }
+
+            blob = blob.subspan(0, residentBlobSize);
+            bVerticesDecodeSucceed = details::StaticMeshLoadStages::DecodeVertices(
+                blob.subspan(0, loadDesc.CompressedVerticesSize), loadDesc.NumVertices, vertexSize, decodedVertices);
+            decodeLevelOfDetails(blob);
         }
+        else
+        {
+            const Path assetPath = MakeAssetPath(EAssetCategory::StaticMesh, assetInfo.GetGuid());
+            if (!fs::exists(assetPath))
+            {
+                return MakeFail<StaticMesh, EStaticMeshLoadStatus::FileDoesNotExists>();
+            }
 
-        const Size expectedBlobSize = loadDesc.CompressedVerticesSize +
-            sizeof(U32) * expectedNumIndices +
-            sizeof(U32) * expectedNumTriangles +
-            sizeof(Meshlet) * expectedNumMeshlets;
-        if (blob.size() != expectedBlobSize)
+            std::error_code errorCode{};
+            const Size fileSize = fs::file_size(assetPath, errorCode);
+            if (errorCode || fileSize == 0)
+            {
+                return MakeFail<StaticMesh, EStaticMeshLoadStatus::EmptyBlob>();
+            }
+
+            if (fileSize != expectedBlobSize)
+            {
+                return MakeFail<StaticMesh, EStaticMeshLoadStatus::BlobSizeMismatch>();
+            }
+
+            looseBlob.resize(residentBlobSize);
+            blob = std::span<const U8>{looseBlob.data(), looseBlob.size()};
+
+            /* 워커 스레드에서 호출 된 경우 같은 Executor의 작업을 기다리면 교착 될 수 있으므로, 해당 스레드에서 직접 압축 해제 한다. */
+            tf::Executor& taskExecutor = Engine::GetTaskExecutor();
+            const bool bCanOverlapDecode = taskExecutor.this_worker_id() < 0;
+            std::promise<bool> decodePromise{};
+            std::future<bool> decodeFuture{decodePromise.get_future()};
+            bool bDecodeLaunched = false;
+            const auto onVerticesRead = [&]()
+            {
+                const std::span<const U8> compressedVertices{blob.subspan(0, loadDesc.CompressedVerticesSize)};
+                if (!bCanOverlapDecode)
+                {
+                    decodePromise.set_value(details::StaticMeshLoadStages::DecodeVertices(compressedVertices, loadDesc.NumVertices, vertexSize, decodedVertices));
+                    bDecodeLaunched = true;
+                    return;
+                }
+
+                taskExecutor.silent_async(
+                    [compressedVertices, numVertices = loadDesc.NumVertices, vertexSize, decodedVertices, &decodePromise]()
+                    {
+                        decodePromise.set_value(details::StaticMeshLoadStages::DecodeVertices(compressedVertices, numVertices, vertexSize, decodedVertices));
+                    });
+                bDecodeLaunched = true;
+            };
+
+            const bool bReadSucceed = details::StaticMeshLoadStages::ReadChunked(assetPath, looseBlob, loadDesc.CompressedVerticesSize, onVerticesRead);
+            if (bReadSucceed)
+            {
+                decodeLevelOfDetails(blob);
+            }
+
+            /* 압축 해제 작업이 참조하는 버퍼들이 유효한 동안 반드시 완료를 기다려야 한다. */
+            if (bDecodeLaunched)
+            {
+                bVerticesDecodeSucceed = decodeFuture.get();
+            }
+
+            if (!bReadSucceed)
+            {
+                IG_LOG(StaticMeshLoaderLog, Error, "Failed to read static mesh asset file {}.", assetPath.string());
+                return MakeFail<StaticMesh, EStaticMeshLoadStatus::FailedReadFile>();
+            }
+        }
+
+        if (!bVerticesDecodeSucceed)
         {
-            return MakeFail<StaticMesh, EStaticMeshLoadStatus::BlobSizeMismatch>();
+            return MakeFail<StaticMesh, EStaticMeshLoadStatus::FailedDecodeVertexBuffer>();
         }
 
-        meshopt_encodeVertexVersion(0);
+        if (!bLevelOfDetailsDecodeSucceed)
+        {
+            IG_LOG(StaticMeshLoaderLog, Error, "Failed to decode level of details of static mesh {}.", assetInfo.GetVirtualPath());
+            return MakeFail<StaticMesh, EStaticMeshLoadStatus::FailedDecodeLevelOfDetail>();
+        }
 
-        GpuUploader& gpuUploader{renderContext.GetNonFrameCriticalGpuUploader()};
         UnifiedMeshStorage& unifiedMeshStorage = renderContext.GetUnifiedMeshStorage();
 
         const auto kDeleter = [&unifiedMeshStorage](Mesh* mesh)
@@ -122,14 +379,22 @@ namespace ig
         Ptr<Mesh, decltype(kDeleter)> meshGuard{&newMesh, kDeleter};
 
         newMesh.NumLevelOfDetails = loadDesc.NumLevelOfDetails;
+        newMesh.MinResidentLevelOfDetail = minResidentLod;
         newMesh.BoundingBox = loadDesc.BoundingBox;
-        newMesh.VertexStorageAlloc = unifiedMeshStorage.AllocateVertices<Vertex>(loadDesc.NumVertices);
+        newMesh.bClusterHierarchy = loadDesc.bClusterHierarchy;
+        newMesh.VertexFormat = loadDesc.VertexFormat;
+        newMesh.Dequantization = MakeVertexDequantization(loadDesc.BoundingBox,
+            Vector2{loadDesc.TexCoordMin[0], loadDesc.TexCoordMin[1]},
+            Vector2{loadDesc.TexCoordMax[0], loadDesc.TexCoordMax[1]});
+        newMesh.VertexStorageAlloc = loadDesc.VertexFormat == EVertexFormat::Full ?
+            unifiedMeshStorage.AllocateVertices<Vertex>(loadDesc.NumVertices) :
+            unifiedMeshStorage.AllocateVertices<QuantizedVertex>(loadDesc.NumVertices);
         if (!newMesh.VertexStorageAlloc)
         {
             return MakeFail<StaticMesh, EStaticMeshLoadStatus::FailedAllocateVertexSpace>();
         }
 
-        for (U8 lod = 0; lod < newMesh.NumLevelOfDetails; ++lod)
+        for (U8 lod = minResidentLod; lod < newMesh.NumLevelOfDetails; ++lod)
         {
             MeshLod& meshLod = newMesh.LevelOfDetails[lod];
             meshLod.IndexStorageAlloc = unifiedMeshStorage.AllocateIndices(loadDesc.NumMeshletVertexIndices[lod]);
@@ -147,107 +412,160 @@ namespace ig
             meshLod.MeshletStorageAlloc = unifiedMeshStorage.AllocateMeshlets(loadDesc.NumMeshlets[lod]);
             if (!meshLod.MeshletStorageAlloc)
             {
-                return MakeFail<StaticMesh, EStaticMeshLoadStatus::FailedAllocateTriangleSpace>();
+                return MakeFail<StaticMesh, EStaticMeshLoadStatus::FailedAllocateMeshletSpace>();
             }
         }
         const MeshVertexAllocation* meshVertexAllocPtr = unifiedMeshStorage.Lookup(newMesh.VertexStorageAlloc);
         IG_CHECK(meshVertexAllocPtr != nullptr);
         IG_CHECK(meshVertexAllocPtr->NumVertices == loadDesc.NumVertices);
-        IG_CHECK(meshVertexAllocPtr->SizeOfVertex == sizeof(Vertex));
-        bool bVerticesDecodeSucceed = false;
-        UploadContext verticesUploadCtx = gpuUploader.Reserve(meshVertexAllocPtr->Alloc.AllocSize);
+        IG_CHECK(meshVertexAllocPtr->SizeOfVertex == vertexSize);
+        IG_CHECK(meshVertexAllocPtr->Alloc.AllocSize == decodedVertices.size());
+
+        /* 정점과 상주 시킬 모든 LOD 데이터를 하나의 업로드로 기록하여 메시 당 한 번만 제출 한다. */
+        Vector<details::MeshUploadCopy> uploadCopies{};
+        uploadCopies.emplace_back(details::MeshUploadCopy{
+            .Storage = details::EMeshStorage::Vertex,
+            .PayloadOffset = 0,
+            .NumBytes = meshVertexAllocPtr->Alloc.AllocSize,
+            .StorageOffset = meshVertexAllocPtr->Alloc.Offset});
+
+        Size payloadOffset = decodedVerticesSize;
+        for (U8 lod = minResidentLod; lod < newMesh.NumLevelOfDetails; ++lod)
+        {
+            IG_CHECK(payloadOffset + loadDesc.GetDecodedLevelOfDetailSize(lod) <= uploadPayloadSize);
+            AppendLevelOfDetailCopies(loadDesc, lod, payloadOffset, newMesh.LevelOfDetails[lod], uploadCopies);
+            payloadOffset += loadDesc.GetDecodedLevelOfDetailSize(lod);
+        }
+
+        GpuMeshUploader meshUploader{renderContext, renderContext.GetNonFrameCriticalGpuUploader()};
+        newMesh.UploadSync = meshUploader.Upload(uploadPayload, uploadCopies);
+
+        meshGuard.release();
+        return MakeSuccess<StaticMesh, EStaticMeshLoadStatus>(renderContext, assetManager, desc, newMesh);
+    }
+
+    Result<StaticMeshLevelOfDetail, EStaticMeshLoadStatus> StaticMeshLoader::LoadLevelOfDetail(const StaticMesh::Desc& desc, const U8 lod) const
+    {
+        const AssetInfo& assetInfo{desc.Info};
+        const StaticMeshLoadDesc& loadDesc{desc.LoadDescriptor};
+        if (!assetInfo.IsValid())
+        {
+            return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::InvalidAssetInfo>();
+        }
+
+        if (assetInfo.GetCategory() != EAssetCategory::StaticMesh)
+        {
+            return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::AssetTypeMismatch>();
+        }
+
+        if (lod >= loadDesc.NumLevelOfDetails || loadDesc.NumLevelOfDetails > Mesh::kMaxMeshLevelOfDetails)
+        {
+            return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::ExceededNumLevelOfDetails>();
+        }
+
+        const Size lodOffset = loadDesc.GetLevelOfDetailOffset(lod);
+        const Size lodSize = loadDesc.GetLevelOfDetailSize(lod);
+        if (lodSize == 0)
+        {
+            return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::EmptyBlob>();
+        }
+
+        Vector<U8> looseLodData{};
+        std::span<const U8> lodData{assetManager.FindPackedAsset(assetInfo.GetGuid())};
+        if (!lodData.empty())
         {
-            const int decodeResult = meshopt_decodeVertexBuffer(verticesUploadCtx.GetOffsettedCpuAddress(),
-                loadDesc.NumVertices,
-                sizeof(Vertex),
-                blob.data(),
-                loadDesc.CompressedVerticesSize);
-            if (decodeResult == 0)
+            if (lodData.size() != loadDesc.GetBlobSize())
             {
-                GpuBuffer* vertexStorageBufferPtr = renderContext.Lookup(unifiedMeshStorage.GetVertexStorageBuffer());
-                IG_CHECK(vertexStorageBufferPtr != nullptr);
-                verticesUploadCtx.CopyBuffer(0, meshVertexAllocPtr->Alloc.AllocSize,
-                    *vertexStorageBufferPtr, meshVertexAllocPtr->Alloc.Offset);
-                bVerticesDecodeSucceed = true;
+                return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::BlobSizeMismatch>();
             }
+
+            lodData = lodData.subspan(lodOffset, lodSize);
         }
-        GpuSyncPoint verticesUploadSync = gpuUploader.Submit(verticesUploadCtx);
+        else
+        {
+            const Path assetPath = MakeAssetPath(EAssetCategory::StaticMesh, assetInfo.GetGuid());
+            std::ifstream fileStream{assetPath.c_str(), std::ios::binary};
+            if (!fileStream)
+            {
+                return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::FileDoesNotExists>();
+            }
 
-        GpuBuffer* indexStorageBufferPtr = renderContext.Lookup(unifiedMeshStorage.GetIndexStorageBuffer());
-        IG_CHECK(indexStorageBufferPtr != nullptr);
-        GpuBuffer* triangleStorageBufferPtr = renderContext.Lookup(unifiedMeshStorage.GetTriangleStorageBuffer());
-        IG_CHECK(triangleStorageBufferPtr != nullptr);
-        GpuBuffer* meshletStorageBufferPtr = renderContext.Lookup(unifiedMeshStorage.GetMeshletStorageBuffer());
-        IG_CHECK(meshletStorageBufferPtr != nullptr);
+            looseLodData.resize(lodSize);
+            fileStream.seekg(static_cast<std::streamoff>(lodOffset));
+            fileStream.read(reinterpret_cast<char*>(looseLodData.data()), static_cast<std::streamsize>(lodSize));
+            if (static_cast<Size>(fileStream.gcount()) != lodSize)
+            {
+                return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::FailedReadFile>();
+            }
 
-        Vector<GpuSyncPoint> lodUploadSyncPoints{newMesh.NumLevelOfDetails};
-        Size blobOffset = loadDesc.CompressedVerticesSize;
-        for (U8 lod = 0; lod < newMesh.NumLevelOfDetails; ++lod)
+            lodData = std::span<const U8>{looseLodData.data(), looseLodData.size()};
+        }
+
+        const Size decodedLodSize = loadDesc.GetDecodedLevelOfDetailSize(lod);
+        Vector<U8> decodedLodData(decodedLodSize);
+        if (!details::StaticMeshLoadStages::DecodeLevelOfDetail(loadDesc, lod, lodData, decodedLodData))
         {
-            MeshLod& meshLod = newMesh.LevelOfDetails[lod];
+            return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::FailedDecodeLevelOfDetail>();
+        }
 
-            const GpuStorage::Allocation* indexStorageAllocPtr = unifiedMeshStorage.Lookup(meshLod.IndexStorageAlloc);
-            IG_CHECK(indexStorageAllocPtr != nullptr);
-            IG_CHECK(indexStorageAllocPtr->NumElements == loadDesc.NumMeshletVertexIndices[lod]);
-            IG_CHECK(indexStorageAllocPtr->AllocSize == (loadDesc.NumMeshletVertexIndices[lod] * sizeof(U32)));
-
-            const GpuStorage::Allocation* triangleStorageAllocPtr = unifiedMeshStorage.Lookup(meshLod.TriangleStorageAlloc);
-            IG_CHECK(triangleStorageAllocPtr != nullptr);
-            IG_CHECK(triangleStorageAllocPtr->NumElements == loadDesc.NumMeshletTriangles[lod]);
-            IG_CHECK(triangleStorageAllocPtr->AllocSize == (loadDesc.NumMeshletTriangles[lod] * sizeof(U32)));
-
-            const GpuStorage::Allocation* meshletStorageAllocPtr = unifiedMeshStorage.Lookup(meshLod.MeshletStorageAlloc);
-            IG_CHECK(meshletStorageAllocPtr != nullptr);
-            IG_CHECK(meshletStorageAllocPtr->NumElements == loadDesc.NumMeshlets[lod]);
-            IG_CHECK(meshletStorageAllocPtr->AllocSize == loadDesc.NumMeshlets[lod] * sizeof(Meshlet));
-
-            const Size requiredUploadCtxSize = indexStorageAllocPtr->AllocSize + triangleStorageAllocPtr->AllocSize + meshletStorageAllocPtr->AllocSize;
-            Size uploadCtxOffset = 0;
-            UploadContext lodUploadCtx = gpuUploader.Reserve(requiredUploadCtxSize);
-
-            std::memcpy(lodUploadCtx.GetOffsettedCpuAddress() + uploadCtxOffset,
-                blob.data() + blobOffset,
-                indexStorageAllocPtr->AllocSize);
-            lodUploadCtx.CopyBuffer(
-                uploadCtxOffset,
-                indexStorageAllocPtr->AllocSize, *indexStorageBufferPtr, indexStorageAllocPtr->Offset);
-            uploadCtxOffset += indexStorageAllocPtr->AllocSize;
-            blobOffset += indexStorageAllocPtr->AllocSize;
-
-            std::memcpy(lodUploadCtx.GetOffsettedCpuAddress() + uploadCtxOffset,
-                blob.data() + blobOffset,
-                triangleStorageAllocPtr->AllocSize);
-            lodUploadCtx.CopyBuffer(
-                uploadCtxOffset,
-                triangleStorageAllocPtr->AllocSize, *triangleStorageBufferPtr, triangleStorageAllocPtr->Offset);
-            uploadCtxOffset += triangleStorageAllocPtr->AllocSize;
-            blobOffset += triangleStorageAllocPtr->AllocSize;
-
-            std::memcpy(lodUploadCtx.GetOffsettedCpuAddress() + uploadCtxOffset,
-                blob.data() + blobOffset,
-                meshletStorageAllocPtr->AllocSize);
-            lodUploadCtx.CopyBuffer(
-                uploadCtxOffset,
-                meshletStorageAllocPtr->AllocSize, *meshletStorageBufferPtr, meshletStorageAllocPtr->Offset);
-            uploadCtxOffset += meshletStorageAllocPtr->AllocSize;
-            blobOffset += meshletStorageAllocPtr->AllocSize;
-
-            IG_CHECK(uploadCtxOffset == requiredUploadCtxSize);
-            lodUploadSyncPoints[lod] = gpuUploader.Submit(lodUploadCtx);
-        }
-
-        verticesUploadSync.WaitOnCpu();
-        for (U8 lod = 0; lod < newMesh.NumLevelOfDetails; ++lod)
-        {
-            lodUploadSyncPoints[lod].WaitOnCpu();
+        UnifiedMeshStorage& unifiedMeshStorage = renderContext.GetUnifiedMeshStorage();
+        const auto kDeleter = [&unifiedMeshStorage](MeshLod* meshLod)
+        {
+            IG_CHECK(meshLod != nullptr);
+            unifiedMeshStorage.Deallocate(meshLod->IndexStorageAlloc);
+            unifiedMeshStorage.Deallocate(meshLod->TriangleStorageAlloc);
+            unifiedMeshStorage.Deallocate(meshLod->MeshletStorageAlloc);
+        };
+        MeshLod newMeshLod{};
+        Ptr<MeshLod, decltype(kDeleter)> meshLodGuard{&newMeshLod, kDeleter};
+
+        newMeshLod.IndexStorageAlloc = unifiedMeshStorage.AllocateIndices(loadDesc.NumMeshletVertexIndices[lod]);
+        if (!newMeshLod.IndexStorageAlloc)
+        {
+            return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::FailedAllocateIndexSpace>();
         }
 
-        if (!bVerticesDecodeSucceed)
+        newMeshLod.TriangleStorageAlloc = unifiedMeshStorage.AllocateTriangles(loadDesc.NumMeshletTriangles[lod]);
+        if (!newMeshLod.TriangleStorageAlloc)
         {
-            return MakeFail<StaticMesh, EStaticMeshLoadStatus::FailedDecodeVertexBuffer>();
+            return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::FailedAllocateTriangleSpace>();
         }
 
-        meshGuard.release();
-        return MakeSuccess<StaticMesh, EStaticMeshLoadStatus>(renderContext, assetManager, desc, newMesh);
+        newMeshLod.MeshletStorageAlloc = unifiedMeshStorage.AllocateMeshlets(loadDesc.NumMeshlets[lod]);
+        if (!newMeshLod.MeshletStorageAlloc)
+        {
+            return MakeFail<StaticMeshLevelOfDetail, EStaticMeshLoadStatus::FailedAllocateMeshletSpace>();
+        }
+
+        Vector<details::MeshUploadCopy> uploadCopies{};
+        AppendLevelOfDetailCopies(loadDesc, lod, 0, newMeshLod, uploadCopies);
+        GpuMeshUploader meshUploader{renderContext, renderContext.GetNonFrameCriticalGpuUploader()};
+        const GpuSyncPoint uploadSync = meshUploader.Upload(decodedLodData, uploadCopies);
+
+        meshLodGuard.release();
+        return MakeSuccess<StaticMeshLevelOfDetail, EStaticMeshLoadStatus>(StaticMeshLevelOfDetail{.Lod = newMeshLod, .UploadSync = uploadSync});
+    }
+
+    void StaticMeshLoader::AppendLevelOfDetailCopies(const StaticMeshLoadDesc& loadDesc, const U8 lod, const Size payloadOffset, const MeshLod& meshLod, Vector<details::MeshUploadCopy>& copies) const
+    {
+        const UnifiedMeshStorage& unifiedMeshStorage = renderContext.GetUnifiedMeshStorage();
+
+        const GpuStorage::Allocation* indexStorageAllocPtr = unifiedMeshStorage.Lookup(meshLod.IndexStorageAlloc);
+        IG_CHECK(indexStorageAllocPtr != nullptr);
+        IG_CHECK(indexStorageAllocPtr->NumElements == loadDesc.NumMeshletVertexIndices[lod]);
+        IG_CHECK(indexStorageAllocPtr->AllocSize == (loadDesc.NumMeshletVertexIndices[lod] * sizeof(U32)));
+
+        const GpuStorage::Allocation* triangleStorageAllocPtr = unifiedMeshStorage.Lookup(meshLod.TriangleStorageAlloc);
+        IG_CHECK(triangleStorageAllocPtr != nullptr);
+        IG_CHECK(triangleStorageAllocPtr->NumElements == loadDesc.NumMeshletTriangles[lod]);
+        IG_CHECK(triangleStorageAllocPtr->AllocSize == (loadDesc.NumMeshletTriangles[lod] * sizeof(U32)));
+
+        const GpuStorage::Allocation* meshletStorageAllocPtr = unifiedMeshStorage.Lookup(meshLod.MeshletStorageAlloc);
+        IG_CHECK(meshletStorageAllocPtr != nullptr);
+        IG_CHECK(meshletStorageAllocPtr->NumElements == loadDesc.NumMeshlets[lod]);
+        IG_CHECK(meshletStorageAllocPtr->AllocSize == loadDesc.NumMeshlets[lod] * sizeof(Meshlet));
+
+        details::StaticMeshLoadStages::AppendLevelOfDetailCopies(loadDesc, lod, payloadOffset,
+            indexStorageAllocPtr->Offset, triangleStorageAllocPtr->Offset, meshletStorageAllocPtr->Offset, copies);
     }
 } // namespace ig
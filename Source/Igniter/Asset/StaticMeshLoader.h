@@ -26,15 +26,100 @@ namespace ig
         FailedAllocateTriangleSpace,
         FailedAllocateMeshletSpace,
         FailedDecodeVertexBuffer,
+        FailedDecodeLevelOfDetail,
+        FailedReadFile,
     };
 
     class AssetManager;
     class RenderContext;
     class UnifiedMeshStorage;
 
+    namespace details
+    {
+        enum class EMeshStorage : U8
+        {
+            Vertex,
+            Index,
+            Triangle,
+            Meshlet
+        };
+
+        /* Upload Payload 의 [PayloadOffset, PayloadOffset + NumBytes) 구간을 메시 저장소의 StorageOffset 으로 복사 */
+        struct MeshUploadCopy
+        {
+        public:
+            EMeshStorage Storage = EMeshStorage::Vertex;
+            Size PayloadOffset = 0;
+            Size NumBytes = 0;
+            Size StorageOffset = 0;
+        };
+
+        /* 업로드 단계의 대상. 로더는 GPU 업로더를 통해 UnifiedMeshStorage 로 업로드 한다. */
+        class MeshUploader
+        {
+        public:
+            virtual ~MeshUploader() = default;
+            /* Payload 와 복사 명령 들을 한 번에 제출 한다. 반환 된 동기화 지점 이전에 대상 공간을 해제 해서는 안된다. */
+            virtual GpuSyncPoint Upload(const std::span<const U8> payload, const std::span<const MeshUploadCopy> copies) = 0;
+        };
+
+        /* 저장소 별 메모리 버퍼로 복사 하는 업로더. GPU 없이 로드 단계를 실행 하기 위해 사용 한다. */
+        class MemoryMeshUploader final : public MeshUploader
+        {
+        public:
+            GpuSyncPoint Upload(const std::span<const U8> payload, const std::span<const MeshUploadCopy> copies) override;
+
+            [[nodiscard]] std::span<const U8> GetStorage(const EMeshStorage storage) const noexcept { return storages[static_cast<Size>(storage)]; }
+            [[nodiscard]] Size GetNumUploads() const noexcept { return numUploads; }
+
+        private:
+            Array<Vector<U8>, magic_enum::enum_count<EMeshStorage>()> storages{};
+            Size numUploads = 0;
+        };
+
+        /*
+         * #sy_note 스태틱 메시 로드 단계
+         * Read(Chunk 단위 읽기) => Decode(정점 및 LOD 압축 해제) => Upload(메시 당 단일 제출) 로 구성 된다.
+         * 정점 구간을 모두 읽는 즉시 Decode를 시작하여 나머지 구간의 I/O와 겹치게 하고, 업로더 예약은 복사에 필요한 시간 동안만 유지한다.
+         * 각 단계는 GPU 자원에 의존하지 않기 때문에, 메모리 버퍼 만으로 독립적으로 실행 할 수 있다.
+         *
+         * Upload Payload Layout
+         * [Decoded Vertices][Decoded LOD(Min)]...[Decoded LOD(N-1)]
+         * Decoded LOD => [MeshletVertexIndices][MeshletTriangles][Meshlets]
+         */
+        struct StaticMeshLoadStages
+        {
+        public:
+            constexpr static Size kReadChunkSize = 1024 * 1024;
+
+        public:
+            /* dst의 크기 만큼 읽으며, 처음 firstRegionSize 바이트를 읽은 직후 onFirstRegionRead 를 호출 한다. */
+            static bool ReadChunked(const Path& path, const std::span<U8> dst, const Size firstRegionSize, const std::function<void()>& onFirstRegionRead);
+            /* vertexSize: GetVertexSize(StaticMeshLoadDesc::VertexFormat) */
+            static bool DecodeVertices(const std::span<const U8> compressedVertices, const U32 numVertices, const Size vertexSize, const std::span<U8> dst);
+            /* dst 의 크기는 StaticMeshLoadDesc::GetDecodedLevelOfDetailSize(lod) 와 같아야 한다. */
+            static bool DecodeLevelOfDetail(const StaticMeshLoadDesc& loadDesc, const U8 lod, const std::span<const U8> encodedLod, const std::span<U8> dst);
+            /*
+             * payloadOffset 에 위치한 디코딩 된 LOD 를 각 저장소로 복사 하는 명령 들을 추가 하고, LOD 다음의 Payload 오프셋을 반환 한다.
+             * 저장소 오프셋은 바이트 단위 이다.
+             */
+            static Size AppendLevelOfDetailCopies(const StaticMeshLoadDesc& loadDesc, const U8 lod, const Size payloadOffset,
+                const Size indexStorageOffset, const Size triangleStorageOffset, const Size meshletStorageOffset, Vector<MeshUploadCopy>& copies);
+        };
+    } // namespace details
+
+    /* 스트리밍 된 단일 LOD. UploadSync 이전에 해제 해서는 안된다. */
+    struct StaticMeshLevelOfDetail
+    {
+    public:
+        MeshLod Lod{};
+        GpuSyncPoint UploadSync{};
+    };
+
     class StaticMeshLoader final
     {
         friend class AssetManager;
+        friend class StaticMeshStreamer;
 
     public:
         StaticMeshLoader(RenderContext& renderContext, AssetManager& assetManager);
@@ -48,6 +133,10 @@ namespace ig
 
     private:
         [[nodiscard]] Result<StaticMesh, EStaticMeshLoadStatus> Load(const StaticMesh::Desc& desc) const;
+        /* 이미 로드 된 메시의 단일 LOD 구간 만을 읽어 업로드 한다. 정점 데이터는 포함하지 않는다. */
+        [[nodiscard]] Result<StaticMeshLevelOfDetail, EStaticMeshLoadStatus> LoadLevelOfDetail(const StaticMesh::Desc& desc, const U8 lod) const;
+
+        void AppendLevelOfDetailCopies(const StaticMeshLoadDesc& loadDesc, const U8 lod, const Size payloadOffset, const MeshLod& meshLod, Vector<details::MeshUploadCopy>& copies) const;
 
     private:
         RenderContext& renderContext;
@@ -0,0 +1,463 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Component/TransformComponent.h"
+#include "Igniter/Component/CameraComponent.h"
+#include "Igniter/Component/StaticMeshComponent.h"
+#include "Igniter/Render/RenderContext.h"
+#include "Igniter/Render/UnifiedMeshStorage.h"
+#include "Igniter/Asset/AssetManager.h"
+#include "Igniter/Asset/StaticMeshStreamer.h"
+
+IG_DECLARE_LOG_CATEGORY(StaticMeshStreamerLog);
+
+IG_DEFINE_LOG_CATEGORY(StaticMeshStreamerLog);
+
+namespace ig::details
+{
+    F32 MeshLodStreamingPolicy::ComputeScreenCoverage(const Vector3& viewSpaceCenter, const F32 radius, const F32 projScaleX, const F32 projScaleY, const F32 nearZ)
+    {
+        const F32 conservativeRadius = radius * kConservativeBoundingSphereRadiusFactor;
+        /* 카메라가 Bounding Sphere 내부에 있거나 Near Plane과 교차하는 경우, 화면 전체를 차지한다고 가정 */
+        if ((viewSpaceCenter.z - conservativeRadius) <= nearZ)
+        {
+            return 1.f;
+        }
+
+        const F32 screenWidth = (conservativeRadius * projScaleX) / viewSpaceCenter.z;
+        const F32 screenHeight = (conservativeRadius * projScaleY) / viewSpaceCenter.z;
+        return std::clamp(screenWidth * screenHeight, 0.f, 1.f);
+    }
+
+    U8 MeshLodStreamingPolicy::MapScreenCoverageToLod(const F32 screenCoverage, const U8 numLevelOfDetails,
+        const bool bOverrideThresholds, const std::span<const F32> thresholds)
+    {
+        IG_CHECK(numLevelOfDetails > 0 && numLevelOfDetails <= Mesh::kMaxMeshLevelOfDetails);
+        /* Assets/Shaders/Utils.hlsli 의 MapScreenCoverageToLodAuto 와 반드시 동일 해야 한다. */
+        constexpr Array<F32, Mesh::kMaxMeshLevelOfDetails> kAutoThresholds{
+            0.0008f, 0.0005f, 0.00035f, 0.0003f, 0.00028f, 0.00025f, 0.0002f, 0.00015f
+        };
+
+        const std::span<const F32> targetThresholds = bOverrideThresholds ? thresholds : std::span<const F32>{kAutoThresholds};
+        IG_CHECK(targetThresholds.size() >= numLevelOfDetails);
+        for (U8 lod = 0; lod < numLevelOfDetails; ++lod)
+        {
+            if (screenCoverage >= targetThresholds[lod])
+            {
+                return lod;
+            }
+        }
+
+        return numLevelOfDetails - 1;
+    }
+
+    F32 MeshLodStreamingPolicy::ComputeLodErrorScreenCoverage(const F32 lodError, const F32 radius)
+    {
+        /* 오차가 없다면 화면 전체를 덮는 경우에도 허용 된다. */
+        if (lodError <= 0.f)
+        {
+            return 1.f;
+        }
+
+        /*
+         * ProjectedError = lodError * projScaleY * (H * 0.5) / z
+         * ScreenCoverage = (r * projScaleX / z) * (r * projScaleY / z), projScaleX / projScaleY = H / W
+         * => ProjectedError == Threshold 일 때, ScreenCoverage = (2 * r * Threshold / lodError)^2 / (W * H)
+         */
+        const F32 conservativeRadius = radius * kConservativeBoundingSphereRadiusFactor;
+        const F32 ratio = (2.f * conservativeRadius * kLodErrorThresholdPixels) / lodError;
+        return std::clamp((ratio * ratio) / (kReferenceViewportWidth * kReferenceViewportHeight), 0.f, 1.f);
+    }
+
+    Array<F32, Mesh::kMaxMeshLevelOfDetails> MeshLodStreamingPolicy::ComputeLodScreenCoverageThresholds(
+        const std::span<const F32> lodErrors, const U8 numLevelOfDetails, const F32 radius)
+    {
+        IG_CHECK(numLevelOfDetails > 0 && numLevelOfDetails <= Mesh::kMaxMeshLevelOfDetails);
+        IG_CHECK(lodErrors.size() >= numLevelOfDetails);
+        Array<F32, Mesh::kMaxMeshLevelOfDetails> thresholds{0.f,};
+        for (U8 lod = 0; lod + 1 < numLevelOfDetails; ++lod)
+        {
+            thresholds[lod] = ComputeLodErrorScreenCoverage(lodErrors[lod + 1], radius);
+        }
+
+        return thresholds;
+    }
+
+    Size MeshLodStreamingPolicy::ComputeStreamedSize(const MeshLodResidency& residency)
+    {
+        IG_CHECK(residency.NumLevelOfDetails > 0);
+        Size streamedSize = 0;
+        for (U8 lod = residency.MinResidentLevelOfDetail; lod < residency.NumLevelOfDetails - 1; ++lod)
+        {
+            streamedSize += residency.LevelOfDetailSizes[lod];
+        }
+
+        if (residency.bLoadPending && residency.MinResidentLevelOfDetail > 0)
+        {
+            streamedSize += residency.LevelOfDetailSizes[residency.MinResidentLevelOfDetail - 1];
+        }
+
+        return streamedSize;
+    }
+
+    MeshLodStreamingDecision MeshLodStreamingPolicy::Decide(const std::span<const MeshLodResidency> residencies, const Size budgetInBytes, const Size maxNumLoads)
+    {
+        struct EvictionCandidate
+        {
+            Index ResidencyIdx;
+            U8 LevelOfDetail;
+            U64 LastRequiredUpdate;
+        };
+
+        Size streamedSize = 0;
+        Vector<EvictionCandidate> evictionCandidates{};
+        Vector<MeshLodStreamingRequest> loadCandidates{};
+        for (Index residencyIdx = 0; residencyIdx < residencies.size(); ++residencyIdx)
+        {
+            const MeshLodResidency& residency = residencies[residencyIdx];
+            IG_CHECK(residency.NumLevelOfDetails > 0);
+            IG_CHECK(residency.MinResidentLevelOfDetail < residency.NumLevelOfDetails);
+            streamedSize += ComputeStreamedSize(residency);
+            if (residency.bLoadPending)
+            {
+                continue;
+            }
+
+            if (residency.RequiredLevelOfDetail < residency.MinResidentLevelOfDetail)
+            {
+                loadCandidates.emplace_back(MeshLodStreamingRequest{
+                    .ResidencyIdx = residencyIdx,
+                    .LevelOfDetail = (U8)(residency.MinResidentLevelOfDetail - 1)
+                });
+            }
+            else if (!residency.bUploadPending)
+            {
+                /* 요구 된 LOD 보다 세밀한 LOD 만 해제 대상. 가장 거친 LOD는 항상 상주 한다. */
+                const U8 evictableEnd = std::min<U8>(residency.RequiredLevelOfDetail, residency.NumLevelOfDetails - 1);
+                for (U8 lod = residency.MinResidentLevelOfDetail; lod < evictableEnd; ++lod)
+                {
+                    evictionCandidates.emplace_back(EvictionCandidate{
+                        .ResidencyIdx = residencyIdx,
+                        .LevelOfDetail = lod,
+                        .LastRequiredUpdate = residency.LastRequiredUpdates[lod]
+                    });
+                }
+            }
+        }
+
+        /*
+         * 더 세밀한 LOD가 요구 되었다면 더 거친 LOD 역시 요구 된 것 이므로, 같은 메시 내 에서는 세밀한 LOD의 갱신 번호가 항상 작거나 같다.
+         * 따라서 (갱신 번호, LOD) 순으로 정렬하면 같은 메시 내 에서 세밀한 LOD 부터 해제 되어 상주 구간의 연속성이 유지 된다.
+         */
+        std::sort(evictionCandidates.begin(), evictionCandidates.end(),
+            [](const EvictionCandidate& lhs, const EvictionCandidate& rhs)
+            {
+                return lhs.LastRequiredUpdate != rhs.LastRequiredUpdate ?
+                    lhs.LastRequiredUpdate < rhs.LastRequiredUpdate :
+                    lhs.LevelOfDetail < rhs.LevelOfDetail;
+            });
+
+        /* 요구 된 LOD 와의 차이가 클 수록 우선 로드 */
+        std::stable_sort(loadCandidates.begin(), loadCandidates.end(),
+            [residencies](const MeshLodStreamingRequest& lhs, const MeshLodStreamingRequest& rhs)
+            {
+                const MeshLodResidency& lhsResidency = residencies[lhs.ResidencyIdx];
+                const MeshLodResidency& rhsResidency = residencies[rhs.ResidencyIdx];
+                return (lhsResidency.MinResidentLevelOfDetail - lhsResidency.RequiredLevelOfDetail) >
+                    (rhsResidency.MinResidentLevelOfDetail - rhsResidency.RequiredLevelOfDetail);
+            });
+
+        MeshLodStreamingDecision decision{};
+        Index evictionCursor = 0;
+        const auto EvictNext = [&]()
+        {
+            const EvictionCandidate& candidate = evictionCandidates[evictionCursor++];
+            streamedSize -= residencies[candidate.ResidencyIdx].LevelOfDetailSizes[candidate.LevelOfDetail];
+            decision.Evictions.emplace_back(MeshLodStreamingRequest{.ResidencyIdx = candidate.ResidencyIdx, .LevelOfDetail = candidate.LevelOfDetail});
+        };
+
+        for (const MeshLodStreamingRequest& loadCandidate : loadCandidates)
+        {
+            if (decision.Loads.size() >= maxNumLoads)
+            {
+                break;
+            }
+
+            const Size lodSize = residencies[loadCandidate.ResidencyIdx].LevelOfDetailSizes[loadCandidate.LevelOfDetail];
+            while ((streamedSize + lodSize) > budgetInBytes && evictionCursor < evictionCandidates.size())
+            {
+                EvictNext();
+            }
+
+            /* 예산 내에 들어오지 않는다면 더 작은 LOD 들이 들어갈 여지가 있으므로 계속 진행 */
+            if ((streamedSize + lodSize) > budgetInBytes)
+            {
+                continue;
+            }
+
+            streamedSize += lodSize;
+            decision.Loads.emplace_back(loadCandidate);
+        }
+
+        /* 예산이 줄어든 경우에도 예산 내로 유지 */
+        while (streamedSize > budgetInBytes && evictionCursor < evictionCandidates.size())
+        {
+            EvictNext();
+        }
+
+        return decision;
+    }
+} // namespace ig::details
+
+namespace ig
+{
+    StaticMeshStreamer::StaticMeshStreamer(tf::Executor& taskExecutor, RenderContext& renderContext, AssetManager& assetManager)
+        : taskExecutor(taskExecutor)
+        , renderContext(renderContext)
+        , assetManager(assetManager)
+        , staticMeshLoader(renderContext, assetManager)
+    {}
+
+    StaticMeshStreamer::~StaticMeshStreamer()
+    {
+        CommitCompletedLoads(true);
+    }
+
+    void StaticMeshStreamer::Update(const Registry& registry)
+    {
+        ZoneScoped;
+        ++numUpdates;
+        CommitCompletedLoads(false);
+
+        /* 현재 캐시 된 메시 들의 상주 상태 갱신 */
+        UnorderedMap<Handle<StaticMesh>, StaticMeshLoadDesc> latestLoadDescs{};
+        for (const AssetManager::Snapshot& snapshot : assetManager.TakeSnapshots(EAssetCategory::StaticMesh))
+        {
+            if (!snapshot.IsCached() && !snapshot.bIsKeptAlive)
+            {
+                continue;
+            }
+
+            const Handle<StaticMesh> staticMeshHandle{snapshot.HandleHash};
+            StaticMesh* staticMeshPtr = assetManager.Lookup(staticMeshHandle);
+            if (staticMeshPtr == nullptr)
+            {
+                continue;
+            }
+
+            /*
+             * Keep-Alive 상태의 메시는 캐시에 로드 시점의 상주 크기로 청구 되므로, 스트리밍 된 LOD 를 모두 해제 하고 상주 집합에서 제외 한다.
+             * 다시 참조 되면 다음 갱신 부터 상주 집합에 포함 된다.
+             */
+            if (!snapshot.IsCached())
+            {
+                TrimToCoarsestLevelOfDetail(staticMeshPtr->mesh);
+                continue;
+            }
+
+            std::optional<StaticMesh::LoadDesc> latestLoadDesc = assetManager.GetLoadDesc<StaticMesh>(snapshot.Info.GetGuid());
+            latestLoadDescs[staticMeshHandle] = latestLoadDesc ? *latestLoadDesc : staticMeshPtr->GetSnapshot().LoadDescriptor;
+
+            const Mesh& mesh = staticMeshPtr->GetMesh();
+            const StaticMeshLoadDesc& loadDesc = staticMeshPtr->GetSnapshot().LoadDescriptor;
+            details::MeshLodResidency& residency = residencyMap[staticMeshHandle];
+            residency.NumLevelOfDetails = mesh.NumLevelOfDetails;
+            residency.MinResidentLevelOfDetail = mesh.MinResidentLevelOfDetail;
+            residency.RequiredLevelOfDetail = mesh.NumLevelOfDetails;
+            residency.bUploadPending = mesh.UploadSync && !mesh.UploadSync.IsExpired();
+            for (U8 lod = 0; lod < mesh.NumLevelOfDetails; ++lod)
+            {
+                residency.LevelOfDetailSizes[lod] = loadDesc.GetDecodedLevelOfDetailSize(lod);
+            }
+        }
+
+        /* 더 이상 캐시 되어 있지 않은 메시 */
+        Vector<Handle<StaticMesh>> staleHandles{};
+        for (const auto& [staticMeshHandle, residency] : residencyMap)
+        {
+            if (!latestLoadDescs.contains(staticMeshHandle))
+            {
+                staleHandles.emplace_back(staticMeshHandle);
+            }
+        }
+        for (const Handle<StaticMesh> staleHandle : staleHandles)
+        {
+            residencyMap.erase(staleHandle);
+        }
+
+        /* 인스턴스 별 Screen Coverage로 부터 메시 마다 요구 되는 가장 세밀한 LOD 결정 */
+        const auto camView = registry.view<const TransformComponent, const CameraComponent>();
+        std::optional<std::pair<TransformComponent, CameraComponent>> mainCamera{};
+        for (const auto& [entity, transform, camera] : camView.each())
+        {
+            if (!mainCamera || camera.bIsMainCamera)
+            {
+                mainCamera = std::make_pair(transform, camera);
+            }
+        }
+
+        if (mainCamera)
+        {
+            const auto& [camTransform, camera] = *mainCamera;
+            const Matrix view = TransformUtility::CreateView(camTransform);
+            const Matrix proj = CameraUtility::CreatePerspectiveForReverseZ(camera);
+
+            const auto staticMeshView = registry.view<const TransformComponent, const StaticMeshComponent>();
+            for (const auto& [entity, transform, staticMeshComponent] : staticMeshView.each())
+            {
+                const auto residencyItr = residencyMap.find(staticMeshComponent.Mesh);
+                if (residencyItr == residencyMap.end())
+                {
+                    continue;
+                }
+
+                const StaticMesh* staticMeshPtr = assetManager.Lookup(staticMeshComponent.Mesh);
+                IG_CHECK(staticMeshPtr != nullptr);
+                const BoundingSphere boundingSphere = ToBoundingSphere(staticMeshPtr->GetMesh().BoundingBox);
+                const Vector3 worldCenter = Vector3::Transform(boundingSphere.Centroid, TransformUtility::CreateTransformation(transform));
+                const F32 maxScale = std::max({std::abs(transform.Scale.x), std::abs(transform.Scale.y), std::abs(transform.Scale.z)});
+                const F32 screenCoverage = details::MeshLodStreamingPolicy::ComputeScreenCoverage(
+                    Vector3::Transform(worldCenter, view), boundingSphere.Radius * maxScale, proj._11, proj._22, camera.NearZ);
+
+                details::MeshLodResidency& residency = residencyItr->second;
+                const StaticMeshLoadDesc& latestLoadDesc = latestLoadDescs[staticMeshComponent.Mesh];
+                const U8 requiredLod = details::MeshLodStreamingPolicy::MapScreenCoverageToLod(
+                    screenCoverage, residency.NumLevelOfDetails,
+                    latestLoadDesc.bOverrideLodScreenCoverageThresholds, latestLoadDesc.LodScreenCoverageThresholds);
+                residency.RequiredLevelOfDetail = std::min(residency.RequiredLevelOfDetail, requiredLod);
+            }
+        }
+
+        Vector<Handle<StaticMesh>> residencyHandles{};
+        Vector<details::MeshLodResidency> residencies{};
+        residencyHandles.reserve(residencyMap.size());
+        residencies.reserve(residencyMap.size());
+        for (auto& [staticMeshHandle, residency] : residencyMap)
+        {
+            for (U8 lod = residency.RequiredLevelOfDetail; lod < residency.NumLevelOfDetails; ++lod)
+            {
+                residency.LastRequiredUpdates[lod] = numUpdates;
+            }
+
+            residencyHandles.emplace_back(staticMeshHandle);
+            residencies.emplace_back(residency);
+        }
+
+        const Size maxNumLoads = kMaxNumInFlightLoads - std::min(pendingLoads.size(), kMaxNumInFlightLoads);
+        const details::MeshLodStreamingDecision decision = details::MeshLodStreamingPolicy::Decide(residencies, budgetInBytes, maxNumLoads);
+
+        for (const details::MeshLodStreamingRequest& eviction : decision.Evictions)
+        {
+            StaticMesh* staticMeshPtr = assetManager.Lookup(residencyHandles[eviction.ResidencyIdx]);
+            IG_CHECK(staticMeshPtr != nullptr);
+            Mesh& mesh = staticMeshPtr->mesh;
+            IG_CHECK(eviction.LevelOfDetail == mesh.MinResidentLevelOfDetail);
+            IG_CHECK(eviction.LevelOfDetail < mesh.NumLevelOfDetails - 1);
+
+            /* GPU 에서 참조 중일 수 있는 공간은 UnifiedMeshStorage 에 의해 지연 해제 된다. */
+            ReleaseLevelOfDetail(mesh.LevelOfDetails[eviction.LevelOfDetail], mesh.UploadSync);
+            ++mesh.MinResidentLevelOfDetail;
+            residencyMap[residencyHandles[eviction.ResidencyIdx]].MinResidentLevelOfDetail = mesh.MinResidentLevelOfDetail;
+        }
+
+        for (const details::MeshLodStreamingRequest& load : decision.Loads)
+        {
+            const Handle<StaticMesh> staticMeshHandle = residencyHandles[load.ResidencyIdx];
+            const StaticMesh* staticMeshPtr = assetManager.Lookup(staticMeshHandle);
+            IG_CHECK(staticMeshPtr != nullptr);
+            IG_CHECK(load.LevelOfDetail + 1 == staticMeshPtr->GetMesh().MinResidentLevelOfDetail);
+
+            SharedPtr<std::promise<Result<StaticMeshLevelOfDetail, EStaticMeshLoadStatus>>> loadPromise =
+                std::make_shared<std::promise<Result<StaticMeshLevelOfDetail, EStaticMeshLoadStatus>>>();
+            pendingLoads.emplace_back(PendingLoad{
+                .MeshHandle = staticMeshHandle,
+                .VertexStorageAlloc = staticMeshPtr->GetMesh().VertexStorageAlloc,
+                .LevelOfDetail = load.LevelOfDetail,
+                .LoadResult = loadPromise->get_future()
+            });
+            residencyMap[staticMeshHandle].bLoadPending = true;
+
+            taskExecutor.silent_async(
+                [this, desc = staticMeshPtr->GetSnapshot(), lod = load.LevelOfDetail, loadPromise]()
+                {
+                    loadPromise->set_value(staticMeshLoader.LoadLevelOfDetail(desc, lod));
+                });
+        }
+
+        streamedSize = 0;
+        for (const auto& [staticMeshHandle, residency] : residencyMap)
+        {
+            streamedSize += details::MeshLodStreamingPolicy::ComputeStreamedSize(residency);
+        }
+    }
+
+    void StaticMeshStreamer::CommitCompletedLoads(const bool bWaitForAll)
+    {
+        for (auto itr = pendingLoads.begin(); itr != pendingLoads.end();)
+        {
+            PendingLoad& pendingLoad = *itr;
+            if (!bWaitForAll && pendingLoad.LoadResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++itr;
+                continue;
+            }
+
+            Result<StaticMeshLevelOfDetail, EStaticMeshLoadStatus> result = pendingLoad.LoadResult.get();
+            if (const auto residencyItr = residencyMap.find(pendingLoad.MeshHandle);
+                residencyItr != residencyMap.end())
+            {
+                residencyItr->second.bLoadPending = false;
+            }
+
+            if (!result.IsSuccess())
+            {
+                IG_LOG(StaticMeshStreamerLog, Error, "Failed to stream LOD{} of static mesh. {}", (U32)pendingLoad.LevelOfDetail, ToCStr(result.GetStatus()));
+                itr = pendingLoads.erase(itr);
+                continue;
+            }
+
+            StaticMeshLevelOfDetail loadedLod = result.Take();
+            /*
+             * 로드 도중 메시가 해제 되었거나 다시 로드 된 경우, 스트리밍 된 LOD는 버린다. 스트리머 해제 시에도 마찬가지.
+             * 상주 집합에서 제외 된(Keep-Alive) 메시의 LOD 도 버린다.
+             */
+            StaticMesh* staticMeshPtr = bWaitForAll ? nullptr : assetManager.Lookup(pendingLoad.MeshHandle);
+            if (staticMeshPtr == nullptr ||
+                !residencyMap.contains(pendingLoad.MeshHandle) ||
+                staticMeshPtr->mesh.VertexStorageAlloc != pendingLoad.VertexStorageAlloc ||
+                staticMeshPtr->mesh.MinResidentLevelOfDetail != (pendingLoad.LevelOfDetail + 1))
+            {
+                ReleaseLevelOfDetail(loadedLod.Lod, loadedLod.UploadSync);
+                itr = pendingLoads.erase(itr);
+                continue;
+            }
+
+            Mesh& mesh = staticMeshPtr->mesh;
+            mesh.LevelOfDetails[pendingLoad.LevelOfDetail] = loadedLod.Lod;
+            mesh.MinResidentLevelOfDetail = pendingLoad.LevelOfDetail;
+            /* 모든 메시 업로드는 같은 업로더(큐)를 통해 제출 되므로, 가장 마지막 동기화 지점이 이전 업로드를 포함 한다. */
+            mesh.UploadSync = loadedLod.UploadSync;
+            itr = pendingLoads.erase(itr);
+        }
+    }
+
+    void StaticMeshStreamer::TrimToCoarsestLevelOfDetail(Mesh& mesh)
+    {
+        if (mesh.NumLevelOfDetails == 0)
+        {
+            return;
+        }
+
+        const U8 coarsestLod = mesh.NumLevelOfDetails - 1;
+        for (; mesh.MinResidentLevelOfDetail < coarsestLod; ++mesh.MinResidentLevelOfDetail)
+        {
+            ReleaseLevelOfDetail(mesh.LevelOfDetails[mesh.MinResidentLevelOfDetail], mesh.UploadSync);
+        }
+    }
+
+    void StaticMeshStreamer::ReleaseLevelOfDetail(MeshLod& meshLod, const GpuSyncPoint& uploadSync)
+    {
+        /* 업로드가 진행 중인 경우, 업로드가 끝난 이후에 해제 된다. */
+        renderContext.GetUnifiedMeshStorage().Deallocate(meshLod, uploadSync);
+        meshLod = {};
+    }
+} // namespace ig
@@ -0,0 +1,139 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Handle.h"
+#include "Igniter/Core/Memory.h"
+#include "Igniter/Render/Mesh.h"
+#include "Igniter/Asset/StaticMesh.h"
+#include "Igniter/Asset/StaticMeshLoader.h"
+
+namespace ig::details
+{
+    /*
+     * #sy_note Static Mesh LOD 스트리밍 정책
+     * 가장 거친 LOD(N-1)는 항상 상주하며, 상주 LOD는 [MinResidentLevelOfDetail, N) 의 연속 구간으로 유지 된다.
+     * 더 세밀한 LOD는 요구 된 LOD에 도달 할 때 까지 한 단계씩 로드 되고,
+     * 예산(가장 거친 LOD를 제외한 스트리밍 LOD의 총 크기)을 초과하는 경우 가장 오랫동안 요구 되지 않은 LOD 부터 해제 된다.
+     * GPU 자원에 의존하지 않으므로 독립적으로 결정을 검증 할 수 있다.
+     */
+    struct MeshLodResidency
+    {
+    public:
+        U8 NumLevelOfDetails = 1;
+        U8 MinResidentLevelOfDetail = 0;
+        /* 이번 갱신에서 요구 된 가장 세밀한 LOD. 어떤 인스턴스에서도 사용되지 않았다면 NumLevelOfDetails. */
+        U8 RequiredLevelOfDetail = 0;
+        /* LOD 로드가 진행 중. 상주 LOD를 변경 할 수 없다. */
+        bool bLoadPending = false;
+        /* GPU 업로드가 진행 중. 해제 할 수 없다. */
+        bool bUploadPending = false;
+        Array<Size, Mesh::kMaxMeshLevelOfDetails> LevelOfDetailSizes{};
+        /* LOD 별로 마지막으로 요구 된 갱신 번호 */
+        Array<U64, Mesh::kMaxMeshLevelOfDetails> LastRequiredUpdates{};
+    };
+
+    struct MeshLodStreamingRequest
+    {
+    public:
+        Index ResidencyIdx = 0;
+        U8 LevelOfDetail = 0;
+    };
+
+    struct MeshLodStreamingDecision
+    {
+    public:
+        /* 순서대로 적용 되어야 한다. 같은 메시에 대해서는 항상 더 세밀한 LOD 부터 해제 된다. */
+        Vector<MeshLodStreamingRequest> Evictions;
+        Vector<MeshLodStreamingRequest> Loads;
+    };
+
+    class MeshLodStreamingPolicy final
+    {
+    public:
+        /* 셰이더(PreMeshInstanceCS)의 Hi-Z 컬링 시 사용되는 보수적인 Bounding Sphere 반지름 */
+        constexpr static F32 kConservativeBoundingSphereRadiusFactor = 0.5f;
+        /* 오차 기반 임계값 유도 시 기준이 되는 화면 해상도와 허용 오차(픽셀) */
+        constexpr static F32 kReferenceViewportWidth = 1920.f;
+        constexpr static F32 kReferenceViewportHeight = 1080.f;
+        constexpr static F32 kLodErrorThresholdPixels = 1.f;
+
+    public:
+        /* Screen UV 공간 에서 Bounding Sphere가 차지하는 사각형의 넓이 [0, 1] */
+        [[nodiscard]] static F32 ComputeScreenCoverage(const Vector3& viewSpaceCenter, const F32 radius, const F32 projScaleX, const F32 projScaleY, const F32 nearZ);
+        /* 셰이더의 LOD 선택 방식(MapScreenCoverageToLodAuto 및 Override Thresholds)과 동일 */
+        [[nodiscard]] static U8 MapScreenCoverageToLod(const F32 screenCoverage, const U8 numLevelOfDetails,
+            const bool bOverrideThresholds, const std::span<const F32> thresholds);
+
+        /* 메시 로컬 공간의 LOD 오차가 기준 해상도에서 kLodErrorThresholdPixels 로 투영 되는 Screen Coverage */
+        [[nodiscard]] static F32 ComputeLodErrorScreenCoverage(const F32 lodError, const F32 radius);
+        /* LOD(i+1) 의 오차가 허용 되는 Screen Coverage 를 LOD(i) 의 임계값으로 사용. 마지막 LOD 는 0. */
+        [[nodiscard]] static Array<F32, Mesh::kMaxMeshLevelOfDetails> ComputeLodScreenCoverageThresholds(
+            const std::span<const F32> lodErrors, const U8 numLevelOfDetails, const F32 radius);
+
+        [[nodiscard]] static Size ComputeStreamedSize(const MeshLodResidency& residency);
+        [[nodiscard]] static MeshLodStreamingDecision Decide(const std::span<const MeshLodResidency> residencies, const Size budgetInBytes, const Size maxNumLoads);
+    };
+} // namespace ig::details
+
+namespace ig
+{
+    class RenderContext;
+    class AssetManager;
+
+    /*
+     * #sy_note Static Mesh LOD 스트리밍
+     * 매 프레임 CPU 에서 인스턴스 별 Screen Coverage를 계산하여 메시 마다 필요한 LOD를 결정하고,
+     * 부족한 LOD는 Task Executor 에서 비동기적으로 로드, 사용되지 않는 LOD는 예산 내에서 UnifiedMeshStorage 로 부터 해제 한다.
+     * 상주 LOD의 변경은 Update 에서만 이루어지므로, SceneProxy 의 Replication 과 동시에 호출 되어서는 안된다.
+     * 참조 되지 않고 캐시에 유지(Keep-Alive) 되고 있는 메시는 가장 거친 LOD 만 남기고 해제 한다.
+     */
+    class StaticMeshStreamer final
+    {
+    public:
+        constexpr static Size kDefaultBudget = MegaBytesToBytes(256);
+        constexpr static Size kMaxNumInFlightLoads = 8;
+
+    public:
+        StaticMeshStreamer(tf::Executor& taskExecutor, RenderContext& renderContext, AssetManager& assetManager);
+        StaticMeshStreamer(const StaticMeshStreamer&) = delete;
+        StaticMeshStreamer(StaticMeshStreamer&&) noexcept = delete;
+        ~StaticMeshStreamer();
+
+        StaticMeshStreamer& operator=(const StaticMeshStreamer&) = delete;
+        StaticMeshStreamer& operator=(StaticMeshStreamer&&) noexcept = delete;
+
+        void Update(const Registry& registry);
+
+        void SetBudget(const Size newBudgetInBytes) { budgetInBytes = newBudgetInBytes; }
+        [[nodiscard]] Size GetBudget() const noexcept { return budgetInBytes; }
+        [[nodiscard]] Size GetStreamedSize() const noexcept { return streamedSize; }
+
+    private:
+        struct PendingLoad
+        {
+        public:
+            Handle<StaticMesh> MeshHandle{};
+            /* 로드 도중 메시가 다시 로드(Reload) 되었는지 확인 하기 위함 */
+            Handle<MeshVertex> VertexStorageAlloc{};
+            U8 LevelOfDetail = 0;
+            std::future<Result<StaticMeshLevelOfDetail, EStaticMeshLoadStatus>> LoadResult;
+        };
+
+    private:
+        void CommitCompletedLoads(const bool bWaitForAll);
+        void TrimToCoarsestLevelOfDetail(Mesh& mesh);
+        void ReleaseLevelOfDetail(MeshLod& meshLod, const GpuSyncPoint& uploadSync);
+
+    private:
+        tf::Executor& taskExecutor;
+        RenderContext& renderContext;
+        AssetManager& assetManager;
+        StaticMeshLoader staticMeshLoader;
+
+        Size budgetInBytes = kDefaultBudget;
+        Size streamedSize = 0;
+        U64 numUpdates = 0;
+
+        UnorderedMap<Handle<StaticMesh>, details::MeshLodResidency> residencyMap{};
+        Vector<PendingLoad> pendingLoads{};
+    };
+} // namespace ig
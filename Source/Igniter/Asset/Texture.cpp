@@ -2,6 +2,7 @@
 #include "Igniter/Core/Json.h"
 #include "Igniter/Core/Engine.h"
 #include "Igniter/Render/RenderContext.h"
+#include "Igniter/Asset/AssetManager.h"
 #include "Igniter/Asset/Texture.h"
 
 namespace ig
@@ -9,6 +10,7 @@ namespace ig
     Json& TextureImportDesc::Serialize(Json& archive) const
     {
         IG_SERIALIZE_TO_JSON(TextureImportDesc, archive, CompressionMode);
+        IG_SERIALIZE_TO_JSON(TextureImportDesc, archive, CompressionQuality);
         IG_SERIALIZE_TO_JSON(TextureImportDesc, archive, bGenerateMips);
         IG_SERIALIZE_TO_JSON(TextureImportDesc, archive, Filter);
         IG_SERIALIZE_TO_JSON(TextureImportDesc, archive, AddressModeU);
@@ -21,6 +23,7 @@ namespace ig
     {
         *this = {};
         IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureImportDesc, archive, CompressionMode, ETextureCompressionMode::None);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureImportDesc, archive, CompressionQuality, ETextureCompressionQuality::Normal);
         IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureImportDesc, archive, bGenerateMips, false);
         IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureImportDesc, archive, Filter, D3D12_FILTER_MIN_MAG_MIP_LINEAR);
         IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureImportDesc, archive, AddressModeU, D3D12_TEXTURE_ADDRESS_MODE_CLAMP);
@@ -42,6 +45,10 @@ namespace ig
         IG_SERIALIZE_TO_JSON(TextureLoadDesc, archive, AddressModeU);
         IG_SERIALIZE_TO_JSON(TextureLoadDesc, archive, AddressModeV);
         IG_SERIALIZE_TO_JSON(TextureLoadDesc, archive, AddressModeW);
+        IG_SERIALIZE_TO_JSON(TextureLoadDesc, archive, PackedTextureGuid);
+        IG_SERIALIZE_TO_JSON(TextureLoadDesc, archive, PackedArraySlice);
+        IG_SERIALIZE_TO_JSON(TextureLoadDesc, archive, PackedOffsetX);
+        IG_SERIALIZE_TO_JSON(TextureLoadDesc, archive, PackedOffsetY);
         return archive;
     }
 
@@ -59,21 +66,36 @@ namespace ig
         IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureLoadDesc, archive, AddressModeU, D3D12_TEXTURE_ADDRESS_MODE_CLAMP);
         IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureLoadDesc, archive, AddressModeV, D3D12_TEXTURE_ADDRESS_MODE_CLAMP);
         IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureLoadDesc, archive, AddressModeW, D3D12_TEXTURE_ADDRESS_MODE_CLAMP);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureLoadDesc, archive, PackedTextureGuid, Guid{});
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureLoadDesc, archive, PackedArraySlice, 0);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureLoadDesc, archive, PackedOffsetX, 0);
+        IG_DESERIALIZE_FROM_JSON_FALLBACK(TextureLoadDesc, archive, PackedOffsetY, 0);
         return archive;
     }
 
-    Texture::Texture(RenderContext& renderContext, const Desc& snapshot, const Handle<GpuTexture> gpuTexture, const Handle<GpuView> srv, const Handle<GpuView> sampler)
+    Texture::Texture(RenderContext& renderContext, const Desc& snapshot, const Handle<GpuTexture> gpuTexture, const Handle<GpuView> srv, const Handle<GpuView> sampler,
+        const U16 mostDetailedResidentMip)
         : renderContext(&renderContext)
         , snapshot(snapshot)
         , gpuTexture(gpuTexture)
         , srv(srv)
         , sampler(sampler)
+        , mostDetailedResidentMip(mostDetailedResidentMip)
     {
         IG_CHECK(gpuTexture);
         IG_CHECK(srv);
         IG_CHECK(sampler);
     }
 
+    Texture::Texture(AssetManager& assetManager, const Desc& snapshot, const Handle<Texture> packedTexture)
+        : snapshot(snapshot)
+        , assetManager(&assetManager)
+        , packedTexture(packedTexture)
+    {
+        IG_CHECK(snapshot.LoadDescriptor.IsSubTexture());
+        IG_CHECK(packedTexture);
+    }
+
     Texture::~Texture()
     {
         Destroy();
@@ -88,10 +110,25 @@ namespace ig
         gpuTexture = std::exchange(rhs.gpuTexture, {});
         srv = std::exchange(rhs.srv, {});
         sampler = std::exchange(rhs.sampler, {});
+        mostDetailedResidentMip = std::exchange(rhs.mostDetailedResidentMip, (U16)0);
+        assetManager = std::exchange(rhs.assetManager, nullptr);
+        packedTexture = std::exchange(rhs.packedTexture, {});
 
         return *this;
     }
 
+    Bytes Texture::GetResidentSize() const
+    {
+        if (IsSubTexture())
+        {
+            const Texture* packedTexturePtr = assetManager->Lookup(packedTexture);
+            return sizeof(Texture) + (packedTexturePtr != nullptr ? packedTexturePtr->GetResidentSize() : 0);
+        }
+
+        const GpuTexture* gpuTexturePtr = renderContext != nullptr ? renderContext->Lookup(gpuTexture) : nullptr;
+        return sizeof(Texture) + (gpuTexturePtr != nullptr ? gpuTexturePtr->GetAllocationSize() : 0);
+    }
+
     void Texture::Destroy()
     {
         if (renderContext != nullptr)
@@ -101,10 +138,17 @@ namespace ig
             renderContext->DestroyGpuView(sampler);
         }
 
+        if (assetManager != nullptr)
+        {
+            assetManager->Unload(packedTexture);
+        }
+
         renderContext = nullptr;
         gpuTexture = {};
         srv = {};
         sampler = {};
+        assetManager = nullptr;
+        packedTexture = {};
     }
 } // namespace ig
 
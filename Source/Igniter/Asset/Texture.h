@@ -4,12 +4,15 @@
 #include "Igniter/D3D12/Common.h"
 #include "Igniter/Render/RenderContext.h"
 #include "Igniter/Asset/Common.h"
+#include "Igniter/Asset/BlockCompressor.h"
 
 namespace ig
 {
     enum class ETextureCompressionMode
     {
         None,
+        BC1,  /* Color maps (no alpha) */
+        BC3,  /* Color maps + Full Alpha */
         BC4,  /* Gray-scale */
         BC5,  /* Tangent-space normal maps */
         BC6H, /* HDR images */
@@ -31,6 +34,8 @@ namespace ig
 
     public:
         ETextureCompressionMode CompressionMode = ETextureCompressionMode::None;
+        /* BC6H/BC7 을 제외한 압축 모드에 적용 (BlockCompressor) */
+        ETextureCompressionQuality CompressionQuality = ETextureCompressionQuality::Normal;
         bool bGenerateMips = false;
 
         D3D12_FILTER Filter = D3D12_FILTER_COMPARISON_MIN_MAG_MIP_LINEAR;
@@ -39,6 +44,27 @@ namespace ig
         D3D12_TEXTURE_ADDRESS_MODE AddressModeW = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
     };
 
+    /* 작은 텍스처 들을 텍스처 배열/아틀라스로 묶어 임포트 (TexturePacker) */
+    struct TexturePackImportDesc
+    {
+    public:
+        /* 생성 되는 텍스처 배열/아틀라스 에셋 Virtual Path 의 접두사 */
+        std::string PackName{};
+
+        ETextureCompressionMode CompressionMode = ETextureCompressionMode::None;
+        ETextureCompressionQuality CompressionQuality = ETextureCompressionQuality::Normal;
+        bool bGenerateMips = true;
+
+        U32 MaxAtlasExtent = 2048;
+        U16 MinArrayLength = 2;
+        U16 MaxAtlasMips = 4;
+
+        D3D12_FILTER Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
+        /* 텍스처 배열 에만 적용; 아틀라스는 항상 CLAMP */
+        D3D12_TEXTURE_ADDRESS_MODE AddressModeU = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+        D3D12_TEXTURE_ADDRESS_MODE AddressModeV = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+    };
+
     struct TextureLoadDesc
     {
     public:
@@ -46,6 +72,7 @@ namespace ig
         const Json& Deserialize(const Json& archive);
 
         [[nodiscard]] bool IsArray() const { return Dimension != ETextureDimension::Tex3D && DepthOrArrayLength > 1; }
+        [[nodiscard]] bool IsSubTexture() const { return PackedTextureGuid.isValid(); }
 
     public:
         DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
@@ -60,22 +87,38 @@ namespace ig
         D3D12_TEXTURE_ADDRESS_MODE AddressModeU = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
         D3D12_TEXTURE_ADDRESS_MODE AddressModeV = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
         D3D12_TEXTURE_ADDRESS_MODE AddressModeW = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+
+        /*
+         * 서브 텍스처 라면 자신이 패킹 된 텍스처 배열/아틀라스. 서브 텍스처는 GPU 자원을 가지지 않으며,
+         * 패킹 된 텍스처의 SRV/Sampler 와 함께 Slice 및 UV 영역(PackedOffset, Width/Height)으로 샘플링 된다.
+         */
+        Guid PackedTextureGuid{};
+        U16 PackedArraySlice = 0;
+        /* 패킹 된 텍스처 내 에서의 시작 위치(Texel, Mip 0) */
+        U32 PackedOffsetX = 0;
+        U32 PackedOffsetY = 0;
     };
 
     class GpuTexture;
     class GpuView;
     class RenderContext;
+    class AssetManager;
 
     class Texture final
     {
+        friend class TextureStreamer;
+
     public:
         using ImportDesc = TextureImportDesc;
         using LoadDesc = TextureLoadDesc;
         using Desc = AssetDesc<Texture>;
 
     public:
+        /* mostDetailedResidentMip: gpuTexture 의 Mip 0 에 해당하는 원본 텍스처의 Mip (TextureStreamer) */
         Texture(RenderContext& renderContext, const Desc& snapshot, const Handle<GpuTexture> gpuTexture, const Handle<GpuView> srv,
-                const Handle<GpuView> sampler);
+                const Handle<GpuView> sampler, const U16 mostDetailedResidentMip = 0);
+        /* 서브 텍스처; packedTexture 의 참조는 서브 텍스처가 해제 될 때 함께 해제 된다. */
+        Texture(AssetManager& assetManager, const Desc& snapshot, const Handle<Texture> packedTexture);
         Texture(const Texture&) = delete;
         Texture(Texture&&) noexcept = default;
         ~Texture();
@@ -87,6 +130,11 @@ namespace ig
         [[nodiscard]] Handle<GpuTexture> GetGpuTexture() const { return gpuTexture; }
         [[nodiscard]] Handle<GpuView> GetShaderResourceView() const { return srv; }
         [[nodiscard]] Handle<GpuView> GetSampler() const { return sampler; }
+        [[nodiscard]] U16 GetMostDetailedResidentMip() const { return mostDetailedResidentMip; }
+        [[nodiscard]] bool IsSubTexture() const { return static_cast<bool>(packedTexture); }
+        [[nodiscard]] Handle<Texture> GetPackedTexture() const { return packedTexture; }
+        /* GPU 텍스처 할당의 크기. 서브 텍스처의 경우 참조 중인 패킹 된 텍스처의 크기. */
+        [[nodiscard]] Bytes GetResidentSize() const;
 
     private:
         void Destroy();
@@ -103,6 +151,10 @@ namespace ig
         Handle<GpuTexture> gpuTexture{};
         Handle<GpuView> srv{};
         Handle<GpuView> sampler{};
+        U16 mostDetailedResidentMip = 0;
+
+        AssetManager* assetManager{nullptr};
+        Handle<Texture> packedTexture{};
     };
 } // namespace ig
 
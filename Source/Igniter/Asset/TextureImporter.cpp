@@ -4,6 +4,7 @@
 #include "Igniter/Core/Serialization.h"
 #include "Igniter/Core/ComInitializer.h"
 #include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/TexturePacker.h"
 #include "Igniter/Asset/TextureImporter.h"
 
 IG_DECLARE_LOG_CATEGORY(TextureImporterLog);
@@ -52,6 +53,10 @@ namespace ig
     {
         switch (compMode)
         {
+        case ETextureCompressionMode::BC1:
+            return DirectX::IsSRGB(format) ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+        case ETextureCompressionMode::BC3:
+            return DirectX::IsSRGB(format) ? DXGI_FORMAT_BC3_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM;
         case ETextureCompressionMode::BC4:
             return IsUnormFormat(format) ? DXGI_FORMAT_BC4_UNORM : DXGI_FORMAT_BC4_SNORM;
         case ETextureCompressionMode::BC5:
@@ -65,8 +70,133 @@ namespace ig
         }
     }
 
-    TextureImporter::TextureImporter()
+    /*
+     * BC1/BC3/BC4/BC5 의 UNORM 포맷 텍스처는 RGBA8 로 변환 후 BlockCompressor 로 압축 한다. (SNORM BC4/BC5 는 DirectXTex)
+     * BlockCompressor 의 BC7 은 Mode 6 만 사용하여 다중 모드를 탐색하는 DirectXTex(GPU) 코덱 보다 품질이 낮으므로, BC6H 와 같이 DirectXTex 를 사용 한다.
+     */
+    static std::optional<details::EBlockCompressionFormat> AsBlockCompressionFormat(const ETextureCompressionMode compMode, const DXGI_FORMAT format)
     {
+        if (DirectX::FormatDataType(format) != DirectX::FORMAT_TYPE_UNORM)
+        {
+            return std::nullopt;
+        }
+
+        switch (compMode)
+        {
+        case ETextureCompressionMode::BC1:
+            return details::EBlockCompressionFormat::BC1;
+        case ETextureCompressionMode::BC3:
+            return details::EBlockCompressionFormat::BC3;
+        case ETextureCompressionMode::BC4:
+            return details::EBlockCompressionFormat::BC4;
+        case ETextureCompressionMode::BC5:
+            return details::EBlockCompressionFormat::BC5;
+        default:
+            return std::nullopt;
+        }
+    }
+
+    /* 패킹 할 소스를 단일 RGBA8 이미지로 로드 한다. HDR 또는 배열/큐브/볼륨 텍스처는 패킹 하지 않는다. */
+    static bool LoadPackingSource(const Path& resPath, DirectX::ScratchImage& rgba8Image)
+    {
+        const Path resExtension = resPath.extension();
+        DirectX::TexMetadata texMetadata{};
+        DirectX::ScratchImage loadedTex{};
+        HRESULT loadRes = E_FAIL;
+        if (IsWICExtension(resExtension))
+        {
+            loadRes = DirectX::LoadFromWICFile(resPath.c_str(), DirectX::WIC_FLAGS_NONE, &texMetadata, loadedTex);
+        }
+        else if (IsDDSExtnsion(resExtension))
+        {
+            loadRes = DirectX::LoadFromDDSFile(resPath.c_str(), DirectX::DDS_FLAGS_NONE, &texMetadata, loadedTex);
+        }
+
+        if (FAILED(loadRes) || texMetadata.dimension != DirectX::TEX_DIMENSION_TEXTURE2D || texMetadata.arraySize != 1 || texMetadata.IsCubemap() ||
+            texMetadata.width == 0 || texMetadata.height == 0 || DirectX::FormatDataType(texMetadata.format) == DirectX::FORMAT_TYPE_FLOAT)
+        {
+            return false;
+        }
+
+        const DirectX::Image* srcImage = loadedTex.GetImage(0, 0, 0);
+        DirectX::ScratchImage decompressedTex{};
+        if (DirectX::IsCompressed(texMetadata.format))
+        {
+            if (FAILED(DirectX::Decompress(*srcImage, DXGI_FORMAT_UNKNOWN, decompressedTex)))
+            {
+                return false;
+            }
+            srcImage = decompressedTex.GetImage(0, 0, 0);
+        }
+
+        const DXGI_FORMAT rgba8Format = DirectX::IsSRGB(srcImage->format) ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
+        if (srcImage->format == rgba8Format)
+        {
+            return SUCCEEDED(rgba8Image.InitializeFromImage(*srcImage));
+        }
+
+        return SUCCEEDED(DirectX::Convert(*srcImage, rgba8Format, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, rgba8Image));
+    }
+
+    /* RGBA8 소스를 (offsetX, offsetY) 에 복사 하고, 주변 padding 만큼의 영역을 소스의 가장자리 Texel 로 채운다. */
+    static void CopyWithEdgePadding(const DirectX::Image& srcImage, const DirectX::Image& dstImage, const U32 offsetX, const U32 offsetY, const U32 padding)
+    {
+        constexpr Size kBytesPerPixel = 4;
+        IG_CHECK(offsetX >= padding && offsetY >= padding);
+        IG_CHECK(offsetX + srcImage.width + padding <= dstImage.width && offsetY + srcImage.height + padding <= dstImage.height);
+        const S64 srcHeight = static_cast<S64>(srcImage.height);
+        const Size srcRowSize = srcImage.width * kBytesPerPixel;
+        for (S64 y = -static_cast<S64>(padding); y < srcHeight + padding; ++y)
+        {
+            const U8* srcRow = srcImage.pixels + std::clamp<S64>(y, 0, srcHeight - 1) * srcImage.rowPitch;
+            U8* dstRow = dstImage.pixels + (offsetY + y) * dstImage.rowPitch + offsetX * kBytesPerPixel;
+            std::memcpy(dstRow, srcRow, srcRowSize);
+            for (U32 paddingIdx = 1; paddingIdx <= padding; ++paddingIdx)
+            {
+                std::memcpy(dstRow - paddingIdx * kBytesPerPixel, srcRow, kBytesPerPixel);
+                std::memcpy(dstRow + srcRowSize + (paddingIdx - 1) * kBytesPerPixel, srcRow + srcRowSize - kBytesPerPixel, kBytesPerPixel);
+            }
+        }
+    }
+
+    /* texture 가 nullptr 라면 에셋 파일은 자리 표시자로 저장 된다. (서브 텍스처) */
+    static Result<Texture::Desc, ETextureImportStatus> ExportTextureAsset(const AssetInfo& assetInfo, const TextureLoadDesc& loadDesc,
+        const DirectX::ScratchImage* texture)
+    {
+        Json assetMetadata{};
+        assetMetadata << assetInfo << loadDesc;
+        if (!SaveJsonToFile(MakeAssetMetadataPath(EAssetCategory::Texture, assetInfo.GetGuid()), assetMetadata))
+        {
+            return MakeFail<Texture::Desc, ETextureImportStatus::FailedSaveMetadataToFile>();
+        }
+
+        const Path assetPath = MakeAssetPath(EAssetCategory::Texture, assetInfo.GetGuid());
+        IG_CHECK(!assetPath.empty());
+        if (texture != nullptr)
+        {
+            if (FAILED(DirectX::SaveToDDSFile(texture->GetImages(), texture->GetImageCount(), texture->GetMetadata(), DirectX::DDS_FLAGS_NONE,
+                assetPath.c_str())))
+            {
+                return MakeFail<Texture::Desc, ETextureImportStatus::FailedSaveAssetToFile>();
+            }
+        }
+        else if (!SaveBlobToFile(assetPath, std::array<U8, 1>{0}))
+        {
+            return MakeFail<Texture::Desc, ETextureImportStatus::FailedSaveAssetToFile>();
+        }
+
+        return MakeSuccess<Texture::Desc, ETextureImportStatus>(assetInfo, loadDesc);
+    }
+
+    TextureImporter::TextureImporter(tf::Executor& taskExecutor, const bool bAllowGpuCodec)
+        : taskExecutor(taskExecutor)
+    {
+        if (!bAllowGpuCodec)
+        {
+            IG_LOG(TextureImporterLog, Info, "GPU codec disabled. All textures will be compressed by CPU.");
+            return;
+        }
+
         U32 creationFlags = 0;
 #if defined(DEBUG) || defined(_DEBUG)
         creationFlags |= static_cast<U32>(D3D11_CREATE_DEVICE_DEBUG);
@@ -100,6 +230,21 @@ namespace ig
         }
 
         const Path resExtension = resPath.extension();
+        if (!IsDDSExtnsion(resExtension) && !IsWICExtension(resExtension) && !IsHDRExtnsion(resExtension))
+        {
+            return MakeFail<Texture::Desc, ETextureImportStatus::UnsupportedExtension>();
+        }
+
+        Json serializedImportDesc{};
+        serializedImportDesc << importDesc;
+        const U64 importCacheKey{ImportCache::MakeKey(resPath, serializedImportDesc, kImporterVersion)};
+        if (const std::optional<ImportCache::Entry> cacheEntry{ImportCache::Lookup(EAssetCategory::Texture, importCacheKey)};
+            cacheEntry && cacheEntry->Outputs.size() == 1)
+        {
+            IG_LOG(TextureImporterLog, Info, "Import cache hit. File: {}", resPathStr);
+            return ImportFromCache(resPath, *cacheEntry);
+        }
+
         DirectX::ScratchImage targetTex{};
         DirectX::TexMetadata texMetadata{};
 
@@ -195,26 +340,17 @@ namespace ig
                     importDesc.CompressionMode = ETextureCompressionMode::BC4;
                 }
 
-                auto compFlags = static_cast<unsigned long>(DirectX::TEX_COMPRESS_PARALLEL);
                 const DXGI_FORMAT compFormat = AsBCnFormat(importDesc.CompressionMode, texMetadata.format);
-
-                const bool bIsGPUCodecAvailable = d3d11Device != nullptr && (importDesc.CompressionMode == ETextureCompressionMode::BC6H ||
-                    importDesc.CompressionMode == ETextureCompressionMode::BC7);
-
                 HRESULT compRes = S_FALSE;
                 DirectX::ScratchImage compTex{};
+                if (const std::optional<details::EBlockCompressionFormat> blockCompFormat = AsBlockCompressionFormat(importDesc.CompressionMode, texMetadata.format);
+                    blockCompFormat)
+                {
+                    compRes = CompressBlocks(resPathStr, *blockCompFormat, importDesc.CompressionQuality, compFormat, targetTex, compTex);
+                }
+                else
                 {
-                    UniqueLock lock{compressionMutex};
-                    if (bIsGPUCodecAvailable)
-                    {
-                        compRes = DirectX::Compress(d3d11Device, targetTex.GetImages(), targetTex.GetImageCount(), targetTex.GetMetadata(),
-                            compFormat, static_cast<DirectX::TEX_COMPRESS_FLAGS>(compFlags), DirectX::TEX_ALPHA_WEIGHT_DEFAULT, compTex);
-                    }
-                    else
-                    {
-                        compRes = DirectX::Compress(targetTex.GetImages(), targetTex.GetImageCount(), targetTex.GetMetadata(), compFormat,
-                            static_cast<DirectX::TEX_COMPRESS_FLAGS>(compFlags), DirectX::TEX_ALPHA_WEIGHT_DEFAULT, compTex);
-                    }
+                    compRes = CompressWithDirectXTex(importDesc.CompressionMode, compFormat, targetTex, compTex);
                 }
 
                 if (FAILED(compRes))
@@ -282,7 +418,258 @@ namespace ig
             return MakeFail<Texture::Desc, ETextureImportStatus::FailedSaveAssetToFile>();
         }
 
+        Json serializedLoadDesc{};
+        serializedLoadDesc << newLoadConfig;
+        const ImportCache::Record cacheRecord{
+            .VirtualPath = std::string{assetInfo.GetVirtualPath()},
+            .SerializedLoadDesc = serializedLoadDesc,
+            .AssetPath = assetPath
+        };
+        ImportCache::Store(EAssetCategory::Texture, importCacheKey, std::span{&cacheRecord, 1}, resMetadata);
+
         IG_CHECK(assetInfo.IsValid() && assetInfo.GetCategory() == EAssetCategory::Texture);
         return MakeSuccess<Texture::Desc, ETextureImportStatus>(assetInfo, newLoadConfig);
     }
+
+    HRESULT TextureImporter::CompressBlocks(const std::string_view resPathStr, const details::EBlockCompressionFormat blockCompFormat,
+        const ETextureCompressionQuality quality, const DXGI_FORMAT compFormat, const DirectX::ScratchImage& srcTex, DirectX::ScratchImage& compTex)
+    {
+        const DirectX::TexMetadata& srcMetadata = srcTex.GetMetadata();
+        const DXGI_FORMAT rgba8Format = DirectX::IsSRGB(srcMetadata.format) ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
+        DirectX::ScratchImage rgba8Tex{};
+        const DirectX::ScratchImage* rgba8TexPtr = &srcTex;
+        if (srcMetadata.format != rgba8Format)
+        {
+            const HRESULT convRes = DirectX::Convert(srcTex.GetImages(), srcTex.GetImageCount(), srcMetadata, rgba8Format, DirectX::TEX_FILTER_DEFAULT,
+                DirectX::TEX_THRESHOLD_DEFAULT, rgba8Tex);
+            if (FAILED(convRes))
+            {
+                return convRes;
+            }
+            rgba8TexPtr = &rgba8Tex;
+        }
+
+        DirectX::TexMetadata compMetadata = rgba8TexPtr->GetMetadata();
+        compMetadata.format = compFormat;
+        const HRESULT initRes = compTex.Initialize(compMetadata);
+        if (FAILED(initRes))
+        {
+            return initRes;
+        }
+
+        /* Mip/Array Slice 순서는 같은 메타데이터(포맷 제외)로 부터 생성된 두 ScratchImage 에서 동일 하다. */
+        IG_CHECK(rgba8TexPtr->GetImageCount() == compTex.GetImageCount());
+        const Size numImages = compTex.GetImageCount();
+        Vector<details::BlockImageView> srcImages(numImages);
+        Vector<details::CompressedImageView> dstImages(numImages);
+        Size numPixels = 0;
+        for (Index imageIdx = 0; imageIdx < numImages; ++imageIdx)
+        {
+            const DirectX::Image& srcImage = rgba8TexPtr->GetImages()[imageIdx];
+            const DirectX::Image& dstImage = compTex.GetImages()[imageIdx];
+            srcImages[imageIdx] = details::BlockImageView{
+                .Pixels = srcImage.pixels, .Width = (U32)srcImage.width, .Height = (U32)srcImage.height, .RowPitch = srcImage.rowPitch};
+            dstImages[imageIdx] = details::CompressedImageView{.Blocks = dstImage.pixels, .RowPitch = dstImage.rowPitch};
+            numPixels += srcImage.width * srcImage.height;
+        }
+
+        Timer timer{};
+        timer.Begin();
+        details::BlockCompressor::Compress(taskExecutor, blockCompFormat, quality, srcImages, dstImages);
+        timer.End();
+
+        const F64 elapsedSeconds = std::max(timer.GetDeltaTimeF64(), 1e-9);
+        IG_LOG(TextureImporterLog, Info, "{}({}): {} images compressed in {} ms ({:.2f} MPixels/s), PSNR(Mip 0): {:.2f} dB. File: {}",
+            magic_enum::enum_name(blockCompFormat), magic_enum::enum_name(quality), numImages, timer.GetDeltaTimeMillis(),
+            (F64)numPixels / elapsedSeconds * 1e-6, details::BlockCompressor::ComputePsnr(blockCompFormat, srcImages.front(), dstImages.front()),
+            resPathStr);
+
+        return S_OK;
+    }
+
+    HRESULT TextureImporter::CompressWithDirectXTex(const ETextureCompressionMode compMode, const DXGI_FORMAT compFormat, const DirectX::ScratchImage& srcTex,
+        DirectX::ScratchImage& compTex)
+    {
+        auto compFlags = static_cast<unsigned long>(DirectX::TEX_COMPRESS_PARALLEL);
+        const bool bIsGPUCodecAvailable = d3d11Device != nullptr && (compMode == ETextureCompressionMode::BC6H || compMode == ETextureCompressionMode::BC7);
+
+        UniqueLock lock{compressionMutex};
+        if (bIsGPUCodecAvailable)
+        {
+            return DirectX::Compress(d3d11Device, srcTex.GetImages(), srcTex.GetImageCount(), srcTex.GetMetadata(),
+                compFormat, static_cast<DirectX::TEX_COMPRESS_FLAGS>(compFlags), DirectX::TEX_ALPHA_WEIGHT_DEFAULT, compTex);
+        }
+
+        return DirectX::Compress(srcTex.GetImages(), srcTex.GetImageCount(), srcTex.GetMetadata(), compFormat,
+            static_cast<DirectX::TEX_COMPRESS_FLAGS>(compFlags), DirectX::TEX_ALPHA_WEIGHT_DEFAULT, compTex);
+    }
+
+    TexturePackImportResult TextureImporter::ImportPack(const std::span<const std::string> resPaths, const TexturePackImportDesc& packDesc)
+    {
+        CoInitializeUnique();
+
+        TexturePackImportResult result{};
+        result.SubTextures.resize(resPaths.size());
+
+        /* 소스는 모두 RGBA8 UNORM(SRGB) 로 변환 되므로 BlockCompressor 가 지원하는 압축 모드와 BC7(DirectXTex) 만 사용 할 수 있다. */
+        const std::optional<details::EBlockCompressionFormat> blockCompFormat =
+            AsBlockCompressionFormat(packDesc.CompressionMode, DXGI_FORMAT_R8G8B8A8_UNORM);
+        const bool bCompressPages = blockCompFormat.has_value() || packDesc.CompressionMode == ETextureCompressionMode::BC7;
+        if (packDesc.CompressionMode != ETextureCompressionMode::None && !bCompressPages)
+        {
+            IG_LOG(TextureImporterLog, Warning, "Compression mode {} is not supported for texture packing. Pack \"{}\" will be uncompressed.",
+                packDesc.CompressionMode, packDesc.PackName);
+        }
+
+        Vector<DirectX::ScratchImage> sourceImages(resPaths.size());
+        Vector<details::TexturePackingSource> packingSources(resPaths.size());
+        for (Index sourceIdx = 0; sourceIdx < resPaths.size(); ++sourceIdx)
+        {
+            result.SubTextures[sourceIdx].ResPath = resPaths[sourceIdx];
+            if (!LoadPackingSource(Path{resPaths[sourceIdx]}, sourceImages[sourceIdx]))
+            {
+                IG_LOG(TextureImporterLog, Warning, "\"{}\" can not be packed into \"{}\".", resPaths[sourceIdx], packDesc.PackName);
+                continue;
+            }
+
+            const DirectX::TexMetadata& sourceMetadata = sourceImages[sourceIdx].GetMetadata();
+            packingSources[sourceIdx] = details::TexturePackingSource{
+                .Format = sourceMetadata.format, .Width = static_cast<U32>(sourceMetadata.width), .Height = static_cast<U32>(sourceMetadata.height)};
+        }
+
+        const details::TexturePackingPlan plan = details::TexturePacker::Plan(packingSources,
+            details::TexturePackingConfig{
+                .MaxAtlasExtent = packDesc.MaxAtlasExtent,
+                .MinArrayLength = packDesc.MinArrayLength,
+                .MaxAtlasMips = packDesc.MaxAtlasMips,
+                .bGenerateMips = packDesc.bGenerateMips,
+                .bBlockCompressed = bCompressPages});
+
+        const std::string_view packName = packDesc.PackName.empty() ? std::string_view{"TexturePack"} : std::string_view{packDesc.PackName};
+        result.PackedTextures.reserve(plan.Pages.size());
+        for (Index pageIdx = 0; pageIdx < plan.Pages.size(); ++pageIdx)
+        {
+            const details::TexturePackPage& page = plan.Pages[pageIdx];
+            const bool bIsAtlas = page.Kind == details::ETexturePackKind::Atlas;
+            const std::string pageName = std::format("{}_{}{}", packName, bIsAtlas ? "Atlas" : "Array", pageIdx);
+
+            DirectX::ScratchImage pageTex{};
+            if (FAILED(pageTex.Initialize2D(page.Format, page.Width, page.Height, page.ArrayLength, 1)))
+            {
+                result.PackedTextures.emplace_back(MakeFail<Texture::Desc, ETextureImportStatus::InvalidDimensions>());
+                continue;
+            }
+            std::memset(pageTex.GetPixels(), 0, pageTex.GetPixelsSize());
+
+            for (Index sourceIdx = 0; sourceIdx < resPaths.size(); ++sourceIdx)
+            {
+                const details::TexturePackPlacement& placement = plan.Placements[sourceIdx];
+                if (placement.PageIdx == pageIdx)
+                {
+                    CopyWithEdgePadding(*sourceImages[sourceIdx].GetImage(0, 0, 0), *pageTex.GetImage(0, placement.ArraySlice, 0),
+                        placement.OffsetX, placement.OffsetY, page.Padding);
+                }
+            }
+
+            /* 아틀라스의 크기는 2^(Mips-1) 의 배수 이므로, 선형 필터의 2:1 축소는 정렬 된 Box Filter 와 같다. */
+            if (page.Mips > 1)
+            {
+                DirectX::ScratchImage mipChain{};
+                if (FAILED(DirectX::GenerateMipMaps(pageTex.GetImages(), pageTex.GetImageCount(), pageTex.GetMetadata(),
+                    DirectX::TEX_FILTER_LINEAR | DirectX::TEX_FILTER_FORCE_NON_WIC, page.Mips, mipChain)))
+                {
+                    result.PackedTextures.emplace_back(MakeFail<Texture::Desc, ETextureImportStatus::FailedGenerateMips>());
+                    continue;
+                }
+                pageTex = std::move(mipChain);
+            }
+
+            if (bCompressPages)
+            {
+                const DXGI_FORMAT compFormat = AsBCnFormat(packDesc.CompressionMode, page.Format);
+                DirectX::ScratchImage compTex{};
+                const HRESULT compRes = blockCompFormat ?
+                    CompressBlocks(pageName, *blockCompFormat, packDesc.CompressionQuality, compFormat, pageTex, compTex) :
+                    CompressWithDirectXTex(packDesc.CompressionMode, compFormat, pageTex, compTex);
+                if (FAILED(compRes))
+                {
+                    result.PackedTextures.emplace_back(MakeFail<Texture::Desc, ETextureImportStatus::FailedCompression>());
+                    continue;
+                }
+                pageTex = std::move(compTex);
+            }
+
+            const TextureLoadDesc pageLoadDesc{
+                .Format = pageTex.GetMetadata().format,
+                .Dimension = ETextureDimension::Tex2D,
+                .Width = page.Width,
+                .Height = page.Height,
+                .DepthOrArrayLength = page.ArrayLength,
+                .Mips = page.Mips,
+                .Filter = packDesc.Filter,
+                .AddressModeU = bIsAtlas ? D3D12_TEXTURE_ADDRESS_MODE_CLAMP : packDesc.AddressModeU,
+                .AddressModeV = bIsAtlas ? D3D12_TEXTURE_ADDRESS_MODE_CLAMP : packDesc.AddressModeV};
+            const AssetInfo pageAssetInfo{MakeVirtualPathPreferred(pageName), EAssetCategory::Texture};
+            result.PackedTextures.emplace_back(ExportTextureAsset(pageAssetInfo, pageLoadDesc, &pageTex));
+
+            for (Index sourceIdx = 0; sourceIdx < resPaths.size(); ++sourceIdx)
+            {
+                const details::TexturePackPlacement& placement = plan.Placements[sourceIdx];
+                if (placement.PageIdx != pageIdx)
+                {
+                    continue;
+                }
+
+                SubTextureImportEntry& subTexture = result.SubTextures[sourceIdx];
+                subTexture.PackedTextureIdx = pageIdx;
+                subTexture.LoadDesc = pageLoadDesc;
+                subTexture.LoadDesc.Width = packingSources[sourceIdx].Width;
+                subTexture.LoadDesc.Height = packingSources[sourceIdx].Height;
+                subTexture.LoadDesc.DepthOrArrayLength = 1;
+                subTexture.LoadDesc.PackedArraySlice = placement.ArraySlice;
+                subTexture.LoadDesc.PackedOffsetX = placement.OffsetX;
+                subTexture.LoadDesc.PackedOffsetY = placement.OffsetY;
+            }
+
+            IG_LOG(TextureImporterLog, Info, "{}: {}x{}x{} ({} Mips) packed.", pageName, page.Width, page.Height, page.ArrayLength, page.Mips);
+        }
+
+        return result;
+    }
+
+    Result<Texture::Desc, ETextureImportStatus> TextureImporter::ExportSubTexture(const std::string_view resPathStr, const TextureLoadDesc& loadDesc)
+    {
+        IG_CHECK(loadDesc.IsSubTexture());
+        const Path resPath{resPathStr};
+        const AssetInfo assetInfo{MakeVirtualPathPreferred(resPath.filename().replace_extension().string()), EAssetCategory::Texture};
+        return ExportTextureAsset(assetInfo, loadDesc, nullptr);
+    }
+
+    Result<Texture::Desc, ETextureImportStatus> TextureImporter::ImportFromCache(const Path& resPath, const ImportCache::Entry& cacheEntry)
+    {
+        const ImportCache::CachedOutput& cachedOutput{cacheEntry.Outputs.front()};
+        if (!cacheEntry.Extra.empty())
+        {
+            SaveJsonToFile(MakeResourceMetadataPath(resPath), cacheEntry.Extra);
+        }
+
+        const AssetInfo assetInfo{cachedOutput.VirtualPath, EAssetCategory::Texture};
+        TextureLoadDesc loadDesc{};
+        cachedOutput.SerializedLoadDesc >> loadDesc;
+
+        Json assetMetadata{};
+        assetMetadata << assetInfo << loadDesc;
+        if (!SaveJsonToFile(MakeAssetMetadataPath(EAssetCategory::Texture, assetInfo.GetGuid()), assetMetadata))
+        {
+            return MakeFail<Texture::Desc, ETextureImportStatus::FailedSaveMetadataToFile>();
+        }
+
+        if (!ImportCache::Materialize(cachedOutput.BlobPath, MakeAssetPath(EAssetCategory::Texture, assetInfo.GetGuid())))
+        {
+            return MakeFail<Texture::Desc, ETextureImportStatus::FailedSaveAssetToFile>();
+        }
+
+        IG_CHECK(assetInfo.IsValid());
+        return MakeSuccess<Texture::Desc, ETextureImportStatus>(assetInfo, loadDesc);
+    }
 } // namespace ig
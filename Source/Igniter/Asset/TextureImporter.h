@@ -2,6 +2,7 @@
 #include "Igniter/Igniter.h"
 #include "Igniter/Core/Result.h"
 #include "Igniter/Asset/Texture.h"
+#include "Igniter/Asset/ImportCache.h"
 
 struct ID3D11Device;
 
@@ -22,14 +23,35 @@ namespace ig
         FailedSaveAssetToFile
     };
 
+    struct SubTextureImportEntry
+    {
+    public:
+        std::string ResPath{};
+        /* TexturePackImportResult::PackedTextures 의 인덱스; 패킹 되지 않은 소스는 InvalidIndex */
+        Index PackedTextureIdx = InvalidIndex;
+        /* PackedTextureGuid 는 패킹 된 텍스처가 임포트 된 이후에 결정 된다. */
+        TextureLoadDesc LoadDesc{};
+    };
+
+    struct TexturePackImportResult
+    {
+    public:
+        Vector<Result<Texture::Desc, ETextureImportStatus>> PackedTextures;
+        /* 소스 순서 */
+        Vector<SubTextureImportEntry> SubTextures;
+    };
+
     class AssetManager;
+    class AssetCooker;
 
     class TextureImporter final
     {
         friend class AssetManager;
+        friend class AssetCooker;
 
     public:
-        TextureImporter();
+        /* bAllowGpuCodec 이 false 라면 D3D11 Device를 생성하지 않고, BC6H 압축을 CPU 에서 수행 한다. */
+        explicit TextureImporter(tf::Executor& taskExecutor, const bool bAllowGpuCodec = true);
         TextureImporter(const TextureImporter&) = delete;
         TextureImporter(TextureImporter&&) noexcept = delete;
         ~TextureImporter();
@@ -37,10 +59,26 @@ namespace ig
         TextureImporter& operator=(const TextureImporter&) = delete;
         TextureImporter& operator=(TextureImporter&&) noexcept = delete;
 
+    public:
+        /* 임포트 결과물에 영향을 주는 변경이 있을 경우 반드시 증가 시켜야 함 (Import Cache 무효화) */
+        constexpr static U32 kImporterVersion = 3;
+
     private:
         Result<Texture::Desc, ETextureImportStatus> Import(const std::string_view resPathStr, TextureImportDesc config);
+        static Result<Texture::Desc, ETextureImportStatus> ImportFromCache(const Path& resPath, const ImportCache::Entry& cacheEntry);
+        /* 소스 들을 텍스처 배열/아틀라스(TexturePacker)로 묶는다. 서브 텍스처 들은 패킹 된 텍스처 들이 등록 된 후 ExportSubTexture 로 생성 한다. */
+        TexturePackImportResult ImportPack(const std::span<const std::string> resPaths, const TexturePackImportDesc& packDesc);
+        /* 서브 텍스처는 메타데이터 만을 가진다. (에셋 파일은 자리 표시자) */
+        static Result<Texture::Desc, ETextureImportStatus> ExportSubTexture(const std::string_view resPathStr, const TextureLoadDesc& loadDesc);
+        /* RGBA8 로 변환 후 모든 Mip/Array Slice 를 taskExecutor 에서 블록 행 단위로 병렬 압축 */
+        HRESULT CompressBlocks(const std::string_view resPathStr, const details::EBlockCompressionFormat blockCompFormat,
+            const ETextureCompressionQuality quality, const DXGI_FORMAT compFormat, const DirectX::ScratchImage& srcTex, DirectX::ScratchImage& compTex);
+        /* DirectXTex 로 압축. BC6H/BC7 은 D3D11 Device 가 있다면 GPU 코덱을 사용 한다. */
+        HRESULT CompressWithDirectXTex(const ETextureCompressionMode compMode, const DXGI_FORMAT compFormat, const DirectX::ScratchImage& srcTex,
+            DirectX::ScratchImage& compTex);
 
     private:
+        tf::Executor& taskExecutor;
         Mutex compressionMutex{};
         ID3D11Device* d3d11Device{nullptr};
     };
@@ -10,17 +10,65 @@
 #include "Igniter/D3D12/CommandList.h"
 #include "Igniter/Render/GpuUploader.h"
 #include "Igniter/Render/RenderContext.h"
+#include "Igniter/Asset/AssetManager.h"
+#include "Igniter/Asset/DdsLayout.h"
 #include "Igniter/Asset/TextureLoader.h"
+#include "Igniter/Asset/TextureStreamer.h"
 
-IG_DECLARE_LOG_CATEGORY(TextureLoader);
+IG_DECLARE_LOG_CATEGORY(TextureLoaderLog);
+
+IG_DEFINE_LOG_CATEGORY(TextureLoaderLog);
 
 namespace ig
 {
-    TextureLoader::TextureLoader(RenderContext& renderContext)
+    TextureLoader::TextureLoader(RenderContext& renderContext, AssetManager& assetManager)
         : renderContext(renderContext)
+        , assetManager(assetManager)
     {}
 
     Result<Texture, ETextureLoaderStatus> TextureLoader::Load(const Texture::Desc& desc)
+    {
+        const Texture::LoadDesc& loadDesc{desc.LoadDescriptor};
+        if (loadDesc.IsSubTexture())
+        {
+            return LoadSubTexture(desc);
+        }
+
+        const bool bStreamable = loadDesc.Mips > 0 && details::TextureMipStreamingPolicy::IsStreamable(loadDesc);
+        return LoadMips(desc, bStreamable ? details::TextureMipStreamingPolicy::ComputeTailMip(loadDesc) : 0);
+    }
+
+    Result<Texture, ETextureLoaderStatus> TextureLoader::LoadSubTexture(const Texture::Desc& desc)
+    {
+        const AssetInfo& assetInfo{desc.Info};
+        if (!assetInfo.IsValid())
+        {
+            return MakeFail<Texture, ETextureLoaderStatus::InvalidAssetInfo>();
+        }
+
+        if (assetInfo.GetCategory() != EAssetCategory::Texture)
+        {
+            return MakeFail<Texture, ETextureLoaderStatus::AssetTypeMismatch>();
+        }
+
+        const Texture::LoadDesc& loadDesc{desc.LoadDescriptor};
+        IG_CHECK(loadDesc.IsSubTexture());
+        if (loadDesc.PackedTextureGuid == assetInfo.GetGuid())
+        {
+            return MakeFail<Texture, ETextureLoaderStatus::FailedLoadPackedTexture>();
+        }
+
+        /* 패킹 된 텍스처가 존재하지 않는다면 LoadTexture 는 기본 텍스처를 반환 한다. */
+        const Handle<Texture> packedTexture = assetManager.LoadTexture(loadDesc.PackedTextureGuid);
+        if (!packedTexture)
+        {
+            return MakeFail<Texture, ETextureLoaderStatus::FailedLoadPackedTexture>();
+        }
+
+        return MakeSuccess<Texture, ETextureLoaderStatus>(Texture{assetManager, desc, packedTexture});
+    }
+
+    Result<Texture, ETextureLoaderStatus> TextureLoader::LoadMips(const Texture::Desc& desc, const U16 mostDetailedMip)
     {
         const AssetInfo& assetInfo{desc.Info};
         if (!assetInfo.IsValid())
@@ -45,48 +93,79 @@ namespace ig
             return MakeFail<Texture, ETextureLoaderStatus::UnknownFormat>();
         }
 
-        /* Load asset from file */
-        const Path assetPath = MakeAssetPath(EAssetCategory::Texture, assetInfo.GetGuid());
-        if (!fs::exists(assetPath))
+        /* Load asset header from package or file */
+        const std::span<const U8> packedAsset{assetManager.FindPackedAsset(assetInfo.GetGuid())};
+        const bool bIsPacked = !packedAsset.empty();
+        std::ifstream fileStream{};
+        Size fileSize = 0;
+        Array<U8, details::DdsLayoutParser::kMaxHeaderSize> headerBuffer{};
+        std::span<const U8> header{};
+        if (bIsPacked)
+        {
+            fileSize = packedAsset.size();
+            header = packedAsset.subspan(0, std::min(fileSize, details::DdsLayoutParser::kMaxHeaderSize));
+        }
+        else
         {
-            return MakeFail<Texture, ETextureLoaderStatus::FileDoesNotExists>();
+            const Path assetPath = MakeAssetPath(EAssetCategory::Texture, assetInfo.GetGuid());
+            if (!fs::exists(assetPath))
+            {
+                return MakeFail<Texture, ETextureLoaderStatus::FileDoesNotExists>();
+            }
+
+            fileSize = static_cast<Size>(fs::file_size(assetPath));
+            fileStream.open(assetPath.c_str(), std::ios::binary);
+            const Size headerSize = std::min(fileSize, details::DdsLayoutParser::kMaxHeaderSize);
+            if (!fileStream.read(reinterpret_cast<char*>(headerBuffer.data()), static_cast<std::streamsize>(headerSize)))
+            {
+                return MakeFail<Texture, ETextureLoaderStatus::FailedLoadFromFile>();
+            }
+            header = std::span<const U8>{headerBuffer.data(), headerSize};
         }
 
-        DirectX::TexMetadata ddsMeta;
-        DirectX::ScratchImage scratchImage;
-        HRESULT res = DirectX::LoadFromDDSFile(assetPath.c_str(), DirectX::DDS_FLAGS_NONE, &ddsMeta, scratchImage);
-        if (FAILED(res))
+        Result<details::DdsLayout, details::EDdsParseStatus> parseResult = details::DdsLayoutParser::Parse(header, fileSize);
+        if (!parseResult.HasOwnership())
         {
+            IG_LOG(TextureLoaderLog, Error, "Failed to parse dds header of {}. {}", assetInfo.GetVirtualPath(), ToCStr(parseResult.GetStatus()));
             return MakeFail<Texture, ETextureLoaderStatus::FailedLoadFromFile>();
         }
+        const details::DdsLayout ddsLayout = parseResult.Take();
 
-        /* Check metadata mismatch */
-        if (loadDesc.Width != ddsMeta.width || loadDesc.Height != ddsMeta.height ||
-            (loadDesc.DepthOrArrayLength != ddsMeta.depth && loadDesc.DepthOrArrayLength != ddsMeta.arraySize))
+        /* Check metadata mismatch; 페이로드를 서브리소스 단위로 직접 읽어 들이므로 Array 크기와 Mip 수 까지 정확히 일치 해야 한다. */
+        const U32 ddsDepthOrArrayLength = ddsLayout.Dimension == ETextureDimension::Tex3D ? ddsLayout.Depth : ddsLayout.ArraySize;
+        if (loadDesc.Width != ddsLayout.Width || loadDesc.Height != ddsLayout.Height || loadDesc.DepthOrArrayLength != ddsDepthOrArrayLength ||
+            loadDesc.Mips != ddsLayout.MipLevels)
         {
             return MakeFail<Texture, ETextureLoaderStatus::DimensionsMismatch>();
         }
 
-        if (loadDesc.bIsCubemap != loadDesc.bIsCubemap)
+        if (loadDesc.bIsCubemap != ddsLayout.bIsCubemap)
         {
             return MakeFail<Texture, ETextureLoaderStatus::CubemapFlagMismatch>();
         }
 
-        if (loadDesc.bIsCubemap && (loadDesc.DepthOrArrayLength % 6 == 0))
+        if (loadDesc.bIsCubemap && (loadDesc.DepthOrArrayLength % 6 != 0))
         {
             return MakeFail<Texture, ETextureLoaderStatus::InvalidCubemapArrayLength>();
         }
 
-        if (loadDesc.Dimension != details::AsTexDimension(ddsMeta.dimension))
+        if (loadDesc.Dimension != ddsLayout.Dimension)
         {
             return MakeFail<Texture, ETextureLoaderStatus::DimensionFlagMismatch>();
         }
 
-        if (loadDesc.Format != ddsMeta.format)
+        if (loadDesc.Format != ddsLayout.Format)
         {
             return MakeFail<Texture, ETextureLoaderStatus::FormatMismatch>();
         }
 
+        /* 스트리밍 가능한 텍스처(2D, Non-Array)는 Mip 과 이미지 인덱스가 같다. */
+        IG_CHECK(mostDetailedMip == 0 || details::TextureMipStreamingPolicy::IsStreamable(loadDesc));
+        IG_CHECK(mostDetailedMip < loadDesc.Mips);
+        const U32 residentWidth = std::max(loadDesc.Width >> mostDetailedMip, 1u);
+        const U32 residentHeight = std::max(loadDesc.Height >> mostDetailedMip, 1u);
+        const uint16_t numResidentMips = loadDesc.Mips - mostDetailedMip;
+
         /* Configure Texture Description */
         /* #sy_todo Support MSAA */
         GpuTextureDesc texDesc{};
@@ -114,7 +193,7 @@ namespace ig
             }
             else
             {
-                texDesc.AsTexture2D(loadDesc.Width, loadDesc.Height, loadDesc.Mips, loadDesc.Format);
+                texDesc.AsTexture2D(residentWidth, residentHeight, numResidentMips, loadDesc.Format);
             }
         }
         else
@@ -133,34 +212,76 @@ namespace ig
             return MakeFail<Texture, ETextureLoaderStatus::FailedCreateTexture>();
         }
 
-        /* Upload texture subresources from sysram to vram */
-        const Size numSubresources = scratchImage.GetImageCount();
-        Vector<D3D12_SUBRESOURCE_DATA> subresources(numSubresources);
-        const DirectX::Image* images = scratchImage.GetImages();
-
-        for (Size idx = 0; idx < numSubresources; ++idx)
-        {
-            D3D12_SUBRESOURCE_DATA& subresource = subresources[idx];
-            subresource.RowPitch = images[idx].rowPitch;
-            subresource.SlicePitch = images[idx].slicePitch;
-            subresource.pData = images[idx].pixels;
-        }
-
-        // COMMON Layout 인 상태에서 텍스처가 GPU 메모리 상에서 어떻게 배치되어있는지
+        /*
+         * #sy_note 페이로드를 업로드 버퍼에 직접 읽어 들인다.
+         * 행의 크기는 같지만 GPU 측 RowPitch 는 D3D12_TEXTURE_DATA_PITCH_ALIGNMENT 로 정렬 되므로, 두 Pitch 가 같은 경우에만
+         * 서브리소스 전체를 한번에 읽고 그렇지 않다면 행 단위로 읽는다. 이 동안 업로더의 예약이 유지되므로 다른 업로드는 대기하게 된다.
+         */
+        const Size numItems = ddsLayout.Dimension == ETextureDimension::Tex3D ? 1 : ddsLayout.ArraySize;
+        const Size numSubresources = numItems * numResidentMips;
         GpuUploader& gpuUploader{renderContext.GetNonFrameCriticalGpuUploader()};
-
         const GpuCopyableFootprints destCopyableFootprints =
             renderContext.GetGpuDevice().GetCopyableFootprints(texDesc, 0, static_cast<U32>(numSubresources), 0);
         UploadContext texUploadCtx = gpuUploader.Reserve(destCopyableFootprints.RequiredSize);
 
         GpuTexture* newTexturePtr = renderContext.Lookup(newTexture);
         IG_CHECK(newTexturePtr != nullptr);
-        texUploadCtx.CopyTextureSimple(*newTexturePtr, destCopyableFootprints, subresources);
+
+        const auto readPayload = [bIsPacked, packedAsset, &fileStream](const Size offset, U8* dst, const Size numBytes)
+        {
+            if (bIsPacked)
+            {
+                IG_CHECK(offset + numBytes <= packedAsset.size());
+                std::memcpy(dst, packedAsset.data() + offset, numBytes);
+                return true;
+            }
+
+            fileStream.seekg(static_cast<std::streamoff>(offset));
+            return static_cast<bool>(fileStream.read(reinterpret_cast<char*>(dst), static_cast<std::streamsize>(numBytes)));
+        };
+
+        bool bPayloadRead = true;
+        U8* const uploadBufferAddr = texUploadCtx.GetOffsettedCpuAddress();
+        for (Size subresourceIdx = 0; bPayloadRead && subresourceIdx < numSubresources; ++subresourceIdx)
+        {
+            const Size item = subresourceIdx / numResidentMips;
+            const Size mip = subresourceIdx % numResidentMips + mostDetailedMip;
+            const details::DdsSubresourceLayout& srcLayout = ddsLayout.Subresources[item * ddsLayout.MipLevels + mip];
+            const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& dstLayout = destCopyableFootprints.Layouts[subresourceIdx];
+            const Size dstRowPitch = dstLayout.Footprint.RowPitch;
+            IG_CHECK(destCopyableFootprints.NumRows[subresourceIdx] == srcLayout.NumRows);
+            IG_CHECK(destCopyableFootprints.RowSizesInBytes[subresourceIdx] == srcLayout.RowPitch);
+            IG_CHECK(dstLayout.Footprint.Depth == srcLayout.Depth);
+
+            U8* const dstAddr = uploadBufferAddr + dstLayout.Offset;
+            if (dstRowPitch == srcLayout.RowPitch)
+            {
+                bPayloadRead = readPayload(srcLayout.Offset, dstAddr, srcLayout.SlicePitch * srcLayout.Depth);
+            }
+            else
+            {
+                for (Size rowIdx = 0; bPayloadRead && rowIdx < static_cast<Size>(srcLayout.NumRows) * srcLayout.Depth; ++rowIdx)
+                {
+                    bPayloadRead = readPayload(srcLayout.Offset + rowIdx * srcLayout.RowPitch, dstAddr + rowIdx * dstRowPitch, srcLayout.RowPitch);
+                }
+            }
+
+            if (bPayloadRead)
+            {
+                texUploadCtx.CopyTextureRegion(0, *newTexturePtr, static_cast<U32>(subresourceIdx), dstLayout);
+            }
+        }
 
         std::optional<GpuSyncPoint> texUploadSync = gpuUploader.Submit(texUploadCtx);
         IG_CHECK(texUploadSync);
         texUploadSync->WaitOnCpu();
 
+        if (!bPayloadRead)
+        {
+            renderContext.DestroyTexture(newTexture);
+            return MakeFail<Texture, ETextureLoaderStatus::FailedLoadFromFile>();
+        }
+
         CommandQueue& mainGfxQueue = renderContext.GetMainGfxQueue();
         auto cmdList = renderContext.GetMainGfxCommandListPool().Request(FrameManager::GetLocalFrameIndex(), "BarrierAfterUpload_TexUpload");
         {
@@ -177,10 +298,22 @@ namespace ig
         GpuSyncPoint barrierSync{mainGfxQueue.MakeSyncPointWithSignal()};
         barrierSync.WaitOnCpu();
 
-        const Handle<GpuView> srv = renderContext.CreateShaderResourceView(newTexture,
-            D3D12_TEX2D_SRV{
-                .MostDetailedMip = 0, .MipLevels = IG_NUMERIC_MAX_OF(D3D12_TEX2D_SRV::MipLevels), .PlaneSlice = 0, .ResourceMinLODClamp = 0.f
-            });
+        /* 텍스처 배열(TexturePacker)은 Slice 를 선택 할 수 있도록 Texture2DArray 로 접근 된다. */
+        const bool bIsTexture2DArray = loadDesc.Dimension == ETextureDimension::Tex2D && loadDesc.IsArray() && !loadDesc.bIsCubemap;
+        const Handle<GpuView> srv = bIsTexture2DArray ?
+            renderContext.CreateShaderResourceView(newTexture,
+                D3D12_TEX2D_ARRAY_SRV{
+                    .MostDetailedMip = 0,
+                    .MipLevels = IG_NUMERIC_MAX_OF(D3D12_TEX2D_ARRAY_SRV::MipLevels),
+                    .FirstArraySlice = 0,
+                    .ArraySize = loadDesc.DepthOrArrayLength,
+                    .PlaneSlice = 0,
+                    .ResourceMinLODClamp = 0.f
+                }) :
+            renderContext.CreateShaderResourceView(newTexture,
+                D3D12_TEX2D_SRV{
+                    .MostDetailedMip = 0, .MipLevels = IG_NUMERIC_MAX_OF(D3D12_TEX2D_SRV::MipLevels), .PlaneSlice = 0, .ResourceMinLODClamp = 0.f
+                });
         if (!srv)
         {
             return MakeFail<Texture, ETextureLoaderStatus::FailedCreateShaderResourceView>();
@@ -205,7 +338,7 @@ namespace ig
         }
 
         /* #sy_todo Layout transition COMMON -> SHADER_RESOURCE? */
-        return MakeSuccess<Texture, ETextureLoaderStatus>(Texture{renderContext, desc, newTexture, srv, samplerView});
+        return MakeSuccess<Texture, ETextureLoaderStatus>(Texture{renderContext, desc, newTexture, srv, samplerView, mostDetailedMip});
     }
 
     Result<Texture, details::EMakeDefaultTexStatus> TextureLoader::MakeDefault(const AssetInfo& assetInfo)
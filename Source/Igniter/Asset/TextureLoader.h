@@ -34,6 +34,7 @@ namespace ig
         FailedCreateTexture,
         FailedCreateShaderResourceView,
         FailedCreateSamplerView,
+        FailedLoadPackedTexture,
     };
 
     class AssetManager;
@@ -42,9 +43,10 @@ namespace ig
     class TextureLoader final
     {
         friend class AssetManager;
+        friend class TextureStreamer;
 
     public:
-        TextureLoader(RenderContext& renderContext);
+        TextureLoader(RenderContext& renderContext, AssetManager& assetManager);
         TextureLoader(const TextureLoader&) = delete;
         TextureLoader(TextureLoader&&) noexcept = delete;
         ~TextureLoader() = default;
@@ -53,11 +55,17 @@ namespace ig
         TextureLoader& operator=(TextureLoader&&) noexcept = delete;
 
     private:
+        /* 스트리밍 가능한 텍스처는 Mip Tail 만 로드 한다. */
         Result<Texture, ETextureLoaderStatus> Load(const Texture::Desc& desc);
+        /* 서브 텍스처는 자신이 패킹 된 텍스처를 로드 하여 참조 한다. */
+        Result<Texture, ETextureLoaderStatus> LoadSubTexture(const Texture::Desc& desc);
+        /* [mostDetailedMip, Mips) 만을 가진 텍스처를 생성 한다. mostDetailedMip > 0 인 경우 텍스처는 스트리밍 가능 해야 한다. */
+        Result<Texture, ETextureLoaderStatus> LoadMips(const Texture::Desc& desc, const U16 mostDetailedMip);
         Result<Texture, details::EMakeDefaultTexStatus> MakeDefault(const AssetInfo& assetInfo);
         Result<Texture, details::EMakeDefaultTexStatus> MakeMonochrome(const AssetInfo& assetInfo, const Color& color);
 
     private:
         RenderContext& renderContext;
+        AssetManager& assetManager;
     };
 } // namespace ig
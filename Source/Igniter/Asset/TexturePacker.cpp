@@ -0,0 +1,265 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Asset/TexturePacker.h"
+
+namespace ig::details
+{
+    namespace
+    {
+        struct SkylineNode
+        {
+        public:
+            U32 X = 0;
+            U32 Y = 0;
+            U32 Width = 0;
+        };
+
+        [[nodiscard]] U32 DivideRoundUp(const U32 value, const U32 divisor)
+        {
+            return (value + divisor - 1) / divisor;
+        }
+    } // namespace
+
+    TexturePackingPlan TexturePacker::Plan(const std::span<const TexturePackingSource> sources, const TexturePackingConfig& config)
+    {
+        IG_CHECK(config.MaxAtlasExtent > 0);
+        TexturePackingPlan plan{};
+        plan.Placements.resize(sources.size());
+
+        /* 포맷, 크기 순으로 정렬 하여 같은 포맷-크기의 소스 들이 연속 되도록 한다. */
+        Vector<Index> sortedIndices(sources.size());
+        std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+        std::stable_sort(sortedIndices.begin(), sortedIndices.end(), [sources](const Index lhs, const Index rhs)
+        {
+            const TexturePackingSource& lhsSource = sources[lhs];
+            const TexturePackingSource& rhsSource = sources[rhs];
+            return std::tie(lhsSource.Format, lhsSource.Width, lhsSource.Height) < std::tie(rhsSource.Format, rhsSource.Width, rhsSource.Height);
+        });
+
+        /* 1. 텍스처 배열 */
+        Vector<Index> atlasCandidates{};
+        for (Size groupBegin = 0; groupBegin < sortedIndices.size();)
+        {
+            const TexturePackingSource& groupSource = sources[sortedIndices[groupBegin]];
+            Size groupEnd = groupBegin + 1;
+            while (groupEnd < sortedIndices.size())
+            {
+                const TexturePackingSource& source = sources[sortedIndices[groupEnd]];
+                if (source.Format != groupSource.Format || source.Width != groupSource.Width || source.Height != groupSource.Height)
+                {
+                    break;
+                }
+                ++groupEnd;
+            }
+
+            const Size groupSize = groupEnd - groupBegin;
+            const bool bHasValidExtent = groupSource.Width > 0 && groupSource.Height > 0;
+            /* BC 텍스처의 최상위 Mip 크기는 4의 배수 여야 한다. */
+            const bool bIsBlockAligned = !config.bBlockCompressed || (groupSource.Width % 4 == 0 && groupSource.Height % 4 == 0);
+            if (bHasValidExtent && bIsBlockAligned && groupSize >= std::max<Size>(config.MinArrayLength, 1))
+            {
+                const U16 numMips = config.bGenerateMips ? ComputeNumMips(groupSource.Width, groupSource.Height) : 1;
+                for (Size chunkBegin = groupBegin; chunkBegin < groupEnd; chunkBegin += kMaxArrayLength)
+                {
+                    const Size chunkEnd = std::min(chunkBegin + kMaxArrayLength, groupEnd);
+                    const Index pageIdx = plan.Pages.size();
+                    plan.Pages.emplace_back(TexturePackPage{
+                        .Kind = ETexturePackKind::Array,
+                        .Format = groupSource.Format,
+                        .Width = groupSource.Width,
+                        .Height = groupSource.Height,
+                        .ArrayLength = static_cast<U16>(chunkEnd - chunkBegin),
+                        .Mips = numMips});
+
+                    for (Size sortedIdx = chunkBegin; sortedIdx < chunkEnd; ++sortedIdx)
+                    {
+                        plan.Placements[sortedIndices[sortedIdx]] =
+                            TexturePackPlacement{.PageIdx = pageIdx, .ArraySlice = static_cast<U16>(sortedIdx - chunkBegin)};
+                    }
+                }
+            }
+            else if (bHasValidExtent)
+            {
+                atlasCandidates.insert(atlasCandidates.end(), sortedIndices.begin() + groupBegin, sortedIndices.begin() + groupEnd);
+            }
+
+            groupBegin = groupEnd;
+        }
+
+        /* 2. 포맷 별 아틀라스 */
+        const U16 atlasMips = config.bGenerateMips ? std::max<U16>(config.MaxAtlasMips, 1) : 1;
+        const U32 padding = ComputeAtlasPadding(atlasMips);
+        const U32 alignment = ComputeAtlasAlignment(atlasMips, config.bBlockCompressed);
+        const U32 binExtentInCells = config.MaxAtlasExtent / alignment;
+        for (Size formatBegin = 0; formatBegin < atlasCandidates.size();)
+        {
+            const DXGI_FORMAT format = sources[atlasCandidates[formatBegin]].Format;
+            Size formatEnd = formatBegin + 1;
+            while (formatEnd < atlasCandidates.size() && sources[atlasCandidates[formatEnd]].Format == format)
+            {
+                ++formatEnd;
+            }
+
+            /* 정렬 단위(Cell)로 표현 된 각 소스의 Footprint(소스 + Padding). 아틀라스 보다 큰 소스는 패킹 하지 않는다. */
+            Vector<Index> pendingIndices{};
+            Vector<SkylineRect> pendingRects{};
+            for (Size candidateIdx = formatBegin; candidateIdx < formatEnd; ++candidateIdx)
+            {
+                const TexturePackingSource& source = sources[atlasCandidates[candidateIdx]];
+                const SkylineRect footprint{
+                    .Width = DivideRoundUp(source.Width + 2 * padding, alignment), .Height = DivideRoundUp(source.Height + 2 * padding, alignment)};
+                if (footprint.Width <= binExtentInCells && footprint.Height <= binExtentInCells)
+                {
+                    pendingIndices.emplace_back(atlasCandidates[candidateIdx]);
+                    pendingRects.emplace_back(footprint);
+                }
+            }
+
+            while (!pendingIndices.empty())
+            {
+                Vector<SkylinePosition> positions(pendingRects.size());
+                PackSkyline(binExtentInCells, binExtentInCells, pendingRects, positions);
+
+                const Index pageIdx = plan.Pages.size();
+                U32 usedWidthInCells = 0;
+                U32 usedHeightInCells = 0;
+                Vector<Index> nextPendingIndices{};
+                Vector<SkylineRect> nextPendingRects{};
+                for (Size pendingIdx = 0; pendingIdx < pendingIndices.size(); ++pendingIdx)
+                {
+                    const SkylinePosition& position = positions[pendingIdx];
+                    if (!position.bPacked)
+                    {
+                        nextPendingIndices.emplace_back(pendingIndices[pendingIdx]);
+                        nextPendingRects.emplace_back(pendingRects[pendingIdx]);
+                        continue;
+                    }
+
+                    usedWidthInCells = std::max(usedWidthInCells, position.X + pendingRects[pendingIdx].Width);
+                    usedHeightInCells = std::max(usedHeightInCells, position.Y + pendingRects[pendingIdx].Height);
+                    plan.Placements[pendingIndices[pendingIdx]] = TexturePackPlacement{
+                        .PageIdx = pageIdx, .OffsetX = position.X * alignment + padding, .OffsetY = position.Y * alignment + padding};
+                }
+
+                /* 빈 아틀라스에는 각각의 Footprint 가 항상 배치 될 수 있으므로, 매 페이지 마다 적어도 하나의 소스가 배치 된다. */
+                IG_CHECK(nextPendingIndices.size() < pendingIndices.size());
+                plan.Pages.emplace_back(TexturePackPage{
+                    .Kind = ETexturePackKind::Atlas,
+                    .Format = format,
+                    .Width = usedWidthInCells * alignment,
+                    .Height = usedHeightInCells * alignment,
+                    .Mips = atlasMips,
+                    .Padding = padding});
+
+                pendingIndices = std::move(nextPendingIndices);
+                pendingRects = std::move(nextPendingRects);
+            }
+
+            formatBegin = formatEnd;
+        }
+
+        return plan;
+    }
+
+    U16 TexturePacker::ComputeNumMips(const U32 width, const U32 height)
+    {
+        return static_cast<U16>(std::bit_width(std::max({width, height, 1u})));
+    }
+
+    bool TexturePacker::PackSkyline(const U32 binWidth, const U32 binHeight, const std::span<const SkylineRect> rects, const std::span<SkylinePosition> positions)
+    {
+        IG_CHECK(rects.size() == positions.size());
+        Vector<Index> order(rects.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [rects](const Index lhs, const Index rhs)
+        {
+            return std::tie(rects[lhs].Height, rects[lhs].Width) > std::tie(rects[rhs].Height, rects[rhs].Width);
+        });
+
+        /* X 순으로 정렬 된, [0, binWidth) 를 빈틈 없이 덮는 구간들 */
+        Vector<SkylineNode> skyline{SkylineNode{.X = 0, .Y = 0, .Width = binWidth}};
+        bool bAllPacked = true;
+        for (const Index rectIdx : order)
+        {
+            const SkylineRect& rect = rects[rectIdx];
+            positions[rectIdx] = SkylinePosition{};
+            if (rect.Width == 0 || rect.Height == 0 || rect.Width > binWidth || rect.Height > binHeight)
+            {
+                bAllPacked = false;
+                continue;
+            }
+
+            Index bestNodeIdx = InvalidIndex;
+            U32 bestX = 0;
+            U32 bestY = std::numeric_limits<U32>::max();
+            for (Index nodeIdx = 0; nodeIdx < skyline.size(); ++nodeIdx)
+            {
+                const U32 x = skyline[nodeIdx].X;
+                if (x + rect.Width > binWidth)
+                {
+                    break;
+                }
+
+                /* 사각형 아래에 놓인 구간 들 중 가장 높은 곳에 놓인다. */
+                U32 y = 0;
+                U32 remainingWidth = rect.Width;
+                for (Index coveredIdx = nodeIdx; remainingWidth > 0; ++coveredIdx)
+                {
+                    IG_CHECK(coveredIdx < skyline.size());
+                    y = std::max(y, skyline[coveredIdx].Y);
+                    remainingWidth -= std::min(remainingWidth, skyline[coveredIdx].Width);
+                }
+
+                if (y + rect.Height <= binHeight && (y < bestY || (y == bestY && x < bestX)))
+                {
+                    bestNodeIdx = nodeIdx;
+                    bestX = x;
+                    bestY = y;
+                }
+            }
+
+            if (bestNodeIdx == InvalidIndex)
+            {
+                bAllPacked = false;
+                continue;
+            }
+
+            positions[rectIdx] = SkylinePosition{.bPacked = true, .X = bestX, .Y = bestY};
+
+            /* 새로운 구간을 삽입하고, 그에 가려진 구간 들을 잘라낸다. */
+            skyline.insert(skyline.begin() + bestNodeIdx, SkylineNode{.X = bestX, .Y = bestY + rect.Height, .Width = rect.Width});
+            const U32 newNodeEnd = bestX + rect.Width;
+            for (Index nodeIdx = bestNodeIdx + 1; nodeIdx < skyline.size();)
+            {
+                SkylineNode& node = skyline[nodeIdx];
+                if (node.X >= newNodeEnd)
+                {
+                    break;
+                }
+
+                const U32 overlap = newNodeEnd - node.X;
+                if (node.Width <= overlap)
+                {
+                    skyline.erase(skyline.begin() + nodeIdx);
+                    continue;
+                }
+
+                node.X += overlap;
+                node.Width -= overlap;
+                break;
+            }
+
+            for (Index nodeIdx = 0; nodeIdx + 1 < skyline.size();)
+            {
+                if (skyline[nodeIdx].Y == skyline[nodeIdx + 1].Y)
+                {
+                    skyline[nodeIdx].Width += skyline[nodeIdx + 1].Width;
+                    skyline.erase(skyline.begin() + nodeIdx + 1);
+                    continue;
+                }
+                ++nodeIdx;
+            }
+        }
+
+        return bAllPacked;
+    }
+} // namespace ig::details
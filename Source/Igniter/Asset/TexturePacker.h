@@ -0,0 +1,107 @@
+#pragma once
+#include "Igniter/Igniter.h"
+
+namespace ig::details
+{
+    struct TexturePackingSource
+    {
+    public:
+        DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+        U32 Width = 0;
+        U32 Height = 0;
+    };
+
+    struct TexturePackingConfig
+    {
+    public:
+        U32 MaxAtlasExtent = 2048;
+        /* 같은 포맷, 같은 크기의 소스가 이 수 이상 이라면 아틀라스 대신 텍스처 배열로 묶는다. */
+        U16 MinArrayLength = 2;
+        /* 아틀라스의 Mip 수; 클수록 Mip 간 Bleeding 을 막기 위한 Padding 이 커진다. */
+        U16 MaxAtlasMips = 4;
+        bool bGenerateMips = true;
+        /* BC 포맷으로 압축 될 경우 모든 Mip 에서 블록(4x4)이 두 소스에 걸치지 않도록 정렬 한다. */
+        bool bBlockCompressed = false;
+    };
+
+    enum class ETexturePackKind : U8
+    {
+        Array,
+        Atlas
+    };
+
+    struct TexturePackPage
+    {
+    public:
+        ETexturePackKind Kind = ETexturePackKind::Atlas;
+        DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+        U32 Width = 0;
+        U32 Height = 0;
+        U16 ArrayLength = 1;
+        U16 Mips = 1;
+        /* 아틀라스 내 각 소스 주변의 Padding(Texel, Mip 0) */
+        U32 Padding = 0;
+    };
+
+    struct TexturePackPlacement
+    {
+    public:
+        [[nodiscard]] bool IsPacked() const noexcept { return PageIdx != InvalidIndex; }
+
+    public:
+        Index PageIdx = InvalidIndex;
+        U16 ArraySlice = 0;
+        /* 페이지 내에서 소스 이미지(Padding 제외)의 시작 위치(Texel, Mip 0) */
+        U32 OffsetX = 0;
+        U32 OffsetY = 0;
+    };
+
+    struct TexturePackingPlan
+    {
+    public:
+        Vector<TexturePackPage> Pages;
+        /* 소스 순서; 패킹 될 수 없는 소스(아틀라스 보다 큰 경우)는 IsPacked() == false */
+        Vector<TexturePackPlacement> Placements;
+    };
+
+    struct SkylineRect
+    {
+    public:
+        U32 Width = 0;
+        U32 Height = 0;
+    };
+
+    struct SkylinePosition
+    {
+    public:
+        bool bPacked = false;
+        U32 X = 0;
+        U32 Y = 0;
+    };
+
+    /*
+     * #sy_note 텍스처 배열/아틀라스 패킹
+     * 같은 포맷, 같은 크기의 소스들은 텍스처 배열의 Slice 로, 나머지 소스들은 포맷 별로 Skyline Bottom-Left 알고리즘을 사용해 아틀라스에 배치 된다.
+     * 아틀라스 에서 각 소스는 2^(Mips-1) Texel 의 Padding 으로 둘러 쌓이고, 그 영역(Footprint)은 Mip 마다 절반이 되는 Box Filter 의 격자
+     * (BC 포맷의 경우 블록 격자) 에 정렬 된다. 따라서 마지막 Mip 까지 서로 다른 소스의 Texel 이 섞이지 않는다.
+     * GPU/파일 시스템에 의존하지 않는 순수한 배치 계산 만을 수행 한다.
+     */
+    class TexturePacker final
+    {
+    public:
+        constexpr static U16 kMaxArrayLength = 2048;
+
+    public:
+        [[nodiscard]] static TexturePackingPlan Plan(const std::span<const TexturePackingSource> sources, const TexturePackingConfig& config);
+
+        [[nodiscard]] static U16 ComputeNumMips(const U32 width, const U32 height);
+        [[nodiscard]] static U32 ComputeAtlasPadding(const U16 numMips) { return 1u << (numMips - 1); }
+        [[nodiscard]] static U32 ComputeAtlasAlignment(const U16 numMips, const bool bBlockCompressed)
+        {
+            return (bBlockCompressed ? 4u : 1u) << (numMips - 1);
+        }
+
+        /* 주어진 크기의 영역에 rects 를 높이가 큰 순서 부터 배치 한다. 모든 사각형이 배치 되었다면 true. */
+        static bool PackSkyline(const U32 binWidth, const U32 binHeight, const std::span<const SkylineRect> rects, const std::span<SkylinePosition> positions);
+    };
+} // namespace ig::details
@@ -0,0 +1,485 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Component/TransformComponent.h"
+#include "Igniter/Component/CameraComponent.h"
+#include "Igniter/Component/StaticMeshComponent.h"
+#include "Igniter/Component/MaterialComponent.h"
+#include "Igniter/Asset/StaticMesh.h"
+#include "Igniter/Asset/Material.h"
+#include "Igniter/Render/RenderContext.h"
+#include "Igniter/Asset/AssetManager.h"
+#include "Igniter/Asset/TextureStreamer.h"
+
+IG_DECLARE_LOG_CATEGORY(TextureStreamerLog);
+
+IG_DEFINE_LOG_CATEGORY(TextureStreamerLog);
+
+namespace ig::details
+{
+    U16 TextureMipStreamingPolicy::ComputeTailMip(const TextureLoadDesc& loadDesc)
+    {
+        IG_CHECK(loadDesc.Mips > 0);
+        const bool bBlockCompressed = DirectX::IsCompressed(loadDesc.Format);
+        const U16 numMips = std::min<U16>(loadDesc.Mips, TextureMipResidency::kMaxNumMips);
+        U16 tailMip = 0;
+        while ((tailMip + 1) < numMips && std::max(loadDesc.Width >> tailMip, loadDesc.Height >> tailMip) > kMaxTailMipExtent)
+        {
+            const U32 nextWidth = std::max(loadDesc.Width >> (tailMip + 1), 1u);
+            const U32 nextHeight = std::max(loadDesc.Height >> (tailMip + 1), 1u);
+            if (bBlockCompressed && ((nextWidth % 4) != 0 || (nextHeight % 4) != 0))
+            {
+                break;
+            }
+
+            ++tailMip;
+        }
+
+        return tailMip;
+    }
+
+    bool TextureMipStreamingPolicy::IsStreamable(const TextureLoadDesc& loadDesc)
+    {
+        return loadDesc.Dimension == ETextureDimension::Tex2D && !loadDesc.IsArray() && !loadDesc.bIsCubemap && !loadDesc.IsSubTexture() &&
+            loadDesc.Mips <= TextureMipResidency::kMaxNumMips && ComputeTailMip(loadDesc) > 0;
+    }
+
+    Size TextureMipStreamingPolicy::ComputeMipSize(const TextureLoadDesc& loadDesc, const U16 mip)
+    {
+        Size rowPitch = 0;
+        Size slicePitch = 0;
+        const HRESULT res = DirectX::ComputePitch(loadDesc.Format, std::max<Size>(loadDesc.Width >> mip, 1), std::max<Size>(loadDesc.Height >> mip, 1),
+            rowPitch, slicePitch);
+        return SUCCEEDED(res) ? slicePitch : 0;
+    }
+
+    F32 TextureMipStreamingPolicy::ComputeProjectedSize(const Vector3& viewSpaceCenter, const F32 radius, const F32 projScaleY, const F32 nearZ)
+    {
+        /* 카메라가 Bounding Sphere 내부에 있거나 Near Plane과 교차하는 경우, 가장 세밀한 Mip 이 필요 하다고 가정 */
+        if ((viewSpaceCenter.z - radius) <= nearZ)
+        {
+            return std::numeric_limits<F32>::max();
+        }
+
+        return (radius * projScaleY / viewSpaceCenter.z) * kReferenceViewportHeight;
+    }
+
+    U16 TextureMipStreamingPolicy::MapProjectedSizeToMip(const F32 projectedSize, const U32 width, const U32 height, const U16 numMips)
+    {
+        IG_CHECK(numMips > 0);
+        if (projectedSize <= 1.f)
+        {
+            return numMips - 1;
+        }
+
+        const F32 texelsPerPixel = (F32)std::max(width, height) / projectedSize;
+        if (texelsPerPixel <= 1.f)
+        {
+            return 0;
+        }
+
+        return (U16)std::min<F32>(std::floor(std::log2(texelsPerPixel)), (F32)(numMips - 1));
+    }
+
+    Size TextureMipStreamingPolicy::ComputeStreamedSize(const TextureMipResidency& residency)
+    {
+        IG_CHECK(residency.TailMip < residency.NumMips);
+        const U16 mostDetailedMip = residency.bTransitionPending ? std::min(residency.MostDetailedResidentMip, residency.PendingMip) :
+            residency.MostDetailedResidentMip;
+        Size streamedSize = 0;
+        for (U16 mip = mostDetailedMip; mip < residency.TailMip; ++mip)
+        {
+            streamedSize += residency.MipSizes[mip];
+        }
+
+        return streamedSize;
+    }
+
+    TextureMipStreamingDecision TextureMipStreamingPolicy::Decide(const std::span<const TextureMipResidency> residencies, const Size budgetInBytes,
+        const Size maxNumLoads)
+    {
+        struct EvictionCandidate
+        {
+            Index ResidencyIdx;
+            U16 Mip;
+            U64 LastRequiredUpdate;
+        };
+
+        Size streamedSize = 0;
+        Vector<EvictionCandidate> evictionCandidates{};
+        Vector<Index> loadCandidates{};
+        for (Index residencyIdx = 0; residencyIdx < residencies.size(); ++residencyIdx)
+        {
+            const TextureMipResidency& residency = residencies[residencyIdx];
+            IG_CHECK(residency.NumMips > 0 && residency.NumMips <= TextureMipResidency::kMaxNumMips);
+            IG_CHECK(residency.MostDetailedResidentMip <= residency.TailMip);
+            streamedSize += ComputeStreamedSize(residency);
+            if (residency.bTransitionPending)
+            {
+                continue;
+            }
+
+            if (residency.RequiredMip < residency.MostDetailedResidentMip)
+            {
+                loadCandidates.emplace_back(residencyIdx);
+            }
+            else
+            {
+                /* 요구 된 Mip 보다 세밀한 Mip 만 해제 대상. Mip Tail 은 항상 상주 한다. */
+                const U16 evictableEnd = std::min(residency.RequiredMip, residency.TailMip);
+                for (U16 mip = residency.MostDetailedResidentMip; mip < evictableEnd; ++mip)
+                {
+                    evictionCandidates.emplace_back(EvictionCandidate{
+                        .ResidencyIdx = residencyIdx,
+                        .Mip = mip,
+                        .LastRequiredUpdate = residency.LastRequiredUpdates[mip]
+                    });
+                }
+            }
+        }
+
+        /* MeshLodStreamingPolicy 와 같이 (갱신 번호, Mip) 순으로 정렬하여, 같은 텍스처 내 에서는 세밀한 Mip 부터 해제 한다. */
+        std::sort(evictionCandidates.begin(), evictionCandidates.end(),
+            [](const EvictionCandidate& lhs, const EvictionCandidate& rhs)
+            {
+                return lhs.LastRequiredUpdate != rhs.LastRequiredUpdate ?
+                    lhs.LastRequiredUpdate < rhs.LastRequiredUpdate :
+                    lhs.Mip < rhs.Mip;
+            });
+
+        /* 요구 된 Mip 과의 차이가 클 수록 우선 로드 */
+        std::stable_sort(loadCandidates.begin(), loadCandidates.end(),
+            [residencies](const Index lhs, const Index rhs)
+            {
+                return (residencies[lhs].MostDetailedResidentMip - residencies[lhs].RequiredMip) >
+                    (residencies[rhs].MostDetailedResidentMip - residencies[rhs].RequiredMip);
+            });
+
+        /* evictedMips[residencyIdx] = 해제 후의 MostDetailedResidentMip */
+        UnorderedMap<Index, U16> evictedMips{};
+        Index evictionCursor = 0;
+        const auto EvictNext = [&]()
+        {
+            const EvictionCandidate& candidate = evictionCandidates[evictionCursor++];
+            streamedSize -= residencies[candidate.ResidencyIdx].MipSizes[candidate.Mip];
+            evictedMips[candidate.ResidencyIdx] = candidate.Mip + 1;
+        };
+
+        TextureMipStreamingDecision decision{};
+        for (const Index residencyIdx : loadCandidates)
+        {
+            if (decision.Loads.size() >= maxNumLoads)
+            {
+                break;
+            }
+
+            /* 요구 된 Mip 이 예산 내에 들어오지 않는다면, 한 단계씩 거친 Mip 으로 타협 한다. */
+            const TextureMipResidency& residency = residencies[residencyIdx];
+            for (U16 targetMip = residency.RequiredMip; targetMip < residency.MostDetailedResidentMip; ++targetMip)
+            {
+                Size loadSize = 0;
+                for (U16 mip = targetMip; mip < residency.MostDetailedResidentMip; ++mip)
+                {
+                    loadSize += residency.MipSizes[mip];
+                }
+
+                while ((streamedSize + loadSize) > budgetInBytes && evictionCursor < evictionCandidates.size())
+                {
+                    EvictNext();
+                }
+
+                if ((streamedSize + loadSize) <= budgetInBytes)
+                {
+                    streamedSize += loadSize;
+                    decision.Loads.emplace_back(TextureMipStreamingRequest{.ResidencyIdx = residencyIdx, .TargetMip = targetMip});
+                    break;
+                }
+            }
+        }
+
+        /* 예산이 줄어든 경우에도 예산 내로 유지 */
+        while (streamedSize > budgetInBytes && evictionCursor < evictionCandidates.size())
+        {
+            EvictNext();
+        }
+
+        decision.Evictions.reserve(evictedMips.size());
+        for (const auto& [residencyIdx, targetMip] : evictedMips)
+        {
+            decision.Evictions.emplace_back(TextureMipStreamingRequest{.ResidencyIdx = residencyIdx, .TargetMip = targetMip});
+        }
+
+        return decision;
+    }
+} // namespace ig::details
+
+namespace ig
+{
+    TextureStreamer::TextureStreamer(tf::Executor& taskExecutor, RenderContext& renderContext, AssetManager& assetManager)
+        : taskExecutor(taskExecutor)
+        , assetManager(assetManager)
+        , textureLoader(renderContext, assetManager)
+    {}
+
+    TextureStreamer::~TextureStreamer()
+    {
+        CommitCompletedTransitions(true);
+    }
+
+    void TextureStreamer::Update(const Registry& registry)
+    {
+        ZoneScoped;
+        ++numUpdates;
+        CommitCompletedTransitions(false);
+
+        /*
+         * 현재 캐시 된 스트리밍 가능한 텍스처 들의 상주 상태 갱신
+         * Keep-Alive 상태의 텍스처도 스트리밍 된 Mip 을 가지고 있을 수 있으므로 상주 집합에 포함 한다.
+         */
+        UnorderedSet<Handle<Texture>> cachedHandles{};
+        keptAliveHandles.clear();
+        for (const AssetManager::Snapshot& snapshot : assetManager.TakeSnapshots(EAssetCategory::Texture))
+        {
+            if (!snapshot.IsCached() && !snapshot.bIsKeptAlive)
+            {
+                continue;
+            }
+
+            const Handle<Texture> textureHandle{snapshot.HandleHash};
+            const Texture* texturePtr = assetManager.Lookup(textureHandle);
+            if (texturePtr == nullptr)
+            {
+                continue;
+            }
+
+            const TextureLoadDesc& loadDesc = texturePtr->GetSnapshot().LoadDescriptor;
+            if (!details::TextureMipStreamingPolicy::IsStreamable(loadDesc))
+            {
+                continue;
+            }
+
+            cachedHandles.insert(textureHandle);
+            if (!snapshot.IsCached())
+            {
+                keptAliveHandles.insert(textureHandle);
+            }
+
+            details::TextureMipResidency& residency = residencyMap[textureHandle];
+            residency.NumMips = loadDesc.Mips;
+            residency.TailMip = details::TextureMipStreamingPolicy::ComputeTailMip(loadDesc);
+            residency.MostDetailedResidentMip = texturePtr->GetMostDetailedResidentMip();
+            residency.RequiredMip = residency.TailMip;
+            for (U16 mip = 0; mip < residency.NumMips; ++mip)
+            {
+                residency.MipSizes[mip] = details::TextureMipStreamingPolicy::ComputeMipSize(loadDesc, mip);
+            }
+        }
+
+        /* 더 이상 캐시 되어 있지 않은 텍스처 */
+        Vector<Handle<Texture>> staleHandles{};
+        for (const auto& [textureHandle, residency] : residencyMap)
+        {
+            if (!cachedHandles.contains(textureHandle))
+            {
+                staleHandles.emplace_back(textureHandle);
+            }
+        }
+        for (const Handle<Texture> staleHandle : staleHandles)
+        {
+            residencyMap.erase(staleHandle);
+        }
+
+        const auto RequireMip = [this](const Handle<Texture> textureHandle, const U16 requiredMip)
+        {
+            if (const auto residencyItr = residencyMap.find(textureHandle);
+                residencyItr != residencyMap.end())
+            {
+                residencyItr->second.RequiredMip = std::min(residencyItr->second.RequiredMip, requiredMip);
+            }
+        };
+
+        /* 머터리얼 별 피드백; 인스턴스의 투영 된 크기로 부터 Texel Density 를 추정하여 머터리얼 텍스처 마다 요구 되는 가장 세밀한 Mip 결정 */
+        const auto camView = registry.view<const TransformComponent, const CameraComponent>();
+        std::optional<std::pair<TransformComponent, CameraComponent>> mainCamera{};
+        for (const auto& [entity, transform, camera] : camView.each())
+        {
+            if (!mainCamera || camera.bIsMainCamera)
+            {
+                mainCamera = std::make_pair(transform, camera);
+            }
+        }
+
+        if (mainCamera)
+        {
+            const auto& [camTransform, camera] = *mainCamera;
+            const Matrix view = TransformUtility::CreateView(camTransform);
+            const Matrix proj = CameraUtility::CreatePerspectiveForReverseZ(camera);
+
+            const auto materialView = registry.view<const TransformComponent, const StaticMeshComponent, const MaterialComponent>();
+            for (const auto& [entity, transform, staticMeshComponent, materialComponent] : materialView.each())
+            {
+                const Material* materialPtr = assetManager.Lookup(materialComponent.Instance);
+                const StaticMesh* staticMeshPtr = assetManager.Lookup(staticMeshComponent.Mesh);
+                if (materialPtr == nullptr || staticMeshPtr == nullptr)
+                {
+                    continue;
+                }
+
+                const Handle<Texture> diffuse = materialPtr->GetDiffuse();
+                const Texture* diffusePtr = assetManager.Lookup(diffuse);
+                if (diffusePtr == nullptr)
+                {
+                    continue;
+                }
+
+                /* 서브 텍스처의 Texel Density 는 자신이 패킹 된 아틀라스의 Mip 요구가 된다. */
+                const Handle<Texture> streamedTexture = diffusePtr->IsSubTexture() ? diffusePtr->GetPackedTexture() : diffuse;
+                const auto residencyItr = residencyMap.find(streamedTexture);
+                if (residencyItr == residencyMap.end())
+                {
+                    continue;
+                }
+
+                const BoundingSphere boundingSphere = ToBoundingSphere(staticMeshPtr->GetMesh().BoundingBox);
+                const Vector3 worldCenter = Vector3::Transform(boundingSphere.Centroid, TransformUtility::CreateTransformation(transform));
+                const F32 maxScale = std::max({std::abs(transform.Scale.x), std::abs(transform.Scale.y), std::abs(transform.Scale.z)});
+                const F32 projectedSize = details::TextureMipStreamingPolicy::ComputeProjectedSize(
+                    Vector3::Transform(worldCenter, view), boundingSphere.Radius * maxScale, proj._22, camera.NearZ);
+
+                const TextureLoadDesc& loadDesc = diffusePtr->GetSnapshot().LoadDescriptor;
+                RequireMip(streamedTexture,
+                    details::TextureMipStreamingPolicy::MapProjectedSizeToMip(projectedSize, loadDesc.Width, loadDesc.Height, residencyItr->second.NumMips));
+            }
+        }
+
+        {
+            UniqueLock lock{feedbackMutex};
+            for (const auto& [textureHandle, requiredMip] : pendingFeedback)
+            {
+                RequireMip(textureHandle, requiredMip);
+            }
+            pendingFeedback.clear();
+        }
+
+        Vector<Handle<Texture>> residencyHandles{};
+        Vector<details::TextureMipResidency> residencies{};
+        residencyHandles.reserve(residencyMap.size());
+        residencies.reserve(residencyMap.size());
+        for (auto& [textureHandle, residency] : residencyMap)
+        {
+            /* Keep-Alive 상태의 텍스처는 캐시에 로드 시점(Mip Tail)의 크기로 청구 되므로, 예산과 관계 없이 Mip Tail 로 되돌린다. */
+            if (keptAliveHandles.contains(textureHandle))
+            {
+                if (!residency.bTransitionPending && residency.MostDetailedResidentMip < residency.TailMip)
+                {
+                    RequestTransition(textureHandle, residency.TailMip);
+                }
+                continue;
+            }
+
+            for (U16 mip = residency.RequiredMip; mip < residency.NumMips; ++mip)
+            {
+                residency.LastRequiredUpdates[mip] = numUpdates;
+            }
+
+            residencyHandles.emplace_back(textureHandle);
+            residencies.emplace_back(residency);
+        }
+
+        const Size maxNumLoads = kMaxNumInFlightLoads - std::min(pendingTransitions.size(), kMaxNumInFlightLoads);
+        const details::TextureMipStreamingDecision decision = details::TextureMipStreamingPolicy::Decide(residencies, budgetInBytes, maxNumLoads);
+        /* Mip 해제 역시 더 작은 텍스처를 로드 하여 교체 하므로, 로드와 같은 경로를 거친다. */
+        for (const details::TextureMipStreamingRequest& eviction : decision.Evictions)
+        {
+            RequestTransition(residencyHandles[eviction.ResidencyIdx], eviction.TargetMip);
+        }
+
+        for (const details::TextureMipStreamingRequest& load : decision.Loads)
+        {
+            RequestTransition(residencyHandles[load.ResidencyIdx], load.TargetMip);
+        }
+
+        streamedSize = 0;
+        for (const auto& [textureHandle, residency] : residencyMap)
+        {
+            streamedSize += details::TextureMipStreamingPolicy::ComputeStreamedSize(residency);
+        }
+    }
+
+    void TextureStreamer::AddFeedback(const Handle<Texture> texture, const U16 requiredMip)
+    {
+        UniqueLock lock{feedbackMutex};
+        const auto [itr, bInserted] = pendingFeedback.try_emplace(texture, requiredMip);
+        if (!bInserted)
+        {
+            itr->second = std::min(itr->second, requiredMip);
+        }
+    }
+
+    void TextureStreamer::RequestTransition(const Handle<Texture> textureHandle, const U16 targetMip)
+    {
+        const Texture* texturePtr = assetManager.Lookup(textureHandle);
+        IG_CHECK(texturePtr != nullptr);
+        IG_CHECK(targetMip != texturePtr->GetMostDetailedResidentMip());
+
+        SharedPtr<std::promise<Result<Texture, ETextureLoaderStatus>>> loadPromise =
+            std::make_shared<std::promise<Result<Texture, ETextureLoaderStatus>>>();
+        pendingTransitions.emplace_back(PendingTransition{
+            .TextureHandle = textureHandle,
+            .GpuTextureHandle = texturePtr->GetGpuTexture(),
+            .TargetMip = targetMip,
+            .LoadResult = loadPromise->get_future()
+        });
+
+        details::TextureMipResidency& residency = residencyMap[textureHandle];
+        residency.bTransitionPending = true;
+        residency.PendingMip = targetMip;
+
+        taskExecutor.silent_async(
+            [this, desc = texturePtr->GetSnapshot(), targetMip, loadPromise]()
+            {
+                loadPromise->set_value(textureLoader.LoadMips(desc, targetMip));
+            });
+    }
+
+    void TextureStreamer::CommitCompletedTransitions(const bool bWaitForAll)
+    {
+        for (auto itr = pendingTransitions.begin(); itr != pendingTransitions.end();)
+        {
+            PendingTransition& pendingTransition = *itr;
+            if (!bWaitForAll && pendingTransition.LoadResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++itr;
+                continue;
+            }
+
+            Result<Texture, ETextureLoaderStatus> result = pendingTransition.LoadResult.get();
+            if (const auto residencyItr = residencyMap.find(pendingTransition.TextureHandle);
+                residencyItr != residencyMap.end())
+            {
+                residencyItr->second.bTransitionPending = false;
+            }
+
+            if (!result.IsSuccess())
+            {
+                IG_LOG(TextureStreamerLog, Error, "Failed to stream texture mips [{}, ). {}", pendingTransition.TargetMip, ToCStr(result.GetStatus()));
+                itr = pendingTransitions.erase(itr);
+                continue;
+            }
+
+            /* 로드 도중 텍스처가 해제 되었거나 다시 로드 된 경우, 스트리밍 된 텍스처는 버린다.(소멸자 에서 지연 해제) 스트리머 해제 시에도 마찬가지. */
+            Texture streamedTexture = result.Take();
+            /* Keep-Alive 상태가 된 텍스처에 대한 더 세밀한 Mip 의 로드 역시 버린다. */
+            Texture* texturePtr = bWaitForAll ? nullptr : assetManager.Lookup(pendingTransition.TextureHandle);
+            if (texturePtr == nullptr || texturePtr->GetGpuTexture() != pendingTransition.GpuTextureHandle ||
+                (keptAliveHandles.contains(pendingTransition.TextureHandle) && pendingTransition.TargetMip < texturePtr->GetMostDetailedResidentMip()))
+            {
+                itr = pendingTransitions.erase(itr);
+                continue;
+            }
+
+            /* 이전 GPU 자원은 RenderContext 에 의해 지연 해제 되므로, 이전 프레임 에서의 참조는 안전 하다. */
+            *texturePtr = std::move(streamedTexture);
+            itr = pendingTransitions.erase(itr);
+        }
+    }
+} // namespace ig
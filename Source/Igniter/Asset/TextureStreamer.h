@@ -0,0 +1,146 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Handle.h"
+#include "Igniter/Core/Memory.h"
+#include "Igniter/Asset/Texture.h"
+#include "Igniter/Asset/TextureLoader.h"
+
+namespace ig::details
+{
+    /*
+     * #sy_note Texture Mip 스트리밍 정책
+     * Mip Tail([TailMip, NumMips)) 은 항상 상주하며, 상주 Mip 은 [MostDetailedResidentMip, NumMips) 의 연속 구간으로 유지 된다.
+     * 요구 된 Mip 이 상주 하지 않는다면 요구 된 Mip 까지 한번에 로드(텍스처 재생성) 되고,
+     * 예산(Mip Tail 을 제외한 스트리밍 Mip 의 총 크기)을 초과하는 경우 가장 오랫동안 요구 되지 않은 Mip 부터 해제 된다.
+     * GPU 자원에 의존하지 않으므로 모의 피드백 만으로 결정을 검증 할 수 있다.
+     */
+    struct TextureMipResidency
+    {
+    public:
+        constexpr static U16 kMaxNumMips = 16;
+
+    public:
+        U16 NumMips = 1;
+        U16 TailMip = 0;
+        U16 MostDetailedResidentMip = 0;
+        /* 이번 갱신에서 요구 된 가장 세밀한 Mip. 어떤 머터리얼 에서도 요구 되지 않았다면 TailMip. */
+        U16 RequiredMip = 0;
+        /* 상주 Mip 변경(로드/해제)이 진행 중. PendingMip 은 변경 후의 MostDetailedResidentMip. */
+        bool bTransitionPending = false;
+        U16 PendingMip = 0;
+        Array<Size, kMaxNumMips> MipSizes{};
+        /* Mip 별로 마지막으로 요구 된 갱신 번호 */
+        Array<U64, kMaxNumMips> LastRequiredUpdates{};
+    };
+
+    struct TextureMipStreamingRequest
+    {
+    public:
+        Index ResidencyIdx = 0;
+        /* 요청이 적용 된 후의 MostDetailedResidentMip */
+        U16 TargetMip = 0;
+    };
+
+    struct TextureMipStreamingDecision
+    {
+    public:
+        /* 텍스처 당 최대 하나의 요청. Evictions 와 Loads 에 같은 텍스처가 동시에 포함 되지 않는다. */
+        Vector<TextureMipStreamingRequest> Evictions;
+        Vector<TextureMipStreamingRequest> Loads;
+    };
+
+    class TextureMipStreamingPolicy final
+    {
+    public:
+        /* 이 크기(Texel) 이하의 Mip 들은 Mip Tail 로써 항상 상주 한다. */
+        constexpr static U32 kMaxTailMipExtent = 128;
+        /* Texel Density 추정 시 기준이 되는 화면 해상도 (MeshLodStreamingPolicy 와 동일) */
+        constexpr static F32 kReferenceViewportHeight = 1080.f;
+
+    public:
+        /* BC 포맷의 경우 텍스처의 최상위 Mip 크기는 4의 배수 여야 하므로, Tail 까지의 모든 Mip 이 이를 만족 하도록 제한 된다. */
+        [[nodiscard]] static U16 ComputeTailMip(const TextureLoadDesc& loadDesc);
+        [[nodiscard]] static bool IsStreamable(const TextureLoadDesc& loadDesc);
+        [[nodiscard]] static Size ComputeMipSize(const TextureLoadDesc& loadDesc, const U16 mip);
+
+        /* 기준 해상도 에서 Bounding Sphere 의 투영 된 지름(Pixel) */
+        [[nodiscard]] static F32 ComputeProjectedSize(const Vector3& viewSpaceCenter, const F32 radius, const F32 projScaleY, const F32 nearZ);
+        /* 텍스처가 메시 표면을 한번 덮는다고(UV [0, 1]) 가정 했을 때, 투영 된 크기 에서 Texel:Pixel 이 1:1 이상이 되는 가장 거친 Mip */
+        [[nodiscard]] static U16 MapProjectedSizeToMip(const F32 projectedSize, const U32 width, const U32 height, const U16 numMips);
+
+        [[nodiscard]] static Size ComputeStreamedSize(const TextureMipResidency& residency);
+        [[nodiscard]] static TextureMipStreamingDecision Decide(const std::span<const TextureMipResidency> residencies, const Size budgetInBytes,
+            const Size maxNumLoads);
+    };
+} // namespace ig::details
+
+namespace ig
+{
+    class RenderContext;
+    class AssetManager;
+
+    /*
+     * #sy_note Texture Mip 스트리밍
+     * 텍스처는 Mip Tail 만 상주 한 상태로 로드 되고, 매 프레임 머터리얼 별 피드백(CPU 에서 추정한 Texel Density 및 AddFeedback)으로 부터
+     * 텍스처 마다 필요한 Mip 을 결정한다. 상주 Mip 의 변경은 Task Executor 에서 새로운 Mip 구간을 가진 텍스처를 비동기적으로 로드 한 뒤
+     * Update 에서 교체 하는 것으로 이루어지며, 이전 GPU 자원은 RenderContext 에 의해 지연 해제 된다.
+     * 상주 Mip 의 변경은 Update 에서만 이루어지므로, SceneProxy 의 Replication 과 동시에 호출 되어서는 안된다.
+     * 참조 되지 않고 캐시에 유지(Keep-Alive) 되고 있는 텍스처는 Mip Tail 로 되돌린다.
+     */
+    class TextureStreamer final
+    {
+    public:
+        constexpr static Size kDefaultBudget = MegaBytesToBytes(512);
+        constexpr static Size kMaxNumInFlightLoads = 4;
+
+    public:
+        TextureStreamer(tf::Executor& taskExecutor, RenderContext& renderContext, AssetManager& assetManager);
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer(TextureStreamer&&) noexcept = delete;
+        ~TextureStreamer();
+
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(TextureStreamer&&) noexcept = delete;
+
+        void Update(const Registry& registry);
+
+        /* 외부 피드백(ex. GPU Feedback Buffer)을 다음 Update 의 요구 Mip 에 반영 한다. */
+        void AddFeedback(const Handle<Texture> texture, const U16 requiredMip);
+
+        void SetBudget(const Size newBudgetInBytes) { budgetInBytes = newBudgetInBytes; }
+        [[nodiscard]] Size GetBudget() const noexcept { return budgetInBytes; }
+        [[nodiscard]] Size GetStreamedSize() const noexcept { return streamedSize; }
+
+    private:
+        struct PendingTransition
+        {
+        public:
+            Handle<Texture> TextureHandle{};
+            /* 로드 도중 텍스처가 다시 로드(Reload) 되었는지 확인 하기 위함 */
+            Handle<GpuTexture> GpuTextureHandle{};
+            U16 TargetMip = 0;
+            std::future<Result<Texture, ETextureLoaderStatus>> LoadResult;
+        };
+
+    private:
+        void CommitCompletedTransitions(const bool bWaitForAll);
+        void RequestTransition(const Handle<Texture> textureHandle, const U16 targetMip);
+
+    private:
+        tf::Executor& taskExecutor;
+        AssetManager& assetManager;
+        TextureLoader textureLoader;
+
+        Size budgetInBytes = kDefaultBudget;
+        Size streamedSize = 0;
+        U64 numUpdates = 0;
+
+        Mutex feedbackMutex{};
+        UnorderedMap<Handle<Texture>, U16> pendingFeedback{};
+
+        UnorderedMap<Handle<Texture>, details::TextureMipResidency> residencyMap{};
+        /* 마지막 Update 시점에 Keep-Alive 상태 였던 텍스처. Mip Tail 만 남긴다. */
+        UnorderedSet<Handle<Texture>> keptAliveHandles{};
+        Vector<PendingTransition> pendingTransitions{};
+    };
+} // namespace ig
@@ -2,6 +2,7 @@
 #include "Igniter/Component/TransformComponent.h"
 #include "Igniter/Audio/AudioSourceComponent.h"
 #include "Igniter/Audio/AudioListenerComponent.h"
+#include "Igniter/Audio/AudioVoicePrioritizer.h"
 #include "Igniter/Audio/AudioSystem.h"
 
 #include "Igniter/Asset/AssetManager.h"
@@ -50,12 +51,13 @@ namespace ig
         }
     }
 
-    Handle<Audio> AudioSystem::CreateAudio(const std::string_view path)
+    Handle<Audio> AudioSystem::CreateAudio(const std::string_view path, const bool bStreamed)
     {
         IG_CHECK(system != nullptr);
 
+        const FMOD_MODE mode = FMOD_LOOP_OFF | (bStreamed ? FMOD_CREATESTREAM : FMOD_CREATESAMPLE);
         FMOD::Sound* newSound = nullptr;
-        if (const FMOD_RESULT result = system->createSound(path.data(), FMOD_LOOP_OFF, nullptr, &newSound);
+        if (const FMOD_RESULT result = system->createSound(path.data(), mode, nullptr, &newSound);
             result != FMOD_OK)
         {
             IG_LOG(AudioSystemLog, Warning, "Failed to create audio clip from path({})=>\n {}", path, FMOD_ErrorString(result));
@@ -67,6 +69,29 @@ namespace ig
         return Handle<Audio>{audioClipStorage.Create(newSound).Value};
     }
 
+    Handle<Audio> AudioSystem::CreateAudio(const std::span<const U8> data, const bool bStreamed)
+    {
+        IG_CHECK(system != nullptr);
+        IG_CHECK(!data.empty());
+
+        FMOD_CREATESOUNDEXINFO exInfo{};
+        exInfo.cbsize = sizeof(FMOD_CREATESOUNDEXINFO);
+        exInfo.length = static_cast<unsigned int>(data.size_bytes());
+
+        const FMOD_MODE mode = FMOD_LOOP_OFF | FMOD_OPENMEMORY | (bStreamed ? FMOD_CREATESTREAM : FMOD_CREATESAMPLE);
+        FMOD::Sound* newSound = nullptr;
+        if (const FMOD_RESULT result = system->createSound(reinterpret_cast<const char*>(data.data()), mode, &exInfo, &newSound);
+            result != FMOD_OK)
+        {
+            IG_LOG(AudioSystemLog, Warning, "Failed to create audio clip from memory({} bytes)=>\n {}", data.size_bytes(), FMOD_ErrorString(result));
+            return {};
+        }
+        IG_CHECK(newSound != nullptr);
+
+        ReadWriteLock lock{audioClipStorageMutex};
+        return Handle<Audio>{audioClipStorage.Create(newSound).Value};
+    }
+
     void AudioSystem::Destroy(const Handle<Audio> audioHandle)
     {
         IG_CHECK(system != nullptr);
@@ -98,28 +123,54 @@ namespace ig
         }
     }
 
-    void AudioSystem::Update(Registry& registry, const float deltaTime)
+    void AudioSystem::Update(tf::Subflow& subflow, Registry& registry, const float deltaTime)
     {
         ZoneScopedN("AudioSystem.Update");
         IG_CHECK(system != nullptr);
 
-        constexpr auto kCalcVelocity = [](const FMOD_VECTOR prevPos, const FMOD_VECTOR currentPos, const float dt)
+        UpdateListeners(registry, deltaTime);
+        {
+            ReadOnlyLock lock{audioClipStorageMutex};
+            GatherVoicesUnsafe(registry, deltaTime);
+        }
+
+        tf::Task estimateAudibility = subflow.for_each_index(0i32, (S32)voices.Entities.size(), 1i32,
+            [this, deltaTime](const Size voiceIdx)
+            {
+                EstimateAudibility(voiceIdx, deltaTime);
+            }).name("AudioSystem.EstimateAudibility");
+
+        tf::Task selectRealVoices = subflow.emplace([this]()
         {
-            if (dt <= FLT_EPSILON)
+            ZoneScopedN("AudioSystem.SelectRealVoices");
+            details::AudioVoicePrioritizer::SelectRealVoices(voices.Audibility, voices.bWasReal, maxRealVoices, voices.bShouldBeReal, voiceCandidates);
+        }).name("AudioSystem.SelectRealVoices");
+
+        /* FMOD 호출은 실제 보이스에 대해서만 한 곳에서 일괄적으로 처리 한다. */
+        tf::Task applyVoices = subflow.emplace([this]()
+        {
+            ZoneScopedN("AudioSystem.ApplyVoices");
             {
-                return FMOD_VECTOR{0.f, 0.f, 0.f};
+                ReadOnlyLock lock{audioClipStorageMutex};
+                ApplyVoicesUnsafe();
             }
-            const float invDeltaTime = 1.f / dt;
-            const FMOD_VECTOR currentVelocity{
-                .x = (currentPos.x - prevPos.x) * invDeltaTime,
-                .y = (currentPos.y - prevPos.y) * invDeltaTime,
-                .z = (currentPos.z - prevPos.z) * invDeltaTime
-            };
-            return currentVelocity;
-        };
 
+            if (const FMOD_RESULT updateResult = system->update();
+                updateResult != FMOD_OK)
+            {
+                IG_LOG(AudioSystemLog, Warning, "Failed to update audio system: {}.", FMOD_ErrorString(updateResult));
+            }
+        }).name("AudioSystem.ApplyVoices");
+
+        estimateAudibility.precede(selectRealVoices);
+        selectRealVoices.precede(applyVoices);
+    }
+
+    void AudioSystem::UpdateListeners(Registry& registry, const float deltaTime)
+    {
         const auto listenerView = registry.view<AudioListenerComponent, const TransformComponent>();
-        system->set3DNumListeners((int)listenerView.size_hint());
+        system->set3DNumListeners(std::max((int)listenerView.size_hint(), 1));
+        listenerPositions.clear();
         int listenerIdx = 0;
         for (auto [entity, listener, transform] : listenerView.each())
         {
@@ -133,7 +184,12 @@ namespace ig
                 .y = transform.Position.y,
                 .z = transform.Position.z
             };
-            const FMOD_VECTOR currentVelocity = kCalcVelocity(prevPos, currentPos, deltaTime);
+            const Vector3 velocity = deltaTime > FLT_EPSILON ? (transform.Position - listener.PrevPosition) / deltaTime : Vector3::Zero;
+            const FMOD_VECTOR currentVelocity{
+                .x = velocity.x,
+                .y = velocity.y,
+                .z = velocity.z
+            };
             const Vector3 forward = TransformUtility::MakeForward(transform);
             const Vector3 up = TransformUtility::MakeUp(transform);
             const FMOD_VECTOR fmodForward{
@@ -148,195 +204,374 @@ namespace ig
             };
             system->set3DListenerAttributes(listenerIdx, &currentPos, &currentVelocity, &fmodForward, &fmodUp);
             listener.PrevPosition = transform.Position;
+            listenerPositions.emplace_back(transform.Position);
             ++listenerIdx;
         }
+    }
 
-        ReadOnlyLock lock{audioClipStorageMutex};
-        for (auto [entity, audioSource] : registry.view<AudioSourceComponent>(entt::exclude_t<TransformComponent>{}).each())
+    void AudioSystem::GatherVoicesUnsafe(Registry& registry, const float deltaTime)
+    {
+        ZoneScopedN("AudioSystem.GatherVoices");
+
+        /* 재생이 끝난 보이스를 먼저 정리 하여, 같은 프레임에 다시 재생 될 수 있도록 한다. */
+        for (Index voiceIdx = 0; voiceIdx < voices.Entities.size(); ++voiceIdx)
+        {
+            voices.bFinished[voiceIdx] = HasVoiceFinishedUnsafe(voiceIdx, deltaTime) ? 1 : 0;
+        }
+
+        /* 이번 프레임에 어떠한 오디오 소스 에서도 참조 되지 않은 보이스(엔티티 또는 컴포넌트가 제거 된 경우)는 제거 된다. */
+        std::fill(voices.bReferenced.begin(), voices.bReferenced.end(), U8{0});
+        const auto gatherVoice = [this](const Entity entity, AudioSourceComponent& audioSource, const TransformComponent* transform)
         {
-            /*
-             * 처리 결과에 따라 현재 프레임에 프로퍼티 값을 반영할지 하지 않을지 결정
-             * 만약 당장 프로퍼티를 반영할 수 없다면, 다음 프레임으로 지연
-             */
-            if (FMOD::Channel* channel = UpdateAudioStatusUnsafe(entity, audioSource);
-                channel != nullptr)
+            const Index voiceIdx = ProcessEventUnsafe(entity, audioSource);
+            if (voiceIdx != InvalidIndex)
             {
-                channel->setVolume(audioSource.Volume);
-                channel->setPitch(audioSource.Pitch);
-                channel->setPan(audioSource.Pan);
-                channel->setMute(audioSource.bMute);
-                FMOD_MODE newMode = FMOD_2D;
-                newMode |= audioSource.bLoop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
-                channel->setMode(newMode);
+                voices.bReferenced[voiceIdx] = 1;
+                voices.Positions[voiceIdx] = transform != nullptr ? transform->Position : Vector3::Zero;
+                voices.PrevPositions[voiceIdx] = transform != nullptr ? audioSource.PrevPosition : Vector3::Zero;
+                voices.Volumes[voiceIdx] = audioSource.Volume;
+                voices.Pitches[voiceIdx] = audioSource.Pitch;
+                voices.Pans[voiceIdx] = audioSource.Pan;
+                voices.MinDistances[voiceIdx] = audioSource.MinDistance;
+                voices.MaxDistances[voiceIdx] = audioSource.MaxDistance;
+                voices.bMuted[voiceIdx] = audioSource.bMute ? 1 : 0;
+                voices.bLooped[voiceIdx] = audioSource.bLoop ? 1 : 0;
+                voices.bIs3D[voiceIdx] = transform != nullptr ? 1 : 0;
             }
+
+            if (transform != nullptr)
+            {
+                audioSource.PrevPosition = transform->Position;
+            }
+        };
+
+        for (auto [entity, audioSource] : registry.view<AudioSourceComponent>(entt::exclude_t<TransformComponent>{}).each())
+        {
+            gatherVoice(entity, audioSource, nullptr);
         }
 
         for (auto [entity, transform, audioSource] : registry.view<TransformComponent, AudioSourceComponent>().each())
         {
-            if (FMOD::Channel* channel = UpdateAudioStatusUnsafe(entity, audioSource);
-                channel != nullptr)
-            {
-                channel->setVolume(audioSource.Volume);
-                channel->setPitch(audioSource.Pitch);
-                channel->setPan(audioSource.Pan);
-                channel->setMute(audioSource.bMute);
-                channel->set3DMinMaxDistance(audioSource.MinDistance, audioSource.MaxDistance);
-                FMOD_MODE newMode = FMOD_3D;
-                newMode |= audioSource.bLoop ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
-                channel->setMode(newMode);
-
-                if (audioSource.LatestStatus == EAudioStatus::Playing)
-                {
-                    IG_CHECK(channel != nullptr);
-                    const FMOD_VECTOR prevPos{
-                        audioSource.PrevPosition.x,
-                        audioSource.PrevPosition.y,
-                        audioSource.PrevPosition.z
-                    };
-                    const FMOD_VECTOR currentPos{
-                        .x = transform.Position.x,
-                        .y = transform.Position.y,
-                        .z = transform.Position.z
-                    };
-                    const FMOD_VECTOR currentVelocity = kCalcVelocity(prevPos, currentPos, deltaTime);
-                    channel->set3DAttributes(&currentPos, &currentVelocity);
-                }
-                audioSource.PrevPosition = transform.Position;
-            }
+            gatherVoice(entity, audioSource, &transform);
         }
 
-        if (const FMOD_RESULT updateResult = system->update();
-            updateResult != FMOD_OK)
+        /* 제거 시 마지막 보이스가 현재 위치로 옮겨 지므로, 뒤 에서 부터 제거 한다. */
+        for (Index voiceIdx = voices.Entities.size(); voiceIdx > 0; --voiceIdx)
         {
-            IG_LOG(AudioSystemLog, Warning, "Failed to update audio system: {}.", FMOD_ErrorString(updateResult));
+            if (voices.bReferenced[voiceIdx - 1] == 0)
+            {
+                RemoveVoice(voiceIdx - 1);
+            }
         }
+
+        voices.Velocities.resize(voices.Entities.size());
+        voices.Audibility.resize(voices.Entities.size());
+        voices.bWasReal.resize(voices.Entities.size());
+        voices.bShouldBeReal.resize(voices.Entities.size());
     }
 
-    FMOD::Channel* AudioSystem::UpdateAudioStatusUnsafe(const Entity entity, AudioSourceComponent& audioSource)
+    Index AudioSystem::ProcessEventUnsafe(const Entity entity, AudioSourceComponent& audioSource)
     {
-        FMOD::Channel* channel = nullptr;
-        bool bIsPlaying = false;                      /* FMOD에선 bIsPlaying이면 재생중이거나 중지(Paused)된 경우이다 */
-        bool bIsPaused = false;                       /* bIsPaused이면 bIsPlaying */
-        bool bShouldEraseChannelRelationship = false; /* 해당 프레임에서 이미 할당된 채널이 만료된 경우, 맵에서의 제거를 지연시켜 재활용 가능하도록 하기 위함 */
-        const auto channelItr = channelMap.find(entity);
-        if (channelItr != channelMap.end())
+        const auto voiceItr = voiceLookup.find(entity);
+        Index voiceIdx = voiceItr != voiceLookup.end() ? voiceItr->second : InvalidIndex;
+        if (voiceIdx != InvalidIndex && voices.bFinished[voiceIdx] != 0)
         {
-            channel = channelItr->second;
-            IG_CHECK(channel != nullptr);
-            if ((channel->isPlaying(&bIsPlaying) != FMOD_OK) || !bIsPlaying)
-            {
-                bShouldEraseChannelRelationship = true;
-                channel = nullptr;
-            }
-            else
-            {
-                if (channel->getPaused(&bIsPaused) != FMOD_OK)
-                {
-                    IG_CHECK_NO_ENTRY();
-                }
-            }
+            RemoveVoice(voiceIdx);
+            voiceIdx = InvalidIndex;
+            audioSource.LatestStatus = EAudioStatus::Stopped;
         }
 
+        switch (audioSource.NextEvent)
+        {
         /*
          * Stopped -> Playing
          * Stopped -> Paused
-         * */
-        if (audioSource.NextEvent == EAudioEvent::Play || audioSource.NextEvent == EAudioEvent::PlayAsPaused)
-        {
-            /* 채널이 유효하지 않거나 존재하지 않기 때문에 새로운 채널 할당이 필요로함 */
-            if (!bIsPlaying)
+         * 새로운 보이스는 가상 보이스로 시작 하며, 실제 채널은 보이스 선택 이후에 할당 된다.
+         */
+        case EAudioEvent::Play:
+        case EAudioEvent::PlayAsPaused:
+            if (voiceIdx == InvalidIndex)
             {
-                IG_CHECK(channel == nullptr);
-
-                const AudioClip* audioClip = audioSource.Clip ?
-                                                 Engine::GetAssetManager().Lookup(audioSource.Clip) :
-                                                 nullptr;
-                const Handle<Audio> audioHandle = audioClip != nullptr ?
-                                                      audioClip->GetAudio() :
-                                                      Handle<Audio>{};
+                const AudioClip* audioClip = audioSource.Clip ? Engine::GetAssetManager().Lookup(audioSource.Clip) : nullptr;
+                const Handle<Audio> audioHandle = audioClip != nullptr ? audioClip->GetAudio() : Handle<Audio>{};
                 if (FMOD::Sound* sound = LookupUnsafe(audioHandle);
                     sound != nullptr)
                 {
-                    if (const FMOD_RESULT result = system->playSound(sound, nullptr, audioSource.NextEvent == EAudioEvent::PlayAsPaused, &channel);
-                        result != FMOD_OK)
-                    {
-                        IG_LOG(AudioSystemLog, Warning, "Failed to play audio source.: {}", FMOD_ErrorString(result));
-                    }
-                    else
-                    {
-                        IG_CHECK(channel != nullptr);
-                        /*  맵 슬롯을 재활용 가능하다면, 재활용 하기 */
-                        if (bShouldEraseChannelRelationship)
-                        {
-                            channelItr->second = channel;
-                            bShouldEraseChannelRelationship = false;
-                        }
-                        else
-                        {
-                            channelMap[entity] = channel;
-                        }
-
-                        audioSource.LatestStatus = audioSource.NextEvent == EAudioEvent::Play ?
-                                                       EAudioStatus::Playing :
-                                                       EAudioStatus::Paused;
-                    }
-
+                    unsigned int lengthMs = 0;
+                    sound->getLength(&lengthMs, FMOD_TIMEUNIT_MS);
+                    const bool bPaused = audioSource.NextEvent == EAudioEvent::PlayAsPaused;
+                    voiceIdx = voices.Emplace(entity, audioHandle, lengthMs * 0.001f, bPaused);
+                    voiceLookup[entity] = voiceIdx;
+                    audioSource.LatestStatus = bPaused ? EAudioStatus::Paused : EAudioStatus::Playing;
                     audioSource.bShouldUpdatePropertiesOnThisFrame = true;
                 }
+                else
+                {
+                    IG_LOG(AudioSystemLog, Warning, "Failed to play audio source. Invalid audio clip.");
+                }
             }
-        }
+            break;
         /*
          * Playing -> Paused
          */
-        else if (audioSource.NextEvent == EAudioEvent::Pause)
-        {
-            if (bIsPlaying && !bIsPaused)
+        case EAudioEvent::Pause:
+            if (voiceIdx != InvalidIndex && voices.bPaused[voiceIdx] == 0)
             {
-                IG_CHECK(channel != nullptr);
-                channel->setPaused(true);
-                bIsPaused = true;
+                voices.bPaused[voiceIdx] = 1;
+                if (voices.Channels[voiceIdx] != nullptr)
+                {
+                    voices.Channels[voiceIdx]->setPaused(true);
+                }
                 audioSource.LatestStatus = EAudioStatus::Paused;
             }
-        }
+            break;
         /*
          * Paused -> Playing
          */
-        else if (audioSource.NextEvent == EAudioEvent::Resume)
-        {
-            if (bIsPlaying && bIsPaused)
+        case EAudioEvent::Resume:
+            if (voiceIdx != InvalidIndex && voices.bPaused[voiceIdx] != 0)
             {
-                IG_CHECK(channel != nullptr);
-                channel->setPaused(false);
-                bIsPaused = false;
+                voices.bPaused[voiceIdx] = 0;
+                if (voices.Channels[voiceIdx] != nullptr)
+                {
+                    voices.Channels[voiceIdx]->setPaused(false);
+                }
                 audioSource.LatestStatus = EAudioStatus::Playing;
             }
-        }
+            break;
         /*
          * Playing -> Stopped
          * Paused -> Stopped
          */
-        else if (audioSource.NextEvent == EAudioEvent::Stop)
-        {
-            /* 현재 프레임에선 FMOD API를 통해 채널을 멈춰주기만 하면, 다음 프레임에서 처리된다. */
-            if (bIsPlaying)
+        case EAudioEvent::Stop:
+            if (voiceIdx != InvalidIndex)
             {
-                IG_CHECK(channel != nullptr);
-                channel->stop();
-                bIsPlaying = false;
-                bIsPaused = false;
+                RemoveVoice(voiceIdx);
+                voiceIdx = InvalidIndex;
                 audioSource.LatestStatus = EAudioStatus::Stopped;
             }
+            break;
+        default:
+            break;
         }
         audioSource.NextEvent = EAudioEvent::None;
 
-        if (bShouldEraseChannelRelationship)
+        return voiceIdx;
+    }
+
+    bool AudioSystem::HasVoiceFinishedUnsafe(const Index voiceIdx, const float deltaTime)
+    {
+        if (FMOD::Channel* channel = voices.Channels[voiceIdx];
+            channel != nullptr)
+        {
+            /* FMOD 에선 bIsPlaying 이면 재생 중 이거나 중지(Paused)된 경우이다 */
+            bool bIsPlaying = false;
+            return channel->isPlaying(&bIsPlaying) != FMOD_OK || !bIsPlaying;
+        }
+
+        /* 클립이 해제 된 경우 */
+        if (LookupUnsafe(voices.Audios[voiceIdx]) == nullptr)
+        {
+            return true;
+        }
+
+        if (voices.bPaused[voiceIdx] != 0)
+        {
+            return false;
+        }
+
+        const float lengthSeconds = voices.LengthSeconds[voiceIdx];
+        float& playbackSeconds = voices.PlaybackSeconds[voiceIdx];
+        playbackSeconds += deltaTime * voices.Pitches[voiceIdx];
+        if (playbackSeconds < lengthSeconds)
+        {
+            return false;
+        }
+
+        if (voices.bLooped[voiceIdx] != 0 && lengthSeconds > 0.f)
+        {
+            playbackSeconds = std::fmod(playbackSeconds, lengthSeconds);
+            return false;
+        }
+
+        return true;
+    }
+
+    void AudioSystem::EstimateAudibility(const Index voiceIdx, const float deltaTime)
+    {
+        const Vector3& position = voices.Positions[voiceIdx];
+        voices.Velocities[voiceIdx] = deltaTime > FLT_EPSILON ? (position - voices.PrevPositions[voiceIdx]) / deltaTime : Vector3::Zero;
+        voices.bWasReal[voiceIdx] = voices.Channels[voiceIdx] != nullptr ? 1 : 0;
+
+        /* 중지 되었거나 음소거 된 보이스는 들리지 않으므로 가상화 된다. */
+        if (voices.bPaused[voiceIdx] != 0 || voices.bMuted[voiceIdx] != 0)
+        {
+            voices.Audibility[voiceIdx] = 0.f;
+            return;
+        }
+
+        const float attenuation = voices.bIs3D[voiceIdx] != 0 ?
+            details::AudioVoicePrioritizer::EstimateAttenuation(position, voices.MinDistances[voiceIdx], voices.MaxDistances[voiceIdx], listenerPositions) :
+            1.f;
+        voices.Audibility[voiceIdx] = voices.Volumes[voiceIdx] * attenuation;
+    }
+
+    void AudioSystem::ApplyVoicesUnsafe()
+    {
+        const Size numVoices = voices.Entities.size();
+
+        /* Real -> Virtual; 새로운 실제 보이스에 채널을 양보 하기 위해 먼저 처리 한다. */
+        for (Index voiceIdx = 0; voiceIdx < numVoices; ++voiceIdx)
+        {
+            FMOD::Channel*& channel = voices.Channels[voiceIdx];
+            if (channel != nullptr && voices.bShouldBeReal[voiceIdx] == 0)
+            {
+                unsigned int positionMs = 0;
+                if (channel->getPosition(&positionMs, FMOD_TIMEUNIT_MS) == FMOD_OK)
+                {
+                    voices.PlaybackSeconds[voiceIdx] = positionMs * 0.001f;
+                }
+                channel->stop();
+                channel = nullptr;
+            }
+        }
+
+        numRealVoices = 0;
+        for (Index voiceIdx = 0; voiceIdx < numVoices; ++voiceIdx)
         {
-            IG_CHECK(channel == nullptr);
-            IG_CHECK(channelItr != channelMap.end());
-            channelMap.erase(channelItr);
+            if (voices.bShouldBeReal[voiceIdx] == 0)
+            {
+                continue;
+            }
+
+            /* Virtual -> Real; 속성을 모두 반영 한 이후에 재생 되도록 중지 된 상태로 시작 한다. */
+            FMOD::Channel*& channel = voices.Channels[voiceIdx];
+            const bool bRealized = channel == nullptr;
+            if (bRealized)
+            {
+                FMOD::Sound* sound = LookupUnsafe(voices.Audios[voiceIdx]);
+                if (sound == nullptr)
+                {
+                    continue;
+                }
+
+                if (const FMOD_RESULT result = system->playSound(sound, nullptr, true, &channel);
+                    result != FMOD_OK)
+                {
+                    IG_LOG(AudioSystemLog, Warning, "Failed to play audio source.: {}", FMOD_ErrorString(result));
+                    channel = nullptr;
+                    continue;
+                }
+                IG_CHECK(channel != nullptr);
+                channel->setPosition(static_cast<unsigned int>(voices.PlaybackSeconds[voiceIdx] * 1000.f), FMOD_TIMEUNIT_MS);
+            }
+
+            channel->setVolume(voices.Volumes[voiceIdx]);
+            channel->setPitch(voices.Pitches[voiceIdx]);
+            channel->setPan(voices.Pans[voiceIdx]);
+            channel->setMute(voices.bMuted[voiceIdx] != 0);
+            FMOD_MODE newMode = voices.bIs3D[voiceIdx] != 0 ? FMOD_3D : FMOD_2D;
+            newMode |= voices.bLooped[voiceIdx] != 0 ? FMOD_LOOP_NORMAL : FMOD_LOOP_OFF;
+            channel->setMode(newMode);
+
+            if (voices.bIs3D[voiceIdx] != 0)
+            {
+                const Vector3& position = voices.Positions[voiceIdx];
+                const Vector3& velocity = voices.Velocities[voiceIdx];
+                const FMOD_VECTOR currentPos{
+                    .x = position.x,
+                    .y = position.y,
+                    .z = position.z
+                };
+                const FMOD_VECTOR currentVelocity{
+                    .x = velocity.x,
+                    .y = velocity.y,
+                    .z = velocity.z
+                };
+                channel->set3DMinMaxDistance(voices.MinDistances[voiceIdx], voices.MaxDistances[voiceIdx]);
+                channel->set3DAttributes(&currentPos, &currentVelocity);
+            }
+
+            if (bRealized)
+            {
+                channel->setPaused(voices.bPaused[voiceIdx] != 0);
+            }
+            ++numRealVoices;
         }
+    }
+
+    void AudioSystem::RemoveVoice(const Index voiceIdx)
+    {
+        IG_CHECK(voiceIdx < voices.Entities.size());
+        if (FMOD::Channel* channel = voices.Channels[voiceIdx];
+            channel != nullptr)
+        {
+            channel->stop();
+        }
+
+        voiceLookup.erase(voices.Entities[voiceIdx]);
+        voices.SwapRemove(voiceIdx);
+        if (voiceIdx < voices.Entities.size())
+        {
+            voiceLookup[voices.Entities[voiceIdx]] = voiceIdx;
+        }
+    }
+
+    Index AudioSystem::VoiceStorage::Emplace(const Entity entity, const Handle<Audio> audio, const float lengthSeconds, const bool bStartPaused)
+    {
+        const Index voiceIdx = Entities.size();
+        Entities.emplace_back(entity);
+        Audios.emplace_back(audio);
+        Channels.emplace_back(nullptr);
+        PlaybackSeconds.emplace_back(0.f);
+        LengthSeconds.emplace_back(lengthSeconds);
+        bPaused.emplace_back(bStartPaused ? 1 : 0);
+        bFinished.emplace_back(0);
+        bReferenced.emplace_back(0);
+
+        Positions.emplace_back(Vector3::Zero);
+        PrevPositions.emplace_back(Vector3::Zero);
+        Volumes.emplace_back(0.f);
+        Pitches.emplace_back(1.f);
+        Pans.emplace_back(0.f);
+        MinDistances.emplace_back(1.f);
+        MaxDistances.emplace_back(1.f);
+        bMuted.emplace_back(0);
+        bLooped.emplace_back(0);
+        bIs3D.emplace_back(0);
+        return voiceIdx;
+    }
+
+    void AudioSystem::VoiceStorage::SwapRemove(const Index voiceIdx)
+    {
+        constexpr auto kSwapRemove = []<typename T>(Vector<T>& elements, const Index elementIdx)
+        {
+            IG_CHECK(elementIdx < elements.size());
+            if (elementIdx + 1 < elements.size())
+            {
+                elements[elementIdx] = std::move(elements.back());
+            }
+            elements.pop_back();
+        };
 
-        return channel;
+        kSwapRemove(Entities, voiceIdx);
+        kSwapRemove(Audios, voiceIdx);
+        kSwapRemove(Channels, voiceIdx);
+        kSwapRemove(PlaybackSeconds, voiceIdx);
+        kSwapRemove(LengthSeconds, voiceIdx);
+        kSwapRemove(bPaused, voiceIdx);
+        kSwapRemove(bFinished, voiceIdx);
+        kSwapRemove(bReferenced, voiceIdx);
+        kSwapRemove(Positions, voiceIdx);
+        kSwapRemove(PrevPositions, voiceIdx);
+        kSwapRemove(Volumes, voiceIdx);
+        kSwapRemove(Pitches, voiceIdx);
+        kSwapRemove(Pans, voiceIdx);
+        kSwapRemove(MinDistances, voiceIdx);
+        kSwapRemove(MaxDistances, voiceIdx);
+        kSwapRemove(bMuted, voiceIdx);
+        kSwapRemove(bLooped, voiceIdx);
+        kSwapRemove(bIs3D, voiceIdx);
     }
 
     FMOD::Sound* AudioSystem::LookupUnsafe(const Handle<Audio> audio)
@@ -12,6 +12,12 @@ namespace ig
     class Audio;
     struct AudioSourceComponent;
 
+    /*
+     * #sy_note 보이스 가상화
+     * 재생 중인 오디오 소스는 각각 하나의 보이스를 가진다. 매 프레임 들리는 정도가 큰 maxRealVoices 개의 보이스 만
+     * FMOD 채널을 할당 받고(Real), 나머지는 채널 없이 재생 위치 만을 추적 한다(Virtual).
+     * 가상 보이스가 다시 실제 보이스가 되면, 추적 된 위치 부터 재생을 이어 간다.
+     */
     class AudioSystem
     {
     public:
@@ -23,22 +29,83 @@ namespace ig
         AudioSystem& operator=(const AudioSystem&) = delete;
         AudioSystem& operator=(AudioSystem&&) noexcept = delete;
 
-        Handle<Audio> CreateAudio(const std::string_view path);
+        /* bStreamed 가 true 라면 재생 중에 조금씩 디코딩 하고, 그렇지 않다면 생성 시 PCM 으로 디코딩 하여 메모리에 유지 한다. */
+        Handle<Audio> CreateAudio(const std::string_view path, const bool bStreamed = false);
+        /* 메모리 상의 오디오 데이터로 부터 생성. 데이터는 내부적으로 복사 된다. */
+        Handle<Audio> CreateAudio(const std::span<const U8> data, const bool bStreamed = false);
         void Destroy(const Handle<Audio> audioHandle);
 
-        void Update(Registry& registry, const float deltaTime);
+        void SetMaxRealVoices(const U32 newMaxRealVoices) { maxRealVoices = std::clamp<U32>(newMaxRealVoices, 1, kMaxChannels); }
+        [[nodiscard]] U32 GetMaxRealVoices() const noexcept { return maxRealVoices; }
+        [[nodiscard]] Size GetNumVoices() const noexcept { return voices.Entities.size(); }
+        [[nodiscard]] U32 GetNumRealVoices() const noexcept { return numRealVoices; }
+
+        /* 이벤트 처리는 호출 시점에, 감쇠 추정/보이스 선택/FMOD 반영은 subflow 에서 처리 된다. */
+        void Update(tf::Subflow& subflow, Registry& registry, const float deltaTime);
 
     private:
-        FMOD::Channel* UpdateAudioStatusUnsafe(const Entity entity, AudioSourceComponent& audioSource);
+        /* 보이스 별 데이터 (SoA) */
+        struct VoiceStorage
+        {
+        public:
+            Index Emplace(const Entity entity, const Handle<Audio> audio, const float lengthSeconds, const bool bStartPaused);
+            void SwapRemove(const Index voiceIdx);
+
+        public:
+            Vector<Entity> Entities;
+            Vector<Handle<Audio>> Audios;
+            /* nullptr 이라면 가상 보이스 */
+            Vector<FMOD::Channel*> Channels;
+            /* 가상 보이스의 재생 위치 */
+            Vector<float> PlaybackSeconds;
+            Vector<float> LengthSeconds;
+            Vector<U8> bPaused;
+            Vector<U8> bFinished;
+            Vector<U8> bReferenced;
+
+            /* 매 프레임 오디오 소스로 부터 갱신 */
+            Vector<Vector3> Positions;
+            Vector<Vector3> PrevPositions;
+            Vector<float> Volumes;
+            Vector<float> Pitches;
+            Vector<float> Pans;
+            Vector<float> MinDistances;
+            Vector<float> MaxDistances;
+            Vector<U8> bMuted;
+            Vector<U8> bLooped;
+            Vector<U8> bIs3D;
+
+            /* 병렬로 계산 */
+            Vector<Vector3> Velocities;
+            Vector<float> Audibility;
+            Vector<U8> bWasReal;
+            Vector<U8> bShouldBeReal;
+        };
+
+    private:
+        void UpdateListeners(Registry& registry, const float deltaTime);
+        void GatherVoicesUnsafe(Registry& registry, const float deltaTime);
+        Index ProcessEventUnsafe(const Entity entity, AudioSourceComponent& audioSource);
+        [[nodiscard]] bool HasVoiceFinishedUnsafe(const Index voiceIdx, const float deltaTime);
+        void EstimateAudibility(const Index voiceIdx, const float deltaTime);
+        void ApplyVoicesUnsafe();
+        void RemoveVoice(const Index voiceIdx);
+
         FMOD::Sound* LookupUnsafe(const Handle<Audio> audio);
 
     private:
         constexpr static int kMaxChannels = 512;
+        constexpr static U32 kDefaultMaxRealVoices = 128;
 
     private:
         FMOD::System* system = nullptr;
 
-        UnorderedMap<Entity, FMOD::Channel*> channelMap;
+        U32 maxRealVoices = kDefaultMaxRealVoices;
+        U32 numRealVoices = 0;
+        Vector<Vector3> listenerPositions;
+        UnorderedMap<Entity, Index> voiceLookup;
+        VoiceStorage voices;
+        Vector<Index> voiceCandidates;
 
         mutable SharedMutex audioClipStorageMutex;
         HandleStorage<FMOD::Sound*> audioClipStorage;
@@ -0,0 +1,67 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Audio/AudioVoicePrioritizer.h"
+
+namespace ig::details
+{
+    float AudioVoicePrioritizer::EstimateAttenuation(const Vector3& emitterPosition, const float minDistance, const float maxDistance,
+        const std::span<const Vector3> listenerPositions)
+    {
+        if (listenerPositions.empty())
+        {
+            return 1.f;
+        }
+
+        /* 여러 리스너가 존재 한다면 가장 가까운 리스너를 기준으로 한다. */
+        float nearestDistanceSquared = std::numeric_limits<float>::max();
+        for (const Vector3& listenerPosition : listenerPositions)
+        {
+            nearestDistanceSquared = std::min(nearestDistanceSquared, Vector3::DistanceSquared(emitterPosition, listenerPosition));
+        }
+
+        const float safeMinDistance = std::max(minDistance, 1e-3f);
+        const float distance = std::clamp(std::sqrt(nearestDistanceSquared), safeMinDistance, std::max(maxDistance, safeMinDistance));
+        return safeMinDistance / distance;
+    }
+
+    U32 AudioVoicePrioritizer::SelectRealVoices(const std::span<const float> audibility, const std::span<const U8> bWasReal, const U32 maxRealVoices,
+        const std::span<U8> bShouldBeReal, Vector<Index>& candidates)
+    {
+        IG_CHECK(audibility.size() == bWasReal.size());
+        IG_CHECK(audibility.size() == bShouldBeReal.size());
+
+        candidates.clear();
+        for (Index voiceIdx = 0; voiceIdx < audibility.size(); ++voiceIdx)
+        {
+            bShouldBeReal[voiceIdx] = 0;
+            if (audibility[voiceIdx] > kMinAudibility)
+            {
+                candidates.emplace_back(voiceIdx);
+            }
+        }
+
+        if (candidates.size() > maxRealVoices)
+        {
+            const auto priorityOf = [audibility, bWasReal](const Index voiceIdx)
+            {
+                return audibility[voiceIdx] * (bWasReal[voiceIdx] != 0 ? kRealVoiceHysteresis : 1.f);
+            };
+
+            /* 우선 순위가 같다면 인덱스가 작은 보이스를 선택 하여 결과가 결정적(Deterministic) 이도록 한다. */
+            std::nth_element(candidates.begin(), candidates.begin() + maxRealVoices, candidates.end(),
+                [&priorityOf](const Index lhs, const Index rhs)
+                {
+                    const float lhsPriority = priorityOf(lhs);
+                    const float rhsPriority = priorityOf(rhs);
+                    return lhsPriority != rhsPriority ? lhsPriority > rhsPriority : lhs < rhs;
+                });
+            candidates.resize(maxRealVoices);
+        }
+
+        for (const Index voiceIdx : candidates)
+        {
+            bShouldBeReal[voiceIdx] = 1;
+        }
+
+        return static_cast<U32>(candidates.size());
+    }
+} // namespace ig::details
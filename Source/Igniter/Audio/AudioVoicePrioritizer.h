@@ -0,0 +1,32 @@
+#pragma once
+#include "Igniter/Igniter.h"
+
+namespace ig::details
+{
+    /*
+     * #sy_note 보이스 가상화 우선 순위
+     * 재생 중인 모든 오디오 소스(보이스) 중 CPU 에서 추정한 들리는 정도(Audibility = 음량 * 거리 감쇠)가 큰 N 개의 보이스 만
+     * 실제 FMOD 채널을 할당 받고, 나머지는 재생 위치 만을 추적하는 가상 보이스가 된다.
+     * 오디오 백엔드(FMOD)에 의존하지 않는 순수한 계산 만을 수행 한다.
+     */
+    class AudioVoicePrioritizer final
+    {
+    public:
+        /* 이 값 이하의 보이스는 실제 채널을 할당 받지 않는다. */
+        constexpr static float kMinAudibility = 1e-4f;
+        /* 이미 실제 채널을 가진 보이스의 우선 순위 가중치. 비슷한 보이스 들이 매 프레임 교체 되는 것을 막는다. */
+        constexpr static float kRealVoiceHysteresis = 1.25f;
+
+    public:
+        /* FMOD 의 기본 감쇠 모델(FMOD_3D_INVERSEROLLOFF)과 같이 minDistance/distance, maxDistance 이후에는 더 이상 감쇠 하지 않는다. */
+        [[nodiscard]] static float EstimateAttenuation(const Vector3& emitterPosition, const float minDistance, const float maxDistance,
+            const std::span<const Vector3> listenerPositions);
+
+        /*
+         * audibility 가 큰 순서로 최대 maxRealVoices 개의 보이스를 선택 하여 bShouldBeReal 에 기록 한다. 선택 된 보이스의 수를 반환.
+         * candidates 는 재사용 되는 임시 버퍼.
+         */
+        static U32 SelectRealVoices(const std::span<const float> audibility, const std::span<const U8> bWasReal, const U32 maxRealVoices,
+            const std::span<U8> bShouldBeReal, Vector<Index>& candidates);
+    };
+} // namespace ig::details
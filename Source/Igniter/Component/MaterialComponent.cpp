@@ -16,16 +16,20 @@ namespace ig
     }
     IG_META_DEFINE_AS_COMPONENT(MaterialComponent);
 
+    Json& SerializeMaterialComponent(Json& archive, const Guid& materialGuid)
+    {
+        IG_SERIALIZE_TO_JSON_EXPR(MaterialComponent, archive, Instance, materialGuid);
+        return archive;
+    }
+
     template <>
     Json& Serialize<Json, MaterialComponent>(Json& archive, const MaterialComponent& materialComponent)
     {
         const Material* material = Engine::GetAssetManager().Lookup(materialComponent.Instance);
-        IG_SERIALIZE_TO_JSON_EXPR(MaterialComponent, archive, Instance,
+        return SerializeMaterialComponent(archive,
             material != nullptr ?
             material->GetSnapshot().Info.GetGuid() :
             Guid{DefaultMaterialGuid});
-
-        return archive;
     }
 
     template <>
@@ -11,6 +11,9 @@ namespace ig
         Handle<Material> Instance{};
     };
 
+    /* 로드 되지 않은 머터리얼을 Guid 로 참조하는 컴포넌트 데이터를 직렬화 (ex. 씬 임포트) */
+    Json& SerializeMaterialComponent(Json& archive, const Guid& materialGuid);
+
     template <>
     Json& Serialize(Json& archive, const MaterialComponent& materialComponent);
 
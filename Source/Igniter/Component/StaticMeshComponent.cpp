@@ -15,6 +15,12 @@ namespace ig
     }
     IG_META_DEFINE_AS_COMPONENT(StaticMeshComponent);
 
+    Json& SerializeStaticMeshComponent(Json& archive, const Guid& meshGuid)
+    {
+        IG_SERIALIZE_TO_JSON(StaticMeshComponent, archive, meshGuid);
+        return archive;
+    }
+
     template <>
     Json& Serialize<Json, StaticMeshComponent>(Json& archive, const StaticMeshComponent& staticMesh)
     {
@@ -22,8 +28,7 @@ namespace ig
         if (const StaticMesh* mesh = assetManager.Lookup(staticMesh.Mesh);
             mesh != nullptr)
         {
-            const Guid& meshGuid = mesh->GetSnapshot().Info.GetGuid();
-            IG_SERIALIZE_TO_JSON(StaticMeshComponent, archive, meshGuid);
+            SerializeStaticMeshComponent(archive, mesh->GetSnapshot().Info.GetGuid());
         }
 
         return archive;
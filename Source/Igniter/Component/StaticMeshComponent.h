@@ -13,6 +13,9 @@ namespace ig
         Handle<StaticMesh> Mesh{};
     };
 
+    /* 로드 되지 않은 메시를 Guid 로 참조하는 컴포넌트 데이터를 직렬화 (ex. 씬 임포트) */
+    Json& SerializeStaticMeshComponent(Json& archive, const Guid& meshGuid);
+
     template <>
     Json& Serialize<Json, StaticMeshComponent>(Json& archive, const StaticMeshComponent& staticMesh);
     template <>
@@ -15,6 +15,8 @@
 #include "Igniter/Render/SceneProxy.h"
 #include "Igniter/Render/Renderer.h"
 #include "Igniter/Asset/AssetManager.h"
+#include "Igniter/Asset/StaticMeshStreamer.h"
+#include "Igniter/Asset/TextureStreamer.h"
 #include "Igniter/ImGui/ImGuiContext.h"
 #include "Igniter/Application/Application.h"
 #include "Igniter/Gameplay/World.h"
@@ -65,6 +67,12 @@ namespace ig
         sceneProxy = MakePtr<SceneProxy>(taskExecutor, *renderContext, *assetManager);
         IG_LOG(EngineLog, Info, "Scene Proxy Initialized.");
 
+        staticMeshStreamer = MakePtr<StaticMeshStreamer>(taskExecutor, *renderContext, *assetManager);
+        IG_LOG(EngineLog, Info, "Static Mesh Streamer Initialized.");
+
+        textureStreamer = MakePtr<TextureStreamer>(taskExecutor, *renderContext, *assetManager);
+        IG_LOG(EngineLog, Info, "Texture Streamer Initialized.");
+
         renderer = MakePtr<Renderer>(*window, *renderContext, *sceneProxy);
         IG_LOG(EngineLog, Info, "Renderer Initialized.");
 
@@ -85,6 +93,12 @@ namespace ig
         renderer.reset();
         IG_LOG(EngineLog, Info, "Renderer Deinitialized.");
 
+        textureStreamer.reset();
+        IG_LOG(EngineLog, Info, "Texture Streamer Deinitialized.");
+
+        staticMeshStreamer.reset();
+        IG_LOG(EngineLog, Info, "Static Mesh Streamer Deinitialized.");
+
         sceneProxy.reset();
         IG_LOG(EngineLog, Info, "Scene Proxy Deinitialized.");
 
@@ -132,6 +146,7 @@ namespace ig
                 }
 
                 inputManager->HandleRawMouseInput();
+                assetManager->CommitReloads();
                 assetManager->DispatchEvent();
             }
 
@@ -150,12 +165,23 @@ namespace ig
                 application.OnImGui();
             }
 
+            /* 상주 LOD 의 변경은 Scene Proxy Replication 이전에, 메인 스레드에서 이루어져야 한다. */
+            {
+                ZoneScopedN("Engine.StreamStaticMeshes");
+                staticMeshStreamer->Update(world->GetRegistry());
+            }
+
+            {
+                ZoneScopedN("Engine.StreamTextures");
+                textureStreamer->Update(world->GetRegistry());
+            }
+
             const GlobalFrameIndex globalFrameIdx = FrameManager::GetGlobalFrameIndex();
             tf::Taskflow frameTaskflow{std::format("Frame#{}", globalFrameIdx)};
             [[maybe_unused]] tf::Task finalizeRenderFrameTask = ScheduleRenderFrame(frameTaskflow);
-            tf::Task audioUpdateTask = frameTaskflow.emplace([this, deltaTime]()
+            tf::Task audioUpdateTask = frameTaskflow.emplace([this, deltaTime](tf::Subflow& subflow)
             {
-               audioSystem->Update(this->world->GetRegistry(), deltaTime); 
+               audioSystem->Update(subflow, this->world->GetRegistry(), deltaTime); 
             });
             taskExecutor.run(frameTaskflow).wait();
 
@@ -280,6 +306,12 @@ namespace ig
         return *instance->sceneProxy;
     }
 
+    TextureStreamer& Engine::GetTextureStreamer()
+    {
+        IG_CHECK(instance != nullptr);
+        return *instance->textureStreamer;
+    }
+
     Renderer& Engine::GetRenderer()
     {
         IG_CHECK(instance != nullptr);
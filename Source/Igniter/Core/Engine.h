@@ -20,6 +20,8 @@ namespace ig
     class AssetManager;
     class World;
     class SceneProxy;
+    class StaticMeshStreamer;
+    class TextureStreamer;
     class Renderer;
     class AudioSystem;
 
@@ -46,6 +48,7 @@ namespace ig
         [[nodiscard]] static ImGuiContext& GetImGuiContext();
         [[nodiscard]] static World& GetWorld();
         [[nodiscard]] static SceneProxy& GetSceneProxy();
+        [[nodiscard]] static TextureStreamer& GetTextureStreamer();
         [[nodiscard]] static Renderer& GetRenderer();
 
         [[nodiscard]] bool IsValid() const { return this == instance; }
@@ -77,6 +80,8 @@ namespace ig
         Ptr<ImGuiContext> imguiContext;
 
         Ptr<SceneProxy> sceneProxy;
+        Ptr<StaticMeshStreamer> staticMeshStreamer;
+        Ptr<TextureStreamer> textureStreamer;
 
         Ptr<Renderer> renderer;
 
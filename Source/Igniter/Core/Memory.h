@@ -69,4 +69,14 @@ namespace ig
     {
         return bytes / (1024.0 * 1024.0 * 1024.0);
     }
+
+    inline constexpr Bytes KiloBytesToBytes(const KiloBytes kiloBytes)
+    {
+        return kiloBytes * 1024Ui64;
+    }
+
+    inline constexpr Bytes MegaBytesToBytes(const MegaBytes megaBytes)
+    {
+        return megaBytes * 1024Ui64 * 1024Ui64;
+    }
 } // namespace ig
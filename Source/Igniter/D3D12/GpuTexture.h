@@ -36,6 +36,9 @@ namespace ig
             return *resource.Get();
         }
 
+        /* 외부에서 생성 된 리소스(ex. 스왑 체인 버퍼)인 경우 0 */
+        [[nodiscard]] Size GetAllocationSize() const { return allocation ? static_cast<Size>(allocation->GetSize()) : 0; }
+
         [[nodiscard]] Size GetIntermediateSize() const
         {
             return GetRequiredIntermediateSize(resource.Get(), 0, static_cast<U32>(desc.GetNumSubresources()));
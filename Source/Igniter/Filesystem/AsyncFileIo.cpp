@@ -0,0 +1,398 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Filesystem/AsyncFileIo.h"
+
+IG_DECLARE_LOG_CATEGORY(AsyncFileIoLog);
+
+IG_DEFINE_LOG_CATEGORY(AsyncFileIoLog);
+
+namespace ig
+{
+    namespace
+    {
+        constexpr ULONG_PTR kReadCompletionKey = 1;
+        constexpr ULONG_PTR kShutdownCompletionKey = 2;
+
+        EAsyncReadStatus ToOpenFailureStatus(const DWORD lastError)
+        {
+            return lastError == ERROR_FILE_NOT_FOUND || lastError == ERROR_PATH_NOT_FOUND ? EAsyncReadStatus::FileDoesNotExists :
+                                                                                            EAsyncReadStatus::FailedToOpenFile;
+        }
+    } // namespace
+
+    AsyncFileIo::AsyncFileIo(tf::Executor& taskExecutor, const U32 maxInFlight, const EAsyncFileIoBackend preferredBackend)
+        : taskExecutor(taskExecutor)
+        , maxInFlight(std::max(maxInFlight, 1u))
+        , backend(preferredBackend)
+    {
+        if (backend == EAsyncFileIoBackend::CompletionPort)
+        {
+            completionPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+            if (completionPort != nullptr)
+            {
+                completionThread = std::jthread{
+                    [this]()
+                    {
+                        ProcessCompletions();
+                    }};
+                return;
+            }
+
+            IG_LOG(AsyncFileIoLog, Warning, "Failed to create I/O completion port. {:#X}. Falling back to thread pool.", GetLastError());
+            backend = EAsyncFileIoBackend::ThreadPool;
+        }
+
+        const U32 numReadThreads = std::min(this->maxInFlight, kMaxNumThreadPoolThreads);
+        readThreads.reserve(numReadThreads);
+        for (U32 threadIdx = 0; threadIdx < numReadThreads; ++threadIdx)
+        {
+            readThreads.emplace_back(
+                [this]()
+                {
+                    ProcessPendingReads();
+                });
+        }
+    }
+
+    AsyncFileIo::~AsyncFileIo()
+    {
+        Vector<U64> remainingBatchIds{};
+        {
+            UniqueLock lock{mutex};
+            for (const Ptr<details::AsyncRead>& pendingRead : pendingReads)
+            {
+                remainingBatchIds.emplace_back(pendingRead->BatchId);
+            }
+
+            for (const auto& [readPtr, inFlightRead] : inFlightReads)
+            {
+                remainingBatchIds.emplace_back(inFlightRead->BatchId);
+            }
+        }
+
+        std::sort(remainingBatchIds.begin(), remainingBatchIds.end());
+        remainingBatchIds.erase(std::unique(remainingBatchIds.begin(), remainingBatchIds.end()), remainingBatchIds.end());
+        for (const U64 batchId : remainingBatchIds)
+        {
+            Cancel(batchId);
+        }
+
+        WaitIdle();
+        if (completionPort != nullptr)
+        {
+            PostQueuedCompletionStatus(completionPort, 0, kShutdownCompletionKey, nullptr);
+            completionThread.join();
+            CloseHandle(completionPort);
+        }
+
+        {
+            UniqueLock lock{mutex};
+            bShutdown = true;
+        }
+        pendingReadCondition.notify_all();
+        for (std::jthread& readThread : readThreads)
+        {
+            readThread.join();
+        }
+    }
+
+    U64 AsyncFileIo::Submit(Vector<AsyncReadRequest> requests)
+    {
+        U64 batchId = 0;
+        {
+            UniqueLock lock{mutex};
+            batchId = ++lastBatchId;
+            for (AsyncReadRequest& request : requests)
+            {
+                Ptr<details::AsyncRead> newRead{MakePtr<details::AsyncRead>()};
+                newRead->BatchId = batchId;
+                newRead->Request = std::move(request);
+                pendingReads.emplace_back(std::move(newRead));
+            }
+            numOutstanding += requests.size();
+        }
+
+        IssuePendingReads();
+        return batchId;
+    }
+
+    void AsyncFileIo::Cancel(const U64 batchId)
+    {
+        Vector<Ptr<details::AsyncRead>> cancelledReads{};
+        {
+            UniqueLock lock{mutex};
+            for (auto itr = pendingReads.begin(); itr != pendingReads.end();)
+            {
+                if ((*itr)->BatchId != batchId)
+                {
+                    ++itr;
+                    continue;
+                }
+
+                cancelledReads.emplace_back(std::move(*itr));
+                itr = pendingReads.erase(itr);
+            }
+
+            /* 파일 핸들은 잠금 하에서 완료 목록에서 제거 된 이후에 닫히므로, 여기서 유효 하다. */
+            for (const auto& [readPtr, inFlightRead] : inFlightReads)
+            {
+                if (inFlightRead->BatchId == batchId && inFlightRead->File != INVALID_HANDLE_VALUE)
+                {
+                    CancelIoEx(inFlightRead->File, &inFlightRead->Overlapped);
+                }
+            }
+        }
+
+        for (Ptr<details::AsyncRead>& cancelledRead : cancelledReads)
+        {
+            DispatchCallback(std::move(cancelledRead->Request.OnCompleted), AsyncReadResult{.Status = EAsyncReadStatus::Cancelled});
+        }
+    }
+
+    void AsyncFileIo::WaitIdle()
+    {
+        UniqueLock lock{mutex};
+        idleCondition.wait(lock,
+            [this]()
+            {
+                return numOutstanding == 0;
+            });
+    }
+
+    Size AsyncFileIo::GetNumOutstanding() const
+    {
+        UniqueLock lock{mutex};
+        return numOutstanding;
+    }
+
+    void AsyncFileIo::IssuePendingReads()
+    {
+        if (backend == EAsyncFileIoBackend::ThreadPool)
+        {
+            pendingReadCondition.notify_all();
+            return;
+        }
+
+        while (true)
+        {
+            details::AsyncRead* read = nullptr;
+            {
+                UniqueLock lock{mutex};
+                if (pendingReads.empty() || inFlightReads.size() >= maxInFlight)
+                {
+                    return;
+                }
+
+                Ptr<details::AsyncRead> nextRead{std::move(pendingReads.front())};
+                pendingReads.pop_front();
+                read = nextRead.get();
+                inFlightReads[read] = std::move(nextRead);
+            }
+
+            if (const std::optional<AsyncReadResult> result = Issue(*read);
+                result)
+            {
+                Complete(*read, result->Status, result->NumReadBytes);
+            }
+        }
+    }
+
+    std::optional<AsyncReadResult> AsyncFileIo::Issue(details::AsyncRead& read)
+    {
+        const AsyncReadRequest& request{read.Request};
+        IG_CHECK(request.Destination.size() <= std::numeric_limits<DWORD>::max());
+        if (request.Destination.size() > std::numeric_limits<DWORD>::max())
+        {
+            return AsyncReadResult{.Status = EAsyncReadStatus::FailedToRead};
+        }
+
+        const HANDLE file = CreateFile(request.FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return AsyncReadResult{.Status = ToOpenFailureStatus(GetLastError())};
+        }
+
+        if (CreateIoCompletionPort(file, completionPort, kReadCompletionKey, 0) == nullptr)
+        {
+            IG_LOG(AsyncFileIoLog, Error, "Failed to associate {} with completion port. {:#X}", request.FilePath.string(), GetLastError());
+            CloseHandle(file);
+            return AsyncReadResult{.Status = EAsyncReadStatus::FailedToOpenFile};
+        }
+
+        {
+            UniqueLock lock{mutex};
+            read.File = file;
+        }
+
+        read.Overlapped.Offset = static_cast<DWORD>(request.Offset & 0xFFFFFFFFull);
+        read.Overlapped.OffsetHigh = static_cast<DWORD>(request.Offset >> 32);
+        /* 동기적으로 완료 되더라도 완료 통지는 Completion Port 로 전달 된다. 실패 한 경우에는 전달 되지 않는다. */
+        if (!ReadFile(file, request.Destination.data(), static_cast<DWORD>(request.Destination.size()), nullptr, &read.Overlapped))
+        {
+            const DWORD lastError = GetLastError();
+            if (lastError == ERROR_HANDLE_EOF)
+            {
+                /* 파일 끝을 넘어선 오프셋 에서의 읽기는 0 바이트를 읽은 것으로 취급 */
+                return AsyncReadResult{.Status = EAsyncReadStatus::Success, .NumReadBytes = 0};
+            }
+
+            if (lastError != ERROR_IO_PENDING)
+            {
+                return AsyncReadResult{.Status = EAsyncReadStatus::FailedToRead};
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    void AsyncFileIo::Complete(details::AsyncRead& read, const EAsyncReadStatus status, const Size numReadBytes)
+    {
+        Ptr<details::AsyncRead> completedRead{};
+        {
+            UniqueLock lock{mutex};
+            const auto itr = inFlightReads.find(&read);
+            IG_CHECK(itr != inFlightReads.end());
+            completedRead = std::move(itr->second);
+            inFlightReads.erase(itr);
+        }
+
+        if (completedRead->File != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(completedRead->File);
+        }
+
+        if (status != EAsyncReadStatus::Success && status != EAsyncReadStatus::Cancelled)
+        {
+            IG_LOG(AsyncFileIoLog, Error, "Failed({}) to read {}.", status, completedRead->Request.FilePath.string());
+        }
+
+        DispatchCallback(std::move(completedRead->Request.OnCompleted), AsyncReadResult{.Status = status, .NumReadBytes = numReadBytes});
+    }
+
+    void AsyncFileIo::DispatchCallback(AsyncReadCallback callback, const AsyncReadResult result)
+    {
+        if (!callback)
+        {
+            UniqueLock lock{mutex};
+            --numOutstanding;
+            idleCondition.notify_all();
+            return;
+        }
+
+        taskExecutor.silent_async(
+            [this, callback = std::move(callback), result]()
+            {
+                callback(result);
+
+                UniqueLock lock{mutex};
+                --numOutstanding;
+                idleCondition.notify_all();
+            });
+    }
+
+    void AsyncFileIo::ProcessCompletions()
+    {
+        while (true)
+        {
+            DWORD numTransferredBytes = 0;
+            ULONG_PTR completionKey = 0;
+            OVERLAPPED* overlapped = nullptr;
+            const bool bSucceeded = GetQueuedCompletionStatus(completionPort, &numTransferredBytes, &completionKey, &overlapped, INFINITE);
+            if (completionKey == kShutdownCompletionKey)
+            {
+                break;
+            }
+
+            if (overlapped == nullptr)
+            {
+                IG_LOG(AsyncFileIoLog, Error, "Failed to dequeue completion packet. {:#X}", GetLastError());
+                continue;
+            }
+
+            EAsyncReadStatus status = EAsyncReadStatus::Success;
+            if (!bSucceeded)
+            {
+                /* 파일 끝을 넘어선 오프셋 에서의 읽기는 0 바이트를 읽은 것으로 취급 */
+                const DWORD lastError = GetLastError();
+                status = lastError == ERROR_OPERATION_ABORTED ? EAsyncReadStatus::Cancelled :
+                         lastError == ERROR_HANDLE_EOF        ? EAsyncReadStatus::Success :
+                                                                EAsyncReadStatus::FailedToRead;
+            }
+
+            Complete(*CONTAINING_RECORD(overlapped, details::AsyncRead, Overlapped), status, numTransferredBytes);
+            IssuePendingReads();
+        }
+    }
+
+    void AsyncFileIo::ProcessPendingReads()
+    {
+        while (true)
+        {
+            details::AsyncRead* read = nullptr;
+            {
+                UniqueLock lock{mutex};
+                pendingReadCondition.wait(lock,
+                    [this]()
+                    {
+                        return bShutdown || !pendingReads.empty();
+                    });
+
+                if (pendingReads.empty())
+                {
+                    IG_CHECK(bShutdown);
+                    return;
+                }
+
+                Ptr<details::AsyncRead> nextRead{std::move(pendingReads.front())};
+                pendingReads.pop_front();
+                read = nextRead.get();
+                inFlightReads[read] = std::move(nextRead);
+            }
+
+            const AsyncReadResult result{ReadSynchronously(read->Request)};
+            Complete(*read, result.Status, result.NumReadBytes);
+        }
+    }
+
+    AsyncReadResult AsyncFileIo::ReadSynchronously(const AsyncReadRequest& request)
+    {
+        const HANDLE file = CreateFile(request.FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return AsyncReadResult{.Status = ToOpenFailureStatus(GetLastError())};
+        }
+
+        /* 동기 핸들에서도 OVERLAPPED 의 오프셋 으로 부터 읽는다. 파일 끝에 도달 하면 0 바이트를 읽고 성공 한다. */
+        AsyncReadResult result{};
+        while (result.NumReadBytes < request.Destination.size())
+        {
+            const U64 offset = request.Offset + result.NumReadBytes;
+            OVERLAPPED overlapped{};
+            overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFull);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+            const Size numRemainingBytes = request.Destination.size() - result.NumReadBytes;
+            const DWORD numRequestedBytes = static_cast<DWORD>(std::min<Size>(numRemainingBytes, std::numeric_limits<DWORD>::max()));
+            DWORD numReadBytes = 0;
+            if (!ReadFile(file, request.Destination.data() + result.NumReadBytes, numRequestedBytes, &numReadBytes, &overlapped))
+            {
+                if (GetLastError() != ERROR_HANDLE_EOF)
+                {
+                    result.Status = EAsyncReadStatus::FailedToRead;
+                }
+                break;
+            }
+
+            if (numReadBytes == 0)
+            {
+                break;
+            }
+            result.NumReadBytes += numReadBytes;
+        }
+
+        CloseHandle(file);
+        return result;
+    }
+} // namespace ig
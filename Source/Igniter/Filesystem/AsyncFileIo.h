@@ -0,0 +1,123 @@
+#pragma once
+#include "Igniter/Igniter.h"
+
+namespace ig
+{
+    enum class EAsyncReadStatus
+    {
+        Success,
+        FileDoesNotExists,
+        FailedToOpenFile,
+        FailedToRead,
+        Cancelled,
+    };
+
+    struct AsyncReadResult
+    {
+    public:
+        EAsyncReadStatus Status = EAsyncReadStatus::Success;
+        /* 파일 끝에 도달한 경우, 버퍼의 크기 보다 작을 수 있다. */
+        Size NumReadBytes = 0;
+    };
+
+    using AsyncReadCallback = std::function<void(const AsyncReadResult&)>;
+
+    enum class EAsyncFileIoBackend
+    {
+        /* Overlapped I/O 와 I/O Completion Port */
+        CompletionPort,
+        /* 전용 스레드 들에서 동기적으로 읽는다. Completion Port 를 생성 할 수 없는 경우의 대체 경로 이다. */
+        ThreadPool,
+    };
+
+    struct AsyncReadRequest
+    {
+    public:
+        Path FilePath{};
+        U64 Offset = 0;
+        /* 호출자가 소유한 버퍼. 완료 콜백이 호출 될 때 까지 유효 해야 한다. */
+        std::span<U8> Destination{};
+        /* Task Executor 의 워커 에서 호출 된다. 요청 마다 반드시 한 번 호출 된다. */
+        AsyncReadCallback OnCompleted{};
+    };
+
+    namespace details
+    {
+        struct AsyncRead
+        {
+        public:
+            /* 완료 통지(OVERLAPPED*)로 부터 CONTAINING_RECORD 를 통해 요청을 찾는다. */
+            OVERLAPPED Overlapped{};
+            U64 BatchId = 0;
+            HANDLE File{INVALID_HANDLE_VALUE};
+            AsyncReadRequest Request{};
+        };
+    } // namespace details
+
+    /*
+     * #sy_note 비동기 파일 읽기
+     * Overlapped I/O 와 I/O Completion Port 를 사용 하여, 최대 MaxInFlight 개의 읽기를 동시에 커널에 제출 한다.
+     * 완료 통지는 전용 스레드가 받아 다음 요청을 제출 하며, 완료 콜백은 Task Executor 로 넘겨 워커 에서 처리 된다.
+     * 요청은 배치 단위로 제출/취소 되며, 취소는 최선의 노력(Best-Effort)으로 이루어 진다. 이미 완료 된 읽기는 Success 로 통지 된다.
+     * ThreadPool 백엔드는 최대 kMaxNumThreadPoolThreads 개의 전용 스레드 에서 동기적으로 읽으며, 읽기 중인 요청은 취소 되지 않는다.
+     * 두 백엔드는 같은 요청/배치/콜백 규칙을 따르므로, 호출자는 백엔드에 의존하지 않는다.
+     */
+    class AsyncFileIo final
+    {
+    public:
+        constexpr static U32 kDefaultMaxInFlight = 64;
+        constexpr static U32 kMaxNumThreadPoolThreads = 4;
+
+    public:
+        /* Completion Port 를 생성 할 수 없다면 ThreadPool 백엔드로 대체 된다. */
+        explicit AsyncFileIo(tf::Executor& taskExecutor, const U32 maxInFlight = kDefaultMaxInFlight,
+            const EAsyncFileIoBackend preferredBackend = EAsyncFileIoBackend::CompletionPort);
+        AsyncFileIo(const AsyncFileIo&) = delete;
+        AsyncFileIo(AsyncFileIo&&) noexcept = delete;
+        /* 남아 있는 요청은 모두 취소 되며, 콜백이 끝날 때 까지 대기 한다. */
+        ~AsyncFileIo();
+
+        AsyncFileIo& operator=(const AsyncFileIo&) = delete;
+        AsyncFileIo& operator=(AsyncFileIo&&) noexcept = delete;
+
+        /* 요청 들을 하나의 배치로 제출 하고, 배치 Id 를 반환 한다. */
+        U64 Submit(Vector<AsyncReadRequest> requests);
+        /* 배치의 완료 되지 않은 요청 들을 취소 한다. 취소 된 요청의 콜백은 Cancelled 로 호출 된다. */
+        void Cancel(const U64 batchId);
+        /* 제출 된 모든 요청의 콜백이 끝날 때 까지 대기. Task Executor 의 워커 에서 호출 해선 안된다. */
+        void WaitIdle();
+
+        [[nodiscard]] Size GetNumOutstanding() const;
+        [[nodiscard]] EAsyncFileIoBackend GetBackend() const noexcept { return backend; }
+
+    private:
+        void IssuePendingReads();
+        /* 완료 통지가 Completion Port 로 전달 되지 않는 경우(실패 또는 파일 끝), 바로 완료 해야 할 결과를 반환 한다. */
+        [[nodiscard]] std::optional<AsyncReadResult> Issue(details::AsyncRead& read);
+        void Complete(details::AsyncRead& read, const EAsyncReadStatus status, const Size numReadBytes);
+        void DispatchCallback(AsyncReadCallback callback, const AsyncReadResult result);
+        void ProcessCompletions();
+
+        void ProcessPendingReads();
+        [[nodiscard]] static AsyncReadResult ReadSynchronously(const AsyncReadRequest& request);
+
+    private:
+        tf::Executor& taskExecutor;
+        const U32 maxInFlight;
+        EAsyncFileIoBackend backend = EAsyncFileIoBackend::CompletionPort;
+        HANDLE completionPort{nullptr};
+        std::jthread completionThread;
+        Vector<std::jthread> readThreads;
+
+        mutable Mutex mutex;
+        std::condition_variable idleCondition;
+        /* ThreadPool 백엔드의 스레드 들은 대기 중인 요청이 생기거나 종료 될 때 까지 대기 한다. */
+        std::condition_variable pendingReadCondition;
+        bool bShutdown = false;
+        U64 lastBatchId = 0;
+        /* 제출 되었으나 콜백이 끝나지 않은 요청의 수 */
+        Size numOutstanding = 0;
+        std::deque<Ptr<details::AsyncRead>> pendingReads;
+        UnorderedMap<const details::AsyncRead*, Ptr<details::AsyncRead>> inFlightReads;
+    };
+} // namespace ig
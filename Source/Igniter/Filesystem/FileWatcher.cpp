@@ -0,0 +1,122 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Core/String.h"
+#include "Igniter/Filesystem/FileWatcher.h"
+
+IG_DECLARE_LOG_CATEGORY(FileWatcherLog);
+
+IG_DEFINE_LOG_CATEGORY(FileWatcherLog);
+
+namespace ig::details
+{
+    namespace
+    {
+        /* 이름 변경은 이전 이름의 삭제와 새 이름의 추가로 취급 한다. */
+        EFileWatchAction NormalizeAction(const EFileWatchAction action)
+        {
+            switch (action)
+            {
+            case EFileWatchAction::RenamedOldName:
+                return EFileWatchAction::Removed;
+            case EFileWatchAction::RenamedNewName:
+                return EFileWatchAction::Added;
+            default:
+                return action;
+            }
+        }
+    } // namespace
+
+    void FileChangeCoalescer::Push(const Path& path, const EFileWatchAction action, const Clock::time_point now)
+    {
+        const EFileWatchAction newAction = NormalizeAction(action);
+        const auto itr = pendingChanges.find(path);
+        if (itr == pendingChanges.end())
+        {
+            pendingChanges[path] = PendingChange{
+                .Change = FileChange{.Action = newAction, .Path = path, .NumRawEvents = 1},
+                .LastEventTime = now
+            };
+            return;
+        }
+
+        FileChange& change = itr->second.Change;
+        switch (change.Action)
+        {
+        case EFileWatchAction::Added:
+            /* 감시 구간 내에서 생성 되었다가 삭제 된 파일은 외부에 드러나지 않는다. */
+            if (newAction == EFileWatchAction::Removed)
+            {
+                pendingChanges.erase(itr);
+                return;
+            }
+            break;
+
+        default:
+            /* 삭제 후 다시 생성 된 경우(ex. 임시 파일 이름 변경을 통한 저장) 기존 파일의 수정으로 취급 한다. */
+            change.Action = newAction == EFileWatchAction::Removed ? EFileWatchAction::Removed : EFileWatchAction::Modified;
+            break;
+        }
+
+        ++change.NumRawEvents;
+        itr->second.LastEventTime = now;
+    }
+
+    Vector<FileChange> FileChangeCoalescer::Flush(const Clock::time_point now, const bool bForce)
+    {
+        Vector<FileChange> batch{};
+        for (auto itr = pendingChanges.begin(); itr != pendingChanges.end();)
+        {
+            if (!bForce && (now - itr->second.LastEventTime) < window)
+            {
+                ++itr;
+                continue;
+            }
+
+            batch.emplace_back(std::move(itr->second.Change));
+            itr = pendingChanges.erase(itr);
+        }
+
+        std::sort(batch.begin(), batch.end(),
+            [](const FileChange& lhs, const FileChange& rhs)
+            {
+                return lhs.Path < rhs.Path;
+            });
+        return batch;
+    }
+} // namespace ig::details
+
+namespace ig
+{
+    FileWatcher::FileWatcher(const Path& directoryPath, const std::chrono::milliseconds debounceWindow, const bool bWatchRecursively)
+        : directoryPath(directoryPath)
+        , coalescer(debounceWindow)
+    {
+        if (!fs::is_directory(directoryPath))
+        {
+            IG_LOG(FileWatcherLog, Warning, "Failed to watch {}. Directory does not exist.", directoryPath.string());
+            return;
+        }
+
+        backend = MakePtr<CoFileWatcher>(directoryPath.string(),
+            EFileWatchFilterFlags::ChangeFileName | EFileWatchFilterFlags::ChangeLastWrite | EFileWatchFilterFlags::ChangeSize,
+            bWatchRecursively);
+    }
+
+    FileWatcher::~FileWatcher() = default;
+
+    Vector<FileChange> FileWatcher::Poll()
+    {
+        if (backend == nullptr)
+        {
+            return {};
+        }
+
+        const auto now = details::FileChangeCoalescer::Clock::now();
+        for (const FileChangeInfo& changeInfo : backend->RequestChanges(false))
+        {
+            coalescer.Push(changeInfo.Path, changeInfo.Action, now);
+        }
+
+        return coalescer.Flush(now);
+    }
+} // namespace ig
@@ -0,0 +1,99 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Filesystem/CoFileWatcher.h"
+
+namespace ig
+{
+    /* 병합 된 파일 변경. Action 은 Added, Removed, Modified 중 하나 이다. */
+    struct FileChange
+    {
+    public:
+        EFileWatchAction Action = EFileWatchAction::Modified;
+        Path Path{};
+        /* 이 변경으로 병합 된 원본 이벤트의 수 */
+        U32 NumRawEvents = 0;
+    };
+} // namespace ig
+
+namespace ig::details
+{
+    /*
+     * #sy_note 파일 변경 병합
+     * 원본 이벤트를 경로 별로 누적 하여, 마지막 이벤트 이후 Window 동안 새 이벤트가 없었던 경로만 배치로 내보낸다.
+     * 에디터가 저장 시 생성 하는 임시 파일(추가 후 삭제)은 서로 상쇄 되어 사라지며,
+     * '삭제 후 추가' 나 '이름 변경을 통한 교체' 는 하나의 Modified 로 병합 된다.
+     * 플랫폼 API 에 의존하지 않으므로, 백엔드는 원본 이벤트만 공급 하면 된다.
+     */
+    class FileChangeCoalescer final
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+    public:
+        explicit FileChangeCoalescer(const Clock::duration window)
+            : window(window)
+        {}
+
+        FileChangeCoalescer(const FileChangeCoalescer&) = delete;
+        FileChangeCoalescer(FileChangeCoalescer&&) noexcept = default;
+        ~FileChangeCoalescer() = default;
+
+        FileChangeCoalescer& operator=(const FileChangeCoalescer&) = delete;
+        FileChangeCoalescer& operator=(FileChangeCoalescer&&) noexcept = default;
+
+        void Push(const Path& path, const EFileWatchAction action, const Clock::time_point now);
+        /* Window 가 지난(bForce 인 경우 모든) 변경 들을 경로 순으로 반환 한다. */
+        [[nodiscard]] Vector<FileChange> Flush(const Clock::time_point now, const bool bForce = false);
+
+        void SetWindow(const Clock::duration newWindow) noexcept { window = newWindow; }
+        [[nodiscard]] Clock::duration GetWindow() const noexcept { return window; }
+        [[nodiscard]] Size GetNumPendingChanges() const noexcept { return pendingChanges.size(); }
+
+    private:
+        struct PendingChange
+        {
+        public:
+            FileChange Change{};
+            Clock::time_point LastEventTime{};
+        };
+
+    private:
+        Clock::duration window;
+        /* 경로의 해시 만으로는 충돌 시 서로 다른 파일의 이벤트가 병합 되므로, 경로 자체를 키로 사용 한다. */
+        UnorderedMap<Path, PendingChange> pendingChanges{};
+    };
+} // namespace ig::details
+
+namespace ig
+{
+    /*
+     * 디렉터리의 변경을 병합 된 배치 단위로 전달 하는 감시자. 메인 루프 에서 Poll 을 호출 하며, 호출 스레드를 막지 않는다.
+     * 백엔드는 CoFileWatcher(ReadDirectoryChangesExW) 이다.
+     */
+    class FileWatcher final
+    {
+    public:
+        constexpr static std::chrono::milliseconds kDefaultDebounceWindow{250};
+
+    public:
+        FileWatcher(const Path& directoryPath, const std::chrono::milliseconds debounceWindow = kDefaultDebounceWindow, const bool bWatchRecursively = true);
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher(FileWatcher&&) noexcept = delete;
+        ~FileWatcher();
+
+        FileWatcher& operator=(const FileWatcher&) = delete;
+        FileWatcher& operator=(FileWatcher&&) noexcept = delete;
+
+        [[nodiscard]] bool IsWatching() const noexcept { return backend != nullptr; }
+        [[nodiscard]] const Path& GetDirectoryPath() const noexcept { return directoryPath; }
+
+        /* 디바운스 구간이 지난 변경 들을 하나의 배치로 반환. 변경이 없다면 빈 배치. */
+        [[nodiscard]] Vector<FileChange> Poll();
+        void SetDebounceWindow(const std::chrono::milliseconds newWindow) { coalescer.SetWindow(newWindow); }
+
+    private:
+        Path directoryPath;
+        Ptr<CoFileWatcher> backend;
+        details::FileChangeCoalescer coalescer;
+    };
+} // namespace ig
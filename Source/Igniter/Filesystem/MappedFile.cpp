@@ -0,0 +1,93 @@
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/Log.h"
+#include "Igniter/Filesystem/MappedFile.h"
+
+IG_DECLARE_LOG_CATEGORY(MappedFileLog);
+
+IG_DEFINE_LOG_CATEGORY(MappedFileLog);
+
+namespace ig
+{
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : file(std::exchange(other.file, INVALID_HANDLE_VALUE))
+        , mapping(std::exchange(other.mapping, nullptr))
+        , mappedAddress(std::exchange(other.mappedAddress, nullptr))
+        , size(std::exchange(other.size, 0))
+    {}
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept
+    {
+        Close();
+        file = std::exchange(rhs.file, INVALID_HANDLE_VALUE);
+        mapping = std::exchange(rhs.mapping, nullptr);
+        mappedAddress = std::exchange(rhs.mappedAddress, nullptr);
+        size = std::exchange(rhs.size, 0);
+        return *this;
+    }
+
+    bool MappedFile::Open(const Path& path)
+    {
+        Close();
+
+        file = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            /* 크기가 0인 파일은 매핑 할 수 없음 */
+            Close();
+            return false;
+        }
+
+        mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            IG_LOG(MappedFileLog, Error, "Failed to create file mapping of {}. Error: {}", path.string(), GetLastError());
+            Close();
+            return false;
+        }
+
+        mappedAddress = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (mappedAddress == nullptr)
+        {
+            IG_LOG(MappedFileLog, Error, "Failed to map view of {}. Error: {}", path.string(), GetLastError());
+            Close();
+            return false;
+        }
+
+        size = static_cast<Size>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (mappedAddress != nullptr)
+        {
+            UnmapViewOfFile(mappedAddress);
+            mappedAddress = nullptr;
+        }
+
+        if (mapping != nullptr)
+        {
+            CloseHandle(mapping);
+            mapping = nullptr;
+        }
+
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+            file = INVALID_HANDLE_VALUE;
+        }
+
+        size = 0;
+    }
+} // namespace ig
@@ -0,0 +1,38 @@
+#pragma once
+#include "Igniter/Igniter.h"
+
+namespace ig
+{
+    /* 읽기 전용 메모리 매핑 파일. 매핑이 유지되는 동안 파일을 덮어쓸 수 없으므로, 쓰기 전에 반드시 Close 해야 함. */
+    class MappedFile final
+    {
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        ~MappedFile();
+
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile& operator=(MappedFile&& rhs) noexcept;
+
+        [[nodiscard]] bool Open(const Path& path);
+        void Close();
+
+        [[nodiscard]] bool IsOpened() const noexcept { return mappedAddress != nullptr; }
+        [[nodiscard]] Size GetSize() const noexcept { return size; }
+        [[nodiscard]] const U8* GetData() const noexcept { return reinterpret_cast<const U8*>(mappedAddress); }
+
+        [[nodiscard]] std::span<const U8> GetSpan(const Size offset, const Size sizeInBytes) const
+        {
+            IG_CHECK(IsOpened());
+            IG_CHECK(offset + sizeInBytes <= size);
+            return std::span<const U8>{GetData() + offset, sizeInBytes};
+        }
+
+    private:
+        HANDLE file{INVALID_HANDLE_VALUE};
+        HANDLE mapping{nullptr};
+        const void* mappedAddress{nullptr};
+        Size size{0};
+    };
+} // namespace ig
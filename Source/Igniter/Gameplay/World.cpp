@@ -72,6 +72,16 @@ namespace ig
         return archive;
     }
 
+    Json& World::AddSerializedComponent(Json& archive, const U32 entityId, const entt::id_type componentTypeId)
+    {
+        const auto nameProperty = entt::resolve(componentTypeId).prop(meta::NameProperty);
+        IG_CHECK(nameProperty);
+
+        Json& componentRoot = archive[EntitiesDataKey][std::format("{}", entityId)][std::format("{}", componentTypeId)];
+        componentRoot[ComponentNameHintKey] = *nameProperty.value().try_cast<std::string>();
+        return componentRoot;
+    }
+
     const Json& World::Deserialize(const Json& archive)
     {
         // #sy_note Registry가 비어있을 때만 호출되나?
@@ -29,6 +29,9 @@ namespace ig
         Json& Serialize(Json& archive) const;
         const Json& Deserialize(const Json& archive);
 
+        /* 런타임 World 없이 직렬화 된 World(archive)를 구성 할 때 사용 (ex. 씬 임포트). 반환 된 Json 에 컴포넌트 데이터를 기록 한다. */
+        static Json& AddSerializedComponent(Json& archive, const U32 entityId, const entt::id_type componentTypeId);
+
     private:
         constexpr static std::string_view EntitiesDataKey = "Entities";
         constexpr static std::string_view ComponentNameHintKey = "NameHint";
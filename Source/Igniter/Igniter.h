@@ -3,9 +3,11 @@
 #pragma warning(disable : 4530)
 #include <array>
 #include <bitset>
+#include <bit>
 #include <functional>
 #include <optional>
 #include <queue>
+#include <deque>
 #include <ranges>
 #include <span>
 #include <variant>
@@ -32,6 +34,7 @@
 #include <variant>
 #include <any>
 #include <future>
+#include <condition_variable>
 #include <coroutine>
 #include <regex>
 #include <numbers>
@@ -1,6 +1,8 @@
 #pragma once
 #include "Igniter/Core/BoundingVolume.h"
+#include "Igniter/D3D12/GpuSyncPoint.h"
 #include "Igniter/Render/Common.h"
+#include "Igniter/Render/Vertex.h"
 
 namespace ig
 {
@@ -38,8 +40,17 @@ namespace ig
     public:
         Handle<MeshVertex> VertexStorageAlloc{};
         U8 NumLevelOfDetails = 0;
+        /* 상주 중인 가장 세밀한 LOD. [MinResidentLevelOfDetail, NumLevelOfDetails) 구간의 LOD 만 유효한 할당을 가진다. */
+        U8 MinResidentLevelOfDetail = 0;
         MeshLod LevelOfDetails[kMaxMeshLevelOfDetails];
         AABB BoundingBox{};
+        /* true 인 경우 각 LOD는 Cluster LOD 계층의 한 단계이며, 셰이더에서 Meshlet 단위로 LOD를 선택한다. */
+        bool bClusterHierarchy = false;
+        /* VertexStorageAlloc 에 저장 된 정점의 형식. Full 이 아닌 경우 Dequantization 으로 복원 한다. */
+        EVertexFormat VertexFormat = EVertexFormat::Full;
+        VertexDequantization Dequantization{};
+        /* 메시 데이터 업로드 완료 시점. GPU 에서 메시 데이터를 참조하기 전에 반드시 대기 해야 한다. */
+        GpuSyncPoint UploadSync{};
     };
 
     /* Meshlet의 경우 단순 데이터이기 때문에, 별도의 CPU/GPU 간 데이터 레이아웃의 차이가 없다 */
@@ -65,6 +76,37 @@ namespace ig
 
         U8 QuantizedNormalConeAxis[3];
         U8 QuantizedNormalConeCutoff;
+
+        /*
+         * Cluster LOD 계층(Mesh::bClusterHierarchy)에서의 오차 경계 (메시 로컬 공간)
+         * LodBounds/LodError: 이 Meshlet을 생성한 그룹의 경계와 단순화 오차 (LOD0 의 경우 0)
+         * ParentLodBounds/ParentLodError: 이 Meshlet을 단순화하여 상위 Meshlet들을 생성한 그룹의 경계와 오차 (최상위인 경우 FLT_MAX)
+         * 항상 LodError <= ParentLodError 이며, ParentLodBounds 는 LodBounds 를 포함한다.
+         */
+        BoundingSphere LodBounds{};
+        F32 LodError = 0.f;
+        BoundingSphere ParentLodBounds{};
+        F32 ParentLodError = FLT_MAX;
+    };
+
+    /*
+     * 스키닝 된 Meshlet(또는 메시)의 경계를 구성하는 Bone 단위 경계. CPU/GPU 간 데이터 레이아웃의 차이가 없다.
+     * BoneSpaceBounds 는 Bone 의 공간(Inverse Bind Matrix 적용 후)에서 해당 Bone 의 영향을 받는 정점 들을 감싸는 구 이다.
+     * 스키닝 된 정점은 영향을 주는 Bone 변환 결과 들의 볼록 결합 이므로, 현재 포즈의 Bone 변환을 적용한 구 들의 합집합이 정점 들을 포함한다.
+     */
+    struct MeshletBoneBounds
+    {
+    public:
+        BoundingSphere BoneSpaceBounds{};
+        U32 BoneIdx = 0;
+    };
+
+    /* Meshlet 별 MeshletBoneBounds 구간. 인덱스는 Meshlet 과 같다. */
+    struct MeshletBoneBoundsRange
+    {
+    public:
+        U32 Offset = 0;
+        U32 NumBoneBounds = 0;
     };
 
     struct GpuMeshLod
@@ -86,7 +128,14 @@ namespace ig
 
         U32 bOverrideLodScreenCoverageThreshold = false;
         F32 LodScreenCoverageThresholds[Mesh::kMaxMeshLevelOfDetails];
-        U32 Padding = 0xFFFFFFFF;
+        U32 MinResidentLevelOfDetail = 0;
+        U32 bClusterHierarchy = false;
+
+        U32 VertexFormat = 0;
+        Vector3 PositionDequantizeOffset{0.f, 0.f, 0.f};
+        Vector3 PositionDequantizeScale{1.f, 1.f, 1.f};
+        Vector2 TexCoordDequantizeOffset{0.f, 0.f};
+        Vector2 TexCoordDequantizeScale{1.f, 1.f};
     };
 
     struct GpuMeshInstance
@@ -28,6 +28,7 @@ namespace ig
     {
         ResizeMeshInstanceIndicesBuffer(kInitNumMeshInstanceIndices);
 
+        pendingMeshUploadSyncPoints.resize(numWorkers);
         meshInstanceIndicesUploadInfos.reserve(numWorkers);
         meshInstanceIndicesGroups.resize(numWorkers);
         const Size initNumMeshInstanceIndicesPerWorker = kInitNumMeshInstanceIndices / numWorkers;
@@ -221,7 +222,22 @@ namespace ig
 
         tf::Task finalizeReplication = replicationSubflow.emplace([this]()
         {
-            if (!replicationSyncPoint.IsValid())
+            GpuSyncPoint latestMeshUploadSync{};
+            for (GpuSyncPoint& pendingUploadSync : pendingMeshUploadSyncPoints)
+            {
+                latestMeshUploadSync = (!latestMeshUploadSync || latestMeshUploadSync < pendingUploadSync) ? pendingUploadSync : latestMeshUploadSync;
+                pendingUploadSync = GpuSyncPoint::Invalid();
+            }
+
+            /* 메시 로더는 업로드 완료를 CPU 에서 기다리지 않기 때문에, 복제 된 메시 데이터를 참조 하기 전 GPU 에서 대기 */
+            if (latestMeshUploadSync)
+            {
+                CommandQueue& asyncCopyQueue = renderContext->GetFrameCriticalAsyncCopyQueue();
+                IG_CHECK(asyncCopyQueue.GetType() == EQueueType::Copy);
+                asyncCopyQueue.Wait(latestMeshUploadSync);
+                replicationSyncPoint = asyncCopyQueue.MakeSyncPointWithSignal();
+            }
+            else if (!replicationSyncPoint.IsValid())
             {
                 CommandQueue& asyncCopyQueue = renderContext->GetFrameCriticalAsyncCopyQueue();
                 IG_CHECK(asyncCopyQueue.GetType() == EQueueType::Copy);
@@ -406,15 +422,37 @@ namespace ig
 
             GpuMaterial newData{};
             const Texture* diffuseTexturePtr = assetManager->Lookup(materialPtr->GetDiffuse());
-            if (diffuseTexturePtr != nullptr)
+            /* 서브 텍스처는 자신이 패킹 된 텍스처 배열/아틀라스의 SRV 와 Sampler 를 공유 한다. */
+            const Texture* sampledTexturePtr = (diffuseTexturePtr != nullptr && diffuseTexturePtr->IsSubTexture()) ?
+                assetManager->Lookup(diffuseTexturePtr->GetPackedTexture()) :
+                diffuseTexturePtr;
+            if (sampledTexturePtr != nullptr)
             {
-                const GpuView* srvPtr = renderContext->Lookup(diffuseTexturePtr->GetShaderResourceView());
+                const GpuView* srvPtr = renderContext->Lookup(sampledTexturePtr->GetShaderResourceView());
                 IG_CHECK(srvPtr != nullptr);
                 newData.DiffuseTextureSrv = srvPtr->Index;
 
-                const GpuView* sampler = renderContext->Lookup(diffuseTexturePtr->GetSampler());
+                const GpuView* sampler = renderContext->Lookup(sampledTexturePtr->GetSampler());
                 IG_CHECK(sampler != nullptr);
                 newData.DiffuseTextureSampler = sampler->Index;
+
+                if (diffuseTexturePtr->IsSubTexture())
+                {
+                    const TextureLoadDesc& subLoadDesc = diffuseTexturePtr->GetSnapshot().LoadDescriptor;
+                    const TextureLoadDesc& packedLoadDesc = sampledTexturePtr->GetSnapshot().LoadDescriptor;
+                    if (packedLoadDesc.IsArray())
+                    {
+                        newData.DiffuseTextureSlice = subLoadDesc.PackedArraySlice;
+                    }
+                    else
+                    {
+                        const F32 packedWidth = static_cast<F32>(std::max(packedLoadDesc.Width, 1u));
+                        const F32 packedHeight = static_cast<F32>(std::max(packedLoadDesc.Height, 1u));
+                        newData.DiffuseUvRect = Vector4{
+                            subLoadDesc.PackedOffsetX / packedWidth, subLoadDesc.PackedOffsetY / packedHeight,
+                            subLoadDesc.Width / packedWidth, subLoadDesc.Height / packedHeight};
+                    }
+                }
             }
 
             if (const U64 currentDataHashValue = HashInstance(newData);
@@ -491,9 +529,24 @@ namespace ig
                         IG_CHECK(vertexAllocPtr != nullptr);
                         proxy.GpuData.VertexStorageByteOffset = (U32)vertexAllocPtr->Alloc.Offset;
                         proxy.GpuData.NumLevelOfDetails = mesh.NumLevelOfDetails;
+                        proxy.GpuData.MinResidentLevelOfDetail = mesh.MinResidentLevelOfDetail;
+                        proxy.GpuData.bClusterHierarchy = mesh.bClusterHierarchy;
+                        proxy.GpuData.VertexFormat = (U32)mesh.VertexFormat;
+                        proxy.GpuData.PositionDequantizeOffset = mesh.Dequantization.PositionOffset;
+                        proxy.GpuData.PositionDequantizeScale = mesh.Dequantization.PositionScale;
+                        proxy.GpuData.TexCoordDequantizeOffset = mesh.Dequantization.TexCoordOffset;
+                        proxy.GpuData.TexCoordDequantizeScale = mesh.Dequantization.TexCoordScale;
                         proxy.GpuData.bOverrideLodScreenCoverageThreshold = latestLoadDesc->bOverrideLodScreenCoverageThresholds;
                         for (U8 lod = 0; lod < proxy.GpuData.NumLevelOfDetails; ++lod)
                         {
+                            proxy.GpuData.LodScreenCoverageThresholds[lod] = latestLoadDesc->LodScreenCoverageThresholds[lod];
+                            /* 상주 하지 않는 LOD는 셰이더에서 MinResidentLevelOfDetail로 대체 된다. */
+                            if (lod < mesh.MinResidentLevelOfDetail)
+                            {
+                                proxy.GpuData.LevelOfDetails[lod] = {};
+                                continue;
+                            }
+
                             const MeshLod& meshLod = mesh.LevelOfDetails[lod];
                             const GpuStorage::Allocation* indexStorageAllocPtr = unifiedMeshStorage.Lookup(meshLod.IndexStorageAlloc);
                             IG_CHECK(indexStorageAllocPtr != nullptr);
@@ -507,11 +560,16 @@ namespace ig
                             gpuMeshLod.TriangleStorageOffset = (U32)triangleStorageAllocPtr->OffsetIndex;
                             gpuMeshLod.MeshletStorageOffset = (U32)meshletStorageAllocPtr->OffsetIndex;
                             gpuMeshLod.NumMeshlets = (U32)meshletStorageAllocPtr->NumElements;
-
-                            proxy.GpuData.LodScreenCoverageThresholds[lod] = latestLoadDesc->LodScreenCoverageThresholds[lod];
                         }
                         proxy.GpuData.MeshBoundingSphere = ToBoundingSphere(mesh.BoundingBox);
 
+                        /* 모든 메시 업로드는 같은 업로더(큐)를 통해 제출 되기 때문에, 가장 마지막 동기화 지점만 기다리면 충분 */
+                        if (mesh.UploadSync && !mesh.UploadSync.IsExpired())
+                        {
+                            GpuSyncPoint& pendingUploadSync{pendingMeshUploadSyncPoints[workerId]};
+                            pendingUploadSync = (!pendingUploadSync || pendingUploadSync < mesh.UploadSync) ? mesh.UploadSync : pendingUploadSync;
+                        }
+
                         proxy.DataHashValue = currentDataHashValue;
                         staticMeshProxyPackage.PendingReplicationGroups[workerId].emplace_back(cachedStaticMesh);
                     }
@@ -153,6 +153,8 @@ namespace ig
         ProxyPackage<MaterialProxy, Handle<Material>> materialProxyPackage;
         constexpr static U32 kNumInitMeshProxies = 512u;
         ProxyPackage<MeshProxy, Handle<StaticMesh>> staticMeshProxyPackage;
+        /* Worker 별, 이번 프레임에 복제 되는 메시 중 아직 업로드가 완료 되지 않은 가장 마지막 업로드 동기화 지점 */
+        Vector<GpuSyncPoint> pendingMeshUploadSyncPoints;
         //ProxyPackage<MeshProxy, Handle<class SkeletalMesh>> skeletalMeshProxyPackage;
 
         ProxyPackage<MeshInstanceProxy> meshInstanceProxyPackage;
@@ -210,6 +210,62 @@ namespace ig
         meshletDeferredManagePackage.DeferredDestroyPendingList[currentLocalFrameIdx].emplace_back(handle.Value);
     }
 
+    void UnifiedMeshStorage::Deallocate(const Handle<MeshVertex> handle, const GpuSyncPoint& uploadSync)
+    {
+        if (!handle)
+        {
+            return;
+        }
+
+        PushUploadPendingDeallocation(UploadPendingDeallocation{.UploadSync = uploadSync, .VertexStorageAlloc = handle});
+    }
+
+    void UnifiedMeshStorage::Deallocate(const MeshLod& meshLod, const GpuSyncPoint& uploadSync)
+    {
+        if (!meshLod.IndexStorageAlloc && !meshLod.TriangleStorageAlloc && !meshLod.MeshletStorageAlloc)
+        {
+            return;
+        }
+
+        PushUploadPendingDeallocation(UploadPendingDeallocation{.UploadSync = uploadSync, .Lod = meshLod});
+    }
+
+    void UnifiedMeshStorage::PushUploadPendingDeallocation(UploadPendingDeallocation&& deallocation)
+    {
+        if (!deallocation.UploadSync || deallocation.UploadSync.IsExpired())
+        {
+            Deallocate(deallocation.VertexStorageAlloc);
+            Deallocate(deallocation.Lod.IndexStorageAlloc);
+            Deallocate(deallocation.Lod.TriangleStorageAlloc);
+            Deallocate(deallocation.Lod.MeshletStorageAlloc);
+            return;
+        }
+
+        UniqueLock uploadPendingListLock{uploadPendingListMutex[currentLocalFrameIdx]};
+        uploadPendingList[currentLocalFrameIdx].emplace_back(std::move(deallocation));
+    }
+
+    Size UnifiedMeshStorage::GetResidentSize(const Mesh& mesh) const noexcept
+    {
+        Size residentSize = 0;
+        if (const MeshVertexAllocation* vertexAllocPtr = Lookup(mesh.VertexStorageAlloc);
+            vertexAllocPtr != nullptr)
+        {
+            residentSize += vertexAllocPtr->Alloc.AllocSize;
+        }
+
+        for (U8 lod = mesh.MinResidentLevelOfDetail; lod < mesh.NumLevelOfDetails; ++lod)
+        {
+            const MeshLod& meshLod = mesh.LevelOfDetails[lod];
+            for (const GpuStorage::Allocation* allocPtr : {Lookup(meshLod.IndexStorageAlloc), Lookup(meshLod.TriangleStorageAlloc), Lookup(meshLod.MeshletStorageAlloc)})
+            {
+                residentSize += allocPtr != nullptr ? allocPtr->AllocSize : 0;
+            }
+        }
+
+        return residentSize;
+    }
+
     const MeshVertexAllocation* UnifiedMeshStorage::Lookup(const Handle<MeshVertex> handle) const noexcept
     {
         if (!handle)
@@ -259,6 +315,26 @@ namespace ig
         IG_CHECK(localFrameIdx < NumFramesInFlight);
         currentLocalFrameIdx = localFrameIdx;
 
+        /* 현재 프레임의 목록은 한 주기 동안 GPU 에서 참조 되지 않았으므로, 업로드만 끝났다면 바로 해제 할 수 있다. */
+        {
+            UniqueLock uploadPendingListLock{uploadPendingListMutex[currentLocalFrameIdx]};
+            Vector<UploadPendingDeallocation>& pendingList{uploadPendingList[currentLocalFrameIdx]};
+            const auto expiredItr = std::partition(pendingList.begin(), pendingList.end(),
+                [](const UploadPendingDeallocation& deallocation)
+                {
+                    return !deallocation.UploadSync.IsExpired();
+                });
+
+            for (auto itr = expiredItr; itr != pendingList.end(); ++itr)
+            {
+                Deallocate(itr->VertexStorageAlloc);
+                Deallocate(itr->Lod.IndexStorageAlloc);
+                Deallocate(itr->Lod.TriangleStorageAlloc);
+                Deallocate(itr->Lod.MeshletStorageAlloc);
+            }
+            pendingList.erase(expiredItr, pendingList.end());
+        }
+
         {
             ScopedLock packageLock{
                 vertexDeferredManagePackage.StorageMutex,
@@ -51,12 +51,21 @@ namespace ig
         void Deallocate(const Handle<MeshIndex> handle);
         void Deallocate(const Handle<MeshTriangle> handle);
         void Deallocate(const Handle<Meshlet> handle);
+        /*
+         * 업로드가 진행 중인 공간을 해제 후 재할당 하면, 복사 명령이 새로운 데이터를 덮어 쓸 수 있다.
+         * uploadSync 가 만료 될 때 까지 해제를 미루며, 호출 스레드를 대기 시키지 않는다.
+         */
+        void Deallocate(const Handle<MeshVertex> handle, const GpuSyncPoint& uploadSync);
+        void Deallocate(const MeshLod& meshLod, const GpuSyncPoint& uploadSync);
 
         [[nodiscard]] const MeshVertexAllocation* Lookup(const Handle<MeshVertex> handle) const noexcept;
         [[nodiscard]] const GpuStorage::Allocation* Lookup(const Handle<MeshIndex> handle) const noexcept;
         [[nodiscard]] const GpuStorage::Allocation* Lookup(const Handle<MeshTriangle> handle) const noexcept;
         [[nodiscard]] const GpuStorage::Allocation* Lookup(const Handle<Meshlet> handle) const noexcept;
 
+        /* 메시의 정점과 상주 중인 LOD 들이 차지 하는 저장소 크기 */
+        [[nodiscard]] Size GetResidentSize(const Mesh& mesh) const noexcept;
+
         void PreRender(const LocalFrameIndex localFrameIdx);
 
         [[nodiscard]] Handle<GpuBuffer> GetVertexStorageBuffer() const noexcept { return vertexStorage.GetGpuBuffer(); }
@@ -75,8 +84,18 @@ namespace ig
 
         [[nodiscard]] Handle<GpuView> GetStorageConstantsCbv() const noexcept { return gpuStorageConstantsCbv; }
 
+    private:
+        struct UploadPendingDeallocation
+        {
+        public:
+            GpuSyncPoint UploadSync{};
+            Handle<MeshVertex> VertexStorageAlloc{};
+            MeshLod Lod{};
+        };
+
     private:
         Handle<MeshVertex> AllocateVertices(const Size numVertices, const Size numDwordsPerVertex);
+        void PushUploadPendingDeallocation(UploadPendingDeallocation&& deallocation);
 
     private:
         RenderContext* renderContext = nullptr;
@@ -120,6 +139,10 @@ namespace ig
         Size numAllocMeshlets = 0;
         DeferredResourceManagePackage<GpuStorage::Allocation> meshletDeferredManagePackage;
 
+        /* 업로드가 끝나지 않아 해제가 미뤄진 할당. 프레임 마다 확인 하여, 만료 된 경우 지연 해제 목록으로 옮긴다. */
+        InFlightFramesResource<Mutex> uploadPendingListMutex;
+        InFlightFramesResource<Vector<UploadPendingDeallocation>> uploadPendingList;
+
         GpuStorageConstants gpuStorageConstants;
         Handle<GpuBuffer> gpuStorageConstantsBuffer;
         Handle<GpuView> gpuStorageConstantsCbv;
@@ -1,5 +1,6 @@
 #pragma once
 #include "Igniter/Igniter.h"
+#include "Igniter/Core/BoundingVolume.h"
 
 namespace ig
 {
@@ -48,6 +49,97 @@ namespace ig
             ((U32)(rgba.w * 255.f) << 24);
     }
 
+    /* [-1, 1]^3 (단위 벡터) -> [-1, 1]^2 */
+    inline Vector2 EncodeOctahedral(const Vector3& normal)
+    {
+        const F32 l1Norm = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+        if (l1Norm <= 0.f)
+        {
+            return Vector2{0.f, 0.f};
+        }
+
+        const F32 x = normal.x / l1Norm;
+        const F32 y = normal.y / l1Norm;
+        if (normal.z >= 0.f)
+        {
+            return Vector2{x, y};
+        }
+
+        return Vector2{
+            (1.f - std::abs(y)) * (x >= 0.f ? 1.f : -1.f),
+            (1.f - std::abs(x)) * (y >= 0.f ? 1.f : -1.f)
+        };
+    }
+
+    inline Vector3 DecodeOctahedral(const Vector2& encoded)
+    {
+        Vector3 normal{encoded.x, encoded.y, 1.f - std::abs(encoded.x) - std::abs(encoded.y)};
+        const F32 t = std::max(-normal.z, 0.f);
+        normal.x += normal.x >= 0.f ? -t : t;
+        normal.y += normal.y >= 0.f ? -t : t;
+        normal.Normalize();
+        return normal;
+    }
+
+    /* Normal 에 수직인 기준 Tangent/Bitangent. 셰이더(DecodeTangentFrame)와 동일 해야 한다. */
+    inline void MakeTangentFrameBasis(const Vector3& normal, Vector3& referenceTangent, Vector3& referenceBitangent)
+    {
+        referenceTangent = std::abs(normal.x) > std::abs(normal.z) ? Vector3{-normal.y, normal.x, 0.f} : Vector3{0.f, -normal.z, normal.y};
+        referenceTangent.Normalize();
+        referenceBitangent = normal.Cross(referenceTangent);
+    }
+
+    /*
+     * Octahedral Normal(x: 10 Bits, y: 10 Bits) | Tangent Angle(11 Bits) | Bitangent Sign(1 Bit)
+     * Tangent 는 Normal 로 부터 유도 된 기준 축에 대한 각도로, Bitangent 는 cross(Normal, Tangent) 의 부호로 표현 한다.
+     */
+    inline U32 EncodeTangentFrame(const Vector3& normal, const Vector3& tangent, const Vector3& bitangent)
+    {
+        constexpr F32 kTwoPi = 2.f * std::numbers::pi_v<F32>;
+        const Vector2 octahedral = EncodeOctahedral(normal);
+        const U32 octahedralX = (U32)std::lround((std::clamp(octahedral.x, -1.f, 1.f) * 0.5f + 0.5f) * 1023.f);
+        const U32 octahedralY = (U32)std::lround((std::clamp(octahedral.y, -1.f, 1.f) * 0.5f + 0.5f) * 1023.f);
+
+        /* 디코딩 시와 같은 기준 축을 사용하기 위해, 양자화 된 Normal 로 부터 기준 축을 만든다. */
+        const Vector3 decodedNormal = DecodeOctahedral(Vector2{(F32)octahedralX / 1023.f * 2.f - 1.f, (F32)octahedralY / 1023.f * 2.f - 1.f});
+        Vector3 referenceTangent{};
+        Vector3 referenceBitangent{};
+        MakeTangentFrameBasis(decodedNormal, referenceTangent, referenceBitangent);
+        const F32 angle = std::atan2(tangent.Dot(referenceBitangent), tangent.Dot(referenceTangent));
+        const U32 quantizedAngle = (U32)std::lround((angle / kTwoPi + 0.5f) * 2047.f) & 0x7FF;
+        const U32 bitangentSign = normal.Cross(tangent).Dot(bitangent) < 0.f ? 1 : 0;
+
+        return octahedralX | (octahedralY << 10) | (quantizedAngle << 20) | (bitangentSign << 31);
+    }
+
+    inline void DecodeTangentFrame(const U32 encodedTangentFrame, Vector3& normal, Vector3& tangent, Vector3& bitangent)
+    {
+        constexpr F32 kTwoPi = 2.f * std::numbers::pi_v<F32>;
+        normal = DecodeOctahedral(Vector2{
+            (F32)(encodedTangentFrame & 0x3FF) / 1023.f * 2.f - 1.f,
+            (F32)((encodedTangentFrame >> 10) & 0x3FF) / 1023.f * 2.f - 1.f
+        });
+
+        Vector3 referenceTangent{};
+        Vector3 referenceBitangent{};
+        MakeTangentFrameBasis(normal, referenceTangent, referenceBitangent);
+        const F32 angle = ((F32)((encodedTangentFrame >> 20) & 0x7FF) / 2047.f - 0.5f) * kTwoPi;
+        tangent = referenceTangent * std::cos(angle) + referenceBitangent * std::sin(angle);
+        bitangent = normal.Cross(tangent) * (((encodedTangentFrame >> 31) & 1) != 0 ? -1.f : 1.f);
+    }
+
+    /*
+     * Full: Vertex
+     * Quantized: QuantizedVertex, UV 는 Half
+     * QuantizedUnormTexCoords: QuantizedVertex, UV 는 메시의 UV 범위에 대한 Unorm16
+     */
+    enum class EVertexFormat : U8
+    {
+        Full,
+        Quantized,
+        QuantizedUnormTexCoords
+    };
+
     struct VertexBase
     {
         Vector3 Position;
@@ -67,4 +159,136 @@ namespace ig
         U16 QuantizedTexCoords[2]; /* (F32, F32) -> (F16, F16) = HLSL(float16_t, float16_t); https://github.com/zeux/meshoptimizer/blob/master/src/quantization.cpp*/
         U32 ColorRGBA8_U32;        /* R8G8B8A8_UINT */
     };
+
+    /* Vertex 의 절반 크기. Vertex Color는 포함하지 않는다. */
+    struct QuantizedVertex
+    {
+        U16 QuantizedPosition[4];  /* xyz: 메시 AABB에 대한 Unorm16, w: 사용 하지 않음 */
+        U32 TangentFrame;          /* EncodeTangentFrame */
+        U16 QuantizedTexCoords[2]; /* Half 또는 UV 범위에 대한 Unorm16 (EVertexFormat) */
+    };
+    static_assert(sizeof(QuantizedVertex) == 16);
+
+    /* 스켈레탈 메시 정점. 최대 4개의 Bone 영향을 가지며, 가중치는 합이 255 인 Unorm8 로 양자화 된다. */
+    struct SkinnedVertex
+    {
+        constexpr static U8 kMaxInfluences = 4;
+
+        Vector3 Position;
+        U32 QuantizedNormal;    /* Vertex 와 동일 */
+        U32 QuantizedTangent;   /* Vertex 와 동일 */
+        U32 QuantizedBitangent; /* Vertex 와 동일 */
+        U16 QuantizedTexCoords[2];
+        U32 ColorRGBA8_U32;
+        U8 BoneIndices[kMaxInfluences]; /* 스켈레톤 내 Bone 인덱스 */
+        U8 BoneWeights[kMaxInfluences]; /* [0, 1] -> [0, 255] */
+    };
+    static_assert(sizeof(SkinnedVertex) == sizeof(Vertex) + 8);
+
+    /* Dequantize(q) = Offset + (q / 65535) * Scale */
+    struct VertexDequantization
+    {
+    public:
+        Vector3 PositionOffset{0.f, 0.f, 0.f};
+        Vector3 PositionScale{1.f, 1.f, 1.f};
+        Vector2 TexCoordOffset{0.f, 0.f};
+        Vector2 TexCoordScale{1.f, 1.f};
+    };
+
+    inline Size GetVertexSize(const EVertexFormat format)
+    {
+        return format == EVertexFormat::Full ? sizeof(Vertex) : sizeof(QuantizedVertex);
+    }
+
+    inline VertexDequantization MakeVertexDequantization(const AABB& positionBounds, const Vector2& texCoordMin, const Vector2& texCoordMax)
+    {
+        return VertexDequantization{
+            .PositionOffset = positionBounds.Min,
+            .PositionScale = positionBounds.Max - positionBounds.Min,
+            .TexCoordOffset = texCoordMin,
+            .TexCoordScale = texCoordMax - texCoordMin
+        };
+    }
+
+    inline U16 QuantizeUnorm16(const F32 value, const F32 offset, const F32 scale)
+    {
+        if (scale <= 0.f)
+        {
+            return 0;
+        }
+
+        return (U16)std::lround(std::clamp((value - offset) / scale, 0.f, 1.f) * 65535.f);
+    }
+
+    inline F32 DequantizeUnorm16(const U16 quantized, const F32 offset, const F32 scale)
+    {
+        return offset + ((F32)quantized / 65535.f) * scale;
+    }
+
+    /* 텍스처 좌표는 임포트 시 이미 EVertexFormat 에 맞게 양자화 되어 있다고 가정한다. */
+    inline QuantizedVertex QuantizeVertex(const Vertex& vertex, const VertexDequantization& dequantization)
+    {
+        QuantizedVertex quantizedVertex{};
+        quantizedVertex.QuantizedPosition[0] = QuantizeUnorm16(vertex.Position.x, dequantization.PositionOffset.x, dequantization.PositionScale.x);
+        quantizedVertex.QuantizedPosition[1] = QuantizeUnorm16(vertex.Position.y, dequantization.PositionOffset.y, dequantization.PositionScale.y);
+        quantizedVertex.QuantizedPosition[2] = QuantizeUnorm16(vertex.Position.z, dequantization.PositionOffset.z, dequantization.PositionScale.z);
+        quantizedVertex.TangentFrame = EncodeTangentFrame(
+            DecodeNormalX10Y10Z10(vertex.QuantizedNormal),
+            DecodeNormalX10Y10Z10(vertex.QuantizedTangent),
+            DecodeNormalX10Y10Z10(vertex.QuantizedBitangent));
+        quantizedVertex.QuantizedTexCoords[0] = vertex.QuantizedTexCoords[0];
+        quantizedVertex.QuantizedTexCoords[1] = vertex.QuantizedTexCoords[1];
+        return quantizedVertex;
+    }
+
+    inline Vector3 DequantizePosition(const QuantizedVertex& quantizedVertex, const VertexDequantization& dequantization)
+    {
+        return Vector3{
+            DequantizeUnorm16(quantizedVertex.QuantizedPosition[0], dequantization.PositionOffset.x, dequantization.PositionScale.x),
+            DequantizeUnorm16(quantizedVertex.QuantizedPosition[1], dequantization.PositionOffset.y, dequantization.PositionScale.y),
+            DequantizeUnorm16(quantizedVertex.QuantizedPosition[2], dequantization.PositionOffset.z, dequantization.PositionScale.z)
+        };
+    }
+
+    /*
+     * 합이 1 이 되도록 정규화 한 가중치를 합이 정확히 255 가 되도록 양자화 한다. (Largest Remainder)
+     * 스키닝 결과가 항상 Bone 변환 들의 볼록 결합이 되어, 셰이더에서 재정규화 할 필요가 없다. 모든 가중치가 0 이라면 첫 영향에 255 를 부여 한다.
+     */
+    inline void QuantizeBoneWeights(const std::span<const F32, SkinnedVertex::kMaxInfluences> weights, U8 (&quantizedWeights)[SkinnedVertex::kMaxInfluences])
+    {
+        F32 weightSum = 0.f;
+        for (const F32 weight : weights)
+        {
+            weightSum += std::max(weight, 0.f);
+        }
+
+        if (weightSum <= 0.f)
+        {
+            std::fill(std::begin(quantizedWeights), std::end(quantizedWeights), (U8)0);
+            quantizedWeights[0] = 255;
+            return;
+        }
+
+        F32 remainders[SkinnedVertex::kMaxInfluences]{};
+        U32 quantizedSum = 0;
+        for (U8 influenceIdx = 0; influenceIdx < SkinnedVertex::kMaxInfluences; ++influenceIdx)
+        {
+            const F32 scaled = std::max(weights[influenceIdx], 0.f) / weightSum * 255.f;
+            const F32 floored = std::floor(scaled);
+            quantizedWeights[influenceIdx] = (U8)floored;
+            remainders[influenceIdx] = scaled - floored;
+            quantizedSum += quantizedWeights[influenceIdx];
+        }
+
+        for (; quantizedSum < 255; ++quantizedSum)
+        {
+            U8 largestRemainderIdx = 0;
+            for (U8 influenceIdx = 1; influenceIdx < SkinnedVertex::kMaxInfluences; ++influenceIdx)
+            {
+                largestRemainderIdx = remainders[influenceIdx] > remainders[largestRemainderIdx] ? influenceIdx : largestRemainderIdx;
+            }
+            ++quantizedWeights[largestRemainderIdx];
+            remainders[largestRemainderIdx] = -1.f;
+        }
+    }
 } // namespace ig
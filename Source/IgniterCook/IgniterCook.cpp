@@ -0,0 +1 @@
+#include "IgniterCook/IgniterCook.h"
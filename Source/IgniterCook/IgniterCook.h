@@ -0,0 +1,4 @@
+#pragma once
+#include "Igniter/Igniter.h"
+#include "Igniter/Core/String.h"
+#include <iostream>
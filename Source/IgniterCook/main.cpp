@@ -0,0 +1,83 @@
+#include "IgniterCook/IgniterCook.h"
+#include "Igniter/Asset/AssetCooker.h"
+
+/*
+ * IgniterCook <Manifest.json | ResourceDirectory> [--root <ProjectRoot>] [--report <Report.json>] [--jobs <NumWorkers>]
+ * 반환 값 => 0: 모든 항목 쿠킹 성공, 1: 하나 이상의 항목 쿠킹 실패, 2: 잘못된 인자 또는 매니페스트
+ */
+namespace
+{
+    constexpr std::string_view kUsage{"Usage: IgniterCook <Manifest.json | ResourceDirectory> [--root <ProjectRoot>] [--report <Report.json>] [--jobs <NumWorkers>]\n"};
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << kUsage;
+        return 2;
+    }
+
+    const ig::Path input{ig::fs::absolute(argv[1])};
+    ig::Path reportPath{};
+    ig::Size numWorkers{std::thread::hardware_concurrency()};
+    for (int argIdx = 2; argIdx < argc; argIdx += 2)
+    {
+        const std::string_view option{argv[argIdx]};
+        if (argIdx + 1 >= argc)
+        {
+            std::cerr << std::format("Missing value for option {}\n", option) << kUsage;
+            return 2;
+        }
+
+        if (option == "--root")
+        {
+            /* 에셋은 작업 디렉터리를 기준으로 'Assets\{Type}\{GUID}' 에 기록 된다. */
+            ig::fs::current_path(argv[argIdx + 1]);
+        }
+        else if (option == "--report")
+        {
+            reportPath = ig::fs::absolute(argv[argIdx + 1]);
+        }
+        else if (option == "--jobs")
+        {
+            numWorkers = std::max<ig::Size>(std::strtoull(argv[argIdx + 1], nullptr, 10), 1);
+        }
+        else
+        {
+            std::cerr << std::format("Unknown option {}\n", option) << kUsage;
+            return 2;
+        }
+    }
+
+    ig::Vector<ig::AssetCookItem> items{};
+    if (ig::fs::is_directory(input))
+    {
+        items = ig::AssetCooker::ScanDirectory(input);
+    }
+    else
+    {
+        std::optional<ig::Vector<ig::AssetCookItem>> manifestItems{ig::AssetCooker::LoadManifest(input)};
+        if (!manifestItems)
+        {
+            return 2;
+        }
+        items = std::move(*manifestItems);
+    }
+
+    ig::AssetCooker cooker{numWorkers};
+    const ig::AssetCookReport report{cooker.Cook(items)};
+    for (const ig::AssetCookRecord& record : report.Records)
+    {
+        std::cout << std::format("[{}] {:>8} ms {:<10} {} ({})\n", record.bSucceeded ? " OK " : "FAIL", record.ElapsedMs, ig::ToCStr(record.Category),
+            record.Source, record.Status);
+    }
+    std::cout << std::format("{} items, {} failed, {} ms\n", report.Records.size(), report.NumFailed, report.ElapsedMs);
+
+    if (!reportPath.empty() && !ig::AssetCooker::SaveReport(reportPath, report))
+    {
+        std::cerr << std::format("Failed to save report to {}\n", reportPath.string());
+    }
+
+    return report.NumFailed == 0 ? 0 : 1;
+}
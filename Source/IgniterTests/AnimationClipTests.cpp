@@ -0,0 +1,426 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/AnimationClipImporter.h"
+#include "Igniter/Animation/AnimationSampler.h"
+
+namespace
+{
+    using ig::details::AnimationClipCompressionStages;
+
+    constexpr ig::F64 kTicksPerSecond = 30.0;
+    constexpr ig::U32 kKeyIntervalTicks = 5;
+    constexpr ig::Size kNumSubTracksPerTrack = magic_enum::enum_count<ig::EAnimationSubTrack>();
+
+    std::string MakeBoneName(const ig::U32 boneIdx)
+    {
+        return std::format("Bone{}", boneIdx);
+    }
+
+    aiMatrix4x4 MakeTranslation(const aiVector3D& translation)
+    {
+        aiMatrix4x4 matrix{};
+        return aiMatrix4x4::Translation(translation, matrix);
+    }
+
+    /*
+     * Scene -> Bone0 -> Bone1 -> ... (Bone 사이 간격은 Y 축 1)
+     * 모든 Bone 은 서로 다른 축/위상으로 회전 하며, 루트 Bone 만 이동, 마지막 Bone 만 스케일 키를 가진다.
+     * 키가 없는 성분은 노드의 변환을 따르므로 상수 트랙이 된다.
+     */
+    ig::Ptr<aiScene> MakeAnimatedScene(const ig::U32 numBones, const ig::U32 durationTicks)
+    {
+        aiNode* rootNode = new aiNode{"Scene"};
+        aiNode* parentNode = rootNode;
+        for (ig::U32 boneIdx = 0; boneIdx < numBones; ++boneIdx)
+        {
+            aiNode* boneNode = new aiNode{MakeBoneName(boneIdx)};
+            boneNode->mTransformation = MakeTranslation(aiVector3D{0.f, boneIdx == 0 ? 0.f : 1.f, 0.f});
+            parentNode->addChildren(1, &boneNode);
+            parentNode = boneNode;
+        }
+
+        const ig::U32 numKeys = durationTicks / kKeyIntervalTicks + 1;
+        const auto computePhase = [durationTicks](const ig::U32 keyIdx)
+        {
+            return 2.f * std::numbers::pi_v<ig::F32> * (ig::F32)(keyIdx * kKeyIntervalTicks) / (ig::F32)durationTicks;
+        };
+        const aiVector3D kAxes[]{aiVector3D{0.f, 1.f, 0.f}, aiVector3D{0.f, 0.f, 1.f}, aiVector3D{1.f, 0.f, 0.f}};
+
+        aiAnimation* animation = new aiAnimation{};
+        animation->mName = aiString{"Wave"};
+        animation->mDuration = (ig::F64)durationTicks;
+        animation->mTicksPerSecond = kTicksPerSecond;
+        animation->mNumChannels = numBones;
+        animation->mChannels = new aiNodeAnim*[numBones];
+        for (ig::U32 boneIdx = 0; boneIdx < numBones; ++boneIdx)
+        {
+            aiNodeAnim* channel = new aiNodeAnim{};
+            channel->mNodeName = aiString{MakeBoneName(boneIdx)};
+            channel->mNumRotationKeys = numKeys;
+            channel->mRotationKeys = new aiQuatKey[numKeys];
+            for (ig::U32 keyIdx = 0; keyIdx < numKeys; ++keyIdx)
+            {
+                const ig::F32 angle = 0.6f * std::sin(computePhase(keyIdx) + 0.7f * (ig::F32)boneIdx);
+                channel->mRotationKeys[keyIdx] = aiQuatKey{(ig::F64)(keyIdx * kKeyIntervalTicks), aiQuaternion{kAxes[boneIdx % std::size(kAxes)], angle}};
+            }
+
+            if (boneIdx == 0)
+            {
+                channel->mNumPositionKeys = numKeys;
+                channel->mPositionKeys = new aiVectorKey[numKeys];
+                for (ig::U32 keyIdx = 0; keyIdx < numKeys; ++keyIdx)
+                {
+                    const aiVector3D position{0.5f * std::sin(computePhase(keyIdx)), 0.2f * (ig::F32)keyIdx / (ig::F32)numKeys, 0.f};
+                    channel->mPositionKeys[keyIdx] = aiVectorKey{(ig::F64)(keyIdx * kKeyIntervalTicks), position};
+                }
+            }
+
+            if (boneIdx == numBones - 1)
+            {
+                channel->mNumScalingKeys = numKeys;
+                channel->mScalingKeys = new aiVectorKey[numKeys];
+                for (ig::U32 keyIdx = 0; keyIdx < numKeys; ++keyIdx)
+                {
+                    const ig::F32 scale = 1.f + 0.2f * std::sin(computePhase(keyIdx));
+                    channel->mScalingKeys[keyIdx] = aiVectorKey{(ig::F64)(keyIdx * kKeyIntervalTicks), aiVector3D{scale, scale, scale}};
+                }
+            }
+
+            animation->mChannels[boneIdx] = channel;
+        }
+
+        ig::Ptr<aiScene> scene{ig::MakePtr<aiScene>()};
+        scene->mRootNode = rootNode;
+        scene->mNumAnimations = 1;
+        scene->mAnimations = new aiAnimation*[1]{animation};
+        return scene;
+    }
+
+    ig::details::AnimationClipData Compress(tf::Executor& taskExecutor, const aiScene& scene, const ig::AnimationClip::ImportDesc& desc)
+    {
+        ig::details::AnimationClipData clipData{};
+        AnimationClipCompressionStages::ResampleChannels(scene, *scene.mAnimations[0], desc.SampleRate, clipData);
+        AnimationClipCompressionStages::SelectBitRates(taskExecutor, desc, clipData);
+        AnimationClipCompressionStages::PackFrames(clipData);
+        return clipData;
+    }
+
+    ig::AnimationClip MakeClip(const ig::details::AnimationClipData& clipData)
+    {
+        return ig::AnimationClip{ig::AnimationClip::Desc{ig::AssetInfo{}, AnimationClipCompressionStages::MakeLoadDesc(clipData)}, clipData.SubTracks,
+            clipData.PackedFrames};
+    }
+
+    /* 씬의 노드 계층과 일치 하는 스켈레톤; 메시 공간은 씬 루트 노드 공간과 같다. */
+    ig::Skeleton MakeChainSkeleton(const ig::U32 numBones)
+    {
+        ig::Skeleton skeleton{};
+        for (ig::U32 boneIdx = 0; boneIdx < numBones; ++boneIdx)
+        {
+            skeleton.BoneNames.emplace_back(MakeBoneName(boneIdx));
+            skeleton.ParentIndices.emplace_back(boneIdx == 0 ? ig::InvalidIndexU32 : boneIdx - 1);
+            skeleton.BindLocalTransforms.emplace_back(ig::Matrix::CreateTranslation(0.f, boneIdx == 0 ? 0.f : 1.f, 0.f));
+            skeleton.InverseBindMatrices.emplace_back(ig::Matrix::CreateTranslation(0.f, -(ig::F32)boneIdx, 0.f));
+        }
+        return skeleton;
+    }
+
+    ig::Vector3 GetSubTrackValue(const ig::AnimationTransform& transform, const ig::EAnimationSubTrack subTrackType)
+    {
+        switch (subTrackType)
+        {
+            case ig::EAnimationSubTrack::Rotation:
+                return ig::Vector3{transform.Rotation.x, transform.Rotation.y, transform.Rotation.z};
+            case ig::EAnimationSubTrack::Translation:
+                return transform.Translation;
+            default:
+                return transform.Scale;
+        }
+    }
+
+    /* 모든 프레임에 대해 복원 된 값과 재샘플링 된 원본 사이의 Sub Track 종류 별 최대 오차 */
+    ig::Array<ig::F32, kNumSubTracksPerTrack> MeasureMaxDecodeErrors(const ig::AnimationClip& clip, const ig::details::AnimationClipData& clipData)
+    {
+        ig::Array<ig::F32, kNumSubTracksPerTrack> maxErrors{0.f, 0.f, 0.f};
+        const ig::Size numTracks = clipData.TrackNames.size();
+        for (ig::U32 frame = 0; frame < clipData.NumFrames; ++frame)
+        {
+            for (ig::U32 trackIdx = 0; trackIdx < numTracks; ++trackIdx)
+            {
+                const ig::AnimationTransform& original = clipData.Samples[frame * numTracks + trackIdx];
+                const ig::AnimationTransform decoded{clip.DecodeTrack(trackIdx, frame)};
+                for (ig::Size subTrackTypeIdx = 0; subTrackTypeIdx < kNumSubTracksPerTrack; ++subTrackTypeIdx)
+                {
+                    const auto subTrackType = (ig::EAnimationSubTrack)subTrackTypeIdx;
+                    maxErrors[subTrackTypeIdx] = std::max(maxErrors[subTrackTypeIdx],
+                        AnimationClipCompressionStages::MeasureError(
+                            subTrackType, GetSubTrackValue(original, subTrackType), GetSubTrackValue(decoded, subTrackType)));
+                }
+            }
+        }
+        return maxErrors;
+    }
+
+    /* 압축 하지 않은 샘플로 부터 SimpleMath 로 계산 한 Skinning 행렬 */
+    ig::Vector<ig::Matrix> ComputeReferencePose(const ig::details::AnimationClipData& clipData, const ig::Skeleton& skeleton,
+        const ig::U32 frame0, const ig::U32 frame1, const ig::F32 alpha)
+    {
+        const ig::Size numTracks = clipData.TrackNames.size();
+        ig::Vector<ig::Matrix> globalTransforms(skeleton.GetNumBones());
+        ig::Vector<ig::Matrix> skinningMatrices(skeleton.GetNumBones());
+        for (ig::U32 boneIdx = 0; boneIdx < skeleton.GetNumBones(); ++boneIdx)
+        {
+            const ig::AnimationTransform& transform0 = clipData.Samples[frame0 * numTracks + boneIdx];
+            const ig::AnimationTransform& transform1 = clipData.Samples[frame1 * numTracks + boneIdx];
+            const ig::Matrix localTransform{ig::Matrix::CreateScale(ig::Vector3::Lerp(transform0.Scale, transform1.Scale, alpha)) *
+                ig::Matrix::CreateFromQuaternion(ig::Quaternion::Lerp(transform0.Rotation, transform1.Rotation, alpha)) *
+                ig::Matrix::CreateTranslation(ig::Vector3::Lerp(transform0.Translation, transform1.Translation, alpha))};
+
+            const ig::U32 parentIdx = skeleton.ParentIndices[boneIdx];
+            globalTransforms[boneIdx] = parentIdx == ig::InvalidIndexU32 ? localTransform * skeleton.RootTransform :
+                localTransform * globalTransforms[parentIdx];
+            skinningMatrices[boneIdx] = skeleton.InverseBindMatrices[boneIdx] * globalTransforms[boneIdx];
+        }
+        return skinningMatrices;
+    }
+
+    ig::Vector3 TransformPoint(const ig::PackedBoneMatrix& matrix, const ig::Vector3& point)
+    {
+        return ig::Vector3{point.x * matrix.m[0][0] + point.y * matrix.m[0][1] + point.z * matrix.m[0][2] + matrix.m[0][3],
+            point.x * matrix.m[1][0] + point.y * matrix.m[1][1] + point.z * matrix.m[1][2] + matrix.m[1][3],
+            point.x * matrix.m[2][0] + point.y * matrix.m[2][1] + point.z * matrix.m[2][2] + matrix.m[2][3]};
+    }
+} // namespace
+
+TEST_CASE("AnimationClip compression stays within the error tolerance", "[Asset][AnimationClip]")
+{
+    constexpr ig::U32 kNumBones = 3;
+    tf::Executor taskExecutor{};
+    const ig::Ptr<aiScene> scene{MakeAnimatedScene(kNumBones, 60)};
+    const ig::AnimationClip::ImportDesc desc{};
+    const ig::details::AnimationClipData clipData{Compress(taskExecutor, *scene, desc)};
+
+    /* 2 초 분량을 30 Hz 로 재샘플링 하면 양 끝을 포함 하여 61 프레임 */
+    REQUIRE(clipData.TrackNames.size() == kNumBones);
+    CHECK(clipData.Duration == Catch::Approx(2.f));
+    CHECK(clipData.NumFrames == 61);
+    CHECK(clipData.SampleRate == Catch::Approx(30.f));
+
+    const ig::F32 maxErrors[kNumSubTracksPerTrack]{desc.MaxRotationError, desc.MaxTranslationError, desc.MaxScaleError};
+    REQUIRE(clipData.SubTracks.size() == kNumBones * kNumSubTracksPerTrack);
+    ig::U32 expectedFrameBitSize = 0;
+    for (ig::Size subTrackIdx = 0; subTrackIdx < clipData.SubTracks.size(); ++subTrackIdx)
+    {
+        INFO("Sub Track: " << subTrackIdx);
+        const ig::Size boneIdx = subTrackIdx / kNumSubTracksPerTrack;
+        const auto subTrackType = (ig::EAnimationSubTrack)(subTrackIdx % kNumSubTracksPerTrack);
+        const ig::AnimationSubTrack& subTrack = clipData.SubTracks[subTrackIdx];
+        CHECK(clipData.SubTrackErrors[subTrackIdx] <= maxErrors[subTrackIdx % kNumSubTracksPerTrack]);
+        CHECK(subTrack.FrameBitOffset == expectedFrameBitSize);
+        expectedFrameBitSize += 3 * (ig::U32)subTrack.NumBits;
+
+        /* 키가 없는 성분은 프레임 데이터를 차지 하지 않는다. */
+        const bool bAnimated = subTrackType == ig::EAnimationSubTrack::Rotation ||
+            (subTrackType == ig::EAnimationSubTrack::Translation && boneIdx == 0) ||
+            (subTrackType == ig::EAnimationSubTrack::Scale && boneIdx == kNumBones - 1);
+        CHECK((subTrack.NumBits > 0) == bAnimated);
+        CHECK(subTrack.NumBits <= ig::AnimationSubTrack::kMaxBits);
+    }
+    CHECK(clipData.FrameBitSize == expectedFrameBitSize);
+
+    const ig::AnimationClip clip{MakeClip(clipData)};
+    const ig::AnimationClipLoadDesc& loadDesc{clip.GetSnapshot().LoadDescriptor};
+    CHECK(clipData.PackedFrames.size() == loadDesc.GetPackedFramesSize());
+    const ig::Size rawSize = sizeof(ig::AnimationTransform) * clipData.Samples.size();
+    CHECK(loadDesc.GetBlobSize() * 3 < rawSize);
+
+    /* 복원 된 값은 비트 수를 결정 할 때 측정한 오차를 벗어나지 않는다. (F32 연산 순서에 의한 차이만 허용) */
+    const ig::Array<ig::F32, kNumSubTracksPerTrack> decodeErrors{MeasureMaxDecodeErrors(clip, clipData)};
+    for (ig::Size subTrackTypeIdx = 0; subTrackTypeIdx < kNumSubTracksPerTrack; ++subTrackTypeIdx)
+    {
+        INFO("Sub Track Type: " << subTrackTypeIdx);
+        CHECK(decodeErrors[subTrackTypeIdx] <= maxErrors[subTrackTypeIdx] * 1.01f + 1e-6f);
+    }
+
+    CHECK(clip.FindTrack("Bone1") == 1);
+    CHECK(clip.FindTrack("Missing") == ig::InvalidIndexU32);
+}
+
+TEST_CASE("AnimationClip spends more bits on tighter tolerances", "[Asset][AnimationClip]")
+{
+    tf::Executor taskExecutor{};
+    const ig::Ptr<aiScene> scene{MakeAnimatedScene(3, 60)};
+
+    ig::U32 prevFrameBitSize = 0;
+    for (const ig::F32 maxError : {1e-2f, 1e-3f, 1e-4f, 2e-5f})
+    {
+        INFO("Max Error: " << maxError);
+        const ig::AnimationClip::ImportDesc desc{.MaxTranslationError = maxError, .MaxRotationError = maxError, .MaxScaleError = maxError};
+        const ig::details::AnimationClipData clipData{Compress(taskExecutor, *scene, desc)};
+        CHECK(clipData.FrameBitSize >= prevFrameBitSize);
+        prevFrameBitSize = clipData.FrameBitSize;
+
+        const ig::Array<ig::F32, kNumSubTracksPerTrack> decodeErrors{MeasureMaxDecodeErrors(MakeClip(clipData), clipData)};
+        for (const ig::F32 decodeError : decodeErrors)
+        {
+            CHECK(decodeError <= maxError * 1.01f + 1e-6f);
+        }
+    }
+}
+
+TEST_CASE("AnimationClip computes frame positions", "[Asset][AnimationClip]")
+{
+    tf::Executor taskExecutor{};
+    const ig::Ptr<aiScene> scene{MakeAnimatedScene(1, 60)};
+    const ig::details::AnimationClipData clipData{Compress(taskExecutor, *scene, ig::AnimationClip::ImportDesc{})};
+    const ig::AnimationClip clip{MakeClip(clipData)};
+    const ig::F32 frameDuration = 1.f / clipData.SampleRate;
+
+    ig::U32 frame0 = 0;
+    ig::U32 frame1 = 0;
+    ig::F32 alpha = 0.f;
+    SECTION("Clamped")
+    {
+        clip.ComputeFramePosition(0.f, false, frame0, frame1, alpha);
+        CHECK(frame0 == 0);
+        CHECK(frame1 == 1);
+        CHECK(alpha == 0.f);
+
+        clip.ComputeFramePosition(-1.f, false, frame0, frame1, alpha);
+        CHECK(frame0 == 0);
+        CHECK(alpha == 0.f);
+
+        clip.ComputeFramePosition(clip.GetDuration() + 1.f, false, frame0, frame1, alpha);
+        CHECK(frame0 == clipData.NumFrames - 1);
+        CHECK(frame1 == clipData.NumFrames - 1);
+        CHECK(alpha == 0.f);
+
+        clip.ComputeFramePosition(10.25f * frameDuration, false, frame0, frame1, alpha);
+        CHECK(frame0 == 10);
+        CHECK(frame1 == 11);
+        CHECK(alpha == Catch::Approx(0.25f).margin(1e-3f));
+    }
+
+    SECTION("Looped")
+    {
+        clip.ComputeFramePosition(clip.GetDuration() * 2.f + 10.5f * frameDuration, true, frame0, frame1, alpha);
+        CHECK(frame0 == 10);
+        CHECK(frame1 == 11);
+        CHECK(alpha == Catch::Approx(0.5f).margin(1e-3f));
+
+        clip.ComputeFramePosition(-0.5f * frameDuration, true, frame0, frame1, alpha);
+        CHECK(frame0 == clipData.NumFrames - 2);
+        CHECK(frame1 == clipData.NumFrames - 1);
+        CHECK(alpha == Catch::Approx(0.5f).margin(1e-3f));
+    }
+}
+
+TEST_CASE("AnimationSampler matches an uncompressed reference pose", "[Animation][AnimationSampler]")
+{
+    constexpr ig::U32 kNumBones = 6;
+    /* 각 Bone 의 회전 오차(1e-4 rad)가 말단 까지의 거리 만큼 증폭 되어 계층을 따라 누적 된다. */
+    constexpr ig::F32 kMaxPositionError = 5e-3f;
+    const ig::Vector3 kProbePoints[]{ig::Vector3{0.f, 0.f, 0.f}, ig::Vector3{0.3f, 0.5f, -0.2f}, ig::Vector3{-0.4f, 1.f, 0.6f}};
+
+    tf::Executor taskExecutor{};
+    const ig::Ptr<aiScene> scene{MakeAnimatedScene(kNumBones, 60)};
+    const ig::details::AnimationClipData clipData{Compress(taskExecutor, *scene, ig::AnimationClip::ImportDesc{})};
+    const ig::AnimationClip clip{MakeClip(clipData)};
+    const ig::Skeleton skeleton{MakeChainSkeleton(kNumBones)};
+    const ig::AnimationBinding binding{clip, skeleton};
+    for (ig::U32 boneIdx = 0; boneIdx < kNumBones; ++boneIdx)
+    {
+        CHECK(binding.GetBoneTracks()[boneIdx] == boneIdx);
+    }
+
+    ig::Vector<ig::AnimationSampleRequest> requests{};
+    for (const ig::F32 framePosition : {0.f, 7.f, 17.5f, 33.25f, 59.9f, 60.f})
+    {
+        requests.emplace_back(ig::AnimationSampleRequest{
+            .Binding = &binding, .Time = framePosition / clipData.SampleRate, .bLoop = false, .OutputOffset = (ig::U32)(requests.size() * kNumBones)});
+    }
+
+    ig::Vector<ig::PackedBoneMatrix> skinningMatrices(requests.size() * kNumBones);
+    ig::AnimationSampler sampler{taskExecutor};
+    sampler.Sample(requests, skinningMatrices);
+
+    ig::Vector<ig::PackedBoneMatrix> serialSkinningMatrices(requests.size() * kNumBones);
+    for (const ig::AnimationSampleRequest& request : requests)
+    {
+        INFO("Time: " << request.Time);
+        ig::AnimationSampler::SamplePose(request, serialSkinningMatrices);
+
+        ig::U32 frame0 = 0;
+        ig::U32 frame1 = 0;
+        ig::F32 alpha = 0.f;
+        clip.ComputeFramePosition(request.Time, request.bLoop, frame0, frame1, alpha);
+        const ig::Vector<ig::Matrix> referenceMatrices{ComputeReferencePose(clipData, skeleton, frame0, frame1, alpha)};
+        for (ig::U32 boneIdx = 0; boneIdx < kNumBones; ++boneIdx)
+        {
+            INFO("Bone: " << boneIdx);
+            const ig::PackedBoneMatrix& skinningMatrix = skinningMatrices[request.OutputOffset + boneIdx];
+            for (const ig::Vector3& probePoint : kProbePoints)
+            {
+                /* 프로브는 Bind Pose 의 Bone 근처에 위치 한 메시 공간의 점 */
+                const ig::Vector3 bindPoint{probePoint + ig::Vector3{0.f, (ig::F32)boneIdx, 0.f}};
+                const ig::Vector3 expected{ig::Vector3::Transform(bindPoint, referenceMatrices[boneIdx])};
+                CHECK(ig::Vector3::Distance(TransformPoint(skinningMatrix, bindPoint), expected) <= kMaxPositionError);
+            }
+        }
+    }
+
+    /* 병렬 평가는 요청 단위로 나누어 질 뿐, 결과는 직렬 평가와 같아야 한다. */
+    CHECK(std::memcmp(skinningMatrices.data(), serialSkinningMatrices.data(), sizeof(ig::PackedBoneMatrix) * skinningMatrices.size()) == 0);
+}
+
+TEST_CASE("AnimationClip compression and sampling throughput", "[Asset][AnimationClip][!benchmark]")
+{
+    constexpr ig::U32 kNumBones = 64;
+    constexpr ig::U32 kNumInstances = 1024;
+    tf::Executor taskExecutor{};
+    const ig::Ptr<aiScene> scene{MakeAnimatedScene(kNumBones, 300)};
+    const ig::AnimationClip::ImportDesc desc{};
+
+    ig::details::AnimationClipData resampled{};
+    AnimationClipCompressionStages::ResampleChannels(*scene, *scene->mAnimations[0], desc.SampleRate, resampled);
+    const ig::details::AnimationClipData clipData{Compress(taskExecutor, *scene, desc)};
+    const ig::AnimationClip clip{MakeClip(clipData)};
+    const ig::Array<ig::F32, kNumSubTracksPerTrack> decodeErrors{MeasureMaxDecodeErrors(clip, clipData)};
+    const ig::Size rawSize = sizeof(ig::AnimationTransform) * clipData.Samples.size();
+    const ig::Size blobSize = clip.GetSnapshot().LoadDescriptor.GetBlobSize();
+
+    BENCHMARK(std::format("Compress {} Bones x {} Frames ({:.2f}:1, Max Error Rotation {:.6f} rad, Translation {:.6f}, Scale {:.6f})", kNumBones,
+        clipData.NumFrames, (ig::F32)rawSize / blobSize, decodeErrors[(ig::Size)ig::EAnimationSubTrack::Rotation],
+        decodeErrors[(ig::Size)ig::EAnimationSubTrack::Translation], decodeErrors[(ig::Size)ig::EAnimationSubTrack::Scale]))
+    {
+        ig::details::AnimationClipData newClipData{resampled};
+        AnimationClipCompressionStages::SelectBitRates(taskExecutor, desc, newClipData);
+        AnimationClipCompressionStages::PackFrames(newClipData);
+        return newClipData.FrameBitSize;
+    };
+
+    const ig::Skeleton skeleton{MakeChainSkeleton(kNumBones)};
+    const ig::AnimationBinding binding{clip, skeleton};
+    ig::Vector<ig::AnimationSampleRequest> requests{};
+    for (ig::U32 instanceIdx = 0; instanceIdx < kNumInstances; ++instanceIdx)
+    {
+        requests.emplace_back(ig::AnimationSampleRequest{
+            .Binding = &binding, .Time = clip.GetDuration() * (ig::F32)instanceIdx / kNumInstances * 3.f, .OutputOffset = instanceIdx * kNumBones});
+    }
+    ig::Vector<ig::PackedBoneMatrix> skinningMatrices(requests.size() * kNumBones);
+
+    ig::AnimationSampler sampler{taskExecutor};
+    BENCHMARK(std::format("Sample {} Instances x {} Bones", kNumInstances, kNumBones))
+    {
+        sampler.Sample(requests, skinningMatrices);
+        return skinningMatrices[0].m[0][0];
+    };
+
+    BENCHMARK(std::format("Sample {} Instances x {} Bones (Single Thread)", kNumInstances, kNumBones))
+    {
+        for (const ig::AnimationSampleRequest& request : requests)
+        {
+            ig::AnimationSampler::SamplePose(request, skinningMatrices);
+        }
+        return skinningMatrices[0].m[0][0];
+    };
+}
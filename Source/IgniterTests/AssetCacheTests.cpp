@@ -0,0 +1,194 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/AssetCache.h"
+#include "Igniter/Asset/Map.h"
+
+namespace
+{
+    using MapCache = ig::details::AssetCache<ig::Map>;
+
+    /* GPU 리소스 없이 생성 할 수 있는 에셋 */
+    ig::AssetInfo CacheNewMap(MapCache& cache, const ig::Size idx, const ig::Bytes footprint)
+    {
+        const ig::AssetInfo assetInfo{std::format("Tests\\Map_{}", idx), ig::EAssetCategory::Map};
+        cache.Cache(assetInfo.GetGuid(), ig::Map{ig::Map::Desc{assetInfo, ig::MapLoadDesc{}}, ig::Json{}}, footprint);
+        REQUIRE(cache.Load(assetInfo.GetGuid()));
+        return assetInfo;
+    }
+} // namespace
+
+TEST_CASE("AssetCache charges a minimum footprint for unknown sizes", "[Asset][AssetCache]")
+{
+    MapCache cache{2 * MapCache::kMinFootprint};
+    ig::Vector<ig::AssetInfo> assetInfos{};
+    for (ig::Size idx = 0; idx < 4; ++idx)
+    {
+        assetInfos.emplace_back(CacheNewMap(cache, idx, 0));
+    }
+
+    for (const ig::AssetInfo& assetInfo : assetInfos)
+    {
+        cache.Unload(assetInfo);
+    }
+
+    const MapCache::Statistics statistics{cache.GetStatistics()};
+    CHECK(statistics.NumKeptAlive == 2);
+    CHECK(statistics.NumEvictions == 2);
+    CHECK(statistics.KeptAliveBytes == 2 * MapCache::kMinFootprint);
+    /* 가장 오래 전에 Keep-Alive 상태가 된 에셋 부터 해제 된다. */
+    CHECK_FALSE(cache.IsCached(assetInfos[0].GetGuid()));
+    CHECK_FALSE(cache.IsCached(assetInfos[1].GetGuid()));
+    CHECK(cache.IsCached(assetInfos[2].GetGuid()));
+    CHECK(cache.IsCached(assetInfos[3].GetGuid()));
+}
+
+TEST_CASE("AssetCache does not keep alive assets larger than the budget", "[Asset][AssetCache]")
+{
+    constexpr ig::Bytes kBudget = ig::MegaBytesToBytes(1);
+    MapCache cache{kBudget};
+    const ig::AssetInfo smallAsset{CacheNewMap(cache, 0, kBudget / 2)};
+    const ig::AssetInfo largeAsset{CacheNewMap(cache, 1, kBudget + 1)};
+
+    cache.Unload(largeAsset);
+    CHECK_FALSE(cache.IsCached(largeAsset.GetGuid()));
+
+    cache.Unload(smallAsset);
+    CHECK(cache.TakeSnapshot(smallAsset.GetGuid()).bIsKeptAlive);
+    CHECK(cache.GetStatistics().KeptAliveBytes == kBudget / 2);
+
+    /* Keep-Alive 중인 에셋을 다시 로드 하면 예산 에서 제외 된다. */
+    CHECK(cache.TryLoad(smallAsset.GetGuid()));
+    CHECK(cache.GetStatistics().KeptAliveBytes == 0);
+    CHECK(cache.GetStatistics().NumKeepAliveHits == 1);
+}
+
+TEST_CASE("Map resident size is the loaded serialized size", "[Asset][AssetCache]")
+{
+    const ig::AssetInfo assetInfo{"Tests\\Map", ig::EAssetCategory::Map};
+    const ig::Json serializedWorld{{"Entities", ig::Json::array({1, 2, 3})}};
+    const std::vector<ig::U8> ubjson{ig::Json::to_ubjson(serializedWorld)};
+    const ig::Map map{ig::Map::Desc{assetInfo, ig::MapLoadDesc{}}, ig::Json::from_ubjson(ubjson), ubjson.size()};
+    CHECK(map.GetResidentSize() == sizeof(ig::Map) + ubjson.size());
+    CHECK(map.GetSerializedWorld() == serializedWorld);
+}
+
+TEST_CASE("AssetCache acquires referenced assets without the cache lock", "[Asset][AssetCache]")
+{
+    MapCache cache{};
+    /* 초기 테이블 용량 보다 많은 엔트리를 추가 하여, 테이블 확장 이후 에도 모든 엔트리에 접근 가능 한지 확인 */
+    ig::Vector<ig::AssetInfo> assetInfos{};
+    for (ig::Size idx = 0; idx < 1024; ++idx)
+    {
+        assetInfos.emplace_back(CacheNewMap(cache, idx, 0));
+    }
+
+    for (const ig::AssetInfo& assetInfo : assetInfos)
+    {
+        const ig::Handle<ig::Map> acquiredHandle{cache.TryAcquire(assetInfo.GetGuid())};
+        REQUIRE(acquiredHandle);
+        CHECK(cache.Lookup(acquiredHandle)->GetSnapshot().Info.GetGuid() == assetInfo.GetGuid());
+        CHECK(cache.TakeSnapshot(assetInfo.GetGuid()).RefCount == 2);
+        CHECK(cache.TryRelease(assetInfo.GetGuid()));
+    }
+
+    /* 마지막 참조는 잠금 없이 해제 될 수 없다. */
+    CHECK_FALSE(cache.TryRelease(assetInfos[0].GetGuid()));
+    cache.Invalidate(assetInfos[0].GetGuid());
+    CHECK_FALSE(cache.TryAcquire(assetInfos[0].GetGuid()));
+
+    /* 무효화 된 엔트리는 같은 Guid 로 다시 캐싱 될 때 재사용 된다. */
+    cache.Cache(assetInfos[0].GetGuid(), ig::Map{ig::Map::Desc{assetInfos[0], ig::MapLoadDesc{}}, ig::Json{}});
+    CHECK_FALSE(cache.TryAcquire(assetInfos[0].GetGuid()));
+    CHECK(cache.TryLoad(assetInfos[0].GetGuid()));
+    CHECK(cache.TryAcquire(assetInfos[0].GetGuid()));
+}
+
+TEST_CASE("AssetCache swaps only the instance cached when the swap was requested", "[Asset][AssetCache]")
+{
+    MapCache cache{};
+    const ig::AssetInfo assetInfo{CacheNewMap(cache, 0, 0)};
+    const ig::Guid guid{assetInfo.GetGuid()};
+    const ig::Handle<ig::Map> requestedHandle{cache.Load(guid, false)};
+
+    ig::Json reloadedWorld{};
+    reloadedWorld["Reloaded"] = true;
+    ig::Map reloadedMap{ig::Map::Desc{assetInfo, ig::MapLoadDesc{}}, reloadedWorld};
+    CHECK(cache.Swap(guid, requestedHandle, reloadedMap));
+    CHECK(cache.Lookup(requestedHandle)->GetSerializedWorld().contains("Reloaded"));
+    CHECK_FALSE(reloadedMap.GetSerializedWorld().contains("Reloaded"));
+
+    /* 해제 후 다시 캐시 된 경우, 이전 요청의 결과로 교체 되어서는 안된다. */
+    cache.Unload(assetInfo);
+    REQUIRE_FALSE(cache.IsCached(guid));
+    cache.Cache(guid, ig::Map{ig::Map::Desc{assetInfo, ig::MapLoadDesc{}}, ig::Json{}});
+    ig::Map staleMap{ig::Map::Desc{assetInfo, ig::MapLoadDesc{}}, reloadedWorld};
+    CHECK_FALSE(cache.Swap(guid, requestedHandle, staleMap));
+    CHECK(cache.Swap(guid, cache.Load(guid, false), staleMap));
+
+    cache.Invalidate(guid);
+    CHECK_FALSE(cache.Swap(guid, requestedHandle, staleMap));
+}
+
+TEST_CASE("AssetCache concurrent acquire/release", "[Asset][AssetCache][!benchmark]")
+{
+    constexpr ig::Size kNumIterations = 100'000;
+    MapCache cache{};
+    const ig::AssetInfo assetInfo{CacheNewMap(cache, 0, 0)};
+    const ig::Guid guid{assetInfo.GetGuid()};
+
+    std::atomic<ig::Size> numFailures{0};
+    /* 기준선: 이전 구현 과 같이 참조 중인 에셋의 획득/해제 마다 캐시 전체에 대한 배타적 잠금을 사용 한다. */
+    ig::SharedMutex baselineMutex{};
+    for (const ig::Size numThreads : {ig::Size{1}, ig::Size{4}, ig::Size{std::max(std::thread::hardware_concurrency(), 1u)}})
+    {
+        BENCHMARK(std::format("{} Threads x {} Acquire/Release (Exclusive Lock)", numThreads, kNumIterations))
+        {
+            std::vector<std::jthread> threads{};
+            for (ig::Size threadIdx = 0; threadIdx < numThreads; ++threadIdx)
+            {
+                threads.emplace_back(
+                    [&cache, &numFailures, &baselineMutex, guid]()
+                    {
+                        for (ig::Size iteration = 0; iteration < kNumIterations; ++iteration)
+                        {
+                            {
+                                ig::ReadWriteLock rwLock{baselineMutex};
+                                if (!cache.TryAcquire(guid))
+                                {
+                                    numFailures.fetch_add(1, std::memory_order_relaxed);
+                                    continue;
+                                }
+                            }
+
+                            ig::ReadWriteLock rwLock{baselineMutex};
+                            if (!cache.TryRelease(guid))
+                            {
+                                numFailures.fetch_add(1, std::memory_order_relaxed);
+                            }
+                        }
+                    });
+            }
+        };
+
+        BENCHMARK(std::format("{} Threads x {} Acquire/Release", numThreads, kNumIterations))
+        {
+            std::vector<std::jthread> threads{};
+            for (ig::Size threadIdx = 0; threadIdx < numThreads; ++threadIdx)
+            {
+                threads.emplace_back(
+                    [&cache, &numFailures, guid]()
+                    {
+                        for (ig::Size iteration = 0; iteration < kNumIterations; ++iteration)
+                        {
+                            if (!cache.TryAcquire(guid) || !cache.TryRelease(guid))
+                            {
+                                numFailures.fetch_add(1, std::memory_order_relaxed);
+                            }
+                        }
+                    });
+            }
+        };
+    }
+
+    CHECK(numFailures.load() == 0);
+    CHECK(cache.TakeSnapshot(guid).RefCount == 1);
+}
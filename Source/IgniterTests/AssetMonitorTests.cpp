@@ -0,0 +1,151 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/AssetMonitor.h"
+#include "Igniter/Asset/Material.h"
+
+namespace
+{
+    /* 임시 디렉터리를 작업 디렉터리로 하여, 'Assets\{Category}\{Guid}' 형식의 에셋 디렉터리를 구성 한다. */
+    class ScopedAssetRoot final
+    {
+    public:
+        ScopedAssetRoot()
+            : previousPath(ig::fs::current_path())
+            , rootPath(ig::fs::temp_directory_path() / std::format("IgniterTests_{}", xg::newGuid().str()))
+        {
+            ig::fs::create_directories(rootPath);
+            ig::fs::current_path(rootPath);
+        }
+
+        ~ScopedAssetRoot()
+        {
+            ig::fs::current_path(previousPath);
+            std::error_code errorCode{};
+            ig::fs::remove_all(rootPath, errorCode);
+        }
+
+    private:
+        ig::Path previousPath;
+        ig::Path rootPath;
+    };
+
+    void WriteMaterialAssets(const ig::Size numAssets)
+    {
+        ig::fs::create_directories(ig::GetAssetDirectoryPath(ig::EAssetCategory::Material));
+        for (ig::Size idx = 0; idx < numAssets; ++idx)
+        {
+            const ig::AssetInfo assetInfo{std::format("Tests\\Material_{}", idx), ig::EAssetCategory::Material};
+            ig::Json serializedMetadata{};
+            serializedMetadata << assetInfo << ig::Material::LoadDesc{};
+            REQUIRE(ig::SaveJsonToFile(ig::MakeAssetMetadataPath(ig::EAssetCategory::Material, assetInfo.GetGuid()), serializedMetadata));
+
+            constexpr ig::U8 kDummyPayload = 0;
+            REQUIRE(ig::SaveBlobToFile(ig::MakeAssetPath(ig::EAssetCategory::Material, assetInfo.GetGuid()), std::span{&kDummyPayload, 1}));
+        }
+    }
+
+    /* 파싱 할 수 없는 메타데이터. 파일이 변경 되기 전까지 매번 거부 된다. */
+    void WriteInvalidMaterialAsset()
+    {
+        const ig::Guid guid{xg::newGuid()};
+        const std::string_view invalidMetadata{"{ not a json"};
+        REQUIRE(ig::SaveBlobToFile(ig::MakeAssetMetadataPath(ig::EAssetCategory::Material, guid),
+            std::span{reinterpret_cast<const ig::U8*>(invalidMetadata.data()), invalidMetadata.size()}));
+
+        constexpr ig::U8 kDummyPayload = 0;
+        REQUIRE(ig::SaveBlobToFile(ig::MakeAssetPath(ig::EAssetCategory::Material, guid), std::span{&kDummyPayload, 1}));
+    }
+
+    ig::details::AssetMonitor::ParseStatistics ParseOnce(tf::Executor& taskExecutor)
+    {
+        /* 인덱스가 유효하지 않다면 파싱 직후 다시 기록 된다. */
+        const ig::details::AssetMonitor assetMonitor{taskExecutor};
+        return assetMonitor.GetParseStatistics();
+    }
+} // namespace
+
+TEST_CASE("AssetMonitor warm start hits the metadata index", "[Asset][AssetMonitor]")
+{
+    constexpr ig::Size kNumAssets = 64;
+    ScopedAssetRoot scopedRoot{};
+    tf::Executor taskExecutor{};
+    WriteMaterialAssets(kNumAssets);
+    WriteInvalidMaterialAsset();
+
+    const auto coldStatistics{ParseOnce(taskExecutor)};
+    CHECK(coldStatistics.NumCandidates == kNumAssets + 1);
+    CHECK(coldStatistics.NumReparsed == kNumAssets + 1);
+    CHECK(coldStatistics.NumRejected == 1);
+    CHECK(coldStatistics.bIndexRebuilt);
+
+    /* 거부 된 메타데이터 또한 인덱스에 기록 되므로, 웜 스타트 에서는 인덱스를 다시 만들지 않는다. */
+    const auto warmStatistics{ParseOnce(taskExecutor)};
+    CHECK(warmStatistics.NumCandidates == kNumAssets + 1);
+    CHECK(warmStatistics.NumIndexHits == kNumAssets + 1);
+    CHECK(warmStatistics.NumReparsed == 0);
+    CHECK(warmStatistics.NumRejected == 1);
+    CHECK_FALSE(warmStatistics.bIndexRebuilt);
+}
+
+TEST_CASE("AssetMonitor re-parses only modified metadata", "[Asset][AssetMonitor]")
+{
+    ScopedAssetRoot scopedRoot{};
+    tf::Executor taskExecutor{};
+    WriteMaterialAssets(8);
+    (void)ParseOnce(taskExecutor);
+
+    WriteMaterialAssets(1);
+    const auto statistics{ParseOnce(taskExecutor)};
+    CHECK(statistics.NumCandidates == 9);
+    CHECK(statistics.NumReparsed == 1);
+    CHECK(statistics.bIndexRebuilt);
+}
+
+TEST_CASE("AssetMetadataIndex records the file state of parse time", "[Asset][AssetMonitor]")
+{
+    ScopedAssetRoot scopedRoot{};
+    const ig::Path metadataPath{"Material.metadata"};
+    const ig::Path indexPath{"Metadata.index"};
+    REQUIRE(ig::SaveJsonToFile(metadataPath, ig::Json{{"Version", 1}}));
+    const ig::U64 parsedLastWriteTime = ig::details::AssetMetadataIndex::QueryLastWriteTime(metadataPath);
+    const ig::U64 parsedFileSize = ig::fs::file_size(metadataPath);
+
+    /* 파싱 이후, 인덱스를 저장 하기 전에 파일이 변경 된 경우 */
+    REQUIRE(ig::SaveJsonToFile(metadataPath, ig::Json{{"Version", 2}, {"Edited", true}}));
+    const ig::details::AssetMetadataIndex::Record records[]{
+        {.MetadataPath = metadataPath, .LastWriteTime = parsedLastWriteTime, .FileSize = parsedFileSize, .SerializedMetadata = ig::Json{{"Version", 1}}}};
+    REQUIRE(ig::details::AssetMetadataIndex::Save(indexPath, records));
+
+    ig::details::AssetMetadataIndex metadataIndex{};
+    REQUIRE(metadataIndex.Open(indexPath));
+    CHECK(metadataIndex.Lookup(metadataPath, parsedLastWriteTime, parsedFileSize).has_value());
+    /* 변경 된 파일의 현재 상태로는 인덱스를 사용 할 수 없으므로 다시 파싱 된다. */
+    CHECK_FALSE(metadataIndex
+                    .Lookup(metadataPath, ig::details::AssetMetadataIndex::QueryLastWriteTime(metadataPath), ig::fs::file_size(metadataPath))
+                    .has_value());
+}
+
+TEST_CASE("AssetMonitor cold/warm startup", "[Asset][AssetMonitor][!benchmark]")
+{
+    constexpr ig::Size kNumAssets = 4096;
+    ScopedAssetRoot scopedRoot{};
+    tf::Executor taskExecutor{};
+    WriteMaterialAssets(kNumAssets);
+    (void)ParseOnce(taskExecutor);
+
+    BENCHMARK_ADVANCED("Cold")(Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure(
+            [&taskExecutor]()
+            {
+                /* 인덱스 파일 삭제 비용이 함께 측정 되나, 파싱 비용에 비해 무시 할 수준 이다. */
+                ig::fs::remove(ig::Path{ig::details::MetadataIndexPath});
+                return ParseOnce(taskExecutor).NumReparsed;
+            });
+    };
+
+    BENCHMARK("Warm")
+    {
+        return ParseOnce(taskExecutor).NumIndexHits;
+    };
+}
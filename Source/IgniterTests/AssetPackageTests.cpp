@@ -0,0 +1,216 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/AssetMonitor.h"
+#include "Igniter/Asset/AssetPackage.h"
+#include "Igniter/Asset/Material.h"
+
+namespace
+{
+    /* 임시 디렉터리를 작업 디렉터리로 하여, 'Assets\{Category}\{Guid}' 형식의 에셋 디렉터리를 구성 한다. */
+    class ScopedAssetRoot final
+    {
+    public:
+        ScopedAssetRoot()
+            : previousPath(ig::fs::current_path())
+            , rootPath(ig::fs::temp_directory_path() / std::format("IgniterTests_{}", xg::newGuid().str()))
+        {
+            ig::fs::create_directories(rootPath);
+            ig::fs::current_path(rootPath);
+        }
+
+        ~ScopedAssetRoot()
+        {
+            ig::fs::current_path(previousPath);
+            std::error_code errorCode{};
+            ig::fs::remove_all(rootPath, errorCode);
+        }
+
+    private:
+        ig::Path previousPath;
+        ig::Path rootPath;
+    };
+
+    ig::Vector<ig::U8> MakePayload(const ig::Size numBytes, const ig::U32 seed)
+    {
+        std::mt19937 generator{seed};
+        std::uniform_int_distribution<ig::U32> byteDistribution{0, 255};
+        ig::Vector<ig::U8> payload(numBytes);
+        for (ig::U8& byte : payload)
+        {
+            byte = (ig::U8)byteDistribution(generator);
+        }
+        return payload;
+    }
+
+    void WriteMaterialAsset(const ig::AssetInfo& assetInfo, const std::span<const ig::U8> payload)
+    {
+        ig::fs::create_directories(ig::GetAssetDirectoryPath(ig::EAssetCategory::Material));
+        ig::Json serializedMetadata{};
+        serializedMetadata << assetInfo << ig::Material::LoadDesc{};
+        REQUIRE(ig::SaveJsonToFile(ig::MakeAssetMetadataPath(ig::EAssetCategory::Material, assetInfo.GetGuid()), serializedMetadata));
+        REQUIRE(ig::SaveBlobToFile(ig::MakeAssetPath(ig::EAssetCategory::Material, assetInfo.GetGuid()), payload));
+    }
+
+    void RemoveLooseAsset(const ig::Guid& guid)
+    {
+        REQUIRE(ig::fs::remove(ig::MakeAssetPath(ig::EAssetCategory::Material, guid)));
+        REQUIRE(ig::fs::remove(ig::MakeAssetMetadataPath(ig::EAssetCategory::Material, guid)));
+    }
+
+    bool IsSameBytes(const std::span<const ig::U8> lhs, const std::span<const ig::U8> rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    const ig::Path kPackagePath{"Assets.pak"};
+} // namespace
+
+TEST_CASE("AssetPackage round-trips asset data and metadata", "[Asset][AssetPackage]")
+{
+    constexpr ig::Size kNumAssets = 16;
+    ScopedAssetRoot scopedRoot{};
+    ig::Vector<ig::AssetInfo> assetInfos{};
+    ig::Vector<ig::Vector<ig::U8>> payloads{};
+    for (ig::Size assetIdx = 0; assetIdx < kNumAssets; ++assetIdx)
+    {
+        /* 정렬 단위 경계를 넘나드는 크기 */
+        assetInfos.emplace_back(std::format("Tests\\Material_{}", assetIdx), ig::EAssetCategory::Material);
+        payloads.emplace_back(MakePayload(1 + assetIdx * 97, (ig::U32)assetIdx));
+        WriteMaterialAsset(assetInfos.back(), payloads.back());
+    }
+
+    ig::Result<ig::AssetPackage::BuildReport, ig::EAssetPackageBuildStatus> buildResult{ig::AssetPackage::Build(kPackagePath)};
+    REQUIRE(buildResult.IsSuccess());
+    const ig::AssetPackage::BuildReport report{buildResult.Take()};
+    CHECK(report.NumPackedAssets == kNumAssets);
+    CHECK(report.NumSkippedAssets == 0);
+    CHECK(report.PackageSize == ig::fs::file_size(kPackagePath));
+
+    ig::AssetPackage package{};
+    REQUIRE(package.Mount(kPackagePath));
+    REQUIRE(package.GetTableOfContents().size() == kNumAssets);
+    for (const ig::AssetPackage::TocEntry& entry : package.GetTableOfContents())
+    {
+        CHECK(entry.Offset % ig::AssetPackage::kDataAlignment == 0);
+        CHECK(entry.Category == ig::EAssetCategory::Material);
+    }
+
+    for (ig::Size assetIdx = 0; assetIdx < kNumAssets; ++assetIdx)
+    {
+        INFO("Asset: " << assetIdx);
+        const ig::Guid guid{assetInfos[assetIdx].GetGuid()};
+        REQUIRE(package.Contains(guid));
+        CHECK(IsSameBytes(package.GetAssetData(guid), payloads[assetIdx]));
+
+        const auto entryItr = std::find_if(package.GetTableOfContents().begin(), package.GetTableOfContents().end(),
+            [&guid](const ig::AssetPackage::TocEntry& entry) { return ig::Guid{entry.Guid} == guid; });
+        REQUIRE(entryItr != package.GetTableOfContents().end());
+        const ig::Json serializedMetadata{package.GetSerializedMetadata(*entryItr)};
+        ig::AssetInfo packedAssetInfo{};
+        serializedMetadata >> packedAssetInfo;
+        CHECK(packedAssetInfo.GetGuid() == guid);
+        CHECK(packedAssetInfo.GetVirtualPath() == assetInfos[assetIdx].GetVirtualPath());
+    }
+
+    const ig::Guid unknownGuid{xg::newGuid()};
+    CHECK_FALSE(package.Contains(unknownGuid));
+    CHECK(package.GetAssetData(unknownGuid).empty());
+
+    package.Unmount();
+    CHECK_FALSE(package.IsMounted());
+    CHECK_FALSE(package.Contains(assetInfos.front().GetGuid()));
+}
+
+TEST_CASE("AssetMonitor serves packed data only for packed only assets", "[Asset][AssetPackage]")
+{
+    ScopedAssetRoot scopedRoot{};
+    tf::Executor taskExecutor{};
+    const ig::AssetInfo packedOnlyInfo{"Tests\\PackedOnly", ig::EAssetCategory::Material};
+    const ig::AssetInfo looseInfo{"Tests\\Loose", ig::EAssetCategory::Material};
+    const ig::Vector<ig::U8> packedOnlyPayload{MakePayload(300, 1)};
+    WriteMaterialAsset(packedOnlyInfo, packedOnlyPayload);
+    WriteMaterialAsset(looseInfo, MakePayload(300, 2));
+
+    ig::Result<ig::AssetPackage::BuildReport, ig::EAssetPackageBuildStatus> buildResult{ig::AssetPackage::Build(kPackagePath)};
+    REQUIRE(buildResult.IsSuccess());
+    CHECK(buildResult.Take().NumPackedAssets == 2);
+
+    /* 패키지 생성 이후 Loose 에셋이 같은 Guid 로 재임포트 된 경우 */
+    RemoveLooseAsset(packedOnlyInfo.GetGuid());
+    WriteMaterialAsset(looseInfo, MakePayload(500, 3));
+
+    ig::details::AssetMonitor assetMonitor{taskExecutor};
+    ig::AssetPackage package{};
+    REQUIRE(package.Mount(kPackagePath));
+    CHECK(assetMonitor.MountPackedAssets(package) == 1);
+    CHECK(assetMonitor.IsPackedOnly(packedOnlyInfo.GetGuid()));
+    CHECK_FALSE(assetMonitor.IsPackedOnly(looseInfo.GetGuid()));
+    CHECK(IsSameBytes(assetMonitor.FindPackedAssetData(package, packedOnlyInfo.GetGuid()), packedOnlyPayload));
+    CHECK(assetMonitor.FindPackedAssetData(package, looseInfo.GetGuid()).empty());
+
+    SECTION("Re-import while the package is mounted")
+    {
+        /* AssetManager::ImportImpl 과 같이 기존 Guid 를 유지 한 채 Loose 에셋으로 대체 한다. */
+        assetMonitor.Remove(packedOnlyInfo.GetGuid(), false);
+        WriteMaterialAsset(packedOnlyInfo, MakePayload(700, 4));
+        assetMonitor.Create<ig::Material>(packedOnlyInfo, ig::Material::LoadDesc{});
+
+        CHECK_FALSE(assetMonitor.IsPackedOnly(packedOnlyInfo.GetGuid()));
+        CHECK(package.Contains(packedOnlyInfo.GetGuid()));
+        CHECK(assetMonitor.FindPackedAssetData(package, packedOnlyInfo.GetGuid()).empty());
+    }
+
+    SECTION("Unmount")
+    {
+        assetMonitor.UnmountPackedAssets();
+        CHECK_FALSE(assetMonitor.Contains(packedOnlyInfo.GetGuid()));
+        CHECK(assetMonitor.Contains(looseInfo.GetGuid()));
+        CHECK(assetMonitor.FindPackedAssetData(package, packedOnlyInfo.GetGuid()).empty());
+    }
+}
+
+TEST_CASE("AssetPackage packed/loose load", "[Asset][AssetPackage][!benchmark]")
+{
+    constexpr ig::Size kNumAssets = 1024;
+    constexpr ig::Size kPayloadSize = 64 * 1024;
+    ScopedAssetRoot scopedRoot{};
+    ig::Vector<ig::Guid> guids{};
+    for (ig::Size assetIdx = 0; assetIdx < kNumAssets; ++assetIdx)
+    {
+        const ig::AssetInfo assetInfo{std::format("Tests\\Material_{}", assetIdx), ig::EAssetCategory::Material};
+        WriteMaterialAsset(assetInfo, MakePayload(kPayloadSize, (ig::U32)assetIdx));
+        guids.emplace_back(assetInfo.GetGuid());
+    }
+
+    ig::Result<ig::AssetPackage::BuildReport, ig::EAssetPackageBuildStatus> buildResult{ig::AssetPackage::Build(kPackagePath)};
+    REQUIRE(buildResult.IsSuccess());
+    (void)buildResult.Take();
+    ig::AssetPackage package{};
+    REQUIRE(package.Mount(kPackagePath));
+
+    /* 로더와 같이 에셋 데이터를 업로드 버퍼에 해당하는 메모리로 복사 한다. 두 경우 모두 OS 의 파일 캐시에 올라와 있는 상태를 측정 한다. */
+    ig::Vector<ig::U8> destination(kPayloadSize);
+    BENCHMARK(std::format("Loose {} x {} KiB", kNumAssets, kPayloadSize / 1024))
+    {
+        ig::Size numReadBytes = 0;
+        for (const ig::Guid& guid : guids)
+        {
+            const ig::Vector<ig::U8> blob{ig::LoadBlobFromFile(ig::MakeAssetPath(ig::EAssetCategory::Material, guid))};
+            std::memcpy(destination.data(), blob.data(), blob.size());
+            numReadBytes += blob.size();
+        }
+        return numReadBytes;
+    };
+
+    BENCHMARK(std::format("Packed {} x {} KiB", kNumAssets, kPayloadSize / 1024))
+    {
+        ig::Size numReadBytes = 0;
+        for (const ig::Guid& guid : guids)
+        {
+            const std::span<const ig::U8> packedData{package.GetAssetData(guid)};
+            std::memcpy(destination.data(), packedData.data(), packedData.size());
+            numReadBytes += packedData.size();
+        }
+        return numReadBytes;
+    };
+}
@@ -0,0 +1,413 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Filesystem/AsyncFileIo.h"
+
+namespace
+{
+    using namespace std::chrono_literals;
+
+    void WriteContent(const ig::Path& path, const std::span<const ig::U8> content)
+    {
+        std::ofstream fileStream{path.c_str(), std::ios::binary};
+        fileStream.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()));
+    }
+
+    class ScopedTempFile final
+    {
+    public:
+        explicit ScopedTempFile(const std::span<const ig::U8> content)
+            : path(ig::fs::temp_directory_path() / std::format("IgniterTests_{}.bin", xg::newGuid().str()))
+        {
+            WriteContent(path, content);
+        }
+
+        ~ScopedTempFile()
+        {
+            std::error_code errorCode{};
+            ig::fs::remove(path, errorCode);
+        }
+
+        [[nodiscard]] const ig::Path& GetPath() const noexcept { return path; }
+
+    private:
+        ig::Path path;
+    };
+
+    class ScopedTempDirectory final
+    {
+    public:
+        ScopedTempDirectory()
+            : path(ig::fs::temp_directory_path() / std::format("IgniterTests_{}", xg::newGuid().str()))
+        {
+            ig::fs::create_directories(path);
+        }
+
+        ~ScopedTempDirectory()
+        {
+            std::error_code errorCode{};
+            ig::fs::remove_all(path, errorCode);
+        }
+
+        [[nodiscard]] const ig::Path& GetPath() const noexcept { return path; }
+
+    private:
+        ig::Path path;
+    };
+
+    /* 데이터가 쓰여지기 전 까지 읽기가 완료 되지 않는 Named Pipe. 읽기 요청을 진행 중인 상태로 붙잡아 두는 데 사용 한다. */
+    class ScopedPipe final
+    {
+    public:
+        ScopedPipe()
+            : path(std::format("\\\\.\\pipe\\IgniterTests_{}", xg::newGuid().str()))
+            , pipe(CreateNamedPipe(path.c_str(), PIPE_ACCESS_OUTBOUND, PIPE_TYPE_BYTE | PIPE_WAIT, 1, 4096, 4096, 0, nullptr))
+        {}
+
+        ~ScopedPipe()
+        {
+            if (pipe != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(pipe);
+            }
+        }
+
+        [[nodiscard]] bool IsValid() const noexcept { return pipe != INVALID_HANDLE_VALUE; }
+        [[nodiscard]] const ig::Path& GetPath() const noexcept { return path; }
+
+        /* 읽는 쪽이 파이프를 열 때 까지 대기 한다. */
+        [[nodiscard]] bool WaitForReader()
+        {
+            return ConnectNamedPipe(pipe, nullptr) || GetLastError() == ERROR_PIPE_CONNECTED;
+        }
+
+        [[nodiscard]] bool Write(const std::span<const ig::U8> data)
+        {
+            DWORD numWrittenBytes = 0;
+            return WriteFile(pipe, data.data(), static_cast<DWORD>(data.size()), &numWrittenBytes, nullptr) && numWrittenBytes == data.size();
+        }
+
+    private:
+        ig::Path path;
+        HANDLE pipe{INVALID_HANDLE_VALUE};
+    };
+
+    ig::Vector<ig::U8> MakeContent(const ig::Size numBytes, const ig::U32 seed)
+    {
+        ig::Vector<ig::U8> content(numBytes);
+        for (ig::Size byteIdx = 0; byteIdx < numBytes; ++byteIdx)
+        {
+            content[byteIdx] = static_cast<ig::U8>((byteIdx * 31 + seed) & 0xFF);
+        }
+        return content;
+    }
+
+    /* 콜백은 워커 에서 호출 되므로, 결과는 WaitIdle 이후에 확인 한다. */
+    ig::AsyncReadResult ReadOnce(ig::AsyncFileIo& asyncFileIo, const ig::Path& path, const ig::U64 offset, const std::span<ig::U8> destination)
+    {
+        ig::AsyncReadResult result{.Status = ig::EAsyncReadStatus::Cancelled};
+        ig::Vector<ig::AsyncReadRequest> requests{};
+        requests.emplace_back(ig::AsyncReadRequest{
+            .FilePath = path,
+            .Offset = offset,
+            .Destination = destination,
+            .OnCompleted = [&result](const ig::AsyncReadResult& readResult)
+            {
+                result = readResult;
+            }});
+        asyncFileIo.Submit(std::move(requests));
+        asyncFileIo.WaitIdle();
+        return result;
+    }
+
+    /* 일부 요청이 끝나지 않은 상태 에서는 WaitIdle 을 사용 할 수 없으므로, 남은 요청 수를 직접 확인 한다. */
+    bool WaitForNumOutstanding(const ig::AsyncFileIo& asyncFileIo, const ig::Size numExpected)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + 10s;
+        while (asyncFileIo.GetNumOutstanding() != numExpected)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+
+    /* 캐시 되지 않는(FILE_FLAG_NO_BUFFERING) 핸들로 파일을 열면 캐시 관리자가 해당 파일의 캐시 된 페이지를 비운다. */
+    void EvictFromFileCache(const std::span<const ig::Path> paths)
+    {
+        for (const ig::Path& path : paths)
+        {
+            const HANDLE file = CreateFile(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+            REQUIRE(file != INVALID_HANDLE_VALUE);
+            CloseHandle(file);
+        }
+    }
+
+    ig::Size ReadAllSynchronously(const std::span<const ig::Path> paths, ig::Vector<ig::Vector<ig::U8>>& destinations)
+    {
+        ig::Size numReadBytes = 0;
+        for (ig::Size fileIdx = 0; fileIdx < paths.size(); ++fileIdx)
+        {
+            std::ifstream fileStream{paths[fileIdx].c_str(), std::ios::binary};
+            fileStream.read(reinterpret_cast<char*>(destinations[fileIdx].data()), static_cast<std::streamsize>(destinations[fileIdx].size()));
+            numReadBytes += static_cast<ig::Size>(fileStream.gcount());
+        }
+        return numReadBytes;
+    }
+
+    ig::Size ReadAllAsync(ig::AsyncFileIo& asyncFileIo, const std::span<const ig::Path> paths, ig::Vector<ig::Vector<ig::U8>>& destinations)
+    {
+        std::atomic<ig::Size> numReadBytes{0};
+        ig::Vector<ig::AsyncReadRequest> requests{};
+        requests.reserve(paths.size());
+        for (ig::Size fileIdx = 0; fileIdx < paths.size(); ++fileIdx)
+        {
+            requests.emplace_back(ig::AsyncReadRequest{
+                .FilePath = paths[fileIdx],
+                .Destination = destinations[fileIdx],
+                .OnCompleted = [&numReadBytes](const ig::AsyncReadResult& result)
+                {
+                    numReadBytes.fetch_add(result.NumReadBytes, std::memory_order_relaxed);
+                }});
+        }
+
+        asyncFileIo.Submit(std::move(requests));
+        asyncFileIo.WaitIdle();
+        return numReadBytes.load(std::memory_order_relaxed);
+    }
+
+    constexpr ig::EAsyncFileIoBackend kBackends[]{ig::EAsyncFileIoBackend::CompletionPort, ig::EAsyncFileIoBackend::ThreadPool};
+} // namespace
+
+TEST_CASE("AsyncFileIo reads files through every backend", "[Filesystem][AsyncFileIo]")
+{
+    constexpr ig::Size kNumFiles = 32;
+    constexpr ig::Size kFileSize = 64 * 1024;
+    tf::Executor taskExecutor{};
+
+    ig::Vector<ig::Vector<ig::U8>> contents{};
+    ig::Vector<ig::Ptr<ScopedTempFile>> files{};
+    for (ig::U32 fileIdx = 0; fileIdx < kNumFiles; ++fileIdx)
+    {
+        contents.emplace_back(MakeContent(kFileSize, fileIdx));
+        files.emplace_back(ig::MakePtr<ScopedTempFile>(contents.back()));
+    }
+
+    for (const ig::EAsyncFileIoBackend backend : kBackends)
+    {
+        INFO("Backend: " << static_cast<int>(backend));
+        ig::AsyncFileIo asyncFileIo{taskExecutor, 8, backend};
+        REQUIRE(asyncFileIo.GetBackend() == backend);
+
+        constexpr ig::U64 kOffset = 4096;
+        ig::Vector<ig::Vector<ig::U8>> destinations(kNumFiles, ig::Vector<ig::U8>(kFileSize - kOffset));
+        ig::Vector<ig::AsyncReadResult> results(kNumFiles, ig::AsyncReadResult{.Status = ig::EAsyncReadStatus::Cancelled});
+        ig::Vector<ig::AsyncReadRequest> requests{};
+        for (ig::Size fileIdx = 0; fileIdx < kNumFiles; ++fileIdx)
+        {
+            requests.emplace_back(ig::AsyncReadRequest{
+                .FilePath = files[fileIdx]->GetPath(),
+                .Offset = kOffset,
+                .Destination = destinations[fileIdx],
+                .OnCompleted = [&results, fileIdx](const ig::AsyncReadResult& result)
+                {
+                    results[fileIdx] = result;
+                }});
+        }
+
+        asyncFileIo.Submit(std::move(requests));
+        asyncFileIo.WaitIdle();
+        CHECK(asyncFileIo.GetNumOutstanding() == 0);
+        for (ig::Size fileIdx = 0; fileIdx < kNumFiles; ++fileIdx)
+        {
+            CHECK(results[fileIdx].Status == ig::EAsyncReadStatus::Success);
+            CHECK(results[fileIdx].NumReadBytes == kFileSize - kOffset);
+            CHECK(std::equal(destinations[fileIdx].begin(), destinations[fileIdx].end(), contents[fileIdx].begin() + kOffset));
+        }
+    }
+}
+
+TEST_CASE("AsyncFileIo treats reads past the end of file as short reads", "[Filesystem][AsyncFileIo]")
+{
+    constexpr ig::Size kFileSize = 1000;
+    tf::Executor taskExecutor{};
+    const ig::Vector<ig::U8> content{MakeContent(kFileSize, 7)};
+    const ScopedTempFile file{content};
+
+    for (const ig::EAsyncFileIoBackend backend : kBackends)
+    {
+        INFO("Backend: " << static_cast<int>(backend));
+        ig::AsyncFileIo asyncFileIo{taskExecutor, ig::AsyncFileIo::kDefaultMaxInFlight, backend};
+        ig::Vector<ig::U8> destination(4096);
+
+        const ig::AsyncReadResult partialResult{ReadOnce(asyncFileIo, file.GetPath(), 600, destination)};
+        CHECK(partialResult.Status == ig::EAsyncReadStatus::Success);
+        CHECK(partialResult.NumReadBytes == kFileSize - 600);
+        CHECK(std::equal(destination.begin(), destination.begin() + (kFileSize - 600), content.begin() + 600));
+
+        /* 파일 끝 이후 에서 시작 하는 읽기는 동기적으로 EOF 가 보고 될 수 있다. */
+        const ig::AsyncReadResult pastEndResult{ReadOnce(asyncFileIo, file.GetPath(), kFileSize + 512, destination)};
+        CHECK(pastEndResult.Status == ig::EAsyncReadStatus::Success);
+        CHECK(pastEndResult.NumReadBytes == 0);
+    }
+}
+
+TEST_CASE("AsyncFileIo reports missing files", "[Filesystem][AsyncFileIo]")
+{
+    tf::Executor taskExecutor{};
+    const ig::Path missingPath{ig::fs::temp_directory_path() / std::format("IgniterTests_{}.bin", xg::newGuid().str())};
+    for (const ig::EAsyncFileIoBackend backend : kBackends)
+    {
+        INFO("Backend: " << static_cast<int>(backend));
+        ig::AsyncFileIo asyncFileIo{taskExecutor, ig::AsyncFileIo::kDefaultMaxInFlight, backend};
+        ig::Vector<ig::U8> destination(16);
+        CHECK(ReadOnce(asyncFileIo, missingPath, 0, destination).Status == ig::EAsyncReadStatus::FileDoesNotExists);
+    }
+}
+
+TEST_CASE("AsyncFileIo cancels the remaining reads of a batch", "[Filesystem][AsyncFileIo]")
+{
+    constexpr ig::Size kNumFiles = 64;
+    constexpr ig::Size kFileSize = 4096;
+    tf::Executor taskExecutor{};
+    const ig::Vector<ig::U8> content{MakeContent(kFileSize, 3)};
+    const ScopedTempFile file{content};
+    const ig::Vector<ig::U8> message{MakeContent(16, 5)};
+
+    for (const ig::EAsyncFileIoBackend backend : kBackends)
+    {
+        INFO("Backend: " << static_cast<int>(backend));
+        /* 한번에 하나의 읽기만 진행 되므로, 파이프 읽기가 끝나기 전 까지 이후 배치의 요청 들은 대기 상태로 남는다. */
+        ig::AsyncFileIo asyncFileIo{taskExecutor, 1, backend};
+        /* 검사가 중간에 실패 하더라도 파이프가 먼저 닫혀 진행 중인 읽기가 실패로 끝나도록, AsyncFileIo 보다 나중에 생성 한다. */
+        ScopedPipe pipe{};
+        REQUIRE(pipe.IsValid());
+        ig::Vector<ig::U8> pipeDestination(message.size());
+        ig::AsyncReadResult pipeResult{.Status = ig::EAsyncReadStatus::FailedToRead};
+        ig::U32 numPipeCallbacks = 0;
+        ig::Vector<ig::AsyncReadRequest> pipeRequests{};
+        pipeRequests.emplace_back(ig::AsyncReadRequest{
+            .FilePath = pipe.GetPath(),
+            .Destination = pipeDestination,
+            .OnCompleted = [&pipeResult, &numPipeCallbacks](const ig::AsyncReadResult& result)
+            {
+                pipeResult = result;
+                ++numPipeCallbacks;
+            }});
+        const ig::U64 pipeBatchId = asyncFileIo.Submit(std::move(pipeRequests));
+        REQUIRE(pipe.WaitForReader());
+
+        ig::Vector<ig::Vector<ig::U8>> destinations(kNumFiles, ig::Vector<ig::U8>(kFileSize));
+        ig::Vector<ig::AsyncReadResult> results(kNumFiles, ig::AsyncReadResult{.Status = ig::EAsyncReadStatus::FailedToRead});
+        ig::Vector<ig::U32> numCallbacks(kNumFiles, 0);
+        ig::Vector<ig::AsyncReadRequest> requests{};
+        for (ig::Size fileIdx = 0; fileIdx < kNumFiles; ++fileIdx)
+        {
+            requests.emplace_back(ig::AsyncReadRequest{
+                .FilePath = file.GetPath(),
+                .Destination = destinations[fileIdx],
+                .OnCompleted = [&results, &numCallbacks, fileIdx](const ig::AsyncReadResult& result)
+                {
+                    results[fileIdx] = result;
+                    ++numCallbacks[fileIdx];
+                }});
+        }
+        const ig::U64 batchId = asyncFileIo.Submit(std::move(requests));
+        CHECK(batchId != pipeBatchId);
+        CHECK(asyncFileIo.GetNumOutstanding() == kNumFiles + 1);
+
+        /* 대기 중인 요청 들은 모두 Cancelled 로 한 번씩 통지 되며, 다른 배치 에는 영향을 주지 않는다. */
+        asyncFileIo.Cancel(batchId);
+        REQUIRE(WaitForNumOutstanding(asyncFileIo, 1));
+        for (ig::Size fileIdx = 0; fileIdx < kNumFiles; ++fileIdx)
+        {
+            CHECK(numCallbacks[fileIdx] == 1);
+            CHECK(results[fileIdx].Status == ig::EAsyncReadStatus::Cancelled);
+            CHECK(results[fileIdx].NumReadBytes == 0);
+        }
+        CHECK(numPipeCallbacks == 0);
+
+        if (backend == ig::EAsyncFileIoBackend::CompletionPort)
+        {
+            /* 진행 중인 Overlapped 읽기는 CancelIoEx 로 취소 된다. 읽기가 커널에 제출 되기 전에 취소를 시도 했을 수 있으므로 반복 한다. */
+            const auto deadline = std::chrono::steady_clock::now() + 10s;
+            while (asyncFileIo.GetNumOutstanding() > 0 && std::chrono::steady_clock::now() < deadline)
+            {
+                asyncFileIo.Cancel(pipeBatchId);
+                std::this_thread::sleep_for(1ms);
+            }
+            REQUIRE(asyncFileIo.GetNumOutstanding() == 0);
+            CHECK(pipeResult.Status == ig::EAsyncReadStatus::Cancelled);
+        }
+        else
+        {
+            /* ThreadPool 백엔드는 진행 중인 읽기를 취소 하지 않으므로, 데이터가 쓰여진 후 정상적으로 완료 된다. */
+            asyncFileIo.Cancel(pipeBatchId);
+            CHECK(asyncFileIo.GetNumOutstanding() == 1);
+            REQUIRE(pipe.Write(message));
+            asyncFileIo.WaitIdle();
+            CHECK(pipeResult.Status == ig::EAsyncReadStatus::Success);
+            CHECK(pipeResult.NumReadBytes == message.size());
+            CHECK(pipeDestination == message);
+        }
+        CHECK(numPipeCallbacks == 1);
+
+        /* 취소 이후 에도 새로운 배치는 정상적으로 처리 된다. */
+        const ig::AsyncReadResult result{ReadOnce(asyncFileIo, file.GetPath(), 0, destinations.front())};
+        CHECK(result.Status == ig::EAsyncReadStatus::Success);
+        CHECK(result.NumReadBytes == kFileSize);
+        CHECK(destinations.front() == content);
+    }
+}
+
+TEST_CASE("AsyncFileIo throughput", "[Filesystem][AsyncFileIo][!benchmark]")
+{
+    /* 에셋 디렉터리와 같이 작은 파일이 많은 경우. Cold 는 매 샘플 마다 파일들을 캐시에서 내보낸 뒤 측정 한다. */
+    constexpr ig::Size kNumFiles = 10000;
+    constexpr ig::Size kFileSize = 16 * 1024;
+    tf::Executor taskExecutor{};
+    const ScopedTempDirectory directory{};
+    ig::Vector<ig::Path> paths{};
+    paths.reserve(kNumFiles);
+    for (ig::U32 fileIdx = 0; fileIdx < kNumFiles; ++fileIdx)
+    {
+        paths.emplace_back(directory.GetPath() / std::format("File_{}.bin", fileIdx));
+        WriteContent(paths.back(), MakeContent(kFileSize, fileIdx));
+    }
+
+    ig::Vector<ig::Vector<ig::U8>> destinations(kNumFiles, ig::Vector<ig::U8>(kFileSize));
+    ig::AsyncFileIo completionPortFileIo{taskExecutor, ig::AsyncFileIo::kDefaultMaxInFlight, ig::EAsyncFileIoBackend::CompletionPort};
+    ig::AsyncFileIo threadPoolFileIo{taskExecutor, ig::AsyncFileIo::kDefaultMaxInFlight, ig::EAsyncFileIoBackend::ThreadPool};
+
+    struct Reader
+    {
+        std::string_view Name;
+        std::function<ig::Size()> ReadAll;
+    };
+
+    /* 동기 std::ifstream 읽기를 기준으로 비교 한다. */
+    const Reader readers[]{
+        {"std::ifstream", [&paths, &destinations]() { return ReadAllSynchronously(paths, destinations); }},
+        {"CompletionPort", [&completionPortFileIo, &paths, &destinations]() { return ReadAllAsync(completionPortFileIo, paths, destinations); }},
+        {"ThreadPool", [&threadPoolFileIo, &paths, &destinations]() { return ReadAllAsync(threadPoolFileIo, paths, destinations); }},
+    };
+
+    for (const Reader& reader : readers)
+    {
+        BENCHMARK_ADVANCED(std::format("Cold {} x {} KiB ({})", kNumFiles, kFileSize / 1024, reader.Name))(Catch::Benchmark::Chronometer meter)
+        {
+            EvictFromFileCache(paths);
+            meter.measure(
+                [&reader]()
+                {
+                    return reader.ReadAll();
+                });
+        };
+
+        BENCHMARK(std::format("Warm {} x {} KiB ({})", kNumFiles, kFileSize / 1024, reader.Name))
+        {
+            return reader.ReadAll();
+        };
+    }
+}
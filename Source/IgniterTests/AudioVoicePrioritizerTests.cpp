@@ -0,0 +1,140 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Audio/AudioVoicePrioritizer.h"
+
+namespace
+{
+    using ig::details::AudioVoicePrioritizer;
+
+    /* AudioSystem 과 같이 매 프레임 우선 순위를 갱신 하고, 실제 채널의 할당/해제 횟수를 기록 하는 가짜 오디오 백엔드 */
+    class StubVoiceBackend
+    {
+    public:
+        StubVoiceBackend(const ig::Size numVoices, const ig::U32 maxRealVoices)
+            : maxRealVoices(maxRealVoices)
+            , bWasReal(numVoices, 0)
+            , bShouldBeReal(numVoices, 0)
+        {
+        }
+
+        void Update(const std::span<const float> audibility)
+        {
+            const ig::U32 numRealVoices = AudioVoicePrioritizer::SelectRealVoices(audibility, bWasReal, maxRealVoices, bShouldBeReal, candidates);
+            REQUIRE(numRealVoices <= maxRealVoices);
+            for (ig::Size voiceIdx = 0; voiceIdx < bWasReal.size(); ++voiceIdx)
+            {
+                if (bShouldBeReal[voiceIdx] != 0 && bWasReal[voiceIdx] == 0)
+                {
+                    ++numAcquiredChannels;
+                }
+                else if (bShouldBeReal[voiceIdx] == 0 && bWasReal[voiceIdx] != 0)
+                {
+                    ++numReleasedChannels;
+                }
+            }
+            bWasReal = bShouldBeReal;
+        }
+
+        [[nodiscard]] bool IsReal(const ig::Index voiceIdx) const { return bWasReal[voiceIdx] != 0; }
+        [[nodiscard]] ig::Size GetNumAcquiredChannels() const noexcept { return numAcquiredChannels; }
+        [[nodiscard]] ig::Size GetNumReleasedChannels() const noexcept { return numReleasedChannels; }
+
+    private:
+        ig::U32 maxRealVoices = 0;
+        ig::Vector<ig::U8> bWasReal;
+        ig::Vector<ig::U8> bShouldBeReal;
+        ig::Vector<ig::Index> candidates;
+        ig::Size numAcquiredChannels = 0;
+        ig::Size numReleasedChannels = 0;
+    };
+} // namespace
+
+TEST_CASE("AudioVoicePrioritizer estimates inverse rolloff attenuation", "[Audio][AudioVoicePrioritizer]")
+{
+    const ig::Vector3 listeners[]{ig::Vector3{0.f, 0.f, 0.f}, ig::Vector3{100.f, 0.f, 0.f}};
+    const std::span<const ig::Vector3> nearListener{listeners, 1};
+
+    CHECK(AudioVoicePrioritizer::EstimateAttenuation(ig::Vector3{0.5f, 0.f, 0.f}, 1.f, 50.f, nearListener) == Catch::Approx(1.f));
+    CHECK(AudioVoicePrioritizer::EstimateAttenuation(ig::Vector3{0.f, 4.f, 0.f}, 2.f, 50.f, nearListener) == Catch::Approx(0.5f));
+    /* maxDistance 이후 에는 더 이상 감쇠 하지 않는다. */
+    CHECK(AudioVoicePrioritizer::EstimateAttenuation(ig::Vector3{0.f, 0.f, 80.f}, 2.f, 50.f, nearListener) == Catch::Approx(2.f / 50.f));
+    /* 가장 가까운 리스너를 기준으로 한다. */
+    CHECK(AudioVoicePrioritizer::EstimateAttenuation(ig::Vector3{90.f, 0.f, 0.f}, 1.f, 50.f, listeners) == Catch::Approx(0.1f));
+    /* 리스너가 없다면 감쇠 하지 않는다. */
+    CHECK(AudioVoicePrioritizer::EstimateAttenuation(ig::Vector3{90.f, 0.f, 0.f}, 1.f, 50.f, {}) == 1.f);
+}
+
+TEST_CASE("AudioVoicePrioritizer selects the most audible voices", "[Audio][AudioVoicePrioritizer]")
+{
+    ig::Vector<ig::Index> candidates{};
+
+    SECTION("Top N")
+    {
+        const float audibility[]{0.2f, 0.9f, 0.f, 0.5f, 0.7f, 0.5f, 1e-5f};
+        const ig::U8 bWasReal[std::size(audibility)]{};
+        ig::U8 bShouldBeReal[std::size(audibility)]{};
+        CHECK(AudioVoicePrioritizer::SelectRealVoices(audibility, bWasReal, 3, bShouldBeReal, candidates) == 3);
+        /* 0.5 가 동일 하다면 인덱스가 작은 보이스가 선택 된다. */
+        constexpr ig::U8 kExpected[std::size(audibility)]{0, 1, 0, 1, 1, 0, 0};
+        CHECK(std::equal(std::begin(bShouldBeReal), std::end(bShouldBeReal), std::begin(kExpected)));
+    }
+
+    SECTION("Inaudible voices are never real")
+    {
+        const float audibility[]{0.f, AudioVoicePrioritizer::kMinAudibility, 0.3f};
+        const ig::U8 bWasReal[std::size(audibility)]{1, 1, 0};
+        ig::U8 bShouldBeReal[std::size(audibility)]{1, 1, 1};
+        CHECK(AudioVoicePrioritizer::SelectRealVoices(audibility, bWasReal, 8, bShouldBeReal, candidates) == 1);
+        CHECK(bShouldBeReal[0] == 0);
+        CHECK(bShouldBeReal[1] == 0);
+        CHECK(bShouldBeReal[2] == 1);
+    }
+
+    SECTION("No real voices")
+    {
+        const float audibility[]{0.4f, 0.8f};
+        const ig::U8 bWasReal[std::size(audibility)]{1, 1};
+        ig::U8 bShouldBeReal[std::size(audibility)]{};
+        CHECK(AudioVoicePrioritizer::SelectRealVoices(audibility, bWasReal, 0, bShouldBeReal, candidates) == 0);
+        CHECK(bShouldBeReal[0] == 0);
+        CHECK(bShouldBeReal[1] == 0);
+    }
+}
+
+TEST_CASE("AudioVoicePrioritizer hysteresis keeps similar voices stable", "[Audio][AudioVoicePrioritizer]")
+{
+    constexpr ig::Size kNumVoices = 16;
+    constexpr ig::U32 kMaxRealVoices = 8;
+    constexpr ig::Size kNumFrames = 600;
+    /* 가장 작은 실제 보이스(0.95) * Hysteresis 가 가장 큰 가상 보이스(0.9 * 1.05) 보다 크다. */
+    constexpr float kJitter = 0.05f;
+    static_assert(0.95f * AudioVoicePrioritizer::kRealVoiceHysteresis > 0.9f * 1.05f);
+
+    StubVoiceBackend backend{kNumVoices, kMaxRealVoices};
+    std::mt19937 generator{0xA0D10};
+    std::uniform_real_distribution<float> jitter{1.f - kJitter, 1.f + kJitter};
+    ig::Vector<float> audibility(kNumVoices);
+    for (ig::Size frame = 0; frame < kNumFrames; ++frame)
+    {
+        /* 앞쪽 절반은 조금 더 크게 들리는 보이스. 매 프레임 감쇠가 조금씩 흔들린다. */
+        for (ig::Size voiceIdx = 0; voiceIdx < kNumVoices; ++voiceIdx)
+        {
+            audibility[voiceIdx] = (voiceIdx < kMaxRealVoices ? 1.f : 0.9f) * jitter(generator);
+        }
+        backend.Update(audibility);
+    }
+
+    /* 첫 프레임 이후 채널은 교체 되지 않는다. */
+    CHECK(backend.GetNumAcquiredChannels() == kMaxRealVoices);
+    CHECK(backend.GetNumReleasedChannels() == 0);
+    for (ig::Index voiceIdx = 0; voiceIdx < kNumVoices; ++voiceIdx)
+    {
+        CHECK(backend.IsReal(voiceIdx) == (voiceIdx < kMaxRealVoices));
+    }
+
+    /* Hysteresis 보다 크게 들리는 보이스는 실제 보이스를 대체 한다. */
+    audibility[kNumVoices - 1] = 1.f * AudioVoicePrioritizer::kRealVoiceHysteresis * 1.5f;
+    backend.Update(audibility);
+    CHECK(backend.IsReal(kNumVoices - 1));
+    CHECK(backend.GetNumAcquiredChannels() == kMaxRealVoices + 1);
+    CHECK(backend.GetNumReleasedChannels() == 1);
+}
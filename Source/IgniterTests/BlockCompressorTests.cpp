@@ -0,0 +1,210 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/BlockCompressor.h"
+
+namespace
+{
+    using ig::details::BlockCompressor;
+    using ig::details::EBlockCompressionFormat;
+
+    constexpr EBlockCompressionFormat kFormats[]{
+        EBlockCompressionFormat::BC1, EBlockCompressionFormat::BC3, EBlockCompressionFormat::BC4, EBlockCompressionFormat::BC5, EBlockCompressionFormat::BC7};
+    constexpr ig::ETextureCompressionQuality kQualities[]{
+        ig::ETextureCompressionQuality::Fast, ig::ETextureCompressionQuality::Normal, ig::ETextureCompressionQuality::High};
+
+    struct TestImage
+    {
+    public:
+        [[nodiscard]] ig::details::BlockImageView GetView() const
+        {
+            return ig::details::BlockImageView{.Pixels = Pixels.data(), .Width = Width, .Height = Height, .RowPitch = (ig::Size)Width * 4};
+        }
+
+    public:
+        ig::U32 Width = 0;
+        ig::U32 Height = 0;
+        ig::Vector<ig::U8> Pixels;
+    };
+
+    struct CompressedImage
+    {
+    public:
+        CompressedImage(const EBlockCompressionFormat format, const ig::U32 width, const ig::U32 height)
+            : RowPitch(BlockCompressor::GetNumBlocks(width) * BlockCompressor::GetBlockSize(format))
+            , Blocks(RowPitch * BlockCompressor::GetNumBlocks(height))
+        {
+        }
+
+        [[nodiscard]] ig::details::CompressedImageView GetView() { return ig::details::CompressedImageView{.Blocks = Blocks.data(), .RowPitch = RowPitch}; }
+
+    public:
+        ig::Size RowPitch = 0;
+        ig::Vector<ig::U8> Blocks;
+    };
+
+    /* 부드러운 그라디언트 위에 약간의 노이즈. 알파는 가로 방향 그라디언트 */
+    TestImage MakeGradientImage(const ig::U32 width, const ig::U32 height, const ig::U32 seed)
+    {
+        TestImage image{.Width = width, .Height = height, .Pixels = ig::Vector<ig::U8>((ig::Size)width * height * 4)};
+        std::mt19937 generator{seed};
+        std::uniform_int_distribution<int> noise{-3, 3};
+        for (ig::U32 y = 0; y < height; ++y)
+        {
+            for (ig::U32 x = 0; x < width; ++x)
+            {
+                ig::U8* pixel = &image.Pixels[((ig::Size)y * width + x) * 4];
+                const int red = (int)(x * 255 / std::max(width - 1, 1u));
+                const int green = (int)(y * 255 / std::max(height - 1, 1u));
+                const int blue = (red + green) / 2;
+                pixel[0] = (ig::U8)std::clamp(red + noise(generator), 0, 255);
+                pixel[1] = (ig::U8)std::clamp(green + noise(generator), 0, 255);
+                pixel[2] = (ig::U8)std::clamp(blue + noise(generator), 0, 255);
+                pixel[3] = (ig::U8)(255 - red);
+            }
+        }
+        return image;
+    }
+
+    const char* ToString(const EBlockCompressionFormat format)
+    {
+        constexpr const char* kNames[]{"BC1", "BC3", "BC4", "BC5", "BC7"};
+        return kNames[(ig::U8)format];
+    }
+
+    const char* ToString(const ig::ETextureCompressionQuality quality)
+    {
+        constexpr const char* kNames[]{"Fast", "Normal", "High"};
+        return kNames[(ig::U8)quality];
+    }
+} // namespace
+
+TEST_CASE("BlockCompressor reports block sizes and counts", "[Asset][BlockCompressor]")
+{
+    CHECK(BlockCompressor::GetBlockSize(EBlockCompressionFormat::BC1) == 8);
+    CHECK(BlockCompressor::GetBlockSize(EBlockCompressionFormat::BC3) == 16);
+    CHECK(BlockCompressor::GetBlockSize(EBlockCompressionFormat::BC4) == 8);
+    CHECK(BlockCompressor::GetBlockSize(EBlockCompressionFormat::BC5) == 16);
+    CHECK(BlockCompressor::GetBlockSize(EBlockCompressionFormat::BC7) == 16);
+
+    CHECK(BlockCompressor::GetNumBlocks(0) == 1);
+    CHECK(BlockCompressor::GetNumBlocks(1) == 1);
+    CHECK(BlockCompressor::GetNumBlocks(4) == 1);
+    CHECK(BlockCompressor::GetNumBlocks(5) == 2);
+    CHECK(BlockCompressor::GetNumBlocks(1024) == 256);
+}
+
+TEST_CASE("BlockCompressor reproduces solid blocks", "[Asset][BlockCompressor]")
+{
+    constexpr ig::U8 kColor[4]{200, 100, 30, 180};
+    ig::U8 pixels[16][4];
+    for (auto& pixel : pixels)
+    {
+        std::copy(std::begin(kColor), std::end(kColor), pixel);
+    }
+
+    for (const EBlockCompressionFormat format : kFormats)
+    {
+        for (const ig::ETextureCompressionQuality quality : kQualities)
+        {
+            INFO(ToString(format) << " " << ToString(quality));
+            ig::U8 block[16]{};
+            BlockCompressor::EncodeBlock(format, quality, pixels, block);
+
+            ig::U8 decoded[16][4];
+            REQUIRE(BlockCompressor::DecodeBlock(format, block, decoded));
+            /* BC1/BC3 의 색상은 RGB565 엔드포인트의 보간 이므로 채널 당 몇 단계의 오차가 허용 된다. */
+            const int tolerance = (format == EBlockCompressionFormat::BC1 || format == EBlockCompressionFormat::BC3) ? 8 : 2;
+            const ig::U32 numChannels = format == EBlockCompressionFormat::BC4 ? 1 : format == EBlockCompressionFormat::BC5 ? 2 : format == EBlockCompressionFormat::BC1 ? 3 : 4;
+            for (const auto& decodedPixel : decoded)
+            {
+                for (ig::U32 channel = 0; channel < numChannels; ++channel)
+                {
+                    CHECK(std::abs((int)decodedPixel[channel] - (int)kColor[channel]) <= tolerance);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("BlockCompressor compresses images in parallel deterministically", "[Asset][BlockCompressor]")
+{
+    tf::Executor taskExecutor{};
+    /* 블록 크기의 배수가 아닌 Mip 체인 */
+    const TestImage images[]{MakeGradientImage(61, 37, 1), MakeGradientImage(30, 18, 2), MakeGradientImage(15, 9, 3), MakeGradientImage(1, 1, 4)};
+    for (const EBlockCompressionFormat format : kFormats)
+    {
+        INFO(ToString(format));
+        ig::Vector<ig::details::BlockImageView> srcViews{};
+        ig::Vector<CompressedImage> compressedImages{};
+        for (const TestImage& image : images)
+        {
+            srcViews.emplace_back(image.GetView());
+            compressedImages.emplace_back(format, image.Width, image.Height);
+        }
+        ig::Vector<ig::details::CompressedImageView> dstViews{};
+        for (CompressedImage& compressedImage : compressedImages)
+        {
+            dstViews.emplace_back(compressedImage.GetView());
+        }
+
+        BlockCompressor::Compress(taskExecutor, format, ig::ETextureCompressionQuality::Normal, srcViews, dstViews);
+
+        for (ig::Size imageIdx = 0; imageIdx < srcViews.size(); ++imageIdx)
+        {
+            /* 한 장 씩 압축한 결과와 같아야 한다. */
+            CompressedImage serialImage{format, images[imageIdx].Width, images[imageIdx].Height};
+            const ig::details::CompressedImageView serialView{serialImage.GetView()};
+            BlockCompressor::Compress(taskExecutor, format, ig::ETextureCompressionQuality::Normal,
+                std::span{&srcViews[imageIdx], 1}, std::span{&serialView, 1});
+            CHECK(serialImage.Blocks == compressedImages[imageIdx].Blocks);
+
+            const ig::F64 psnr = BlockCompressor::ComputePsnr(format, srcViews[imageIdx], dstViews[imageIdx]);
+            CHECK(psnr > 30.0);
+        }
+    }
+}
+
+TEST_CASE("BlockCompressor quality presets do not lose quality", "[Asset][BlockCompressor]")
+{
+    tf::Executor taskExecutor{};
+    const TestImage image{MakeGradientImage(64, 64, 5)};
+    const ig::details::BlockImageView srcView{image.GetView()};
+    for (const EBlockCompressionFormat format : kFormats)
+    {
+        INFO(ToString(format));
+        ig::F64 prevPsnr = 0.0;
+        for (const ig::ETextureCompressionQuality quality : kQualities)
+        {
+            CompressedImage compressedImage{format, image.Width, image.Height};
+            const ig::details::CompressedImageView dstView{compressedImage.GetView()};
+            BlockCompressor::Compress(taskExecutor, format, quality, std::span{&srcView, 1}, std::span{&dstView, 1});
+
+            /* 보정 단계는 오차가 줄어드는 경우에만 적용 되므로, 높은 품질이 낮은 품질 보다 눈에 띄게 나빠선 안된다. */
+            const ig::F64 psnr = BlockCompressor::ComputePsnr(format, srcView, dstView);
+            CHECK(psnr >= prevPsnr - 0.5);
+            prevPsnr = psnr;
+        }
+    }
+}
+
+TEST_CASE("BlockCompressor PSNR and throughput", "[Asset][BlockCompressor][!benchmark]")
+{
+    tf::Executor taskExecutor{};
+    const TestImage image{MakeGradientImage(1024, 1024, 6)};
+    const ig::details::BlockImageView srcView{image.GetView()};
+    for (const EBlockCompressionFormat format : kFormats)
+    {
+        for (const ig::ETextureCompressionQuality quality : kQualities)
+        {
+            CompressedImage compressedImage{format, image.Width, image.Height};
+            const ig::details::CompressedImageView dstView{compressedImage.GetView()};
+            BlockCompressor::Compress(taskExecutor, format, quality, std::span{&srcView, 1}, std::span{&dstView, 1});
+            const ig::F64 psnr = BlockCompressor::ComputePsnr(format, srcView, dstView);
+
+            BENCHMARK(std::format("1024x1024 {} {} ({:.2f} dB)", ToString(format), ToString(quality), psnr))
+            {
+                BlockCompressor::Compress(taskExecutor, format, quality, std::span{&srcView, 1}, std::span{&dstView, 1});
+                return compressedImage.Blocks[0];
+            };
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/ClusterLodBuilder.h"
+
+namespace
+{
+    struct TestMesh
+    {
+    public:
+        ig::Vector<ig::Vertex> Vertices;
+        ig::Vector<ig::U32> Indices;
+    };
+
+    /* 단순화 오차가 0 이 되지 않도록 높이가 굴곡진 (gridSize x gridSize) 평면 */
+    TestMesh BuildWavyGrid(const ig::U32 gridSize)
+    {
+        TestMesh mesh{};
+        for (ig::U32 y = 0; y <= gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x <= gridSize; ++x)
+            {
+                ig::Vertex vertex{};
+                vertex.Position = ig::Vector3{(ig::F32)x, (ig::F32)y, std::sin((ig::F32)x * 0.35f) * std::cos((ig::F32)y * 0.25f) * 2.f};
+                mesh.Vertices.emplace_back(vertex);
+            }
+        }
+
+        for (ig::U32 y = 0; y < gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x < gridSize; ++x)
+            {
+                const ig::U32 v0 = y * (gridSize + 1) + x;
+                const ig::U32 v1 = v0 + 1;
+                const ig::U32 v2 = v0 + gridSize + 1;
+                const ig::U32 v3 = v2 + 1;
+                mesh.Indices.insert(mesh.Indices.end(), {v0, v2, v1, v1, v2, v3});
+            }
+        }
+
+        return mesh;
+    }
+
+    ig::Size GetNumTriangles(const ig::details::ClusterLodLevel& level)
+    {
+        ig::Size numTriangles = 0;
+        for (const ig::Meshlet& meshlet : level.Meshlets)
+        {
+            numTriangles += meshlet.NumTriangles;
+        }
+        return numTriangles;
+    }
+} // namespace
+
+TEST_CASE("ClusterLodBuilder builds a hierarchy with monotonic error", "[Asset][ClusterLodBuilder]")
+{
+    using ig::details::ClusterLodBuilder;
+    const TestMesh mesh{BuildWavyGrid(64)};
+    const ig::details::ClusterLodHierarchy hierarchy{ClusterLodBuilder::Build(mesh.Vertices, mesh.Indices, ig::Mesh::kMaxMeshLevelOfDetails)};
+
+    REQUIRE(hierarchy.Levels.size() >= 2);
+    CHECK(hierarchy.Levels.size() <= ig::Mesh::kMaxMeshLevelOfDetails);
+    CHECK(GetNumTriangles(hierarchy.Levels[0]) == mesh.Indices.size() / ig::Mesh::kNumVertexPerTriangle);
+    CHECK(ClusterLodBuilder::ValidateErrorMonotonicity(hierarchy));
+
+    ig::F32 prevMaxLodError = 0.f;
+    for (ig::Size levelIdx = 0; levelIdx < hierarchy.Levels.size(); ++levelIdx)
+    {
+        INFO("Level: " << levelIdx);
+        const ig::details::ClusterLodLevel& level = hierarchy.Levels[levelIdx];
+        REQUIRE_FALSE(level.Meshlets.empty());
+        if (levelIdx > 0)
+        {
+            CHECK(GetNumTriangles(level) < GetNumTriangles(hierarchy.Levels[levelIdx - 1]));
+        }
+
+        ig::F32 maxLodError = 0.f;
+        for (const ig::Meshlet& meshlet : level.Meshlets)
+        {
+            CHECK(meshlet.LodError <= meshlet.ParentLodError);
+            CHECK(meshlet.NumTriangles <= ig::Meshlet::kMaxTriangles);
+            CHECK(meshlet.NumIndices <= ig::Meshlet::kMaxVertices);
+            maxLodError = std::max(maxLodError, meshlet.LodError);
+        }
+
+        /* 상위 단계 일 수록 오차가 커진다. */
+        CHECK(maxLodError >= prevMaxLodError);
+        prevMaxLodError = maxLodError;
+    }
+    CHECK(prevMaxLodError > 0.f);
+}
+
+TEST_CASE("ClusterLodBuilder is deterministic", "[Asset][ClusterLodBuilder]")
+{
+    using ig::details::ClusterLodBuilder;
+    const TestMesh mesh{BuildWavyGrid(32)};
+    const ig::details::ClusterLodHierarchy lhs{ClusterLodBuilder::Build(mesh.Vertices, mesh.Indices, ig::Mesh::kMaxMeshLevelOfDetails)};
+    const ig::details::ClusterLodHierarchy rhs{ClusterLodBuilder::Build(mesh.Vertices, mesh.Indices, ig::Mesh::kMaxMeshLevelOfDetails)};
+
+    REQUIRE(lhs.Levels.size() == rhs.Levels.size());
+    for (ig::Size levelIdx = 0; levelIdx < lhs.Levels.size(); ++levelIdx)
+    {
+        const ig::details::ClusterLodLevel& lhsLevel = lhs.Levels[levelIdx];
+        const ig::details::ClusterLodLevel& rhsLevel = rhs.Levels[levelIdx];
+        CHECK(lhsLevel.MeshletVertexIndices == rhsLevel.MeshletVertexIndices);
+        CHECK(lhsLevel.MeshletTriangles == rhsLevel.MeshletTriangles);
+        REQUIRE(lhsLevel.Meshlets.size() == rhsLevel.Meshlets.size());
+        CHECK(std::memcmp(lhsLevel.Meshlets.data(), rhsLevel.Meshlets.data(), sizeof(ig::Meshlet) * lhsLevel.Meshlets.size()) == 0);
+    }
+}
+
+TEST_CASE("ClusterLodBuilder validation rejects broken hierarchies", "[Asset][ClusterLodBuilder]")
+{
+    using ig::details::ClusterLodBuilder;
+    const TestMesh mesh{BuildWavyGrid(64)};
+    const ig::details::ClusterLodHierarchy hierarchy{ClusterLodBuilder::Build(mesh.Vertices, mesh.Indices, ig::Mesh::kMaxMeshLevelOfDetails)};
+    REQUIRE(hierarchy.Levels.size() >= 2);
+    REQUIRE(ClusterLodBuilder::ValidateErrorMonotonicity(hierarchy));
+
+    SECTION("Parent error below child error")
+    {
+        ig::details::ClusterLodHierarchy broken{hierarchy};
+        broken.Levels[0].Meshlets[0].ParentLodError = -1.f;
+        CHECK_FALSE(ClusterLodBuilder::ValidateErrorMonotonicity(broken));
+    }
+
+    SECTION("Parent bounds not containing child bounds")
+    {
+        ig::details::ClusterLodHierarchy broken{hierarchy};
+        ig::Meshlet& meshlet = broken.Levels[0].Meshlets[0];
+        meshlet.LodBounds.Radius = meshlet.ParentLodBounds.Radius * 2.f + 1.f;
+        CHECK_FALSE(ClusterLodBuilder::ValidateErrorMonotonicity(broken));
+    }
+
+    SECTION("Missing parent group")
+    {
+        ig::details::ClusterLodHierarchy broken{hierarchy};
+        broken.Levels[0].Meshlets[0].ParentLodError += 1.f;
+        CHECK_FALSE(ClusterLodBuilder::ValidateErrorMonotonicity(broken));
+    }
+}
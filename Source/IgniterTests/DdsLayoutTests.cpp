@@ -0,0 +1,222 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/DdsLayout.h"
+
+namespace
+{
+    using ig::details::DdsLayoutParser;
+    using ig::details::EDdsParseStatus;
+
+    constexpr ig::U32 kFourCCDxt1 = '1' << 24 | 'T' << 16 | 'X' << 8 | 'D';
+    constexpr ig::U32 kFourCCDx10 = '0' << 24 | '1' << 16 | 'X' << 8 | 'D';
+
+    struct DdsHeaderDesc
+    {
+    public:
+        ig::U32 Width = 1;
+        ig::U32 Height = 1;
+        ig::U32 Depth = 0;
+        ig::U32 MipLevels = 1;
+        /* 0 인 경우 RGBA8 마스크를 가진 레거시 픽셀 포맷 */
+        ig::U32 FourCC = 0;
+        ig::U32 Caps2 = 0;
+        /* FourCC 가 DX10 인 경우 */
+        DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+        ig::U32 ResourceDimension = 3;
+        ig::U32 MiscFlag = 0;
+        ig::U32 ArraySize = 1;
+    };
+
+    void WriteU32(ig::Vector<ig::U8>& bytes, const ig::Size offset, const ig::U32 value)
+    {
+        for (ig::Size byteIdx = 0; byteIdx < sizeof(ig::U32); ++byteIdx)
+        {
+            bytes[offset + byteIdx] = (ig::U8)(value >> (byteIdx * 8));
+        }
+    }
+
+    /* https://learn.microsoft.com/en-us/windows/win32/direct3ddds/dds-header */
+    ig::Vector<ig::U8> MakeDdsHeader(const DdsHeaderDesc& desc)
+    {
+        const bool bHasDx10Header = desc.FourCC == kFourCCDx10;
+        ig::Vector<ig::U8> header(bHasDx10Header ? DdsLayoutParser::kMaxHeaderSize : 128, 0);
+        WriteU32(header, 0, 0x20534444);
+        WriteU32(header, 4, 124);
+        WriteU32(header, 12, desc.Height);
+        WriteU32(header, 16, desc.Width);
+        WriteU32(header, 24, desc.Depth);
+        WriteU32(header, 28, desc.MipLevels);
+        WriteU32(header, 76, 32);
+        if (desc.FourCC != 0)
+        {
+            WriteU32(header, 80, 0x4);
+            WriteU32(header, 84, desc.FourCC);
+        }
+        else
+        {
+            WriteU32(header, 80, 0x41);
+            WriteU32(header, 88, 32);
+            WriteU32(header, 92, 0x000000FF);
+            WriteU32(header, 96, 0x0000FF00);
+            WriteU32(header, 100, 0x00FF0000);
+            WriteU32(header, 104, 0xFF000000);
+        }
+        WriteU32(header, 112, desc.Caps2);
+
+        if (bHasDx10Header)
+        {
+            WriteU32(header, 128, (ig::U32)desc.Format);
+            WriteU32(header, 132, desc.ResourceDimension);
+            WriteU32(header, 136, desc.MiscFlag);
+            WriteU32(header, 140, desc.ArraySize);
+        }
+        return header;
+    }
+
+    /* DirectXTex 의 ComputePitch 로 계산한 전체 페이로드 크기 */
+    ig::Size ComputeExpectedPayloadSize(const DXGI_FORMAT format, const ig::U32 width, const ig::U32 height, const ig::U32 depth,
+        const ig::U32 mipLevels, const ig::U32 arraySize)
+    {
+        ig::Size payloadSize = 0;
+        for (ig::U32 mip = 0; mip < mipLevels; ++mip)
+        {
+            size_t rowPitch = 0;
+            size_t slicePitch = 0;
+            REQUIRE(SUCCEEDED(DirectX::ComputePitch(format, std::max(width >> mip, 1u), std::max(height >> mip, 1u), rowPitch, slicePitch)));
+            payloadSize += slicePitch * std::max(depth >> mip, 1u);
+        }
+        return payloadSize * arraySize;
+    }
+
+    void CheckSubresourcesArePacked(const ig::details::DdsLayout& layout)
+    {
+        ig::Size expectedOffset = layout.PayloadOffset;
+        for (const ig::details::DdsSubresourceLayout& subresource : layout.Subresources)
+        {
+            CHECK(subresource.Offset == expectedOffset);
+            CHECK(subresource.SlicePitch == subresource.RowPitch * subresource.NumRows);
+            expectedOffset += subresource.SlicePitch * subresource.Depth;
+        }
+    }
+
+    ig::Size GetPayloadSize(const ig::details::DdsLayout& layout)
+    {
+        const ig::details::DdsSubresourceLayout& lastSubresource = layout.Subresources.back();
+        return lastSubresource.Offset + lastSubresource.SlicePitch * lastSubresource.Depth - layout.PayloadOffset;
+    }
+} // namespace
+
+TEST_CASE("DdsLayoutParser computes the layout of a legacy BC1 mip chain", "[Asset][DdsLayout]")
+{
+    const ig::Vector<ig::U8> header{MakeDdsHeader(DdsHeaderDesc{.Width = 256, .Height = 100, .MipLevels = 9, .FourCC = kFourCCDxt1})};
+    const ig::Size payloadSize = ComputeExpectedPayloadSize(DXGI_FORMAT_BC1_UNORM, 256, 100, 1, 9, 1);
+
+    ig::Result<ig::details::DdsLayout, EDdsParseStatus> result{DdsLayoutParser::Parse(header, header.size() + payloadSize)};
+    REQUIRE(result.IsSuccess());
+    const ig::details::DdsLayout layout{result.Take()};
+    CHECK(layout.Format == DXGI_FORMAT_BC1_UNORM);
+    CHECK(layout.Dimension == ig::ETextureDimension::Tex2D);
+    CHECK(layout.MipLevels == 9);
+    CHECK(layout.PayloadOffset == 128);
+    REQUIRE(layout.Subresources.size() == 9);
+
+    /* Mip 0: 64x25 블록, 마지막 Mip: 1x1 블록 */
+    CHECK(layout.Subresources[0].RowPitch == 64 * 8);
+    CHECK(layout.Subresources[0].NumRows == 25);
+    CHECK(layout.Subresources[8].RowPitch == 8);
+    CHECK(layout.Subresources[8].NumRows == 1);
+    CheckSubresourcesArePacked(layout);
+    CHECK(GetPayloadSize(layout) == payloadSize);
+}
+
+TEST_CASE("DdsLayoutParser computes the layout of DX10 arrays, cubemaps and volumes", "[Asset][DdsLayout]")
+{
+    SECTION("BC7 texture array")
+    {
+        const ig::Vector<ig::U8> header{MakeDdsHeader(DdsHeaderDesc{
+            .Width = 60, .Height = 30, .MipLevels = 6, .FourCC = kFourCCDx10, .Format = DXGI_FORMAT_BC7_UNORM_SRGB, .ArraySize = 3})};
+        const ig::Size payloadSize = ComputeExpectedPayloadSize(DXGI_FORMAT_BC7_UNORM_SRGB, 60, 30, 1, 6, 3);
+
+        ig::Result<ig::details::DdsLayout, EDdsParseStatus> result{DdsLayoutParser::Parse(header, header.size() + payloadSize)};
+        REQUIRE(result.IsSuccess());
+        const ig::details::DdsLayout layout{result.Take()};
+        CHECK(layout.ArraySize == 3);
+        CHECK(layout.PayloadOffset == DdsLayoutParser::kMaxHeaderSize);
+        REQUIRE(layout.Subresources.size() == 3 * 6);
+        /* 서브리소스 인덱스 = ArraySlice * MipLevels + Mip */
+        CHECK(layout.Subresources[6].RowPitch == layout.Subresources[0].RowPitch);
+        CHECK(layout.Subresources[6].Offset == layout.PayloadOffset + payloadSize / 3);
+        CheckSubresourcesArePacked(layout);
+        CHECK(GetPayloadSize(layout) == payloadSize);
+    }
+
+    SECTION("Cubemap")
+    {
+        constexpr ig::U32 kDx10MiscTextureCube = 0x4;
+        const ig::Vector<ig::U8> header{MakeDdsHeader(DdsHeaderDesc{
+            .Width = 64, .Height = 64, .MipLevels = 7, .FourCC = kFourCCDx10, .Format = DXGI_FORMAT_R16G16B16A16_FLOAT, .MiscFlag = kDx10MiscTextureCube})};
+        const ig::Size payloadSize = ComputeExpectedPayloadSize(DXGI_FORMAT_R16G16B16A16_FLOAT, 64, 64, 1, 7, 6);
+
+        ig::Result<ig::details::DdsLayout, EDdsParseStatus> result{DdsLayoutParser::Parse(header, header.size() + payloadSize)};
+        REQUIRE(result.IsSuccess());
+        const ig::details::DdsLayout layout{result.Take()};
+        CHECK(layout.bIsCubemap);
+        CHECK(layout.ArraySize == 6);
+        REQUIRE(layout.Subresources.size() == 6 * 7);
+        CHECK(layout.Subresources[0].RowPitch == 64 * 8);
+        CheckSubresourcesArePacked(layout);
+        CHECK(GetPayloadSize(layout) == payloadSize);
+    }
+
+    SECTION("Legacy volume")
+    {
+        constexpr ig::U32 kCaps2Volume = 0x200000;
+        const ig::Vector<ig::U8> header{MakeDdsHeader(DdsHeaderDesc{.Width = 16, .Height = 8, .Depth = 4, .MipLevels = 5, .Caps2 = kCaps2Volume})};
+        const ig::Size payloadSize = ComputeExpectedPayloadSize(DXGI_FORMAT_R8G8B8A8_UNORM, 16, 8, 4, 5, 1);
+
+        ig::Result<ig::details::DdsLayout, EDdsParseStatus> result{DdsLayoutParser::Parse(header, header.size() + payloadSize)};
+        REQUIRE(result.IsSuccess());
+        const ig::details::DdsLayout layout{result.Take()};
+        CHECK(layout.Format == DXGI_FORMAT_R8G8B8A8_UNORM);
+        CHECK(layout.Dimension == ig::ETextureDimension::Tex3D);
+        REQUIRE(layout.Subresources.size() == 5);
+        CHECK(layout.Subresources[0].Depth == 4);
+        CHECK(layout.Subresources[2].Depth == 1);
+        CHECK(layout.Subresources[4].RowPitch == 4);
+        CheckSubresourcesArePacked(layout);
+        CHECK(GetPayloadSize(layout) == payloadSize);
+    }
+}
+
+TEST_CASE("DdsLayoutParser rejects malformed files", "[Asset][DdsLayout]")
+{
+    const DdsHeaderDesc validDesc{.Width = 32, .Height = 32, .MipLevels = 6, .FourCC = kFourCCDxt1};
+    const ig::Size payloadSize = ComputeExpectedPayloadSize(DXGI_FORMAT_BC1_UNORM, 32, 32, 1, 6, 1);
+    const auto parse = [](const ig::Vector<ig::U8>& header, const ig::Size fileSize)
+    {
+        return DdsLayoutParser::Parse(header, fileSize).GetStatus();
+    };
+
+    ig::Vector<ig::U8> header{MakeDdsHeader(validDesc)};
+    ig::Result<ig::details::DdsLayout, EDdsParseStatus> validResult{DdsLayoutParser::Parse(header, header.size() + payloadSize)};
+    REQUIRE(validResult.IsSuccess());
+    CHECK(validResult.Take().Subresources.size() == 6);
+    CHECK(parse(header, header.size() + payloadSize - 1) == EDdsParseStatus::TruncatedPayload);
+    CHECK(DdsLayoutParser::Parse(std::span{header.data(), 64}, header.size() + payloadSize).GetStatus() == EDdsParseStatus::NotEnoughData);
+
+    ig::Vector<ig::U8> invalidMagic{header};
+    invalidMagic[0] = 'X';
+    CHECK(parse(invalidMagic, invalidMagic.size() + payloadSize) == EDdsParseStatus::InvalidMagic);
+
+    DdsHeaderDesc tooManyMips{validDesc};
+    tooManyMips.MipLevels = 7;
+    CHECK(parse(MakeDdsHeader(tooManyMips), header.size() + payloadSize * 2) == EDdsParseStatus::InvalidHeader);
+
+    DdsHeaderDesc unknownFourCC{validDesc};
+    unknownFourCC.FourCC = 'X' << 24 | 'X' << 16 | 'X' << 8 | 'X';
+    CHECK(parse(MakeDdsHeader(unknownFourCC), header.size() + payloadSize) == EDdsParseStatus::UnsupportedFormat);
+
+    /* 일부 면만 존재하는 레거시 큐브맵 */
+    DdsHeaderDesc partialCubemap{validDesc};
+    partialCubemap.Caps2 = 0x200 | 0x400;
+    CHECK(parse(MakeDdsHeader(partialCubemap), header.size() + payloadSize * 6) == EDdsParseStatus::UnsupportedDimension);
+}
@@ -0,0 +1,121 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Filesystem/FileWatcher.h"
+
+namespace
+{
+    using Coalescer = ig::details::FileChangeCoalescer;
+    using namespace std::chrono_literals;
+
+    constexpr Coalescer::Clock::duration kWindow = 100ms;
+    const Coalescer::Clock::time_point kStartTime{};
+} // namespace
+
+TEST_CASE("FileChangeCoalescer cancels a file added and removed within the window", "[Filesystem][FileChangeCoalescer]")
+{
+    Coalescer coalescer{kWindow};
+    coalescer.Push("Assets\\Temp.tmp", ig::EFileWatchAction::Added, kStartTime);
+    coalescer.Push("Assets\\Temp.tmp", ig::EFileWatchAction::Modified, kStartTime + 1ms);
+    coalescer.Push("Assets\\Temp.tmp", ig::EFileWatchAction::Removed, kStartTime + 2ms);
+
+    CHECK(coalescer.GetNumPendingChanges() == 0);
+    CHECK(coalescer.Flush(kStartTime + kWindow * 2, true).empty());
+}
+
+TEST_CASE("FileChangeCoalescer turns a remove followed by an add into a modification", "[Filesystem][FileChangeCoalescer]")
+{
+    Coalescer coalescer{kWindow};
+    SECTION("Remove and add")
+    {
+        coalescer.Push("Assets\\Mesh.bin", ig::EFileWatchAction::Removed, kStartTime);
+        coalescer.Push("Assets\\Mesh.bin", ig::EFileWatchAction::Added, kStartTime + 1ms);
+    }
+
+    SECTION("Replace through rename")
+    {
+        coalescer.Push("Assets\\Mesh.bin", ig::EFileWatchAction::RenamedOldName, kStartTime);
+        coalescer.Push("Assets\\Mesh.bin", ig::EFileWatchAction::RenamedNewName, kStartTime + 1ms);
+    }
+
+    const ig::Vector<ig::FileChange> batch{coalescer.Flush(kStartTime + 1ms + kWindow)};
+    REQUIRE(batch.size() == 1);
+    CHECK(batch[0].Action == ig::EFileWatchAction::Modified);
+    CHECK(batch[0].Path == ig::Path{"Assets\\Mesh.bin"});
+    CHECK(batch[0].NumRawEvents == 2);
+}
+
+TEST_CASE("FileChangeCoalescer collapses repeated writes", "[Filesystem][FileChangeCoalescer]")
+{
+    constexpr ig::U32 kNumWrites = 16;
+    Coalescer coalescer{kWindow};
+    for (ig::U32 writeIdx = 0; writeIdx < kNumWrites; ++writeIdx)
+    {
+        coalescer.Push("Assets\\Texture.dds", ig::EFileWatchAction::Modified, kStartTime + writeIdx * 1ms);
+    }
+    coalescer.Push("Assets\\Material.json", ig::EFileWatchAction::Modified, kStartTime);
+
+    const ig::Vector<ig::FileChange> batch{coalescer.Flush(kStartTime + kNumWrites * 1ms + kWindow)};
+    REQUIRE(batch.size() == 2);
+    /* 배치는 경로 순으로 정렬 된다. */
+    CHECK(batch[0].Path == ig::Path{"Assets\\Material.json"});
+    CHECK(batch[0].NumRawEvents == 1);
+    CHECK(batch[1].Path == ig::Path{"Assets\\Texture.dds"});
+    CHECK(batch[1].Action == ig::EFileWatchAction::Modified);
+    CHECK(batch[1].NumRawEvents == kNumWrites);
+}
+
+TEST_CASE("FileChangeCoalescer flushes a change only after its window expires", "[Filesystem][FileChangeCoalescer]")
+{
+    Coalescer coalescer{kWindow};
+    coalescer.Push("Assets\\Audio.wav", ig::EFileWatchAction::Added, kStartTime);
+    coalescer.Push("Assets\\Audio.wav", ig::EFileWatchAction::Modified, kStartTime + 50ms);
+
+    /* 마지막 이벤트 부터 Window 가 지나기 전 까지는 내보내지 않는다. */
+    CHECK(coalescer.Flush(kStartTime + kWindow).empty());
+    CHECK(coalescer.GetNumPendingChanges() == 1);
+
+    const ig::Vector<ig::FileChange> batch{coalescer.Flush(kStartTime + 50ms + kWindow)};
+    REQUIRE(batch.size() == 1);
+    CHECK(batch[0].Action == ig::EFileWatchAction::Added);
+    CHECK(batch[0].NumRawEvents == 2);
+    CHECK(coalescer.GetNumPendingChanges() == 0);
+
+    /* 강제로 비우는 경우 Window 와 관계 없이 모두 내보낸다. */
+    coalescer.Push("Assets\\Audio.wav", ig::EFileWatchAction::Removed, kStartTime + 200ms);
+    CHECK(coalescer.Flush(kStartTime + 200ms).empty());
+    const ig::Vector<ig::FileChange> forcedBatch{coalescer.Flush(kStartTime + 200ms, true)};
+    REQUIRE(forcedBatch.size() == 1);
+    CHECK(forcedBatch[0].Action == ig::EFileWatchAction::Removed);
+}
+
+TEST_CASE("FileChangeCoalescer never merges changes of different paths", "[Filesystem][FileChangeCoalescer]")
+{
+    /* 경로 별 변경은 경로 자체로 구분 되어야 하며, 해시가 같더라도 서로 다른 파일의 이벤트가 병합 되어서는 안된다. */
+    constexpr ig::Size kNumFiles = 4096;
+    Coalescer coalescer{kWindow};
+    for (ig::Size fileIdx = 0; fileIdx < kNumFiles; ++fileIdx)
+    {
+        coalescer.Push(std::format("Assets\\Textures\\Texture_{}.dds", fileIdx), ig::EFileWatchAction::Added, kStartTime);
+    }
+    coalescer.Push("Assets\\Textures\\Texture_0.dds", ig::EFileWatchAction::Modified, kStartTime + 1ms);
+    CHECK(coalescer.GetNumPendingChanges() == kNumFiles);
+
+    /* 다른 파일의 삭제가 추가된 파일을 상쇄 해서는 안된다. */
+    coalescer.Push("Assets\\Textures\\Texture.dds", ig::EFileWatchAction::Removed, kStartTime + 1ms);
+    CHECK(coalescer.GetNumPendingChanges() == kNumFiles + 1);
+
+    const ig::Vector<ig::FileChange> batch{coalescer.Flush(kStartTime + 1ms + kWindow)};
+    REQUIRE(batch.size() == kNumFiles + 1);
+    for (const ig::FileChange& change : batch)
+    {
+        INFO("Path: " << change.Path.string());
+        if (change.Path == ig::Path{"Assets\\Textures\\Texture.dds"})
+        {
+            CHECK(change.Action == ig::EFileWatchAction::Removed);
+            CHECK(change.NumRawEvents == 1);
+            continue;
+        }
+
+        CHECK(change.Action == ig::EFileWatchAction::Added);
+        CHECK(change.NumRawEvents == (change.Path == ig::Path{"Assets\\Textures\\Texture_0.dds"} ? 2 : 1));
+    }
+}
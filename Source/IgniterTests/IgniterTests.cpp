@@ -0,0 +1 @@
+#include "IgniterTests/IgniterTests.h"
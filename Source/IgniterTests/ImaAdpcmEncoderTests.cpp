@@ -0,0 +1,242 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/ImaAdpcmEncoder.h"
+
+namespace
+{
+    using Encoder = ig::details::ImaAdpcmEncoder;
+
+    constexpr std::array<ig::S32, 89> kStepTable{7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80,
+        88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166,
+        1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+        11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+    constexpr std::array<ig::S32, 8> kIndexTable{-1, -1, -1, -1, 2, 4, 6, 8};
+
+    struct WaveFormat
+    {
+    public:
+        ig::U16 FormatTag = 0;
+        ig::U16 NumChannels = 0;
+        ig::U32 SampleRate = 0;
+        ig::U16 BlockAlign = 0;
+        ig::U16 BitsPerSample = 0;
+        ig::U16 SamplesPerBlock = 0;
+        ig::U32 NumFrames = 0;
+        std::span<const ig::U8> Data;
+    };
+
+    template <typename T>
+    T Read(const std::span<const ig::U8> bytes, const ig::Size offset)
+    {
+        REQUIRE(offset + sizeof(T) <= bytes.size());
+        T value{};
+        std::memcpy(&value, bytes.data() + offset, sizeof(T));
+        return value;
+    }
+
+    bool IsFourCC(const std::span<const ig::U8> bytes, const ig::Size offset, const char (&fourCC)[5])
+    {
+        return offset + 4 <= bytes.size() && std::memcmp(bytes.data() + offset, fourCC, 4) == 0;
+    }
+
+    WaveFormat ParseWave(const std::span<const ig::U8> wave)
+    {
+        REQUIRE(IsFourCC(wave, 0, "RIFF"));
+        REQUIRE(Read<ig::U32>(wave, 4) + 8 == wave.size());
+        REQUIRE(IsFourCC(wave, 8, "WAVE"));
+
+        WaveFormat format{};
+        ig::Size chunkOffset = 12;
+        while (chunkOffset + 8 <= wave.size())
+        {
+            const ig::U32 chunkSize = Read<ig::U32>(wave, chunkOffset + 4);
+            const ig::Size chunkDataOffset = chunkOffset + 8;
+            REQUIRE(chunkDataOffset + chunkSize <= wave.size());
+            if (IsFourCC(wave, chunkOffset, "fmt "))
+            {
+                format.FormatTag = Read<ig::U16>(wave, chunkDataOffset);
+                format.NumChannels = Read<ig::U16>(wave, chunkDataOffset + 2);
+                format.SampleRate = Read<ig::U32>(wave, chunkDataOffset + 4);
+                format.BlockAlign = Read<ig::U16>(wave, chunkDataOffset + 12);
+                format.BitsPerSample = Read<ig::U16>(wave, chunkDataOffset + 14);
+                format.SamplesPerBlock = Read<ig::U16>(wave, chunkDataOffset + 18);
+            }
+            else if (IsFourCC(wave, chunkOffset, "fact"))
+            {
+                format.NumFrames = Read<ig::U32>(wave, chunkDataOffset);
+            }
+            else if (IsFourCC(wave, chunkOffset, "data"))
+            {
+                format.Data = wave.subspan(chunkDataOffset, chunkSize);
+            }
+            chunkOffset = chunkDataOffset + chunkSize;
+        }
+
+        return format;
+    }
+
+    ig::S32 DecodeNibble(ig::S32& predictor, ig::S32& stepIndex, const ig::U8 nibble)
+    {
+        const ig::S32 step = kStepTable[stepIndex];
+        ig::S32 delta = step >> 3;
+        delta += (nibble & 4) != 0 ? step : 0;
+        delta += (nibble & 2) != 0 ? (step >> 1) : 0;
+        delta += (nibble & 1) != 0 ? (step >> 2) : 0;
+        predictor = std::clamp<ig::S32>((nibble & 8) != 0 ? predictor - delta : predictor + delta, -32768, 32767);
+        stepIndex = std::clamp<ig::S32>(stepIndex + kIndexTable[nibble & 7], 0, static_cast<ig::S32>(kStepTable.size()) - 1);
+        return predictor;
+    }
+
+    /* WAVE_FORMAT_IMA_ADPCM 디코더(MS IMA ADPCM 명세). 마지막 블록의 Padding 은 버린다. */
+    ig::Vector<ig::S16> Decode(const WaveFormat& format)
+    {
+        const ig::U16 numChannels = format.NumChannels;
+        ig::Vector<ig::S16> decodedSamples(static_cast<ig::Size>(format.NumFrames) * numChannels);
+        const auto storeSample = [&decodedSamples, &format, numChannels](const ig::Size frameIdx, const ig::U16 channelIdx, const ig::S32 sample)
+        {
+            if (frameIdx < format.NumFrames)
+            {
+                decodedSamples[frameIdx * numChannels + channelIdx] = static_cast<ig::S16>(sample);
+            }
+        };
+
+        const ig::Size numBlocks = format.Data.size() / format.BlockAlign;
+        ig::Vector<ig::S32> predictors(numChannels);
+        ig::Vector<ig::S32> stepIndices(numChannels);
+        for (ig::Size blockIdx = 0; blockIdx < numBlocks; ++blockIdx)
+        {
+            const std::span<const ig::U8> block{format.Data.subspan(blockIdx * format.BlockAlign, format.BlockAlign)};
+            const ig::Size firstFrameIdx = blockIdx * format.SamplesPerBlock;
+            for (ig::U16 channelIdx = 0; channelIdx < numChannels; ++channelIdx)
+            {
+                predictors[channelIdx] = Read<ig::S16>(block, channelIdx * 4);
+                stepIndices[channelIdx] = block[channelIdx * 4 + 2];
+                REQUIRE(stepIndices[channelIdx] < static_cast<ig::S32>(kStepTable.size()));
+                storeSample(firstFrameIdx, channelIdx, predictors[channelIdx]);
+            }
+
+            ig::Size byteOffset = 4 * numChannels;
+            for (ig::U32 groupBegin = 1; groupBegin < format.SamplesPerBlock; groupBegin += 8)
+            {
+                for (ig::U16 channelIdx = 0; channelIdx < numChannels; ++channelIdx)
+                {
+                    for (ig::U32 sampleIdx = 0; sampleIdx < 8; sampleIdx += 2)
+                    {
+                        const ig::U8 encodedByte = block[byteOffset++];
+                        storeSample(firstFrameIdx + groupBegin + sampleIdx, channelIdx,
+                            DecodeNibble(predictors[channelIdx], stepIndices[channelIdx], encodedByte & 0xF));
+                        storeSample(firstFrameIdx + groupBegin + sampleIdx + 1, channelIdx,
+                            DecodeNibble(predictors[channelIdx], stepIndices[channelIdx], encodedByte >> 4));
+                    }
+                }
+            }
+            REQUIRE(byteOffset == block.size());
+        }
+
+        return decodedSamples;
+    }
+
+    /* 채널 마다 다른 기본 주파수 + 고주파 성분 + 노이즈. 블록 경계와 맞지 않는 길이로 마지막 블록의 Padding 을 포함 시킨다. */
+    ig::Vector<ig::S16> MakeSignal(const ig::U32 sampleRate, const ig::U16 numChannels, const ig::Size numFrames)
+    {
+        std::mt19937 generator{sampleRate + numChannels};
+        std::normal_distribution<ig::F32> noiseDistribution{0.f, 200.f};
+        constexpr ig::F32 kTwoPi = 2.f * std::numbers::pi_v<ig::F32>;
+        ig::Vector<ig::S16> samples(numFrames * numChannels);
+        for (ig::Size frameIdx = 0; frameIdx < numFrames; ++frameIdx)
+        {
+            const ig::F32 time = static_cast<ig::F32>(frameIdx) / sampleRate;
+            for (ig::U16 channelIdx = 0; channelIdx < numChannels; ++channelIdx)
+            {
+                const ig::F32 sample = 12000.f * std::sin(kTwoPi * 220.f * (channelIdx + 1) * time) + 6000.f * std::sin(kTwoPi * 1500.f * time) +
+                    noiseDistribution(generator);
+                samples[frameIdx * numChannels + channelIdx] = static_cast<ig::S16>(std::clamp(sample, -32768.f, 32767.f));
+            }
+        }
+        return samples;
+    }
+} // namespace
+
+TEST_CASE("IMA ADPCM round-trips PCM within the error bound", "[Asset][ImaAdpcmEncoder]")
+{
+    /* 신호 시작 시 StepIndex 가 0 에서 적응 하는 동안의 샘플은 최대 오차 검사에서 제외 한다. */
+    constexpr ig::Size kNumAdaptationFrames = 32;
+    constexpr ig::S32 kMaxAbsError = 2048;
+    constexpr ig::F64 kMinSignalToNoiseRatio = 28.0;
+
+    for (const ig::U16 numChannels : {1, 2})
+    {
+        for (const ig::U32 sampleRate : {22050u, 44100u, 48000u})
+        {
+            INFO("Channels: " << numChannels << ", Sample Rate: " << sampleRate);
+            const ig::Size numFrames = sampleRate / 2 + 123;
+            const ig::Vector<ig::S16> samples{MakeSignal(sampleRate, numChannels, numFrames)};
+            const ig::Vector<ig::U8> wave{Encoder::EncodeWave(samples, sampleRate, numChannels)};
+            const WaveFormat format{ParseWave(wave)};
+
+            CHECK(format.FormatTag == Encoder::kWaveFormatTag);
+            CHECK(format.NumChannels == numChannels);
+            CHECK(format.SampleRate == sampleRate);
+            CHECK(format.BitsPerSample == Encoder::kBitsPerSample);
+            CHECK(format.NumFrames == numFrames);
+            REQUIRE(format.BlockAlign == Encoder::ComputeBlockAlign(sampleRate, numChannels));
+            REQUIRE(format.SamplesPerBlock == Encoder::ComputeSamplesPerBlock(format.BlockAlign, numChannels));
+            REQUIRE(format.Data.size() % format.BlockAlign == 0);
+            CHECK(format.Data.size() / format.BlockAlign == (numFrames + format.SamplesPerBlock - 1) / format.SamplesPerBlock);
+            /* 블록 헤더를 포함 하여도 4:1 에 가까운 압축률 */
+            CHECK(static_cast<ig::F64>(samples.size() * sizeof(ig::S16)) / format.Data.size() > 3.9);
+
+            const ig::Vector<ig::S16> decodedSamples{Decode(format)};
+            REQUIRE(decodedSamples.size() == samples.size());
+
+            ig::S32 maxAbsError = 0;
+            ig::F64 signalEnergy = 0.0;
+            ig::F64 errorEnergy = 0.0;
+            for (ig::Size sampleIdx = 0; sampleIdx < samples.size(); ++sampleIdx)
+            {
+                const ig::S32 error = static_cast<ig::S32>(decodedSamples[sampleIdx]) - samples[sampleIdx];
+                if (sampleIdx / numChannels >= kNumAdaptationFrames)
+                {
+                    maxAbsError = std::max(maxAbsError, std::abs(error));
+                }
+                signalEnergy += static_cast<ig::F64>(samples[sampleIdx]) * samples[sampleIdx];
+                errorEnergy += static_cast<ig::F64>(error) * error;
+            }
+
+            /* 블록의 첫 샘플은 헤더에 그대로 저장 되므로 손실이 없다. */
+            for (ig::Size frameIdx = 0; frameIdx < numFrames; frameIdx += format.SamplesPerBlock)
+            {
+                for (ig::U16 channelIdx = 0; channelIdx < numChannels; ++channelIdx)
+                {
+                    CHECK(decodedSamples[frameIdx * numChannels + channelIdx] == samples[frameIdx * numChannels + channelIdx]);
+                }
+            }
+
+            CHECK(maxAbsError <= kMaxAbsError);
+            REQUIRE(errorEnergy > 0.0);
+            CHECK(10.0 * std::log10(signalEnergy / errorEnergy) >= kMinSignalToNoiseRatio);
+        }
+    }
+}
+
+TEST_CASE("IMA ADPCM encodes silence and empty input losslessly", "[Asset][ImaAdpcmEncoder]")
+{
+    constexpr ig::U32 kSampleRate = 44100;
+    constexpr ig::U16 kNumChannels = 2;
+
+    SECTION("Silence")
+    {
+        const ig::Vector<ig::S16> samples(4096 * kNumChannels, 0);
+        const ig::Vector<ig::U8> wave{Encoder::EncodeWave(samples, kSampleRate, kNumChannels)};
+        const WaveFormat format{ParseWave(wave)};
+        CHECK(Decode(format) == samples);
+    }
+
+    SECTION("Empty")
+    {
+        const ig::Vector<ig::U8> wave{Encoder::EncodeWave({}, kSampleRate, kNumChannels)};
+        const WaveFormat format{ParseWave(wave)};
+        CHECK(format.NumFrames == 0);
+        CHECK(format.Data.empty());
+    }
+}
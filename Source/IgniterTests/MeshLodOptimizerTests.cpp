@@ -0,0 +1,116 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/StaticMeshImporter.h"
+
+namespace
+{
+    using PositionKey = std::tuple<ig::F32, ig::F32, ig::F32>;
+    using TriangleKey = std::array<PositionKey, ig::Mesh::kNumVertexPerTriangle>;
+
+    struct TestMesh
+    {
+    public:
+        ig::Vector<ig::Vertex> Vertices;
+        ig::Vector<ig::U32> Indices;
+    };
+
+    /* 삼각형 순서를 섞어 캐시 효율이 나쁜 (gridSize x gridSize) 평면. 마지막 정점은 참조 되지 않는다. */
+    TestMesh BuildShuffledGrid(const ig::U32 gridSize)
+    {
+        TestMesh mesh{};
+        for (ig::U32 y = 0; y <= gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x <= gridSize; ++x)
+            {
+                ig::Vertex vertex{};
+                vertex.Position = ig::Vector3{(ig::F32)x, (ig::F32)y, 0.f};
+                mesh.Vertices.emplace_back(vertex);
+            }
+        }
+        ig::Vertex unusedVertex{};
+        unusedVertex.Position = ig::Vector3{-1.f, -1.f, -1.f};
+        mesh.Vertices.emplace_back(unusedVertex);
+
+        ig::Vector<std::array<ig::U32, ig::Mesh::kNumVertexPerTriangle>> triangles{};
+        for (ig::U32 y = 0; y < gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x < gridSize; ++x)
+            {
+                const ig::U32 v0 = y * (gridSize + 1) + x;
+                const ig::U32 v1 = v0 + 1;
+                const ig::U32 v2 = v0 + gridSize + 1;
+                const ig::U32 v3 = v2 + 1;
+                triangles.push_back({v0, v2, v1});
+                triangles.push_back({v1, v2, v3});
+            }
+        }
+
+        std::mt19937 generator{0xC0FFEE};
+        std::shuffle(triangles.begin(), triangles.end(), generator);
+        for (const auto& triangle : triangles)
+        {
+            mesh.Indices.insert(mesh.Indices.end(), triangle.begin(), triangle.end());
+        }
+        return mesh;
+    }
+
+    /* 감긴 순서를 유지하며 가장 작은 정점이 앞에 오도록 회전 한 삼각형 들의 정렬 된 목록 */
+    ig::Vector<TriangleKey> MakeTriangleKeys(const std::span<const ig::Vertex> vertices, const std::span<const ig::U32> indices)
+    {
+        ig::Vector<TriangleKey> triangleKeys{};
+        for (ig::Size triangleIdx = 0; triangleIdx < indices.size() / ig::Mesh::kNumVertexPerTriangle; ++triangleIdx)
+        {
+            TriangleKey triangleKey{};
+            for (ig::Size cornerIdx = 0; cornerIdx < ig::Mesh::kNumVertexPerTriangle; ++cornerIdx)
+            {
+                const ig::Vector3& position = vertices[indices[triangleIdx * ig::Mesh::kNumVertexPerTriangle + cornerIdx]].Position;
+                triangleKey[cornerIdx] = PositionKey{position.x, position.y, position.z};
+            }
+            std::rotate(triangleKey.begin(), std::min_element(triangleKey.begin(), triangleKey.end()), triangleKey.end());
+            triangleKeys.emplace_back(triangleKey);
+        }
+
+        std::sort(triangleKeys.begin(), triangleKeys.end());
+        return triangleKeys;
+    }
+} // namespace
+
+TEST_CASE("MeshLodOptimizer improves vertex cache and fetch locality", "[Asset][MeshLodOptimizer]")
+{
+    using ig::details::MeshLodOptimizer;
+    const TestMesh mesh{BuildShuffledGrid(48)};
+
+    /* LOD1 은 LOD0 삼각형의 절반 */
+    ig::Vector<ig::Vertex> vertices{mesh.Vertices};
+    ig::Vector<ig::U32> lodIndices[2]{mesh.Indices, ig::Vector<ig::U32>(mesh.Indices.begin(), mesh.Indices.begin() + mesh.Indices.size() / 2)};
+    const ig::Vector<TriangleKey> lod0Triangles{MakeTriangleKeys(mesh.Vertices, lodIndices[0])};
+    const ig::Vector<TriangleKey> lod1Triangles{MakeTriangleKeys(mesh.Vertices, lodIndices[1])};
+    const ig::details::MeshLodStatistics unoptimizedStats{MeshLodOptimizer::Analyze(vertices, lodIndices[0])};
+
+    MeshLodOptimizer::Optimize(vertices, lodIndices);
+    const ig::details::MeshLodStatistics optimizedStats{MeshLodOptimizer::Analyze(vertices, lodIndices[0])};
+
+    CHECK(optimizedStats.Acmr < unoptimizedStats.Acmr);
+    CHECK(optimizedStats.Atvr < unoptimizedStats.Atvr);
+    CHECK(optimizedStats.Overfetch <= unoptimizedStats.Overfetch);
+
+    /* 참조 되지 않는 정점은 제거 되고, 삼각형은 유지 된다. */
+    CHECK(vertices.size() == mesh.Vertices.size() - 1);
+    CHECK(MakeTriangleKeys(vertices, lodIndices[0]) == lod0Triangles);
+    CHECK(MakeTriangleKeys(vertices, lodIndices[1]) == lod1Triangles);
+
+    /* 정점은 LOD0 에서 처음 참조 되는 순서대로 배치 된다. */
+    ig::U32 numReferencedVertices = 0;
+    for (const ig::U32 index : lodIndices[0])
+    {
+        CHECK(index <= numReferencedVertices);
+        numReferencedVertices = std::max(numReferencedVertices, index + 1);
+    }
+    CHECK(numReferencedVertices == vertices.size());
+}
+
+TEST_CASE("MeshLodOptimizer analyzes empty meshes", "[Asset][MeshLodOptimizer]")
+{
+    const ig::details::MeshLodStatistics stats{ig::details::MeshLodOptimizer::Analyze({}, {})};
+    CHECK(stats.Acmr == 0.f);
+    CHECK(stats.Overfetch == 0.f);
+}
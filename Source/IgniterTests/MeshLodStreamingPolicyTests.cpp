@@ -0,0 +1,277 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/StaticMeshStreamer.h"
+
+namespace
+{
+    using Policy = ig::details::MeshLodStreamingPolicy;
+
+    constexpr ig::F32 kRadius = 10.f;
+    constexpr ig::F32 kNearZ = 0.1f;
+    constexpr ig::U8 kNumLevelOfDetails = 5;
+    constexpr ig::Array<ig::F32, kNumLevelOfDetails> kLodErrors{0.f, 0.02f, 0.05f, 0.1f, 0.4f};
+
+    /* 기준 해상도 에서 수직 시야각 60도 */
+    const ig::F32 kProjScaleY = 1.f / std::tan(std::numbers::pi_v<ig::F32> / 6.f);
+    const ig::F32 kProjScaleX = kProjScaleY * (Policy::kReferenceViewportHeight / Policy::kReferenceViewportWidth);
+
+    ig::F32 ProjectErrorToPixels(const ig::F32 lodError, const ig::F32 viewDepth)
+    {
+        return lodError * kProjScaleY * (Policy::kReferenceViewportHeight * 0.5f) / viewDepth;
+    }
+} // namespace
+
+TEST_CASE("LOD thresholds derived from errors decrease toward coarser LODs", "[Asset][MeshLodStreamingPolicy]")
+{
+    const ig::Array<ig::F32, ig::Mesh::kMaxMeshLevelOfDetails> thresholds{
+        Policy::ComputeLodScreenCoverageThresholds(kLodErrors, kNumLevelOfDetails, kRadius)};
+
+    for (ig::U8 lod = 0; lod + 1 < kNumLevelOfDetails; ++lod)
+    {
+        INFO("LOD: " << (int)lod);
+        CHECK(thresholds[lod] == Policy::ComputeLodErrorScreenCoverage(kLodErrors[lod + 1], kRadius));
+        CHECK(thresholds[lod] > 0.f);
+        if (lod > 0)
+        {
+            CHECK(thresholds[lod] < thresholds[lod - 1]);
+        }
+    }
+    /* 마지막 LOD 는 항상 선택 될 수 있어야 한다. */
+    CHECK(thresholds[kNumLevelOfDetails - 1] == 0.f);
+    CHECK(Policy::ComputeLodErrorScreenCoverage(0.f, kRadius) == 1.f);
+}
+
+TEST_CASE("LOD selection keeps the projected error under the pixel threshold", "[Asset][MeshLodStreamingPolicy]")
+{
+    const ig::Array<ig::F32, ig::Mesh::kMaxMeshLevelOfDetails> thresholds{
+        Policy::ComputeLodScreenCoverageThresholds(kLodErrors, kNumLevelOfDetails, kRadius)};
+    /* 임계값 경계 에서의 부동 소수점 오차 */
+    constexpr ig::F32 kTolerance = 1e-3f;
+
+    ig::U8 prevLod = 0;
+    for (ig::F32 viewDepth = kRadius; viewDepth < 20000.f; viewDepth *= 1.05f)
+    {
+        INFO("View Depth: " << viewDepth);
+        const ig::F32 screenCoverage = Policy::ComputeScreenCoverage(ig::Vector3{0.f, 0.f, viewDepth}, kRadius, kProjScaleX, kProjScaleY, kNearZ);
+        const ig::U8 lod = Policy::MapScreenCoverageToLod(screenCoverage, kNumLevelOfDetails, true, thresholds);
+        REQUIRE(lod < kNumLevelOfDetails);
+
+        /* 선택 된 LOD 의 오차는 1 픽셀 미만, 한 단계 거친 LOD 의 오차는 1 픽셀 이상 이다. */
+        CHECK(ProjectErrorToPixels(kLodErrors[lod], viewDepth) <= Policy::kLodErrorThresholdPixels + kTolerance);
+        if (lod + 1 < kNumLevelOfDetails)
+        {
+            CHECK(ProjectErrorToPixels(kLodErrors[lod + 1], viewDepth) >= Policy::kLodErrorThresholdPixels - kTolerance);
+        }
+
+        /* 멀어질 수록 더 거친 LOD 가 선택 된다. */
+        CHECK(lod >= prevLod);
+        prevLod = lod;
+    }
+    CHECK(prevLod == kNumLevelOfDetails - 1);
+}
+
+namespace
+{
+    /* 가장 거친 LOD 는 항상 상주하므로 예산에 포함 되지 않는다. */
+    constexpr ig::Array<ig::Size, ig::Mesh::kMaxMeshLevelOfDetails> kLodSizes{1600, 800, 400, 200, 100};
+    constexpr ig::U8 kNotRequired = kNumLevelOfDetails;
+
+    ig::details::MeshLodResidency MakeResidency(const ig::U8 minResidentLod, const ig::U8 requiredLod, const ig::U64 lastRequiredUpdate)
+    {
+        ig::details::MeshLodResidency residency{};
+        residency.NumLevelOfDetails = kNumLevelOfDetails;
+        residency.MinResidentLevelOfDetail = minResidentLod;
+        residency.RequiredLevelOfDetail = requiredLod;
+        residency.LevelOfDetailSizes = kLodSizes;
+        residency.LastRequiredUpdates.fill(lastRequiredUpdate);
+        return residency;
+    }
+
+    ig::U8 ComputeRequiredLod(const ig::F32 viewDepth)
+    {
+        const ig::Array<ig::F32, ig::Mesh::kMaxMeshLevelOfDetails> thresholds{
+            Policy::ComputeLodScreenCoverageThresholds(kLodErrors, kNumLevelOfDetails, kRadius)};
+        const ig::F32 screenCoverage = Policy::ComputeScreenCoverage(ig::Vector3{0.f, 0.f, viewDepth}, kRadius, kProjScaleX, kProjScaleY, kNearZ);
+        return Policy::MapScreenCoverageToLod(screenCoverage, kNumLevelOfDetails, true, thresholds);
+    }
+
+    ig::Size ComputeTotalStreamedSize(const std::span<const ig::details::MeshLodResidency> residencies)
+    {
+        ig::Size streamedSize = 0;
+        for (const ig::details::MeshLodResidency& residency : residencies)
+        {
+            streamedSize += Policy::ComputeStreamedSize(residency);
+        }
+        return streamedSize;
+    }
+
+    /* StaticMeshStreamer::Update 와 같이 갱신 번호를 기록하고 결정을 적용 한다. 로드는 즉시 완료 된다고 가정 한다. */
+    ig::details::MeshLodStreamingDecision Step(ig::Vector<ig::details::MeshLodResidency>& residencies, const std::span<const ig::U8> requiredLods,
+        const ig::U64 update, const ig::Size budgetInBytes, const ig::Size maxNumLoads)
+    {
+        for (ig::Index residencyIdx = 0; residencyIdx < residencies.size(); ++residencyIdx)
+        {
+            ig::details::MeshLodResidency& residency = residencies[residencyIdx];
+            residency.RequiredLevelOfDetail = requiredLods[residencyIdx];
+            for (ig::U8 lod = residency.RequiredLevelOfDetail; lod < residency.NumLevelOfDetails; ++lod)
+            {
+                residency.LastRequiredUpdates[lod] = update;
+            }
+        }
+
+        const ig::details::MeshLodStreamingDecision decision{Policy::Decide(residencies, budgetInBytes, maxNumLoads)};
+        for (const ig::details::MeshLodStreamingRequest& eviction : decision.Evictions)
+        {
+            ig::details::MeshLodResidency& residency = residencies[eviction.ResidencyIdx];
+            REQUIRE(eviction.LevelOfDetail == residency.MinResidentLevelOfDetail);
+            REQUIRE(eviction.LevelOfDetail < residency.RequiredLevelOfDetail);
+            ++residency.MinResidentLevelOfDetail;
+        }
+
+        for (const ig::details::MeshLodStreamingRequest& load : decision.Loads)
+        {
+            ig::details::MeshLodResidency& residency = residencies[load.ResidencyIdx];
+            REQUIRE(load.LevelOfDetail + 1 == residency.MinResidentLevelOfDetail);
+            --residency.MinResidentLevelOfDetail;
+        }
+
+        return decision;
+    }
+
+    /* LOD 0 ~ 4 가 각각 요구 되는 거리 */
+    constexpr ig::Array<ig::F32, kNumLevelOfDetails> kViewDepths{12.f, 30.f, 70.f, 200.f, 1000.f};
+} // namespace
+
+TEST_CASE("LOD streaming promotes required LODs one level at a time", "[Asset][MeshLodStreamingPolicy]")
+{
+    ig::Vector<ig::U8> requiredLods{};
+    ig::Vector<ig::details::MeshLodResidency> residencies{};
+    for (ig::U8 expectedLod = 0; expectedLod < kNumLevelOfDetails; ++expectedLod)
+    {
+        requiredLods.emplace_back(ComputeRequiredLod(kViewDepths[expectedLod]));
+        REQUIRE(requiredLods.back() == expectedLod);
+        residencies.emplace_back(MakeResidency(kNumLevelOfDetails - 1, kNotRequired, 0));
+    }
+
+    SECTION("Under the budget")
+    {
+        const ig::details::MeshLodStreamingDecision decision{Step(residencies, requiredLods, 1, std::numeric_limits<ig::Size>::max(), 16)};
+        CHECK(decision.Evictions.empty());
+        /* 요구 된 LOD 와의 차이가 큰 메시 부터, 상주 LOD 보다 한 단계 세밀한 LOD 를 요청 한다. */
+        REQUIRE(decision.Loads.size() == 4);
+        for (ig::Index loadIdx = 0; loadIdx < decision.Loads.size(); ++loadIdx)
+        {
+            CHECK(decision.Loads[loadIdx].ResidencyIdx == loadIdx);
+            CHECK(decision.Loads[loadIdx].LevelOfDetail == kNumLevelOfDetails - 2);
+        }
+
+        for (ig::U64 update = 2; update < 8; ++update)
+        {
+            (void)Step(residencies, requiredLods, update, std::numeric_limits<ig::Size>::max(), 16);
+        }
+
+        ig::Size expectedStreamedSize = 0;
+        for (ig::Index residencyIdx = 0; residencyIdx < residencies.size(); ++residencyIdx)
+        {
+            CHECK(residencies[residencyIdx].MinResidentLevelOfDetail == requiredLods[residencyIdx]);
+            for (ig::U8 lod = requiredLods[residencyIdx]; lod + 1 < kNumLevelOfDetails; ++lod)
+            {
+                expectedStreamedSize += kLodSizes[lod];
+            }
+        }
+        CHECK(ComputeTotalStreamedSize(residencies) == expectedStreamedSize);
+    }
+
+    SECTION("Limited number of loads")
+    {
+        const ig::details::MeshLodStreamingDecision decision{Step(residencies, requiredLods, 1, std::numeric_limits<ig::Size>::max(), 2)};
+        REQUIRE(decision.Loads.size() == 2);
+        CHECK(decision.Loads[0].ResidencyIdx == 0);
+        CHECK(decision.Loads[1].ResidencyIdx == 1);
+    }
+
+    SECTION("Limited budget")
+    {
+        /* LOD 3 네 개(800) 이후 LOD 2(400) 는 들어갈 수 없고, 요구 된 LOD 이하의 LOD 는 해제 대상이 아니다. */
+        constexpr ig::Size kBudget = 1000;
+        for (ig::U64 update = 1; update < 8; ++update)
+        {
+            (void)Step(residencies, requiredLods, update, kBudget, 16);
+            CHECK(ComputeTotalStreamedSize(residencies) <= kBudget);
+        }
+
+        for (ig::Index residencyIdx = 0; residencyIdx + 1 < residencies.size(); ++residencyIdx)
+        {
+            CHECK(residencies[residencyIdx].MinResidentLevelOfDetail == kNumLevelOfDetails - 2);
+        }
+        CHECK(residencies.back().MinResidentLevelOfDetail == kNumLevelOfDetails - 1);
+    }
+}
+
+TEST_CASE("LOD streaming evicts the least recently required LODs first", "[Asset][MeshLodStreamingPolicy]")
+{
+    /* A, B 는 LOD 1 까지 상주 하지만 더 이상 요구 되지 않으며, A 가 더 오래 전에 요구 되었다. C 는 LOD 3 을 요구 한다. */
+    ig::Vector<ig::details::MeshLodResidency> residencies{
+        MakeResidency(1, kNotRequired, 1),
+        MakeResidency(1, kNotRequired, 2),
+        MakeResidency(kNumLevelOfDetails - 1, ComputeRequiredLod(kViewDepths[3]), 3)};
+    REQUIRE(residencies[2].RequiredLevelOfDetail == 3);
+    REQUIRE(ComputeTotalStreamedSize(residencies) == 2800);
+
+    SECTION("Evicts only as much as the load needs")
+    {
+        const ig::details::MeshLodStreamingDecision decision{Policy::Decide(residencies, 2800, 16)};
+        REQUIRE(decision.Evictions.size() == 1);
+        CHECK(decision.Evictions[0].ResidencyIdx == 0);
+        CHECK(decision.Evictions[0].LevelOfDetail == 1);
+        REQUIRE(decision.Loads.size() == 1);
+        CHECK(decision.Loads[0].ResidencyIdx == 2);
+        CHECK(decision.Loads[0].LevelOfDetail == 3);
+    }
+
+    SECTION("Evicts finer LODs of the older mesh before the newer mesh")
+    {
+        const ig::details::MeshLodStreamingDecision decision{Policy::Decide(residencies, 1000, 16)};
+        const ig::Vector<std::pair<ig::Index, ig::U8>> expectedEvictions{{0, 1}, {0, 2}, {0, 3}, {1, 1}};
+        REQUIRE(decision.Evictions.size() == expectedEvictions.size());
+        for (ig::Index evictionIdx = 0; evictionIdx < expectedEvictions.size(); ++evictionIdx)
+        {
+            INFO("Eviction: " << evictionIdx);
+            CHECK(decision.Evictions[evictionIdx].ResidencyIdx == expectedEvictions[evictionIdx].first);
+            CHECK(decision.Evictions[evictionIdx].LevelOfDetail == expectedEvictions[evictionIdx].second);
+        }
+        REQUIRE(decision.Loads.size() == 1);
+        CHECK(decision.Loads[0].ResidencyIdx == 2);
+    }
+
+    SECTION("Pending meshes are neither evicted nor loaded")
+    {
+        residencies[0].bUploadPending = true;
+        residencies[2].bLoadPending = true;
+        const ig::details::MeshLodStreamingDecision decision{Policy::Decide(residencies, 1000, 16)};
+        CHECK(decision.Loads.empty());
+        /* 진행 중인 로드 역시 예산에 포함 되므로 B 의 모든 스트리밍 LOD 가 해제 된다. */
+        REQUIRE(decision.Evictions.size() == 3);
+        for (ig::U8 lod = 1; lod < kNumLevelOfDetails - 1; ++lod)
+        {
+            CHECK(decision.Evictions[lod - 1].ResidencyIdx == 1);
+            CHECK(decision.Evictions[lod - 1].LevelOfDetail == lod);
+        }
+    }
+}
+
+TEST_CASE("LOD streaming never evicts required LODs when the budget shrinks", "[Asset][MeshLodStreamingPolicy]")
+{
+    /* LOD 0 까지 상주 하지만 LOD 2 만 요구 된다. LOD 0, 1 만 해제 될 수 있다. */
+    ig::Vector<ig::details::MeshLodResidency> residencies{MakeResidency(0, ComputeRequiredLod(kViewDepths[2]), 1)};
+    REQUIRE(residencies[0].RequiredLevelOfDetail == 2);
+
+    const ig::details::MeshLodStreamingDecision decision{Policy::Decide(residencies, 0, 16)};
+    CHECK(decision.Loads.empty());
+    REQUIRE(decision.Evictions.size() == 2);
+    CHECK(decision.Evictions[0].LevelOfDetail == 0);
+    CHECK(decision.Evictions[1].LevelOfDetail == 1);
+
+    residencies[0].MinResidentLevelOfDetail = 2;
+    CHECK(Policy::ComputeStreamedSize(residencies[0]) == kLodSizes[2] + kLodSizes[3]);
+    CHECK(Policy::Decide(residencies, 0, 16).Evictions.empty());
+}
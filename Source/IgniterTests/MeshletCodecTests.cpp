@@ -0,0 +1,260 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/MeshletCodec.h"
+
+namespace
+{
+    struct TestMeshlets
+    {
+    public:
+        ig::Vector<ig::U32> VertexIndices;
+        ig::Vector<ig::U32> Triangles;
+        ig::Vector<ig::Meshlet> Meshlets;
+    };
+
+    /* (gridSize x gridSize) 개의 Quad 로 이루어진 평면 */
+    void BuildGrid(const ig::U32 gridSize, ig::Vector<ig::Vector3>& positions, ig::Vector<ig::U32>& indices)
+    {
+        for (ig::U32 y = 0; y <= gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x <= gridSize; ++x)
+            {
+                positions.emplace_back((ig::F32)x, (ig::F32)y, 0.f);
+            }
+        }
+
+        for (ig::U32 y = 0; y < gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x < gridSize; ++x)
+            {
+                const ig::U32 v0 = y * (gridSize + 1) + x;
+                const ig::U32 v1 = v0 + 1;
+                const ig::U32 v2 = v0 + gridSize + 1;
+                const ig::U32 v3 = v2 + 1;
+                indices.insert(indices.end(), {v0, v2, v1, v1, v2, v3});
+            }
+        }
+    }
+
+    /* 위도/경도 방향으로 분할 된 구. 평면과 달리 닫힌 곡면이므로 Meshlet 의 정점 재사용 패턴이 다르다. */
+    void BuildSphere(const ig::U32 numSegments, ig::Vector<ig::Vector3>& positions, ig::Vector<ig::U32>& indices)
+    {
+        const ig::U32 numRings = numSegments / 2;
+        for (ig::U32 ring = 0; ring <= numRings; ++ring)
+        {
+            const ig::F32 phi = std::numbers::pi_v<ig::F32> * (ig::F32)ring / numRings;
+            for (ig::U32 segment = 0; segment <= numSegments; ++segment)
+            {
+                const ig::F32 theta = 2.f * std::numbers::pi_v<ig::F32> * (ig::F32)segment / numSegments;
+                positions.emplace_back(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+            }
+        }
+
+        for (ig::U32 ring = 0; ring < numRings; ++ring)
+        {
+            for (ig::U32 segment = 0; segment < numSegments; ++segment)
+            {
+                const ig::U32 v0 = ring * (numSegments + 1) + segment;
+                const ig::U32 v1 = v0 + 1;
+                const ig::U32 v2 = v0 + numSegments + 1;
+                const ig::U32 v3 = v2 + 1;
+                indices.insert(indices.end(), {v0, v2, v1, v1, v2, v3});
+            }
+        }
+    }
+
+    TestMeshlets BuildMeshlets(const ig::Vector<ig::Vector3>& positions, const ig::Vector<ig::U32>& indices)
+    {
+        const ig::Size maxNumMeshlets = meshopt_buildMeshletsBound(indices.size(), ig::Meshlet::kMaxVertices, ig::Meshlet::kMaxTriangles);
+        std::vector<meshopt_Meshlet> rawMeshlets(maxNumMeshlets);
+        std::vector<unsigned int> rawVertexIndices(maxNumMeshlets * ig::Meshlet::kMaxVertices);
+        std::vector<unsigned char> rawTriangles(maxNumMeshlets * ig::Meshlet::kMaxTriangles * ig::Mesh::kNumVertexPerTriangle);
+        rawMeshlets.resize(meshopt_buildMeshlets(rawMeshlets.data(), rawVertexIndices.data(), rawTriangles.data(), indices.data(), indices.size(),
+            &positions[0].x, positions.size(), sizeof(ig::Vector3), ig::Meshlet::kMaxVertices, ig::Meshlet::kMaxTriangles, 0.f));
+
+        TestMeshlets result{};
+        for (const meshopt_Meshlet& rawMeshlet : rawMeshlets)
+        {
+            ig::Meshlet& meshlet = result.Meshlets.emplace_back();
+            meshlet.IndexOffset = (ig::U32)result.VertexIndices.size();
+            meshlet.NumIndices = rawMeshlet.vertex_count;
+            meshlet.TriangleOffset = (ig::U32)result.Triangles.size();
+            meshlet.NumTriangles = rawMeshlet.triangle_count;
+            meshlet.BoundingVolume = ig::BoundingSphere{.Centroid = ig::Vector3{(ig::F32)meshlet.IndexOffset, 1.f, 2.f}, .Radius = 3.f};
+            meshlet.QuantizedNormalConeAxis[0] = 1;
+            meshlet.QuantizedNormalConeAxis[1] = 2;
+            meshlet.QuantizedNormalConeAxis[2] = 127;
+            meshlet.QuantizedNormalConeCutoff = 64;
+            meshlet.ParentLodError = FLT_MAX;
+
+            result.VertexIndices.insert(result.VertexIndices.end(), rawVertexIndices.begin() + rawMeshlet.vertex_offset,
+                rawVertexIndices.begin() + rawMeshlet.vertex_offset + rawMeshlet.vertex_count);
+            for (ig::U32 triangleIdx = 0; triangleIdx < rawMeshlet.triangle_count; ++triangleIdx)
+            {
+                const unsigned char* localIndices = &rawTriangles[rawMeshlet.triangle_offset + triangleIdx * ig::Mesh::kNumVertexPerTriangle];
+                result.Triangles.emplace_back(ig::EncodeTriangleU32(localIndices[0], localIndices[1], localIndices[2]));
+            }
+        }
+
+        return result;
+    }
+
+    TestMeshlets BuildGridMeshlets(const ig::U32 gridSize)
+    {
+        ig::Vector<ig::Vector3> positions{};
+        ig::Vector<ig::U32> indices{};
+        BuildGrid(gridSize, positions, indices);
+        return BuildMeshlets(positions, indices);
+    }
+
+    TestMeshlets BuildSphereMeshlets(const ig::U32 numSegments)
+    {
+        ig::Vector<ig::Vector3> positions{};
+        ig::Vector<ig::U32> indices{};
+        BuildSphere(numSegments, positions, indices);
+        /* 임포터와 같이 정점 캐시 최적화 이후 Meshlet 을 생성 한다. */
+        meshopt_optimizeVertexCache(indices.data(), indices.data(), indices.size(), positions.size());
+        return BuildMeshlets(positions, indices);
+    }
+
+    bool IsSameMeshlet(const ig::Meshlet& lhs, const ig::Meshlet& rhs)
+    {
+        return lhs.IndexOffset == rhs.IndexOffset && lhs.NumIndices == rhs.NumIndices &&
+            lhs.TriangleOffset == rhs.TriangleOffset && lhs.NumTriangles == rhs.NumTriangles &&
+            std::memcmp(&lhs.BoundingVolume, &rhs.BoundingVolume, sizeof(ig::BoundingSphere)) == 0 &&
+            std::memcmp(lhs.QuantizedNormalConeAxis, rhs.QuantizedNormalConeAxis, sizeof(lhs.QuantizedNormalConeAxis)) == 0 &&
+            lhs.QuantizedNormalConeCutoff == rhs.QuantizedNormalConeCutoff &&
+            std::memcmp(&lhs.LodBounds, &rhs.LodBounds, sizeof(ig::BoundingSphere)) == 0 && lhs.LodError == rhs.LodError &&
+            std::memcmp(&lhs.ParentLodBounds, &rhs.ParentLodBounds, sizeof(ig::BoundingSphere)) == 0 && lhs.ParentLodError == rhs.ParentLodError;
+    }
+} // namespace
+
+TEST_CASE("MeshletCodec round-trips meshlet streams", "[Asset][MeshletCodec]")
+{
+    using ig::details::MeshletCodec;
+    const TestMeshlets testMeshlets{BuildGridMeshlets(32)};
+    REQUIRE(testMeshlets.Meshlets.size() > 1);
+
+    const ig::Vector<ig::U8> encodedVertexIndices{MeshletCodec::EncodeVertexIndices(testMeshlets.VertexIndices)};
+    ig::Vector<ig::U32> decodedVertexIndices(testMeshlets.VertexIndices.size());
+    REQUIRE(MeshletCodec::DecodeVertexIndices(encodedVertexIndices, decodedVertexIndices));
+    CHECK(decodedVertexIndices == testMeshlets.VertexIndices);
+    CHECK(encodedVertexIndices.size() < testMeshlets.VertexIndices.size() * sizeof(ig::U32));
+
+    const ig::Vector<ig::U8> encodedTriangles{MeshletCodec::EncodeTriangles(testMeshlets.Triangles)};
+    ig::Vector<ig::U32> decodedTriangles(testMeshlets.Triangles.size());
+    REQUIRE(MeshletCodec::DecodeTriangles(encodedTriangles, decodedTriangles));
+    /* meshopt 인덱스 코덱은 삼각형 내 정점을 회전 시킬 수 있으므로, 감긴 순서를 유지한 회전 까지 같은 것으로 본다. */
+    for (ig::Size triangleIdx = 0; triangleIdx < decodedTriangles.size(); ++triangleIdx)
+    {
+        const ig::U32 expected = testMeshlets.Triangles[triangleIdx];
+        const ig::U32 decoded = decodedTriangles[triangleIdx];
+        const ig::U32 rotatedOnce = ((decoded >> 8) & 0xFFFF) | ((decoded & 0xFF) << 16);
+        const ig::U32 rotatedTwice = ((rotatedOnce >> 8) & 0xFFFF) | ((rotatedOnce & 0xFF) << 16);
+        CHECK((decoded == expected || rotatedOnce == expected || rotatedTwice == expected));
+    }
+
+    const ig::Vector<ig::U8> encodedMeshlets{MeshletCodec::EncodeMeshlets(testMeshlets.Meshlets)};
+    ig::Vector<ig::Meshlet> decodedMeshlets(testMeshlets.Meshlets.size());
+    REQUIRE(MeshletCodec::DecodeMeshlets(encodedMeshlets, decodedMeshlets));
+    for (ig::Size meshletIdx = 0; meshletIdx < decodedMeshlets.size(); ++meshletIdx)
+    {
+        CHECK(IsSameMeshlet(decodedMeshlets[meshletIdx], testMeshlets.Meshlets[meshletIdx]));
+    }
+}
+
+TEST_CASE("MeshletCodec rejects truncated streams", "[Asset][MeshletCodec]")
+{
+    using ig::details::MeshletCodec;
+    const TestMeshlets testMeshlets{BuildGridMeshlets(16)};
+
+    const ig::Vector<ig::U8> encodedMeshlets{MeshletCodec::EncodeMeshlets(testMeshlets.Meshlets)};
+    ig::Vector<ig::Meshlet> decodedMeshlets(testMeshlets.Meshlets.size());
+    CHECK_FALSE(MeshletCodec::DecodeMeshlets(std::span{encodedMeshlets.data(), encodedMeshlets.size() - 1}, decodedMeshlets));
+
+    const ig::Vector<ig::U8> encodedVertexIndices{MeshletCodec::EncodeVertexIndices(testMeshlets.VertexIndices)};
+    ig::Vector<ig::U32> decodedVertexIndices(testMeshlets.VertexIndices.size());
+    CHECK_FALSE(MeshletCodec::DecodeVertexIndices(std::span{encodedVertexIndices.data(), encodedVertexIndices.size() / 2}, decodedVertexIndices));
+}
+
+TEST_CASE("MeshletCodec round-trips non-contiguous offsets", "[Asset][MeshletCodec]")
+{
+    using ig::details::MeshletCodec;
+    /* 예측값과의 차이가 32 비트 ZigZag 로 표현 될 수 없는 경우를 포함 한다. */
+    const std::pair<ig::U32, ig::U32> kOffsets[]{
+        {0xFFFFFF00u, 0x80000000u},
+        {0u, 0u},
+        {0x80000000u, 0xFFFFFFF0u},
+        {5u, 1u},
+        {0xFFFFFFFFu - 64u, 7u}};
+
+    ig::Vector<ig::Meshlet> meshlets{};
+    for (const auto [indexOffset, triangleOffset] : kOffsets)
+    {
+        ig::Meshlet& meshlet = meshlets.emplace_back();
+        meshlet.IndexOffset = indexOffset;
+        meshlet.NumIndices = 64;
+        meshlet.TriangleOffset = triangleOffset;
+        meshlet.NumTriangles = 124;
+    }
+
+    const ig::Vector<ig::U8> encodedMeshlets{MeshletCodec::EncodeMeshlets(meshlets)};
+    ig::Vector<ig::Meshlet> decodedMeshlets(meshlets.size());
+    REQUIRE(MeshletCodec::DecodeMeshlets(encodedMeshlets, decodedMeshlets));
+    for (ig::Size meshletIdx = 0; meshletIdx < decodedMeshlets.size(); ++meshletIdx)
+    {
+        INFO("Meshlet: " << meshletIdx);
+        CHECK(IsSameMeshlet(decodedMeshlets[meshletIdx], meshlets[meshletIdx]));
+    }
+
+    SECTION("Decoded offsets out of range are rejected")
+    {
+        /* 첫 Meshlet 의 IndexOffset 차이(ZigZag(0xFFFFFF00) = 0x1FFFFFE00)를 ZigZag(-1) 로 바꾼다. */
+        const ig::Vector<ig::U8> encodedMeshlet{MeshletCodec::EncodeMeshlets(std::span{meshlets.data(), 1})};
+        ig::Vector<ig::U8> corruptedMeshlet{};
+        corruptedMeshlet.push_back(1);
+        const auto firstVarintEnd = std::find_if(encodedMeshlet.begin(), encodedMeshlet.end(), [](const ig::U8 byte) { return (byte & 0x80) == 0; });
+        REQUIRE(firstVarintEnd != encodedMeshlet.end());
+        corruptedMeshlet.insert(corruptedMeshlet.end(), firstVarintEnd + 1, encodedMeshlet.end());
+
+        ig::Meshlet decodedMeshlet{};
+        REQUIRE(MeshletCodec::DecodeMeshlets(encodedMeshlet, std::span{&decodedMeshlet, 1}));
+        CHECK_FALSE(MeshletCodec::DecodeMeshlets(corruptedMeshlet, std::span{&decodedMeshlet, 1}));
+    }
+}
+
+TEST_CASE("MeshletCodec encoded size and decode throughput", "[Asset][MeshletCodec][!benchmark]")
+{
+    using ig::details::MeshletCodec;
+    const std::pair<std::string_view, TestMeshlets> kSampleMeshes[]{
+        {"Grid 256x256", BuildGridMeshlets(256)},
+        {"Sphere 512x256", BuildSphereMeshlets(512)}};
+
+    for (const auto& [name, testMeshlets] : kSampleMeshes)
+    {
+        const ig::Vector<ig::U8> encodedVertexIndices{MeshletCodec::EncodeVertexIndices(testMeshlets.VertexIndices)};
+        const ig::Vector<ig::U8> encodedTriangles{MeshletCodec::EncodeTriangles(testMeshlets.Triangles)};
+        const ig::Vector<ig::U8> encodedMeshlets{MeshletCodec::EncodeMeshlets(testMeshlets.Meshlets)};
+        const ig::Size rawSize = sizeof(ig::U32) * (testMeshlets.VertexIndices.size() + testMeshlets.Triangles.size()) +
+            sizeof(ig::Meshlet) * testMeshlets.Meshlets.size();
+        const ig::Size encodedSize = encodedVertexIndices.size() + encodedTriangles.size() + encodedMeshlets.size();
+
+        ig::Vector<ig::U32> decodedVertexIndices(testMeshlets.VertexIndices.size());
+        ig::Vector<ig::U32> decodedTriangles(testMeshlets.Triangles.size());
+        ig::Vector<ig::Meshlet> decodedMeshlets(testMeshlets.Meshlets.size());
+        BENCHMARK(std::format("Decode {} {} Meshlets ({} -> {} bytes, {:.2f}:1, Indices {:.2f}, Triangles {:.2f}, Meshlets {:.2f} bytes/elem)", name,
+            testMeshlets.Meshlets.size(), rawSize, encodedSize, (ig::F32)rawSize / encodedSize,
+            (ig::F32)encodedVertexIndices.size() / testMeshlets.VertexIndices.size(), (ig::F32)encodedTriangles.size() / testMeshlets.Triangles.size(),
+            (ig::F32)encodedMeshlets.size() / testMeshlets.Meshlets.size()))
+        {
+            const bool bDecoded = MeshletCodec::DecodeVertexIndices(encodedVertexIndices, decodedVertexIndices) &&
+                MeshletCodec::DecodeTriangles(encodedTriangles, decodedTriangles) && MeshletCodec::DecodeMeshlets(encodedMeshlets, decodedMeshlets);
+            return bDecoded;
+        };
+
+        BENCHMARK(std::format("Encode {} {} Meshlets", name, testMeshlets.Meshlets.size()))
+        {
+            return MeshletCodec::EncodeVertexIndices(testMeshlets.VertexIndices).size() + MeshletCodec::EncodeTriangles(testMeshlets.Triangles).size() +
+                MeshletCodec::EncodeMeshlets(testMeshlets.Meshlets).size();
+        };
+    }
+}
@@ -0,0 +1,344 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/SkeletalMeshImporter.h"
+#include "Igniter/Asset/SkeletalMeshLoader.h"
+
+namespace
+{
+    constexpr const char* kBoneNames[]{"Hips", "Spine", "Chest", "Neck", "Head"};
+    constexpr ig::U32 kNumBones = (ig::U32)std::size(kBoneNames);
+    constexpr ig::U32 kGridColumns = 8;
+    constexpr ig::U32 kGridRows = 32;
+    /* 메시 노드의 변환; Bind Pose 는 메시 노드 공간을 기준으로 한다. */
+    const aiVector3D kMeshNodeTranslation{2.f, 0.f, 0.f};
+
+    aiMatrix4x4 MakeTranslation(const aiVector3D& translation)
+    {
+        aiMatrix4x4 matrix{};
+        return aiMatrix4x4::Translation(translation, matrix);
+    }
+
+    /* i 번째 정점에 적용 되는 (Bone, 가중치) */
+    using VertexInfluences = ig::Vector<std::pair<ig::U32, ig::F32>>;
+
+    /*
+     * Scene -> Armature -> Hips -> Spine -> Chest -> Neck -> Head (Bone 사이 간격은 Y 축 1)
+     *       -> Body (메시)
+     * 메시는 Y 축 [0, 4] 에 걸친 평면 이며, 각 정점은 인접한 두 Bone 의 영향을 받는다.
+     * 원점의 정점은 5개의 Bone, (1, 4) 의 정점은 어떤 Bone 의 영향도 받지 않는다.
+     */
+    ig::Ptr<aiScene> MakeSkinnedScene(const bool bWithMissingBoneNode = false)
+    {
+        ig::Vector<aiVector3D> positions{};
+        ig::Vector<VertexInfluences> influences{};
+        for (ig::U32 row = 0; row <= kGridRows; ++row)
+        {
+            for (ig::U32 column = 0; column <= kGridColumns; ++column)
+            {
+                const ig::F32 x = (ig::F32)column / kGridColumns;
+                const ig::F32 y = (ig::F32)row * (kNumBones - 1) / kGridRows;
+                positions.emplace_back(x, y, 0.5f * std::sin(x * 3.f));
+
+                VertexInfluences& vertexInfluences = influences.emplace_back();
+                const ig::U32 lowerBone = std::min((ig::U32)y, kNumBones - 2);
+                const ig::F32 t = y - (ig::F32)lowerBone;
+                vertexInfluences.emplace_back(lowerBone, 1.f - t);
+                vertexInfluences.emplace_back(lowerBone + 1, t);
+            }
+        }
+        influences.front() = VertexInfluences{{0, 0.4f}, {1, 0.25f}, {2, 0.15f}, {3, 0.12f}, {4, 0.08f}};
+        influences.back().clear();
+
+        aiMesh* mesh = new aiMesh{};
+        mesh->mName = aiString{"Body"};
+        mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mesh->mNumVertices = (unsigned int)positions.size();
+        mesh->mVertices = new aiVector3D[positions.size()];
+        std::copy(positions.begin(), positions.end(), mesh->mVertices);
+
+        mesh->mNumFaces = kGridRows * kGridColumns * 2;
+        mesh->mFaces = new aiFace[mesh->mNumFaces];
+        for (ig::U32 row = 0; row < kGridRows; ++row)
+        {
+            for (ig::U32 column = 0; column < kGridColumns; ++column)
+            {
+                const ig::U32 v0 = row * (kGridColumns + 1) + column;
+                const ig::U32 v1 = v0 + 1;
+                const ig::U32 v2 = v0 + kGridColumns + 1;
+                const ig::U32 v3 = v2 + 1;
+                const ig::U32 triangles[2][3]{{v0, v2, v1}, {v1, v2, v3}};
+                for (ig::U32 triangleIdx = 0; triangleIdx < 2; ++triangleIdx)
+                {
+                    aiFace& face = mesh->mFaces[(row * kGridColumns + column) * 2 + triangleIdx];
+                    face.mNumIndices = 3;
+                    face.mIndices = new unsigned int[3]{triangles[triangleIdx][0], triangles[triangleIdx][1], triangles[triangleIdx][2]};
+                }
+            }
+        }
+
+        mesh->mNumBones = kNumBones;
+        mesh->mBones = new aiBone*[kNumBones];
+        for (ig::U32 boneIdx = 0; boneIdx < kNumBones; ++boneIdx)
+        {
+            ig::Vector<aiVertexWeight> weights{};
+            for (ig::U32 vertexIdx = 0; vertexIdx < influences.size(); ++vertexIdx)
+            {
+                for (const auto& [influenceBone, weight] : influences[vertexIdx])
+                {
+                    if (influenceBone == boneIdx && weight > 0.f)
+                    {
+                        weights.emplace_back(vertexIdx, weight);
+                    }
+                }
+            }
+
+            aiBone* bone = new aiBone{};
+            bone->mName = aiString{bWithMissingBoneNode && boneIdx == kNumBones - 1 ? "MissingBone" : kBoneNames[boneIdx]};
+            /* 메시 공간 -> Bone 공간 */
+            bone->mOffsetMatrix = MakeTranslation(aiVector3D{0.f, -(ig::F32)boneIdx, 0.f} + kMeshNodeTranslation);
+            bone->mNumWeights = (unsigned int)weights.size();
+            bone->mWeights = new aiVertexWeight[weights.size()];
+            std::copy(weights.begin(), weights.end(), bone->mWeights);
+            mesh->mBones[boneIdx] = bone;
+        }
+
+        aiNode* boneNodes[kNumBones]{};
+        for (ig::U32 boneIdx = 0; boneIdx < kNumBones; ++boneIdx)
+        {
+            boneNodes[boneIdx] = new aiNode{kBoneNames[boneIdx]};
+            boneNodes[boneIdx]->mTransformation = MakeTranslation(aiVector3D{0.f, boneIdx == 0 ? 0.f : 1.f, 0.f});
+            if (boneIdx > 0)
+            {
+                boneNodes[boneIdx - 1]->addChildren(1, &boneNodes[boneIdx]);
+            }
+        }
+
+        aiNode* armatureNode = new aiNode{"Armature"};
+        armatureNode->addChildren(1, &boneNodes[0]);
+
+        aiNode* meshNode = new aiNode{"Body"};
+        meshNode->mTransformation = MakeTranslation(kMeshNodeTranslation);
+        meshNode->mNumMeshes = 1;
+        meshNode->mMeshes = new unsigned int[1]{0};
+
+        aiNode* rootNode = new aiNode{"Scene"};
+        aiNode* rootChildren[]{armatureNode, meshNode};
+        rootNode->addChildren(2, rootChildren);
+
+        ig::Ptr<aiScene> scene{ig::MakePtr<aiScene>()};
+        scene->mRootNode = rootNode;
+        scene->mNumMeshes = 1;
+        scene->mMeshes = new aiMesh*[1]{mesh};
+        return scene;
+    }
+
+    template <typename T>
+    bool IsBitwiseEqual(const std::span<const T> lhs, const std::span<const T> rhs)
+    {
+        return lhs.size() == rhs.size() && std::memcmp(lhs.data(), rhs.data(), lhs.size_bytes()) == 0;
+    }
+
+    ig::Vector<ig::U8> ConcatBlobs(const std::span<const std::span<const ig::U8>> blobs)
+    {
+        ig::Vector<ig::U8> blob{};
+        for (const std::span<const ig::U8> subBlob : blobs)
+        {
+            blob.insert(blob.end(), subBlob.begin(), subBlob.end());
+        }
+        return blob;
+    }
+
+    /* 정점이 영향을 받는 모든 Bone 에 대해, 해당 Bone 의 경계가 Bone 공간의 정점을 포함 해야 한다. */
+    bool IsContainedByBoneBounds(const ig::SkinnedVertex& vertex, const ig::Skeleton& skeleton, const std::span<const ig::MeshletBoneBounds> boneBounds)
+    {
+        constexpr ig::F32 kEpsilon = 1e-4f;
+        for (ig::U8 influenceIdx = 0; influenceIdx < ig::SkinnedVertex::kMaxInfluences; ++influenceIdx)
+        {
+            if (vertex.BoneWeights[influenceIdx] == 0)
+            {
+                continue;
+            }
+
+            const ig::U32 boneIdx = vertex.BoneIndices[influenceIdx];
+            const ig::Vector3 boneSpacePosition{ig::Vector3::Transform(vertex.Position, skeleton.InverseBindMatrices[boneIdx])};
+            const auto boneBoundsItr = std::find_if(boneBounds.begin(), boneBounds.end(),
+                [boneIdx](const ig::MeshletBoneBounds& bounds) { return bounds.BoneIdx == boneIdx; });
+            if (boneBoundsItr == boneBounds.end() ||
+                ig::Vector3::Distance(boneBoundsItr->BoneSpaceBounds.Centroid, boneSpacePosition) > boneBoundsItr->BoneSpaceBounds.Radius + kEpsilon)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+TEST_CASE("Bone weights are quantized to 8 bits summing to 255", "[Render][Vertex]")
+{
+    std::mt19937 generator{0xB0AE};
+    std::uniform_real_distribution<ig::F32> distribution{0.f, 1.f};
+    for (ig::Size sampleIdx = 0; sampleIdx < 4096; ++sampleIdx)
+    {
+        ig::F32 weights[ig::SkinnedVertex::kMaxInfluences]{};
+        ig::F32 weightSum = 0.f;
+        for (ig::F32& weight : weights)
+        {
+            weight = (sampleIdx & 1) != 0 ? distribution(generator) : std::pow(distribution(generator), 8.f);
+            weightSum += weight;
+        }
+
+        ig::U8 quantizedWeights[ig::SkinnedVertex::kMaxInfluences]{};
+        ig::QuantizeBoneWeights(weights, quantizedWeights);
+        CHECK(std::accumulate(std::begin(quantizedWeights), std::end(quantizedWeights), 0) == 255);
+        /* 최대 나머지 방식 이므로 각 가중치의 오차는 한 단계 미만 이다. */
+        for (ig::U8 influenceIdx = 0; influenceIdx < ig::SkinnedVertex::kMaxInfluences; ++influenceIdx)
+        {
+            CHECK(std::abs((ig::F32)quantizedWeights[influenceIdx] - weights[influenceIdx] / weightSum * 255.f) < 1.f);
+        }
+    }
+
+    /* 영향이 없는 정점은 첫 번째 영향을 따른다. */
+    const ig::F32 zeroWeights[ig::SkinnedVertex::kMaxInfluences]{};
+    ig::U8 quantizedWeights[ig::SkinnedVertex::kMaxInfluences]{};
+    ig::QuantizeBoneWeights(zeroWeights, quantizedWeights);
+    CHECK(quantizedWeights[0] == 255);
+    CHECK(quantizedWeights[1] == 0);
+    CHECK(quantizedWeights[2] == 0);
+    CHECK(quantizedWeights[3] == 0);
+}
+
+TEST_CASE("Skeletal mesh import round-trips through the load stages", "[Asset][SkeletalMesh]")
+{
+    const ig::Ptr<aiScene> scene{MakeSkinnedScene()};
+    ig::details::SkeletalMeshData meshData{};
+    REQUIRE(ig::details::SkeletalMeshImportStages::Build(*scene, 0, true, meshData) == ig::ESkeletalMeshImportStatus::Success);
+
+    /* Pre-Order 스켈레톤; Bone 이 아닌 조상 노드(Armature)도 포함 된다. */
+    const ig::Skeleton& skeleton = meshData.MeshSkeleton;
+    REQUIRE(skeleton.GetNumBones() == kNumBones + 1);
+    CHECK(skeleton.BoneNames[0] == "Armature");
+    CHECK(skeleton.ParentIndices[0] == ig::InvalidIndexU32);
+    for (ig::U32 boneIdx = 1; boneIdx < skeleton.GetNumBones(); ++boneIdx)
+    {
+        CHECK(skeleton.BoneNames[boneIdx] == kBoneNames[boneIdx - 1]);
+        CHECK(skeleton.ParentIndices[boneIdx] == boneIdx - 1);
+    }
+    /* (0, 3, 0) 은 Chest(메시 노드 공간에서 (-2, 2, 0)) 공간에서 (2, 1, 0) */
+    const ig::Vector3 chestSpacePosition{ig::Vector3::Transform(ig::Vector3{0.f, 3.f, 0.f}, skeleton.InverseBindMatrices[skeleton.FindBone("Chest")])};
+    CHECK(chestSpacePosition.x == Catch::Approx(2.f));
+    CHECK(chestSpacePosition.y == Catch::Approx(1.f));
+    CHECK(chestSpacePosition.z == Catch::Approx(0.f).margin(1e-6f));
+
+    const ig::SkeletalMeshLoadDesc loadDesc{ig::details::SkeletalMeshImportStages::MakeLoadDesc(meshData)};
+    REQUIRE(ig::details::SkeletalMeshLoadStages::ValidateSkeleton(loadDesc));
+    const ig::Vector<ig::U8> blob{ConcatBlobs(ig::details::SkeletalMeshImportStages::GetBlobs(meshData))};
+    REQUIRE(blob.size() == loadDesc.GetBlobSize());
+
+    ig::details::DecodedSkeletalMesh decoded{};
+    REQUIRE(ig::details::SkeletalMeshLoadStages::Decode(loadDesc, blob, decoded));
+
+    /* 업로드 페이로드: [SkinnedVertex][U32 Meshlet Vertex Indices][U32 Meshlet Triangles][Meshlet] */
+    const ig::U8* payload = decoded.UploadPayload.data();
+    const std::span<const ig::SkinnedVertex> vertices{reinterpret_cast<const ig::SkinnedVertex*>(payload), loadDesc.NumVertices};
+    payload += vertices.size_bytes();
+    const std::span<const ig::U32> meshletVertexIndices{reinterpret_cast<const ig::U32*>(payload), loadDesc.NumMeshletVertexIndices};
+    payload += meshletVertexIndices.size_bytes();
+    const std::span<const ig::U32> meshletTriangles{reinterpret_cast<const ig::U32*>(payload), loadDesc.NumMeshletTriangles};
+    payload += meshletTriangles.size_bytes();
+    const std::span<const ig::Meshlet> meshlets{reinterpret_cast<const ig::Meshlet*>(payload), loadDesc.NumMeshlets};
+    REQUIRE(payload + meshlets.size_bytes() == decoded.UploadPayload.data() + decoded.UploadPayload.size());
+
+    CHECK(IsBitwiseEqual<ig::SkinnedVertex>(vertices, meshData.Vertices));
+    CHECK(IsBitwiseEqual<ig::U32>(meshletVertexIndices, meshData.MeshletVertexIndices));
+    CHECK(IsBitwiseEqual<ig::U32>(meshletTriangles, meshData.MeshletTriangles));
+    CHECK(IsBitwiseEqual<ig::Meshlet>(meshlets, meshData.Meshlets));
+    CHECK(decoded.MeshSkeleton.BoneNames == skeleton.BoneNames);
+    CHECK(decoded.MeshSkeleton.ParentIndices == skeleton.ParentIndices);
+    CHECK(IsBitwiseEqual<ig::Matrix>(decoded.MeshSkeleton.InverseBindMatrices, skeleton.InverseBindMatrices));
+    CHECK(IsBitwiseEqual<ig::Matrix>(decoded.MeshSkeleton.BindLocalTransforms, skeleton.BindLocalTransforms));
+    CHECK(std::memcmp(&decoded.MeshSkeleton.RootTransform, &skeleton.RootTransform, sizeof(ig::Matrix)) == 0);
+    CHECK(IsBitwiseEqual<ig::MeshletBoneBoundsRange>(decoded.BoneBoundsRanges, meshData.BoneBoundsRanges));
+    CHECK(IsBitwiseEqual<ig::MeshletBoneBounds>(decoded.BoneBounds, meshData.BoneBounds));
+    CHECK(IsBitwiseEqual<ig::MeshletBoneBounds>(decoded.MeshBoneBounds, meshData.MeshBoneBounds));
+
+    ig::U32 numTriangles = 0;
+    for (ig::Index meshletIdx = 0; meshletIdx < meshlets.size(); ++meshletIdx)
+    {
+        const ig::Meshlet& meshlet = meshlets[meshletIdx];
+        CHECK(meshlet.NumIndices <= ig::Meshlet::kMaxVertices);
+        CHECK(meshlet.NumTriangles <= ig::Meshlet::kMaxTriangles);
+        numTriangles += meshlet.NumTriangles;
+
+        const ig::MeshletBoneBoundsRange& range = decoded.BoneBoundsRanges[meshletIdx];
+        const std::span<const ig::MeshletBoneBounds> meshletBoneBounds{decoded.BoneBounds.data() + range.Offset, range.NumBoneBounds};
+        for (ig::U32 indexIdx = 0; indexIdx < meshlet.NumIndices; ++indexIdx)
+        {
+            CHECK(IsContainedByBoneBounds(vertices[meshletVertexIndices[meshlet.IndexOffset + indexIdx]], decoded.MeshSkeleton, meshletBoneBounds));
+        }
+    }
+    CHECK(numTriangles == kGridRows * kGridColumns * 2);
+
+    /* 4 x 8 Bits 가중치 */
+    bool bFoundFiveInfluenceVertex = false;
+    bool bFoundUnweightedVertex = false;
+    for (const ig::SkinnedVertex& vertex : vertices)
+    {
+        CHECK(std::accumulate(std::begin(vertex.BoneWeights), std::end(vertex.BoneWeights), 0) == 255);
+        CHECK(IsContainedByBoneBounds(vertex, decoded.MeshSkeleton, decoded.MeshBoneBounds));
+        for (ig::U8 influenceIdx = 0; influenceIdx < ig::SkinnedVertex::kMaxInfluences; ++influenceIdx)
+        {
+            CHECK(vertex.BoneIndices[influenceIdx] < skeleton.GetNumBones());
+        }
+
+        if (vertex.Position == ig::Vector3{0.f, 0.f, 0.f})
+        {
+            /* 가장 작은 영향(Head, 0.08)은 버려지고, 나머지 네 개의 합이 255 가 되도록 다시 정규화 된다. */
+            bFoundFiveInfluenceVertex = true;
+            constexpr ig::U8 kExpectedWeights[]{111, 69, 42, 33};
+            for (ig::U8 influenceIdx = 0; influenceIdx < ig::SkinnedVertex::kMaxInfluences; ++influenceIdx)
+            {
+                CHECK(vertex.BoneWeights[influenceIdx] == kExpectedWeights[influenceIdx]);
+                CHECK(skeleton.BoneNames[vertex.BoneIndices[influenceIdx]] == kBoneNames[influenceIdx]);
+            }
+        }
+        else if (vertex.Position.x == 1.f && vertex.Position.y == (ig::F32)(kNumBones - 1))
+        {
+            /* 영향이 없는 정점은 루트 Bone 을 따른다. */
+            bFoundUnweightedVertex = true;
+            CHECK(vertex.BoneWeights[0] == 255);
+            CHECK(vertex.BoneIndices[0] == 0);
+        }
+    }
+    CHECK(bFoundFiveInfluenceVertex);
+    CHECK(bFoundUnweightedVertex);
+}
+
+TEST_CASE("Skeletal mesh load stages reject malformed assets", "[Asset][SkeletalMesh]")
+{
+    const ig::Ptr<aiScene> scene{MakeSkinnedScene()};
+    ig::details::SkeletalMeshData meshData{};
+    REQUIRE(ig::details::SkeletalMeshImportStages::Build(*scene, 0, false, meshData) == ig::ESkeletalMeshImportStatus::Success);
+    const ig::SkeletalMeshLoadDesc loadDesc{ig::details::SkeletalMeshImportStages::MakeLoadDesc(meshData)};
+    const ig::Vector<ig::U8> blob{ConcatBlobs(ig::details::SkeletalMeshImportStages::GetBlobs(meshData))};
+
+    ig::details::DecodedSkeletalMesh decoded{};
+    CHECK_FALSE(ig::details::SkeletalMeshLoadStages::Decode(loadDesc, std::span{blob.data(), blob.size() - 1}, decoded));
+
+    /* 압축 된 정점 데이터가 손상 된 경우 */
+    ig::Vector<ig::U8> corruptedBlob{blob};
+    std::fill_n(corruptedBlob.begin(), loadDesc.CompressedVerticesSize, (ig::U8)0xFF);
+    CHECK_FALSE(ig::details::SkeletalMeshLoadStages::Decode(loadDesc, corruptedBlob, decoded));
+
+    /* 부모가 자식 보다 뒤에 오는 계층 */
+    ig::SkeletalMeshLoadDesc invalidSkeletonDesc{loadDesc};
+    invalidSkeletonDesc.BoneParentIndices[1] = 2;
+    CHECK_FALSE(ig::details::SkeletalMeshLoadStages::ValidateSkeleton(invalidSkeletonDesc));
+    invalidSkeletonDesc.BoneParentIndices.pop_back();
+    CHECK_FALSE(ig::details::SkeletalMeshLoadStages::ValidateSkeleton(invalidSkeletonDesc));
+}
+
+TEST_CASE("Skeletal mesh import fails on bones without nodes", "[Asset][SkeletalMesh]")
+{
+    const ig::Ptr<aiScene> scene{MakeSkinnedScene(true)};
+    ig::details::SkeletalMeshData meshData{};
+    CHECK(ig::details::SkeletalMeshImportStages::Build(*scene, 0, true, meshData) == ig::ESkeletalMeshImportStatus::MissingBoneNode);
+}
@@ -0,0 +1,129 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/SoundBank.h"
+
+namespace
+{
+    using SoundBank = ig::details::SoundBank;
+
+    ig::Vector<ig::U8> MakeClip(const ig::Size numBytes, const ig::U32 seed)
+    {
+        std::mt19937 generator{seed};
+        std::uniform_int_distribution<ig::U32> byteDistribution{0, 255};
+        ig::Vector<ig::U8> clip(numBytes);
+        for (ig::U8& byte : clip)
+        {
+            byte = (ig::U8)byteDistribution(generator);
+        }
+        return clip;
+    }
+
+    SoundBank::Entry ReadEntry(const std::span<const ig::U8> bank, const ig::Index entryIdx)
+    {
+        SoundBank::Entry entry{};
+        std::memcpy(&entry, bank.data() + sizeof(SoundBank::Header) + sizeof(SoundBank::Entry) * entryIdx, sizeof(SoundBank::Entry));
+        return entry;
+    }
+
+    void WriteEntry(ig::Vector<ig::U8>& bank, const ig::Index entryIdx, const SoundBank::Entry& entry)
+    {
+        std::memcpy(bank.data() + sizeof(SoundBank::Header) + sizeof(SoundBank::Entry) * entryIdx, &entry, sizeof(SoundBank::Entry));
+    }
+} // namespace
+
+TEST_CASE("SoundBank looks up clip data by entry offset and size", "[Asset][SoundBank]")
+{
+    /* 정렬 단위 경계를 넘나드는 크기와 빈 클립 */
+    const ig::Size clipSizes[]{1, 15, 16, 17, 0, 4096, 333};
+    ig::Vector<ig::Vector<ig::U8>> clips{};
+    for (ig::Index clipIdx = 0; clipIdx < std::size(clipSizes); ++clipIdx)
+    {
+        clips.emplace_back(MakeClip(clipSizes[clipIdx], (ig::U32)clipIdx));
+    }
+
+    const ig::Vector<ig::U8> bank{SoundBank::Build(clips)};
+    REQUIRE(SoundBank::Validate(bank));
+    REQUIRE(SoundBank::GetNumEntries(bank) == clips.size());
+
+    const ig::Size dataBegin = sizeof(SoundBank::Header) + sizeof(SoundBank::Entry) * clips.size();
+    ig::Size prevDataEnd = dataBegin;
+    for (ig::Index clipIdx = 0; clipIdx < clips.size(); ++clipIdx)
+    {
+        INFO("Clip: " << clipIdx);
+        const SoundBank::Entry entry{ReadEntry(bank, clipIdx)};
+        CHECK(entry.Offset % SoundBank::kDataAlignment == 0);
+        CHECK(entry.Size == clips[clipIdx].size());
+        /* 엔트리 들은 Offset Table 이후에 순서대로, 정렬에 필요한 만큼만 떨어져 배치 된다. */
+        CHECK(entry.Offset >= prevDataEnd);
+        CHECK(entry.Offset - prevDataEnd < SoundBank::kDataAlignment);
+        prevDataEnd = entry.Offset + entry.Size;
+
+        const std::span<const ig::U8> entryData{SoundBank::GetEntryData(bank, clipIdx)};
+        CHECK(entryData.data() == bank.data() + entry.Offset);
+        REQUIRE(entryData.size() == clips[clipIdx].size());
+        CHECK(std::equal(entryData.begin(), entryData.end(), clips[clipIdx].begin()));
+    }
+    CHECK(prevDataEnd == bank.size());
+
+    CHECK(SoundBank::GetEntryData(bank, clips.size()).empty());
+    CHECK(SoundBank::GetEntryData(bank, std::numeric_limits<ig::Index>::max()).empty());
+}
+
+TEST_CASE("SoundBank rejects malformed banks", "[Asset][SoundBank]")
+{
+    const ig::Vector<ig::Vector<ig::U8>> clips{MakeClip(100, 0), MakeClip(200, 1)};
+    const ig::Vector<ig::U8> bank{SoundBank::Build(clips)};
+    REQUIRE(SoundBank::Validate(bank));
+
+    SECTION("Empty bank")
+    {
+        const ig::Vector<ig::U8> emptyBank{SoundBank::Build({})};
+        CHECK(emptyBank.size() == sizeof(SoundBank::Header));
+        CHECK(SoundBank::Validate(emptyBank));
+        CHECK(SoundBank::GetNumEntries(emptyBank) == 0);
+        CHECK(SoundBank::GetEntryData(emptyBank, 0).empty());
+    }
+
+    SECTION("Truncated")
+    {
+        CHECK_FALSE(SoundBank::Validate(std::span<const ig::U8>{bank}.first(sizeof(SoundBank::Header) - 1)));
+        /* Offset Table 이 잘린 경우 */
+        CHECK_FALSE(SoundBank::Validate(std::span<const ig::U8>{bank}.first(sizeof(SoundBank::Header) + sizeof(SoundBank::Entry))));
+        /* 마지막 클립 데이터가 잘린 경우 */
+        CHECK_FALSE(SoundBank::Validate(std::span<const ig::U8>{bank}.first(bank.size() - 1)));
+    }
+
+    SECTION("Bad header")
+    {
+        ig::Vector<ig::U8> corruptedBank{bank};
+        SoundBank::Header header{};
+        std::memcpy(&header, corruptedBank.data(), sizeof(SoundBank::Header));
+        header.Version = SoundBank::Header::kVersion + 1;
+        std::memcpy(corruptedBank.data(), &header, sizeof(SoundBank::Header));
+        CHECK_FALSE(SoundBank::Validate(corruptedBank));
+
+        header.Version = SoundBank::Header::kVersion;
+        header.Magic = 0;
+        std::memcpy(corruptedBank.data(), &header, sizeof(SoundBank::Header));
+        CHECK_FALSE(SoundBank::Validate(corruptedBank));
+    }
+
+    SECTION("Entry out of range")
+    {
+        ig::Vector<ig::U8> corruptedBank{bank};
+        SoundBank::Entry entry{ReadEntry(bank, 1)};
+        entry.Size = bank.size() - entry.Offset + 1;
+        WriteEntry(corruptedBank, 1, entry);
+        CHECK_FALSE(SoundBank::Validate(corruptedBank));
+
+        /* Offset + Size 의 Overflow */
+        entry.Offset = 16;
+        entry.Size = std::numeric_limits<ig::U64>::max();
+        WriteEntry(corruptedBank, 1, entry);
+        CHECK_FALSE(SoundBank::Validate(corruptedBank));
+
+        entry.Offset = bank.size() + 1;
+        entry.Size = 0;
+        WriteEntry(corruptedBank, 1, entry);
+        CHECK_FALSE(SoundBank::Validate(corruptedBank));
+    }
+}
@@ -0,0 +1,417 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Filesystem/Utils.h"
+#include "Igniter/Asset/AssetCooker.h"
+#include "Igniter/Asset/StaticMesh.h"
+#include "Igniter/Asset/StaticMeshImporter.h"
+#include "Igniter/Asset/StaticMeshStreamer.h"
+
+namespace
+{
+    /* 임시 디렉터리를 작업 디렉터리로 하여, 'Assets\{Category}\{Guid}' 형식의 에셋 디렉터리를 구성 한다. */
+    class ScopedAssetRoot final
+    {
+    public:
+        ScopedAssetRoot()
+            : previousPath(ig::fs::current_path())
+            , rootPath(ig::fs::temp_directory_path() / std::format("IgniterTests_{}", xg::newGuid().str()))
+        {
+            ig::fs::create_directories(rootPath);
+            ig::fs::current_path(rootPath);
+        }
+
+        ~ScopedAssetRoot()
+        {
+            ig::fs::current_path(previousPath);
+            std::error_code errorCode{};
+            ig::fs::remove_all(rootPath, errorCode);
+        }
+
+    private:
+        ig::Path previousPath;
+        ig::Path rootPath;
+    };
+
+    struct SampleModel
+    {
+    public:
+        std::string Name;
+        ig::Vector<ig::Vector3> Positions;
+        ig::Vector<ig::U32> Indices;
+    };
+
+    /* 극점을 하나의 정점으로 공유하고 경도 방향 이음새가 없는 닫힌 구 */
+    SampleModel MakeSphere(const ig::U32 numSegments, const ig::U32 numRings)
+    {
+        SampleModel model{.Name = "Sphere"};
+        model.Positions.emplace_back(0.f, 1.f, 0.f);
+        for (ig::U32 ring = 1; ring < numRings; ++ring)
+        {
+            const ig::F32 phi = std::numbers::pi_v<ig::F32> * (ig::F32)ring / numRings;
+            for (ig::U32 segment = 0; segment < numSegments; ++segment)
+            {
+                const ig::F32 theta = 2.f * std::numbers::pi_v<ig::F32> * (ig::F32)segment / numSegments;
+                model.Positions.emplace_back(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+            }
+        }
+        model.Positions.emplace_back(0.f, -1.f, 0.f);
+
+        const auto RingVertex = [numSegments](const ig::U32 ring, const ig::U32 segment) { return 1 + (ring - 1) * numSegments + (segment % numSegments); };
+        const ig::U32 bottomPole = (ig::U32)model.Positions.size() - 1;
+        for (ig::U32 segment = 0; segment < numSegments; ++segment)
+        {
+            model.Indices.insert(model.Indices.end(), {0, RingVertex(1, segment + 1), RingVertex(1, segment)});
+            model.Indices.insert(model.Indices.end(), {bottomPole, RingVertex(numRings - 1, segment), RingVertex(numRings - 1, segment + 1)});
+        }
+
+        for (ig::U32 ring = 1; ring + 1 < numRings; ++ring)
+        {
+            for (ig::U32 segment = 0; segment < numSegments; ++segment)
+            {
+                const ig::U32 v0 = RingVertex(ring, segment);
+                const ig::U32 v1 = RingVertex(ring, segment + 1);
+                const ig::U32 v2 = RingVertex(ring + 1, segment);
+                const ig::U32 v3 = RingVertex(ring + 1, segment + 1);
+                model.Indices.insert(model.Indices.end(), {v0, v1, v2, v1, v3, v2});
+            }
+        }
+
+        return model;
+    }
+
+    SampleModel MakeTorus(const ig::U32 numMajorSegments, const ig::U32 numMinorSegments)
+    {
+        constexpr ig::F32 kMajorRadius = 1.f;
+        constexpr ig::F32 kMinorRadius = 0.3f;
+        SampleModel model{.Name = "Torus"};
+        for (ig::U32 major = 0; major < numMajorSegments; ++major)
+        {
+            const ig::F32 theta = 2.f * std::numbers::pi_v<ig::F32> * (ig::F32)major / numMajorSegments;
+            for (ig::U32 minor = 0; minor < numMinorSegments; ++minor)
+            {
+                const ig::F32 phi = 2.f * std::numbers::pi_v<ig::F32> * (ig::F32)minor / numMinorSegments;
+                const ig::F32 radius = kMajorRadius + kMinorRadius * std::cos(phi);
+                model.Positions.emplace_back(radius * std::cos(theta), kMinorRadius * std::sin(phi), radius * std::sin(theta));
+            }
+        }
+
+        for (ig::U32 major = 0; major < numMajorSegments; ++major)
+        {
+            for (ig::U32 minor = 0; minor < numMinorSegments; ++minor)
+            {
+                const ig::U32 nextMajor = (major + 1) % numMajorSegments;
+                const ig::U32 nextMinor = (minor + 1) % numMinorSegments;
+                const ig::U32 v0 = major * numMinorSegments + minor;
+                const ig::U32 v1 = major * numMinorSegments + nextMinor;
+                const ig::U32 v2 = nextMajor * numMinorSegments + minor;
+                const ig::U32 v3 = nextMajor * numMinorSegments + nextMinor;
+                model.Indices.insert(model.Indices.end(), {v0, v1, v2, v1, v3, v2});
+            }
+        }
+
+        return model;
+    }
+
+    /* 삼각형 순서를 섞어 정점 캐시 효율이 낮은 상태로 만든 굴곡 있는 평면 */
+    SampleModel MakeShuffledTerrain(const ig::U32 gridSize)
+    {
+        SampleModel model{.Name = "ShuffledTerrain"};
+        for (ig::U32 y = 0; y <= gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x <= gridSize; ++x)
+            {
+                model.Positions.emplace_back((ig::F32)x, 2.f * std::sin((ig::F32)x * 0.3f) * std::cos((ig::F32)y * 0.2f), (ig::F32)y);
+            }
+        }
+
+        ig::Vector<ig::Array<ig::U32, 3>> triangles{};
+        for (ig::U32 y = 0; y < gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x < gridSize; ++x)
+            {
+                const ig::U32 v0 = y * (gridSize + 1) + x;
+                const ig::U32 v1 = v0 + 1;
+                const ig::U32 v2 = v0 + gridSize + 1;
+                const ig::U32 v3 = v2 + 1;
+                triangles.push_back({v0, v2, v1});
+                triangles.push_back({v1, v2, v3});
+            }
+        }
+
+        std::mt19937 generator{7};
+        std::shuffle(triangles.begin(), triangles.end(), generator);
+        for (const ig::Array<ig::U32, 3>& triangle : triangles)
+        {
+            model.Indices.insert(model.Indices.end(), triangle.begin(), triangle.end());
+        }
+
+        return model;
+    }
+
+    /* 정점 공유가 유지 되도록 Index Buffer 를 가진 glTF 2.0 (+ 외부 .bin 버퍼) 로 기록 한다. */
+    ig::Path WriteGltf(const SampleModel& model)
+    {
+        const ig::Path binPath{std::format("{}.bin", model.Name)};
+        const ig::Path gltfPath{std::format("{}.gltf", model.Name)};
+        const ig::Size positionsSize = sizeof(ig::Vector3) * model.Positions.size();
+        const ig::Size indicesSize = sizeof(ig::U32) * model.Indices.size();
+
+        ig::Vector<ig::U8> buffer(positionsSize + indicesSize);
+        std::memcpy(buffer.data(), model.Positions.data(), positionsSize);
+        std::memcpy(buffer.data() + positionsSize, model.Indices.data(), indicesSize);
+        REQUIRE(ig::SaveBlobToFile(binPath, buffer));
+
+        ig::Vector3 minPosition{FLT_MAX, FLT_MAX, FLT_MAX};
+        ig::Vector3 maxPosition{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+        for (const ig::Vector3& position : model.Positions)
+        {
+            minPosition = ig::Vector3::Min(minPosition, position);
+            maxPosition = ig::Vector3::Max(maxPosition, position);
+        }
+
+        ig::Json primitive{};
+        primitive["attributes"]["POSITION"] = 0;
+        primitive["indices"] = 1;
+        primitive["mode"] = 4;
+        ig::Json mesh{};
+        mesh["name"] = model.Name;
+        mesh["primitives"] = ig::Json::array({primitive});
+
+        ig::Json positionAccessor{};
+        positionAccessor["bufferView"] = 0;
+        positionAccessor["componentType"] = 5126;
+        positionAccessor["count"] = model.Positions.size();
+        positionAccessor["type"] = "VEC3";
+        positionAccessor["min"] = ig::Json::array({minPosition.x, minPosition.y, minPosition.z});
+        positionAccessor["max"] = ig::Json::array({maxPosition.x, maxPosition.y, maxPosition.z});
+        ig::Json indexAccessor{};
+        indexAccessor["bufferView"] = 1;
+        indexAccessor["componentType"] = 5125;
+        indexAccessor["count"] = model.Indices.size();
+        indexAccessor["type"] = "SCALAR";
+
+        ig::Json positionBufferView{};
+        positionBufferView["buffer"] = 0;
+        positionBufferView["byteOffset"] = 0;
+        positionBufferView["byteLength"] = positionsSize;
+        positionBufferView["target"] = 34962;
+        ig::Json indexBufferView{};
+        indexBufferView["buffer"] = 0;
+        indexBufferView["byteOffset"] = positionsSize;
+        indexBufferView["byteLength"] = indicesSize;
+        indexBufferView["target"] = 34963;
+
+        ig::Json gltfBuffer{};
+        gltfBuffer["byteLength"] = buffer.size();
+        gltfBuffer["uri"] = binPath.filename().string();
+
+        ig::Json node{};
+        node["name"] = model.Name;
+        node["mesh"] = 0;
+        ig::Json scene{};
+        scene["nodes"] = ig::Json::array({0});
+
+        ig::Json gltf{};
+        gltf["asset"]["version"] = "2.0";
+        gltf["scene"] = 0;
+        gltf["scenes"] = ig::Json::array({scene});
+        gltf["nodes"] = ig::Json::array({node});
+        gltf["meshes"] = ig::Json::array({mesh});
+        gltf["accessors"] = ig::Json::array({positionAccessor, indexAccessor});
+        gltf["bufferViews"] = ig::Json::array({positionBufferView, indexBufferView});
+        gltf["buffers"] = ig::Json::array({gltfBuffer});
+        REQUIRE(ig::SaveJsonToFile(gltfPath, gltf));
+        return ig::fs::absolute(gltfPath);
+    }
+
+    /* 쿠커를 통해 임포트 하고, 기록 된 메타데이터 로 부터 LoadDesc 를 읽는다. */
+    ig::StaticMesh::LoadDesc CookStaticMesh(ig::AssetCooker& cooker, const ig::Path& modelPath, const ig::StaticMesh::ImportDesc& importDesc)
+    {
+        ig::Json serializedDesc{};
+        serializedDesc << importDesc;
+        const ig::AssetCookItem item{.Category = ig::EAssetCategory::StaticMesh, .Source = modelPath.string(), .SerializedDesc = serializedDesc};
+        const ig::AssetCookReport report{cooker.Cook(std::span{&item, 1})};
+        REQUIRE(report.Records.size() == 1);
+        REQUIRE(report.Records[0].bSucceeded);
+        REQUIRE(report.Records[0].Outputs.size() == 1);
+
+        const ig::Json serializedMetadata{ig::LoadJsonFromFile(ig::MakeAssetMetadataPath(ig::EAssetCategory::StaticMesh, report.Records[0].Outputs[0]))};
+        ig::AssetInfo assetInfo{};
+        ig::StaticMesh::LoadDesc loadDesc{};
+        serializedMetadata >> assetInfo;
+        serializedMetadata >> loadDesc;
+        REQUIRE(assetInfo.GetGuid() == report.Records[0].Outputs[0]);
+        return loadDesc;
+    }
+
+    bool IsSameStatistics(const ig::details::MeshLodStatistics& lhs, const ig::details::MeshLodStatistics& rhs)
+    {
+        return lhs.Acmr == rhs.Acmr && lhs.Atvr == rhs.Atvr && lhs.Overdraw == rhs.Overdraw && lhs.Overfetch == rhs.Overfetch &&
+            lhs.MeshletVertexFill == rhs.MeshletVertexFill && lhs.MeshletTriangleFill == rhs.MeshletTriangleFill;
+    }
+} // namespace
+
+TEST_CASE("StaticMeshImporter records LOD statistics of sample models", "[Asset][StaticMeshImporter]")
+{
+    ScopedAssetRoot scopedRoot{};
+    ig::AssetCooker cooker{};
+    ig::StaticMesh::ImportDesc importDesc{};
+    importDesc.bImproveCacheLocality = true;
+    importDesc.bGenerateLODs = true;
+    importDesc.bBuildClusterHierarchy = false;
+
+    for (const SampleModel& model : {MakeSphere(96, 48), MakeTorus(96, 32), MakeShuffledTerrain(64)})
+    {
+        INFO("Model: " << model.Name);
+        const ig::Path modelPath{WriteGltf(model)};
+        const ig::StaticMesh::LoadDesc loadDesc{CookStaticMesh(cooker, modelPath, importDesc)};
+        REQUIRE(loadDesc.NumLevelOfDetails > 1);
+
+        for (ig::U8 lod = 0; lod < loadDesc.NumLevelOfDetails; ++lod)
+        {
+            INFO("LOD: " << (int)lod);
+            const ig::details::MeshLodStatistics& stats = loadDesc.LevelOfDetailStatistics[lod];
+            /* 삼각형 당 최대 3 개의 정점 변환 */
+            CHECK(stats.Acmr > 0.f);
+            CHECK(stats.Acmr <= 3.f);
+            CHECK(stats.Atvr > 0.f);
+            CHECK(stats.Overdraw >= 1.f);
+            CHECK(stats.Overfetch > 0.f);
+            CHECK(stats.MeshletVertexFill > 0.f);
+            CHECK(stats.MeshletVertexFill <= 1.f);
+            CHECK(stats.MeshletTriangleFill > 0.f);
+            CHECK(stats.MeshletTriangleFill <= 1.f);
+        }
+
+        const ig::details::MeshLodStatistics& unoptimizedStats = loadDesc.UnoptimizedStatistics;
+        const ig::details::MeshLodStatistics& optimizedStats = loadDesc.LevelOfDetailStatistics[0];
+        /* LOD0 는 모든 정점을 참조 하므로, 정점 당 최소 1 번 변환 된다. */
+        CHECK(optimizedStats.Atvr >= 1.f);
+        CHECK(optimizedStats.Acmr <= unoptimizedStats.Acmr);
+        CHECK(optimizedStats.Atvr <= unoptimizedStats.Atvr);
+        if (model.Name == "ShuffledTerrain")
+        {
+            CHECK(optimizedStats.Acmr < unoptimizedStats.Acmr);
+        }
+
+        /* Import Cache 를 통한 임포트 결과 역시 같은 통계를 가져야 한다. */
+        const ig::StaticMesh::LoadDesc cachedLoadDesc{CookStaticMesh(cooker, modelPath, importDesc)};
+        REQUIRE(cachedLoadDesc.NumLevelOfDetails == loadDesc.NumLevelOfDetails);
+        CHECK(IsSameStatistics(cachedLoadDesc.UnoptimizedStatistics, loadDesc.UnoptimizedStatistics));
+        for (ig::U8 lod = 0; lod < loadDesc.NumLevelOfDetails; ++lod)
+        {
+            CHECK(IsSameStatistics(cachedLoadDesc.LevelOfDetailStatistics[lod], loadDesc.LevelOfDetailStatistics[lod]));
+        }
+    }
+}
+
+namespace
+{
+    /* 단순화 오차가 없는 평면. 첫 LOD 에서 최대로 단순화 되므로, 이후 후보들은 인덱스가 줄어들지 않는다. */
+    SampleModel MakeFlatGrid(const ig::U32 gridSize)
+    {
+        SampleModel model{.Name = "FlatGrid"};
+        for (ig::U32 y = 0; y <= gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x <= gridSize; ++x)
+            {
+                model.Positions.emplace_back((ig::F32)x, 0.f, (ig::F32)y);
+            }
+        }
+
+        for (ig::U32 y = 0; y < gridSize; ++y)
+        {
+            for (ig::U32 x = 0; x < gridSize; ++x)
+            {
+                const ig::U32 v0 = y * (gridSize + 1) + x;
+                const ig::U32 v1 = v0 + 1;
+                const ig::U32 v2 = v0 + gridSize + 1;
+                const ig::U32 v3 = v2 + 1;
+                model.Indices.insert(model.Indices.end(), {v0, v2, v1, v1, v2, v3});
+            }
+        }
+
+        return model;
+    }
+
+    ig::StaticMesh::ImportDesc MakeLevelOfDetailImportDesc()
+    {
+        ig::StaticMesh::ImportDesc importDesc{};
+        importDesc.bGenerateLODs = true;
+        importDesc.bBuildClusterHierarchy = false;
+        return importDesc;
+    }
+} // namespace
+
+TEST_CASE("StaticMeshImporter generates LODs with increasing error", "[Asset][StaticMeshImporter]")
+{
+    ScopedAssetRoot scopedRoot{};
+    ig::AssetCooker cooker{};
+    const ig::StaticMesh::LoadDesc loadDesc{CookStaticMesh(cooker, WriteGltf(MakeSphere(96, 48)), MakeLevelOfDetailImportDesc())};
+    REQUIRE(loadDesc.NumLevelOfDetails >= 3);
+    CHECK(loadDesc.LevelOfDetailErrors[0] == 0.f);
+
+    for (ig::U8 lod = 1; lod < loadDesc.NumLevelOfDetails; ++lod)
+    {
+        INFO("LOD: " << (int)lod);
+        CHECK(loadDesc.LevelOfDetailErrors[lod] > 0.f);
+        CHECK(loadDesc.LevelOfDetailErrors[lod] >= loadDesc.LevelOfDetailErrors[lod - 1]);
+        /* 이전 LOD 대비 kMinLodIndexReductionRatio 이하로 줄어든 LOD 만 저장 된다. */
+        CHECK((ig::F32)loadDesc.NumMeshletTriangles[lod] <= (ig::F32)loadDesc.NumMeshletTriangles[lod - 1] * ig::StaticMeshImporter::kMinLodIndexReductionRatio);
+    }
+    CHECK(loadDesc.LevelOfDetailErrors[loadDesc.NumLevelOfDetails - 1] > loadDesc.LevelOfDetailErrors[1]);
+
+    for (ig::U8 lod = loadDesc.NumLevelOfDetails; lod < ig::Mesh::kMaxMeshLevelOfDetails; ++lod)
+    {
+        CHECK(loadDesc.LevelOfDetailErrors[lod] == 0.f);
+        CHECK(loadDesc.NumMeshletTriangles[lod] == 0);
+    }
+}
+
+TEST_CASE("StaticMeshImporter prunes LODs without enough index reduction", "[Asset][StaticMeshImporter]")
+{
+    ScopedAssetRoot scopedRoot{};
+    ig::AssetCooker cooker{};
+    const ig::StaticMesh::LoadDesc loadDesc{CookStaticMesh(cooker, WriteGltf(MakeFlatGrid(32)), MakeLevelOfDetailImportDesc())};
+
+    /* 첫 후보 이후의 모든 후보는 더 이상 줄어들지 않으므로 버려진다. */
+    REQUIRE(loadDesc.NumLevelOfDetails == 2);
+    CHECK(loadDesc.NumMeshletTriangles[0] == 32 * 32 * 2);
+    CHECK((ig::F32)loadDesc.NumMeshletTriangles[1] <= (ig::F32)loadDesc.NumMeshletTriangles[0] * ig::StaticMeshImporter::kMinLodIndexReductionRatio);
+}
+
+TEST_CASE("StaticMeshImporter exports LOD errors and thresholds", "[Asset][StaticMeshImporter]")
+{
+    ScopedAssetRoot scopedRoot{};
+    ig::AssetCooker cooker{};
+    const ig::Path modelPath{WriteGltf(MakeTorus(96, 32))};
+    const ig::StaticMesh::LoadDesc loadDesc{CookStaticMesh(cooker, modelPath, MakeLevelOfDetailImportDesc())};
+    REQUIRE(loadDesc.NumLevelOfDetails > 1);
+
+    /* 임계값은 기록 된 오차와 Bounding Box 로 부터 유도 된 값 이어야 한다. */
+    CHECK(loadDesc.bOverrideLodScreenCoverageThresholds);
+    const ig::Array<ig::F32, ig::Mesh::kMaxMeshLevelOfDetails> expectedThresholds{ig::details::MeshLodStreamingPolicy::ComputeLodScreenCoverageThresholds(
+        loadDesc.LevelOfDetailErrors, loadDesc.NumLevelOfDetails, ig::ToBoundingSphere(loadDesc.BoundingBox).Radius)};
+    for (ig::U8 lod = 0; lod < loadDesc.NumLevelOfDetails; ++lod)
+    {
+        INFO("LOD: " << (int)lod);
+        CHECK(loadDesc.LodScreenCoverageThresholds[lod] == Catch::Approx(expectedThresholds[lod]));
+        if (lod > 0)
+        {
+            CHECK(loadDesc.LodScreenCoverageThresholds[lod] <= loadDesc.LodScreenCoverageThresholds[lod - 1]);
+        }
+    }
+
+    /* 메타데이터 직렬화 및 Import Cache 를 거친 결과는 같아야 한다. */
+    ig::Json serializedLoadDesc{};
+    serializedLoadDesc << loadDesc;
+    ig::StaticMesh::LoadDesc deserializedLoadDesc{};
+    serializedLoadDesc >> deserializedLoadDesc;
+    const ig::StaticMesh::LoadDesc cachedLoadDesc{CookStaticMesh(cooker, modelPath, MakeLevelOfDetailImportDesc())};
+    for (const ig::StaticMesh::LoadDesc& roundTripped : {deserializedLoadDesc, cachedLoadDesc})
+    {
+        REQUIRE(roundTripped.NumLevelOfDetails == loadDesc.NumLevelOfDetails);
+        CHECK(roundTripped.bOverrideLodScreenCoverageThresholds == loadDesc.bOverrideLodScreenCoverageThresholds);
+        CHECK(roundTripped.LevelOfDetailErrors == loadDesc.LevelOfDetailErrors);
+        CHECK(roundTripped.LodScreenCoverageThresholds == loadDesc.LodScreenCoverageThresholds);
+    }
+}
@@ -0,0 +1,258 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/MeshletCodec.h"
+#include "Igniter/Asset/StaticMeshLoader.h"
+
+namespace
+{
+    struct TestLevelOfDetail
+    {
+    public:
+        ig::Vector<ig::U32> VertexIndices{};
+        ig::Vector<ig::U32> Triangles{};
+        ig::Vector<ig::Meshlet> Meshlets{};
+    };
+
+    struct TestStaticMesh
+    {
+    public:
+        ig::StaticMeshLoadDesc LoadDesc{};
+        ig::Vector<ig::U8> Vertices{};
+        ig::Vector<TestLevelOfDetail> LevelOfDetails{};
+        ig::Vector<ig::U8> Blob{};
+    };
+
+    constexpr ig::U32 kNumVerticesPerMeshlet = 8;
+    constexpr ig::U32 kNumTrianglesPerMeshlet = 6;
+
+    TestLevelOfDetail MakeLevelOfDetail(const ig::U32 numMeshlets, const ig::U32 numVertices)
+    {
+        TestLevelOfDetail newLod{};
+        for (ig::U32 meshletIdx = 0; meshletIdx < numMeshlets; ++meshletIdx)
+        {
+            ig::Meshlet meshlet{};
+            meshlet.IndexOffset = static_cast<ig::U32>(newLod.VertexIndices.size());
+            meshlet.NumIndices = kNumVerticesPerMeshlet;
+            meshlet.TriangleOffset = static_cast<ig::U32>(newLod.Triangles.size());
+            meshlet.NumTriangles = kNumTrianglesPerMeshlet;
+            meshlet.BoundingVolume = ig::BoundingSphere{.Centroid = ig::Vector3{(ig::F32)meshletIdx, 1.f, 2.f}, .Radius = 0.5f};
+            meshlet.LodError = 0.01f * meshletIdx;
+            newLod.Meshlets.emplace_back(meshlet);
+
+            for (ig::U32 localIdx = 0; localIdx < kNumVerticesPerMeshlet; ++localIdx)
+            {
+                newLod.VertexIndices.emplace_back((meshletIdx * 3 + localIdx) % numVertices);
+            }
+
+            for (ig::U32 triangleIdx = 0; triangleIdx < kNumTrianglesPerMeshlet; ++triangleIdx)
+            {
+                newLod.Triangles.emplace_back(ig::EncodeTriangleU32(
+                    static_cast<ig::U8>(triangleIdx),
+                    static_cast<ig::U8>(triangleIdx + 1),
+                    static_cast<ig::U8>(triangleIdx + 2)));
+            }
+        }
+
+        return newLod;
+    }
+
+    template <typename T>
+    void AppendBytes(ig::Vector<ig::U8>& dst, const std::span<const T> src)
+    {
+        const ig::U8* srcBytes = reinterpret_cast<const ig::U8*>(src.data());
+        dst.insert(dst.end(), srcBytes, srcBytes + src.size_bytes());
+    }
+
+    /* 가장 거친 LOD 부터 기록 되는 레이아웃(bCoarsestLodFirst) 으로 Blob 을 구성 한다. */
+    TestStaticMesh MakeTestStaticMesh(const bool bCompressedLevelOfDetails)
+    {
+        constexpr ig::U32 kNumVertices = 512;
+        constexpr ig::U8 kNumLevelOfDetails = 3;
+
+        TestStaticMesh testMesh{};
+        ig::StaticMeshLoadDesc& loadDesc{testMesh.LoadDesc};
+        loadDesc.NumVertices = kNumVertices;
+        loadDesc.NumLevelOfDetails = kNumLevelOfDetails;
+        loadDesc.bCoarsestLodFirst = true;
+        loadDesc.bCompressedLevelOfDetails = bCompressedLevelOfDetails;
+        loadDesc.VertexFormat = ig::EVertexFormat::Full;
+
+        const ig::Size vertexSize = ig::GetVertexSize(loadDesc.VertexFormat);
+        testMesh.Vertices.resize(kNumVertices * vertexSize);
+        for (ig::Size byteIdx = 0; byteIdx < testMesh.Vertices.size(); ++byteIdx)
+        {
+            testMesh.Vertices[byteIdx] = static_cast<ig::U8>((byteIdx * 7) ^ (byteIdx >> 5));
+        }
+
+        testMesh.Blob.resize(meshopt_encodeVertexBufferBound(kNumVertices, vertexSize));
+        testMesh.Blob.resize(meshopt_encodeVertexBuffer(testMesh.Blob.data(), testMesh.Blob.size(), testMesh.Vertices.data(), kNumVertices, vertexSize));
+        loadDesc.CompressedVerticesSize = testMesh.Blob.size();
+
+        for (ig::U8 lod = 0; lod < kNumLevelOfDetails; ++lod)
+        {
+            TestLevelOfDetail& newLod{testMesh.LevelOfDetails.emplace_back(MakeLevelOfDetail(64u >> lod, kNumVertices))};
+            loadDesc.NumMeshletVertexIndices[lod] = static_cast<ig::U32>(newLod.VertexIndices.size());
+            loadDesc.NumMeshletTriangles[lod] = static_cast<ig::U32>(newLod.Triangles.size());
+            loadDesc.NumMeshlets[lod] = static_cast<ig::U32>(newLod.Meshlets.size());
+        }
+
+        for (ig::U8 lod = kNumLevelOfDetails; lod-- > 0;)
+        {
+            const TestLevelOfDetail& testLod{testMesh.LevelOfDetails[lod]};
+            if (!bCompressedLevelOfDetails)
+            {
+                AppendBytes(testMesh.Blob, std::span<const ig::U32>{testLod.VertexIndices.data(), testLod.VertexIndices.size()});
+                AppendBytes(testMesh.Blob, std::span<const ig::U32>{testLod.Triangles.data(), testLod.Triangles.size()});
+                AppendBytes(testMesh.Blob, std::span<const ig::Meshlet>{testLod.Meshlets.data(), testLod.Meshlets.size()});
+                continue;
+            }
+
+            const ig::Vector<ig::U8> encodedIndices{ig::details::MeshletCodec::EncodeVertexIndices(testLod.VertexIndices)};
+            const ig::Vector<ig::U8> encodedTriangles{ig::details::MeshletCodec::EncodeTriangles(testLod.Triangles)};
+            const ig::Vector<ig::U8> encodedMeshlets{ig::details::MeshletCodec::EncodeMeshlets(testLod.Meshlets)};
+            loadDesc.CompressedMeshletVertexIndicesSize[lod] = static_cast<ig::U32>(encodedIndices.size());
+            loadDesc.CompressedMeshletTrianglesSize[lod] = static_cast<ig::U32>(encodedTriangles.size());
+            loadDesc.CompressedMeshletsSize[lod] = static_cast<ig::U32>(encodedMeshlets.size());
+            testMesh.Blob.insert(testMesh.Blob.end(), encodedIndices.begin(), encodedIndices.end());
+            testMesh.Blob.insert(testMesh.Blob.end(), encodedTriangles.begin(), encodedTriangles.end());
+            testMesh.Blob.insert(testMesh.Blob.end(), encodedMeshlets.begin(), encodedMeshlets.end());
+        }
+
+        REQUIRE(testMesh.Blob.size() == loadDesc.GetBlobSize());
+        return testMesh;
+    }
+
+    template <typename T>
+    bool IsStorageEqual(const std::span<const ig::U8> storage, const ig::Size storageOffset, const ig::Vector<T>& expected)
+    {
+        const ig::Size numBytes = sizeof(T) * expected.size();
+        return storage.size() >= storageOffset + numBytes &&
+            std::memcmp(storage.data() + storageOffset, expected.data(), numBytes) == 0;
+    }
+
+    class ScopedTempFile final
+    {
+    public:
+        explicit ScopedTempFile(const std::span<const ig::U8> content)
+            : path(ig::fs::temp_directory_path() / std::format("IgniterTests_{}.bin", xg::newGuid().str()))
+        {
+            std::ofstream fileStream{path.c_str(), std::ios::binary};
+            fileStream.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()));
+        }
+
+        ~ScopedTempFile()
+        {
+            std::error_code errorCode{};
+            ig::fs::remove(path, errorCode);
+        }
+
+        [[nodiscard]] const ig::Path& GetPath() const noexcept { return path; }
+
+    private:
+        ig::Path path;
+    };
+} // namespace
+
+TEST_CASE("StaticMeshLoadStages load a mesh into memory storages", "[Asset][StaticMeshLoader]")
+{
+    using namespace ig::details;
+    for (const bool bCompressedLevelOfDetails : {false, true})
+    {
+        INFO("bCompressedLevelOfDetails: " << bCompressedLevelOfDetails);
+        const TestStaticMesh testMesh{MakeTestStaticMesh(bCompressedLevelOfDetails)};
+        const ig::StaticMeshLoadDesc& loadDesc{testMesh.LoadDesc};
+        const ScopedTempFile blobFile{testMesh.Blob};
+
+        /* 모든 LOD 를 상주 시키는 경우와 가장 거친 LOD 만 상주 시키는 경우 */
+        for (const ig::U8 minResidentLod : {ig::U8{0}, loadDesc.GetInitialResidentLevelOfDetail()})
+        {
+            INFO("minResidentLod: " << (ig::U32)minResidentLod);
+            ig::Vector<ig::U8> residentBlob(loadDesc.GetResidentBlobSize(minResidentLod));
+            ig::Size numFirstRegionNotified = 0;
+            REQUIRE(StaticMeshLoadStages::ReadChunked(blobFile.GetPath(), residentBlob, loadDesc.CompressedVerticesSize,
+                [&numFirstRegionNotified]()
+                {
+                    ++numFirstRegionNotified;
+                }));
+            CHECK(numFirstRegionNotified == 1);
+
+            const ig::Size decodedVerticesSize = testMesh.Vertices.size();
+            ig::Size payloadSize = decodedVerticesSize;
+            for (ig::U8 lod = minResidentLod; lod < loadDesc.NumLevelOfDetails; ++lod)
+            {
+                payloadSize += loadDesc.GetDecodedLevelOfDetailSize(lod);
+            }
+
+            ig::Vector<ig::U8> payload(payloadSize);
+            REQUIRE(StaticMeshLoadStages::DecodeVertices(std::span<const ig::U8>{residentBlob.data(), loadDesc.CompressedVerticesSize},
+                loadDesc.NumVertices, ig::GetVertexSize(loadDesc.VertexFormat), std::span<ig::U8>{payload.data(), decodedVerticesSize}));
+
+            /* 저장소의 다른 할당과 겹치지 않는 위치에 업로드 되는지 확인 하기 위해, 0 이 아닌 오프셋을 사용 한다. */
+            constexpr ig::Size kVertexStorageOffset = 256;
+            ig::Vector<MeshUploadCopy> copies{};
+            copies.emplace_back(MeshUploadCopy{.Storage = EMeshStorage::Vertex, .PayloadOffset = 0, .NumBytes = decodedVerticesSize, .StorageOffset = kVertexStorageOffset});
+
+            ig::Array<ig::Size, ig::Mesh::kMaxMeshLevelOfDetails> indexStorageOffsets{};
+            ig::Array<ig::Size, ig::Mesh::kMaxMeshLevelOfDetails> triangleStorageOffsets{};
+            ig::Array<ig::Size, ig::Mesh::kMaxMeshLevelOfDetails> meshletStorageOffsets{};
+            ig::Size indexStorageOffset = 16;
+            ig::Size triangleStorageOffset = 32;
+            ig::Size meshletStorageOffset = 0;
+            ig::Size payloadOffset = decodedVerticesSize;
+            for (ig::U8 lod = minResidentLod; lod < loadDesc.NumLevelOfDetails; ++lod)
+            {
+                const ig::Size decodedLodSize = loadDesc.GetDecodedLevelOfDetailSize(lod);
+                REQUIRE(StaticMeshLoadStages::DecodeLevelOfDetail(loadDesc, lod,
+                    std::span<const ig::U8>{residentBlob.data() + loadDesc.GetLevelOfDetailOffset(lod), loadDesc.GetLevelOfDetailSize(lod)},
+                    std::span<ig::U8>{payload.data() + payloadOffset, decodedLodSize}));
+
+                indexStorageOffsets[lod] = indexStorageOffset;
+                triangleStorageOffsets[lod] = triangleStorageOffset;
+                meshletStorageOffsets[lod] = meshletStorageOffset;
+                const ig::Size nextPayloadOffset = StaticMeshLoadStages::AppendLevelOfDetailCopies(loadDesc, lod, payloadOffset,
+                    indexStorageOffset, triangleStorageOffset, meshletStorageOffset, copies);
+                CHECK(nextPayloadOffset == payloadOffset + decodedLodSize);
+
+                payloadOffset = nextPayloadOffset;
+                indexStorageOffset += sizeof(ig::U32) * loadDesc.NumMeshletVertexIndices[lod];
+                triangleStorageOffset += sizeof(ig::U32) * loadDesc.NumMeshletTriangles[lod];
+                meshletStorageOffset += sizeof(ig::Meshlet) * loadDesc.NumMeshlets[lod];
+            }
+            CHECK(payloadOffset == payloadSize);
+
+            MemoryMeshUploader uploader{};
+            CHECK_FALSE(uploader.Upload(payload, copies).IsValid());
+            CHECK(uploader.GetNumUploads() == 1);
+            CHECK(IsStorageEqual(uploader.GetStorage(EMeshStorage::Vertex), kVertexStorageOffset, testMesh.Vertices));
+            for (ig::U8 lod = minResidentLod; lod < loadDesc.NumLevelOfDetails; ++lod)
+            {
+                const TestLevelOfDetail& expectedLod{testMesh.LevelOfDetails[lod]};
+                CHECK(IsStorageEqual(uploader.GetStorage(EMeshStorage::Index), indexStorageOffsets[lod], expectedLod.VertexIndices));
+                CHECK(IsStorageEqual(uploader.GetStorage(EMeshStorage::Triangle), triangleStorageOffsets[lod], expectedLod.Triangles));
+                CHECK(IsStorageEqual(uploader.GetStorage(EMeshStorage::Meshlet), meshletStorageOffsets[lod], expectedLod.Meshlets));
+            }
+        }
+    }
+}
+
+TEST_CASE("StaticMeshLoadStages reject mismatched regions", "[Asset][StaticMeshLoader]")
+{
+    using namespace ig::details;
+    const TestStaticMesh testMesh{MakeTestStaticMesh(true)};
+    const ig::StaticMeshLoadDesc& loadDesc{testMesh.LoadDesc};
+    constexpr ig::U8 kLod = 0;
+    const std::span<const ig::U8> encodedLod{testMesh.Blob.data() + loadDesc.GetLevelOfDetailOffset(kLod), loadDesc.GetLevelOfDetailSize(kLod)};
+
+    ig::Vector<ig::U8> decodedLod(loadDesc.GetDecodedLevelOfDetailSize(kLod));
+    CHECK(StaticMeshLoadStages::DecodeLevelOfDetail(loadDesc, kLod, encodedLod, decodedLod));
+    CHECK_FALSE(StaticMeshLoadStages::DecodeLevelOfDetail(loadDesc, kLod, encodedLod.subspan(1), decodedLod));
+    CHECK_FALSE(StaticMeshLoadStages::DecodeLevelOfDetail(loadDesc, kLod, encodedLod, std::span<ig::U8>{decodedLod}.subspan(1)));
+
+    ig::Vector<ig::U8> decodedVertices(testMesh.Vertices.size());
+    CHECK_FALSE(StaticMeshLoadStages::DecodeVertices(std::span<const ig::U8>{testMesh.Blob.data(), loadDesc.CompressedVerticesSize},
+        loadDesc.NumVertices + 1, ig::GetVertexSize(loadDesc.VertexFormat), decodedVertices));
+
+    /* 파일이 요청한 크기 보다 작다면 실패 한다. */
+    const ScopedTempFile truncatedFile{std::span<const ig::U8>{testMesh.Blob.data(), testMesh.Blob.size() / 2}};
+    ig::Vector<ig::U8> blob(testMesh.Blob.size());
+    CHECK_FALSE(StaticMeshLoadStages::ReadChunked(truncatedFile.GetPath(), blob, loadDesc.CompressedVerticesSize, {}));
+}
@@ -0,0 +1,277 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/TextureStreamer.h"
+
+namespace
+{
+    using Policy = ig::details::TextureMipStreamingPolicy;
+
+    /* 1024x1024 BC7, Mip 0(1 MiB), Mip 1(256 KiB), Mip 2(64 KiB) 만 스트리밍 되고 Mip 3(128x128) 부터 Mip Tail 이다. */
+    constexpr ig::U16 kTailMip = 3;
+    constexpr ig::U16 kNotRequired = kTailMip;
+
+    ig::TextureLoadDesc MakeLoadDesc()
+    {
+        ig::TextureLoadDesc loadDesc{};
+        loadDesc.Format = DXGI_FORMAT_BC7_UNORM;
+        loadDesc.Width = 1024;
+        loadDesc.Height = 1024;
+        loadDesc.Mips = 11;
+        return loadDesc;
+    }
+
+    ig::details::TextureMipResidency MakeResidency(const ig::U16 mostDetailedResidentMip, const ig::U16 requiredMip, const ig::U64 lastRequiredUpdate)
+    {
+        const ig::TextureLoadDesc loadDesc{MakeLoadDesc()};
+        ig::details::TextureMipResidency residency{};
+        residency.NumMips = loadDesc.Mips;
+        residency.TailMip = Policy::ComputeTailMip(loadDesc);
+        residency.MostDetailedResidentMip = mostDetailedResidentMip;
+        residency.RequiredMip = requiredMip;
+        for (ig::U16 mip = 0; mip < residency.NumMips; ++mip)
+        {
+            residency.MipSizes[mip] = Policy::ComputeMipSize(loadDesc, mip);
+        }
+        residency.LastRequiredUpdates.fill(lastRequiredUpdate);
+        return residency;
+    }
+
+    ig::Size ComputeTotalStreamedSize(const std::span<const ig::details::TextureMipResidency> residencies)
+    {
+        ig::Size streamedSize = 0;
+        for (const ig::details::TextureMipResidency& residency : residencies)
+        {
+            streamedSize += Policy::ComputeStreamedSize(residency);
+        }
+        return streamedSize;
+    }
+
+    /* TextureStreamer 와 같이 결정을 적용 한다. 로드/해제는 즉시 완료 된다고 가정 한다. */
+    void Apply(ig::Vector<ig::details::TextureMipResidency>& residencies, const ig::details::TextureMipStreamingDecision& decision)
+    {
+        for (const ig::details::TextureMipStreamingRequest& eviction : decision.Evictions)
+        {
+            residencies[eviction.ResidencyIdx].MostDetailedResidentMip = eviction.TargetMip;
+        }
+
+        for (const ig::details::TextureMipStreamingRequest& load : decision.Loads)
+        {
+            residencies[load.ResidencyIdx].MostDetailedResidentMip = load.TargetMip;
+        }
+    }
+
+    /* 해제 요청은 unordered map 순서로 생성 되므로, 해제 대상 텍스처 순으로 정렬 하여 비교 한다. */
+    ig::Vector<std::pair<ig::Index, ig::U16>> SortEvictions(const ig::details::TextureMipStreamingDecision& decision)
+    {
+        ig::Vector<std::pair<ig::Index, ig::U16>> evictions{};
+        for (const ig::details::TextureMipStreamingRequest& eviction : decision.Evictions)
+        {
+            evictions.emplace_back(eviction.ResidencyIdx, eviction.TargetMip);
+        }
+        std::sort(evictions.begin(), evictions.end());
+        return evictions;
+    }
+
+    const ig::details::TextureMipResidency kResidency{MakeResidency(0, 0, 0)};
+    const ig::Size kMipSizes[kTailMip]{kResidency.MipSizes[0], kResidency.MipSizes[1], kResidency.MipSizes[2]};
+    const ig::Size kFullStreamedSize = kMipSizes[0] + kMipSizes[1] + kMipSizes[2];
+    constexpr ig::Size kUnlimitedBudget = std::numeric_limits<ig::Size>::max();
+    constexpr ig::Size kUnlimitedLoads = std::numeric_limits<ig::Size>::max();
+} // namespace
+
+TEST_CASE("Texture mip residency excludes the mip tail from the streamed size", "[Asset][TextureMipStreamingPolicy]")
+{
+    REQUIRE(kResidency.TailMip == kTailMip);
+    CHECK(kMipSizes[0] == 1024 * 1024);
+    CHECK(kMipSizes[1] == 256 * 1024);
+    CHECK(kMipSizes[2] == 64 * 1024);
+    CHECK(Policy::ComputeStreamedSize(kResidency) == kFullStreamedSize);
+    CHECK(Policy::ComputeStreamedSize(MakeResidency(kTailMip, kNotRequired, 0)) == 0);
+
+    /* 진행 중인 로드는 로드 될 Mip 까지 예산에 포함 된다. */
+    ig::details::TextureMipResidency pendingResidency{MakeResidency(kTailMip, 0, 0)};
+    pendingResidency.bTransitionPending = true;
+    pendingResidency.PendingMip = 1;
+    CHECK(Policy::ComputeStreamedSize(pendingResidency) == kMipSizes[1] + kMipSizes[2]);
+}
+
+TEST_CASE("Texture mip promotion under budget", "[Asset][TextureMipStreamingPolicy]")
+{
+    /* 요구 된 Mip 과의 차이: 0 -> 1, 1 -> 3, 2 -> 2 */
+    ig::Vector<ig::details::TextureMipResidency> residencies{MakeResidency(kTailMip, 2, 1), MakeResidency(kTailMip, 0, 1),
+        MakeResidency(kTailMip, 1, 1)};
+
+    SECTION("Unlimited loads")
+    {
+        const ig::details::TextureMipStreamingDecision decision{Policy::Decide(residencies, kUnlimitedBudget, kUnlimitedLoads)};
+        CHECK(decision.Evictions.empty());
+        REQUIRE(decision.Loads.size() == residencies.size());
+        for (const ig::details::TextureMipStreamingRequest& load : decision.Loads)
+        {
+            INFO("Residency: " << load.ResidencyIdx);
+            /* 요구 된 Mip 까지 한번에 로드 한다. */
+            CHECK(load.TargetMip == residencies[load.ResidencyIdx].RequiredMip);
+        }
+
+        Apply(residencies, decision);
+        CHECK(ComputeTotalStreamedSize(residencies) == kMipSizes[2] + kFullStreamedSize + (kMipSizes[1] + kMipSizes[2]));
+        /* 요구가 충족 되면 더 이상의 결정은 없다. */
+        const ig::details::TextureMipStreamingDecision nextDecision{Policy::Decide(residencies, kUnlimitedBudget, kUnlimitedLoads)};
+        CHECK(nextDecision.Loads.empty());
+        CHECK(nextDecision.Evictions.empty());
+    }
+
+    SECTION("Limited loads")
+    {
+        /* 요구 된 Mip 과의 차이가 큰 텍스처 부터 로드 한다. */
+        const ig::details::TextureMipStreamingDecision decision{Policy::Decide(residencies, kUnlimitedBudget, 2)};
+        CHECK(decision.Evictions.empty());
+        REQUIRE(decision.Loads.size() == 2);
+        CHECK(decision.Loads[0].ResidencyIdx == 1);
+        CHECK(decision.Loads[0].TargetMip == 0);
+        CHECK(decision.Loads[1].ResidencyIdx == 2);
+        CHECK(decision.Loads[1].TargetMip == 1);
+
+        Apply(residencies, decision);
+        const ig::details::TextureMipStreamingDecision nextDecision{Policy::Decide(residencies, kUnlimitedBudget, 2)};
+        REQUIRE(nextDecision.Loads.size() == 1);
+        CHECK(nextDecision.Loads[0].ResidencyIdx == 0);
+        CHECK(nextDecision.Loads[0].TargetMip == 2);
+    }
+
+    SECTION("Exact budget")
+    {
+        const ig::Size budget = kMipSizes[2] + kFullStreamedSize + (kMipSizes[1] + kMipSizes[2]);
+        const ig::details::TextureMipStreamingDecision decision{Policy::Decide(residencies, budget, kUnlimitedLoads)};
+        CHECK(decision.Evictions.empty());
+        CHECK(decision.Loads.size() == residencies.size());
+        Apply(residencies, decision);
+        CHECK(ComputeTotalStreamedSize(residencies) == budget);
+    }
+}
+
+TEST_CASE("Texture mip eviction follows the least recently required order", "[Asset][TextureMipStreamingPolicy]")
+{
+    /* A(마지막 요구: 1), B(3), C(2) 는 더 이상 요구 되지 않으며, D 가 Mip 0 을 새로 요구 한다. */
+    ig::Vector<ig::details::TextureMipResidency> residencies{MakeResidency(0, kNotRequired, 1), MakeResidency(0, kNotRequired, 3),
+        MakeResidency(0, kNotRequired, 2), MakeResidency(kTailMip, 0, 4)};
+    const ig::Size streamedSize = ComputeTotalStreamedSize(residencies);
+    REQUIRE(streamedSize == 3 * kFullStreamedSize);
+
+    struct Expectation
+    {
+        ig::Size Budget;
+        ig::Vector<std::pair<ig::Index, ig::U16>> Evictions;
+    };
+
+    /* 같은 텍스처 내 에서는 세밀한 Mip 부터, 텍스처 간 에는 가장 오랫동안 요구 되지 않은 텍스처 부터 필요한 만큼만 해제 한다. */
+    const Expectation expectations[]{
+        {streamedSize + kFullStreamedSize, {}},
+        {streamedSize + kFullStreamedSize - kMipSizes[0], {{0, 1}}},
+        {streamedSize + kFullStreamedSize - kMipSizes[0] - kMipSizes[1], {{0, 2}}},
+        {streamedSize, {{0, kTailMip}}},
+        {streamedSize - kMipSizes[0], {{0, kTailMip}, {2, 1}}},
+        {streamedSize - kFullStreamedSize - kMipSizes[0], {{0, kTailMip}, {1, 1}, {2, kTailMip}}},
+    };
+
+    for (const Expectation& expectation : expectations)
+    {
+        INFO("Budget: " << expectation.Budget);
+        ig::Vector<ig::details::TextureMipResidency> steppedResidencies{residencies};
+        const ig::details::TextureMipStreamingDecision decision{Policy::Decide(steppedResidencies, expectation.Budget, kUnlimitedLoads)};
+        CHECK(SortEvictions(decision) == expectation.Evictions);
+        REQUIRE(decision.Loads.size() == 1);
+        CHECK(decision.Loads[0].ResidencyIdx == 3);
+        CHECK(decision.Loads[0].TargetMip == 0);
+
+        Apply(steppedResidencies, decision);
+        CHECK(ComputeTotalStreamedSize(steppedResidencies) <= expectation.Budget);
+    }
+}
+
+TEST_CASE("Unreferenced textures are trimmed down to the mip tail", "[Asset][TextureMipStreamingPolicy]")
+{
+    /*
+     * TextureStreamer 는 캐시에 유지(Keep-Alive) 되고 있는 텍스처를 곧바로 Mip Tail 로 되돌린다.
+     * 정책 에서는 요구 되지 않은 텍스처(RequiredMip == TailMip)가 예산 압박 시 같은 결과(Mip Tail)로 수렴 해야 하며,
+     * 피드백 으로 Mip Tail 보다 거친 Mip 이 요구 되더라도 Mip Tail 은 해제 되지 않는다.
+     */
+    ig::Vector<ig::details::TextureMipResidency> residencies{MakeResidency(0, kNotRequired, 1), MakeResidency(1, kResidency.NumMips - 1, 1),
+        MakeResidency(kTailMip, kNotRequired, 1)};
+
+    const ig::details::TextureMipStreamingDecision decision{Policy::Decide(residencies, 0, kUnlimitedLoads)};
+    CHECK(decision.Loads.empty());
+    const ig::Vector<std::pair<ig::Index, ig::U16>> expectedEvictions{{0, kTailMip}, {1, kTailMip}};
+    CHECK(SortEvictions(decision) == expectedEvictions);
+
+    Apply(residencies, decision);
+    CHECK(ComputeTotalStreamedSize(residencies) == 0);
+    for (const ig::details::TextureMipResidency& residency : residencies)
+    {
+        CHECK(residency.MostDetailedResidentMip == kTailMip);
+    }
+
+    /* Mip Tail 만 상주 한다면 더 이상 해제 할 것이 없다. */
+    const ig::details::TextureMipStreamingDecision nextDecision{Policy::Decide(residencies, 0, kUnlimitedLoads)};
+    CHECK(nextDecision.Loads.empty());
+    CHECK(nextDecision.Evictions.empty());
+
+    SECTION("Under budget")
+    {
+        /* 예산이 충분 하다면 요구 되지 않더라도 해제 하지 않는다. */
+        ig::Vector<ig::details::TextureMipResidency> residentResidencies{MakeResidency(0, kNotRequired, 1)};
+        const ig::details::TextureMipStreamingDecision residentDecision{Policy::Decide(residentResidencies, kFullStreamedSize, kUnlimitedLoads)};
+        CHECK(residentDecision.Loads.empty());
+        CHECK(residentDecision.Evictions.empty());
+    }
+}
+
+TEST_CASE("Texture mip streaming when the budget is exceeded", "[Asset][TextureMipStreamingPolicy]")
+{
+    SECTION("Compromise to a coarser mip")
+    {
+        /* 요구 된 Mip 0 이 예산 내에 들어오지 않는다면, 들어오는 가장 세밀한 Mip 까지 로드 한다. */
+        const ig::details::TextureMipResidency residencies[]{MakeResidency(kTailMip, 0, 1)};
+        const ig::details::TextureMipStreamingDecision decision{Policy::Decide(residencies, kMipSizes[1] + kMipSizes[2], kUnlimitedLoads)};
+        CHECK(decision.Evictions.empty());
+        REQUIRE(decision.Loads.size() == 1);
+        CHECK(decision.Loads[0].TargetMip == 1);
+
+        const ig::details::TextureMipStreamingDecision noLoadDecision{Policy::Decide(residencies, kMipSizes[2] - 1, kUnlimitedLoads)};
+        CHECK(noLoadDecision.Evictions.empty());
+        CHECK(noLoadDecision.Loads.empty());
+    }
+
+    SECTION("Required mips are never evicted")
+    {
+        /* A 는 Mip 0, B 는 Mip 1 을 요구 한다. 예산이 줄어들면 요구 되지 않은 B 의 Mip 0 만 해제 된다. */
+        ig::Vector<ig::details::TextureMipResidency> residencies{MakeResidency(0, 0, 1), MakeResidency(0, 1, 1)};
+        const ig::details::TextureMipStreamingDecision decision{Policy::Decide(residencies, 0, kUnlimitedLoads)};
+        CHECK(decision.Loads.empty());
+        const ig::Vector<std::pair<ig::Index, ig::U16>> expectedEvictions{{1, 1}};
+        CHECK(SortEvictions(decision) == expectedEvictions);
+
+        Apply(residencies, decision);
+        CHECK(ComputeTotalStreamedSize(residencies) == kFullStreamedSize + kMipSizes[1] + kMipSizes[2]);
+        CHECK(Policy::Decide(residencies, 0, kUnlimitedLoads).Evictions.empty());
+    }
+
+    SECTION("Pending transitions")
+    {
+        /* 진행 중인 로드는 예산에 포함 되지만, 해제 대상이 되지 않는다. */
+        ig::details::TextureMipResidency pendingResidency{MakeResidency(kTailMip, 0, 1)};
+        pendingResidency.bTransitionPending = true;
+        pendingResidency.PendingMip = 0;
+        const ig::details::TextureMipResidency residencies[]{pendingResidency, MakeResidency(kTailMip, 0, 1)};
+
+        const ig::details::TextureMipStreamingDecision decision{Policy::Decide(residencies, kFullStreamedSize, kUnlimitedLoads)};
+        CHECK(decision.Evictions.empty());
+        CHECK(decision.Loads.empty());
+
+        const ig::details::TextureMipStreamingDecision partialDecision{
+            Policy::Decide(residencies, kFullStreamedSize + kMipSizes[2], kUnlimitedLoads)};
+        CHECK(partialDecision.Evictions.empty());
+        REQUIRE(partialDecision.Loads.size() == 1);
+        CHECK(partialDecision.Loads[0].ResidencyIdx == 1);
+        CHECK(partialDecision.Loads[0].TargetMip == 2);
+    }
+}
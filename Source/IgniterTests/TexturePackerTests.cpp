@@ -0,0 +1,212 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Asset/TexturePacker.h"
+
+namespace
+{
+    using ig::details::TexturePacker;
+
+    /* 정렬 단위(Cell)로 표현 된 아틀라스 내의 Footprint */
+    struct CellRect
+    {
+    public:
+        [[nodiscard]] bool Overlaps(const CellRect& other) const noexcept
+        {
+            return X < other.X + other.Width && other.X < X + Width && Y < other.Y + other.Height && other.Y < Y + Height;
+        }
+
+    public:
+        ig::U32 X = 0;
+        ig::U32 Y = 0;
+        ig::U32 Width = 0;
+        ig::U32 Height = 0;
+    };
+
+    ig::Vector<ig::details::TexturePackingSource> MakeRandomSources(const ig::Size numSources, const ig::U32 seed)
+    {
+        constexpr DXGI_FORMAT kFormats[]{DXGI_FORMAT_R8G8B8A8_UNORM, DXGI_FORMAT_R8G8B8A8_UNORM_SRGB};
+        std::mt19937 generator{seed};
+        std::uniform_int_distribution<ig::U32> extentDistribution{1, 50};
+        std::uniform_int_distribution<ig::Size> formatDistribution{0, std::size(kFormats) - 1};
+
+        ig::Vector<ig::details::TexturePackingSource> sources{};
+        for (ig::Size sourceIdx = 0; sourceIdx < numSources; ++sourceIdx)
+        {
+            sources.emplace_back(ig::details::TexturePackingSource{
+                .Format = kFormats[formatDistribution(generator)], .Width = extentDistribution(generator) * 4, .Height = extentDistribution(generator) * 4});
+        }
+        return sources;
+    }
+} // namespace
+
+TEST_CASE("TexturePacker computes mip counts", "[Asset][TexturePacker]")
+{
+    CHECK(TexturePacker::ComputeNumMips(0, 0) == 1);
+    CHECK(TexturePacker::ComputeNumMips(1, 1) == 1);
+    CHECK(TexturePacker::ComputeNumMips(256, 100) == 9);
+    CHECK(TexturePacker::ComputeNumMips(3, 1024) == 11);
+
+    CHECK(TexturePacker::ComputeAtlasPadding(1) == 1);
+    CHECK(TexturePacker::ComputeAtlasPadding(4) == 8);
+    CHECK(TexturePacker::ComputeAtlasAlignment(4, false) == 8);
+    CHECK(TexturePacker::ComputeAtlasAlignment(4, true) == 32);
+}
+
+TEST_CASE("TexturePacker fills a skyline bin without overlaps", "[Asset][TexturePacker]")
+{
+    SECTION("Rects that exactly cover the bin")
+    {
+        const ig::details::SkylineRect rects[]{{2, 2}, {2, 2}, {4, 1}, {1, 1}, {3, 1}};
+        ig::details::SkylinePosition positions[std::size(rects)]{};
+        REQUIRE(TexturePacker::PackSkyline(4, 4, rects, positions));
+
+        ig::U32 coverage[4][4]{};
+        for (ig::Size rectIdx = 0; rectIdx < std::size(rects); ++rectIdx)
+        {
+            REQUIRE(positions[rectIdx].bPacked);
+            for (ig::U32 y = positions[rectIdx].Y; y < positions[rectIdx].Y + rects[rectIdx].Height; ++y)
+            {
+                for (ig::U32 x = positions[rectIdx].X; x < positions[rectIdx].X + rects[rectIdx].Width; ++x)
+                {
+                    REQUIRE(x < 4);
+                    REQUIRE(y < 4);
+                    ++coverage[y][x];
+                }
+            }
+        }
+
+        for (const auto& row : coverage)
+        {
+            for (const ig::U32 numCovered : row)
+            {
+                CHECK(numCovered == 1);
+            }
+        }
+    }
+
+    SECTION("Rects that do not fit")
+    {
+        const ig::details::SkylineRect rects[]{{3, 3}, {5, 1}, {2, 2}, {0, 1}};
+        ig::details::SkylinePosition positions[std::size(rects)]{};
+        CHECK_FALSE(TexturePacker::PackSkyline(4, 4, rects, positions));
+        CHECK(positions[0].bPacked);
+        CHECK_FALSE(positions[1].bPacked);
+        /* 3x3 이 배치 된 후 남은 L 자 영역에는 2x2 가 들어갈 수 없다. */
+        CHECK_FALSE(positions[2].bPacked);
+        CHECK_FALSE(positions[3].bPacked);
+    }
+}
+
+TEST_CASE("TexturePacker groups same sized sources into texture arrays", "[Asset][TexturePacker]")
+{
+    const ig::details::TexturePackingSource sources[]{
+        {DXGI_FORMAT_BC7_UNORM, 64, 64},
+        {DXGI_FORMAT_BC7_UNORM, 32, 32},
+        {DXGI_FORMAT_BC7_UNORM, 64, 64},
+        {DXGI_FORMAT_BC1_UNORM, 64, 64},
+        {DXGI_FORMAT_BC7_UNORM, 64, 64},
+        /* 블록 크기에 정렬 되지 않은 소스는 배열로 묶이지 않는다. */
+        {DXGI_FORMAT_BC7_UNORM, 30, 30},
+        {DXGI_FORMAT_BC7_UNORM, 30, 30},
+    };
+    const ig::details::TexturePackingPlan plan{
+        TexturePacker::Plan(sources, ig::details::TexturePackingConfig{.MaxAtlasExtent = 256, .MinArrayLength = 2, .bBlockCompressed = true})};
+    REQUIRE(plan.Placements.size() == std::size(sources));
+
+    const ig::Index arrayPageIdx = plan.Placements[0].PageIdx;
+    REQUIRE(arrayPageIdx < plan.Pages.size());
+    const ig::details::TexturePackPage& arrayPage = plan.Pages[arrayPageIdx];
+    CHECK(arrayPage.Kind == ig::details::ETexturePackKind::Array);
+    CHECK(arrayPage.Format == DXGI_FORMAT_BC7_UNORM);
+    CHECK(arrayPage.Width == 64);
+    CHECK(arrayPage.ArrayLength == 3);
+    CHECK(arrayPage.Mips == 7);
+
+    ig::UnorderedSet<ig::U16> slices{};
+    for (const ig::Size sourceIdx : {0, 2, 4})
+    {
+        CHECK(plan.Placements[sourceIdx].PageIdx == arrayPageIdx);
+        CHECK(plan.Placements[sourceIdx].ArraySlice < arrayPage.ArrayLength);
+        slices.insert(plan.Placements[sourceIdx].ArraySlice);
+    }
+    CHECK(slices.size() == 3);
+
+    for (const ig::Size sourceIdx : {1, 3, 5, 6})
+    {
+        INFO("Source: " << sourceIdx);
+        REQUIRE(plan.Placements[sourceIdx].IsPacked());
+        const ig::details::TexturePackPage& page = plan.Pages[plan.Placements[sourceIdx].PageIdx];
+        CHECK(page.Kind == ig::details::ETexturePackKind::Atlas);
+        CHECK(page.Format == sources[sourceIdx].Format);
+    }
+}
+
+TEST_CASE("TexturePacker atlas footprints are aligned and disjoint", "[Asset][TexturePacker]")
+{
+    for (const bool bBlockCompressed : {false, true})
+    {
+        INFO("Block Compressed: " << bBlockCompressed);
+        const ig::details::TexturePackingConfig config{
+            .MaxAtlasExtent = 512, .MinArrayLength = std::numeric_limits<ig::U16>::max(), .MaxAtlasMips = 4, .bBlockCompressed = bBlockCompressed};
+        ig::Vector<ig::details::TexturePackingSource> sources{MakeRandomSources(96, 0xA71A5)};
+        /* 아틀라스 보다 큰 소스 */
+        sources.emplace_back(ig::details::TexturePackingSource{.Format = DXGI_FORMAT_R8G8B8A8_UNORM, .Width = 512, .Height = 64});
+
+        const ig::details::TexturePackingPlan plan{TexturePacker::Plan(sources, config)};
+        REQUIRE(plan.Placements.size() == sources.size());
+        CHECK_FALSE(plan.Placements.back().IsPacked());
+
+        const ig::U32 padding = TexturePacker::ComputeAtlasPadding(config.MaxAtlasMips);
+        const ig::U32 alignment = TexturePacker::ComputeAtlasAlignment(config.MaxAtlasMips, bBlockCompressed);
+        ig::Vector<ig::Vector<CellRect>> pageFootprints(plan.Pages.size());
+        for (ig::Size sourceIdx = 0; sourceIdx + 1 < sources.size(); ++sourceIdx)
+        {
+            INFO("Source: " << sourceIdx);
+            const ig::details::TexturePackingSource& source = sources[sourceIdx];
+            const ig::details::TexturePackPlacement& placement = plan.Placements[sourceIdx];
+            REQUIRE(placement.IsPacked());
+            const ig::details::TexturePackPage& page = plan.Pages[placement.PageIdx];
+            CHECK(page.Kind == ig::details::ETexturePackKind::Atlas);
+            CHECK(page.Format == source.Format);
+            CHECK(page.Padding == padding);
+            CHECK(page.Mips == config.MaxAtlasMips);
+            CHECK(page.Width <= config.MaxAtlasExtent);
+            CHECK(page.Height <= config.MaxAtlasExtent);
+            CHECK(page.Width % alignment == 0);
+            CHECK(page.Height % alignment == 0);
+
+            /* Footprint 의 시작은 마지막 Mip 의 Texel(BC 의 경우 블록) 격자에 정렬 되어야 한다. */
+            REQUIRE(placement.OffsetX >= padding);
+            REQUIRE(placement.OffsetY >= padding);
+            CHECK((placement.OffsetX - padding) % alignment == 0);
+            CHECK((placement.OffsetY - padding) % alignment == 0);
+            CHECK(placement.OffsetX + source.Width + padding <= page.Width);
+            CHECK(placement.OffsetY + source.Height + padding <= page.Height);
+
+            pageFootprints[placement.PageIdx].emplace_back(CellRect{
+                .X = (placement.OffsetX - padding) / alignment,
+                .Y = (placement.OffsetY - padding) / alignment,
+                .Width = (source.Width + 2 * padding + alignment - 1) / alignment,
+                .Height = (source.Height + 2 * padding + alignment - 1) / alignment});
+        }
+
+        for (const ig::Vector<CellRect>& footprints : pageFootprints)
+        {
+            for (ig::Size lhsIdx = 0; lhsIdx < footprints.size(); ++lhsIdx)
+            {
+                for (ig::Size rhsIdx = lhsIdx + 1; rhsIdx < footprints.size(); ++rhsIdx)
+                {
+                    CHECK_FALSE(footprints[lhsIdx].Overlaps(footprints[rhsIdx]));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("TexturePacker skips sources without extent", "[Asset][TexturePacker]")
+{
+    const ig::details::TexturePackingSource sources[]{{DXGI_FORMAT_R8G8B8A8_UNORM, 0, 16}, {DXGI_FORMAT_R8G8B8A8_UNORM, 0, 16}};
+    const ig::details::TexturePackingPlan plan{TexturePacker::Plan(sources, ig::details::TexturePackingConfig{})};
+    CHECK(plan.Pages.empty());
+    CHECK_FALSE(plan.Placements[0].IsPacked());
+    CHECK_FALSE(plan.Placements[1].IsPacked());
+}
@@ -0,0 +1,108 @@
+#include "IgniterTests/IgniterTests.h"
+#include "Igniter/Render/Vertex.h"
+
+namespace
+{
+    constexpr ig::Size kNumSamples = 4096;
+
+    ig::Vector3 MakeRandomUnitVector(std::mt19937& generator)
+    {
+        std::uniform_real_distribution<ig::F32> distribution{-1.f, 1.f};
+        while (true)
+        {
+            ig::Vector3 vector{distribution(generator), distribution(generator), distribution(generator)};
+            if (const ig::F32 length = vector.Length();
+                length > 0.1f && length <= 1.f)
+            {
+                return vector / length;
+            }
+        }
+    }
+} // namespace
+
+TEST_CASE("Unorm16 quantization stays within half a step", "[Render][Vertex]")
+{
+    constexpr ig::F32 kOffset = -12.5f;
+    constexpr ig::F32 kScale = 40.f;
+    /* 반올림 하므로 최대 오차는 반 단계. 부동 소수점 오차를 위해 약간의 여유를 둔다. */
+    constexpr ig::F32 kMaxError = kScale / 65535.f * 0.5f * 1.01f;
+
+    std::mt19937 generator{0x1234};
+    std::uniform_real_distribution<ig::F32> distribution{kOffset, kOffset + kScale};
+    for (ig::Size sampleIdx = 0; sampleIdx < kNumSamples; ++sampleIdx)
+    {
+        const ig::F32 value = distribution(generator);
+        const ig::F32 dequantized = ig::DequantizeUnorm16(ig::QuantizeUnorm16(value, kOffset, kScale), kOffset, kScale);
+        CHECK(std::abs(dequantized - value) <= kMaxError);
+    }
+
+    CHECK(ig::QuantizeUnorm16(kOffset, kOffset, kScale) == 0);
+    CHECK(ig::QuantizeUnorm16(kOffset + kScale, kOffset, kScale) == 65535);
+    /* 범위 밖의 값은 경계로 고정 된다. */
+    CHECK(ig::QuantizeUnorm16(kOffset - 1.f, kOffset, kScale) == 0);
+    CHECK(ig::QuantizeUnorm16(kOffset + kScale + 1.f, kOffset, kScale) == 65535);
+    /* 한 축으로 납작한 메시 */
+    CHECK(ig::QuantizeUnorm16(3.f, 3.f, 0.f) == 0);
+    CHECK(ig::DequantizeUnorm16(0, 3.f, 0.f) == 3.f);
+}
+
+TEST_CASE("Quantized vertex positions stay inside the mesh bounds", "[Render][Vertex]")
+{
+    const ig::AABB bounds{ig::Vector3{-3.f, 0.f, 10.f}, ig::Vector3{5.f, 0.5f, 110.f}};
+    const ig::VertexDequantization dequantization{ig::MakeVertexDequantization(bounds, ig::Vector2{0.f, 0.f}, ig::Vector2{1.f, 1.f})};
+    const ig::Vector3 maxError{dequantization.PositionScale / 65535.f * 0.5f * 1.01f};
+
+    std::mt19937 generator{0x5678};
+    std::uniform_real_distribution<ig::F32> distribution{0.f, 1.f};
+    for (ig::Size sampleIdx = 0; sampleIdx < kNumSamples; ++sampleIdx)
+    {
+        ig::Vertex vertex{};
+        vertex.Position = bounds.Min + (bounds.Max - bounds.Min) * ig::Vector3{distribution(generator), distribution(generator), distribution(generator)};
+        vertex.QuantizedNormal = ig::EncodeNormalX10Y10Z10(ig::Vector3{0.f, 0.f, 1.f});
+        vertex.QuantizedTangent = ig::EncodeNormalX10Y10Z10(ig::Vector3{1.f, 0.f, 0.f});
+        vertex.QuantizedBitangent = ig::EncodeNormalX10Y10Z10(ig::Vector3{0.f, 1.f, 0.f});
+
+        const ig::Vector3 position{ig::DequantizePosition(ig::QuantizeVertex(vertex, dequantization), dequantization)};
+        CHECK(std::abs(position.x - vertex.Position.x) <= maxError.x);
+        CHECK(std::abs(position.y - vertex.Position.y) <= maxError.y);
+        CHECK(std::abs(position.z - vertex.Position.z) <= maxError.z);
+        CHECK((position.x >= bounds.Min.x && position.y >= bounds.Min.y && position.z >= bounds.Min.z));
+        CHECK((position.x <= bounds.Max.x && position.y <= bounds.Max.y && position.z <= bounds.Max.z));
+    }
+}
+
+TEST_CASE("Tangent frame encoding preserves the frame", "[Render][Vertex]")
+{
+    /* Octahedral 10 Bits 와 각도 11 Bits 의 오차는 1도 미만 이어야 한다. */
+    const ig::F32 kMinCosine = std::cos(1.f * std::numbers::pi_v<ig::F32> / 180.f);
+
+    std::mt19937 generator{0x9ABC};
+    for (ig::Size sampleIdx = 0; sampleIdx < kNumSamples; ++sampleIdx)
+    {
+        const ig::Vector3 normal{MakeRandomUnitVector(generator)};
+        ig::Vector3 tangent{normal.Cross(MakeRandomUnitVector(generator))};
+        if (tangent.Length() < 0.1f)
+        {
+            continue;
+        }
+        tangent.Normalize();
+        const ig::F32 bitangentSign = (sampleIdx & 1) != 0 ? -1.f : 1.f;
+        const ig::Vector3 bitangent{normal.Cross(tangent) * bitangentSign};
+
+        ig::Vector3 decodedNormal{};
+        ig::Vector3 decodedTangent{};
+        ig::Vector3 decodedBitangent{};
+        ig::DecodeTangentFrame(ig::EncodeTangentFrame(normal, tangent, bitangent), decodedNormal, decodedTangent, decodedBitangent);
+        CHECK(decodedNormal.Dot(normal) >= kMinCosine);
+        CHECK(decodedTangent.Dot(tangent) >= kMinCosine);
+        CHECK(decodedBitangent.Dot(bitangent) >= kMinCosine);
+    }
+}
+
+TEST_CASE("Vertex formats have the expected sizes", "[Render][Vertex]")
+{
+    CHECK(ig::GetVertexSize(ig::EVertexFormat::Full) == sizeof(ig::Vertex));
+    CHECK(ig::GetVertexSize(ig::EVertexFormat::Quantized) == 16);
+    CHECK(ig::GetVertexSize(ig::EVertexFormat::QuantizedUnormTexCoords) == 16);
+    CHECK(ig::GetVertexSize(ig::EVertexFormat::Quantized) * 2 <= sizeof(ig::Vertex));
+}
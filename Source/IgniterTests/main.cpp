@@ -0,0 +1,10 @@
+#include "IgniterTests/IgniterTests.h"
+
+/*
+ * IgniterTests [Catch2 Options]
+ * 벤치마크는 '[!benchmark]' 태그로 분리 되어 있으며, 명시적으로 지정한 경우에만 실행 된다. (ex. IgniterTests "[!benchmark]")
+ */
+int main(int argc, char** argv)
+{
+    return Catch::Session().run(argc, argv);
+}